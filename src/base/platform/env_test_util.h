@@ -0,0 +1,24 @@
+#ifndef BASE_PLATFORM_ENV_TEST_UTIL_H_
+#define BASE_PLATFORM_ENV_TEST_UTIL_H_
+
+#include "base/platform/env.h"
+
+namespace base {
+
+// 测试用的 Env: NowMicros 返回手动设置的时间, 其他调用转发给 Env::Default().
+// 不是线程安全的, 只在驱动测试的线程里推进时间.
+class FakeClockEnv : public EnvDecorator {
+ public:
+  explicit FakeClockEnv(uint64 now_micros = 1000000)
+    : EnvDecorator(Env::Default()), now_(now_micros) {}
+
+  uint64 NowMicros() override { return now_; }
+  void set_now(uint64 now_micros) { now_ = now_micros; }
+  void AdvanceMillis(int64 ms) { now_ += ms * 1000; }
+
+ private:
+  uint64 now_;
+};
+
+} // namespace base
+#endif // BASE_PLATFORM_ENV_TEST_UTIL_H_
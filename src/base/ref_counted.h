@@ -4,6 +4,7 @@
 #ifndef BASE_REF_COUNTED_H_
 #define BASE_REF_COUNTED_H_
 #include <atomic>
+#include <cassert>
 #include "base/macros.h"
 
 #include <glog/logging.h>
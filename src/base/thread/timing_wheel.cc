@@ -0,0 +1,182 @@
+#include "base/thread/timing_wheel.h"
+
+#include <algorithm>
+#include <chrono>
+
+#include "base/logging.h"
+
+namespace base {
+namespace thread {
+
+TimingWheel::TimingWheel(const Options& options, ExpireCallback expired)
+  : options_(options),
+    expired_(std::move(expired)),
+    slot_mask_((1ULL << options.slot_bits) - 1),
+    max_ticks_(1ULL << (options.slot_bits * options.levels)),
+    stopping_(false),
+    next_tick_(options.env->NowMicros() / options.tick_micros),
+    slots_(static_cast<size_t>(options.levels) << options.slot_bits, nullptr) {
+  CHECK_GT(options_.tick_micros, 0);
+  CHECK_GT(options_.slot_bits, 0);
+  CHECK_GT(options_.levels, 0);
+  CHECK_LT(options_.slot_bits * options_.levels, 64);
+  if (options_.start_thread) {
+    thread_.reset(options_.env->StartThread(ThreadOptions(), "timing_wheel",
+                                            [this]() { Loop(); }));
+  }
+}
+
+TimingWheel::~TimingWheel() {
+  {
+    mutex_lock l(mu_);
+    stopping_ = true;
+  }
+  cv_.notify_all();
+  // 等待 tick 线程退出
+  thread_.reset();
+}
+
+void TimingWheel::Schedule(uint64 key, int64 delay_micros) {
+  mutex_lock l(mu_);
+  const uint64 now = options_.env->NowMicros();
+  auto it = timers_.find(key);
+  Timer* timer;
+  if (it == timers_.end()) {
+    timer = &timers_[key];
+    timer->key = key;
+  } else {
+    timer = &it->second;
+    DoUnlink(timer);
+  }
+  timer->expire_tick = DoTickOf(now + std::max<int64>(delay_micros, 0));
+  DoPlace(timer);
+}
+
+bool TimingWheel::Cancel(uint64 key) {
+  mutex_lock l(mu_);
+  auto it = timers_.find(key);
+  if (it == timers_.end()) {
+    return false;
+  }
+  DoUnlink(&it->second);
+  timers_.erase(it);
+  return true;
+}
+
+bool TimingWheel::Contains(uint64 key) const {
+  mutex_lock l(mu_);
+  return timers_.count(key) > 0;
+}
+
+size_t TimingWheel::size() const {
+  mutex_lock l(mu_);
+  return timers_.size();
+}
+
+void TimingWheel::AdvanceTo(uint64 now_micros) {
+  std::vector<uint64> keys;
+  {
+    mutex_lock l(mu_);
+    const uint64 target = now_micros / options_.tick_micros;
+    while (next_tick_ <= target) {
+      if (timers_.empty()) {
+        // 空闲时直接跳过, 没有需要重新分配的定时器
+        next_tick_ = target + 1;
+        break;
+      }
+      const uint64 index = next_tick_ & slot_mask_;
+      // 低层转完一圈, 把上一层当前槽中的定时器分配下来
+      for (int level = 1; index == 0 && level < options_.levels; ++level) {
+        const uint64 upper = (next_tick_ >> (options_.slot_bits * level)) & slot_mask_;
+        DoCascade(level, upper);
+        if (upper != 0) {
+          break;
+        }
+      }
+      Timer* timer = slots_[index];
+      slots_[index] = nullptr;
+      while (timer != nullptr) {
+        Timer* next = timer->next;
+        keys.push_back(timer->key);
+        timers_.erase(timer->key);
+        timer = next;
+      }
+      next_tick_++;
+    }
+  }
+  if (!keys.empty()) {
+    expired_(&keys);
+  }
+}
+
+void TimingWheel::Loop() {
+  mutex_lock l(mu_);
+  while (!stopping_) {
+    cv_.wait_for(l, std::chrono::microseconds(options_.tick_micros));
+    if (stopping_) {
+      break;
+    }
+    l.unlock();
+    AdvanceTo(options_.env->NowMicros());
+    l.lock();
+  }
+}
+
+void TimingWheel::DoPlace(Timer* timer) {
+  // 已经过期的定时器在下一个 tick 到期
+  uint64 expire_tick = std::max(timer->expire_tick, next_tick_);
+  uint64 delta = expire_tick - next_tick_;
+  if (delta >= max_ticks_) {
+    delta = max_ticks_ - 1;
+    expire_tick = next_tick_ + delta;
+  }
+  timer->expire_tick = expire_tick;
+  int level = 0;
+  while (level + 1 < options_.levels &&
+         delta >= (1ULL << (options_.slot_bits * (level + 1)))) {
+    level++;
+  }
+  timer->level = level;
+  timer->slot = static_cast<int>(
+      (expire_tick >> (options_.slot_bits * level)) & slot_mask_);
+  Timer*& head = slots_[(static_cast<size_t>(level) << options_.slot_bits) +
+                        timer->slot];
+  timer->prev = nullptr;
+  timer->next = head;
+  if (head != nullptr) {
+    head->prev = timer;
+  }
+  head = timer;
+}
+
+void TimingWheel::DoUnlink(Timer* timer) {
+  if (timer->prev != nullptr) {
+    timer->prev->next = timer->next;
+  } else {
+    slots_[(static_cast<size_t>(timer->level) << options_.slot_bits) +
+           timer->slot] = timer->next;
+  }
+  if (timer->next != nullptr) {
+    timer->next->prev = timer->prev;
+  }
+  timer->prev = nullptr;
+  timer->next = nullptr;
+}
+
+void TimingWheel::DoCascade(int level, uint64 index) {
+  Timer*& head = slots_[(static_cast<size_t>(level) << options_.slot_bits) + index];
+  Timer* timer = head;
+  head = nullptr;
+  while (timer != nullptr) {
+    Timer* next = timer->next;
+    DoPlace(timer);
+    timer = next;
+  }
+}
+
+uint64 TimingWheel::DoTickOf(uint64 micros) const {
+  return (micros + options_.tick_micros - 1) / options_.tick_micros;
+}
+
+} // namespace thread
+} // namespace base
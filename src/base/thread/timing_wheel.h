@@ -0,0 +1,93 @@
+#ifndef BASE_THREAD_TIMING_WHEEL_H_
+#define BASE_THREAD_TIMING_WHEEL_H_
+
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "base/macros.h"
+#include "base/platform/env.h"
+#include "base/platform/mutex.h"
+#include "base/port.h"
+
+namespace base {
+namespace thread {
+
+// 分层时间轮, 用于大量定时器 (例如会话 lease) 的到期.
+//
+// 每层 2^slot_bits 个槽, 第 L 层的一个槽覆盖 2^(slot_bits * L) 个 tick.
+// 定时器按到期时间与当前 tick 的距离放入对应层的槽中, 低层转完一圈时把上一层
+// 当前槽中的定时器重新分配到下层. Schedule, Cancel 和续约都是 O(1), 推进一个
+// tick 均摊 O(1). 定时器以 key 标识, 不为每个定时器保存闭包; 同一轮推进中
+// 到期的 key 一次交给回调, 调用者可以批量处理.
+//
+// 默认由一个 tick 线程驱动; start_thread 为 false 时由调用者调用 AdvanceTo,
+// 便于在测试和模拟中使用虚拟时间.
+class TimingWheel {
+ public:
+  // 到期的 key, 调用时不持有内部锁, 回调中可以再次 Schedule
+  typedef std::function<void(std::vector<uint64>* keys)> ExpireCallback;
+
+  struct Options {
+    int64 tick_micros = 10000;
+    // 默认 4 层, 每层 256 个槽, tick 为 10ms 时可以表示 497 天
+    int slot_bits = 8;
+    int levels = 4;
+    Env* env = Env::Default();
+    bool start_thread = true;
+  };
+
+  TimingWheel(const Options& options, ExpireCallback expired);
+  ~TimingWheel();
+
+  // 在 delay_micros 之后到期, 不会提前. key 已存在时重新设置到期时间 (续约).
+  // 超过时间轮范围的延迟被截断到最大范围.
+  void Schedule(uint64 key, int64 delay_micros);
+  // key 不存在 (已经到期或取消) 时返回 false
+  bool Cancel(uint64 key);
+  bool Contains(uint64 key) const;
+  size_t size() const;
+
+  // 处理 now_micros 之前的所有 tick, 回调到期的 key
+  void AdvanceTo(uint64 now_micros);
+
+ private:
+  struct Timer {
+    uint64 key;
+    uint64 expire_tick;
+    int level;
+    int slot;
+    Timer* prev;
+    Timer* next;
+  };
+
+  void Loop();
+  void DoPlace(Timer* timer);
+  void DoUnlink(Timer* timer);
+  void DoCascade(int level, uint64 index);
+  uint64 DoTickOf(uint64 micros) const;
+
+  const Options options_;
+  const ExpireCallback expired_;
+  const uint64 slot_mask_;
+  // 从 next_tick_ 开始最多能表示的 tick 数
+  const uint64 max_ticks_;
+
+  mutable mutex mu_;
+  condition_variable cv_;
+  bool stopping_;
+  // 下一个要处理的 tick
+  uint64 next_tick_;
+  // 每个槽是一个双向链表的表头, levels * 2^slot_bits 个
+  std::vector<Timer*> slots_;
+  // unordered_map 中元素的地址在 rehash 后不变
+  std::unordered_map<uint64, Timer> timers_;
+  std::unique_ptr<Thread> thread_;
+
+  DISALLOW_COPY_AND_ASSIGN(TimingWheel);
+};
+
+} // namespace thread
+} // namespace base
+#endif // BASE_THREAD_TIMING_WHEEL_H_
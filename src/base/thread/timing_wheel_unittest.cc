@@ -0,0 +1,149 @@
+#include "base/thread/timing_wheel.h"
+
+#include <algorithm>
+#include <map>
+#include <random>
+
+#include "base/platform/env.h"
+#include "base/platform/env_test_util.h"
+
+#include <gtest/gtest.h>
+
+namespace base {
+namespace thread {
+
+namespace {
+
+class TimingWheelTest : public ::testing::Test {
+ protected:
+  // 每层 4 个槽, 共 3 层, 便于覆盖层间的重新分配
+  void Init(int slot_bits, int levels) {
+    TimingWheel::Options options;
+    options.tick_micros = 10;
+    options.slot_bits = slot_bits;
+    options.levels = levels;
+    options.env = &env_;
+    options.start_thread = false;
+    wheel_.reset(new TimingWheel(options, [this](std::vector<uint64>* keys) {
+      batches_++;
+      for (uint64 key : *keys) {
+        expired_[key] = env_.NowMicros();
+      }
+    }));
+  }
+
+  // 逐个 tick 推进, 记录每个 key 到期的时间
+  void AdvanceTo(uint64 now) {
+    for (uint64 t = env_.NowMicros(); t <= now; t += 10) {
+      env_.set_now(t);
+      wheel_->AdvanceTo(t);
+    }
+    env_.set_now(now);
+  }
+
+  FakeClockEnv env_{0};
+  std::unique_ptr<TimingWheel> wheel_;
+  std::map<uint64, uint64> expired_;
+  int batches_ = 0;
+};
+
+} // namespace
+
+TEST_F(TimingWheelTest, ExpiresInBatches) {
+  Init(8, 4);
+  for (uint64 key = 0; key < 100; ++key) {
+    wheel_->Schedule(key, 95);
+  }
+  wheel_->Schedule(100, 5);
+  EXPECT_EQ(101u, wheel_->size());
+
+  AdvanceTo(90);
+  EXPECT_EQ(1u, expired_.size());
+  EXPECT_EQ(10u, expired_[100]);
+  // 不会提前到期, 同一个 tick 到期的 key 一次回调
+  AdvanceTo(100);
+  EXPECT_EQ(101u, expired_.size());
+  EXPECT_EQ(100u, expired_[0]);
+  EXPECT_EQ(2, batches_);
+  EXPECT_EQ(0u, wheel_->size());
+}
+
+TEST_F(TimingWheelTest, CancelAndRenew) {
+  Init(8, 4);
+  wheel_->Schedule(1, 100);
+  wheel_->Schedule(2, 100);
+  EXPECT_TRUE(wheel_->Cancel(1));
+  EXPECT_FALSE(wheel_->Cancel(1));
+  EXPECT_FALSE(wheel_->Contains(1));
+
+  AdvanceTo(50);
+  // 续约从现在开始计算
+  wheel_->Schedule(2, 100);
+  AdvanceTo(140);
+  EXPECT_TRUE(expired_.empty());
+  EXPECT_TRUE(wheel_->Contains(2));
+  AdvanceTo(150);
+  EXPECT_EQ(1u, expired_.size());
+  EXPECT_EQ(150u, expired_[2]);
+}
+
+TEST_F(TimingWheelTest, CascadesAcrossLevels) {
+  // 4 * 4 * 4 = 64 个 tick
+  Init(2, 3);
+  AdvanceTo(0);
+  std::mt19937 random(301);
+  std::map<uint64, uint64> deadlines;
+  for (uint64 key = 0; key < 500; ++key) {
+    const uint64 now = env_.NowMicros();
+    const int64 delay = random() % 640;
+    wheel_->Schedule(key, delay);
+    // 当前 tick 已经处理过, 最早在下一个 tick 到期
+    deadlines[key] = std::max((now + delay + 9) / 10 * 10, now + 10);
+    AdvanceTo(now + (random() % 3) * 10);
+  }
+  AdvanceTo(env_.NowMicros() + 700);
+  ASSERT_EQ(deadlines.size(), expired_.size());
+  for (const auto& kv : deadlines) {
+    EXPECT_EQ(kv.second, expired_[kv.first]) << "key " << kv.first;
+  }
+}
+
+TEST_F(TimingWheelTest, ClampsToRange) {
+  Init(2, 2);
+  wheel_->Schedule(1, 1000);
+  // 超出 16 个 tick 的范围
+  AdvanceTo(150);
+  EXPECT_EQ(150u, expired_[1]);
+}
+
+TEST_F(TimingWheelTest, SkipsIdleTicks) {
+  Init(8, 4);
+  wheel_->AdvanceTo(1000000000);
+  env_.set_now(1000000000);
+  wheel_->Schedule(1, 10);
+  AdvanceTo(1000000010);
+  EXPECT_EQ(1000000010u, expired_[1]);
+}
+
+TEST(TimingWheel, TickThread) {
+  mutex mu;
+  condition_variable cv;
+  std::vector<uint64> expired;
+  TimingWheel::Options options;
+  options.tick_micros = 1000;
+  TimingWheel wheel(options, [&](std::vector<uint64>* keys) {
+    mutex_lock l(mu);
+    expired.insert(expired.end(), keys->begin(), keys->end());
+    cv.notify_all();
+  });
+  wheel.Schedule(7, 5000);
+  mutex_lock l(mu);
+  while (expired.empty()) {
+    ASSERT_EQ(kCondMaybeNotified, WaitForMilliseconds(&l, &cv, 1000));
+  }
+  ASSERT_EQ(1u, expired.size());
+  EXPECT_EQ(7u, expired[0]);
+}
+
+} // namespace thread
+} // namespace base
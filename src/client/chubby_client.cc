@@ -0,0 +1,340 @@
+#include "client/chubby_client.h"
+
+#include <algorithm>
+
+#include "base/errors.h"
+#include "base/logging.h"
+#include "base/random/random.h"
+#include "base/strings/stringprintf.h"
+
+namespace mpr {
+namespace chubby {
+
+namespace {
+
+// KeepAlive 失败后重试的间隔
+const int64_t kRetryMicros = 100 * 1000;
+
+} // namespace
+
+ChubbyClient::Options::Options()
+  : keepalive_hold_micros(5 * 1000 * 1000),
+    min_keepalive_interval_micros(1000 * 1000),
+    lease_micros(12 * 1000 * 1000),
+    max_cache_entries(10000),
+    env(base::Env::Default()),
+    start_thread(true) {}
+
+ChubbyClient::ChubbyClient(const Options& options, ClientChannel* channel)
+  : options_(options),
+    channel_(channel),
+    stopping_(false),
+    epoch_(0),
+    acked_invalidation_(0),
+    cache_incarnation_(0),
+    last_keepalive_micros_(options.env->NowMicros()),
+    hits_(0),
+    misses_(0),
+    request_id_prefix_(base::strings::SPrintf(
+        "%016llx.", static_cast<unsigned long long>(base::random::New64()))),
+    next_request_id_(0) {
+  DCHECK(channel_ != nullptr);
+  DCHECK(!options_.nodes.empty());
+  leader_ = options_.nodes[0];
+  if (options_.start_thread) {
+    thread_.reset(options_.env->StartThread(base::ThreadOptions(),
+                                            "chubby_keepalive",
+                                            [this]() { KeepAliveLoop(); }));
+  }
+}
+
+ChubbyClient::~ChubbyClient() {
+  {
+    base::mutex_lock l(mu_);
+    stopping_ = true;
+    cv_.notify_all();
+  }
+  thread_.reset(nullptr);
+}
+
+base::Status ChubbyClient::Get(const std::string& key, std::string* value) {
+  int64_t epoch;
+  {
+    base::mutex_lock l(mu_);
+    auto it = cache_.find(key);
+    if (it != cache_.end()) {
+      hits_++;
+      if (!it->second.hit) {
+        return base::errors::NotFound(key);
+      }
+      *value = it->second.value;
+      return base::Status::OK();
+    }
+    misses_++;
+    epoch = epoch_;
+  }
+
+  GetRequest request;
+  request.set_key(key);
+  request.set_uuid(options_.uuid);
+  request.set_session_id(options_.session_id);
+  GetResponse response;
+  RETURN_IF_ERROR(Call(&ClientChannel::Get, request, &response));
+  {
+    base::mutex_lock l(mu_);
+    const bool unchanged = epoch == epoch_;
+    if (response.cache_incarnation() != cache_incarnation_) {
+      // 读取之前已经在新的 CacheTracker 上登记, 这次的结果仍然可以缓存
+      DoResetCache(response.cache_incarnation());
+    }
+    if (response.cacheable() && unchanged) {
+      if (cache_.size() >= options_.max_cache_entries && !cache_.empty()) {
+        cache_.erase(cache_.begin());
+      }
+      CacheEntry& entry = cache_[key];
+      entry.hit = response.hit();
+      entry.value = response.value();
+    }
+  }
+  if (!response.hit()) {
+    return base::errors::NotFound(key);
+  }
+  *value = response.value();
+  return base::Status::OK();
+}
+
+base::Status ChubbyClient::Put(const std::string& key, const std::string& value) {
+  {
+    // 服务端不等待写入者确认, 自己的缓存先删除
+    base::mutex_lock l(mu_);
+    DoForget(key);
+  }
+  PutRequest request;
+  request.set_key(key);
+  request.set_value(value);
+  request.set_uuid(options_.uuid);
+  request.set_session_id(options_.session_id);
+  request.set_request_id(NextRequestId());
+  PutResponse response;
+  base::Status status = Call(&ClientChannel::Put, request, &response);
+  {
+    // 写入期间开始的 Get 可能在 Invalidate 之前登记并读到旧值, 服务端不通知
+    // 写入者, 返回后再删除一次. 失败的写入也可能已经提交
+    base::mutex_lock l(mu_);
+    DoForget(key);
+  }
+  return status;
+}
+
+base::Status ChubbyClient::Delete(const std::string& key) {
+  {
+    base::mutex_lock l(mu_);
+    DoForget(key);
+  }
+  DelRequest request;
+  request.set_key(key);
+  request.set_uuid(options_.uuid);
+  request.set_session_id(options_.session_id);
+  request.set_request_id(NextRequestId());
+  DelResponse response;
+  base::Status status = Call(&ClientChannel::Delete, request, &response);
+  {
+    // 与 Put 相同
+    base::mutex_lock l(mu_);
+    DoForget(key);
+  }
+  return status;
+}
+
+base::Status ChubbyClient::Lock(const std::string& key, int64_t wait_timeout_ms) {
+  LockRequest request;
+  request.set_key(key);
+  request.set_session_id(options_.session_id);
+  request.set_hostname(options_.hostname);
+  request.set_uuid(options_.uuid);
+  request.set_wait_timeout_ms(wait_timeout_ms);
+  request.set_request_id(NextRequestId());
+  LockResponse response;
+  RETURN_IF_ERROR(Call(&ClientChannel::Lock, request, &response));
+  base::mutex_lock l(mu_);
+  locks_.insert(key);
+  return base::Status::OK();
+}
+
+base::Status ChubbyClient::UnLock(const std::string& key) {
+  UnLockRequest request;
+  request.set_key(key);
+  request.set_session_id(options_.session_id);
+  request.set_uuid(options_.uuid);
+  request.set_request_id(NextRequestId());
+  UnLockResponse response;
+  RETURN_IF_ERROR(Call(&ClientChannel::UnLock, request, &response));
+  base::mutex_lock l(mu_);
+  locks_.erase(key);
+  return base::Status::OK();
+}
+
+bool ChubbyClient::HoldsLock(const std::string& key) const {
+  base::mutex_lock l(mu_);
+  return locks_.count(key) > 0;
+}
+
+base::Status ChubbyClient::KeepAliveOnce(int64_t hold_micros,
+                                         int* invalidations) {
+  KeepAliveRequest request;
+  request.set_session_id(options_.session_id);
+  request.set_uuid(options_.uuid);
+  request.set_hold_ms(hold_micros / 1000);
+  {
+    base::mutex_lock l(mu_);
+    request.set_acked_invalidation(acked_invalidation_);
+    request.set_cache_incarnation(cache_incarnation_);
+    for (const std::string& key : locks_) {
+      request.add_locks(key);
+    }
+  }
+  KeepAliveResponse response;
+  base::Status status = Call(&ClientChannel::KeepAlive, request, &response);
+
+  base::mutex_lock l(mu_);
+  const uint64_t now = options_.env->NowMicros();
+  if (!status.ok()) {
+    if (now - last_keepalive_micros_ >= static_cast<uint64_t>(options_.lease_micros)) {
+      // 会话可能已经过期, 缓存不再有失效通知, 锁也可能已被释放
+      LOG(WARNING) << "[ChubbyClient] session " << options_.session_id
+                   << " lost: " << status.ToString();
+      cache_.clear();
+      locks_.clear();
+      epoch_++;
+    }
+    return status;
+  }
+  last_keepalive_micros_ = now;
+  if (response.cache_incarnation() != cache_incarnation_) {
+    DoResetCache(response.cache_incarnation());
+  }
+  for (const std::string& key : response.invalidations()) {
+    DoForget(key);
+  }
+  if (invalidations != nullptr) {
+    *invalidations = response.invalidations_size();
+  }
+  acked_invalidation_ = std::max(acked_invalidation_, response.invalidation_seq());
+  return base::Status::OK();
+}
+
+std::string ChubbyClient::leader() const {
+  base::mutex_lock l(mu_);
+  return leader_;
+}
+
+size_t ChubbyClient::cache_size() const {
+  base::mutex_lock l(mu_);
+  return cache_.size();
+}
+
+int64_t ChubbyClient::cache_hits() const {
+  base::mutex_lock l(mu_);
+  return hits_;
+}
+
+int64_t ChubbyClient::cache_misses() const {
+  base::mutex_lock l(mu_);
+  return misses_;
+}
+
+template <typename Request, typename Response>
+base::Status ChubbyClient::Call(
+    base::Status (ClientChannel::*method)(const std::string&, const Request&,
+                                          Response*),
+    const Request& request, Response* response) {
+  std::string node = leader();
+  base::Status status;
+  // 每个节点最多尝试两次: 一次转发, 一次传输失败
+  const size_t attempts = options_.nodes.size() * 2;
+  for (size_t attempt = 0; attempt < attempts; ++attempt) {
+    response->Clear();
+    status = (channel_->*method)(node, request, response);
+    if (status.ok() && response->success()) {
+      base::mutex_lock l(mu_);
+      DoSetLeader(node);
+      return base::Status::OK();
+    }
+    if (status.ok() && response->leader_id() == node) {
+      // leader 拒绝了请求
+      base::mutex_lock l(mu_);
+      DoSetLeader(node);
+      return base::errors::FailedPrecondition("request rejected by leader ", node);
+    }
+    if (status.ok() && !response->leader_id().empty()) {
+      node = response->leader_id();
+      continue;
+    }
+    if (status.ok()) {
+      status = base::errors::Unavailable("node ", node, " does not know the leader");
+    }
+    auto it = std::find(options_.nodes.begin(), options_.nodes.end(), node);
+    size_t next = it == options_.nodes.end() ? 0 : it - options_.nodes.begin() + 1;
+    node = options_.nodes[next % options_.nodes.size()];
+  }
+  return status.ok() ? base::errors::Unavailable("no leader found") : status;
+}
+
+void ChubbyClient::DoForget(const std::string& key) {
+  cache_.erase(key);
+  epoch_++;
+}
+
+void ChubbyClient::DoResetCache(int64_t incarnation) {
+  if (!cache_.empty()) {
+    LOG(INFO) << "[ChubbyClient] session " << options_.session_id
+              << " drops " << cache_.size() << " cached keys after leader change";
+  }
+  cache_.clear();
+  epoch_++;
+  acked_invalidation_ = 0;
+  cache_incarnation_ = incarnation;
+}
+
+void ChubbyClient::DoSetLeader(const std::string& node) {
+  if (node != leader_ && cache_incarnation_ != 0) {
+    // 之前的 leader 上登记的缓存不再有失效通知
+    DoResetCache(0);
+  }
+  leader_ = node;
+}
+
+std::string ChubbyClient::NextRequestId() {
+  base::mutex_lock l(mu_);
+  return request_id_prefix_ + std::to_string(++next_request_id_);
+}
+
+void ChubbyClient::KeepAliveLoop() {
+  while (true) {
+    {
+      base::mutex_lock l(mu_);
+      if (stopping_) {
+        return;
+      }
+    }
+    const uint64_t start = options_.env->NowMicros();
+    int invalidations = 0;
+    int64_t wait_micros = 0;
+    if (!KeepAliveOnce(options_.keepalive_hold_micros, &invalidations).ok()) {
+      wait_micros = kRetryMicros;
+    } else if (invalidations == 0) {
+      // 有失效时立即确认, 否则对端没有挂起请求时不要空转
+      wait_micros = start + options_.min_keepalive_interval_micros -
+                    options_.env->NowMicros();
+    }
+    if (wait_micros > 0) {
+      base::mutex_lock l(mu_);
+      if (!stopping_) {
+        cv_.wait_for(l, std::chrono::microseconds(wait_micros));
+      }
+    }
+  }
+}
+
+} // namespace chubby
+} // namespace mpr
@@ -0,0 +1,156 @@
+#ifndef MPR_CHUBBY_CLIENT_CHUBBY_CLIENT_H_
+#define MPR_CHUBBY_CLIENT_CHUBBY_CLIENT_H_
+
+#include <memory>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "base/macros.h"
+#include "base/status.h"
+#include "base/platform/env.h"
+#include "base/platform/mutex.h"
+#include "proto/service.pb.h"
+
+namespace mpr {
+namespace chubby {
+
+// 到集群节点的同步 RPC, node 是节点 id (与响应中的 leader_id 相同).
+// 返回非 OK 表示传输失败, 请求的结果在 response 中.
+class ClientChannel {
+ public:
+  ClientChannel() {}
+  virtual ~ClientChannel() {}
+
+  virtual base::Status Get(const std::string& node, const GetRequest& request,
+                           GetResponse* response) = 0;
+  virtual base::Status Put(const std::string& node, const PutRequest& request,
+                           PutResponse* response) = 0;
+  virtual base::Status Delete(const std::string& node, const DelRequest& request,
+                              DelResponse* response) = 0;
+  virtual base::Status Lock(const std::string& node, const LockRequest& request,
+                            LockResponse* response) = 0;
+  virtual base::Status UnLock(const std::string& node,
+                              const UnLockRequest& request,
+                              UnLockResponse* response) = 0;
+  virtual base::Status KeepAlive(const std::string& node,
+                                 const KeepAliveRequest& request,
+                                 KeepAliveResponse* response) = 0;
+
+ private:
+  DISALLOW_COPY_AND_ASSIGN(ClientChannel);
+};
+
+// 带本地缓存的客户端.
+//
+// Get 的结果 (包括 key 不存在) 缓存在本地, 命中时不发送请求. 服务端记录每个
+// 会话缓存的 key, 写入提交之前通过 KeepAlive 的响应通知失效, 客户端删除缓存
+// 后在下一次 KeepAlive 中确认, 所以缓存不会读到已经提交的写入之前的值.
+// 服务端不通知写入者本身, 客户端在 Put/Delete 发送之前和返回之后各删除一次
+// 这个 key, 写入期间并发的 Get 读到的旧值不会留在缓存中.
+// 后台线程持续发送 KeepAlive, 没有失效时在 leader 上挂起 keepalive_hold_micros.
+// 超过 lease_micros 没有成功的 KeepAlive 时会话可能已经过期, 丢弃缓存和锁.
+// 换主后新 leader 不知道之前的缓存者, 响应中的 cache_incarnation 变化或者
+// leader 变化时清空缓存, 失效序号从头开始.
+//
+// 请求先发给已知的 leader, 响应中的 leader_id 指向其他节点时转发过去, 传输
+// 失败时依次尝试下一个节点. 写请求在重试时带同一个 request_id, 服务端的
+// DedupTable 保证 chubby_dedup_window 条日志之内到达的重试只 apply 一次, 并
+// 返回第一次 apply 的结果. request_id 带每个实例随机的前缀, 重启后沿用
+// session_id (例如 proxy 的上游会话) 也不会被误认为重试.
+class ChubbyClient {
+ public:
+  struct Options {
+    // 集群中的节点, 第一个作为初始的 leader
+    std::vector<std::string> nodes;
+    std::string uuid;
+    std::string session_id;
+    std::string hostname;
+    int64_t keepalive_hold_micros;
+    // 对端不挂起 KeepAlive (例如 proxy) 时, 没有失效的两次 KeepAlive 之间的
+    // 最小间隔
+    int64_t min_keepalive_interval_micros;
+    // 与服务端的 chubby_session_lease 相同
+    int64_t lease_micros;
+    // 缓存满时随机淘汰
+    size_t max_cache_entries;
+    base::Env* env;
+    // 为 false 时由调用者调用 KeepAliveOnce
+    bool start_thread;
+
+    Options();
+  };
+
+  ChubbyClient(const Options& options, ClientChannel* channel);
+  // 等待正在挂起的 KeepAlive 返回
+  ~ChubbyClient();
+
+  // key 不存在时返回 NotFound
+  base::Status Get(const std::string& key, std::string* value);
+  base::Status Put(const std::string& key, const std::string& value);
+  base::Status Delete(const std::string& key);
+  // 锁被其他会话持有时返回 FailedPrecondition. wait_timeout_ms > 0 时在服务端
+  // 排队等待.
+  base::Status Lock(const std::string& key, int64_t wait_timeout_ms);
+  base::Status UnLock(const std::string& key);
+  // 本地记录的锁状态, 不发送请求
+  bool HoldsLock(const std::string& key) const;
+
+  // 发送一次 KeepAlive 并处理响应中的失效. invalidations 不为空时返回处理的
+  // 失效数.
+  base::Status KeepAliveOnce(int64_t hold_micros, int* invalidations = nullptr);
+
+  std::string leader() const;
+  size_t cache_size() const;
+  int64_t cache_hits() const;
+  int64_t cache_misses() const;
+
+ private:
+  struct CacheEntry {
+    bool hit;
+    std::string value;
+  };
+
+  // 找到 leader 并发送请求, response.success 为 false 且 leader 就是该节点时
+  // 返回 FailedPrecondition
+  template <typename Request, typename Response>
+  base::Status Call(base::Status (ClientChannel::*method)(const std::string&,
+                                                          const Request&,
+                                                          Response*),
+                    const Request& request, Response* response);
+  void DoForget(const std::string& key);
+  // 清空缓存, 之后的失效序号属于 incarnation
+  void DoResetCache(int64_t incarnation);
+  void DoSetLeader(const std::string& node);
+  std::string NextRequestId();
+  void KeepAliveLoop();
+
+  const Options options_;
+  ClientChannel* channel_;
+
+  mutable base::mutex mu_;
+  base::condition_variable cv_;
+  bool stopping_;
+  std::string leader_;
+  std::unordered_map<std::string, CacheEntry> cache_;
+  std::set<std::string> locks_;
+  // 每处理一个失效加一, 请求期间变化过的 Get 结果不缓存
+  int64_t epoch_;
+  int64_t acked_invalidation_;
+  // acked_invalidation_ 和缓存所属的 CacheTracker, 0 表示还没有见过
+  int64_t cache_incarnation_;
+  uint64_t last_keepalive_micros_;
+  int64_t hits_;
+  int64_t misses_;
+  // 每个实例随机, 重启后同一个 session_id 上的 request_id 不会与之前的重复
+  const std::string request_id_prefix_;
+  int64_t next_request_id_;
+  std::unique_ptr<base::Thread> thread_;
+
+  DISALLOW_COPY_AND_ASSIGN(ChubbyClient);
+};
+
+} // namespace chubby
+} // namespace mpr
+#endif // MPR_CHUBBY_CLIENT_CHUBBY_CLIENT_H_
@@ -0,0 +1,192 @@
+#include <gtest/gtest.h>
+#include <map>
+#include <thread>
+#include <vector>
+
+#include "client/chubby_client.h"
+#include "base/errors.h"
+#include "base/platform/env_test_util.h"
+#include "client/client_test_util.h"
+
+namespace mpr {
+namespace chubby {
+
+namespace {
+
+ChubbyClient::Options TestOptions(const std::string& session_id,
+                                  base::Env* env = base::Env::Default()) {
+  ChubbyClient::Options options;
+  options.nodes = {"n1", "n2", "n3"};
+  options.session_id = session_id;
+  options.env = env;
+  options.start_thread = false;
+  return options;
+}
+
+} // namespace
+
+TEST(ChubbyClient, FindsLeaderAndCaches) {
+  FakeCluster cluster("n2");
+  ChubbyClient client(TestOptions("s1"), &cluster);
+  ASSERT_TRUE(client.Put("/a", "1").ok());
+  EXPECT_EQ("n2", client.leader());
+
+  std::string value;
+  for (int i = 0; i < 10; ++i) {
+    ASSERT_TRUE(client.Get("/a", &value).ok());
+    EXPECT_EQ("1", value);
+    // 不存在的 key 同样缓存
+    EXPECT_TRUE(base::errors::IsNotFound(client.Get("/b", &value)));
+  }
+  EXPECT_EQ(2, cluster.gets());
+  EXPECT_EQ(18, client.cache_hits());
+  EXPECT_EQ(2u, client.cache_size());
+
+  // 自己的写入不需要等待失效
+  ASSERT_TRUE(client.Put("/a", "2").ok());
+  ASSERT_TRUE(client.Get("/a", &value).ok());
+  EXPECT_EQ("2", value);
+}
+
+TEST(ChubbyClient, InvalidatesBeforeWrite) {
+  FakeCluster cluster("n2");
+  ChubbyClient reader(TestOptions("reader"), &cluster);
+  ChubbyClient writer(TestOptions("writer"), &cluster);
+  ASSERT_TRUE(writer.Put("/a", "1").ok());
+  std::string value;
+  ASSERT_TRUE(reader.Get("/a", &value).ok());
+  EXPECT_EQ(1u, cluster.tracker_->readers("/a"));
+
+  std::thread write([&writer]() { EXPECT_TRUE(writer.Put("/a", "2").ok()); });
+  while (cluster.tracker_->pending_writes() == 0) {
+    std::this_thread::yield();
+  }
+  // 失效之前缓存仍然有效, 写入在等待确认
+  ASSERT_TRUE(reader.Get("/a", &value).ok());
+  EXPECT_EQ("1", value);
+  ASSERT_TRUE(reader.KeepAliveOnce(0).ok());
+  EXPECT_EQ(0u, reader.cache_size());
+  EXPECT_EQ(1u, cluster.tracker_->pending_writes());
+  // 下一次 KeepAlive 带上确认
+  ASSERT_TRUE(reader.KeepAliveOnce(0).ok());
+  write.join();
+  EXPECT_EQ(0u, cluster.tracker_->pending_writes());
+
+  ASSERT_TRUE(reader.Get("/a", &value).ok());
+  EXPECT_EQ("2", value);
+}
+
+TEST(ChubbyClient, ResetsCacheOnLeaderChange) {
+  FakeCluster cluster("n2");
+  ChubbyClient reader(TestOptions("reader"), &cluster);
+  ChubbyClient writer(TestOptions("writer"), &cluster);
+  ASSERT_TRUE(writer.Put("/a", "1").ok());
+  ASSERT_TRUE(writer.Put("/b", "1").ok());
+  std::string value;
+  ASSERT_TRUE(reader.Get("/a", &value).ok());
+  ASSERT_TRUE(reader.Get("/b", &value).ok());
+  // 在旧 leader 上确认过几个失效
+  for (int i = 0; i < 3; ++i) {
+    std::thread write([&writer]() { EXPECT_TRUE(writer.Put("/a", "1").ok()); });
+    while (cluster.tracker_->pending_writes() == 0) {
+      std::this_thread::yield();
+    }
+    ASSERT_TRUE(reader.KeepAliveOnce(0).ok());
+    ASSERT_TRUE(reader.KeepAliveOnce(0).ok());
+    write.join();
+    ASSERT_TRUE(reader.Get("/a", &value).ok());
+  }
+  EXPECT_EQ(2u, reader.cache_size());
+
+  // 新 leader 上的写入不需要等待任何人, 客户端的 KeepAlive 仍然成功
+  cluster.ChangeLeader("n3");
+  ASSERT_TRUE(writer.Put("/a", "2").ok());
+  ASSERT_TRUE(reader.KeepAliveOnce(0).ok());
+  EXPECT_EQ(0u, reader.cache_size());
+  ASSERT_TRUE(reader.Get("/a", &value).ok());
+  EXPECT_EQ("2", value);
+
+  // 旧的确认序号不能确认新 leader 上还没有收到的失效
+  ASSERT_TRUE(reader.Get("/b", &value).ok());
+  std::thread write([&writer]() { EXPECT_TRUE(writer.Put("/b", "2").ok()); });
+  while (cluster.tracker_->pending_writes() == 0) {
+    std::this_thread::yield();
+  }
+  ASSERT_TRUE(reader.KeepAliveOnce(0).ok());
+  EXPECT_EQ(1u, cluster.tracker_->pending_writes());
+  ASSERT_TRUE(reader.KeepAliveOnce(0).ok());
+  write.join();
+  ASSERT_TRUE(reader.Get("/b", &value).ok());
+  EXPECT_EQ("2", value);
+}
+
+// 写入期间同一个客户端的 Get 在 Invalidate 之前登记并读到旧值, 服务端不通知
+// 写入者, 这个旧值不能留在缓存中
+TEST(ChubbyClient, GetDuringOwnWriteNotCached) {
+  FakeCluster cluster("n2");
+  ChubbyClient client(TestOptions("s1"), &cluster);
+  ASSERT_TRUE(client.Put("a", "1").ok());
+  std::string value;
+  base::Status during;
+  cluster.before_write_ = [&client, &value, &during]() {
+    during = client.Get("a", &value);
+  };
+  ASSERT_TRUE(client.Put("a", "2").ok());
+  ASSERT_TRUE(during.ok());
+  EXPECT_EQ("1", value);
+  cluster.before_write_ = nullptr;
+  ASSERT_TRUE(client.Get("a", &value).ok());
+  EXPECT_EQ("2", value);
+  EXPECT_EQ(2, cluster.gets());
+
+  // Delete 相同
+  cluster.before_write_ = [&client, &value, &during]() {
+    during = client.Get("a", &value);
+  };
+  ASSERT_TRUE(client.Delete("a").ok());
+  ASSERT_TRUE(during.ok());
+  cluster.before_write_ = nullptr;
+  EXPECT_TRUE(base::errors::IsNotFound(client.Get("a", &value)));
+}
+
+// 重启后的客户端沿用 session_id, request_id 不能与之前的重复
+TEST(ChubbyClient, RequestIdsDifferAcrossRestarts) {
+  FakeCluster cluster("n2");
+  {
+    ChubbyClient client(TestOptions("s1"), &cluster);
+    ASSERT_TRUE(client.Put("a", "1").ok());
+  }
+  ChubbyClient restarted(TestOptions("s1"), &cluster);
+  ASSERT_TRUE(restarted.Put("a", "2").ok());
+  std::vector<std::string> ids = cluster.put_request_ids();
+  ASSERT_EQ(2u, ids.size());
+  EXPECT_NE(ids[0], ids[1]);
+}
+
+TEST(ChubbyClient, LocksAndSessionLoss) {
+  base::FakeClockEnv env;
+  FakeCluster cluster("n2");
+  ChubbyClient client(TestOptions("s1", &env), &cluster);
+  ChubbyClient other(TestOptions("s2", &env), &cluster);
+  ASSERT_TRUE(client.Lock("/lock", 0).ok());
+  EXPECT_TRUE(client.HoldsLock("/lock"));
+  EXPECT_TRUE(base::errors::IsFailedPrecondition(other.Lock("/lock", 0)));
+  EXPECT_FALSE(other.HoldsLock("/lock"));
+
+  std::string value;
+  client.Get("/a", &value);
+  EXPECT_EQ(1u, client.cache_size());
+
+  // lease 之内失败不丢弃状态
+  cluster.down_ = true;
+  env.AdvanceMillis(6000);
+  EXPECT_FALSE(client.KeepAliveOnce(0).ok());
+  EXPECT_TRUE(client.HoldsLock("/lock"));
+  env.AdvanceMillis(6000);
+  EXPECT_FALSE(client.KeepAliveOnce(0).ok());
+  EXPECT_FALSE(client.HoldsLock("/lock"));
+  EXPECT_EQ(0u, client.cache_size());
+}
+
+} // namespace chubby
+} // namespace mpr
@@ -0,0 +1,201 @@
+#ifndef MPR_CHUBBY_CLIENT_CLIENT_TEST_UTIL_H_
+#define MPR_CHUBBY_CLIENT_CLIENT_TEST_UTIL_H_
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base/errors.h"
+#include "base/platform/mutex.h"
+#include "client/chubby_client.h"
+#include "server/cache_tracker.h"
+
+namespace mpr {
+namespace chubby {
+
+// 测试用的集群: 只有 leader 处理请求, 其他节点只返回 leader_id. 写入前通过
+// CacheTracker 使缓存失效, 缓存者都确认后才写入.
+class FakeCluster : public ClientChannel {
+ public:
+  explicit FakeCluster(const std::string& leader = "n1")
+    : leader_(leader), down_(false), gets_(0), keepalives_(0) {
+    ResetTracker();
+  }
+
+  base::Status Get(const std::string& node, const GetRequest& request,
+                   GetResponse* response) override {
+    base::Status status;
+    if (!Serve(node, response, &status)) {
+      return status;
+    }
+    base::mutex_lock l(mu_);
+    gets_++;
+    // 先登记再读取, 之后的写入一定会通知这个会话
+    response->set_cacheable(
+        tracker_->AddReader(request.session_id(), request.key()));
+    response->set_cache_incarnation(tracker_->incarnation());
+    auto it = data_.find(request.key());
+    response->set_hit(it != data_.end());
+    if (it != data_.end()) {
+      response->set_value(it->second);
+    }
+    response->set_success(true);
+    return base::Status::OK();
+  }
+
+  base::Status Put(const std::string& node, const PutRequest& request,
+                   PutResponse* response) override {
+    base::Status status;
+    if (!Serve(node, response, &status)) {
+      return status;
+    }
+    Write(request.key(), request.session_id(), [this, request]() {
+      data_[request.key()] = request.value();
+      put_request_ids_.push_back(request.request_id());
+    });
+    response->set_success(true);
+    return base::Status::OK();
+  }
+
+  base::Status Delete(const std::string& node, const DelRequest& request,
+                      DelResponse* response) override {
+    base::Status status;
+    if (!Serve(node, response, &status)) {
+      return status;
+    }
+    Write(request.key(), request.session_id(),
+          [this, request]() { data_.erase(request.key()); });
+    response->set_success(true);
+    return base::Status::OK();
+  }
+
+  base::Status Lock(const std::string& node, const LockRequest& request,
+                    LockResponse* response) override {
+    base::Status status;
+    if (!Serve(node, response, &status)) {
+      return status;
+    }
+    base::mutex_lock l(mu_);
+    std::string& owner = locks_[request.key()];
+    if (owner.empty() || owner == request.session_id()) {
+      owner = request.session_id();
+      response->set_success(true);
+    }
+    return base::Status::OK();
+  }
+
+  base::Status UnLock(const std::string& node, const UnLockRequest& request,
+                      UnLockResponse* response) override {
+    base::Status status;
+    if (!Serve(node, response, &status)) {
+      return status;
+    }
+    base::mutex_lock l(mu_);
+    locks_.erase(request.key());
+    response->set_success(true);
+    return base::Status::OK();
+  }
+
+  base::Status KeepAlive(const std::string& node, const KeepAliveRequest& request,
+                         KeepAliveResponse* response) override {
+    base::Status status;
+    if (!Serve(node, response, &status)) {
+      return status;
+    }
+    {
+      base::mutex_lock l(mu_);
+      keepalives_++;
+    }
+    tracker_->KeepAlive(request, request.hold_ms() * 1000LL,
+                        [response](const base::Status&, KeepAliveResponse* r) {
+                          response->Swap(r);
+                        });
+    response->set_success(true);
+    response->set_leader_id(leader_);
+    return base::Status::OK();
+  }
+
+  int gets() {
+    base::mutex_lock l(mu_);
+    return gets_;
+  }
+
+  int keepalives() {
+    base::mutex_lock l(mu_);
+    return keepalives_;
+  }
+
+  std::vector<std::string> put_request_ids() {
+    base::mutex_lock l(mu_);
+    return put_request_ids_;
+  }
+
+  std::string lock_owner(const std::string& key) {
+    base::mutex_lock l(mu_);
+    auto it = locks_.find(key);
+    return it == locks_.end() ? "" : it->second;
+  }
+
+  // 新 leader 的 CacheTracker 不知道之前的缓存者
+  void ChangeLeader(const std::string& node) {
+    leader_ = node;
+    ResetTracker();
+  }
+
+  std::string leader_;
+  bool down_;
+  std::unique_ptr<CacheTracker> tracker_;
+  // 收到写请求之后, Invalidate 之前调用
+  std::function<void()> before_write_;
+
+ private:
+  void ResetTracker() {
+    CacheTracker::Options options;
+    options.grace_micros = 0;
+    options.start_thread = false;
+    tracker_.reset(new CacheTracker(options));
+  }
+
+  // 其他节点只返回 leader_id
+  template <typename Response>
+  bool Serve(const std::string& node, Response* response, base::Status* status) {
+    if (down_) {
+      *status = base::errors::Unavailable("node ", node, " down");
+      return false;
+    }
+    response->set_leader_id(leader_);
+    return node == leader_;
+  }
+
+  void Write(const std::string& key, const std::string& writer,
+             std::function<void()> apply) {
+    if (before_write_) {
+      before_write_();
+    }
+    bool done = false;
+    tracker_->Invalidate(key, writer, [this, &done](const base::Status&) {
+      base::mutex_lock l(mu_);
+      done = true;
+      cv_.notify_all();
+    });
+    base::mutex_lock l(mu_);
+    while (!done) {
+      cv_.wait(l);
+    }
+    apply();
+  }
+
+  base::mutex mu_;
+  base::condition_variable cv_;
+  std::map<std::string, std::string> data_;
+  std::map<std::string, std::string> locks_;
+  std::vector<std::string> put_request_ids_;
+  int gets_;
+  int keepalives_;
+};
+
+} // namespace chubby
+} // namespace mpr
+#endif // MPR_CHUBBY_CLIENT_CLIENT_TEST_UTIL_H_
@@ -0,0 +1,140 @@
+#include "client/http_channel.h"
+
+#include <stdlib.h>
+#include <sys/time.h>
+
+#include <event2/buffer.h>
+#include <event2/event.h>
+#include <event2/http.h>
+
+#include "base/errors.h"
+#include "base/logging.h"
+
+namespace mpr {
+namespace chubby {
+
+namespace {
+
+struct CallContext {
+  bool done = false;
+  int code = 0;
+  std::string body;
+};
+
+void OnResponse(struct evhttp_request* request, void* arg) {
+  CallContext* context = static_cast<CallContext*>(arg);
+  context->done = true;
+  // 连接失败或超时时 request 为空
+  if (request != nullptr) {
+    context->code = evhttp_request_get_response_code(request);
+    struct evbuffer* input = evhttp_request_get_input_buffer(request);
+    const size_t length = evbuffer_get_length(input);
+    context->body.resize(length);
+    if (length > 0) {
+      evbuffer_copyout(input, &context->body[0], length);
+    }
+  }
+}
+
+} // namespace
+
+HttpChannel::Options::Options()
+  : timeout_micros(10 * 1000 * 1000) {}
+
+HttpChannel::HttpChannel(const Options& options)
+  : options_(options) {}
+
+base::Status HttpChannel::Get(const std::string& node, const GetRequest& request,
+                              GetResponse* response) {
+  return Call(node, "Get", request, response);
+}
+
+base::Status HttpChannel::Put(const std::string& node, const PutRequest& request,
+                              PutResponse* response) {
+  return Call(node, "Put", request, response);
+}
+
+base::Status HttpChannel::Delete(const std::string& node,
+                                 const DelRequest& request,
+                                 DelResponse* response) {
+  return Call(node, "Delete", request, response);
+}
+
+base::Status HttpChannel::Lock(const std::string& node,
+                               const LockRequest& request,
+                               LockResponse* response) {
+  return Call(node, "Lock", request, response);
+}
+
+base::Status HttpChannel::UnLock(const std::string& node,
+                                 const UnLockRequest& request,
+                                 UnLockResponse* response) {
+  return Call(node, "UnLock", request, response);
+}
+
+base::Status HttpChannel::KeepAlive(const std::string& node,
+                                    const KeepAliveRequest& request,
+                                    KeepAliveResponse* response) {
+  return Call(node, "KeepAlive", request, response);
+}
+
+base::Status HttpChannel::Call(const std::string& node,
+                               const std::string& method,
+                               const google::protobuf::Message& request,
+                               google::protobuf::Message* response) {
+  const size_t colon = node.rfind(':');
+  if (colon == std::string::npos) {
+    return base::errors::InvalidArgument("bad node address: ", node);
+  }
+  const std::string host = node.substr(0, colon);
+  const int port = atoi(node.c_str() + colon + 1);
+  std::string body;
+  if (!request.SerializeToString(&body)) {
+    return base::errors::InvalidArgument("can not serialize ", method, " request");
+  }
+
+  struct event_base* base = event_base_new();
+  if (base == nullptr) {
+    return base::errors::Internal("event_base_new failed");
+  }
+  struct evhttp_connection* conn =
+      evhttp_connection_base_new(base, nullptr, host.c_str(), port);
+  if (conn == nullptr) {
+    event_base_free(base);
+    return base::errors::Unavailable("can not connect to ", node);
+  }
+  struct timeval timeout;
+  timeout.tv_sec = options_.timeout_micros / 1000000;
+  timeout.tv_usec = options_.timeout_micros % 1000000;
+  evhttp_connection_set_timeout_tv(conn, &timeout);
+
+  CallContext context;
+  // 发送后由 evhttp 释放
+  struct evhttp_request* http_request = evhttp_request_new(OnResponse, &context);
+  struct evkeyvalq* headers = evhttp_request_get_output_headers(http_request);
+  evhttp_add_header(headers, "Host", host.c_str());
+  evhttp_add_header(headers, "Content-Type", "application/x-protobuf");
+  evbuffer_add(evhttp_request_get_output_buffer(http_request),
+               body.data(), body.size());
+  const std::string uri = "/chubby/" + method;
+  base::Status status;
+  if (evhttp_make_request(conn, http_request, EVHTTP_REQ_POST, uri.c_str()) != 0) {
+    status = base::errors::Unavailable("can not send ", method, " to ", node);
+  } else {
+    event_base_dispatch(base);
+    if (!context.done || context.code == 0) {
+      status = base::errors::Unavailable(method, " to ", node, " failed");
+    } else if (context.code != HTTP_OK) {
+      status = base::errors::Unavailable(method, " to ", node, " returned HTTP ",
+                                         context.code);
+    } else if (!response->ParseFromString(context.body)) {
+      status = base::errors::DataLoss("bad ", method, " response from ", node);
+    }
+  }
+  evhttp_connection_free(conn);
+  event_base_free(base);
+  return status;
+}
+
+} // namespace chubby
+} // namespace mpr
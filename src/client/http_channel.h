@@ -0,0 +1,59 @@
+#ifndef MPR_CHUBBY_CLIENT_HTTP_CHANNEL_H_
+#define MPR_CHUBBY_CLIENT_HTTP_CHANNEL_H_
+
+#include <string>
+
+#include "client/chubby_client.h"
+
+namespace google {
+namespace protobuf {
+class Message;
+} // namespace protobuf
+} // namespace google
+
+namespace mpr {
+namespace chubby {
+
+// 基于 libevent evhttp 的 ClientChannel.
+//
+// node 是 "host:port", 每个方法 POST 序列化的请求到 http://node/chubby/<方法>,
+// 响应体是序列化的响应. 每次调用使用自己的 event_base 和连接, 可以在多个线程
+// 上并发调用.
+class HttpChannel : public ClientChannel {
+ public:
+  struct Options {
+    // 必须大于挂起的 KeepAlive 的时间
+    int64_t timeout_micros;
+
+    Options();
+  };
+
+  explicit HttpChannel(const Options& options);
+
+  base::Status Get(const std::string& node, const GetRequest& request,
+                   GetResponse* response) override;
+  base::Status Put(const std::string& node, const PutRequest& request,
+                   PutResponse* response) override;
+  base::Status Delete(const std::string& node, const DelRequest& request,
+                      DelResponse* response) override;
+  base::Status Lock(const std::string& node, const LockRequest& request,
+                    LockResponse* response) override;
+  base::Status UnLock(const std::string& node, const UnLockRequest& request,
+                      UnLockResponse* response) override;
+  base::Status KeepAlive(const std::string& node,
+                         const KeepAliveRequest& request,
+                         KeepAliveResponse* response) override;
+
+ private:
+  base::Status Call(const std::string& node, const std::string& method,
+                    const google::protobuf::Message& request,
+                    google::protobuf::Message* response);
+
+  const Options options_;
+
+  DISALLOW_COPY_AND_ASSIGN(HttpChannel);
+};
+
+} // namespace chubby
+} // namespace mpr
+#endif // MPR_CHUBBY_CLIENT_HTTP_CHANNEL_H_
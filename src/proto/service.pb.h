@@ -1,103 +1,293 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: service.proto
 
-#ifndef PROTOBUF_service_2eproto__INCLUDED
-#define PROTOBUF_service_2eproto__INCLUDED
+#ifndef GOOGLE_PROTOBUF_INCLUDED_service_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_service_2eproto
 
+#include <limits>
 #include <string>
 
-#include <google/protobuf/stubs/common.h>
-
-#if GOOGLE_PROTOBUF_VERSION < 3000000
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please update
+#error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3000000 < GOOGLE_PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please
+#error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
 #endif
 
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_bases.h>
 #include <google/protobuf/generated_message_util.h>
-#include <google/protobuf/metadata.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/message.h>
-#include <google/protobuf/repeated_field.h>
-#include <google/protobuf/extension_set.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
 #include <google/protobuf/generated_enum_reflection.h>
 #include <google/protobuf/unknown_field_set.h>
 // @@protoc_insertion_point(includes)
-
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_service_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_service_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_service_2eproto;
 namespace mpr {
 namespace chubby {
-
-// Internal implementation detail -- do not call these.
-void protobuf_AddDesc_service_2eproto();
-void protobuf_AssignDesc_service_2eproto();
-void protobuf_ShutdownFile_service_2eproto();
-
 class AppendEntriesRequest;
+struct AppendEntriesRequestDefaultTypeInternal;
+extern AppendEntriesRequestDefaultTypeInternal _AppendEntriesRequest_default_instance_;
 class AppendEntriesResponse;
+struct AppendEntriesResponseDefaultTypeInternal;
+extern AppendEntriesResponseDefaultTypeInternal _AppendEntriesResponse_default_instance_;
 class CleanBinlogRequest;
+struct CleanBinlogRequestDefaultTypeInternal;
+extern CleanBinlogRequestDefaultTypeInternal _CleanBinlogRequest_default_instance_;
 class CleanBinlogResponse;
+struct CleanBinlogResponseDefaultTypeInternal;
+extern CleanBinlogResponseDefaultTypeInternal _CleanBinlogResponse_default_instance_;
+class CoalescedHeartbeatRequest;
+struct CoalescedHeartbeatRequestDefaultTypeInternal;
+extern CoalescedHeartbeatRequestDefaultTypeInternal _CoalescedHeartbeatRequest_default_instance_;
+class CoalescedHeartbeatResponse;
+struct CoalescedHeartbeatResponseDefaultTypeInternal;
+extern CoalescedHeartbeatResponseDefaultTypeInternal _CoalescedHeartbeatResponse_default_instance_;
 class DelRequest;
+struct DelRequestDefaultTypeInternal;
+extern DelRequestDefaultTypeInternal _DelRequest_default_instance_;
 class DelResponse;
+struct DelResponseDefaultTypeInternal;
+extern DelResponseDefaultTypeInternal _DelResponse_default_instance_;
 class Entry;
+struct EntryDefaultTypeInternal;
+extern EntryDefaultTypeInternal _Entry_default_instance_;
 class GetRequest;
+struct GetRequestDefaultTypeInternal;
+extern GetRequestDefaultTypeInternal _GetRequest_default_instance_;
 class GetResponse;
+struct GetResponseDefaultTypeInternal;
+extern GetResponseDefaultTypeInternal _GetResponse_default_instance_;
+class GroupHeartbeat;
+struct GroupHeartbeatDefaultTypeInternal;
+extern GroupHeartbeatDefaultTypeInternal _GroupHeartbeat_default_instance_;
+class GroupHeartbeatResponse;
+struct GroupHeartbeatResponseDefaultTypeInternal;
+extern GroupHeartbeatResponseDefaultTypeInternal _GroupHeartbeatResponse_default_instance_;
+class KeepAliveBatchRequest;
+struct KeepAliveBatchRequestDefaultTypeInternal;
+extern KeepAliveBatchRequestDefaultTypeInternal _KeepAliveBatchRequest_default_instance_;
+class KeepAliveBatchResponse;
+struct KeepAliveBatchResponseDefaultTypeInternal;
+extern KeepAliveBatchResponseDefaultTypeInternal _KeepAliveBatchResponse_default_instance_;
 class KeepAliveRequest;
+struct KeepAliveRequestDefaultTypeInternal;
+extern KeepAliveRequestDefaultTypeInternal _KeepAliveRequest_default_instance_;
 class KeepAliveResponse;
+struct KeepAliveResponseDefaultTypeInternal;
+extern KeepAliveResponseDefaultTypeInternal _KeepAliveResponse_default_instance_;
 class LockRequest;
+struct LockRequestDefaultTypeInternal;
+extern LockRequestDefaultTypeInternal _LockRequest_default_instance_;
 class LockResponse;
+struct LockResponseDefaultTypeInternal;
+extern LockResponseDefaultTypeInternal _LockResponse_default_instance_;
 class LoginRequest;
+struct LoginRequestDefaultTypeInternal;
+extern LoginRequestDefaultTypeInternal _LoginRequest_default_instance_;
 class LoginResponse;
+struct LoginResponseDefaultTypeInternal;
+extern LoginResponseDefaultTypeInternal _LoginResponse_default_instance_;
 class LogoutRequest;
+struct LogoutRequestDefaultTypeInternal;
+extern LogoutRequestDefaultTypeInternal _LogoutRequest_default_instance_;
 class LogoutResponse;
+struct LogoutResponseDefaultTypeInternal;
+extern LogoutResponseDefaultTypeInternal _LogoutResponse_default_instance_;
 class PutRequest;
+struct PutRequestDefaultTypeInternal;
+extern PutRequestDefaultTypeInternal _PutRequest_default_instance_;
 class PutResponse;
+struct PutResponseDefaultTypeInternal;
+extern PutResponseDefaultTypeInternal _PutResponse_default_instance_;
 class RegisterRequest;
+struct RegisterRequestDefaultTypeInternal;
+extern RegisterRequestDefaultTypeInternal _RegisterRequest_default_instance_;
 class RegisterResponse;
+struct RegisterResponseDefaultTypeInternal;
+extern RegisterResponseDefaultTypeInternal _RegisterResponse_default_instance_;
 class RpcStatRequest;
+struct RpcStatRequestDefaultTypeInternal;
+extern RpcStatRequestDefaultTypeInternal _RpcStatRequest_default_instance_;
 class RpcStatResponse;
+struct RpcStatResponseDefaultTypeInternal;
+extern RpcStatResponseDefaultTypeInternal _RpcStatResponse_default_instance_;
 class ScanItem;
+struct ScanItemDefaultTypeInternal;
+extern ScanItemDefaultTypeInternal _ScanItem_default_instance_;
 class ScanRequest;
+struct ScanRequestDefaultTypeInternal;
+extern ScanRequestDefaultTypeInternal _ScanRequest_default_instance_;
 class ScanResponse;
+struct ScanResponseDefaultTypeInternal;
+extern ScanResponseDefaultTypeInternal _ScanResponse_default_instance_;
+class ShardInfo;
+struct ShardInfoDefaultTypeInternal;
+extern ShardInfoDefaultTypeInternal _ShardInfo_default_instance_;
+class ShardMapInfo;
+struct ShardMapInfoDefaultTypeInternal;
+extern ShardMapInfoDefaultTypeInternal _ShardMapInfo_default_instance_;
 class ShowStatusRequest;
+struct ShowStatusRequestDefaultTypeInternal;
+extern ShowStatusRequestDefaultTypeInternal _ShowStatusRequest_default_instance_;
 class ShowStatusResponse;
+struct ShowStatusResponseDefaultTypeInternal;
+extern ShowStatusResponseDefaultTypeInternal _ShowStatusResponse_default_instance_;
+class StaleRead;
+struct StaleReadDefaultTypeInternal;
+extern StaleReadDefaultTypeInternal _StaleRead_default_instance_;
 class StatInfo;
+struct StatInfoDefaultTypeInternal;
+extern StatInfoDefaultTypeInternal _StatInfo_default_instance_;
 class Status;
+struct StatusDefaultTypeInternal;
+extern StatusDefaultTypeInternal _Status_default_instance_;
+class TimeoutNowRequest;
+struct TimeoutNowRequestDefaultTypeInternal;
+extern TimeoutNowRequestDefaultTypeInternal _TimeoutNowRequest_default_instance_;
+class TimeoutNowResponse;
+struct TimeoutNowResponseDefaultTypeInternal;
+extern TimeoutNowResponseDefaultTypeInternal _TimeoutNowResponse_default_instance_;
+class TransferLeadershipRequest;
+struct TransferLeadershipRequestDefaultTypeInternal;
+extern TransferLeadershipRequestDefaultTypeInternal _TransferLeadershipRequest_default_instance_;
+class TransferLeadershipResponse;
+struct TransferLeadershipResponseDefaultTypeInternal;
+extern TransferLeadershipResponseDefaultTypeInternal _TransferLeadershipResponse_default_instance_;
 class UnLockRequest;
+struct UnLockRequestDefaultTypeInternal;
+extern UnLockRequestDefaultTypeInternal _UnLockRequest_default_instance_;
 class UnLockResponse;
+struct UnLockResponseDefaultTypeInternal;
+extern UnLockResponseDefaultTypeInternal _UnLockResponse_default_instance_;
 class UserInfo;
+struct UserInfoDefaultTypeInternal;
+extern UserInfoDefaultTypeInternal _UserInfo_default_instance_;
 class VoteRequest;
+struct VoteRequestDefaultTypeInternal;
+extern VoteRequestDefaultTypeInternal _VoteRequest_default_instance_;
 class VoteResponse;
+struct VoteResponseDefaultTypeInternal;
+extern VoteResponseDefaultTypeInternal _VoteResponse_default_instance_;
+class WatchEvent;
+struct WatchEventDefaultTypeInternal;
+extern WatchEventDefaultTypeInternal _WatchEvent_default_instance_;
+class WatchRequest;
+struct WatchRequestDefaultTypeInternal;
+extern WatchRequestDefaultTypeInternal _WatchRequest_default_instance_;
+class WatchResponse;
+struct WatchResponseDefaultTypeInternal;
+extern WatchResponseDefaultTypeInternal _WatchResponse_default_instance_;
+}  // namespace chubby
+}  // namespace mpr
+PROTOBUF_NAMESPACE_OPEN
+template<> ::mpr::chubby::AppendEntriesRequest* Arena::CreateMaybeMessage<::mpr::chubby::AppendEntriesRequest>(Arena*);
+template<> ::mpr::chubby::AppendEntriesResponse* Arena::CreateMaybeMessage<::mpr::chubby::AppendEntriesResponse>(Arena*);
+template<> ::mpr::chubby::CleanBinlogRequest* Arena::CreateMaybeMessage<::mpr::chubby::CleanBinlogRequest>(Arena*);
+template<> ::mpr::chubby::CleanBinlogResponse* Arena::CreateMaybeMessage<::mpr::chubby::CleanBinlogResponse>(Arena*);
+template<> ::mpr::chubby::CoalescedHeartbeatRequest* Arena::CreateMaybeMessage<::mpr::chubby::CoalescedHeartbeatRequest>(Arena*);
+template<> ::mpr::chubby::CoalescedHeartbeatResponse* Arena::CreateMaybeMessage<::mpr::chubby::CoalescedHeartbeatResponse>(Arena*);
+template<> ::mpr::chubby::DelRequest* Arena::CreateMaybeMessage<::mpr::chubby::DelRequest>(Arena*);
+template<> ::mpr::chubby::DelResponse* Arena::CreateMaybeMessage<::mpr::chubby::DelResponse>(Arena*);
+template<> ::mpr::chubby::Entry* Arena::CreateMaybeMessage<::mpr::chubby::Entry>(Arena*);
+template<> ::mpr::chubby::GetRequest* Arena::CreateMaybeMessage<::mpr::chubby::GetRequest>(Arena*);
+template<> ::mpr::chubby::GetResponse* Arena::CreateMaybeMessage<::mpr::chubby::GetResponse>(Arena*);
+template<> ::mpr::chubby::GroupHeartbeat* Arena::CreateMaybeMessage<::mpr::chubby::GroupHeartbeat>(Arena*);
+template<> ::mpr::chubby::GroupHeartbeatResponse* Arena::CreateMaybeMessage<::mpr::chubby::GroupHeartbeatResponse>(Arena*);
+template<> ::mpr::chubby::KeepAliveBatchRequest* Arena::CreateMaybeMessage<::mpr::chubby::KeepAliveBatchRequest>(Arena*);
+template<> ::mpr::chubby::KeepAliveBatchResponse* Arena::CreateMaybeMessage<::mpr::chubby::KeepAliveBatchResponse>(Arena*);
+template<> ::mpr::chubby::KeepAliveRequest* Arena::CreateMaybeMessage<::mpr::chubby::KeepAliveRequest>(Arena*);
+template<> ::mpr::chubby::KeepAliveResponse* Arena::CreateMaybeMessage<::mpr::chubby::KeepAliveResponse>(Arena*);
+template<> ::mpr::chubby::LockRequest* Arena::CreateMaybeMessage<::mpr::chubby::LockRequest>(Arena*);
+template<> ::mpr::chubby::LockResponse* Arena::CreateMaybeMessage<::mpr::chubby::LockResponse>(Arena*);
+template<> ::mpr::chubby::LoginRequest* Arena::CreateMaybeMessage<::mpr::chubby::LoginRequest>(Arena*);
+template<> ::mpr::chubby::LoginResponse* Arena::CreateMaybeMessage<::mpr::chubby::LoginResponse>(Arena*);
+template<> ::mpr::chubby::LogoutRequest* Arena::CreateMaybeMessage<::mpr::chubby::LogoutRequest>(Arena*);
+template<> ::mpr::chubby::LogoutResponse* Arena::CreateMaybeMessage<::mpr::chubby::LogoutResponse>(Arena*);
+template<> ::mpr::chubby::PutRequest* Arena::CreateMaybeMessage<::mpr::chubby::PutRequest>(Arena*);
+template<> ::mpr::chubby::PutResponse* Arena::CreateMaybeMessage<::mpr::chubby::PutResponse>(Arena*);
+template<> ::mpr::chubby::RegisterRequest* Arena::CreateMaybeMessage<::mpr::chubby::RegisterRequest>(Arena*);
+template<> ::mpr::chubby::RegisterResponse* Arena::CreateMaybeMessage<::mpr::chubby::RegisterResponse>(Arena*);
+template<> ::mpr::chubby::RpcStatRequest* Arena::CreateMaybeMessage<::mpr::chubby::RpcStatRequest>(Arena*);
+template<> ::mpr::chubby::RpcStatResponse* Arena::CreateMaybeMessage<::mpr::chubby::RpcStatResponse>(Arena*);
+template<> ::mpr::chubby::ScanItem* Arena::CreateMaybeMessage<::mpr::chubby::ScanItem>(Arena*);
+template<> ::mpr::chubby::ScanRequest* Arena::CreateMaybeMessage<::mpr::chubby::ScanRequest>(Arena*);
+template<> ::mpr::chubby::ScanResponse* Arena::CreateMaybeMessage<::mpr::chubby::ScanResponse>(Arena*);
+template<> ::mpr::chubby::ShardInfo* Arena::CreateMaybeMessage<::mpr::chubby::ShardInfo>(Arena*);
+template<> ::mpr::chubby::ShardMapInfo* Arena::CreateMaybeMessage<::mpr::chubby::ShardMapInfo>(Arena*);
+template<> ::mpr::chubby::ShowStatusRequest* Arena::CreateMaybeMessage<::mpr::chubby::ShowStatusRequest>(Arena*);
+template<> ::mpr::chubby::ShowStatusResponse* Arena::CreateMaybeMessage<::mpr::chubby::ShowStatusResponse>(Arena*);
+template<> ::mpr::chubby::StaleRead* Arena::CreateMaybeMessage<::mpr::chubby::StaleRead>(Arena*);
+template<> ::mpr::chubby::StatInfo* Arena::CreateMaybeMessage<::mpr::chubby::StatInfo>(Arena*);
+template<> ::mpr::chubby::Status* Arena::CreateMaybeMessage<::mpr::chubby::Status>(Arena*);
+template<> ::mpr::chubby::TimeoutNowRequest* Arena::CreateMaybeMessage<::mpr::chubby::TimeoutNowRequest>(Arena*);
+template<> ::mpr::chubby::TimeoutNowResponse* Arena::CreateMaybeMessage<::mpr::chubby::TimeoutNowResponse>(Arena*);
+template<> ::mpr::chubby::TransferLeadershipRequest* Arena::CreateMaybeMessage<::mpr::chubby::TransferLeadershipRequest>(Arena*);
+template<> ::mpr::chubby::TransferLeadershipResponse* Arena::CreateMaybeMessage<::mpr::chubby::TransferLeadershipResponse>(Arena*);
+template<> ::mpr::chubby::UnLockRequest* Arena::CreateMaybeMessage<::mpr::chubby::UnLockRequest>(Arena*);
+template<> ::mpr::chubby::UnLockResponse* Arena::CreateMaybeMessage<::mpr::chubby::UnLockResponse>(Arena*);
+template<> ::mpr::chubby::UserInfo* Arena::CreateMaybeMessage<::mpr::chubby::UserInfo>(Arena*);
+template<> ::mpr::chubby::VoteRequest* Arena::CreateMaybeMessage<::mpr::chubby::VoteRequest>(Arena*);
+template<> ::mpr::chubby::VoteResponse* Arena::CreateMaybeMessage<::mpr::chubby::VoteResponse>(Arena*);
+template<> ::mpr::chubby::WatchEvent* Arena::CreateMaybeMessage<::mpr::chubby::WatchEvent>(Arena*);
+template<> ::mpr::chubby::WatchRequest* Arena::CreateMaybeMessage<::mpr::chubby::WatchRequest>(Arena*);
+template<> ::mpr::chubby::WatchResponse* Arena::CreateMaybeMessage<::mpr::chubby::WatchResponse>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace mpr {
+namespace chubby {
 
-enum NodeStatus {
+enum NodeStatus : int {
   kLeader = 0,
   kCandiate = 1,
   kFollower = 2,
   kOffline = 3,
-  NodeStatus_INT_MIN_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32min,
-  NodeStatus_INT_MAX_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32max
+  kLearner = 4,
+  NodeStatus_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  NodeStatus_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
 };
 bool NodeStatus_IsValid(int value);
-const NodeStatus NodeStatus_MIN = kLeader;
-const NodeStatus NodeStatus_MAX = kOffline;
-const int NodeStatus_ARRAYSIZE = NodeStatus_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* NodeStatus_descriptor();
-inline const ::std::string& NodeStatus_Name(NodeStatus value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    NodeStatus_descriptor(), value);
+constexpr NodeStatus NodeStatus_MIN = kLeader;
+constexpr NodeStatus NodeStatus_MAX = kLearner;
+constexpr int NodeStatus_ARRAYSIZE = NodeStatus_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* NodeStatus_descriptor();
+template<typename T>
+inline const std::string& NodeStatus_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, NodeStatus>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function NodeStatus_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    NodeStatus_descriptor(), enum_t_value);
 }
 inline bool NodeStatus_Parse(
-    const ::std::string& name, NodeStatus* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<NodeStatus>(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, NodeStatus* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<NodeStatus>(
     NodeStatus_descriptor(), name, value);
 }
-enum LogOperation {
+enum LogOperation : int {
   kLogOperationUnknown = 0,
   kPut = 1,
   kDel = 2,
@@ -106,26 +296,32 @@ enum LogOperation {
   kLogin = 5,
   kLogout = 6,
   kRegister = 7,
+  kIngest = 8,
+  kTokenKey = 9,
   kNop = 10,
-  LogOperation_INT_MIN_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32min,
-  LogOperation_INT_MAX_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32max
+  LogOperation_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  LogOperation_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
 };
 bool LogOperation_IsValid(int value);
-const LogOperation LogOperation_MIN = kLogOperationUnknown;
-const LogOperation LogOperation_MAX = kNop;
-const int LogOperation_ARRAYSIZE = LogOperation_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* LogOperation_descriptor();
-inline const ::std::string& LogOperation_Name(LogOperation value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    LogOperation_descriptor(), value);
+constexpr LogOperation LogOperation_MIN = kLogOperationUnknown;
+constexpr LogOperation LogOperation_MAX = kNop;
+constexpr int LogOperation_ARRAYSIZE = LogOperation_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* LogOperation_descriptor();
+template<typename T>
+inline const std::string& LogOperation_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, LogOperation>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function LogOperation_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    LogOperation_descriptor(), enum_t_value);
 }
 inline bool LogOperation_Parse(
-    const ::std::string& name, LogOperation* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<LogOperation>(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, LogOperation* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<LogOperation>(
     LogOperation_descriptor(), name, value);
 }
-enum StatOperation {
+enum StatOperation : int {
   kStatOperationUnknown = 0,
   kPutOp = 1,
   kGetOp = 2,
@@ -134,6681 +330,16303 @@ enum StatOperation {
   kKeepAliveOp = 5,
   kLockOp = 6,
   kUnlockOp = 7,
-  StatOperation_INT_MIN_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32min,
-  StatOperation_INT_MAX_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32max
+  kWatchOp = 8,
+  StatOperation_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  StatOperation_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
 };
 bool StatOperation_IsValid(int value);
-const StatOperation StatOperation_MIN = kStatOperationUnknown;
-const StatOperation StatOperation_MAX = kUnlockOp;
-const int StatOperation_ARRAYSIZE = StatOperation_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* StatOperation_descriptor();
-inline const ::std::string& StatOperation_Name(StatOperation value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    StatOperation_descriptor(), value);
+constexpr StatOperation StatOperation_MIN = kStatOperationUnknown;
+constexpr StatOperation StatOperation_MAX = kWatchOp;
+constexpr int StatOperation_ARRAYSIZE = StatOperation_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* StatOperation_descriptor();
+template<typename T>
+inline const std::string& StatOperation_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, StatOperation>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function StatOperation_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    StatOperation_descriptor(), enum_t_value);
 }
 inline bool StatOperation_Parse(
-    const ::std::string& name, StatOperation* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<StatOperation>(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, StatOperation* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<StatOperation>(
     StatOperation_descriptor(), name, value);
 }
 // ===================================================================
 
-class UserInfo : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:mpr.chubby.UserInfo) */ {
+class UserInfo final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mpr.chubby.UserInfo) */ {
  public:
-  UserInfo();
-  virtual ~UserInfo();
+  inline UserInfo() : UserInfo(nullptr) {}
+  ~UserInfo() override;
+  explicit PROTOBUF_CONSTEXPR UserInfo(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   UserInfo(const UserInfo& from);
+  UserInfo(UserInfo&& from) noexcept
+    : UserInfo() {
+    *this = ::std::move(from);
+  }
 
   inline UserInfo& operator=(const UserInfo& from) {
     CopyFrom(from);
     return *this;
   }
+  inline UserInfo& operator=(UserInfo&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const UserInfo& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const UserInfo& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const UserInfo* internal_default_instance() {
+    return reinterpret_cast<const UserInfo*>(
+               &_UserInfo_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
 
-  void Swap(UserInfo* other);
+  friend void swap(UserInfo& a, UserInfo& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(UserInfo* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(UserInfo* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline UserInfo* New() const { return New(NULL); }
-
-  UserInfo* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  UserInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<UserInfo>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const UserInfo& from);
-  void MergeFrom(const UserInfo& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const UserInfo& from) {
+    UserInfo::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
   void InternalSwap(UserInfo* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mpr.chubby.UserInfo";
   }
+  protected:
+  explicit UserInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // optional string username = 1;
+  enum : int {
+    kUsernameFieldNumber = 1,
+    kPasswordFieldNumber = 2,
+  };
+  // string username = 1;
   void clear_username();
-  static const int kUsernameFieldNumber = 1;
-  const ::std::string& username() const;
-  void set_username(const ::std::string& value);
-  void set_username(const char* value);
-  void set_username(const char* value, size_t size);
-  ::std::string* mutable_username();
-  ::std::string* release_username();
-  void set_allocated_username(::std::string* username);
-
-  // optional string password = 2;
+  const std::string& username() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_username(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_username();
+  PROTOBUF_NODISCARD std::string* release_username();
+  void set_allocated_username(std::string* username);
+  private:
+  const std::string& _internal_username() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_username(const std::string& value);
+  std::string* _internal_mutable_username();
+  public:
+
+  // string password = 2;
   void clear_password();
-  static const int kPasswordFieldNumber = 2;
-  const ::std::string& password() const;
-  void set_password(const ::std::string& value);
-  void set_password(const char* value);
-  void set_password(const char* value, size_t size);
-  ::std::string* mutable_password();
-  ::std::string* release_password();
-  void set_allocated_password(::std::string* password);
+  const std::string& password() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_password(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_password();
+  PROTOBUF_NODISCARD std::string* release_password();
+  void set_allocated_password(std::string* password);
+  private:
+  const std::string& _internal_password() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_password(const std::string& value);
+  std::string* _internal_mutable_password();
+  public:
 
   // @@protoc_insertion_point(class_scope:mpr.chubby.UserInfo)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  bool _is_default_instance_;
-  ::google::protobuf::internal::ArenaStringPtr username_;
-  ::google::protobuf::internal::ArenaStringPtr password_;
-  mutable int _cached_size_;
-  friend void  protobuf_AddDesc_service_2eproto();
-  friend void protobuf_AssignDesc_service_2eproto();
-  friend void protobuf_ShutdownFile_service_2eproto();
-
-  void InitAsDefaultInstance();
-  static UserInfo* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr username_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr password_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_service_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Entry : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:mpr.chubby.Entry) */ {
+class Entry final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mpr.chubby.Entry) */ {
  public:
-  Entry();
-  virtual ~Entry();
+  inline Entry() : Entry(nullptr) {}
+  ~Entry() override;
+  explicit PROTOBUF_CONSTEXPR Entry(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Entry(const Entry& from);
+  Entry(Entry&& from) noexcept
+    : Entry() {
+    *this = ::std::move(from);
+  }
 
   inline Entry& operator=(const Entry& from) {
     CopyFrom(from);
     return *this;
   }
+  inline Entry& operator=(Entry&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const Entry& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Entry& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Entry* internal_default_instance() {
+    return reinterpret_cast<const Entry*>(
+               &_Entry_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
 
-  void Swap(Entry* other);
+  friend void swap(Entry& a, Entry& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Entry* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Entry* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline Entry* New() const { return New(NULL); }
-
-  Entry* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  Entry* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Entry>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Entry& from);
-  void MergeFrom(const Entry& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Entry& from) {
+    Entry::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
   void InternalSwap(Entry* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mpr.chubby.Entry";
   }
+  protected:
+  explicit Entry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // optional string key = 1;
+  enum : int {
+    kKeyFieldNumber = 1,
+    kValueFieldNumber = 2,
+    kUserFieldNumber = 5,
+    kDedupKeyFieldNumber = 6,
+    kTermFieldNumber = 3,
+    kOpFieldNumber = 4,
+  };
+  // string key = 1;
   void clear_key();
-  static const int kKeyFieldNumber = 1;
-  const ::std::string& key() const;
-  void set_key(const ::std::string& value);
-  void set_key(const char* value);
-  void set_key(const char* value, size_t size);
-  ::std::string* mutable_key();
-  ::std::string* release_key();
-  void set_allocated_key(::std::string* key);
-
-  // optional bytes value = 2;
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
+
+  // bytes value = 2;
   void clear_value();
-  static const int kValueFieldNumber = 2;
-  const ::std::string& value() const;
-  void set_value(const ::std::string& value);
-  void set_value(const char* value);
-  void set_value(const void* value, size_t size);
-  ::std::string* mutable_value();
-  ::std::string* release_value();
-  void set_allocated_value(::std::string* value);
-
-  // optional int64 term = 3;
+  const std::string& value() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_value();
+  PROTOBUF_NODISCARD std::string* release_value();
+  void set_allocated_value(std::string* value);
+  private:
+  const std::string& _internal_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
+  std::string* _internal_mutable_value();
+  public:
+
+  // string user = 5;
+  void clear_user();
+  const std::string& user() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_user(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_user();
+  PROTOBUF_NODISCARD std::string* release_user();
+  void set_allocated_user(std::string* user);
+  private:
+  const std::string& _internal_user() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_user(const std::string& value);
+  std::string* _internal_mutable_user();
+  public:
+
+  // bytes dedup_key = 6;
+  void clear_dedup_key();
+  const std::string& dedup_key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_dedup_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_dedup_key();
+  PROTOBUF_NODISCARD std::string* release_dedup_key();
+  void set_allocated_dedup_key(std::string* dedup_key);
+  private:
+  const std::string& _internal_dedup_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_dedup_key(const std::string& value);
+  std::string* _internal_mutable_dedup_key();
+  public:
+
+  // int64 term = 3;
   void clear_term();
-  static const int kTermFieldNumber = 3;
-  ::google::protobuf::int64 term() const;
-  void set_term(::google::protobuf::int64 value);
+  int64_t term() const;
+  void set_term(int64_t value);
+  private:
+  int64_t _internal_term() const;
+  void _internal_set_term(int64_t value);
+  public:
 
-  // optional .mpr.chubby.LogOperation op = 4;
+  // .mpr.chubby.LogOperation op = 4;
   void clear_op();
-  static const int kOpFieldNumber = 4;
   ::mpr::chubby::LogOperation op() const;
   void set_op(::mpr::chubby::LogOperation value);
-
-  // optional string user = 5;
-  void clear_user();
-  static const int kUserFieldNumber = 5;
-  const ::std::string& user() const;
-  void set_user(const ::std::string& value);
-  void set_user(const char* value);
-  void set_user(const char* value, size_t size);
-  ::std::string* mutable_user();
-  ::std::string* release_user();
-  void set_allocated_user(::std::string* user);
+  private:
+  ::mpr::chubby::LogOperation _internal_op() const;
+  void _internal_set_op(::mpr::chubby::LogOperation value);
+  public:
 
   // @@protoc_insertion_point(class_scope:mpr.chubby.Entry)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  bool _is_default_instance_;
-  ::google::protobuf::internal::ArenaStringPtr key_;
-  ::google::protobuf::internal::ArenaStringPtr value_;
-  ::google::protobuf::int64 term_;
-  ::google::protobuf::internal::ArenaStringPtr user_;
-  int op_;
-  mutable int _cached_size_;
-  friend void  protobuf_AddDesc_service_2eproto();
-  friend void protobuf_AssignDesc_service_2eproto();
-  friend void protobuf_ShutdownFile_service_2eproto();
-
-  void InitAsDefaultInstance();
-  static Entry* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr user_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr dedup_key_;
+    int64_t term_;
+    int op_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_service_2eproto;
 };
 // -------------------------------------------------------------------
 
-class StatInfo : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:mpr.chubby.StatInfo) */ {
+class StatInfo final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mpr.chubby.StatInfo) */ {
  public:
-  StatInfo();
-  virtual ~StatInfo();
+  inline StatInfo() : StatInfo(nullptr) {}
+  ~StatInfo() override;
+  explicit PROTOBUF_CONSTEXPR StatInfo(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   StatInfo(const StatInfo& from);
+  StatInfo(StatInfo&& from) noexcept
+    : StatInfo() {
+    *this = ::std::move(from);
+  }
 
   inline StatInfo& operator=(const StatInfo& from) {
     CopyFrom(from);
     return *this;
   }
+  inline StatInfo& operator=(StatInfo&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const StatInfo& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const StatInfo& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const StatInfo* internal_default_instance() {
+    return reinterpret_cast<const StatInfo*>(
+               &_StatInfo_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
 
-  void Swap(StatInfo* other);
+  friend void swap(StatInfo& a, StatInfo& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(StatInfo* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(StatInfo* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline StatInfo* New() const { return New(NULL); }
-
-  StatInfo* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  StatInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<StatInfo>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const StatInfo& from);
-  void MergeFrom(const StatInfo& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const StatInfo& from) {
+    StatInfo::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
   void InternalSwap(StatInfo* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mpr.chubby.StatInfo";
   }
+  protected:
+  explicit StatInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // optional int64 current_stat = 1;
+  enum : int {
+    kCurrentStatFieldNumber = 1,
+    kAverageStatFieldNumber = 2,
+  };
+  // int64 current_stat = 1;
   void clear_current_stat();
-  static const int kCurrentStatFieldNumber = 1;
-  ::google::protobuf::int64 current_stat() const;
-  void set_current_stat(::google::protobuf::int64 value);
+  int64_t current_stat() const;
+  void set_current_stat(int64_t value);
+  private:
+  int64_t _internal_current_stat() const;
+  void _internal_set_current_stat(int64_t value);
+  public:
 
-  // optional int64 average_stat = 2;
+  // int64 average_stat = 2;
   void clear_average_stat();
-  static const int kAverageStatFieldNumber = 2;
-  ::google::protobuf::int64 average_stat() const;
-  void set_average_stat(::google::protobuf::int64 value);
+  int64_t average_stat() const;
+  void set_average_stat(int64_t value);
+  private:
+  int64_t _internal_average_stat() const;
+  void _internal_set_average_stat(int64_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:mpr.chubby.StatInfo)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  bool _is_default_instance_;
-  ::google::protobuf::int64 current_stat_;
-  ::google::protobuf::int64 average_stat_;
-  mutable int _cached_size_;
-  friend void  protobuf_AddDesc_service_2eproto();
-  friend void protobuf_AssignDesc_service_2eproto();
-  friend void protobuf_ShutdownFile_service_2eproto();
-
-  void InitAsDefaultInstance();
-  static StatInfo* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int64_t current_stat_;
+    int64_t average_stat_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_service_2eproto;
 };
 // -------------------------------------------------------------------
 
-class AppendEntriesRequest : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:mpr.chubby.AppendEntriesRequest) */ {
+class AppendEntriesRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mpr.chubby.AppendEntriesRequest) */ {
  public:
-  AppendEntriesRequest();
-  virtual ~AppendEntriesRequest();
+  inline AppendEntriesRequest() : AppendEntriesRequest(nullptr) {}
+  ~AppendEntriesRequest() override;
+  explicit PROTOBUF_CONSTEXPR AppendEntriesRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   AppendEntriesRequest(const AppendEntriesRequest& from);
+  AppendEntriesRequest(AppendEntriesRequest&& from) noexcept
+    : AppendEntriesRequest() {
+    *this = ::std::move(from);
+  }
 
   inline AppendEntriesRequest& operator=(const AppendEntriesRequest& from) {
     CopyFrom(from);
     return *this;
   }
+  inline AppendEntriesRequest& operator=(AppendEntriesRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const AppendEntriesRequest& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const AppendEntriesRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const AppendEntriesRequest* internal_default_instance() {
+    return reinterpret_cast<const AppendEntriesRequest*>(
+               &_AppendEntriesRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
 
-  void Swap(AppendEntriesRequest* other);
+  friend void swap(AppendEntriesRequest& a, AppendEntriesRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(AppendEntriesRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(AppendEntriesRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline AppendEntriesRequest* New() const { return New(NULL); }
-
-  AppendEntriesRequest* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  AppendEntriesRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<AppendEntriesRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const AppendEntriesRequest& from);
-  void MergeFrom(const AppendEntriesRequest& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const AppendEntriesRequest& from) {
+    AppendEntriesRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
   void InternalSwap(AppendEntriesRequest* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mpr.chubby.AppendEntriesRequest";
   }
+  protected:
+  explicit AppendEntriesRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // optional int64 term = 1;
-  void clear_term();
-  static const int kTermFieldNumber = 1;
-  ::google::protobuf::int64 term() const;
-  void set_term(::google::protobuf::int64 value);
+  enum : int {
+    kEntriesFieldNumber = 6,
+    kLeaderIdFieldNumber = 2,
+    kTermFieldNumber = 1,
+    kPrevLogIndexFieldNumber = 3,
+    kPrevLogTermFieldNumber = 4,
+    kLeaderCommitIndexFieldNumber = 5,
+    kHeartbeatIntervalMicrosFieldNumber = 8,
+    kGroupIdFieldNumber = 7,
+  };
+  // repeated .mpr.chubby.Entry entries = 6;
+  int entries_size() const;
+  private:
+  int _internal_entries_size() const;
+  public:
+  void clear_entries();
+  ::mpr::chubby::Entry* mutable_entries(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::mpr::chubby::Entry >*
+      mutable_entries();
+  private:
+  const ::mpr::chubby::Entry& _internal_entries(int index) const;
+  ::mpr::chubby::Entry* _internal_add_entries();
+  public:
+  const ::mpr::chubby::Entry& entries(int index) const;
+  ::mpr::chubby::Entry* add_entries();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::mpr::chubby::Entry >&
+      entries() const;
 
-  // optional string leader_id = 2;
+  // string leader_id = 2;
   void clear_leader_id();
-  static const int kLeaderIdFieldNumber = 2;
-  const ::std::string& leader_id() const;
-  void set_leader_id(const ::std::string& value);
-  void set_leader_id(const char* value);
-  void set_leader_id(const char* value, size_t size);
-  ::std::string* mutable_leader_id();
-  ::std::string* release_leader_id();
-  void set_allocated_leader_id(::std::string* leader_id);
-
-  // optional int64 prev_log_index = 3;
+  const std::string& leader_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_leader_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_leader_id();
+  PROTOBUF_NODISCARD std::string* release_leader_id();
+  void set_allocated_leader_id(std::string* leader_id);
+  private:
+  const std::string& _internal_leader_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_leader_id(const std::string& value);
+  std::string* _internal_mutable_leader_id();
+  public:
+
+  // int64 term = 1;
+  void clear_term();
+  int64_t term() const;
+  void set_term(int64_t value);
+  private:
+  int64_t _internal_term() const;
+  void _internal_set_term(int64_t value);
+  public:
+
+  // int64 prev_log_index = 3;
   void clear_prev_log_index();
-  static const int kPrevLogIndexFieldNumber = 3;
-  ::google::protobuf::int64 prev_log_index() const;
-  void set_prev_log_index(::google::protobuf::int64 value);
+  int64_t prev_log_index() const;
+  void set_prev_log_index(int64_t value);
+  private:
+  int64_t _internal_prev_log_index() const;
+  void _internal_set_prev_log_index(int64_t value);
+  public:
 
-  // optional int64 prev_log_term = 4;
+  // int64 prev_log_term = 4;
   void clear_prev_log_term();
-  static const int kPrevLogTermFieldNumber = 4;
-  ::google::protobuf::int64 prev_log_term() const;
-  void set_prev_log_term(::google::protobuf::int64 value);
+  int64_t prev_log_term() const;
+  void set_prev_log_term(int64_t value);
+  private:
+  int64_t _internal_prev_log_term() const;
+  void _internal_set_prev_log_term(int64_t value);
+  public:
 
-  // optional int64 leader_commit_index = 5;
+  // int64 leader_commit_index = 5;
   void clear_leader_commit_index();
-  static const int kLeaderCommitIndexFieldNumber = 5;
-  ::google::protobuf::int64 leader_commit_index() const;
-  void set_leader_commit_index(::google::protobuf::int64 value);
+  int64_t leader_commit_index() const;
+  void set_leader_commit_index(int64_t value);
+  private:
+  int64_t _internal_leader_commit_index() const;
+  void _internal_set_leader_commit_index(int64_t value);
+  public:
 
-  // repeated .mpr.chubby.Entry entries = 6;
-  int entries_size() const;
-  void clear_entries();
-  static const int kEntriesFieldNumber = 6;
-  const ::mpr::chubby::Entry& entries(int index) const;
-  ::mpr::chubby::Entry* mutable_entries(int index);
-  ::mpr::chubby::Entry* add_entries();
-  ::google::protobuf::RepeatedPtrField< ::mpr::chubby::Entry >*
-      mutable_entries();
-  const ::google::protobuf::RepeatedPtrField< ::mpr::chubby::Entry >&
-      entries() const;
+  // int64 heartbeat_interval_micros = 8;
+  void clear_heartbeat_interval_micros();
+  int64_t heartbeat_interval_micros() const;
+  void set_heartbeat_interval_micros(int64_t value);
+  private:
+  int64_t _internal_heartbeat_interval_micros() const;
+  void _internal_set_heartbeat_interval_micros(int64_t value);
+  public:
+
+  // int32 group_id = 7;
+  void clear_group_id();
+  int32_t group_id() const;
+  void set_group_id(int32_t value);
+  private:
+  int32_t _internal_group_id() const;
+  void _internal_set_group_id(int32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:mpr.chubby.AppendEntriesRequest)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  bool _is_default_instance_;
-  ::google::protobuf::int64 term_;
-  ::google::protobuf::internal::ArenaStringPtr leader_id_;
-  ::google::protobuf::int64 prev_log_index_;
-  ::google::protobuf::int64 prev_log_term_;
-  ::google::protobuf::int64 leader_commit_index_;
-  ::google::protobuf::RepeatedPtrField< ::mpr::chubby::Entry > entries_;
-  mutable int _cached_size_;
-  friend void  protobuf_AddDesc_service_2eproto();
-  friend void protobuf_AssignDesc_service_2eproto();
-  friend void protobuf_ShutdownFile_service_2eproto();
-
-  void InitAsDefaultInstance();
-  static AppendEntriesRequest* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::mpr::chubby::Entry > entries_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr leader_id_;
+    int64_t term_;
+    int64_t prev_log_index_;
+    int64_t prev_log_term_;
+    int64_t leader_commit_index_;
+    int64_t heartbeat_interval_micros_;
+    int32_t group_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_service_2eproto;
 };
 // -------------------------------------------------------------------
 
-class AppendEntriesResponse : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:mpr.chubby.AppendEntriesResponse) */ {
+class AppendEntriesResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mpr.chubby.AppendEntriesResponse) */ {
  public:
-  AppendEntriesResponse();
-  virtual ~AppendEntriesResponse();
+  inline AppendEntriesResponse() : AppendEntriesResponse(nullptr) {}
+  ~AppendEntriesResponse() override;
+  explicit PROTOBUF_CONSTEXPR AppendEntriesResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   AppendEntriesResponse(const AppendEntriesResponse& from);
+  AppendEntriesResponse(AppendEntriesResponse&& from) noexcept
+    : AppendEntriesResponse() {
+    *this = ::std::move(from);
+  }
 
   inline AppendEntriesResponse& operator=(const AppendEntriesResponse& from) {
     CopyFrom(from);
     return *this;
   }
+  inline AppendEntriesResponse& operator=(AppendEntriesResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const AppendEntriesResponse& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const AppendEntriesResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const AppendEntriesResponse* internal_default_instance() {
+    return reinterpret_cast<const AppendEntriesResponse*>(
+               &_AppendEntriesResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
 
-  void Swap(AppendEntriesResponse* other);
+  friend void swap(AppendEntriesResponse& a, AppendEntriesResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(AppendEntriesResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(AppendEntriesResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline AppendEntriesResponse* New() const { return New(NULL); }
-
-  AppendEntriesResponse* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  AppendEntriesResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<AppendEntriesResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const AppendEntriesResponse& from);
-  void MergeFrom(const AppendEntriesResponse& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const AppendEntriesResponse& from) {
+    AppendEntriesResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
   void InternalSwap(AppendEntriesResponse* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mpr.chubby.AppendEntriesResponse";
   }
+  protected:
+  explicit AppendEntriesResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // optional int64 current_term = 1;
+  enum : int {
+    kCurrentTermFieldNumber = 1,
+    kLogLengthFieldNumber = 3,
+    kConflictTermFieldNumber = 5,
+    kConflictIndexFieldNumber = 6,
+    kSuccessFieldNumber = 2,
+    kIsBusyFieldNumber = 4,
+  };
+  // int64 current_term = 1;
   void clear_current_term();
-  static const int kCurrentTermFieldNumber = 1;
-  ::google::protobuf::int64 current_term() const;
-  void set_current_term(::google::protobuf::int64 value);
+  int64_t current_term() const;
+  void set_current_term(int64_t value);
+  private:
+  int64_t _internal_current_term() const;
+  void _internal_set_current_term(int64_t value);
+  public:
+
+  // int64 log_length = 3;
+  void clear_log_length();
+  int64_t log_length() const;
+  void set_log_length(int64_t value);
+  private:
+  int64_t _internal_log_length() const;
+  void _internal_set_log_length(int64_t value);
+  public:
+
+  // int64 conflict_term = 5;
+  void clear_conflict_term();
+  int64_t conflict_term() const;
+  void set_conflict_term(int64_t value);
+  private:
+  int64_t _internal_conflict_term() const;
+  void _internal_set_conflict_term(int64_t value);
+  public:
+
+  // int64 conflict_index = 6;
+  void clear_conflict_index();
+  int64_t conflict_index() const;
+  void set_conflict_index(int64_t value);
+  private:
+  int64_t _internal_conflict_index() const;
+  void _internal_set_conflict_index(int64_t value);
+  public:
 
-  // optional bool success = 2;
+  // bool success = 2;
   void clear_success();
-  static const int kSuccessFieldNumber = 2;
   bool success() const;
   void set_success(bool value);
+  private:
+  bool _internal_success() const;
+  void _internal_set_success(bool value);
+  public:
 
-  // optional int64 log_length = 3;
-  void clear_log_length();
-  static const int kLogLengthFieldNumber = 3;
-  ::google::protobuf::int64 log_length() const;
-  void set_log_length(::google::protobuf::int64 value);
-
-  // optional bool is_busy = 4;
+  // bool is_busy = 4;
   void clear_is_busy();
-  static const int kIsBusyFieldNumber = 4;
   bool is_busy() const;
   void set_is_busy(bool value);
+  private:
+  bool _internal_is_busy() const;
+  void _internal_set_is_busy(bool value);
+  public:
 
   // @@protoc_insertion_point(class_scope:mpr.chubby.AppendEntriesResponse)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  bool _is_default_instance_;
-  ::google::protobuf::int64 current_term_;
-  ::google::protobuf::int64 log_length_;
-  bool success_;
-  bool is_busy_;
-  mutable int _cached_size_;
-  friend void  protobuf_AddDesc_service_2eproto();
-  friend void protobuf_AssignDesc_service_2eproto();
-  friend void protobuf_ShutdownFile_service_2eproto();
-
-  void InitAsDefaultInstance();
-  static AppendEntriesResponse* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int64_t current_term_;
+    int64_t log_length_;
+    int64_t conflict_term_;
+    int64_t conflict_index_;
+    bool success_;
+    bool is_busy_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_service_2eproto;
 };
 // -------------------------------------------------------------------
 
-class VoteRequest : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:mpr.chubby.VoteRequest) */ {
+class VoteRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mpr.chubby.VoteRequest) */ {
  public:
-  VoteRequest();
-  virtual ~VoteRequest();
+  inline VoteRequest() : VoteRequest(nullptr) {}
+  ~VoteRequest() override;
+  explicit PROTOBUF_CONSTEXPR VoteRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   VoteRequest(const VoteRequest& from);
+  VoteRequest(VoteRequest&& from) noexcept
+    : VoteRequest() {
+    *this = ::std::move(from);
+  }
 
   inline VoteRequest& operator=(const VoteRequest& from) {
     CopyFrom(from);
     return *this;
   }
+  inline VoteRequest& operator=(VoteRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const VoteRequest& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const VoteRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const VoteRequest* internal_default_instance() {
+    return reinterpret_cast<const VoteRequest*>(
+               &_VoteRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
 
-  void Swap(VoteRequest* other);
+  friend void swap(VoteRequest& a, VoteRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(VoteRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(VoteRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline VoteRequest* New() const { return New(NULL); }
-
-  VoteRequest* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  VoteRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<VoteRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const VoteRequest& from);
-  void MergeFrom(const VoteRequest& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const VoteRequest& from) {
+    VoteRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
   void InternalSwap(VoteRequest* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mpr.chubby.VoteRequest";
   }
+  protected:
+  explicit VoteRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // optional int64 term = 1;
+  enum : int {
+    kCandidateIdFieldNumber = 2,
+    kTermFieldNumber = 1,
+    kLastLogIndexFieldNumber = 3,
+    kLastLogTermFieldNumber = 4,
+    kGroupIdFieldNumber = 5,
+    kPreVoteFieldNumber = 6,
+    kTransferFieldNumber = 7,
+  };
+  // string candidate_id = 2;
+  void clear_candidate_id();
+  const std::string& candidate_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_candidate_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_candidate_id();
+  PROTOBUF_NODISCARD std::string* release_candidate_id();
+  void set_allocated_candidate_id(std::string* candidate_id);
+  private:
+  const std::string& _internal_candidate_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_candidate_id(const std::string& value);
+  std::string* _internal_mutable_candidate_id();
+  public:
+
+  // int64 term = 1;
   void clear_term();
-  static const int kTermFieldNumber = 1;
-  ::google::protobuf::int64 term() const;
-  void set_term(::google::protobuf::int64 value);
+  int64_t term() const;
+  void set_term(int64_t value);
+  private:
+  int64_t _internal_term() const;
+  void _internal_set_term(int64_t value);
+  public:
 
-  // optional string candidate_id = 2;
-  void clear_candidate_id();
-  static const int kCandidateIdFieldNumber = 2;
-  const ::std::string& candidate_id() const;
-  void set_candidate_id(const ::std::string& value);
-  void set_candidate_id(const char* value);
-  void set_candidate_id(const char* value, size_t size);
-  ::std::string* mutable_candidate_id();
-  ::std::string* release_candidate_id();
-  void set_allocated_candidate_id(::std::string* candidate_id);
-
-  // optional int64 last_log_index = 3;
+  // int64 last_log_index = 3;
   void clear_last_log_index();
-  static const int kLastLogIndexFieldNumber = 3;
-  ::google::protobuf::int64 last_log_index() const;
-  void set_last_log_index(::google::protobuf::int64 value);
+  int64_t last_log_index() const;
+  void set_last_log_index(int64_t value);
+  private:
+  int64_t _internal_last_log_index() const;
+  void _internal_set_last_log_index(int64_t value);
+  public:
 
-  // optional int64 last_log_term = 4;
+  // int64 last_log_term = 4;
   void clear_last_log_term();
-  static const int kLastLogTermFieldNumber = 4;
-  ::google::protobuf::int64 last_log_term() const;
-  void set_last_log_term(::google::protobuf::int64 value);
+  int64_t last_log_term() const;
+  void set_last_log_term(int64_t value);
+  private:
+  int64_t _internal_last_log_term() const;
+  void _internal_set_last_log_term(int64_t value);
+  public:
+
+  // int32 group_id = 5;
+  void clear_group_id();
+  int32_t group_id() const;
+  void set_group_id(int32_t value);
+  private:
+  int32_t _internal_group_id() const;
+  void _internal_set_group_id(int32_t value);
+  public:
+
+  // bool pre_vote = 6;
+  void clear_pre_vote();
+  bool pre_vote() const;
+  void set_pre_vote(bool value);
+  private:
+  bool _internal_pre_vote() const;
+  void _internal_set_pre_vote(bool value);
+  public:
+
+  // bool transfer = 7;
+  void clear_transfer();
+  bool transfer() const;
+  void set_transfer(bool value);
+  private:
+  bool _internal_transfer() const;
+  void _internal_set_transfer(bool value);
+  public:
 
   // @@protoc_insertion_point(class_scope:mpr.chubby.VoteRequest)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  bool _is_default_instance_;
-  ::google::protobuf::int64 term_;
-  ::google::protobuf::internal::ArenaStringPtr candidate_id_;
-  ::google::protobuf::int64 last_log_index_;
-  ::google::protobuf::int64 last_log_term_;
-  mutable int _cached_size_;
-  friend void  protobuf_AddDesc_service_2eproto();
-  friend void protobuf_AssignDesc_service_2eproto();
-  friend void protobuf_ShutdownFile_service_2eproto();
-
-  void InitAsDefaultInstance();
-  static VoteRequest* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr candidate_id_;
+    int64_t term_;
+    int64_t last_log_index_;
+    int64_t last_log_term_;
+    int32_t group_id_;
+    bool pre_vote_;
+    bool transfer_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_service_2eproto;
 };
 // -------------------------------------------------------------------
 
-class VoteResponse : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:mpr.chubby.VoteResponse) */ {
+class VoteResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mpr.chubby.VoteResponse) */ {
  public:
-  VoteResponse();
-  virtual ~VoteResponse();
+  inline VoteResponse() : VoteResponse(nullptr) {}
+  ~VoteResponse() override;
+  explicit PROTOBUF_CONSTEXPR VoteResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   VoteResponse(const VoteResponse& from);
+  VoteResponse(VoteResponse&& from) noexcept
+    : VoteResponse() {
+    *this = ::std::move(from);
+  }
 
   inline VoteResponse& operator=(const VoteResponse& from) {
     CopyFrom(from);
     return *this;
   }
+  inline VoteResponse& operator=(VoteResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const VoteResponse& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const VoteResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const VoteResponse* internal_default_instance() {
+    return reinterpret_cast<const VoteResponse*>(
+               &_VoteResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
 
-  void Swap(VoteResponse* other);
+  friend void swap(VoteResponse& a, VoteResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(VoteResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(VoteResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline VoteResponse* New() const { return New(NULL); }
-
-  VoteResponse* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  VoteResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<VoteResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const VoteResponse& from);
-  void MergeFrom(const VoteResponse& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const VoteResponse& from) {
+    VoteResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
   void InternalSwap(VoteResponse* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mpr.chubby.VoteResponse";
   }
+  protected:
+  explicit VoteResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // optional int64 term = 1;
+  enum : int {
+    kTermFieldNumber = 1,
+    kVoteGrantedFieldNumber = 2,
+  };
+  // int64 term = 1;
   void clear_term();
-  static const int kTermFieldNumber = 1;
-  ::google::protobuf::int64 term() const;
-  void set_term(::google::protobuf::int64 value);
+  int64_t term() const;
+  void set_term(int64_t value);
+  private:
+  int64_t _internal_term() const;
+  void _internal_set_term(int64_t value);
+  public:
 
-  // optional bool vote_granted = 2;
+  // bool vote_granted = 2;
   void clear_vote_granted();
-  static const int kVoteGrantedFieldNumber = 2;
   bool vote_granted() const;
   void set_vote_granted(bool value);
+  private:
+  bool _internal_vote_granted() const;
+  void _internal_set_vote_granted(bool value);
+  public:
 
   // @@protoc_insertion_point(class_scope:mpr.chubby.VoteResponse)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  bool _is_default_instance_;
-  ::google::protobuf::int64 term_;
-  bool vote_granted_;
-  mutable int _cached_size_;
-  friend void  protobuf_AddDesc_service_2eproto();
-  friend void protobuf_AssignDesc_service_2eproto();
-  friend void protobuf_ShutdownFile_service_2eproto();
-
-  void InitAsDefaultInstance();
-  static VoteResponse* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int64_t term_;
+    bool vote_granted_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_service_2eproto;
 };
 // -------------------------------------------------------------------
 
-class PutRequest : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:mpr.chubby.PutRequest) */ {
+class TimeoutNowRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mpr.chubby.TimeoutNowRequest) */ {
  public:
-  PutRequest();
-  virtual ~PutRequest();
-
-  PutRequest(const PutRequest& from);
+  inline TimeoutNowRequest() : TimeoutNowRequest(nullptr) {}
+  ~TimeoutNowRequest() override;
+  explicit PROTOBUF_CONSTEXPR TimeoutNowRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TimeoutNowRequest(const TimeoutNowRequest& from);
+  TimeoutNowRequest(TimeoutNowRequest&& from) noexcept
+    : TimeoutNowRequest() {
+    *this = ::std::move(from);
+  }
 
-  inline PutRequest& operator=(const PutRequest& from) {
+  inline TimeoutNowRequest& operator=(const TimeoutNowRequest& from) {
     CopyFrom(from);
     return *this;
   }
+  inline TimeoutNowRequest& operator=(TimeoutNowRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const PutRequest& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TimeoutNowRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TimeoutNowRequest* internal_default_instance() {
+    return reinterpret_cast<const TimeoutNowRequest*>(
+               &_TimeoutNowRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
 
-  void Swap(PutRequest* other);
+  friend void swap(TimeoutNowRequest& a, TimeoutNowRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TimeoutNowRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TimeoutNowRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline PutRequest* New() const { return New(NULL); }
+  TimeoutNowRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TimeoutNowRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TimeoutNowRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TimeoutNowRequest& from) {
+    TimeoutNowRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
 
-  PutRequest* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const PutRequest& from);
-  void MergeFrom(const PutRequest& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
-  void InternalSwap(PutRequest* other);
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TimeoutNowRequest* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mpr.chubby.TimeoutNowRequest";
   }
+  protected:
+  explicit TimeoutNowRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // optional string key = 1;
-  void clear_key();
-  static const int kKeyFieldNumber = 1;
-  const ::std::string& key() const;
-  void set_key(const ::std::string& value);
-  void set_key(const char* value);
-  void set_key(const char* value, size_t size);
-  ::std::string* mutable_key();
-  ::std::string* release_key();
-  void set_allocated_key(::std::string* key);
-
-  // optional bytes value = 2;
-  void clear_value();
-  static const int kValueFieldNumber = 2;
-  const ::std::string& value() const;
-  void set_value(const ::std::string& value);
-  void set_value(const char* value);
-  void set_value(const void* value, size_t size);
-  ::std::string* mutable_value();
-  ::std::string* release_value();
-  void set_allocated_value(::std::string* value);
-
-  // optional string uuid = 3;
-  void clear_uuid();
-  static const int kUuidFieldNumber = 3;
-  const ::std::string& uuid() const;
-  void set_uuid(const ::std::string& value);
-  void set_uuid(const char* value);
-  void set_uuid(const char* value, size_t size);
-  ::std::string* mutable_uuid();
-  ::std::string* release_uuid();
-  void set_allocated_uuid(::std::string* uuid);
+  enum : int {
+    kLeaderIdFieldNumber = 3,
+    kTermFieldNumber = 2,
+    kGroupIdFieldNumber = 1,
+  };
+  // string leader_id = 3;
+  void clear_leader_id();
+  const std::string& leader_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_leader_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_leader_id();
+  PROTOBUF_NODISCARD std::string* release_leader_id();
+  void set_allocated_leader_id(std::string* leader_id);
+  private:
+  const std::string& _internal_leader_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_leader_id(const std::string& value);
+  std::string* _internal_mutable_leader_id();
+  public:
 
-  // @@protoc_insertion_point(class_scope:mpr.chubby.PutRequest)
- private:
+  // int64 term = 2;
+  void clear_term();
+  int64_t term() const;
+  void set_term(int64_t value);
+  private:
+  int64_t _internal_term() const;
+  void _internal_set_term(int64_t value);
+  public:
+
+  // int32 group_id = 1;
+  void clear_group_id();
+  int32_t group_id() const;
+  void set_group_id(int32_t value);
+  private:
+  int32_t _internal_group_id() const;
+  void _internal_set_group_id(int32_t value);
+  public:
 
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  bool _is_default_instance_;
-  ::google::protobuf::internal::ArenaStringPtr key_;
-  ::google::protobuf::internal::ArenaStringPtr value_;
-  ::google::protobuf::internal::ArenaStringPtr uuid_;
-  mutable int _cached_size_;
-  friend void  protobuf_AddDesc_service_2eproto();
-  friend void protobuf_AssignDesc_service_2eproto();
-  friend void protobuf_ShutdownFile_service_2eproto();
-
-  void InitAsDefaultInstance();
-  static PutRequest* default_instance_;
+  // @@protoc_insertion_point(class_scope:mpr.chubby.TimeoutNowRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr leader_id_;
+    int64_t term_;
+    int32_t group_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_service_2eproto;
 };
 // -------------------------------------------------------------------
 
-class PutResponse : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:mpr.chubby.PutResponse) */ {
+class TimeoutNowResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mpr.chubby.TimeoutNowResponse) */ {
  public:
-  PutResponse();
-  virtual ~PutResponse();
-
-  PutResponse(const PutResponse& from);
+  inline TimeoutNowResponse() : TimeoutNowResponse(nullptr) {}
+  ~TimeoutNowResponse() override;
+  explicit PROTOBUF_CONSTEXPR TimeoutNowResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TimeoutNowResponse(const TimeoutNowResponse& from);
+  TimeoutNowResponse(TimeoutNowResponse&& from) noexcept
+    : TimeoutNowResponse() {
+    *this = ::std::move(from);
+  }
 
-  inline PutResponse& operator=(const PutResponse& from) {
+  inline TimeoutNowResponse& operator=(const TimeoutNowResponse& from) {
     CopyFrom(from);
     return *this;
   }
+  inline TimeoutNowResponse& operator=(TimeoutNowResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const PutResponse& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TimeoutNowResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TimeoutNowResponse* internal_default_instance() {
+    return reinterpret_cast<const TimeoutNowResponse*>(
+               &_TimeoutNowResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
 
-  void Swap(PutResponse* other);
+  friend void swap(TimeoutNowResponse& a, TimeoutNowResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TimeoutNowResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TimeoutNowResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline PutResponse* New() const { return New(NULL); }
+  TimeoutNowResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TimeoutNowResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TimeoutNowResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TimeoutNowResponse& from) {
+    TimeoutNowResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
 
-  PutResponse* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const PutResponse& from);
-  void MergeFrom(const PutResponse& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
-  void InternalSwap(PutResponse* other);
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TimeoutNowResponse* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mpr.chubby.TimeoutNowResponse";
   }
+  protected:
+  explicit TimeoutNowResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // optional bool success = 1;
+  enum : int {
+    kTermFieldNumber = 1,
+    kSuccessFieldNumber = 2,
+  };
+  // int64 term = 1;
+  void clear_term();
+  int64_t term() const;
+  void set_term(int64_t value);
+  private:
+  int64_t _internal_term() const;
+  void _internal_set_term(int64_t value);
+  public:
+
+  // bool success = 2;
   void clear_success();
-  static const int kSuccessFieldNumber = 1;
   bool success() const;
   void set_success(bool value);
+  private:
+  bool _internal_success() const;
+  void _internal_set_success(bool value);
+  public:
 
-  // optional string leader_id = 2;
-  void clear_leader_id();
-  static const int kLeaderIdFieldNumber = 2;
-  const ::std::string& leader_id() const;
-  void set_leader_id(const ::std::string& value);
-  void set_leader_id(const char* value);
-  void set_leader_id(const char* value, size_t size);
-  ::std::string* mutable_leader_id();
-  ::std::string* release_leader_id();
-  void set_allocated_leader_id(::std::string* leader_id);
-
-  // optional bool uuid_expired = 3;
-  void clear_uuid_expired();
-  static const int kUuidExpiredFieldNumber = 3;
-  bool uuid_expired() const;
-  void set_uuid_expired(bool value);
-
-  // @@protoc_insertion_point(class_scope:mpr.chubby.PutResponse)
+  // @@protoc_insertion_point(class_scope:mpr.chubby.TimeoutNowResponse)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  bool _is_default_instance_;
-  ::google::protobuf::internal::ArenaStringPtr leader_id_;
-  bool success_;
-  bool uuid_expired_;
-  mutable int _cached_size_;
-  friend void  protobuf_AddDesc_service_2eproto();
-  friend void protobuf_AssignDesc_service_2eproto();
-  friend void protobuf_ShutdownFile_service_2eproto();
-
-  void InitAsDefaultInstance();
-  static PutResponse* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int64_t term_;
+    bool success_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_service_2eproto;
 };
 // -------------------------------------------------------------------
 
-class GetRequest : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:mpr.chubby.GetRequest) */ {
+class TransferLeadershipRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mpr.chubby.TransferLeadershipRequest) */ {
  public:
-  GetRequest();
-  virtual ~GetRequest();
-
-  GetRequest(const GetRequest& from);
+  inline TransferLeadershipRequest() : TransferLeadershipRequest(nullptr) {}
+  ~TransferLeadershipRequest() override;
+  explicit PROTOBUF_CONSTEXPR TransferLeadershipRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TransferLeadershipRequest(const TransferLeadershipRequest& from);
+  TransferLeadershipRequest(TransferLeadershipRequest&& from) noexcept
+    : TransferLeadershipRequest() {
+    *this = ::std::move(from);
+  }
 
-  inline GetRequest& operator=(const GetRequest& from) {
+  inline TransferLeadershipRequest& operator=(const TransferLeadershipRequest& from) {
     CopyFrom(from);
     return *this;
   }
+  inline TransferLeadershipRequest& operator=(TransferLeadershipRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const GetRequest& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TransferLeadershipRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TransferLeadershipRequest* internal_default_instance() {
+    return reinterpret_cast<const TransferLeadershipRequest*>(
+               &_TransferLeadershipRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    9;
 
-  void Swap(GetRequest* other);
+  friend void swap(TransferLeadershipRequest& a, TransferLeadershipRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TransferLeadershipRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TransferLeadershipRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline GetRequest* New() const { return New(NULL); }
+  TransferLeadershipRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TransferLeadershipRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TransferLeadershipRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TransferLeadershipRequest& from) {
+    TransferLeadershipRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-  GetRequest* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const GetRequest& from);
-  void MergeFrom(const GetRequest& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
-  void InternalSwap(GetRequest* other);
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TransferLeadershipRequest* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mpr.chubby.TransferLeadershipRequest";
   }
+  protected:
+  explicit TransferLeadershipRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // optional string key = 1;
-  void clear_key();
-  static const int kKeyFieldNumber = 1;
-  const ::std::string& key() const;
-  void set_key(const ::std::string& value);
-  void set_key(const char* value);
-  void set_key(const char* value, size_t size);
-  ::std::string* mutable_key();
-  ::std::string* release_key();
-  void set_allocated_key(::std::string* key);
-
-  // optional string uuid = 2;
-  void clear_uuid();
-  static const int kUuidFieldNumber = 2;
-  const ::std::string& uuid() const;
-  void set_uuid(const ::std::string& value);
-  void set_uuid(const char* value);
-  void set_uuid(const char* value, size_t size);
-  ::std::string* mutable_uuid();
-  ::std::string* release_uuid();
-  void set_allocated_uuid(::std::string* uuid);
+  enum : int {
+    kTargetIdFieldNumber = 2,
+    kGroupIdFieldNumber = 1,
+  };
+  // string target_id = 2;
+  void clear_target_id();
+  const std::string& target_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_target_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_target_id();
+  PROTOBUF_NODISCARD std::string* release_target_id();
+  void set_allocated_target_id(std::string* target_id);
+  private:
+  const std::string& _internal_target_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_target_id(const std::string& value);
+  std::string* _internal_mutable_target_id();
+  public:
 
-  // @@protoc_insertion_point(class_scope:mpr.chubby.GetRequest)
- private:
+  // int32 group_id = 1;
+  void clear_group_id();
+  int32_t group_id() const;
+  void set_group_id(int32_t value);
+  private:
+  int32_t _internal_group_id() const;
+  void _internal_set_group_id(int32_t value);
+  public:
 
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  bool _is_default_instance_;
-  ::google::protobuf::internal::ArenaStringPtr key_;
-  ::google::protobuf::internal::ArenaStringPtr uuid_;
-  mutable int _cached_size_;
-  friend void  protobuf_AddDesc_service_2eproto();
-  friend void protobuf_AssignDesc_service_2eproto();
-  friend void protobuf_ShutdownFile_service_2eproto();
-
-  void InitAsDefaultInstance();
-  static GetRequest* default_instance_;
+  // @@protoc_insertion_point(class_scope:mpr.chubby.TransferLeadershipRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr target_id_;
+    int32_t group_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_service_2eproto;
 };
 // -------------------------------------------------------------------
 
-class GetResponse : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:mpr.chubby.GetResponse) */ {
+class TransferLeadershipResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mpr.chubby.TransferLeadershipResponse) */ {
  public:
-  GetResponse();
-  virtual ~GetResponse();
-
-  GetResponse(const GetResponse& from);
+  inline TransferLeadershipResponse() : TransferLeadershipResponse(nullptr) {}
+  ~TransferLeadershipResponse() override;
+  explicit PROTOBUF_CONSTEXPR TransferLeadershipResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TransferLeadershipResponse(const TransferLeadershipResponse& from);
+  TransferLeadershipResponse(TransferLeadershipResponse&& from) noexcept
+    : TransferLeadershipResponse() {
+    *this = ::std::move(from);
+  }
 
-  inline GetResponse& operator=(const GetResponse& from) {
+  inline TransferLeadershipResponse& operator=(const TransferLeadershipResponse& from) {
     CopyFrom(from);
     return *this;
   }
+  inline TransferLeadershipResponse& operator=(TransferLeadershipResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const GetResponse& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TransferLeadershipResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TransferLeadershipResponse* internal_default_instance() {
+    return reinterpret_cast<const TransferLeadershipResponse*>(
+               &_TransferLeadershipResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    10;
 
-  void Swap(GetResponse* other);
+  friend void swap(TransferLeadershipResponse& a, TransferLeadershipResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TransferLeadershipResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TransferLeadershipResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline GetResponse* New() const { return New(NULL); }
+  TransferLeadershipResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TransferLeadershipResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TransferLeadershipResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TransferLeadershipResponse& from) {
+    TransferLeadershipResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
 
-  GetResponse* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const GetResponse& from);
-  void MergeFrom(const GetResponse& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
-  void InternalSwap(GetResponse* other);
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TransferLeadershipResponse* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mpr.chubby.TransferLeadershipResponse";
   }
+  protected:
+  explicit TransferLeadershipResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // optional bool hit = 1;
-  void clear_hit();
-  static const int kHitFieldNumber = 1;
-  bool hit() const;
-  void set_hit(bool value);
-
-  // optional bytes value = 2;
-  void clear_value();
-  static const int kValueFieldNumber = 2;
-  const ::std::string& value() const;
-  void set_value(const ::std::string& value);
-  void set_value(const char* value);
-  void set_value(const void* value, size_t size);
-  ::std::string* mutable_value();
-  ::std::string* release_value();
-  void set_allocated_value(::std::string* value);
-
-  // optional string leader_id = 3;
+  enum : int {
+    kLeaderIdFieldNumber = 2,
+    kMessageFieldNumber = 3,
+    kSuccessFieldNumber = 1,
+  };
+  // string leader_id = 2;
   void clear_leader_id();
-  static const int kLeaderIdFieldNumber = 3;
-  const ::std::string& leader_id() const;
-  void set_leader_id(const ::std::string& value);
-  void set_leader_id(const char* value);
-  void set_leader_id(const char* value, size_t size);
-  ::std::string* mutable_leader_id();
-  ::std::string* release_leader_id();
-  void set_allocated_leader_id(::std::string* leader_id);
-
-  // optional bool success = 4;
+  const std::string& leader_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_leader_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_leader_id();
+  PROTOBUF_NODISCARD std::string* release_leader_id();
+  void set_allocated_leader_id(std::string* leader_id);
+  private:
+  const std::string& _internal_leader_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_leader_id(const std::string& value);
+  std::string* _internal_mutable_leader_id();
+  public:
+
+  // string message = 3;
+  void clear_message();
+  const std::string& message() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_message(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_message();
+  PROTOBUF_NODISCARD std::string* release_message();
+  void set_allocated_message(std::string* message);
+  private:
+  const std::string& _internal_message() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_message(const std::string& value);
+  std::string* _internal_mutable_message();
+  public:
+
+  // bool success = 1;
   void clear_success();
-  static const int kSuccessFieldNumber = 4;
   bool success() const;
   void set_success(bool value);
+  private:
+  bool _internal_success() const;
+  void _internal_set_success(bool value);
+  public:
 
-  // optional bool uuid_expired = 5;
-  void clear_uuid_expired();
-  static const int kUuidExpiredFieldNumber = 5;
-  bool uuid_expired() const;
-  void set_uuid_expired(bool value);
-
-  // @@protoc_insertion_point(class_scope:mpr.chubby.GetResponse)
+  // @@protoc_insertion_point(class_scope:mpr.chubby.TransferLeadershipResponse)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  bool _is_default_instance_;
-  ::google::protobuf::internal::ArenaStringPtr value_;
-  ::google::protobuf::internal::ArenaStringPtr leader_id_;
-  bool hit_;
-  bool success_;
-  bool uuid_expired_;
-  mutable int _cached_size_;
-  friend void  protobuf_AddDesc_service_2eproto();
-  friend void protobuf_AssignDesc_service_2eproto();
-  friend void protobuf_ShutdownFile_service_2eproto();
-
-  void InitAsDefaultInstance();
-  static GetResponse* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr leader_id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr message_;
+    bool success_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_service_2eproto;
 };
 // -------------------------------------------------------------------
 
-class DelRequest : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:mpr.chubby.DelRequest) */ {
+class PutRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mpr.chubby.PutRequest) */ {
  public:
-  DelRequest();
-  virtual ~DelRequest();
+  inline PutRequest() : PutRequest(nullptr) {}
+  ~PutRequest() override;
+  explicit PROTOBUF_CONSTEXPR PutRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  DelRequest(const DelRequest& from);
+  PutRequest(const PutRequest& from);
+  PutRequest(PutRequest&& from) noexcept
+    : PutRequest() {
+    *this = ::std::move(from);
+  }
 
-  inline DelRequest& operator=(const DelRequest& from) {
+  inline PutRequest& operator=(const PutRequest& from) {
     CopyFrom(from);
     return *this;
   }
+  inline PutRequest& operator=(PutRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const DelRequest& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PutRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PutRequest* internal_default_instance() {
+    return reinterpret_cast<const PutRequest*>(
+               &_PutRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    11;
 
-  void Swap(DelRequest* other);
+  friend void swap(PutRequest& a, PutRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PutRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PutRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline DelRequest* New() const { return New(NULL); }
+  PutRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PutRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PutRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PutRequest& from) {
+    PutRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-  DelRequest* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const DelRequest& from);
-  void MergeFrom(const DelRequest& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
-  void InternalSwap(DelRequest* other);
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PutRequest* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mpr.chubby.PutRequest";
   }
+  protected:
+  explicit PutRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // optional string key = 1;
+  enum : int {
+    kKeyFieldNumber = 1,
+    kValueFieldNumber = 2,
+    kUuidFieldNumber = 3,
+    kSessionIdFieldNumber = 4,
+    kRequestIdFieldNumber = 5,
+  };
+  // string key = 1;
   void clear_key();
-  static const int kKeyFieldNumber = 1;
-  const ::std::string& key() const;
-  void set_key(const ::std::string& value);
-  void set_key(const char* value);
-  void set_key(const char* value, size_t size);
-  ::std::string* mutable_key();
-  ::std::string* release_key();
-  void set_allocated_key(::std::string* key);
-
-  // optional string uuid = 2;
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
+
+  // bytes value = 2;
+  void clear_value();
+  const std::string& value() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_value();
+  PROTOBUF_NODISCARD std::string* release_value();
+  void set_allocated_value(std::string* value);
+  private:
+  const std::string& _internal_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
+  std::string* _internal_mutable_value();
+  public:
+
+  // string uuid = 3;
   void clear_uuid();
-  static const int kUuidFieldNumber = 2;
-  const ::std::string& uuid() const;
-  void set_uuid(const ::std::string& value);
-  void set_uuid(const char* value);
-  void set_uuid(const char* value, size_t size);
-  ::std::string* mutable_uuid();
-  ::std::string* release_uuid();
-  void set_allocated_uuid(::std::string* uuid);
+  const std::string& uuid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_uuid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_uuid();
+  PROTOBUF_NODISCARD std::string* release_uuid();
+  void set_allocated_uuid(std::string* uuid);
+  private:
+  const std::string& _internal_uuid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_uuid(const std::string& value);
+  std::string* _internal_mutable_uuid();
+  public:
 
-  // @@protoc_insertion_point(class_scope:mpr.chubby.DelRequest)
- private:
+  // string session_id = 4;
+  void clear_session_id();
+  const std::string& session_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_session_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_session_id();
+  PROTOBUF_NODISCARD std::string* release_session_id();
+  void set_allocated_session_id(std::string* session_id);
+  private:
+  const std::string& _internal_session_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_session_id(const std::string& value);
+  std::string* _internal_mutable_session_id();
+  public:
+
+  // string request_id = 5;
+  void clear_request_id();
+  const std::string& request_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_request_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_request_id();
+  PROTOBUF_NODISCARD std::string* release_request_id();
+  void set_allocated_request_id(std::string* request_id);
+  private:
+  const std::string& _internal_request_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_request_id(const std::string& value);
+  std::string* _internal_mutable_request_id();
+  public:
 
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  bool _is_default_instance_;
-  ::google::protobuf::internal::ArenaStringPtr key_;
-  ::google::protobuf::internal::ArenaStringPtr uuid_;
-  mutable int _cached_size_;
-  friend void  protobuf_AddDesc_service_2eproto();
-  friend void protobuf_AssignDesc_service_2eproto();
-  friend void protobuf_ShutdownFile_service_2eproto();
-
-  void InitAsDefaultInstance();
-  static DelRequest* default_instance_;
+  // @@protoc_insertion_point(class_scope:mpr.chubby.PutRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr uuid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr session_id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr request_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_service_2eproto;
 };
 // -------------------------------------------------------------------
 
-class DelResponse : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:mpr.chubby.DelResponse) */ {
+class PutResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mpr.chubby.PutResponse) */ {
  public:
-  DelResponse();
-  virtual ~DelResponse();
+  inline PutResponse() : PutResponse(nullptr) {}
+  ~PutResponse() override;
+  explicit PROTOBUF_CONSTEXPR PutResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  DelResponse(const DelResponse& from);
+  PutResponse(const PutResponse& from);
+  PutResponse(PutResponse&& from) noexcept
+    : PutResponse() {
+    *this = ::std::move(from);
+  }
 
-  inline DelResponse& operator=(const DelResponse& from) {
+  inline PutResponse& operator=(const PutResponse& from) {
     CopyFrom(from);
     return *this;
   }
+  inline PutResponse& operator=(PutResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const DelResponse& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PutResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PutResponse* internal_default_instance() {
+    return reinterpret_cast<const PutResponse*>(
+               &_PutResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    12;
 
-  void Swap(DelResponse* other);
+  friend void swap(PutResponse& a, PutResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PutResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PutResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline DelResponse* New() const { return New(NULL); }
-
-  DelResponse* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const DelResponse& from);
-  void MergeFrom(const DelResponse& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
-  void InternalSwap(DelResponse* other);
-  private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
+  PutResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PutResponse>(arena);
   }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PutResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PutResponse& from) {
+    PutResponse::MergeImpl(*this, from);
   }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-  // nested types ----------------------------------------------------
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PutResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mpr.chubby.PutResponse";
+  }
+  protected:
+  explicit PutResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // optional bool success = 1;
+  enum : int {
+    kLeaderIdFieldNumber = 2,
+    kSuccessFieldNumber = 1,
+    kUuidExpiredFieldNumber = 3,
+  };
+  // string leader_id = 2;
+  void clear_leader_id();
+  const std::string& leader_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_leader_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_leader_id();
+  PROTOBUF_NODISCARD std::string* release_leader_id();
+  void set_allocated_leader_id(std::string* leader_id);
+  private:
+  const std::string& _internal_leader_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_leader_id(const std::string& value);
+  std::string* _internal_mutable_leader_id();
+  public:
+
+  // bool success = 1;
   void clear_success();
-  static const int kSuccessFieldNumber = 1;
   bool success() const;
   void set_success(bool value);
+  private:
+  bool _internal_success() const;
+  void _internal_set_success(bool value);
+  public:
 
-  // optional string leader_id = 2;
-  void clear_leader_id();
-  static const int kLeaderIdFieldNumber = 2;
-  const ::std::string& leader_id() const;
-  void set_leader_id(const ::std::string& value);
-  void set_leader_id(const char* value);
-  void set_leader_id(const char* value, size_t size);
-  ::std::string* mutable_leader_id();
-  ::std::string* release_leader_id();
-  void set_allocated_leader_id(::std::string* leader_id);
-
-  // optional bool uuid_expired = 3;
+  // bool uuid_expired = 3;
   void clear_uuid_expired();
-  static const int kUuidExpiredFieldNumber = 3;
   bool uuid_expired() const;
   void set_uuid_expired(bool value);
+  private:
+  bool _internal_uuid_expired() const;
+  void _internal_set_uuid_expired(bool value);
+  public:
 
-  // @@protoc_insertion_point(class_scope:mpr.chubby.DelResponse)
+  // @@protoc_insertion_point(class_scope:mpr.chubby.PutResponse)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  bool _is_default_instance_;
-  ::google::protobuf::internal::ArenaStringPtr leader_id_;
-  bool success_;
-  bool uuid_expired_;
-  mutable int _cached_size_;
-  friend void  protobuf_AddDesc_service_2eproto();
-  friend void protobuf_AssignDesc_service_2eproto();
-  friend void protobuf_ShutdownFile_service_2eproto();
-
-  void InitAsDefaultInstance();
-  static DelResponse* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr leader_id_;
+    bool success_;
+    bool uuid_expired_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_service_2eproto;
 };
 // -------------------------------------------------------------------
 
-class UnLockRequest : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:mpr.chubby.UnLockRequest) */ {
+class StaleRead final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mpr.chubby.StaleRead) */ {
  public:
-  UnLockRequest();
-  virtual ~UnLockRequest();
-
-  UnLockRequest(const UnLockRequest& from);
+  inline StaleRead() : StaleRead(nullptr) {}
+  ~StaleRead() override;
+  explicit PROTOBUF_CONSTEXPR StaleRead(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  StaleRead(const StaleRead& from);
+  StaleRead(StaleRead&& from) noexcept
+    : StaleRead() {
+    *this = ::std::move(from);
+  }
 
-  inline UnLockRequest& operator=(const UnLockRequest& from) {
+  inline StaleRead& operator=(const StaleRead& from) {
     CopyFrom(from);
     return *this;
   }
+  inline StaleRead& operator=(StaleRead&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const UnLockRequest& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const StaleRead& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const StaleRead* internal_default_instance() {
+    return reinterpret_cast<const StaleRead*>(
+               &_StaleRead_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    13;
 
-  void Swap(UnLockRequest* other);
+  friend void swap(StaleRead& a, StaleRead& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(StaleRead* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(StaleRead* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline UnLockRequest* New() const { return New(NULL); }
+  StaleRead* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<StaleRead>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const StaleRead& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const StaleRead& from) {
+    StaleRead::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-  UnLockRequest* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const UnLockRequest& from);
-  void MergeFrom(const UnLockRequest& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
-  void InternalSwap(UnLockRequest* other);
+  void SetCachedSize(int size) const final;
+  void InternalSwap(StaleRead* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mpr.chubby.StaleRead";
   }
+  protected:
+  explicit StaleRead(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // optional string key = 1;
-  void clear_key();
-  static const int kKeyFieldNumber = 1;
-  const ::std::string& key() const;
-  void set_key(const ::std::string& value);
-  void set_key(const char* value);
-  void set_key(const char* value, size_t size);
-  ::std::string* mutable_key();
-  ::std::string* release_key();
-  void set_allocated_key(::std::string* key);
-
-  // optional string session_id = 2;
-  void clear_session_id();
-  static const int kSessionIdFieldNumber = 2;
-  const ::std::string& session_id() const;
-  void set_session_id(const ::std::string& value);
-  void set_session_id(const char* value);
-  void set_session_id(const char* value, size_t size);
-  ::std::string* mutable_session_id();
-  ::std::string* release_session_id();
-  void set_allocated_session_id(::std::string* session_id);
-
-  // optional string uuid = 3;
-  void clear_uuid();
-  static const int kUuidFieldNumber = 3;
-  const ::std::string& uuid() const;
-  void set_uuid(const ::std::string& value);
-  void set_uuid(const char* value);
-  void set_uuid(const char* value, size_t size);
-  ::std::string* mutable_uuid();
-  ::std::string* release_uuid();
-  void set_allocated_uuid(::std::string* uuid);
+  enum : int {
+    kMaxLagEntriesFieldNumber = 1,
+    kMinAppliedIndexFieldNumber = 3,
+    kMaxLagMsFieldNumber = 2,
+  };
+  // int64 max_lag_entries = 1;
+  void clear_max_lag_entries();
+  int64_t max_lag_entries() const;
+  void set_max_lag_entries(int64_t value);
+  private:
+  int64_t _internal_max_lag_entries() const;
+  void _internal_set_max_lag_entries(int64_t value);
+  public:
 
-  // @@protoc_insertion_point(class_scope:mpr.chubby.UnLockRequest)
- private:
+  // int64 min_applied_index = 3;
+  void clear_min_applied_index();
+  int64_t min_applied_index() const;
+  void set_min_applied_index(int64_t value);
+  private:
+  int64_t _internal_min_applied_index() const;
+  void _internal_set_min_applied_index(int64_t value);
+  public:
+
+  // int32 max_lag_ms = 2;
+  void clear_max_lag_ms();
+  int32_t max_lag_ms() const;
+  void set_max_lag_ms(int32_t value);
+  private:
+  int32_t _internal_max_lag_ms() const;
+  void _internal_set_max_lag_ms(int32_t value);
+  public:
 
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  bool _is_default_instance_;
-  ::google::protobuf::internal::ArenaStringPtr key_;
-  ::google::protobuf::internal::ArenaStringPtr session_id_;
-  ::google::protobuf::internal::ArenaStringPtr uuid_;
-  mutable int _cached_size_;
-  friend void  protobuf_AddDesc_service_2eproto();
-  friend void protobuf_AssignDesc_service_2eproto();
-  friend void protobuf_ShutdownFile_service_2eproto();
-
-  void InitAsDefaultInstance();
-  static UnLockRequest* default_instance_;
+  // @@protoc_insertion_point(class_scope:mpr.chubby.StaleRead)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int64_t max_lag_entries_;
+    int64_t min_applied_index_;
+    int32_t max_lag_ms_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_service_2eproto;
 };
 // -------------------------------------------------------------------
 
-class UnLockResponse : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:mpr.chubby.UnLockResponse) */ {
+class GetRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mpr.chubby.GetRequest) */ {
  public:
-  UnLockResponse();
-  virtual ~UnLockResponse();
+  inline GetRequest() : GetRequest(nullptr) {}
+  ~GetRequest() override;
+  explicit PROTOBUF_CONSTEXPR GetRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  UnLockResponse(const UnLockResponse& from);
+  GetRequest(const GetRequest& from);
+  GetRequest(GetRequest&& from) noexcept
+    : GetRequest() {
+    *this = ::std::move(from);
+  }
 
-  inline UnLockResponse& operator=(const UnLockResponse& from) {
+  inline GetRequest& operator=(const GetRequest& from) {
     CopyFrom(from);
     return *this;
   }
+  inline GetRequest& operator=(GetRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const UnLockResponse& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GetRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GetRequest* internal_default_instance() {
+    return reinterpret_cast<const GetRequest*>(
+               &_GetRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    14;
 
-  void Swap(UnLockResponse* other);
+  friend void swap(GetRequest& a, GetRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GetRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GetRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline UnLockResponse* New() const { return New(NULL); }
+  GetRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GetRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const GetRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GetRequest& from) {
+    GetRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-  UnLockResponse* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const UnLockResponse& from);
-  void MergeFrom(const UnLockResponse& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
-  void InternalSwap(UnLockResponse* other);
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GetRequest* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mpr.chubby.GetRequest";
   }
+  protected:
+  explicit GetRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // optional bool success = 1;
-  void clear_success();
-  static const int kSuccessFieldNumber = 1;
-  bool success() const;
-  void set_success(bool value);
+  enum : int {
+    kKeyFieldNumber = 1,
+    kUuidFieldNumber = 2,
+    kSessionIdFieldNumber = 4,
+    kStaleReadFieldNumber = 3,
+  };
+  // string key = 1;
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
 
-  // optional string leader_id = 2;
-  void clear_leader_id();
-  static const int kLeaderIdFieldNumber = 2;
-  const ::std::string& leader_id() const;
-  void set_leader_id(const ::std::string& value);
-  void set_leader_id(const char* value);
-  void set_leader_id(const char* value, size_t size);
-  ::std::string* mutable_leader_id();
-  ::std::string* release_leader_id();
-  void set_allocated_leader_id(::std::string* leader_id);
-
-  // optional bool uuid_expired = 3;
-  void clear_uuid_expired();
-  static const int kUuidExpiredFieldNumber = 3;
-  bool uuid_expired() const;
-  void set_uuid_expired(bool value);
+  // string uuid = 2;
+  void clear_uuid();
+  const std::string& uuid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_uuid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_uuid();
+  PROTOBUF_NODISCARD std::string* release_uuid();
+  void set_allocated_uuid(std::string* uuid);
+  private:
+  const std::string& _internal_uuid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_uuid(const std::string& value);
+  std::string* _internal_mutable_uuid();
+  public:
 
-  // @@protoc_insertion_point(class_scope:mpr.chubby.UnLockResponse)
- private:
+  // string session_id = 4;
+  void clear_session_id();
+  const std::string& session_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_session_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_session_id();
+  PROTOBUF_NODISCARD std::string* release_session_id();
+  void set_allocated_session_id(std::string* session_id);
+  private:
+  const std::string& _internal_session_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_session_id(const std::string& value);
+  std::string* _internal_mutable_session_id();
+  public:
 
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  bool _is_default_instance_;
-  ::google::protobuf::internal::ArenaStringPtr leader_id_;
-  bool success_;
-  bool uuid_expired_;
-  mutable int _cached_size_;
-  friend void  protobuf_AddDesc_service_2eproto();
-  friend void protobuf_AssignDesc_service_2eproto();
-  friend void protobuf_ShutdownFile_service_2eproto();
-
-  void InitAsDefaultInstance();
-  static UnLockResponse* default_instance_;
+  // .mpr.chubby.StaleRead stale_read = 3;
+  bool has_stale_read() const;
+  private:
+  bool _internal_has_stale_read() const;
+  public:
+  void clear_stale_read();
+  const ::mpr::chubby::StaleRead& stale_read() const;
+  PROTOBUF_NODISCARD ::mpr::chubby::StaleRead* release_stale_read();
+  ::mpr::chubby::StaleRead* mutable_stale_read();
+  void set_allocated_stale_read(::mpr::chubby::StaleRead* stale_read);
+  private:
+  const ::mpr::chubby::StaleRead& _internal_stale_read() const;
+  ::mpr::chubby::StaleRead* _internal_mutable_stale_read();
+  public:
+  void unsafe_arena_set_allocated_stale_read(
+      ::mpr::chubby::StaleRead* stale_read);
+  ::mpr::chubby::StaleRead* unsafe_arena_release_stale_read();
+
+  // @@protoc_insertion_point(class_scope:mpr.chubby.GetRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr uuid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr session_id_;
+    ::mpr::chubby::StaleRead* stale_read_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_service_2eproto;
 };
 // -------------------------------------------------------------------
 
-class ShowStatusRequest : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:mpr.chubby.ShowStatusRequest) */ {
+class GetResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mpr.chubby.GetResponse) */ {
  public:
-  ShowStatusRequest();
-  virtual ~ShowStatusRequest();
+  inline GetResponse() : GetResponse(nullptr) {}
+  ~GetResponse() override;
+  explicit PROTOBUF_CONSTEXPR GetResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  ShowStatusRequest(const ShowStatusRequest& from);
+  GetResponse(const GetResponse& from);
+  GetResponse(GetResponse&& from) noexcept
+    : GetResponse() {
+    *this = ::std::move(from);
+  }
 
-  inline ShowStatusRequest& operator=(const ShowStatusRequest& from) {
+  inline GetResponse& operator=(const GetResponse& from) {
     CopyFrom(from);
     return *this;
   }
+  inline GetResponse& operator=(GetResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const ShowStatusRequest& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GetResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GetResponse* internal_default_instance() {
+    return reinterpret_cast<const GetResponse*>(
+               &_GetResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    15;
 
-  void Swap(ShowStatusRequest* other);
+  friend void swap(GetResponse& a, GetResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GetResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GetResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline ShowStatusRequest* New() const { return New(NULL); }
-
-  ShowStatusRequest* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const ShowStatusRequest& from);
-  void MergeFrom(const ShowStatusRequest& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  GetResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GetResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const GetResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GetResponse& from) {
+    GetResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
-  void InternalSwap(ShowStatusRequest* other);
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GetResponse* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mpr.chubby.GetResponse";
   }
+  protected:
+  explicit GetResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // @@protoc_insertion_point(class_scope:mpr.chubby.ShowStatusRequest)
- private:
+  enum : int {
+    kValueFieldNumber = 2,
+    kLeaderIdFieldNumber = 3,
+    kLastAppliedFieldNumber = 6,
+    kCacheIncarnationFieldNumber = 8,
+    kHitFieldNumber = 1,
+    kSuccessFieldNumber = 4,
+    kUuidExpiredFieldNumber = 5,
+    kCacheableFieldNumber = 7,
+  };
+  // bytes value = 2;
+  void clear_value();
+  const std::string& value() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_value();
+  PROTOBUF_NODISCARD std::string* release_value();
+  void set_allocated_value(std::string* value);
+  private:
+  const std::string& _internal_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
+  std::string* _internal_mutable_value();
+  public:
+
+  // string leader_id = 3;
+  void clear_leader_id();
+  const std::string& leader_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_leader_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_leader_id();
+  PROTOBUF_NODISCARD std::string* release_leader_id();
+  void set_allocated_leader_id(std::string* leader_id);
+  private:
+  const std::string& _internal_leader_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_leader_id(const std::string& value);
+  std::string* _internal_mutable_leader_id();
+  public:
+
+  // int64 last_applied = 6;
+  void clear_last_applied();
+  int64_t last_applied() const;
+  void set_last_applied(int64_t value);
+  private:
+  int64_t _internal_last_applied() const;
+  void _internal_set_last_applied(int64_t value);
+  public:
+
+  // int64 cache_incarnation = 8;
+  void clear_cache_incarnation();
+  int64_t cache_incarnation() const;
+  void set_cache_incarnation(int64_t value);
+  private:
+  int64_t _internal_cache_incarnation() const;
+  void _internal_set_cache_incarnation(int64_t value);
+  public:
+
+  // bool hit = 1;
+  void clear_hit();
+  bool hit() const;
+  void set_hit(bool value);
+  private:
+  bool _internal_hit() const;
+  void _internal_set_hit(bool value);
+  public:
 
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  bool _is_default_instance_;
-  mutable int _cached_size_;
-  friend void  protobuf_AddDesc_service_2eproto();
-  friend void protobuf_AssignDesc_service_2eproto();
-  friend void protobuf_ShutdownFile_service_2eproto();
+  // bool success = 4;
+  void clear_success();
+  bool success() const;
+  void set_success(bool value);
+  private:
+  bool _internal_success() const;
+  void _internal_set_success(bool value);
+  public:
+
+  // bool uuid_expired = 5;
+  void clear_uuid_expired();
+  bool uuid_expired() const;
+  void set_uuid_expired(bool value);
+  private:
+  bool _internal_uuid_expired() const;
+  void _internal_set_uuid_expired(bool value);
+  public:
+
+  // bool cacheable = 7;
+  void clear_cacheable();
+  bool cacheable() const;
+  void set_cacheable(bool value);
+  private:
+  bool _internal_cacheable() const;
+  void _internal_set_cacheable(bool value);
+  public:
 
-  void InitAsDefaultInstance();
-  static ShowStatusRequest* default_instance_;
+  // @@protoc_insertion_point(class_scope:mpr.chubby.GetResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr leader_id_;
+    int64_t last_applied_;
+    int64_t cache_incarnation_;
+    bool hit_;
+    bool success_;
+    bool uuid_expired_;
+    bool cacheable_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_service_2eproto;
 };
 // -------------------------------------------------------------------
 
-class ShowStatusResponse : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:mpr.chubby.ShowStatusResponse) */ {
+class DelRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mpr.chubby.DelRequest) */ {
  public:
-  ShowStatusResponse();
-  virtual ~ShowStatusResponse();
+  inline DelRequest() : DelRequest(nullptr) {}
+  ~DelRequest() override;
+  explicit PROTOBUF_CONSTEXPR DelRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  ShowStatusResponse(const ShowStatusResponse& from);
+  DelRequest(const DelRequest& from);
+  DelRequest(DelRequest&& from) noexcept
+    : DelRequest() {
+    *this = ::std::move(from);
+  }
 
-  inline ShowStatusResponse& operator=(const ShowStatusResponse& from) {
+  inline DelRequest& operator=(const DelRequest& from) {
     CopyFrom(from);
     return *this;
   }
+  inline DelRequest& operator=(DelRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const ShowStatusResponse& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const DelRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const DelRequest* internal_default_instance() {
+    return reinterpret_cast<const DelRequest*>(
+               &_DelRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    16;
 
-  void Swap(ShowStatusResponse* other);
+  friend void swap(DelRequest& a, DelRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(DelRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(DelRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline ShowStatusResponse* New() const { return New(NULL); }
+  DelRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<DelRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const DelRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const DelRequest& from) {
+    DelRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-  ShowStatusResponse* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const ShowStatusResponse& from);
-  void MergeFrom(const ShowStatusResponse& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
-  void InternalSwap(ShowStatusResponse* other);
+  void SetCachedSize(int size) const final;
+  void InternalSwap(DelRequest* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mpr.chubby.DelRequest";
   }
+  protected:
+  explicit DelRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // optional .mpr.chubby.NodeStatus status = 1;
-  void clear_status();
-  static const int kStatusFieldNumber = 1;
-  ::mpr::chubby::NodeStatus status() const;
-  void set_status(::mpr::chubby::NodeStatus value);
-
-  // optional int64 term = 2;
-  void clear_term();
-  static const int kTermFieldNumber = 2;
-  ::google::protobuf::int64 term() const;
-  void set_term(::google::protobuf::int64 value);
-
-  // optional int64 last_log_index = 3;
-  void clear_last_log_index();
-  static const int kLastLogIndexFieldNumber = 3;
-  ::google::protobuf::int64 last_log_index() const;
-  void set_last_log_index(::google::protobuf::int64 value);
+  enum : int {
+    kKeyFieldNumber = 1,
+    kUuidFieldNumber = 2,
+    kSessionIdFieldNumber = 3,
+    kRequestIdFieldNumber = 4,
+  };
+  // string key = 1;
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
 
-  // optional int64 last_log_term = 4;
-  void clear_last_log_term();
-  static const int kLastLogTermFieldNumber = 4;
-  ::google::protobuf::int64 last_log_term() const;
-  void set_last_log_term(::google::protobuf::int64 value);
+  // string uuid = 2;
+  void clear_uuid();
+  const std::string& uuid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_uuid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_uuid();
+  PROTOBUF_NODISCARD std::string* release_uuid();
+  void set_allocated_uuid(std::string* uuid);
+  private:
+  const std::string& _internal_uuid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_uuid(const std::string& value);
+  std::string* _internal_mutable_uuid();
+  public:
 
-  // optional int64 commit_index = 5;
-  void clear_commit_index();
-  static const int kCommitIndexFieldNumber = 5;
-  ::google::protobuf::int64 commit_index() const;
-  void set_commit_index(::google::protobuf::int64 value);
+  // string session_id = 3;
+  void clear_session_id();
+  const std::string& session_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_session_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_session_id();
+  PROTOBUF_NODISCARD std::string* release_session_id();
+  void set_allocated_session_id(std::string* session_id);
+  private:
+  const std::string& _internal_session_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_session_id(const std::string& value);
+  std::string* _internal_mutable_session_id();
+  public:
 
-  // optional int64 last_applied = 6;
-  void clear_last_applied();
-  static const int kLastAppliedFieldNumber = 6;
-  ::google::protobuf::int64 last_applied() const;
-  void set_last_applied(::google::protobuf::int64 value);
+  // string request_id = 4;
+  void clear_request_id();
+  const std::string& request_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_request_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_request_id();
+  PROTOBUF_NODISCARD std::string* release_request_id();
+  void set_allocated_request_id(std::string* request_id);
+  private:
+  const std::string& _internal_request_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_request_id(const std::string& value);
+  std::string* _internal_mutable_request_id();
+  public:
 
-  // @@protoc_insertion_point(class_scope:mpr.chubby.ShowStatusResponse)
+  // @@protoc_insertion_point(class_scope:mpr.chubby.DelRequest)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  bool _is_default_instance_;
-  ::google::protobuf::int64 term_;
-  ::google::protobuf::int64 last_log_index_;
-  ::google::protobuf::int64 last_log_term_;
-  ::google::protobuf::int64 commit_index_;
-  ::google::protobuf::int64 last_applied_;
-  int status_;
-  mutable int _cached_size_;
-  friend void  protobuf_AddDesc_service_2eproto();
-  friend void protobuf_AssignDesc_service_2eproto();
-  friend void protobuf_ShutdownFile_service_2eproto();
-
-  void InitAsDefaultInstance();
-  static ShowStatusResponse* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr uuid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr session_id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr request_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_service_2eproto;
 };
 // -------------------------------------------------------------------
 
-class ScanRequest : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:mpr.chubby.ScanRequest) */ {
+class DelResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mpr.chubby.DelResponse) */ {
  public:
-  ScanRequest();
-  virtual ~ScanRequest();
+  inline DelResponse() : DelResponse(nullptr) {}
+  ~DelResponse() override;
+  explicit PROTOBUF_CONSTEXPR DelResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  ScanRequest(const ScanRequest& from);
+  DelResponse(const DelResponse& from);
+  DelResponse(DelResponse&& from) noexcept
+    : DelResponse() {
+    *this = ::std::move(from);
+  }
 
-  inline ScanRequest& operator=(const ScanRequest& from) {
+  inline DelResponse& operator=(const DelResponse& from) {
     CopyFrom(from);
     return *this;
   }
+  inline DelResponse& operator=(DelResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const ScanRequest& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const DelResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const DelResponse* internal_default_instance() {
+    return reinterpret_cast<const DelResponse*>(
+               &_DelResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    17;
 
-  void Swap(ScanRequest* other);
+  friend void swap(DelResponse& a, DelResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(DelResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(DelResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline ScanRequest* New() const { return New(NULL); }
+  DelResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<DelResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const DelResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const DelResponse& from) {
+    DelResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-  ScanRequest* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const ScanRequest& from);
-  void MergeFrom(const ScanRequest& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
-  void InternalSwap(ScanRequest* other);
+  void SetCachedSize(int size) const final;
+  void InternalSwap(DelResponse* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mpr.chubby.DelResponse";
   }
+  protected:
+  explicit DelResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // optional string start_key = 1;
-  void clear_start_key();
-  static const int kStartKeyFieldNumber = 1;
-  const ::std::string& start_key() const;
-  void set_start_key(const ::std::string& value);
-  void set_start_key(const char* value);
-  void set_start_key(const char* value, size_t size);
-  ::std::string* mutable_start_key();
-  ::std::string* release_start_key();
-  void set_allocated_start_key(::std::string* start_key);
-
-  // optional bytes end_key = 2;
-  void clear_end_key();
-  static const int kEndKeyFieldNumber = 2;
-  const ::std::string& end_key() const;
-  void set_end_key(const ::std::string& value);
-  void set_end_key(const char* value);
-  void set_end_key(const void* value, size_t size);
-  ::std::string* mutable_end_key();
-  ::std::string* release_end_key();
-  void set_allocated_end_key(::std::string* end_key);
-
-  // optional int32 size_limit = 3;
-  void clear_size_limit();
-  static const int kSizeLimitFieldNumber = 3;
-  ::google::protobuf::int32 size_limit() const;
-  void set_size_limit(::google::protobuf::int32 value);
+  enum : int {
+    kLeaderIdFieldNumber = 2,
+    kSuccessFieldNumber = 1,
+    kUuidExpiredFieldNumber = 3,
+  };
+  // string leader_id = 2;
+  void clear_leader_id();
+  const std::string& leader_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_leader_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_leader_id();
+  PROTOBUF_NODISCARD std::string* release_leader_id();
+  void set_allocated_leader_id(std::string* leader_id);
+  private:
+  const std::string& _internal_leader_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_leader_id(const std::string& value);
+  std::string* _internal_mutable_leader_id();
+  public:
 
-  // optional string uuid = 4;
-  void clear_uuid();
-  static const int kUuidFieldNumber = 4;
-  const ::std::string& uuid() const;
-  void set_uuid(const ::std::string& value);
-  void set_uuid(const char* value);
-  void set_uuid(const char* value, size_t size);
-  ::std::string* mutable_uuid();
-  ::std::string* release_uuid();
-  void set_allocated_uuid(::std::string* uuid);
+  // bool success = 1;
+  void clear_success();
+  bool success() const;
+  void set_success(bool value);
+  private:
+  bool _internal_success() const;
+  void _internal_set_success(bool value);
+  public:
 
-  // @@protoc_insertion_point(class_scope:mpr.chubby.ScanRequest)
- private:
+  // bool uuid_expired = 3;
+  void clear_uuid_expired();
+  bool uuid_expired() const;
+  void set_uuid_expired(bool value);
+  private:
+  bool _internal_uuid_expired() const;
+  void _internal_set_uuid_expired(bool value);
+  public:
 
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  bool _is_default_instance_;
-  ::google::protobuf::internal::ArenaStringPtr start_key_;
-  ::google::protobuf::internal::ArenaStringPtr end_key_;
-  ::google::protobuf::internal::ArenaStringPtr uuid_;
-  ::google::protobuf::int32 size_limit_;
-  mutable int _cached_size_;
-  friend void  protobuf_AddDesc_service_2eproto();
-  friend void protobuf_AssignDesc_service_2eproto();
-  friend void protobuf_ShutdownFile_service_2eproto();
-
-  void InitAsDefaultInstance();
-  static ScanRequest* default_instance_;
+  // @@protoc_insertion_point(class_scope:mpr.chubby.DelResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr leader_id_;
+    bool success_;
+    bool uuid_expired_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_service_2eproto;
 };
 // -------------------------------------------------------------------
 
-class ScanItem : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:mpr.chubby.ScanItem) */ {
+class UnLockRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mpr.chubby.UnLockRequest) */ {
  public:
-  ScanItem();
-  virtual ~ScanItem();
+  inline UnLockRequest() : UnLockRequest(nullptr) {}
+  ~UnLockRequest() override;
+  explicit PROTOBUF_CONSTEXPR UnLockRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  ScanItem(const ScanItem& from);
+  UnLockRequest(const UnLockRequest& from);
+  UnLockRequest(UnLockRequest&& from) noexcept
+    : UnLockRequest() {
+    *this = ::std::move(from);
+  }
 
-  inline ScanItem& operator=(const ScanItem& from) {
+  inline UnLockRequest& operator=(const UnLockRequest& from) {
     CopyFrom(from);
     return *this;
   }
+  inline UnLockRequest& operator=(UnLockRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const ScanItem& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const UnLockRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const UnLockRequest* internal_default_instance() {
+    return reinterpret_cast<const UnLockRequest*>(
+               &_UnLockRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    18;
 
-  void Swap(ScanItem* other);
+  friend void swap(UnLockRequest& a, UnLockRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(UnLockRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(UnLockRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline ScanItem* New() const { return New(NULL); }
+  UnLockRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<UnLockRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const UnLockRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const UnLockRequest& from) {
+    UnLockRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-  ScanItem* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const ScanItem& from);
-  void MergeFrom(const ScanItem& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
-  void InternalSwap(ScanItem* other);
+  void SetCachedSize(int size) const final;
+  void InternalSwap(UnLockRequest* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mpr.chubby.UnLockRequest";
   }
+  protected:
+  explicit UnLockRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // optional string key = 1;
+  enum : int {
+    kKeyFieldNumber = 1,
+    kSessionIdFieldNumber = 2,
+    kUuidFieldNumber = 3,
+    kRequestIdFieldNumber = 4,
+  };
+  // string key = 1;
   void clear_key();
-  static const int kKeyFieldNumber = 1;
-  const ::std::string& key() const;
-  void set_key(const ::std::string& value);
-  void set_key(const char* value);
-  void set_key(const char* value, size_t size);
-  ::std::string* mutable_key();
-  ::std::string* release_key();
-  void set_allocated_key(::std::string* key);
-
-  // optional bytes value = 2;
-  void clear_value();
-  static const int kValueFieldNumber = 2;
-  const ::std::string& value() const;
-  void set_value(const ::std::string& value);
-  void set_value(const char* value);
-  void set_value(const void* value, size_t size);
-  ::std::string* mutable_value();
-  ::std::string* release_value();
-  void set_allocated_value(::std::string* value);
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
 
-  // @@protoc_insertion_point(class_scope:mpr.chubby.ScanItem)
- private:
+  // string session_id = 2;
+  void clear_session_id();
+  const std::string& session_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_session_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_session_id();
+  PROTOBUF_NODISCARD std::string* release_session_id();
+  void set_allocated_session_id(std::string* session_id);
+  private:
+  const std::string& _internal_session_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_session_id(const std::string& value);
+  std::string* _internal_mutable_session_id();
+  public:
+
+  // string uuid = 3;
+  void clear_uuid();
+  const std::string& uuid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_uuid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_uuid();
+  PROTOBUF_NODISCARD std::string* release_uuid();
+  void set_allocated_uuid(std::string* uuid);
+  private:
+  const std::string& _internal_uuid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_uuid(const std::string& value);
+  std::string* _internal_mutable_uuid();
+  public:
+
+  // string request_id = 4;
+  void clear_request_id();
+  const std::string& request_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_request_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_request_id();
+  PROTOBUF_NODISCARD std::string* release_request_id();
+  void set_allocated_request_id(std::string* request_id);
+  private:
+  const std::string& _internal_request_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_request_id(const std::string& value);
+  std::string* _internal_mutable_request_id();
+  public:
 
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  bool _is_default_instance_;
-  ::google::protobuf::internal::ArenaStringPtr key_;
-  ::google::protobuf::internal::ArenaStringPtr value_;
-  mutable int _cached_size_;
-  friend void  protobuf_AddDesc_service_2eproto();
-  friend void protobuf_AssignDesc_service_2eproto();
-  friend void protobuf_ShutdownFile_service_2eproto();
-
-  void InitAsDefaultInstance();
-  static ScanItem* default_instance_;
+  // @@protoc_insertion_point(class_scope:mpr.chubby.UnLockRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr session_id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr uuid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr request_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_service_2eproto;
 };
 // -------------------------------------------------------------------
 
-class ScanResponse : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:mpr.chubby.ScanResponse) */ {
+class UnLockResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mpr.chubby.UnLockResponse) */ {
  public:
-  ScanResponse();
-  virtual ~ScanResponse();
+  inline UnLockResponse() : UnLockResponse(nullptr) {}
+  ~UnLockResponse() override;
+  explicit PROTOBUF_CONSTEXPR UnLockResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  ScanResponse(const ScanResponse& from);
+  UnLockResponse(const UnLockResponse& from);
+  UnLockResponse(UnLockResponse&& from) noexcept
+    : UnLockResponse() {
+    *this = ::std::move(from);
+  }
 
-  inline ScanResponse& operator=(const ScanResponse& from) {
+  inline UnLockResponse& operator=(const UnLockResponse& from) {
     CopyFrom(from);
     return *this;
   }
+  inline UnLockResponse& operator=(UnLockResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const ScanResponse& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const UnLockResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const UnLockResponse* internal_default_instance() {
+    return reinterpret_cast<const UnLockResponse*>(
+               &_UnLockResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    19;
 
-  void Swap(ScanResponse* other);
+  friend void swap(UnLockResponse& a, UnLockResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(UnLockResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(UnLockResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline ScanResponse* New() const { return New(NULL); }
+  UnLockResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<UnLockResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const UnLockResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const UnLockResponse& from) {
+    UnLockResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-  ScanResponse* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const ScanResponse& from);
-  void MergeFrom(const ScanResponse& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
-  void InternalSwap(ScanResponse* other);
+  void SetCachedSize(int size) const final;
+  void InternalSwap(UnLockResponse* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mpr.chubby.UnLockResponse";
   }
+  protected:
+  explicit UnLockResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // optional bool has_more = 1;
-  void clear_has_more();
-  static const int kHasMoreFieldNumber = 1;
-  bool has_more() const;
-  void set_has_more(bool value);
-
-  // repeated .mpr.chubby.ScanItem items = 2;
-  int items_size() const;
-  void clear_items();
-  static const int kItemsFieldNumber = 2;
-  const ::mpr::chubby::ScanItem& items(int index) const;
-  ::mpr::chubby::ScanItem* mutable_items(int index);
-  ::mpr::chubby::ScanItem* add_items();
-  ::google::protobuf::RepeatedPtrField< ::mpr::chubby::ScanItem >*
-      mutable_items();
-  const ::google::protobuf::RepeatedPtrField< ::mpr::chubby::ScanItem >&
-      items() const;
-
-  // optional string leader_id = 3;
+  enum : int {
+    kLeaderIdFieldNumber = 2,
+    kSuccessFieldNumber = 1,
+    kUuidExpiredFieldNumber = 3,
+  };
+  // string leader_id = 2;
   void clear_leader_id();
-  static const int kLeaderIdFieldNumber = 3;
-  const ::std::string& leader_id() const;
-  void set_leader_id(const ::std::string& value);
-  void set_leader_id(const char* value);
-  void set_leader_id(const char* value, size_t size);
-  ::std::string* mutable_leader_id();
-  ::std::string* release_leader_id();
-  void set_allocated_leader_id(::std::string* leader_id);
-
-  // optional bool success = 4;
+  const std::string& leader_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_leader_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_leader_id();
+  PROTOBUF_NODISCARD std::string* release_leader_id();
+  void set_allocated_leader_id(std::string* leader_id);
+  private:
+  const std::string& _internal_leader_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_leader_id(const std::string& value);
+  std::string* _internal_mutable_leader_id();
+  public:
+
+  // bool success = 1;
   void clear_success();
-  static const int kSuccessFieldNumber = 4;
   bool success() const;
   void set_success(bool value);
+  private:
+  bool _internal_success() const;
+  void _internal_set_success(bool value);
+  public:
 
-  // optional bool uuid_expired = 5;
+  // bool uuid_expired = 3;
   void clear_uuid_expired();
-  static const int kUuidExpiredFieldNumber = 5;
   bool uuid_expired() const;
   void set_uuid_expired(bool value);
+  private:
+  bool _internal_uuid_expired() const;
+  void _internal_set_uuid_expired(bool value);
+  public:
 
-  // @@protoc_insertion_point(class_scope:mpr.chubby.ScanResponse)
+  // @@protoc_insertion_point(class_scope:mpr.chubby.UnLockResponse)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  bool _is_default_instance_;
-  ::google::protobuf::RepeatedPtrField< ::mpr::chubby::ScanItem > items_;
-  ::google::protobuf::internal::ArenaStringPtr leader_id_;
-  bool has_more_;
-  bool success_;
-  bool uuid_expired_;
-  mutable int _cached_size_;
-  friend void  protobuf_AddDesc_service_2eproto();
-  friend void protobuf_AssignDesc_service_2eproto();
-  friend void protobuf_ShutdownFile_service_2eproto();
-
-  void InitAsDefaultInstance();
-  static ScanResponse* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr leader_id_;
+    bool success_;
+    bool uuid_expired_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_service_2eproto;
 };
 // -------------------------------------------------------------------
 
-class LockRequest : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:mpr.chubby.LockRequest) */ {
+class ShowStatusRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:mpr.chubby.ShowStatusRequest) */ {
  public:
-  LockRequest();
-  virtual ~LockRequest();
+  inline ShowStatusRequest() : ShowStatusRequest(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR ShowStatusRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  LockRequest(const LockRequest& from);
+  ShowStatusRequest(const ShowStatusRequest& from);
+  ShowStatusRequest(ShowStatusRequest&& from) noexcept
+    : ShowStatusRequest() {
+    *this = ::std::move(from);
+  }
 
-  inline LockRequest& operator=(const LockRequest& from) {
+  inline ShowStatusRequest& operator=(const ShowStatusRequest& from) {
     CopyFrom(from);
     return *this;
   }
+  inline ShowStatusRequest& operator=(ShowStatusRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const LockRequest& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ShowStatusRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ShowStatusRequest* internal_default_instance() {
+    return reinterpret_cast<const ShowStatusRequest*>(
+               &_ShowStatusRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    20;
 
-  void Swap(LockRequest* other);
+  friend void swap(ShowStatusRequest& a, ShowStatusRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ShowStatusRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ShowStatusRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline LockRequest* New() const { return New(NULL); }
+  ShowStatusRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ShowStatusRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const ShowStatusRequest& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const ShowStatusRequest& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
 
-  LockRequest* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const LockRequest& from);
-  void MergeFrom(const LockRequest& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
-  void InternalSwap(LockRequest* other);
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mpr.chubby.ShowStatusRequest";
   }
+  protected:
+  explicit ShowStatusRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // optional string key = 1;
-  void clear_key();
-  static const int kKeyFieldNumber = 1;
-  const ::std::string& key() const;
-  void set_key(const ::std::string& value);
-  void set_key(const char* value);
-  void set_key(const char* value, size_t size);
-  ::std::string* mutable_key();
-  ::std::string* release_key();
-  void set_allocated_key(::std::string* key);
-
-  // optional string session_id = 2;
-  void clear_session_id();
-  static const int kSessionIdFieldNumber = 2;
-  const ::std::string& session_id() const;
-  void set_session_id(const ::std::string& value);
-  void set_session_id(const char* value);
-  void set_session_id(const char* value, size_t size);
-  ::std::string* mutable_session_id();
-  ::std::string* release_session_id();
-  void set_allocated_session_id(::std::string* session_id);
-
-  // optional string hostname = 3;
-  void clear_hostname();
-  static const int kHostnameFieldNumber = 3;
-  const ::std::string& hostname() const;
-  void set_hostname(const ::std::string& value);
-  void set_hostname(const char* value);
-  void set_hostname(const char* value, size_t size);
-  ::std::string* mutable_hostname();
-  ::std::string* release_hostname();
-  void set_allocated_hostname(::std::string* hostname);
-
-  // optional string uuid = 4;
-  void clear_uuid();
-  static const int kUuidFieldNumber = 4;
-  const ::std::string& uuid() const;
-  void set_uuid(const ::std::string& value);
-  void set_uuid(const char* value);
-  void set_uuid(const char* value, size_t size);
-  ::std::string* mutable_uuid();
-  ::std::string* release_uuid();
-  void set_allocated_uuid(::std::string* uuid);
-
-  // @@protoc_insertion_point(class_scope:mpr.chubby.LockRequest)
+  // @@protoc_insertion_point(class_scope:mpr.chubby.ShowStatusRequest)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  bool _is_default_instance_;
-  ::google::protobuf::internal::ArenaStringPtr key_;
-  ::google::protobuf::internal::ArenaStringPtr session_id_;
-  ::google::protobuf::internal::ArenaStringPtr hostname_;
-  ::google::protobuf::internal::ArenaStringPtr uuid_;
-  mutable int _cached_size_;
-  friend void  protobuf_AddDesc_service_2eproto();
-  friend void protobuf_AssignDesc_service_2eproto();
-  friend void protobuf_ShutdownFile_service_2eproto();
-
-  void InitAsDefaultInstance();
-  static LockRequest* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+  };
+  friend struct ::TableStruct_service_2eproto;
 };
 // -------------------------------------------------------------------
 
-class LockResponse : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:mpr.chubby.LockResponse) */ {
+class ShowStatusResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mpr.chubby.ShowStatusResponse) */ {
  public:
-  LockResponse();
-  virtual ~LockResponse();
+  inline ShowStatusResponse() : ShowStatusResponse(nullptr) {}
+  ~ShowStatusResponse() override;
+  explicit PROTOBUF_CONSTEXPR ShowStatusResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  LockResponse(const LockResponse& from);
+  ShowStatusResponse(const ShowStatusResponse& from);
+  ShowStatusResponse(ShowStatusResponse&& from) noexcept
+    : ShowStatusResponse() {
+    *this = ::std::move(from);
+  }
 
-  inline LockResponse& operator=(const LockResponse& from) {
+  inline ShowStatusResponse& operator=(const ShowStatusResponse& from) {
     CopyFrom(from);
     return *this;
   }
+  inline ShowStatusResponse& operator=(ShowStatusResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const LockResponse& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ShowStatusResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ShowStatusResponse* internal_default_instance() {
+    return reinterpret_cast<const ShowStatusResponse*>(
+               &_ShowStatusResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    21;
 
-  void Swap(LockResponse* other);
+  friend void swap(ShowStatusResponse& a, ShowStatusResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ShowStatusResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ShowStatusResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline LockResponse* New() const { return New(NULL); }
+  ShowStatusResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ShowStatusResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ShowStatusResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ShowStatusResponse& from) {
+    ShowStatusResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-  LockResponse* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const LockResponse& from);
-  void MergeFrom(const LockResponse& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
-  void InternalSwap(LockResponse* other);
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ShowStatusResponse* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mpr.chubby.ShowStatusResponse";
   }
+  protected:
+  explicit ShowStatusResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // optional bool success = 1;
-  void clear_success();
-  static const int kSuccessFieldNumber = 1;
-  bool success() const;
-  void set_success(bool value);
+  enum : int {
+    kTermFieldNumber = 2,
+    kLastLogIndexFieldNumber = 3,
+    kLastLogTermFieldNumber = 4,
+    kCommitIndexFieldNumber = 5,
+    kLastAppliedFieldNumber = 6,
+    kStatusFieldNumber = 1,
+  };
+  // int64 term = 2;
+  void clear_term();
+  int64_t term() const;
+  void set_term(int64_t value);
+  private:
+  int64_t _internal_term() const;
+  void _internal_set_term(int64_t value);
+  public:
 
-  // optional string leader_id = 2;
-  void clear_leader_id();
-  static const int kLeaderIdFieldNumber = 2;
-  const ::std::string& leader_id() const;
-  void set_leader_id(const ::std::string& value);
-  void set_leader_id(const char* value);
-  void set_leader_id(const char* value, size_t size);
-  ::std::string* mutable_leader_id();
-  ::std::string* release_leader_id();
-  void set_allocated_leader_id(::std::string* leader_id);
-
-  // optional bool uuid_expired = 3;
-  void clear_uuid_expired();
-  static const int kUuidExpiredFieldNumber = 3;
-  bool uuid_expired() const;
-  void set_uuid_expired(bool value);
+  // int64 last_log_index = 3;
+  void clear_last_log_index();
+  int64_t last_log_index() const;
+  void set_last_log_index(int64_t value);
+  private:
+  int64_t _internal_last_log_index() const;
+  void _internal_set_last_log_index(int64_t value);
+  public:
 
-  // @@protoc_insertion_point(class_scope:mpr.chubby.LockResponse)
- private:
+  // int64 last_log_term = 4;
+  void clear_last_log_term();
+  int64_t last_log_term() const;
+  void set_last_log_term(int64_t value);
+  private:
+  int64_t _internal_last_log_term() const;
+  void _internal_set_last_log_term(int64_t value);
+  public:
+
+  // int64 commit_index = 5;
+  void clear_commit_index();
+  int64_t commit_index() const;
+  void set_commit_index(int64_t value);
+  private:
+  int64_t _internal_commit_index() const;
+  void _internal_set_commit_index(int64_t value);
+  public:
+
+  // int64 last_applied = 6;
+  void clear_last_applied();
+  int64_t last_applied() const;
+  void set_last_applied(int64_t value);
+  private:
+  int64_t _internal_last_applied() const;
+  void _internal_set_last_applied(int64_t value);
+  public:
+
+  // .mpr.chubby.NodeStatus status = 1;
+  void clear_status();
+  ::mpr::chubby::NodeStatus status() const;
+  void set_status(::mpr::chubby::NodeStatus value);
+  private:
+  ::mpr::chubby::NodeStatus _internal_status() const;
+  void _internal_set_status(::mpr::chubby::NodeStatus value);
+  public:
 
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  bool _is_default_instance_;
-  ::google::protobuf::internal::ArenaStringPtr leader_id_;
-  bool success_;
-  bool uuid_expired_;
-  mutable int _cached_size_;
-  friend void  protobuf_AddDesc_service_2eproto();
-  friend void protobuf_AssignDesc_service_2eproto();
-  friend void protobuf_ShutdownFile_service_2eproto();
-
-  void InitAsDefaultInstance();
-  static LockResponse* default_instance_;
+  // @@protoc_insertion_point(class_scope:mpr.chubby.ShowStatusResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int64_t term_;
+    int64_t last_log_index_;
+    int64_t last_log_term_;
+    int64_t commit_index_;
+    int64_t last_applied_;
+    int status_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_service_2eproto;
 };
 // -------------------------------------------------------------------
 
-class KeepAliveRequest : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:mpr.chubby.KeepAliveRequest) */ {
+class ScanRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mpr.chubby.ScanRequest) */ {
  public:
-  KeepAliveRequest();
-  virtual ~KeepAliveRequest();
+  inline ScanRequest() : ScanRequest(nullptr) {}
+  ~ScanRequest() override;
+  explicit PROTOBUF_CONSTEXPR ScanRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  KeepAliveRequest(const KeepAliveRequest& from);
+  ScanRequest(const ScanRequest& from);
+  ScanRequest(ScanRequest&& from) noexcept
+    : ScanRequest() {
+    *this = ::std::move(from);
+  }
 
-  inline KeepAliveRequest& operator=(const KeepAliveRequest& from) {
+  inline ScanRequest& operator=(const ScanRequest& from) {
     CopyFrom(from);
     return *this;
   }
+  inline ScanRequest& operator=(ScanRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const KeepAliveRequest& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ScanRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ScanRequest* internal_default_instance() {
+    return reinterpret_cast<const ScanRequest*>(
+               &_ScanRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    22;
 
-  void Swap(KeepAliveRequest* other);
+  friend void swap(ScanRequest& a, ScanRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ScanRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ScanRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline KeepAliveRequest* New() const { return New(NULL); }
+  ScanRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ScanRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ScanRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ScanRequest& from) {
+    ScanRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
 
-  KeepAliveRequest* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const KeepAliveRequest& from);
-  void MergeFrom(const KeepAliveRequest& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
-  void InternalSwap(KeepAliveRequest* other);
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ScanRequest* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mpr.chubby.ScanRequest";
   }
+  protected:
+  explicit ScanRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // optional string session_id = 1;
-  void clear_session_id();
-  static const int kSessionIdFieldNumber = 1;
-  const ::std::string& session_id() const;
-  void set_session_id(const ::std::string& value);
-  void set_session_id(const char* value);
-  void set_session_id(const char* value, size_t size);
-  ::std::string* mutable_session_id();
-  ::std::string* release_session_id();
-  void set_allocated_session_id(::std::string* session_id);
-
-  // optional string uuid = 2;
-  void clear_uuid();
-  static const int kUuidFieldNumber = 2;
-  const ::std::string& uuid() const;
-  void set_uuid(const ::std::string& value);
-  void set_uuid(const char* value);
-  void set_uuid(const char* value, size_t size);
-  ::std::string* mutable_uuid();
-  ::std::string* release_uuid();
-  void set_allocated_uuid(::std::string* uuid);
+  enum : int {
+    kStartKeyFieldNumber = 1,
+    kEndKeyFieldNumber = 2,
+    kUuidFieldNumber = 4,
+    kStaleReadFieldNumber = 5,
+    kSizeLimitFieldNumber = 3,
+  };
+  // string start_key = 1;
+  void clear_start_key();
+  const std::string& start_key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_start_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_start_key();
+  PROTOBUF_NODISCARD std::string* release_start_key();
+  void set_allocated_start_key(std::string* start_key);
+  private:
+  const std::string& _internal_start_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_start_key(const std::string& value);
+  std::string* _internal_mutable_start_key();
+  public:
 
-  // repeated string locks = 3;
-  int locks_size() const;
-  void clear_locks();
-  static const int kLocksFieldNumber = 3;
-  const ::std::string& locks(int index) const;
-  ::std::string* mutable_locks(int index);
-  void set_locks(int index, const ::std::string& value);
-  void set_locks(int index, const char* value);
-  void set_locks(int index, const char* value, size_t size);
-  ::std::string* add_locks();
-  void add_locks(const ::std::string& value);
-  void add_locks(const char* value);
-  void add_locks(const char* value, size_t size);
-  const ::google::protobuf::RepeatedPtrField< ::std::string>& locks() const;
-  ::google::protobuf::RepeatedPtrField< ::std::string>* mutable_locks();
+  // bytes end_key = 2;
+  void clear_end_key();
+  const std::string& end_key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_end_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_end_key();
+  PROTOBUF_NODISCARD std::string* release_end_key();
+  void set_allocated_end_key(std::string* end_key);
+  private:
+  const std::string& _internal_end_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_end_key(const std::string& value);
+  std::string* _internal_mutable_end_key();
+  public:
 
-  // optional bool forward_from_leader = 4;
-  void clear_forward_from_leader();
-  static const int kForwardFromLeaderFieldNumber = 4;
-  bool forward_from_leader() const;
-  void set_forward_from_leader(bool value);
+  // string uuid = 4;
+  void clear_uuid();
+  const std::string& uuid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_uuid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_uuid();
+  PROTOBUF_NODISCARD std::string* release_uuid();
+  void set_allocated_uuid(std::string* uuid);
+  private:
+  const std::string& _internal_uuid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_uuid(const std::string& value);
+  std::string* _internal_mutable_uuid();
+  public:
 
-  // @@protoc_insertion_point(class_scope:mpr.chubby.KeepAliveRequest)
- private:
+  // .mpr.chubby.StaleRead stale_read = 5;
+  bool has_stale_read() const;
+  private:
+  bool _internal_has_stale_read() const;
+  public:
+  void clear_stale_read();
+  const ::mpr::chubby::StaleRead& stale_read() const;
+  PROTOBUF_NODISCARD ::mpr::chubby::StaleRead* release_stale_read();
+  ::mpr::chubby::StaleRead* mutable_stale_read();
+  void set_allocated_stale_read(::mpr::chubby::StaleRead* stale_read);
+  private:
+  const ::mpr::chubby::StaleRead& _internal_stale_read() const;
+  ::mpr::chubby::StaleRead* _internal_mutable_stale_read();
+  public:
+  void unsafe_arena_set_allocated_stale_read(
+      ::mpr::chubby::StaleRead* stale_read);
+  ::mpr::chubby::StaleRead* unsafe_arena_release_stale_read();
+
+  // int32 size_limit = 3;
+  void clear_size_limit();
+  int32_t size_limit() const;
+  void set_size_limit(int32_t value);
+  private:
+  int32_t _internal_size_limit() const;
+  void _internal_set_size_limit(int32_t value);
+  public:
 
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  bool _is_default_instance_;
-  ::google::protobuf::internal::ArenaStringPtr session_id_;
-  ::google::protobuf::internal::ArenaStringPtr uuid_;
-  ::google::protobuf::RepeatedPtrField< ::std::string> locks_;
-  bool forward_from_leader_;
-  mutable int _cached_size_;
-  friend void  protobuf_AddDesc_service_2eproto();
-  friend void protobuf_AssignDesc_service_2eproto();
-  friend void protobuf_ShutdownFile_service_2eproto();
-
-  void InitAsDefaultInstance();
-  static KeepAliveRequest* default_instance_;
+  // @@protoc_insertion_point(class_scope:mpr.chubby.ScanRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr start_key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr end_key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr uuid_;
+    ::mpr::chubby::StaleRead* stale_read_;
+    int32_t size_limit_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_service_2eproto;
 };
 // -------------------------------------------------------------------
 
-class KeepAliveResponse : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:mpr.chubby.KeepAliveResponse) */ {
+class ScanItem final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mpr.chubby.ScanItem) */ {
  public:
-  KeepAliveResponse();
-  virtual ~KeepAliveResponse();
+  inline ScanItem() : ScanItem(nullptr) {}
+  ~ScanItem() override;
+  explicit PROTOBUF_CONSTEXPR ScanItem(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  KeepAliveResponse(const KeepAliveResponse& from);
+  ScanItem(const ScanItem& from);
+  ScanItem(ScanItem&& from) noexcept
+    : ScanItem() {
+    *this = ::std::move(from);
+  }
 
-  inline KeepAliveResponse& operator=(const KeepAliveResponse& from) {
+  inline ScanItem& operator=(const ScanItem& from) {
     CopyFrom(from);
     return *this;
   }
+  inline ScanItem& operator=(ScanItem&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const KeepAliveResponse& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ScanItem& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ScanItem* internal_default_instance() {
+    return reinterpret_cast<const ScanItem*>(
+               &_ScanItem_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    23;
 
-  void Swap(KeepAliveResponse* other);
+  friend void swap(ScanItem& a, ScanItem& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ScanItem* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ScanItem* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline KeepAliveResponse* New() const { return New(NULL); }
+  ScanItem* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ScanItem>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ScanItem& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ScanItem& from) {
+    ScanItem::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-  KeepAliveResponse* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const KeepAliveResponse& from);
-  void MergeFrom(const KeepAliveResponse& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
-  void InternalSwap(KeepAliveResponse* other);
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ScanItem* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mpr.chubby.ScanItem";
   }
+  protected:
+  explicit ScanItem(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // optional bool success = 1;
-  void clear_success();
-  static const int kSuccessFieldNumber = 1;
-  bool success() const;
-  void set_success(bool value);
+  enum : int {
+    kKeyFieldNumber = 1,
+    kValueFieldNumber = 2,
+  };
+  // string key = 1;
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
 
-  // optional string leader_id = 2;
-  void clear_leader_id();
-  static const int kLeaderIdFieldNumber = 2;
-  const ::std::string& leader_id() const;
-  void set_leader_id(const ::std::string& value);
-  void set_leader_id(const char* value);
-  void set_leader_id(const char* value, size_t size);
-  ::std::string* mutable_leader_id();
-  ::std::string* release_leader_id();
-  void set_allocated_leader_id(::std::string* leader_id);
+  // bytes value = 2;
+  void clear_value();
+  const std::string& value() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_value();
+  PROTOBUF_NODISCARD std::string* release_value();
+  void set_allocated_value(std::string* value);
+  private:
+  const std::string& _internal_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
+  std::string* _internal_mutable_value();
+  public:
 
-  // @@protoc_insertion_point(class_scope:mpr.chubby.KeepAliveResponse)
+  // @@protoc_insertion_point(class_scope:mpr.chubby.ScanItem)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  bool _is_default_instance_;
-  ::google::protobuf::internal::ArenaStringPtr leader_id_;
-  bool success_;
-  mutable int _cached_size_;
-  friend void  protobuf_AddDesc_service_2eproto();
-  friend void protobuf_AssignDesc_service_2eproto();
-  friend void protobuf_ShutdownFile_service_2eproto();
-
-  void InitAsDefaultInstance();
-  static KeepAliveResponse* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_service_2eproto;
 };
 // -------------------------------------------------------------------
 
-class LoginRequest : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:mpr.chubby.LoginRequest) */ {
+class ScanResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mpr.chubby.ScanResponse) */ {
  public:
-  LoginRequest();
-  virtual ~LoginRequest();
+  inline ScanResponse() : ScanResponse(nullptr) {}
+  ~ScanResponse() override;
+  explicit PROTOBUF_CONSTEXPR ScanResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  LoginRequest(const LoginRequest& from);
+  ScanResponse(const ScanResponse& from);
+  ScanResponse(ScanResponse&& from) noexcept
+    : ScanResponse() {
+    *this = ::std::move(from);
+  }
 
-  inline LoginRequest& operator=(const LoginRequest& from) {
+  inline ScanResponse& operator=(const ScanResponse& from) {
     CopyFrom(from);
     return *this;
   }
+  inline ScanResponse& operator=(ScanResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const LoginRequest& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ScanResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ScanResponse* internal_default_instance() {
+    return reinterpret_cast<const ScanResponse*>(
+               &_ScanResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    24;
 
-  void Swap(LoginRequest* other);
+  friend void swap(ScanResponse& a, ScanResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ScanResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ScanResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline LoginRequest* New() const { return New(NULL); }
+  ScanResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ScanResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ScanResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ScanResponse& from) {
+    ScanResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
 
-  LoginRequest* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const LoginRequest& from);
-  void MergeFrom(const LoginRequest& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
-  void InternalSwap(LoginRequest* other);
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ScanResponse* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mpr.chubby.ScanResponse";
   }
+  protected:
+  explicit ScanResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // optional string username = 1;
-  void clear_username();
-  static const int kUsernameFieldNumber = 1;
-  const ::std::string& username() const;
-  void set_username(const ::std::string& value);
-  void set_username(const char* value);
-  void set_username(const char* value, size_t size);
-  ::std::string* mutable_username();
-  ::std::string* release_username();
-  void set_allocated_username(::std::string* username);
-
-  // optional string passwd = 2;
-  void clear_passwd();
-  static const int kPasswdFieldNumber = 2;
-  const ::std::string& passwd() const;
-  void set_passwd(const ::std::string& value);
-  void set_passwd(const char* value);
-  void set_passwd(const char* value, size_t size);
-  ::std::string* mutable_passwd();
-  ::std::string* release_passwd();
-  void set_allocated_passwd(::std::string* passwd);
+  enum : int {
+    kItemsFieldNumber = 2,
+    kLeaderIdFieldNumber = 3,
+    kLastAppliedFieldNumber = 6,
+    kHasMoreFieldNumber = 1,
+    kSuccessFieldNumber = 4,
+    kUuidExpiredFieldNumber = 5,
+  };
+  // repeated .mpr.chubby.ScanItem items = 2;
+  int items_size() const;
+  private:
+  int _internal_items_size() const;
+  public:
+  void clear_items();
+  ::mpr::chubby::ScanItem* mutable_items(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::mpr::chubby::ScanItem >*
+      mutable_items();
+  private:
+  const ::mpr::chubby::ScanItem& _internal_items(int index) const;
+  ::mpr::chubby::ScanItem* _internal_add_items();
+  public:
+  const ::mpr::chubby::ScanItem& items(int index) const;
+  ::mpr::chubby::ScanItem* add_items();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::mpr::chubby::ScanItem >&
+      items() const;
 
-  // @@protoc_insertion_point(class_scope:mpr.chubby.LoginRequest)
- private:
+  // string leader_id = 3;
+  void clear_leader_id();
+  const std::string& leader_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_leader_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_leader_id();
+  PROTOBUF_NODISCARD std::string* release_leader_id();
+  void set_allocated_leader_id(std::string* leader_id);
+  private:
+  const std::string& _internal_leader_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_leader_id(const std::string& value);
+  std::string* _internal_mutable_leader_id();
+  public:
+
+  // int64 last_applied = 6;
+  void clear_last_applied();
+  int64_t last_applied() const;
+  void set_last_applied(int64_t value);
+  private:
+  int64_t _internal_last_applied() const;
+  void _internal_set_last_applied(int64_t value);
+  public:
+
+  // bool has_more = 1;
+  void clear_has_more();
+  bool has_more() const;
+  void set_has_more(bool value);
+  private:
+  bool _internal_has_more() const;
+  void _internal_set_has_more(bool value);
+  public:
+
+  // bool success = 4;
+  void clear_success();
+  bool success() const;
+  void set_success(bool value);
+  private:
+  bool _internal_success() const;
+  void _internal_set_success(bool value);
+  public:
 
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  bool _is_default_instance_;
-  ::google::protobuf::internal::ArenaStringPtr username_;
-  ::google::protobuf::internal::ArenaStringPtr passwd_;
-  mutable int _cached_size_;
-  friend void  protobuf_AddDesc_service_2eproto();
-  friend void protobuf_AssignDesc_service_2eproto();
-  friend void protobuf_ShutdownFile_service_2eproto();
-
-  void InitAsDefaultInstance();
-  static LoginRequest* default_instance_;
+  // bool uuid_expired = 5;
+  void clear_uuid_expired();
+  bool uuid_expired() const;
+  void set_uuid_expired(bool value);
+  private:
+  bool _internal_uuid_expired() const;
+  void _internal_set_uuid_expired(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:mpr.chubby.ScanResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::mpr::chubby::ScanItem > items_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr leader_id_;
+    int64_t last_applied_;
+    bool has_more_;
+    bool success_;
+    bool uuid_expired_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_service_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Status : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:mpr.chubby.Status) */ {
+class LockRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mpr.chubby.LockRequest) */ {
  public:
-  Status();
-  virtual ~Status();
+  inline LockRequest() : LockRequest(nullptr) {}
+  ~LockRequest() override;
+  explicit PROTOBUF_CONSTEXPR LockRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  Status(const Status& from);
+  LockRequest(const LockRequest& from);
+  LockRequest(LockRequest&& from) noexcept
+    : LockRequest() {
+    *this = ::std::move(from);
+  }
 
-  inline Status& operator=(const Status& from) {
+  inline LockRequest& operator=(const LockRequest& from) {
     CopyFrom(from);
     return *this;
   }
+  inline LockRequest& operator=(LockRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const Status& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LockRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const LockRequest* internal_default_instance() {
+    return reinterpret_cast<const LockRequest*>(
+               &_LockRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    25;
 
-  void Swap(Status* other);
+  friend void swap(LockRequest& a, LockRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(LockRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LockRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline Status* New() const { return New(NULL); }
+  LockRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<LockRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const LockRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LockRequest& from) {
+    LockRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-  Status* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const Status& from);
-  void MergeFrom(const Status& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
-  void InternalSwap(Status* other);
+  void SetCachedSize(int size) const final;
+  void InternalSwap(LockRequest* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mpr.chubby.LockRequest";
   }
+  protected:
+  explicit LockRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // optional int64 code = 1;
-  void clear_code();
-  static const int kCodeFieldNumber = 1;
-  ::google::protobuf::int64 code() const;
-  void set_code(::google::protobuf::int64 value);
+  enum : int {
+    kKeyFieldNumber = 1,
+    kSessionIdFieldNumber = 2,
+    kHostnameFieldNumber = 3,
+    kUuidFieldNumber = 4,
+    kRequestIdFieldNumber = 6,
+    kWaitTimeoutMsFieldNumber = 5,
+  };
+  // string key = 1;
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
 
-  // optional string message = 2;
-  void clear_message();
-  static const int kMessageFieldNumber = 2;
-  const ::std::string& message() const;
-  void set_message(const ::std::string& value);
-  void set_message(const char* value);
-  void set_message(const char* value, size_t size);
-  ::std::string* mutable_message();
-  ::std::string* release_message();
-  void set_allocated_message(::std::string* message);
+  // string session_id = 2;
+  void clear_session_id();
+  const std::string& session_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_session_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_session_id();
+  PROTOBUF_NODISCARD std::string* release_session_id();
+  void set_allocated_session_id(std::string* session_id);
+  private:
+  const std::string& _internal_session_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_session_id(const std::string& value);
+  std::string* _internal_mutable_session_id();
+  public:
 
-  // @@protoc_insertion_point(class_scope:mpr.chubby.Status)
- private:
+  // string hostname = 3;
+  void clear_hostname();
+  const std::string& hostname() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_hostname(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_hostname();
+  PROTOBUF_NODISCARD std::string* release_hostname();
+  void set_allocated_hostname(std::string* hostname);
+  private:
+  const std::string& _internal_hostname() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_hostname(const std::string& value);
+  std::string* _internal_mutable_hostname();
+  public:
+
+  // string uuid = 4;
+  void clear_uuid();
+  const std::string& uuid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_uuid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_uuid();
+  PROTOBUF_NODISCARD std::string* release_uuid();
+  void set_allocated_uuid(std::string* uuid);
+  private:
+  const std::string& _internal_uuid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_uuid(const std::string& value);
+  std::string* _internal_mutable_uuid();
+  public:
+
+  // string request_id = 6;
+  void clear_request_id();
+  const std::string& request_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_request_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_request_id();
+  PROTOBUF_NODISCARD std::string* release_request_id();
+  void set_allocated_request_id(std::string* request_id);
+  private:
+  const std::string& _internal_request_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_request_id(const std::string& value);
+  std::string* _internal_mutable_request_id();
+  public:
 
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  bool _is_default_instance_;
-  ::google::protobuf::int64 code_;
-  ::google::protobuf::internal::ArenaStringPtr message_;
-  mutable int _cached_size_;
-  friend void  protobuf_AddDesc_service_2eproto();
-  friend void protobuf_AssignDesc_service_2eproto();
-  friend void protobuf_ShutdownFile_service_2eproto();
-
-  void InitAsDefaultInstance();
-  static Status* default_instance_;
+  // int64 wait_timeout_ms = 5;
+  void clear_wait_timeout_ms();
+  int64_t wait_timeout_ms() const;
+  void set_wait_timeout_ms(int64_t value);
+  private:
+  int64_t _internal_wait_timeout_ms() const;
+  void _internal_set_wait_timeout_ms(int64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:mpr.chubby.LockRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr session_id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr hostname_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr uuid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr request_id_;
+    int64_t wait_timeout_ms_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_service_2eproto;
 };
 // -------------------------------------------------------------------
 
-class LoginResponse : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:mpr.chubby.LoginResponse) */ {
+class LockResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mpr.chubby.LockResponse) */ {
  public:
-  LoginResponse();
-  virtual ~LoginResponse();
+  inline LockResponse() : LockResponse(nullptr) {}
+  ~LockResponse() override;
+  explicit PROTOBUF_CONSTEXPR LockResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  LoginResponse(const LoginResponse& from);
+  LockResponse(const LockResponse& from);
+  LockResponse(LockResponse&& from) noexcept
+    : LockResponse() {
+    *this = ::std::move(from);
+  }
 
-  inline LoginResponse& operator=(const LoginResponse& from) {
+  inline LockResponse& operator=(const LockResponse& from) {
     CopyFrom(from);
     return *this;
   }
+  inline LockResponse& operator=(LockResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const LoginResponse& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LockResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const LockResponse* internal_default_instance() {
+    return reinterpret_cast<const LockResponse*>(
+               &_LockResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    26;
 
-  void Swap(LoginResponse* other);
+  friend void swap(LockResponse& a, LockResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(LockResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LockResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline LoginResponse* New() const { return New(NULL); }
+  LockResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<LockResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const LockResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LockResponse& from) {
+    LockResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-  LoginResponse* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const LoginResponse& from);
-  void MergeFrom(const LoginResponse& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
-  void InternalSwap(LoginResponse* other);
+  void SetCachedSize(int size) const final;
+  void InternalSwap(LockResponse* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mpr.chubby.LockResponse";
   }
+  protected:
+  explicit LockResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // optional .mpr.chubby.Status status = 1;
-  bool has_status() const;
-  void clear_status();
-  static const int kStatusFieldNumber = 1;
-  const ::mpr::chubby::Status& status() const;
-  ::mpr::chubby::Status* mutable_status();
-  ::mpr::chubby::Status* release_status();
-  void set_allocated_status(::mpr::chubby::Status* status);
-
-  // optional string uuid = 2;
-  void clear_uuid();
-  static const int kUuidFieldNumber = 2;
-  const ::std::string& uuid() const;
-  void set_uuid(const ::std::string& value);
-  void set_uuid(const char* value);
-  void set_uuid(const char* value, size_t size);
-  ::std::string* mutable_uuid();
-  ::std::string* release_uuid();
-  void set_allocated_uuid(::std::string* uuid);
-
-  // optional string leader_id = 3;
+  enum : int {
+    kLeaderIdFieldNumber = 2,
+    kSuccessFieldNumber = 1,
+    kUuidExpiredFieldNumber = 3,
+  };
+  // string leader_id = 2;
   void clear_leader_id();
-  static const int kLeaderIdFieldNumber = 3;
-  const ::std::string& leader_id() const;
-  void set_leader_id(const ::std::string& value);
-  void set_leader_id(const char* value);
-  void set_leader_id(const char* value, size_t size);
-  ::std::string* mutable_leader_id();
-  ::std::string* release_leader_id();
-  void set_allocated_leader_id(::std::string* leader_id);
+  const std::string& leader_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_leader_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_leader_id();
+  PROTOBUF_NODISCARD std::string* release_leader_id();
+  void set_allocated_leader_id(std::string* leader_id);
+  private:
+  const std::string& _internal_leader_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_leader_id(const std::string& value);
+  std::string* _internal_mutable_leader_id();
+  public:
 
-  // @@protoc_insertion_point(class_scope:mpr.chubby.LoginResponse)
- private:
+  // bool success = 1;
+  void clear_success();
+  bool success() const;
+  void set_success(bool value);
+  private:
+  bool _internal_success() const;
+  void _internal_set_success(bool value);
+  public:
+
+  // bool uuid_expired = 3;
+  void clear_uuid_expired();
+  bool uuid_expired() const;
+  void set_uuid_expired(bool value);
+  private:
+  bool _internal_uuid_expired() const;
+  void _internal_set_uuid_expired(bool value);
+  public:
 
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  bool _is_default_instance_;
-  ::mpr::chubby::Status* status_;
-  ::google::protobuf::internal::ArenaStringPtr uuid_;
-  ::google::protobuf::internal::ArenaStringPtr leader_id_;
-  mutable int _cached_size_;
-  friend void  protobuf_AddDesc_service_2eproto();
-  friend void protobuf_AssignDesc_service_2eproto();
-  friend void protobuf_ShutdownFile_service_2eproto();
-
-  void InitAsDefaultInstance();
-  static LoginResponse* default_instance_;
+  // @@protoc_insertion_point(class_scope:mpr.chubby.LockResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr leader_id_;
+    bool success_;
+    bool uuid_expired_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_service_2eproto;
 };
 // -------------------------------------------------------------------
 
-class LogoutRequest : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:mpr.chubby.LogoutRequest) */ {
+class KeepAliveRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mpr.chubby.KeepAliveRequest) */ {
  public:
-  LogoutRequest();
-  virtual ~LogoutRequest();
+  inline KeepAliveRequest() : KeepAliveRequest(nullptr) {}
+  ~KeepAliveRequest() override;
+  explicit PROTOBUF_CONSTEXPR KeepAliveRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  LogoutRequest(const LogoutRequest& from);
+  KeepAliveRequest(const KeepAliveRequest& from);
+  KeepAliveRequest(KeepAliveRequest&& from) noexcept
+    : KeepAliveRequest() {
+    *this = ::std::move(from);
+  }
 
-  inline LogoutRequest& operator=(const LogoutRequest& from) {
+  inline KeepAliveRequest& operator=(const KeepAliveRequest& from) {
     CopyFrom(from);
     return *this;
   }
+  inline KeepAliveRequest& operator=(KeepAliveRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const LogoutRequest& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const KeepAliveRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const KeepAliveRequest* internal_default_instance() {
+    return reinterpret_cast<const KeepAliveRequest*>(
+               &_KeepAliveRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    27;
 
-  void Swap(LogoutRequest* other);
+  friend void swap(KeepAliveRequest& a, KeepAliveRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(KeepAliveRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(KeepAliveRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline LogoutRequest* New() const { return New(NULL); }
-
-  LogoutRequest* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const LogoutRequest& from);
-  void MergeFrom(const LogoutRequest& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
-  void InternalSwap(LogoutRequest* other);
-  private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
+  KeepAliveRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<KeepAliveRequest>(arena);
   }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const KeepAliveRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const KeepAliveRequest& from) {
+    KeepAliveRequest::MergeImpl(*this, from);
   }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-  // nested types ----------------------------------------------------
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(KeepAliveRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mpr.chubby.KeepAliveRequest";
+  }
+  protected:
+  explicit KeepAliveRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // optional string uuid = 1;
+  enum : int {
+    kLocksFieldNumber = 3,
+    kSessionIdFieldNumber = 1,
+    kUuidFieldNumber = 2,
+    kAckedInvalidationFieldNumber = 5,
+    kForwardFromLeaderFieldNumber = 4,
+    kHoldMsFieldNumber = 6,
+    kCacheIncarnationFieldNumber = 7,
+  };
+  // repeated string locks = 3;
+  int locks_size() const;
+  private:
+  int _internal_locks_size() const;
+  public:
+  void clear_locks();
+  const std::string& locks(int index) const;
+  std::string* mutable_locks(int index);
+  void set_locks(int index, const std::string& value);
+  void set_locks(int index, std::string&& value);
+  void set_locks(int index, const char* value);
+  void set_locks(int index, const char* value, size_t size);
+  std::string* add_locks();
+  void add_locks(const std::string& value);
+  void add_locks(std::string&& value);
+  void add_locks(const char* value);
+  void add_locks(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& locks() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_locks();
+  private:
+  const std::string& _internal_locks(int index) const;
+  std::string* _internal_add_locks();
+  public:
+
+  // string session_id = 1;
+  void clear_session_id();
+  const std::string& session_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_session_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_session_id();
+  PROTOBUF_NODISCARD std::string* release_session_id();
+  void set_allocated_session_id(std::string* session_id);
+  private:
+  const std::string& _internal_session_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_session_id(const std::string& value);
+  std::string* _internal_mutable_session_id();
+  public:
+
+  // string uuid = 2;
   void clear_uuid();
-  static const int kUuidFieldNumber = 1;
-  const ::std::string& uuid() const;
-  void set_uuid(const ::std::string& value);
-  void set_uuid(const char* value);
-  void set_uuid(const char* value, size_t size);
-  ::std::string* mutable_uuid();
-  ::std::string* release_uuid();
-  void set_allocated_uuid(::std::string* uuid);
+  const std::string& uuid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_uuid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_uuid();
+  PROTOBUF_NODISCARD std::string* release_uuid();
+  void set_allocated_uuid(std::string* uuid);
+  private:
+  const std::string& _internal_uuid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_uuid(const std::string& value);
+  std::string* _internal_mutable_uuid();
+  public:
 
-  // @@protoc_insertion_point(class_scope:mpr.chubby.LogoutRequest)
- private:
+  // int64 acked_invalidation = 5;
+  void clear_acked_invalidation();
+  int64_t acked_invalidation() const;
+  void set_acked_invalidation(int64_t value);
+  private:
+  int64_t _internal_acked_invalidation() const;
+  void _internal_set_acked_invalidation(int64_t value);
+  public:
+
+  // bool forward_from_leader = 4;
+  void clear_forward_from_leader();
+  bool forward_from_leader() const;
+  void set_forward_from_leader(bool value);
+  private:
+  bool _internal_forward_from_leader() const;
+  void _internal_set_forward_from_leader(bool value);
+  public:
+
+  // int32 hold_ms = 6;
+  void clear_hold_ms();
+  int32_t hold_ms() const;
+  void set_hold_ms(int32_t value);
+  private:
+  int32_t _internal_hold_ms() const;
+  void _internal_set_hold_ms(int32_t value);
+  public:
 
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  bool _is_default_instance_;
-  ::google::protobuf::internal::ArenaStringPtr uuid_;
-  mutable int _cached_size_;
-  friend void  protobuf_AddDesc_service_2eproto();
-  friend void protobuf_AssignDesc_service_2eproto();
-  friend void protobuf_ShutdownFile_service_2eproto();
+  // int64 cache_incarnation = 7;
+  void clear_cache_incarnation();
+  int64_t cache_incarnation() const;
+  void set_cache_incarnation(int64_t value);
+  private:
+  int64_t _internal_cache_incarnation() const;
+  void _internal_set_cache_incarnation(int64_t value);
+  public:
 
-  void InitAsDefaultInstance();
-  static LogoutRequest* default_instance_;
+  // @@protoc_insertion_point(class_scope:mpr.chubby.KeepAliveRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> locks_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr session_id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr uuid_;
+    int64_t acked_invalidation_;
+    bool forward_from_leader_;
+    int32_t hold_ms_;
+    int64_t cache_incarnation_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_service_2eproto;
 };
 // -------------------------------------------------------------------
 
-class LogoutResponse : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:mpr.chubby.LogoutResponse) */ {
+class KeepAliveResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mpr.chubby.KeepAliveResponse) */ {
  public:
-  LogoutResponse();
-  virtual ~LogoutResponse();
+  inline KeepAliveResponse() : KeepAliveResponse(nullptr) {}
+  ~KeepAliveResponse() override;
+  explicit PROTOBUF_CONSTEXPR KeepAliveResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  LogoutResponse(const LogoutResponse& from);
+  KeepAliveResponse(const KeepAliveResponse& from);
+  KeepAliveResponse(KeepAliveResponse&& from) noexcept
+    : KeepAliveResponse() {
+    *this = ::std::move(from);
+  }
 
-  inline LogoutResponse& operator=(const LogoutResponse& from) {
+  inline KeepAliveResponse& operator=(const KeepAliveResponse& from) {
     CopyFrom(from);
     return *this;
   }
+  inline KeepAliveResponse& operator=(KeepAliveResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const LogoutResponse& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const KeepAliveResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const KeepAliveResponse* internal_default_instance() {
+    return reinterpret_cast<const KeepAliveResponse*>(
+               &_KeepAliveResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    28;
 
-  void Swap(LogoutResponse* other);
+  friend void swap(KeepAliveResponse& a, KeepAliveResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(KeepAliveResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(KeepAliveResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline LogoutResponse* New() const { return New(NULL); }
+  KeepAliveResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<KeepAliveResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const KeepAliveResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const KeepAliveResponse& from) {
+    KeepAliveResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-  LogoutResponse* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const LogoutResponse& from);
-  void MergeFrom(const LogoutResponse& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
-  void InternalSwap(LogoutResponse* other);
+  void SetCachedSize(int size) const final;
+  void InternalSwap(KeepAliveResponse* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mpr.chubby.KeepAliveResponse";
   }
+  protected:
+  explicit KeepAliveResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // optional .mpr.chubby.Status status = 1;
-  bool has_status() const;
-  void clear_status();
-  static const int kStatusFieldNumber = 1;
-  const ::mpr::chubby::Status& status() const;
-  ::mpr::chubby::Status* mutable_status();
-  ::mpr::chubby::Status* release_status();
-  void set_allocated_status(::mpr::chubby::Status* status);
+  enum : int {
+    kInvalidationsFieldNumber = 3,
+    kLeaderIdFieldNumber = 2,
+    kInvalidationSeqFieldNumber = 4,
+    kCacheIncarnationFieldNumber = 5,
+    kSuccessFieldNumber = 1,
+  };
+  // repeated string invalidations = 3;
+  int invalidations_size() const;
+  private:
+  int _internal_invalidations_size() const;
+  public:
+  void clear_invalidations();
+  const std::string& invalidations(int index) const;
+  std::string* mutable_invalidations(int index);
+  void set_invalidations(int index, const std::string& value);
+  void set_invalidations(int index, std::string&& value);
+  void set_invalidations(int index, const char* value);
+  void set_invalidations(int index, const char* value, size_t size);
+  std::string* add_invalidations();
+  void add_invalidations(const std::string& value);
+  void add_invalidations(std::string&& value);
+  void add_invalidations(const char* value);
+  void add_invalidations(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& invalidations() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_invalidations();
+  private:
+  const std::string& _internal_invalidations(int index) const;
+  std::string* _internal_add_invalidations();
+  public:
 
-  // optional string leader_id = 2;
+  // string leader_id = 2;
   void clear_leader_id();
-  static const int kLeaderIdFieldNumber = 2;
-  const ::std::string& leader_id() const;
-  void set_leader_id(const ::std::string& value);
-  void set_leader_id(const char* value);
-  void set_leader_id(const char* value, size_t size);
-  ::std::string* mutable_leader_id();
-  ::std::string* release_leader_id();
-  void set_allocated_leader_id(::std::string* leader_id);
+  const std::string& leader_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_leader_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_leader_id();
+  PROTOBUF_NODISCARD std::string* release_leader_id();
+  void set_allocated_leader_id(std::string* leader_id);
+  private:
+  const std::string& _internal_leader_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_leader_id(const std::string& value);
+  std::string* _internal_mutable_leader_id();
+  public:
 
-  // @@protoc_insertion_point(class_scope:mpr.chubby.LogoutResponse)
- private:
+  // int64 invalidation_seq = 4;
+  void clear_invalidation_seq();
+  int64_t invalidation_seq() const;
+  void set_invalidation_seq(int64_t value);
+  private:
+  int64_t _internal_invalidation_seq() const;
+  void _internal_set_invalidation_seq(int64_t value);
+  public:
+
+  // int64 cache_incarnation = 5;
+  void clear_cache_incarnation();
+  int64_t cache_incarnation() const;
+  void set_cache_incarnation(int64_t value);
+  private:
+  int64_t _internal_cache_incarnation() const;
+  void _internal_set_cache_incarnation(int64_t value);
+  public:
+
+  // bool success = 1;
+  void clear_success();
+  bool success() const;
+  void set_success(bool value);
+  private:
+  bool _internal_success() const;
+  void _internal_set_success(bool value);
+  public:
 
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  bool _is_default_instance_;
-  ::mpr::chubby::Status* status_;
-  ::google::protobuf::internal::ArenaStringPtr leader_id_;
-  mutable int _cached_size_;
-  friend void  protobuf_AddDesc_service_2eproto();
-  friend void protobuf_AssignDesc_service_2eproto();
-  friend void protobuf_ShutdownFile_service_2eproto();
-
-  void InitAsDefaultInstance();
-  static LogoutResponse* default_instance_;
+  // @@protoc_insertion_point(class_scope:mpr.chubby.KeepAliveResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> invalidations_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr leader_id_;
+    int64_t invalidation_seq_;
+    int64_t cache_incarnation_;
+    bool success_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_service_2eproto;
 };
 // -------------------------------------------------------------------
 
-class RegisterRequest : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:mpr.chubby.RegisterRequest) */ {
+class KeepAliveBatchRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mpr.chubby.KeepAliveBatchRequest) */ {
  public:
-  RegisterRequest();
-  virtual ~RegisterRequest();
-
-  RegisterRequest(const RegisterRequest& from);
+  inline KeepAliveBatchRequest() : KeepAliveBatchRequest(nullptr) {}
+  ~KeepAliveBatchRequest() override;
+  explicit PROTOBUF_CONSTEXPR KeepAliveBatchRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  KeepAliveBatchRequest(const KeepAliveBatchRequest& from);
+  KeepAliveBatchRequest(KeepAliveBatchRequest&& from) noexcept
+    : KeepAliveBatchRequest() {
+    *this = ::std::move(from);
+  }
 
-  inline RegisterRequest& operator=(const RegisterRequest& from) {
+  inline KeepAliveBatchRequest& operator=(const KeepAliveBatchRequest& from) {
     CopyFrom(from);
     return *this;
   }
+  inline KeepAliveBatchRequest& operator=(KeepAliveBatchRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const RegisterRequest& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const KeepAliveBatchRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const KeepAliveBatchRequest* internal_default_instance() {
+    return reinterpret_cast<const KeepAliveBatchRequest*>(
+               &_KeepAliveBatchRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    29;
 
-  void Swap(RegisterRequest* other);
+  friend void swap(KeepAliveBatchRequest& a, KeepAliveBatchRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(KeepAliveBatchRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(KeepAliveBatchRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline RegisterRequest* New() const { return New(NULL); }
+  KeepAliveBatchRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<KeepAliveBatchRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const KeepAliveBatchRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const KeepAliveBatchRequest& from) {
+    KeepAliveBatchRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-  RegisterRequest* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const RegisterRequest& from);
-  void MergeFrom(const RegisterRequest& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
-  void InternalSwap(RegisterRequest* other);
+  void SetCachedSize(int size) const final;
+  void InternalSwap(KeepAliveBatchRequest* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mpr.chubby.KeepAliveBatchRequest";
   }
+  protected:
+  explicit KeepAliveBatchRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // optional string username = 1;
-  void clear_username();
-  static const int kUsernameFieldNumber = 1;
-  const ::std::string& username() const;
-  void set_username(const ::std::string& value);
-  void set_username(const char* value);
-  void set_username(const char* value, size_t size);
-  ::std::string* mutable_username();
-  ::std::string* release_username();
-  void set_allocated_username(::std::string* username);
-
-  // optional string passwd = 2;
-  void clear_passwd();
-  static const int kPasswdFieldNumber = 2;
-  const ::std::string& passwd() const;
-  void set_passwd(const ::std::string& value);
-  void set_passwd(const char* value);
-  void set_passwd(const char* value, size_t size);
-  ::std::string* mutable_passwd();
-  ::std::string* release_passwd();
-  void set_allocated_passwd(::std::string* passwd);
+  enum : int {
+    kSessionsFieldNumber = 2,
+    kForwarderIdFieldNumber = 1,
+  };
+  // repeated .mpr.chubby.KeepAliveRequest sessions = 2;
+  int sessions_size() const;
+  private:
+  int _internal_sessions_size() const;
+  public:
+  void clear_sessions();
+  ::mpr::chubby::KeepAliveRequest* mutable_sessions(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::mpr::chubby::KeepAliveRequest >*
+      mutable_sessions();
+  private:
+  const ::mpr::chubby::KeepAliveRequest& _internal_sessions(int index) const;
+  ::mpr::chubby::KeepAliveRequest* _internal_add_sessions();
+  public:
+  const ::mpr::chubby::KeepAliveRequest& sessions(int index) const;
+  ::mpr::chubby::KeepAliveRequest* add_sessions();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::mpr::chubby::KeepAliveRequest >&
+      sessions() const;
+
+  // string forwarder_id = 1;
+  void clear_forwarder_id();
+  const std::string& forwarder_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_forwarder_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_forwarder_id();
+  PROTOBUF_NODISCARD std::string* release_forwarder_id();
+  void set_allocated_forwarder_id(std::string* forwarder_id);
+  private:
+  const std::string& _internal_forwarder_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_forwarder_id(const std::string& value);
+  std::string* _internal_mutable_forwarder_id();
+  public:
 
-  // @@protoc_insertion_point(class_scope:mpr.chubby.RegisterRequest)
+  // @@protoc_insertion_point(class_scope:mpr.chubby.KeepAliveBatchRequest)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  bool _is_default_instance_;
-  ::google::protobuf::internal::ArenaStringPtr username_;
-  ::google::protobuf::internal::ArenaStringPtr passwd_;
-  mutable int _cached_size_;
-  friend void  protobuf_AddDesc_service_2eproto();
-  friend void protobuf_AssignDesc_service_2eproto();
-  friend void protobuf_ShutdownFile_service_2eproto();
-
-  void InitAsDefaultInstance();
-  static RegisterRequest* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::mpr::chubby::KeepAliveRequest > sessions_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr forwarder_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_service_2eproto;
 };
 // -------------------------------------------------------------------
 
-class RegisterResponse : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:mpr.chubby.RegisterResponse) */ {
+class KeepAliveBatchResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mpr.chubby.KeepAliveBatchResponse) */ {
  public:
-  RegisterResponse();
-  virtual ~RegisterResponse();
-
-  RegisterResponse(const RegisterResponse& from);
+  inline KeepAliveBatchResponse() : KeepAliveBatchResponse(nullptr) {}
+  ~KeepAliveBatchResponse() override;
+  explicit PROTOBUF_CONSTEXPR KeepAliveBatchResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  KeepAliveBatchResponse(const KeepAliveBatchResponse& from);
+  KeepAliveBatchResponse(KeepAliveBatchResponse&& from) noexcept
+    : KeepAliveBatchResponse() {
+    *this = ::std::move(from);
+  }
 
-  inline RegisterResponse& operator=(const RegisterResponse& from) {
+  inline KeepAliveBatchResponse& operator=(const KeepAliveBatchResponse& from) {
     CopyFrom(from);
     return *this;
   }
+  inline KeepAliveBatchResponse& operator=(KeepAliveBatchResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const RegisterResponse& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const KeepAliveBatchResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const KeepAliveBatchResponse* internal_default_instance() {
+    return reinterpret_cast<const KeepAliveBatchResponse*>(
+               &_KeepAliveBatchResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    30;
 
-  void Swap(RegisterResponse* other);
+  friend void swap(KeepAliveBatchResponse& a, KeepAliveBatchResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(KeepAliveBatchResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(KeepAliveBatchResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline RegisterResponse* New() const { return New(NULL); }
+  KeepAliveBatchResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<KeepAliveBatchResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const KeepAliveBatchResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const KeepAliveBatchResponse& from) {
+    KeepAliveBatchResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-  RegisterResponse* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const RegisterResponse& from);
-  void MergeFrom(const RegisterResponse& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
-  void InternalSwap(RegisterResponse* other);
+  void SetCachedSize(int size) const final;
+  void InternalSwap(KeepAliveBatchResponse* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mpr.chubby.KeepAliveBatchResponse";
   }
+  protected:
+  explicit KeepAliveBatchResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // optional .mpr.chubby.Status status = 1;
-  bool has_status() const;
-  void clear_status();
-  static const int kStatusFieldNumber = 1;
-  const ::mpr::chubby::Status& status() const;
-  ::mpr::chubby::Status* mutable_status();
-  ::mpr::chubby::Status* release_status();
-  void set_allocated_status(::mpr::chubby::Status* status);
+  enum : int {
+    kResponsesFieldNumber = 4,
+    kLeaderIdFieldNumber = 2,
+    kSuccessFieldNumber = 1,
+    kRenewedFieldNumber = 3,
+  };
+  // repeated .mpr.chubby.KeepAliveResponse responses = 4;
+  int responses_size() const;
+  private:
+  int _internal_responses_size() const;
+  public:
+  void clear_responses();
+  ::mpr::chubby::KeepAliveResponse* mutable_responses(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::mpr::chubby::KeepAliveResponse >*
+      mutable_responses();
+  private:
+  const ::mpr::chubby::KeepAliveResponse& _internal_responses(int index) const;
+  ::mpr::chubby::KeepAliveResponse* _internal_add_responses();
+  public:
+  const ::mpr::chubby::KeepAliveResponse& responses(int index) const;
+  ::mpr::chubby::KeepAliveResponse* add_responses();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::mpr::chubby::KeepAliveResponse >&
+      responses() const;
 
-  // optional string leader_id = 2;
+  // string leader_id = 2;
   void clear_leader_id();
-  static const int kLeaderIdFieldNumber = 2;
-  const ::std::string& leader_id() const;
-  void set_leader_id(const ::std::string& value);
-  void set_leader_id(const char* value);
-  void set_leader_id(const char* value, size_t size);
-  ::std::string* mutable_leader_id();
-  ::std::string* release_leader_id();
-  void set_allocated_leader_id(::std::string* leader_id);
+  const std::string& leader_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_leader_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_leader_id();
+  PROTOBUF_NODISCARD std::string* release_leader_id();
+  void set_allocated_leader_id(std::string* leader_id);
+  private:
+  const std::string& _internal_leader_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_leader_id(const std::string& value);
+  std::string* _internal_mutable_leader_id();
+  public:
 
-  // @@protoc_insertion_point(class_scope:mpr.chubby.RegisterResponse)
- private:
+  // bool success = 1;
+  void clear_success();
+  bool success() const;
+  void set_success(bool value);
+  private:
+  bool _internal_success() const;
+  void _internal_set_success(bool value);
+  public:
+
+  // int32 renewed = 3;
+  void clear_renewed();
+  int32_t renewed() const;
+  void set_renewed(int32_t value);
+  private:
+  int32_t _internal_renewed() const;
+  void _internal_set_renewed(int32_t value);
+  public:
 
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  bool _is_default_instance_;
-  ::mpr::chubby::Status* status_;
-  ::google::protobuf::internal::ArenaStringPtr leader_id_;
-  mutable int _cached_size_;
-  friend void  protobuf_AddDesc_service_2eproto();
-  friend void protobuf_AssignDesc_service_2eproto();
-  friend void protobuf_ShutdownFile_service_2eproto();
-
-  void InitAsDefaultInstance();
-  static RegisterResponse* default_instance_;
+  // @@protoc_insertion_point(class_scope:mpr.chubby.KeepAliveBatchResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::mpr::chubby::KeepAliveResponse > responses_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr leader_id_;
+    bool success_;
+    int32_t renewed_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_service_2eproto;
 };
 // -------------------------------------------------------------------
 
-class CleanBinlogRequest : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:mpr.chubby.CleanBinlogRequest) */ {
+class WatchEvent final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mpr.chubby.WatchEvent) */ {
  public:
-  CleanBinlogRequest();
-  virtual ~CleanBinlogRequest();
-
-  CleanBinlogRequest(const CleanBinlogRequest& from);
+  inline WatchEvent() : WatchEvent(nullptr) {}
+  ~WatchEvent() override;
+  explicit PROTOBUF_CONSTEXPR WatchEvent(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  WatchEvent(const WatchEvent& from);
+  WatchEvent(WatchEvent&& from) noexcept
+    : WatchEvent() {
+    *this = ::std::move(from);
+  }
 
-  inline CleanBinlogRequest& operator=(const CleanBinlogRequest& from) {
+  inline WatchEvent& operator=(const WatchEvent& from) {
     CopyFrom(from);
     return *this;
   }
+  inline WatchEvent& operator=(WatchEvent&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const CleanBinlogRequest& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const WatchEvent& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const WatchEvent* internal_default_instance() {
+    return reinterpret_cast<const WatchEvent*>(
+               &_WatchEvent_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    31;
 
-  void Swap(CleanBinlogRequest* other);
+  friend void swap(WatchEvent& a, WatchEvent& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(WatchEvent* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(WatchEvent* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline CleanBinlogRequest* New() const { return New(NULL); }
+  WatchEvent* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<WatchEvent>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const WatchEvent& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const WatchEvent& from) {
+    WatchEvent::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-  CleanBinlogRequest* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const CleanBinlogRequest& from);
-  void MergeFrom(const CleanBinlogRequest& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
-  void InternalSwap(CleanBinlogRequest* other);
+  void SetCachedSize(int size) const final;
+  void InternalSwap(WatchEvent* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mpr.chubby.WatchEvent";
   }
+  protected:
+  explicit WatchEvent(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // optional int64 end_index = 1;
-  void clear_end_index();
-  static const int kEndIndexFieldNumber = 1;
-  ::google::protobuf::int64 end_index() const;
-  void set_end_index(::google::protobuf::int64 value);
+  enum : int {
+    kKeyFieldNumber = 1,
+    kValueFieldNumber = 3,
+    kIndexFieldNumber = 4,
+    kOpFieldNumber = 2,
+  };
+  // string key = 1;
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
 
-  // @@protoc_insertion_point(class_scope:mpr.chubby.CleanBinlogRequest)
- private:
+  // bytes value = 3;
+  void clear_value();
+  const std::string& value() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_value();
+  PROTOBUF_NODISCARD std::string* release_value();
+  void set_allocated_value(std::string* value);
+  private:
+  const std::string& _internal_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
+  std::string* _internal_mutable_value();
+  public:
 
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  bool _is_default_instance_;
-  ::google::protobuf::int64 end_index_;
-  mutable int _cached_size_;
-  friend void  protobuf_AddDesc_service_2eproto();
-  friend void protobuf_AssignDesc_service_2eproto();
-  friend void protobuf_ShutdownFile_service_2eproto();
+  // int64 index = 4;
+  void clear_index();
+  int64_t index() const;
+  void set_index(int64_t value);
+  private:
+  int64_t _internal_index() const;
+  void _internal_set_index(int64_t value);
+  public:
+
+  // .mpr.chubby.LogOperation op = 2;
+  void clear_op();
+  ::mpr::chubby::LogOperation op() const;
+  void set_op(::mpr::chubby::LogOperation value);
+  private:
+  ::mpr::chubby::LogOperation _internal_op() const;
+  void _internal_set_op(::mpr::chubby::LogOperation value);
+  public:
 
-  void InitAsDefaultInstance();
-  static CleanBinlogRequest* default_instance_;
+  // @@protoc_insertion_point(class_scope:mpr.chubby.WatchEvent)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    int64_t index_;
+    int op_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_service_2eproto;
 };
 // -------------------------------------------------------------------
 
-class CleanBinlogResponse : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:mpr.chubby.CleanBinlogResponse) */ {
+class WatchRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mpr.chubby.WatchRequest) */ {
  public:
-  CleanBinlogResponse();
-  virtual ~CleanBinlogResponse();
-
-  CleanBinlogResponse(const CleanBinlogResponse& from);
+  inline WatchRequest() : WatchRequest(nullptr) {}
+  ~WatchRequest() override;
+  explicit PROTOBUF_CONSTEXPR WatchRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  WatchRequest(const WatchRequest& from);
+  WatchRequest(WatchRequest&& from) noexcept
+    : WatchRequest() {
+    *this = ::std::move(from);
+  }
 
-  inline CleanBinlogResponse& operator=(const CleanBinlogResponse& from) {
+  inline WatchRequest& operator=(const WatchRequest& from) {
     CopyFrom(from);
     return *this;
   }
+  inline WatchRequest& operator=(WatchRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const CleanBinlogResponse& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const WatchRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const WatchRequest* internal_default_instance() {
+    return reinterpret_cast<const WatchRequest*>(
+               &_WatchRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    32;
 
-  void Swap(CleanBinlogResponse* other);
+  friend void swap(WatchRequest& a, WatchRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(WatchRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(WatchRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline CleanBinlogResponse* New() const { return New(NULL); }
+  WatchRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<WatchRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const WatchRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const WatchRequest& from) {
+    WatchRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-  CleanBinlogResponse* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const CleanBinlogResponse& from);
-  void MergeFrom(const CleanBinlogResponse& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
-  void InternalSwap(CleanBinlogResponse* other);
+  void SetCachedSize(int size) const final;
+  void InternalSwap(WatchRequest* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mpr.chubby.WatchRequest";
   }
+  protected:
+  explicit WatchRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // optional bool success = 1;
-  void clear_success();
-  static const int kSuccessFieldNumber = 1;
-  bool success() const;
-  void set_success(bool value);
+  enum : int {
+    kKeyFieldNumber = 1,
+    kUuidFieldNumber = 3,
+    kSessionIdFieldNumber = 4,
+    kPrefixFieldNumber = 2,
+    kTimeoutMsFieldNumber = 7,
+    kWatchIdFieldNumber = 5,
+    kStartIndexFieldNumber = 6,
+  };
+  // string key = 1;
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
 
-  // @@protoc_insertion_point(class_scope:mpr.chubby.CleanBinlogResponse)
+  // string uuid = 3;
+  void clear_uuid();
+  const std::string& uuid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_uuid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_uuid();
+  PROTOBUF_NODISCARD std::string* release_uuid();
+  void set_allocated_uuid(std::string* uuid);
+  private:
+  const std::string& _internal_uuid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_uuid(const std::string& value);
+  std::string* _internal_mutable_uuid();
+  public:
+
+  // string session_id = 4;
+  void clear_session_id();
+  const std::string& session_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_session_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_session_id();
+  PROTOBUF_NODISCARD std::string* release_session_id();
+  void set_allocated_session_id(std::string* session_id);
+  private:
+  const std::string& _internal_session_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_session_id(const std::string& value);
+  std::string* _internal_mutable_session_id();
+  public:
+
+  // bool prefix = 2;
+  void clear_prefix();
+  bool prefix() const;
+  void set_prefix(bool value);
+  private:
+  bool _internal_prefix() const;
+  void _internal_set_prefix(bool value);
+  public:
+
+  // int32 timeout_ms = 7;
+  void clear_timeout_ms();
+  int32_t timeout_ms() const;
+  void set_timeout_ms(int32_t value);
+  private:
+  int32_t _internal_timeout_ms() const;
+  void _internal_set_timeout_ms(int32_t value);
+  public:
+
+  // int64 watch_id = 5;
+  void clear_watch_id();
+  int64_t watch_id() const;
+  void set_watch_id(int64_t value);
+  private:
+  int64_t _internal_watch_id() const;
+  void _internal_set_watch_id(int64_t value);
+  public:
+
+  // int64 start_index = 6;
+  void clear_start_index();
+  int64_t start_index() const;
+  void set_start_index(int64_t value);
+  private:
+  int64_t _internal_start_index() const;
+  void _internal_set_start_index(int64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:mpr.chubby.WatchRequest)
  private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr uuid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr session_id_;
+    bool prefix_;
+    int32_t timeout_ms_;
+    int64_t watch_id_;
+    int64_t start_index_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_service_2eproto;
+};
+// -------------------------------------------------------------------
+
+class WatchResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mpr.chubby.WatchResponse) */ {
+ public:
+  inline WatchResponse() : WatchResponse(nullptr) {}
+  ~WatchResponse() override;
+  explicit PROTOBUF_CONSTEXPR WatchResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  WatchResponse(const WatchResponse& from);
+  WatchResponse(WatchResponse&& from) noexcept
+    : WatchResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline WatchResponse& operator=(const WatchResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline WatchResponse& operator=(WatchResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const WatchResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const WatchResponse* internal_default_instance() {
+    return reinterpret_cast<const WatchResponse*>(
+               &_WatchResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    33;
+
+  friend void swap(WatchResponse& a, WatchResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(WatchResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(WatchResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  WatchResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<WatchResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const WatchResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const WatchResponse& from) {
+    WatchResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(WatchResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mpr.chubby.WatchResponse";
+  }
+  protected:
+  explicit WatchResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kEventsFieldNumber = 5,
+    kLeaderIdFieldNumber = 2,
+    kWatchIdFieldNumber = 4,
+    kLastIndexFieldNumber = 7,
+    kSuccessFieldNumber = 1,
+    kUuidExpiredFieldNumber = 3,
+    kOverflowFieldNumber = 6,
+    kCompactedFieldNumber = 8,
+  };
+  // repeated .mpr.chubby.WatchEvent events = 5;
+  int events_size() const;
+  private:
+  int _internal_events_size() const;
+  public:
+  void clear_events();
+  ::mpr::chubby::WatchEvent* mutable_events(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::mpr::chubby::WatchEvent >*
+      mutable_events();
+  private:
+  const ::mpr::chubby::WatchEvent& _internal_events(int index) const;
+  ::mpr::chubby::WatchEvent* _internal_add_events();
+  public:
+  const ::mpr::chubby::WatchEvent& events(int index) const;
+  ::mpr::chubby::WatchEvent* add_events();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::mpr::chubby::WatchEvent >&
+      events() const;
+
+  // string leader_id = 2;
+  void clear_leader_id();
+  const std::string& leader_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_leader_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_leader_id();
+  PROTOBUF_NODISCARD std::string* release_leader_id();
+  void set_allocated_leader_id(std::string* leader_id);
+  private:
+  const std::string& _internal_leader_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_leader_id(const std::string& value);
+  std::string* _internal_mutable_leader_id();
+  public:
+
+  // int64 watch_id = 4;
+  void clear_watch_id();
+  int64_t watch_id() const;
+  void set_watch_id(int64_t value);
+  private:
+  int64_t _internal_watch_id() const;
+  void _internal_set_watch_id(int64_t value);
+  public:
+
+  // int64 last_index = 7;
+  void clear_last_index();
+  int64_t last_index() const;
+  void set_last_index(int64_t value);
+  private:
+  int64_t _internal_last_index() const;
+  void _internal_set_last_index(int64_t value);
+  public:
+
+  // bool success = 1;
+  void clear_success();
+  bool success() const;
+  void set_success(bool value);
+  private:
+  bool _internal_success() const;
+  void _internal_set_success(bool value);
+  public:
+
+  // bool uuid_expired = 3;
+  void clear_uuid_expired();
+  bool uuid_expired() const;
+  void set_uuid_expired(bool value);
+  private:
+  bool _internal_uuid_expired() const;
+  void _internal_set_uuid_expired(bool value);
+  public:
+
+  // bool overflow = 6;
+  void clear_overflow();
+  bool overflow() const;
+  void set_overflow(bool value);
+  private:
+  bool _internal_overflow() const;
+  void _internal_set_overflow(bool value);
+  public:
 
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  bool _is_default_instance_;
-  bool success_;
-  mutable int _cached_size_;
-  friend void  protobuf_AddDesc_service_2eproto();
-  friend void protobuf_AssignDesc_service_2eproto();
-  friend void protobuf_ShutdownFile_service_2eproto();
+  // bool compacted = 8;
+  void clear_compacted();
+  bool compacted() const;
+  void set_compacted(bool value);
+  private:
+  bool _internal_compacted() const;
+  void _internal_set_compacted(bool value);
+  public:
 
-  void InitAsDefaultInstance();
-  static CleanBinlogResponse* default_instance_;
+  // @@protoc_insertion_point(class_scope:mpr.chubby.WatchResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::mpr::chubby::WatchEvent > events_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr leader_id_;
+    int64_t watch_id_;
+    int64_t last_index_;
+    bool success_;
+    bool uuid_expired_;
+    bool overflow_;
+    bool compacted_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_service_2eproto;
 };
 // -------------------------------------------------------------------
 
-class RpcStatRequest : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:mpr.chubby.RpcStatRequest) */ {
+class LoginRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mpr.chubby.LoginRequest) */ {
  public:
-  RpcStatRequest();
-  virtual ~RpcStatRequest();
+  inline LoginRequest() : LoginRequest(nullptr) {}
+  ~LoginRequest() override;
+  explicit PROTOBUF_CONSTEXPR LoginRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  RpcStatRequest(const RpcStatRequest& from);
+  LoginRequest(const LoginRequest& from);
+  LoginRequest(LoginRequest&& from) noexcept
+    : LoginRequest() {
+    *this = ::std::move(from);
+  }
 
-  inline RpcStatRequest& operator=(const RpcStatRequest& from) {
+  inline LoginRequest& operator=(const LoginRequest& from) {
     CopyFrom(from);
     return *this;
   }
+  inline LoginRequest& operator=(LoginRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const RpcStatRequest& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LoginRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const LoginRequest* internal_default_instance() {
+    return reinterpret_cast<const LoginRequest*>(
+               &_LoginRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    34;
 
-  void Swap(RpcStatRequest* other);
+  friend void swap(LoginRequest& a, LoginRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(LoginRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LoginRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline RpcStatRequest* New() const { return New(NULL); }
+  LoginRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<LoginRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const LoginRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LoginRequest& from) {
+    LoginRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-  RpcStatRequest* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const RpcStatRequest& from);
-  void MergeFrom(const RpcStatRequest& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
-  void InternalSwap(RpcStatRequest* other);
+  void SetCachedSize(int size) const final;
+  void InternalSwap(LoginRequest* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mpr.chubby.LoginRequest";
   }
+  protected:
+  explicit LoginRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // repeated .mpr.chubby.StatOperation op = 1;
-  int op_size() const;
-  void clear_op();
-  static const int kOpFieldNumber = 1;
-  ::mpr::chubby::StatOperation op(int index) const;
-  void set_op(int index, ::mpr::chubby::StatOperation value);
-  void add_op(::mpr::chubby::StatOperation value);
-  const ::google::protobuf::RepeatedField<int>& op() const;
-  ::google::protobuf::RepeatedField<int>* mutable_op();
+  enum : int {
+    kUsernameFieldNumber = 1,
+    kPasswdFieldNumber = 2,
+  };
+  // string username = 1;
+  void clear_username();
+  const std::string& username() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_username(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_username();
+  PROTOBUF_NODISCARD std::string* release_username();
+  void set_allocated_username(std::string* username);
+  private:
+  const std::string& _internal_username() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_username(const std::string& value);
+  std::string* _internal_mutable_username();
+  public:
 
-  // @@protoc_insertion_point(class_scope:mpr.chubby.RpcStatRequest)
- private:
+  // string passwd = 2;
+  void clear_passwd();
+  const std::string& passwd() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_passwd(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_passwd();
+  PROTOBUF_NODISCARD std::string* release_passwd();
+  void set_allocated_passwd(std::string* passwd);
+  private:
+  const std::string& _internal_passwd() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_passwd(const std::string& value);
+  std::string* _internal_mutable_passwd();
+  public:
 
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  bool _is_default_instance_;
-  ::google::protobuf::RepeatedField<int> op_;
-  mutable int _op_cached_byte_size_;
-  mutable int _cached_size_;
-  friend void  protobuf_AddDesc_service_2eproto();
-  friend void protobuf_AssignDesc_service_2eproto();
-  friend void protobuf_ShutdownFile_service_2eproto();
-
-  void InitAsDefaultInstance();
-  static RpcStatRequest* default_instance_;
+  // @@protoc_insertion_point(class_scope:mpr.chubby.LoginRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr username_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr passwd_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_service_2eproto;
 };
 // -------------------------------------------------------------------
 
-class RpcStatResponse : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:mpr.chubby.RpcStatResponse) */ {
+class Status final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mpr.chubby.Status) */ {
  public:
-  RpcStatResponse();
-  virtual ~RpcStatResponse();
+  inline Status() : Status(nullptr) {}
+  ~Status() override;
+  explicit PROTOBUF_CONSTEXPR Status(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  RpcStatResponse(const RpcStatResponse& from);
+  Status(const Status& from);
+  Status(Status&& from) noexcept
+    : Status() {
+    *this = ::std::move(from);
+  }
 
-  inline RpcStatResponse& operator=(const RpcStatResponse& from) {
+  inline Status& operator=(const Status& from) {
     CopyFrom(from);
     return *this;
   }
+  inline Status& operator=(Status&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const RpcStatResponse& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Status& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Status* internal_default_instance() {
+    return reinterpret_cast<const Status*>(
+               &_Status_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    35;
 
-  void Swap(RpcStatResponse* other);
+  friend void swap(Status& a, Status& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Status* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Status* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline RpcStatResponse* New() const { return New(NULL); }
+  Status* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Status>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Status& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Status& from) {
+    Status::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-  RpcStatResponse* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const RpcStatResponse& from);
-  void MergeFrom(const RpcStatResponse& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
-  void InternalSwap(RpcStatResponse* other);
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Status* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mpr.chubby.Status";
   }
+  protected:
+  explicit Status(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // optional .mpr.chubby.NodeStatus status = 1;
-  void clear_status();
-  static const int kStatusFieldNumber = 1;
-  ::mpr::chubby::NodeStatus status() const;
-  void set_status(::mpr::chubby::NodeStatus value);
+  enum : int {
+    kMessageFieldNumber = 2,
+    kCodeFieldNumber = 1,
+  };
+  // string message = 2;
+  void clear_message();
+  const std::string& message() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_message(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_message();
+  PROTOBUF_NODISCARD std::string* release_message();
+  void set_allocated_message(std::string* message);
+  private:
+  const std::string& _internal_message() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_message(const std::string& value);
+  std::string* _internal_mutable_message();
+  public:
 
-  // repeated .mpr.chubby.StatInfo stats = 2;
-  int stats_size() const;
-  void clear_stats();
-  static const int kStatsFieldNumber = 2;
-  const ::mpr::chubby::StatInfo& stats(int index) const;
-  ::mpr::chubby::StatInfo* mutable_stats(int index);
-  ::mpr::chubby::StatInfo* add_stats();
-  ::google::protobuf::RepeatedPtrField< ::mpr::chubby::StatInfo >*
-      mutable_stats();
-  const ::google::protobuf::RepeatedPtrField< ::mpr::chubby::StatInfo >&
-      stats() const;
+  // int64 code = 1;
+  void clear_code();
+  int64_t code() const;
+  void set_code(int64_t value);
+  private:
+  int64_t _internal_code() const;
+  void _internal_set_code(int64_t value);
+  public:
 
-  // @@protoc_insertion_point(class_scope:mpr.chubby.RpcStatResponse)
+  // @@protoc_insertion_point(class_scope:mpr.chubby.Status)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  bool _is_default_instance_;
-  ::google::protobuf::RepeatedPtrField< ::mpr::chubby::StatInfo > stats_;
-  int status_;
-  mutable int _cached_size_;
-  friend void  protobuf_AddDesc_service_2eproto();
-  friend void protobuf_AssignDesc_service_2eproto();
-  friend void protobuf_ShutdownFile_service_2eproto();
-
-  void InitAsDefaultInstance();
-  static RpcStatResponse* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr message_;
+    int64_t code_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_service_2eproto;
 };
-// ===================================================================
+// -------------------------------------------------------------------
 
+class LoginResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mpr.chubby.LoginResponse) */ {
+ public:
+  inline LoginResponse() : LoginResponse(nullptr) {}
+  ~LoginResponse() override;
+  explicit PROTOBUF_CONSTEXPR LoginResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-// ===================================================================
+  LoginResponse(const LoginResponse& from);
+  LoginResponse(LoginResponse&& from) noexcept
+    : LoginResponse() {
+    *this = ::std::move(from);
+  }
 
-#if !PROTOBUF_INLINE_NOT_IN_HEADERS
-// UserInfo
+  inline LoginResponse& operator=(const LoginResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline LoginResponse& operator=(LoginResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LoginResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const LoginResponse* internal_default_instance() {
+    return reinterpret_cast<const LoginResponse*>(
+               &_LoginResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    36;
+
+  friend void swap(LoginResponse& a, LoginResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(LoginResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LoginResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  LoginResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<LoginResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const LoginResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LoginResponse& from) {
+    LoginResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(LoginResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mpr.chubby.LoginResponse";
+  }
+  protected:
+  explicit LoginResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kUuidFieldNumber = 2,
+    kLeaderIdFieldNumber = 3,
+    kStatusFieldNumber = 1,
+  };
+  // string uuid = 2;
+  void clear_uuid();
+  const std::string& uuid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_uuid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_uuid();
+  PROTOBUF_NODISCARD std::string* release_uuid();
+  void set_allocated_uuid(std::string* uuid);
+  private:
+  const std::string& _internal_uuid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_uuid(const std::string& value);
+  std::string* _internal_mutable_uuid();
+  public:
+
+  // string leader_id = 3;
+  void clear_leader_id();
+  const std::string& leader_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_leader_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_leader_id();
+  PROTOBUF_NODISCARD std::string* release_leader_id();
+  void set_allocated_leader_id(std::string* leader_id);
+  private:
+  const std::string& _internal_leader_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_leader_id(const std::string& value);
+  std::string* _internal_mutable_leader_id();
+  public:
+
+  // .mpr.chubby.Status status = 1;
+  bool has_status() const;
+  private:
+  bool _internal_has_status() const;
+  public:
+  void clear_status();
+  const ::mpr::chubby::Status& status() const;
+  PROTOBUF_NODISCARD ::mpr::chubby::Status* release_status();
+  ::mpr::chubby::Status* mutable_status();
+  void set_allocated_status(::mpr::chubby::Status* status);
+  private:
+  const ::mpr::chubby::Status& _internal_status() const;
+  ::mpr::chubby::Status* _internal_mutable_status();
+  public:
+  void unsafe_arena_set_allocated_status(
+      ::mpr::chubby::Status* status);
+  ::mpr::chubby::Status* unsafe_arena_release_status();
+
+  // @@protoc_insertion_point(class_scope:mpr.chubby.LoginResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr uuid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr leader_id_;
+    ::mpr::chubby::Status* status_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_service_2eproto;
+};
+// -------------------------------------------------------------------
+
+class LogoutRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mpr.chubby.LogoutRequest) */ {
+ public:
+  inline LogoutRequest() : LogoutRequest(nullptr) {}
+  ~LogoutRequest() override;
+  explicit PROTOBUF_CONSTEXPR LogoutRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  LogoutRequest(const LogoutRequest& from);
+  LogoutRequest(LogoutRequest&& from) noexcept
+    : LogoutRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline LogoutRequest& operator=(const LogoutRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline LogoutRequest& operator=(LogoutRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LogoutRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const LogoutRequest* internal_default_instance() {
+    return reinterpret_cast<const LogoutRequest*>(
+               &_LogoutRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    37;
+
+  friend void swap(LogoutRequest& a, LogoutRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(LogoutRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LogoutRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  LogoutRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<LogoutRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const LogoutRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LogoutRequest& from) {
+    LogoutRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(LogoutRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mpr.chubby.LogoutRequest";
+  }
+  protected:
+  explicit LogoutRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kUuidFieldNumber = 1,
+  };
+  // string uuid = 1;
+  void clear_uuid();
+  const std::string& uuid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_uuid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_uuid();
+  PROTOBUF_NODISCARD std::string* release_uuid();
+  void set_allocated_uuid(std::string* uuid);
+  private:
+  const std::string& _internal_uuid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_uuid(const std::string& value);
+  std::string* _internal_mutable_uuid();
+  public:
+
+  // @@protoc_insertion_point(class_scope:mpr.chubby.LogoutRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr uuid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_service_2eproto;
+};
+// -------------------------------------------------------------------
+
+class LogoutResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mpr.chubby.LogoutResponse) */ {
+ public:
+  inline LogoutResponse() : LogoutResponse(nullptr) {}
+  ~LogoutResponse() override;
+  explicit PROTOBUF_CONSTEXPR LogoutResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  LogoutResponse(const LogoutResponse& from);
+  LogoutResponse(LogoutResponse&& from) noexcept
+    : LogoutResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline LogoutResponse& operator=(const LogoutResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline LogoutResponse& operator=(LogoutResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LogoutResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const LogoutResponse* internal_default_instance() {
+    return reinterpret_cast<const LogoutResponse*>(
+               &_LogoutResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    38;
+
+  friend void swap(LogoutResponse& a, LogoutResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(LogoutResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LogoutResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  LogoutResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<LogoutResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const LogoutResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LogoutResponse& from) {
+    LogoutResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(LogoutResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mpr.chubby.LogoutResponse";
+  }
+  protected:
+  explicit LogoutResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kLeaderIdFieldNumber = 2,
+    kStatusFieldNumber = 1,
+  };
+  // string leader_id = 2;
+  void clear_leader_id();
+  const std::string& leader_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_leader_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_leader_id();
+  PROTOBUF_NODISCARD std::string* release_leader_id();
+  void set_allocated_leader_id(std::string* leader_id);
+  private:
+  const std::string& _internal_leader_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_leader_id(const std::string& value);
+  std::string* _internal_mutable_leader_id();
+  public:
+
+  // .mpr.chubby.Status status = 1;
+  bool has_status() const;
+  private:
+  bool _internal_has_status() const;
+  public:
+  void clear_status();
+  const ::mpr::chubby::Status& status() const;
+  PROTOBUF_NODISCARD ::mpr::chubby::Status* release_status();
+  ::mpr::chubby::Status* mutable_status();
+  void set_allocated_status(::mpr::chubby::Status* status);
+  private:
+  const ::mpr::chubby::Status& _internal_status() const;
+  ::mpr::chubby::Status* _internal_mutable_status();
+  public:
+  void unsafe_arena_set_allocated_status(
+      ::mpr::chubby::Status* status);
+  ::mpr::chubby::Status* unsafe_arena_release_status();
+
+  // @@protoc_insertion_point(class_scope:mpr.chubby.LogoutResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr leader_id_;
+    ::mpr::chubby::Status* status_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_service_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RegisterRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mpr.chubby.RegisterRequest) */ {
+ public:
+  inline RegisterRequest() : RegisterRequest(nullptr) {}
+  ~RegisterRequest() override;
+  explicit PROTOBUF_CONSTEXPR RegisterRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RegisterRequest(const RegisterRequest& from);
+  RegisterRequest(RegisterRequest&& from) noexcept
+    : RegisterRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline RegisterRequest& operator=(const RegisterRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RegisterRequest& operator=(RegisterRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RegisterRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RegisterRequest* internal_default_instance() {
+    return reinterpret_cast<const RegisterRequest*>(
+               &_RegisterRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    39;
+
+  friend void swap(RegisterRequest& a, RegisterRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RegisterRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RegisterRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RegisterRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RegisterRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RegisterRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RegisterRequest& from) {
+    RegisterRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RegisterRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mpr.chubby.RegisterRequest";
+  }
+  protected:
+  explicit RegisterRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kUsernameFieldNumber = 1,
+    kPasswdFieldNumber = 2,
+  };
+  // string username = 1;
+  void clear_username();
+  const std::string& username() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_username(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_username();
+  PROTOBUF_NODISCARD std::string* release_username();
+  void set_allocated_username(std::string* username);
+  private:
+  const std::string& _internal_username() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_username(const std::string& value);
+  std::string* _internal_mutable_username();
+  public:
+
+  // string passwd = 2;
+  void clear_passwd();
+  const std::string& passwd() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_passwd(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_passwd();
+  PROTOBUF_NODISCARD std::string* release_passwd();
+  void set_allocated_passwd(std::string* passwd);
+  private:
+  const std::string& _internal_passwd() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_passwd(const std::string& value);
+  std::string* _internal_mutable_passwd();
+  public:
+
+  // @@protoc_insertion_point(class_scope:mpr.chubby.RegisterRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr username_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr passwd_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_service_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RegisterResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mpr.chubby.RegisterResponse) */ {
+ public:
+  inline RegisterResponse() : RegisterResponse(nullptr) {}
+  ~RegisterResponse() override;
+  explicit PROTOBUF_CONSTEXPR RegisterResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RegisterResponse(const RegisterResponse& from);
+  RegisterResponse(RegisterResponse&& from) noexcept
+    : RegisterResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline RegisterResponse& operator=(const RegisterResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RegisterResponse& operator=(RegisterResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RegisterResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RegisterResponse* internal_default_instance() {
+    return reinterpret_cast<const RegisterResponse*>(
+               &_RegisterResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    40;
+
+  friend void swap(RegisterResponse& a, RegisterResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RegisterResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RegisterResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RegisterResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RegisterResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RegisterResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RegisterResponse& from) {
+    RegisterResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RegisterResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mpr.chubby.RegisterResponse";
+  }
+  protected:
+  explicit RegisterResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kLeaderIdFieldNumber = 2,
+    kStatusFieldNumber = 1,
+  };
+  // string leader_id = 2;
+  void clear_leader_id();
+  const std::string& leader_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_leader_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_leader_id();
+  PROTOBUF_NODISCARD std::string* release_leader_id();
+  void set_allocated_leader_id(std::string* leader_id);
+  private:
+  const std::string& _internal_leader_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_leader_id(const std::string& value);
+  std::string* _internal_mutable_leader_id();
+  public:
+
+  // .mpr.chubby.Status status = 1;
+  bool has_status() const;
+  private:
+  bool _internal_has_status() const;
+  public:
+  void clear_status();
+  const ::mpr::chubby::Status& status() const;
+  PROTOBUF_NODISCARD ::mpr::chubby::Status* release_status();
+  ::mpr::chubby::Status* mutable_status();
+  void set_allocated_status(::mpr::chubby::Status* status);
+  private:
+  const ::mpr::chubby::Status& _internal_status() const;
+  ::mpr::chubby::Status* _internal_mutable_status();
+  public:
+  void unsafe_arena_set_allocated_status(
+      ::mpr::chubby::Status* status);
+  ::mpr::chubby::Status* unsafe_arena_release_status();
+
+  // @@protoc_insertion_point(class_scope:mpr.chubby.RegisterResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr leader_id_;
+    ::mpr::chubby::Status* status_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_service_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CleanBinlogRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mpr.chubby.CleanBinlogRequest) */ {
+ public:
+  inline CleanBinlogRequest() : CleanBinlogRequest(nullptr) {}
+  ~CleanBinlogRequest() override;
+  explicit PROTOBUF_CONSTEXPR CleanBinlogRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CleanBinlogRequest(const CleanBinlogRequest& from);
+  CleanBinlogRequest(CleanBinlogRequest&& from) noexcept
+    : CleanBinlogRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline CleanBinlogRequest& operator=(const CleanBinlogRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CleanBinlogRequest& operator=(CleanBinlogRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CleanBinlogRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CleanBinlogRequest* internal_default_instance() {
+    return reinterpret_cast<const CleanBinlogRequest*>(
+               &_CleanBinlogRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    41;
+
+  friend void swap(CleanBinlogRequest& a, CleanBinlogRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CleanBinlogRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CleanBinlogRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CleanBinlogRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CleanBinlogRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CleanBinlogRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CleanBinlogRequest& from) {
+    CleanBinlogRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CleanBinlogRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mpr.chubby.CleanBinlogRequest";
+  }
+  protected:
+  explicit CleanBinlogRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kEndIndexFieldNumber = 1,
+  };
+  // int64 end_index = 1;
+  void clear_end_index();
+  int64_t end_index() const;
+  void set_end_index(int64_t value);
+  private:
+  int64_t _internal_end_index() const;
+  void _internal_set_end_index(int64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:mpr.chubby.CleanBinlogRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int64_t end_index_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_service_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CleanBinlogResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mpr.chubby.CleanBinlogResponse) */ {
+ public:
+  inline CleanBinlogResponse() : CleanBinlogResponse(nullptr) {}
+  ~CleanBinlogResponse() override;
+  explicit PROTOBUF_CONSTEXPR CleanBinlogResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CleanBinlogResponse(const CleanBinlogResponse& from);
+  CleanBinlogResponse(CleanBinlogResponse&& from) noexcept
+    : CleanBinlogResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline CleanBinlogResponse& operator=(const CleanBinlogResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CleanBinlogResponse& operator=(CleanBinlogResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CleanBinlogResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CleanBinlogResponse* internal_default_instance() {
+    return reinterpret_cast<const CleanBinlogResponse*>(
+               &_CleanBinlogResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    42;
+
+  friend void swap(CleanBinlogResponse& a, CleanBinlogResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CleanBinlogResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CleanBinlogResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CleanBinlogResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CleanBinlogResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CleanBinlogResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CleanBinlogResponse& from) {
+    CleanBinlogResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CleanBinlogResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mpr.chubby.CleanBinlogResponse";
+  }
+  protected:
+  explicit CleanBinlogResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSuccessFieldNumber = 1,
+  };
+  // bool success = 1;
+  void clear_success();
+  bool success() const;
+  void set_success(bool value);
+  private:
+  bool _internal_success() const;
+  void _internal_set_success(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:mpr.chubby.CleanBinlogResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    bool success_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_service_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RpcStatRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mpr.chubby.RpcStatRequest) */ {
+ public:
+  inline RpcStatRequest() : RpcStatRequest(nullptr) {}
+  ~RpcStatRequest() override;
+  explicit PROTOBUF_CONSTEXPR RpcStatRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RpcStatRequest(const RpcStatRequest& from);
+  RpcStatRequest(RpcStatRequest&& from) noexcept
+    : RpcStatRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline RpcStatRequest& operator=(const RpcStatRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RpcStatRequest& operator=(RpcStatRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RpcStatRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RpcStatRequest* internal_default_instance() {
+    return reinterpret_cast<const RpcStatRequest*>(
+               &_RpcStatRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    43;
+
+  friend void swap(RpcStatRequest& a, RpcStatRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RpcStatRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RpcStatRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RpcStatRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RpcStatRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RpcStatRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RpcStatRequest& from) {
+    RpcStatRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RpcStatRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mpr.chubby.RpcStatRequest";
+  }
+  protected:
+  explicit RpcStatRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kOpFieldNumber = 1,
+  };
+  // repeated .mpr.chubby.StatOperation op = 1;
+  int op_size() const;
+  private:
+  int _internal_op_size() const;
+  public:
+  void clear_op();
+  private:
+  ::mpr::chubby::StatOperation _internal_op(int index) const;
+  void _internal_add_op(::mpr::chubby::StatOperation value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>* _internal_mutable_op();
+  public:
+  ::mpr::chubby::StatOperation op(int index) const;
+  void set_op(int index, ::mpr::chubby::StatOperation value);
+  void add_op(::mpr::chubby::StatOperation value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>& op() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>* mutable_op();
+
+  // @@protoc_insertion_point(class_scope:mpr.chubby.RpcStatRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField<int> op_;
+    mutable std::atomic<int> _op_cached_byte_size_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_service_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RpcStatResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mpr.chubby.RpcStatResponse) */ {
+ public:
+  inline RpcStatResponse() : RpcStatResponse(nullptr) {}
+  ~RpcStatResponse() override;
+  explicit PROTOBUF_CONSTEXPR RpcStatResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RpcStatResponse(const RpcStatResponse& from);
+  RpcStatResponse(RpcStatResponse&& from) noexcept
+    : RpcStatResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline RpcStatResponse& operator=(const RpcStatResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RpcStatResponse& operator=(RpcStatResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RpcStatResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RpcStatResponse* internal_default_instance() {
+    return reinterpret_cast<const RpcStatResponse*>(
+               &_RpcStatResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    44;
+
+  friend void swap(RpcStatResponse& a, RpcStatResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RpcStatResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RpcStatResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RpcStatResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RpcStatResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RpcStatResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RpcStatResponse& from) {
+    RpcStatResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RpcStatResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mpr.chubby.RpcStatResponse";
+  }
+  protected:
+  explicit RpcStatResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kStatsFieldNumber = 2,
+    kStatusFieldNumber = 1,
+  };
+  // repeated .mpr.chubby.StatInfo stats = 2;
+  int stats_size() const;
+  private:
+  int _internal_stats_size() const;
+  public:
+  void clear_stats();
+  ::mpr::chubby::StatInfo* mutable_stats(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::mpr::chubby::StatInfo >*
+      mutable_stats();
+  private:
+  const ::mpr::chubby::StatInfo& _internal_stats(int index) const;
+  ::mpr::chubby::StatInfo* _internal_add_stats();
+  public:
+  const ::mpr::chubby::StatInfo& stats(int index) const;
+  ::mpr::chubby::StatInfo* add_stats();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::mpr::chubby::StatInfo >&
+      stats() const;
+
+  // .mpr.chubby.NodeStatus status = 1;
+  void clear_status();
+  ::mpr::chubby::NodeStatus status() const;
+  void set_status(::mpr::chubby::NodeStatus value);
+  private:
+  ::mpr::chubby::NodeStatus _internal_status() const;
+  void _internal_set_status(::mpr::chubby::NodeStatus value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:mpr.chubby.RpcStatResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::mpr::chubby::StatInfo > stats_;
+    int status_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_service_2eproto;
+};
+// -------------------------------------------------------------------
+
+class GroupHeartbeat final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mpr.chubby.GroupHeartbeat) */ {
+ public:
+  inline GroupHeartbeat() : GroupHeartbeat(nullptr) {}
+  ~GroupHeartbeat() override;
+  explicit PROTOBUF_CONSTEXPR GroupHeartbeat(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  GroupHeartbeat(const GroupHeartbeat& from);
+  GroupHeartbeat(GroupHeartbeat&& from) noexcept
+    : GroupHeartbeat() {
+    *this = ::std::move(from);
+  }
+
+  inline GroupHeartbeat& operator=(const GroupHeartbeat& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GroupHeartbeat& operator=(GroupHeartbeat&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GroupHeartbeat& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GroupHeartbeat* internal_default_instance() {
+    return reinterpret_cast<const GroupHeartbeat*>(
+               &_GroupHeartbeat_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    45;
+
+  friend void swap(GroupHeartbeat& a, GroupHeartbeat& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GroupHeartbeat* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GroupHeartbeat* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  GroupHeartbeat* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GroupHeartbeat>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const GroupHeartbeat& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GroupHeartbeat& from) {
+    GroupHeartbeat::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GroupHeartbeat* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mpr.chubby.GroupHeartbeat";
+  }
+  protected:
+  explicit GroupHeartbeat(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTermFieldNumber = 2,
+    kCommitIndexFieldNumber = 3,
+    kHeartbeatIntervalMicrosFieldNumber = 4,
+    kGroupIdFieldNumber = 1,
+  };
+  // int64 term = 2;
+  void clear_term();
+  int64_t term() const;
+  void set_term(int64_t value);
+  private:
+  int64_t _internal_term() const;
+  void _internal_set_term(int64_t value);
+  public:
+
+  // int64 commit_index = 3;
+  void clear_commit_index();
+  int64_t commit_index() const;
+  void set_commit_index(int64_t value);
+  private:
+  int64_t _internal_commit_index() const;
+  void _internal_set_commit_index(int64_t value);
+  public:
+
+  // int64 heartbeat_interval_micros = 4;
+  void clear_heartbeat_interval_micros();
+  int64_t heartbeat_interval_micros() const;
+  void set_heartbeat_interval_micros(int64_t value);
+  private:
+  int64_t _internal_heartbeat_interval_micros() const;
+  void _internal_set_heartbeat_interval_micros(int64_t value);
+  public:
+
+  // int32 group_id = 1;
+  void clear_group_id();
+  int32_t group_id() const;
+  void set_group_id(int32_t value);
+  private:
+  int32_t _internal_group_id() const;
+  void _internal_set_group_id(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:mpr.chubby.GroupHeartbeat)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int64_t term_;
+    int64_t commit_index_;
+    int64_t heartbeat_interval_micros_;
+    int32_t group_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_service_2eproto;
+};
+// -------------------------------------------------------------------
+
+class GroupHeartbeatResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mpr.chubby.GroupHeartbeatResponse) */ {
+ public:
+  inline GroupHeartbeatResponse() : GroupHeartbeatResponse(nullptr) {}
+  ~GroupHeartbeatResponse() override;
+  explicit PROTOBUF_CONSTEXPR GroupHeartbeatResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  GroupHeartbeatResponse(const GroupHeartbeatResponse& from);
+  GroupHeartbeatResponse(GroupHeartbeatResponse&& from) noexcept
+    : GroupHeartbeatResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline GroupHeartbeatResponse& operator=(const GroupHeartbeatResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GroupHeartbeatResponse& operator=(GroupHeartbeatResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GroupHeartbeatResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GroupHeartbeatResponse* internal_default_instance() {
+    return reinterpret_cast<const GroupHeartbeatResponse*>(
+               &_GroupHeartbeatResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    46;
+
+  friend void swap(GroupHeartbeatResponse& a, GroupHeartbeatResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GroupHeartbeatResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GroupHeartbeatResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  GroupHeartbeatResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GroupHeartbeatResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const GroupHeartbeatResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GroupHeartbeatResponse& from) {
+    GroupHeartbeatResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GroupHeartbeatResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mpr.chubby.GroupHeartbeatResponse";
+  }
+  protected:
+  explicit GroupHeartbeatResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kCurrentTermFieldNumber = 1,
+    kSuccessFieldNumber = 2,
+  };
+  // int64 current_term = 1;
+  void clear_current_term();
+  int64_t current_term() const;
+  void set_current_term(int64_t value);
+  private:
+  int64_t _internal_current_term() const;
+  void _internal_set_current_term(int64_t value);
+  public:
+
+  // bool success = 2;
+  void clear_success();
+  bool success() const;
+  void set_success(bool value);
+  private:
+  bool _internal_success() const;
+  void _internal_set_success(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:mpr.chubby.GroupHeartbeatResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int64_t current_term_;
+    bool success_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_service_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CoalescedHeartbeatRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mpr.chubby.CoalescedHeartbeatRequest) */ {
+ public:
+  inline CoalescedHeartbeatRequest() : CoalescedHeartbeatRequest(nullptr) {}
+  ~CoalescedHeartbeatRequest() override;
+  explicit PROTOBUF_CONSTEXPR CoalescedHeartbeatRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CoalescedHeartbeatRequest(const CoalescedHeartbeatRequest& from);
+  CoalescedHeartbeatRequest(CoalescedHeartbeatRequest&& from) noexcept
+    : CoalescedHeartbeatRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline CoalescedHeartbeatRequest& operator=(const CoalescedHeartbeatRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CoalescedHeartbeatRequest& operator=(CoalescedHeartbeatRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CoalescedHeartbeatRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CoalescedHeartbeatRequest* internal_default_instance() {
+    return reinterpret_cast<const CoalescedHeartbeatRequest*>(
+               &_CoalescedHeartbeatRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    47;
+
+  friend void swap(CoalescedHeartbeatRequest& a, CoalescedHeartbeatRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CoalescedHeartbeatRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CoalescedHeartbeatRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CoalescedHeartbeatRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CoalescedHeartbeatRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CoalescedHeartbeatRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CoalescedHeartbeatRequest& from) {
+    CoalescedHeartbeatRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CoalescedHeartbeatRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mpr.chubby.CoalescedHeartbeatRequest";
+  }
+  protected:
+  explicit CoalescedHeartbeatRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kHeartbeatsFieldNumber = 2,
+    kLeaderIdFieldNumber = 1,
+  };
+  // repeated .mpr.chubby.GroupHeartbeat heartbeats = 2;
+  int heartbeats_size() const;
+  private:
+  int _internal_heartbeats_size() const;
+  public:
+  void clear_heartbeats();
+  ::mpr::chubby::GroupHeartbeat* mutable_heartbeats(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::mpr::chubby::GroupHeartbeat >*
+      mutable_heartbeats();
+  private:
+  const ::mpr::chubby::GroupHeartbeat& _internal_heartbeats(int index) const;
+  ::mpr::chubby::GroupHeartbeat* _internal_add_heartbeats();
+  public:
+  const ::mpr::chubby::GroupHeartbeat& heartbeats(int index) const;
+  ::mpr::chubby::GroupHeartbeat* add_heartbeats();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::mpr::chubby::GroupHeartbeat >&
+      heartbeats() const;
+
+  // string leader_id = 1;
+  void clear_leader_id();
+  const std::string& leader_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_leader_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_leader_id();
+  PROTOBUF_NODISCARD std::string* release_leader_id();
+  void set_allocated_leader_id(std::string* leader_id);
+  private:
+  const std::string& _internal_leader_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_leader_id(const std::string& value);
+  std::string* _internal_mutable_leader_id();
+  public:
+
+  // @@protoc_insertion_point(class_scope:mpr.chubby.CoalescedHeartbeatRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::mpr::chubby::GroupHeartbeat > heartbeats_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr leader_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_service_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CoalescedHeartbeatResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mpr.chubby.CoalescedHeartbeatResponse) */ {
+ public:
+  inline CoalescedHeartbeatResponse() : CoalescedHeartbeatResponse(nullptr) {}
+  ~CoalescedHeartbeatResponse() override;
+  explicit PROTOBUF_CONSTEXPR CoalescedHeartbeatResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CoalescedHeartbeatResponse(const CoalescedHeartbeatResponse& from);
+  CoalescedHeartbeatResponse(CoalescedHeartbeatResponse&& from) noexcept
+    : CoalescedHeartbeatResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline CoalescedHeartbeatResponse& operator=(const CoalescedHeartbeatResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CoalescedHeartbeatResponse& operator=(CoalescedHeartbeatResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CoalescedHeartbeatResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CoalescedHeartbeatResponse* internal_default_instance() {
+    return reinterpret_cast<const CoalescedHeartbeatResponse*>(
+               &_CoalescedHeartbeatResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    48;
+
+  friend void swap(CoalescedHeartbeatResponse& a, CoalescedHeartbeatResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CoalescedHeartbeatResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CoalescedHeartbeatResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CoalescedHeartbeatResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CoalescedHeartbeatResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CoalescedHeartbeatResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CoalescedHeartbeatResponse& from) {
+    CoalescedHeartbeatResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CoalescedHeartbeatResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mpr.chubby.CoalescedHeartbeatResponse";
+  }
+  protected:
+  explicit CoalescedHeartbeatResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kResponsesFieldNumber = 1,
+  };
+  // repeated .mpr.chubby.GroupHeartbeatResponse responses = 1;
+  int responses_size() const;
+  private:
+  int _internal_responses_size() const;
+  public:
+  void clear_responses();
+  ::mpr::chubby::GroupHeartbeatResponse* mutable_responses(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::mpr::chubby::GroupHeartbeatResponse >*
+      mutable_responses();
+  private:
+  const ::mpr::chubby::GroupHeartbeatResponse& _internal_responses(int index) const;
+  ::mpr::chubby::GroupHeartbeatResponse* _internal_add_responses();
+  public:
+  const ::mpr::chubby::GroupHeartbeatResponse& responses(int index) const;
+  ::mpr::chubby::GroupHeartbeatResponse* add_responses();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::mpr::chubby::GroupHeartbeatResponse >&
+      responses() const;
+
+  // @@protoc_insertion_point(class_scope:mpr.chubby.CoalescedHeartbeatResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::mpr::chubby::GroupHeartbeatResponse > responses_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_service_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ShardInfo final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mpr.chubby.ShardInfo) */ {
+ public:
+  inline ShardInfo() : ShardInfo(nullptr) {}
+  ~ShardInfo() override;
+  explicit PROTOBUF_CONSTEXPR ShardInfo(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ShardInfo(const ShardInfo& from);
+  ShardInfo(ShardInfo&& from) noexcept
+    : ShardInfo() {
+    *this = ::std::move(from);
+  }
+
+  inline ShardInfo& operator=(const ShardInfo& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ShardInfo& operator=(ShardInfo&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ShardInfo& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ShardInfo* internal_default_instance() {
+    return reinterpret_cast<const ShardInfo*>(
+               &_ShardInfo_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    49;
+
+  friend void swap(ShardInfo& a, ShardInfo& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ShardInfo* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ShardInfo* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ShardInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ShardInfo>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ShardInfo& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ShardInfo& from) {
+    ShardInfo::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ShardInfo* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mpr.chubby.ShardInfo";
+  }
+  protected:
+  explicit ShardInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kReplicasFieldNumber = 4,
+    kLearnersFieldNumber = 6,
+    kStartKeyFieldNumber = 2,
+    kEndKeyFieldNumber = 3,
+    kLeaderIdFieldNumber = 5,
+    kGroupIdFieldNumber = 1,
+  };
+  // repeated string replicas = 4;
+  int replicas_size() const;
+  private:
+  int _internal_replicas_size() const;
+  public:
+  void clear_replicas();
+  const std::string& replicas(int index) const;
+  std::string* mutable_replicas(int index);
+  void set_replicas(int index, const std::string& value);
+  void set_replicas(int index, std::string&& value);
+  void set_replicas(int index, const char* value);
+  void set_replicas(int index, const char* value, size_t size);
+  std::string* add_replicas();
+  void add_replicas(const std::string& value);
+  void add_replicas(std::string&& value);
+  void add_replicas(const char* value);
+  void add_replicas(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& replicas() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_replicas();
+  private:
+  const std::string& _internal_replicas(int index) const;
+  std::string* _internal_add_replicas();
+  public:
+
+  // repeated string learners = 6;
+  int learners_size() const;
+  private:
+  int _internal_learners_size() const;
+  public:
+  void clear_learners();
+  const std::string& learners(int index) const;
+  std::string* mutable_learners(int index);
+  void set_learners(int index, const std::string& value);
+  void set_learners(int index, std::string&& value);
+  void set_learners(int index, const char* value);
+  void set_learners(int index, const char* value, size_t size);
+  std::string* add_learners();
+  void add_learners(const std::string& value);
+  void add_learners(std::string&& value);
+  void add_learners(const char* value);
+  void add_learners(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& learners() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_learners();
+  private:
+  const std::string& _internal_learners(int index) const;
+  std::string* _internal_add_learners();
+  public:
+
+  // bytes start_key = 2;
+  void clear_start_key();
+  const std::string& start_key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_start_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_start_key();
+  PROTOBUF_NODISCARD std::string* release_start_key();
+  void set_allocated_start_key(std::string* start_key);
+  private:
+  const std::string& _internal_start_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_start_key(const std::string& value);
+  std::string* _internal_mutable_start_key();
+  public:
+
+  // bytes end_key = 3;
+  void clear_end_key();
+  const std::string& end_key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_end_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_end_key();
+  PROTOBUF_NODISCARD std::string* release_end_key();
+  void set_allocated_end_key(std::string* end_key);
+  private:
+  const std::string& _internal_end_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_end_key(const std::string& value);
+  std::string* _internal_mutable_end_key();
+  public:
+
+  // string leader_id = 5;
+  void clear_leader_id();
+  const std::string& leader_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_leader_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_leader_id();
+  PROTOBUF_NODISCARD std::string* release_leader_id();
+  void set_allocated_leader_id(std::string* leader_id);
+  private:
+  const std::string& _internal_leader_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_leader_id(const std::string& value);
+  std::string* _internal_mutable_leader_id();
+  public:
+
+  // int32 group_id = 1;
+  void clear_group_id();
+  int32_t group_id() const;
+  void set_group_id(int32_t value);
+  private:
+  int32_t _internal_group_id() const;
+  void _internal_set_group_id(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:mpr.chubby.ShardInfo)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> replicas_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> learners_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr start_key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr end_key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr leader_id_;
+    int32_t group_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_service_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ShardMapInfo final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mpr.chubby.ShardMapInfo) */ {
+ public:
+  inline ShardMapInfo() : ShardMapInfo(nullptr) {}
+  ~ShardMapInfo() override;
+  explicit PROTOBUF_CONSTEXPR ShardMapInfo(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ShardMapInfo(const ShardMapInfo& from);
+  ShardMapInfo(ShardMapInfo&& from) noexcept
+    : ShardMapInfo() {
+    *this = ::std::move(from);
+  }
+
+  inline ShardMapInfo& operator=(const ShardMapInfo& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ShardMapInfo& operator=(ShardMapInfo&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ShardMapInfo& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ShardMapInfo* internal_default_instance() {
+    return reinterpret_cast<const ShardMapInfo*>(
+               &_ShardMapInfo_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    50;
+
+  friend void swap(ShardMapInfo& a, ShardMapInfo& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ShardMapInfo* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ShardMapInfo* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ShardMapInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ShardMapInfo>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ShardMapInfo& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ShardMapInfo& from) {
+    ShardMapInfo::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ShardMapInfo* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mpr.chubby.ShardMapInfo";
+  }
+  protected:
+  explicit ShardMapInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kShardsFieldNumber = 3,
+    kVersionFieldNumber = 1,
+    kHashPartitionFieldNumber = 2,
+  };
+  // repeated .mpr.chubby.ShardInfo shards = 3;
+  int shards_size() const;
+  private:
+  int _internal_shards_size() const;
+  public:
+  void clear_shards();
+  ::mpr::chubby::ShardInfo* mutable_shards(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::mpr::chubby::ShardInfo >*
+      mutable_shards();
+  private:
+  const ::mpr::chubby::ShardInfo& _internal_shards(int index) const;
+  ::mpr::chubby::ShardInfo* _internal_add_shards();
+  public:
+  const ::mpr::chubby::ShardInfo& shards(int index) const;
+  ::mpr::chubby::ShardInfo* add_shards();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::mpr::chubby::ShardInfo >&
+      shards() const;
+
+  // int64 version = 1;
+  void clear_version();
+  int64_t version() const;
+  void set_version(int64_t value);
+  private:
+  int64_t _internal_version() const;
+  void _internal_set_version(int64_t value);
+  public:
+
+  // bool hash_partition = 2;
+  void clear_hash_partition();
+  bool hash_partition() const;
+  void set_hash_partition(bool value);
+  private:
+  bool _internal_hash_partition() const;
+  void _internal_set_hash_partition(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:mpr.chubby.ShardMapInfo)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::mpr::chubby::ShardInfo > shards_;
+    int64_t version_;
+    bool hash_partition_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_service_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// UserInfo
+
+// string username = 1;
+inline void UserInfo::clear_username() {
+  _impl_.username_.ClearToEmpty();
+}
+inline const std::string& UserInfo::username() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.UserInfo.username)
+  return _internal_username();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void UserInfo::set_username(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.username_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpr.chubby.UserInfo.username)
+}
+inline std::string* UserInfo::mutable_username() {
+  std::string* _s = _internal_mutable_username();
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.UserInfo.username)
+  return _s;
+}
+inline const std::string& UserInfo::_internal_username() const {
+  return _impl_.username_.Get();
+}
+inline void UserInfo::_internal_set_username(const std::string& value) {
+  
+  _impl_.username_.Set(value, GetArenaForAllocation());
+}
+inline std::string* UserInfo::_internal_mutable_username() {
+  
+  return _impl_.username_.Mutable(GetArenaForAllocation());
+}
+inline std::string* UserInfo::release_username() {
+  // @@protoc_insertion_point(field_release:mpr.chubby.UserInfo.username)
+  return _impl_.username_.Release();
+}
+inline void UserInfo::set_allocated_username(std::string* username) {
+  if (username != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.username_.SetAllocated(username, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.username_.IsDefault()) {
+    _impl_.username_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.UserInfo.username)
+}
+
+// string password = 2;
+inline void UserInfo::clear_password() {
+  _impl_.password_.ClearToEmpty();
+}
+inline const std::string& UserInfo::password() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.UserInfo.password)
+  return _internal_password();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void UserInfo::set_password(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.password_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpr.chubby.UserInfo.password)
+}
+inline std::string* UserInfo::mutable_password() {
+  std::string* _s = _internal_mutable_password();
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.UserInfo.password)
+  return _s;
+}
+inline const std::string& UserInfo::_internal_password() const {
+  return _impl_.password_.Get();
+}
+inline void UserInfo::_internal_set_password(const std::string& value) {
+  
+  _impl_.password_.Set(value, GetArenaForAllocation());
+}
+inline std::string* UserInfo::_internal_mutable_password() {
+  
+  return _impl_.password_.Mutable(GetArenaForAllocation());
+}
+inline std::string* UserInfo::release_password() {
+  // @@protoc_insertion_point(field_release:mpr.chubby.UserInfo.password)
+  return _impl_.password_.Release();
+}
+inline void UserInfo::set_allocated_password(std::string* password) {
+  if (password != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.password_.SetAllocated(password, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.password_.IsDefault()) {
+    _impl_.password_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.UserInfo.password)
+}
+
+// -------------------------------------------------------------------
+
+// Entry
+
+// string key = 1;
+inline void Entry::clear_key() {
+  _impl_.key_.ClearToEmpty();
+}
+inline const std::string& Entry::key() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.Entry.key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Entry::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpr.chubby.Entry.key)
+}
+inline std::string* Entry::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.Entry.key)
+  return _s;
+}
+inline const std::string& Entry::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void Entry::_internal_set_key(const std::string& value) {
+  
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Entry::_internal_mutable_key() {
+  
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Entry::release_key() {
+  // @@protoc_insertion_point(field_release:mpr.chubby.Entry.key)
+  return _impl_.key_.Release();
+}
+inline void Entry::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.Entry.key)
+}
+
+// bytes value = 2;
+inline void Entry::clear_value() {
+  _impl_.value_.ClearToEmpty();
+}
+inline const std::string& Entry::value() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.Entry.value)
+  return _internal_value();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Entry::set_value(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.value_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpr.chubby.Entry.value)
+}
+inline std::string* Entry::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.Entry.value)
+  return _s;
+}
+inline const std::string& Entry::_internal_value() const {
+  return _impl_.value_.Get();
+}
+inline void Entry::_internal_set_value(const std::string& value) {
+  
+  _impl_.value_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Entry::_internal_mutable_value() {
+  
+  return _impl_.value_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Entry::release_value() {
+  // @@protoc_insertion_point(field_release:mpr.chubby.Entry.value)
+  return _impl_.value_.Release();
+}
+inline void Entry::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.Entry.value)
+}
+
+// int64 term = 3;
+inline void Entry::clear_term() {
+  _impl_.term_ = int64_t{0};
+}
+inline int64_t Entry::_internal_term() const {
+  return _impl_.term_;
+}
+inline int64_t Entry::term() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.Entry.term)
+  return _internal_term();
+}
+inline void Entry::_internal_set_term(int64_t value) {
+  
+  _impl_.term_ = value;
+}
+inline void Entry::set_term(int64_t value) {
+  _internal_set_term(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.Entry.term)
+}
+
+// .mpr.chubby.LogOperation op = 4;
+inline void Entry::clear_op() {
+  _impl_.op_ = 0;
+}
+inline ::mpr::chubby::LogOperation Entry::_internal_op() const {
+  return static_cast< ::mpr::chubby::LogOperation >(_impl_.op_);
+}
+inline ::mpr::chubby::LogOperation Entry::op() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.Entry.op)
+  return _internal_op();
+}
+inline void Entry::_internal_set_op(::mpr::chubby::LogOperation value) {
+  
+  _impl_.op_ = value;
+}
+inline void Entry::set_op(::mpr::chubby::LogOperation value) {
+  _internal_set_op(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.Entry.op)
+}
+
+// string user = 5;
+inline void Entry::clear_user() {
+  _impl_.user_.ClearToEmpty();
+}
+inline const std::string& Entry::user() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.Entry.user)
+  return _internal_user();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Entry::set_user(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.user_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpr.chubby.Entry.user)
+}
+inline std::string* Entry::mutable_user() {
+  std::string* _s = _internal_mutable_user();
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.Entry.user)
+  return _s;
+}
+inline const std::string& Entry::_internal_user() const {
+  return _impl_.user_.Get();
+}
+inline void Entry::_internal_set_user(const std::string& value) {
+  
+  _impl_.user_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Entry::_internal_mutable_user() {
+  
+  return _impl_.user_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Entry::release_user() {
+  // @@protoc_insertion_point(field_release:mpr.chubby.Entry.user)
+  return _impl_.user_.Release();
+}
+inline void Entry::set_allocated_user(std::string* user) {
+  if (user != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.user_.SetAllocated(user, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.user_.IsDefault()) {
+    _impl_.user_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.Entry.user)
+}
+
+// bytes dedup_key = 6;
+inline void Entry::clear_dedup_key() {
+  _impl_.dedup_key_.ClearToEmpty();
+}
+inline const std::string& Entry::dedup_key() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.Entry.dedup_key)
+  return _internal_dedup_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Entry::set_dedup_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.dedup_key_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpr.chubby.Entry.dedup_key)
+}
+inline std::string* Entry::mutable_dedup_key() {
+  std::string* _s = _internal_mutable_dedup_key();
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.Entry.dedup_key)
+  return _s;
+}
+inline const std::string& Entry::_internal_dedup_key() const {
+  return _impl_.dedup_key_.Get();
+}
+inline void Entry::_internal_set_dedup_key(const std::string& value) {
+  
+  _impl_.dedup_key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Entry::_internal_mutable_dedup_key() {
+  
+  return _impl_.dedup_key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Entry::release_dedup_key() {
+  // @@protoc_insertion_point(field_release:mpr.chubby.Entry.dedup_key)
+  return _impl_.dedup_key_.Release();
+}
+inline void Entry::set_allocated_dedup_key(std::string* dedup_key) {
+  if (dedup_key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.dedup_key_.SetAllocated(dedup_key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.dedup_key_.IsDefault()) {
+    _impl_.dedup_key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.Entry.dedup_key)
+}
+
+// -------------------------------------------------------------------
+
+// StatInfo
+
+// int64 current_stat = 1;
+inline void StatInfo::clear_current_stat() {
+  _impl_.current_stat_ = int64_t{0};
+}
+inline int64_t StatInfo::_internal_current_stat() const {
+  return _impl_.current_stat_;
+}
+inline int64_t StatInfo::current_stat() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.StatInfo.current_stat)
+  return _internal_current_stat();
+}
+inline void StatInfo::_internal_set_current_stat(int64_t value) {
+  
+  _impl_.current_stat_ = value;
+}
+inline void StatInfo::set_current_stat(int64_t value) {
+  _internal_set_current_stat(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.StatInfo.current_stat)
+}
+
+// int64 average_stat = 2;
+inline void StatInfo::clear_average_stat() {
+  _impl_.average_stat_ = int64_t{0};
+}
+inline int64_t StatInfo::_internal_average_stat() const {
+  return _impl_.average_stat_;
+}
+inline int64_t StatInfo::average_stat() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.StatInfo.average_stat)
+  return _internal_average_stat();
+}
+inline void StatInfo::_internal_set_average_stat(int64_t value) {
+  
+  _impl_.average_stat_ = value;
+}
+inline void StatInfo::set_average_stat(int64_t value) {
+  _internal_set_average_stat(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.StatInfo.average_stat)
+}
+
+// -------------------------------------------------------------------
+
+// AppendEntriesRequest
+
+// int64 term = 1;
+inline void AppendEntriesRequest::clear_term() {
+  _impl_.term_ = int64_t{0};
+}
+inline int64_t AppendEntriesRequest::_internal_term() const {
+  return _impl_.term_;
+}
+inline int64_t AppendEntriesRequest::term() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.AppendEntriesRequest.term)
+  return _internal_term();
+}
+inline void AppendEntriesRequest::_internal_set_term(int64_t value) {
+  
+  _impl_.term_ = value;
+}
+inline void AppendEntriesRequest::set_term(int64_t value) {
+  _internal_set_term(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.AppendEntriesRequest.term)
+}
+
+// string leader_id = 2;
+inline void AppendEntriesRequest::clear_leader_id() {
+  _impl_.leader_id_.ClearToEmpty();
+}
+inline const std::string& AppendEntriesRequest::leader_id() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.AppendEntriesRequest.leader_id)
+  return _internal_leader_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void AppendEntriesRequest::set_leader_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.leader_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpr.chubby.AppendEntriesRequest.leader_id)
+}
+inline std::string* AppendEntriesRequest::mutable_leader_id() {
+  std::string* _s = _internal_mutable_leader_id();
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.AppendEntriesRequest.leader_id)
+  return _s;
+}
+inline const std::string& AppendEntriesRequest::_internal_leader_id() const {
+  return _impl_.leader_id_.Get();
+}
+inline void AppendEntriesRequest::_internal_set_leader_id(const std::string& value) {
+  
+  _impl_.leader_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* AppendEntriesRequest::_internal_mutable_leader_id() {
+  
+  return _impl_.leader_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* AppendEntriesRequest::release_leader_id() {
+  // @@protoc_insertion_point(field_release:mpr.chubby.AppendEntriesRequest.leader_id)
+  return _impl_.leader_id_.Release();
+}
+inline void AppendEntriesRequest::set_allocated_leader_id(std::string* leader_id) {
+  if (leader_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.leader_id_.SetAllocated(leader_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.leader_id_.IsDefault()) {
+    _impl_.leader_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.AppendEntriesRequest.leader_id)
+}
+
+// int64 prev_log_index = 3;
+inline void AppendEntriesRequest::clear_prev_log_index() {
+  _impl_.prev_log_index_ = int64_t{0};
+}
+inline int64_t AppendEntriesRequest::_internal_prev_log_index() const {
+  return _impl_.prev_log_index_;
+}
+inline int64_t AppendEntriesRequest::prev_log_index() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.AppendEntriesRequest.prev_log_index)
+  return _internal_prev_log_index();
+}
+inline void AppendEntriesRequest::_internal_set_prev_log_index(int64_t value) {
+  
+  _impl_.prev_log_index_ = value;
+}
+inline void AppendEntriesRequest::set_prev_log_index(int64_t value) {
+  _internal_set_prev_log_index(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.AppendEntriesRequest.prev_log_index)
+}
+
+// int64 prev_log_term = 4;
+inline void AppendEntriesRequest::clear_prev_log_term() {
+  _impl_.prev_log_term_ = int64_t{0};
+}
+inline int64_t AppendEntriesRequest::_internal_prev_log_term() const {
+  return _impl_.prev_log_term_;
+}
+inline int64_t AppendEntriesRequest::prev_log_term() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.AppendEntriesRequest.prev_log_term)
+  return _internal_prev_log_term();
+}
+inline void AppendEntriesRequest::_internal_set_prev_log_term(int64_t value) {
+  
+  _impl_.prev_log_term_ = value;
+}
+inline void AppendEntriesRequest::set_prev_log_term(int64_t value) {
+  _internal_set_prev_log_term(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.AppendEntriesRequest.prev_log_term)
+}
+
+// int64 leader_commit_index = 5;
+inline void AppendEntriesRequest::clear_leader_commit_index() {
+  _impl_.leader_commit_index_ = int64_t{0};
+}
+inline int64_t AppendEntriesRequest::_internal_leader_commit_index() const {
+  return _impl_.leader_commit_index_;
+}
+inline int64_t AppendEntriesRequest::leader_commit_index() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.AppendEntriesRequest.leader_commit_index)
+  return _internal_leader_commit_index();
+}
+inline void AppendEntriesRequest::_internal_set_leader_commit_index(int64_t value) {
+  
+  _impl_.leader_commit_index_ = value;
+}
+inline void AppendEntriesRequest::set_leader_commit_index(int64_t value) {
+  _internal_set_leader_commit_index(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.AppendEntriesRequest.leader_commit_index)
+}
+
+// repeated .mpr.chubby.Entry entries = 6;
+inline int AppendEntriesRequest::_internal_entries_size() const {
+  return _impl_.entries_.size();
+}
+inline int AppendEntriesRequest::entries_size() const {
+  return _internal_entries_size();
+}
+inline void AppendEntriesRequest::clear_entries() {
+  _impl_.entries_.Clear();
+}
+inline ::mpr::chubby::Entry* AppendEntriesRequest::mutable_entries(int index) {
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.AppendEntriesRequest.entries)
+  return _impl_.entries_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::mpr::chubby::Entry >*
+AppendEntriesRequest::mutable_entries() {
+  // @@protoc_insertion_point(field_mutable_list:mpr.chubby.AppendEntriesRequest.entries)
+  return &_impl_.entries_;
+}
+inline const ::mpr::chubby::Entry& AppendEntriesRequest::_internal_entries(int index) const {
+  return _impl_.entries_.Get(index);
+}
+inline const ::mpr::chubby::Entry& AppendEntriesRequest::entries(int index) const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.AppendEntriesRequest.entries)
+  return _internal_entries(index);
+}
+inline ::mpr::chubby::Entry* AppendEntriesRequest::_internal_add_entries() {
+  return _impl_.entries_.Add();
+}
+inline ::mpr::chubby::Entry* AppendEntriesRequest::add_entries() {
+  ::mpr::chubby::Entry* _add = _internal_add_entries();
+  // @@protoc_insertion_point(field_add:mpr.chubby.AppendEntriesRequest.entries)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::mpr::chubby::Entry >&
+AppendEntriesRequest::entries() const {
+  // @@protoc_insertion_point(field_list:mpr.chubby.AppendEntriesRequest.entries)
+  return _impl_.entries_;
+}
+
+// int32 group_id = 7;
+inline void AppendEntriesRequest::clear_group_id() {
+  _impl_.group_id_ = 0;
+}
+inline int32_t AppendEntriesRequest::_internal_group_id() const {
+  return _impl_.group_id_;
+}
+inline int32_t AppendEntriesRequest::group_id() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.AppendEntriesRequest.group_id)
+  return _internal_group_id();
+}
+inline void AppendEntriesRequest::_internal_set_group_id(int32_t value) {
+  
+  _impl_.group_id_ = value;
+}
+inline void AppendEntriesRequest::set_group_id(int32_t value) {
+  _internal_set_group_id(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.AppendEntriesRequest.group_id)
+}
+
+// int64 heartbeat_interval_micros = 8;
+inline void AppendEntriesRequest::clear_heartbeat_interval_micros() {
+  _impl_.heartbeat_interval_micros_ = int64_t{0};
+}
+inline int64_t AppendEntriesRequest::_internal_heartbeat_interval_micros() const {
+  return _impl_.heartbeat_interval_micros_;
+}
+inline int64_t AppendEntriesRequest::heartbeat_interval_micros() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.AppendEntriesRequest.heartbeat_interval_micros)
+  return _internal_heartbeat_interval_micros();
+}
+inline void AppendEntriesRequest::_internal_set_heartbeat_interval_micros(int64_t value) {
+  
+  _impl_.heartbeat_interval_micros_ = value;
+}
+inline void AppendEntriesRequest::set_heartbeat_interval_micros(int64_t value) {
+  _internal_set_heartbeat_interval_micros(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.AppendEntriesRequest.heartbeat_interval_micros)
+}
+
+// -------------------------------------------------------------------
+
+// AppendEntriesResponse
+
+// int64 current_term = 1;
+inline void AppendEntriesResponse::clear_current_term() {
+  _impl_.current_term_ = int64_t{0};
+}
+inline int64_t AppendEntriesResponse::_internal_current_term() const {
+  return _impl_.current_term_;
+}
+inline int64_t AppendEntriesResponse::current_term() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.AppendEntriesResponse.current_term)
+  return _internal_current_term();
+}
+inline void AppendEntriesResponse::_internal_set_current_term(int64_t value) {
+  
+  _impl_.current_term_ = value;
+}
+inline void AppendEntriesResponse::set_current_term(int64_t value) {
+  _internal_set_current_term(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.AppendEntriesResponse.current_term)
+}
+
+// bool success = 2;
+inline void AppendEntriesResponse::clear_success() {
+  _impl_.success_ = false;
+}
+inline bool AppendEntriesResponse::_internal_success() const {
+  return _impl_.success_;
+}
+inline bool AppendEntriesResponse::success() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.AppendEntriesResponse.success)
+  return _internal_success();
+}
+inline void AppendEntriesResponse::_internal_set_success(bool value) {
+  
+  _impl_.success_ = value;
+}
+inline void AppendEntriesResponse::set_success(bool value) {
+  _internal_set_success(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.AppendEntriesResponse.success)
+}
+
+// int64 log_length = 3;
+inline void AppendEntriesResponse::clear_log_length() {
+  _impl_.log_length_ = int64_t{0};
+}
+inline int64_t AppendEntriesResponse::_internal_log_length() const {
+  return _impl_.log_length_;
+}
+inline int64_t AppendEntriesResponse::log_length() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.AppendEntriesResponse.log_length)
+  return _internal_log_length();
+}
+inline void AppendEntriesResponse::_internal_set_log_length(int64_t value) {
+  
+  _impl_.log_length_ = value;
+}
+inline void AppendEntriesResponse::set_log_length(int64_t value) {
+  _internal_set_log_length(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.AppendEntriesResponse.log_length)
+}
+
+// bool is_busy = 4;
+inline void AppendEntriesResponse::clear_is_busy() {
+  _impl_.is_busy_ = false;
+}
+inline bool AppendEntriesResponse::_internal_is_busy() const {
+  return _impl_.is_busy_;
+}
+inline bool AppendEntriesResponse::is_busy() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.AppendEntriesResponse.is_busy)
+  return _internal_is_busy();
+}
+inline void AppendEntriesResponse::_internal_set_is_busy(bool value) {
+  
+  _impl_.is_busy_ = value;
+}
+inline void AppendEntriesResponse::set_is_busy(bool value) {
+  _internal_set_is_busy(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.AppendEntriesResponse.is_busy)
+}
+
+// int64 conflict_term = 5;
+inline void AppendEntriesResponse::clear_conflict_term() {
+  _impl_.conflict_term_ = int64_t{0};
+}
+inline int64_t AppendEntriesResponse::_internal_conflict_term() const {
+  return _impl_.conflict_term_;
+}
+inline int64_t AppendEntriesResponse::conflict_term() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.AppendEntriesResponse.conflict_term)
+  return _internal_conflict_term();
+}
+inline void AppendEntriesResponse::_internal_set_conflict_term(int64_t value) {
+  
+  _impl_.conflict_term_ = value;
+}
+inline void AppendEntriesResponse::set_conflict_term(int64_t value) {
+  _internal_set_conflict_term(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.AppendEntriesResponse.conflict_term)
+}
+
+// int64 conflict_index = 6;
+inline void AppendEntriesResponse::clear_conflict_index() {
+  _impl_.conflict_index_ = int64_t{0};
+}
+inline int64_t AppendEntriesResponse::_internal_conflict_index() const {
+  return _impl_.conflict_index_;
+}
+inline int64_t AppendEntriesResponse::conflict_index() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.AppendEntriesResponse.conflict_index)
+  return _internal_conflict_index();
+}
+inline void AppendEntriesResponse::_internal_set_conflict_index(int64_t value) {
+  
+  _impl_.conflict_index_ = value;
+}
+inline void AppendEntriesResponse::set_conflict_index(int64_t value) {
+  _internal_set_conflict_index(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.AppendEntriesResponse.conflict_index)
+}
+
+// -------------------------------------------------------------------
+
+// VoteRequest
+
+// int64 term = 1;
+inline void VoteRequest::clear_term() {
+  _impl_.term_ = int64_t{0};
+}
+inline int64_t VoteRequest::_internal_term() const {
+  return _impl_.term_;
+}
+inline int64_t VoteRequest::term() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.VoteRequest.term)
+  return _internal_term();
+}
+inline void VoteRequest::_internal_set_term(int64_t value) {
+  
+  _impl_.term_ = value;
+}
+inline void VoteRequest::set_term(int64_t value) {
+  _internal_set_term(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.VoteRequest.term)
+}
+
+// string candidate_id = 2;
+inline void VoteRequest::clear_candidate_id() {
+  _impl_.candidate_id_.ClearToEmpty();
+}
+inline const std::string& VoteRequest::candidate_id() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.VoteRequest.candidate_id)
+  return _internal_candidate_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void VoteRequest::set_candidate_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.candidate_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpr.chubby.VoteRequest.candidate_id)
+}
+inline std::string* VoteRequest::mutable_candidate_id() {
+  std::string* _s = _internal_mutable_candidate_id();
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.VoteRequest.candidate_id)
+  return _s;
+}
+inline const std::string& VoteRequest::_internal_candidate_id() const {
+  return _impl_.candidate_id_.Get();
+}
+inline void VoteRequest::_internal_set_candidate_id(const std::string& value) {
+  
+  _impl_.candidate_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* VoteRequest::_internal_mutable_candidate_id() {
+  
+  return _impl_.candidate_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* VoteRequest::release_candidate_id() {
+  // @@protoc_insertion_point(field_release:mpr.chubby.VoteRequest.candidate_id)
+  return _impl_.candidate_id_.Release();
+}
+inline void VoteRequest::set_allocated_candidate_id(std::string* candidate_id) {
+  if (candidate_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.candidate_id_.SetAllocated(candidate_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.candidate_id_.IsDefault()) {
+    _impl_.candidate_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.VoteRequest.candidate_id)
+}
+
+// int64 last_log_index = 3;
+inline void VoteRequest::clear_last_log_index() {
+  _impl_.last_log_index_ = int64_t{0};
+}
+inline int64_t VoteRequest::_internal_last_log_index() const {
+  return _impl_.last_log_index_;
+}
+inline int64_t VoteRequest::last_log_index() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.VoteRequest.last_log_index)
+  return _internal_last_log_index();
+}
+inline void VoteRequest::_internal_set_last_log_index(int64_t value) {
+  
+  _impl_.last_log_index_ = value;
+}
+inline void VoteRequest::set_last_log_index(int64_t value) {
+  _internal_set_last_log_index(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.VoteRequest.last_log_index)
+}
+
+// int64 last_log_term = 4;
+inline void VoteRequest::clear_last_log_term() {
+  _impl_.last_log_term_ = int64_t{0};
+}
+inline int64_t VoteRequest::_internal_last_log_term() const {
+  return _impl_.last_log_term_;
+}
+inline int64_t VoteRequest::last_log_term() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.VoteRequest.last_log_term)
+  return _internal_last_log_term();
+}
+inline void VoteRequest::_internal_set_last_log_term(int64_t value) {
+  
+  _impl_.last_log_term_ = value;
+}
+inline void VoteRequest::set_last_log_term(int64_t value) {
+  _internal_set_last_log_term(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.VoteRequest.last_log_term)
+}
+
+// int32 group_id = 5;
+inline void VoteRequest::clear_group_id() {
+  _impl_.group_id_ = 0;
+}
+inline int32_t VoteRequest::_internal_group_id() const {
+  return _impl_.group_id_;
+}
+inline int32_t VoteRequest::group_id() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.VoteRequest.group_id)
+  return _internal_group_id();
+}
+inline void VoteRequest::_internal_set_group_id(int32_t value) {
+  
+  _impl_.group_id_ = value;
+}
+inline void VoteRequest::set_group_id(int32_t value) {
+  _internal_set_group_id(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.VoteRequest.group_id)
+}
+
+// bool pre_vote = 6;
+inline void VoteRequest::clear_pre_vote() {
+  _impl_.pre_vote_ = false;
+}
+inline bool VoteRequest::_internal_pre_vote() const {
+  return _impl_.pre_vote_;
+}
+inline bool VoteRequest::pre_vote() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.VoteRequest.pre_vote)
+  return _internal_pre_vote();
+}
+inline void VoteRequest::_internal_set_pre_vote(bool value) {
+  
+  _impl_.pre_vote_ = value;
+}
+inline void VoteRequest::set_pre_vote(bool value) {
+  _internal_set_pre_vote(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.VoteRequest.pre_vote)
+}
+
+// bool transfer = 7;
+inline void VoteRequest::clear_transfer() {
+  _impl_.transfer_ = false;
+}
+inline bool VoteRequest::_internal_transfer() const {
+  return _impl_.transfer_;
+}
+inline bool VoteRequest::transfer() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.VoteRequest.transfer)
+  return _internal_transfer();
+}
+inline void VoteRequest::_internal_set_transfer(bool value) {
+  
+  _impl_.transfer_ = value;
+}
+inline void VoteRequest::set_transfer(bool value) {
+  _internal_set_transfer(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.VoteRequest.transfer)
+}
+
+// -------------------------------------------------------------------
+
+// VoteResponse
+
+// int64 term = 1;
+inline void VoteResponse::clear_term() {
+  _impl_.term_ = int64_t{0};
+}
+inline int64_t VoteResponse::_internal_term() const {
+  return _impl_.term_;
+}
+inline int64_t VoteResponse::term() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.VoteResponse.term)
+  return _internal_term();
+}
+inline void VoteResponse::_internal_set_term(int64_t value) {
+  
+  _impl_.term_ = value;
+}
+inline void VoteResponse::set_term(int64_t value) {
+  _internal_set_term(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.VoteResponse.term)
+}
+
+// bool vote_granted = 2;
+inline void VoteResponse::clear_vote_granted() {
+  _impl_.vote_granted_ = false;
+}
+inline bool VoteResponse::_internal_vote_granted() const {
+  return _impl_.vote_granted_;
+}
+inline bool VoteResponse::vote_granted() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.VoteResponse.vote_granted)
+  return _internal_vote_granted();
+}
+inline void VoteResponse::_internal_set_vote_granted(bool value) {
+  
+  _impl_.vote_granted_ = value;
+}
+inline void VoteResponse::set_vote_granted(bool value) {
+  _internal_set_vote_granted(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.VoteResponse.vote_granted)
+}
+
+// -------------------------------------------------------------------
+
+// TimeoutNowRequest
+
+// int32 group_id = 1;
+inline void TimeoutNowRequest::clear_group_id() {
+  _impl_.group_id_ = 0;
+}
+inline int32_t TimeoutNowRequest::_internal_group_id() const {
+  return _impl_.group_id_;
+}
+inline int32_t TimeoutNowRequest::group_id() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.TimeoutNowRequest.group_id)
+  return _internal_group_id();
+}
+inline void TimeoutNowRequest::_internal_set_group_id(int32_t value) {
+  
+  _impl_.group_id_ = value;
+}
+inline void TimeoutNowRequest::set_group_id(int32_t value) {
+  _internal_set_group_id(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.TimeoutNowRequest.group_id)
+}
+
+// int64 term = 2;
+inline void TimeoutNowRequest::clear_term() {
+  _impl_.term_ = int64_t{0};
+}
+inline int64_t TimeoutNowRequest::_internal_term() const {
+  return _impl_.term_;
+}
+inline int64_t TimeoutNowRequest::term() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.TimeoutNowRequest.term)
+  return _internal_term();
+}
+inline void TimeoutNowRequest::_internal_set_term(int64_t value) {
+  
+  _impl_.term_ = value;
+}
+inline void TimeoutNowRequest::set_term(int64_t value) {
+  _internal_set_term(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.TimeoutNowRequest.term)
+}
+
+// string leader_id = 3;
+inline void TimeoutNowRequest::clear_leader_id() {
+  _impl_.leader_id_.ClearToEmpty();
+}
+inline const std::string& TimeoutNowRequest::leader_id() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.TimeoutNowRequest.leader_id)
+  return _internal_leader_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TimeoutNowRequest::set_leader_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.leader_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpr.chubby.TimeoutNowRequest.leader_id)
+}
+inline std::string* TimeoutNowRequest::mutable_leader_id() {
+  std::string* _s = _internal_mutable_leader_id();
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.TimeoutNowRequest.leader_id)
+  return _s;
+}
+inline const std::string& TimeoutNowRequest::_internal_leader_id() const {
+  return _impl_.leader_id_.Get();
+}
+inline void TimeoutNowRequest::_internal_set_leader_id(const std::string& value) {
+  
+  _impl_.leader_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* TimeoutNowRequest::_internal_mutable_leader_id() {
+  
+  return _impl_.leader_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* TimeoutNowRequest::release_leader_id() {
+  // @@protoc_insertion_point(field_release:mpr.chubby.TimeoutNowRequest.leader_id)
+  return _impl_.leader_id_.Release();
+}
+inline void TimeoutNowRequest::set_allocated_leader_id(std::string* leader_id) {
+  if (leader_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.leader_id_.SetAllocated(leader_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.leader_id_.IsDefault()) {
+    _impl_.leader_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.TimeoutNowRequest.leader_id)
+}
+
+// -------------------------------------------------------------------
+
+// TimeoutNowResponse
+
+// int64 term = 1;
+inline void TimeoutNowResponse::clear_term() {
+  _impl_.term_ = int64_t{0};
+}
+inline int64_t TimeoutNowResponse::_internal_term() const {
+  return _impl_.term_;
+}
+inline int64_t TimeoutNowResponse::term() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.TimeoutNowResponse.term)
+  return _internal_term();
+}
+inline void TimeoutNowResponse::_internal_set_term(int64_t value) {
+  
+  _impl_.term_ = value;
+}
+inline void TimeoutNowResponse::set_term(int64_t value) {
+  _internal_set_term(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.TimeoutNowResponse.term)
+}
+
+// bool success = 2;
+inline void TimeoutNowResponse::clear_success() {
+  _impl_.success_ = false;
+}
+inline bool TimeoutNowResponse::_internal_success() const {
+  return _impl_.success_;
+}
+inline bool TimeoutNowResponse::success() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.TimeoutNowResponse.success)
+  return _internal_success();
+}
+inline void TimeoutNowResponse::_internal_set_success(bool value) {
+  
+  _impl_.success_ = value;
+}
+inline void TimeoutNowResponse::set_success(bool value) {
+  _internal_set_success(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.TimeoutNowResponse.success)
+}
+
+// -------------------------------------------------------------------
+
+// TransferLeadershipRequest
+
+// int32 group_id = 1;
+inline void TransferLeadershipRequest::clear_group_id() {
+  _impl_.group_id_ = 0;
+}
+inline int32_t TransferLeadershipRequest::_internal_group_id() const {
+  return _impl_.group_id_;
+}
+inline int32_t TransferLeadershipRequest::group_id() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.TransferLeadershipRequest.group_id)
+  return _internal_group_id();
+}
+inline void TransferLeadershipRequest::_internal_set_group_id(int32_t value) {
+  
+  _impl_.group_id_ = value;
+}
+inline void TransferLeadershipRequest::set_group_id(int32_t value) {
+  _internal_set_group_id(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.TransferLeadershipRequest.group_id)
+}
+
+// string target_id = 2;
+inline void TransferLeadershipRequest::clear_target_id() {
+  _impl_.target_id_.ClearToEmpty();
+}
+inline const std::string& TransferLeadershipRequest::target_id() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.TransferLeadershipRequest.target_id)
+  return _internal_target_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TransferLeadershipRequest::set_target_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.target_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpr.chubby.TransferLeadershipRequest.target_id)
+}
+inline std::string* TransferLeadershipRequest::mutable_target_id() {
+  std::string* _s = _internal_mutable_target_id();
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.TransferLeadershipRequest.target_id)
+  return _s;
+}
+inline const std::string& TransferLeadershipRequest::_internal_target_id() const {
+  return _impl_.target_id_.Get();
+}
+inline void TransferLeadershipRequest::_internal_set_target_id(const std::string& value) {
+  
+  _impl_.target_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* TransferLeadershipRequest::_internal_mutable_target_id() {
+  
+  return _impl_.target_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* TransferLeadershipRequest::release_target_id() {
+  // @@protoc_insertion_point(field_release:mpr.chubby.TransferLeadershipRequest.target_id)
+  return _impl_.target_id_.Release();
+}
+inline void TransferLeadershipRequest::set_allocated_target_id(std::string* target_id) {
+  if (target_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.target_id_.SetAllocated(target_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.target_id_.IsDefault()) {
+    _impl_.target_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.TransferLeadershipRequest.target_id)
+}
+
+// -------------------------------------------------------------------
+
+// TransferLeadershipResponse
+
+// bool success = 1;
+inline void TransferLeadershipResponse::clear_success() {
+  _impl_.success_ = false;
+}
+inline bool TransferLeadershipResponse::_internal_success() const {
+  return _impl_.success_;
+}
+inline bool TransferLeadershipResponse::success() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.TransferLeadershipResponse.success)
+  return _internal_success();
+}
+inline void TransferLeadershipResponse::_internal_set_success(bool value) {
+  
+  _impl_.success_ = value;
+}
+inline void TransferLeadershipResponse::set_success(bool value) {
+  _internal_set_success(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.TransferLeadershipResponse.success)
+}
+
+// string leader_id = 2;
+inline void TransferLeadershipResponse::clear_leader_id() {
+  _impl_.leader_id_.ClearToEmpty();
+}
+inline const std::string& TransferLeadershipResponse::leader_id() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.TransferLeadershipResponse.leader_id)
+  return _internal_leader_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TransferLeadershipResponse::set_leader_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.leader_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpr.chubby.TransferLeadershipResponse.leader_id)
+}
+inline std::string* TransferLeadershipResponse::mutable_leader_id() {
+  std::string* _s = _internal_mutable_leader_id();
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.TransferLeadershipResponse.leader_id)
+  return _s;
+}
+inline const std::string& TransferLeadershipResponse::_internal_leader_id() const {
+  return _impl_.leader_id_.Get();
+}
+inline void TransferLeadershipResponse::_internal_set_leader_id(const std::string& value) {
+  
+  _impl_.leader_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* TransferLeadershipResponse::_internal_mutable_leader_id() {
+  
+  return _impl_.leader_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* TransferLeadershipResponse::release_leader_id() {
+  // @@protoc_insertion_point(field_release:mpr.chubby.TransferLeadershipResponse.leader_id)
+  return _impl_.leader_id_.Release();
+}
+inline void TransferLeadershipResponse::set_allocated_leader_id(std::string* leader_id) {
+  if (leader_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.leader_id_.SetAllocated(leader_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.leader_id_.IsDefault()) {
+    _impl_.leader_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.TransferLeadershipResponse.leader_id)
+}
+
+// string message = 3;
+inline void TransferLeadershipResponse::clear_message() {
+  _impl_.message_.ClearToEmpty();
+}
+inline const std::string& TransferLeadershipResponse::message() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.TransferLeadershipResponse.message)
+  return _internal_message();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TransferLeadershipResponse::set_message(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.message_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpr.chubby.TransferLeadershipResponse.message)
+}
+inline std::string* TransferLeadershipResponse::mutable_message() {
+  std::string* _s = _internal_mutable_message();
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.TransferLeadershipResponse.message)
+  return _s;
+}
+inline const std::string& TransferLeadershipResponse::_internal_message() const {
+  return _impl_.message_.Get();
+}
+inline void TransferLeadershipResponse::_internal_set_message(const std::string& value) {
+  
+  _impl_.message_.Set(value, GetArenaForAllocation());
+}
+inline std::string* TransferLeadershipResponse::_internal_mutable_message() {
+  
+  return _impl_.message_.Mutable(GetArenaForAllocation());
+}
+inline std::string* TransferLeadershipResponse::release_message() {
+  // @@protoc_insertion_point(field_release:mpr.chubby.TransferLeadershipResponse.message)
+  return _impl_.message_.Release();
+}
+inline void TransferLeadershipResponse::set_allocated_message(std::string* message) {
+  if (message != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.message_.SetAllocated(message, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.message_.IsDefault()) {
+    _impl_.message_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.TransferLeadershipResponse.message)
+}
+
+// -------------------------------------------------------------------
+
+// PutRequest
+
+// string key = 1;
+inline void PutRequest::clear_key() {
+  _impl_.key_.ClearToEmpty();
+}
+inline const std::string& PutRequest::key() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.PutRequest.key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PutRequest::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpr.chubby.PutRequest.key)
+}
+inline std::string* PutRequest::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.PutRequest.key)
+  return _s;
+}
+inline const std::string& PutRequest::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void PutRequest::_internal_set_key(const std::string& value) {
+  
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PutRequest::_internal_mutable_key() {
+  
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PutRequest::release_key() {
+  // @@protoc_insertion_point(field_release:mpr.chubby.PutRequest.key)
+  return _impl_.key_.Release();
+}
+inline void PutRequest::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.PutRequest.key)
+}
+
+// bytes value = 2;
+inline void PutRequest::clear_value() {
+  _impl_.value_.ClearToEmpty();
+}
+inline const std::string& PutRequest::value() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.PutRequest.value)
+  return _internal_value();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PutRequest::set_value(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.value_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpr.chubby.PutRequest.value)
+}
+inline std::string* PutRequest::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.PutRequest.value)
+  return _s;
+}
+inline const std::string& PutRequest::_internal_value() const {
+  return _impl_.value_.Get();
+}
+inline void PutRequest::_internal_set_value(const std::string& value) {
+  
+  _impl_.value_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PutRequest::_internal_mutable_value() {
+  
+  return _impl_.value_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PutRequest::release_value() {
+  // @@protoc_insertion_point(field_release:mpr.chubby.PutRequest.value)
+  return _impl_.value_.Release();
+}
+inline void PutRequest::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.PutRequest.value)
+}
+
+// string uuid = 3;
+inline void PutRequest::clear_uuid() {
+  _impl_.uuid_.ClearToEmpty();
+}
+inline const std::string& PutRequest::uuid() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.PutRequest.uuid)
+  return _internal_uuid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PutRequest::set_uuid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.uuid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpr.chubby.PutRequest.uuid)
+}
+inline std::string* PutRequest::mutable_uuid() {
+  std::string* _s = _internal_mutable_uuid();
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.PutRequest.uuid)
+  return _s;
+}
+inline const std::string& PutRequest::_internal_uuid() const {
+  return _impl_.uuid_.Get();
+}
+inline void PutRequest::_internal_set_uuid(const std::string& value) {
+  
+  _impl_.uuid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PutRequest::_internal_mutable_uuid() {
+  
+  return _impl_.uuid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PutRequest::release_uuid() {
+  // @@protoc_insertion_point(field_release:mpr.chubby.PutRequest.uuid)
+  return _impl_.uuid_.Release();
+}
+inline void PutRequest::set_allocated_uuid(std::string* uuid) {
+  if (uuid != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.uuid_.SetAllocated(uuid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.uuid_.IsDefault()) {
+    _impl_.uuid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.PutRequest.uuid)
+}
+
+// string session_id = 4;
+inline void PutRequest::clear_session_id() {
+  _impl_.session_id_.ClearToEmpty();
+}
+inline const std::string& PutRequest::session_id() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.PutRequest.session_id)
+  return _internal_session_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PutRequest::set_session_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.session_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpr.chubby.PutRequest.session_id)
+}
+inline std::string* PutRequest::mutable_session_id() {
+  std::string* _s = _internal_mutable_session_id();
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.PutRequest.session_id)
+  return _s;
+}
+inline const std::string& PutRequest::_internal_session_id() const {
+  return _impl_.session_id_.Get();
+}
+inline void PutRequest::_internal_set_session_id(const std::string& value) {
+  
+  _impl_.session_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PutRequest::_internal_mutable_session_id() {
+  
+  return _impl_.session_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PutRequest::release_session_id() {
+  // @@protoc_insertion_point(field_release:mpr.chubby.PutRequest.session_id)
+  return _impl_.session_id_.Release();
+}
+inline void PutRequest::set_allocated_session_id(std::string* session_id) {
+  if (session_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.session_id_.SetAllocated(session_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.session_id_.IsDefault()) {
+    _impl_.session_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.PutRequest.session_id)
+}
+
+// string request_id = 5;
+inline void PutRequest::clear_request_id() {
+  _impl_.request_id_.ClearToEmpty();
+}
+inline const std::string& PutRequest::request_id() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.PutRequest.request_id)
+  return _internal_request_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PutRequest::set_request_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.request_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpr.chubby.PutRequest.request_id)
+}
+inline std::string* PutRequest::mutable_request_id() {
+  std::string* _s = _internal_mutable_request_id();
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.PutRequest.request_id)
+  return _s;
+}
+inline const std::string& PutRequest::_internal_request_id() const {
+  return _impl_.request_id_.Get();
+}
+inline void PutRequest::_internal_set_request_id(const std::string& value) {
+  
+  _impl_.request_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PutRequest::_internal_mutable_request_id() {
+  
+  return _impl_.request_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PutRequest::release_request_id() {
+  // @@protoc_insertion_point(field_release:mpr.chubby.PutRequest.request_id)
+  return _impl_.request_id_.Release();
+}
+inline void PutRequest::set_allocated_request_id(std::string* request_id) {
+  if (request_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.request_id_.SetAllocated(request_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.request_id_.IsDefault()) {
+    _impl_.request_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.PutRequest.request_id)
+}
+
+// -------------------------------------------------------------------
+
+// PutResponse
+
+// bool success = 1;
+inline void PutResponse::clear_success() {
+  _impl_.success_ = false;
+}
+inline bool PutResponse::_internal_success() const {
+  return _impl_.success_;
+}
+inline bool PutResponse::success() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.PutResponse.success)
+  return _internal_success();
+}
+inline void PutResponse::_internal_set_success(bool value) {
+  
+  _impl_.success_ = value;
+}
+inline void PutResponse::set_success(bool value) {
+  _internal_set_success(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.PutResponse.success)
+}
+
+// string leader_id = 2;
+inline void PutResponse::clear_leader_id() {
+  _impl_.leader_id_.ClearToEmpty();
+}
+inline const std::string& PutResponse::leader_id() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.PutResponse.leader_id)
+  return _internal_leader_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PutResponse::set_leader_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.leader_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpr.chubby.PutResponse.leader_id)
+}
+inline std::string* PutResponse::mutable_leader_id() {
+  std::string* _s = _internal_mutable_leader_id();
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.PutResponse.leader_id)
+  return _s;
+}
+inline const std::string& PutResponse::_internal_leader_id() const {
+  return _impl_.leader_id_.Get();
+}
+inline void PutResponse::_internal_set_leader_id(const std::string& value) {
+  
+  _impl_.leader_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PutResponse::_internal_mutable_leader_id() {
+  
+  return _impl_.leader_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PutResponse::release_leader_id() {
+  // @@protoc_insertion_point(field_release:mpr.chubby.PutResponse.leader_id)
+  return _impl_.leader_id_.Release();
+}
+inline void PutResponse::set_allocated_leader_id(std::string* leader_id) {
+  if (leader_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.leader_id_.SetAllocated(leader_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.leader_id_.IsDefault()) {
+    _impl_.leader_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.PutResponse.leader_id)
+}
+
+// bool uuid_expired = 3;
+inline void PutResponse::clear_uuid_expired() {
+  _impl_.uuid_expired_ = false;
+}
+inline bool PutResponse::_internal_uuid_expired() const {
+  return _impl_.uuid_expired_;
+}
+inline bool PutResponse::uuid_expired() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.PutResponse.uuid_expired)
+  return _internal_uuid_expired();
+}
+inline void PutResponse::_internal_set_uuid_expired(bool value) {
+  
+  _impl_.uuid_expired_ = value;
+}
+inline void PutResponse::set_uuid_expired(bool value) {
+  _internal_set_uuid_expired(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.PutResponse.uuid_expired)
+}
+
+// -------------------------------------------------------------------
+
+// StaleRead
+
+// int64 max_lag_entries = 1;
+inline void StaleRead::clear_max_lag_entries() {
+  _impl_.max_lag_entries_ = int64_t{0};
+}
+inline int64_t StaleRead::_internal_max_lag_entries() const {
+  return _impl_.max_lag_entries_;
+}
+inline int64_t StaleRead::max_lag_entries() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.StaleRead.max_lag_entries)
+  return _internal_max_lag_entries();
+}
+inline void StaleRead::_internal_set_max_lag_entries(int64_t value) {
+  
+  _impl_.max_lag_entries_ = value;
+}
+inline void StaleRead::set_max_lag_entries(int64_t value) {
+  _internal_set_max_lag_entries(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.StaleRead.max_lag_entries)
+}
+
+// int32 max_lag_ms = 2;
+inline void StaleRead::clear_max_lag_ms() {
+  _impl_.max_lag_ms_ = 0;
+}
+inline int32_t StaleRead::_internal_max_lag_ms() const {
+  return _impl_.max_lag_ms_;
+}
+inline int32_t StaleRead::max_lag_ms() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.StaleRead.max_lag_ms)
+  return _internal_max_lag_ms();
+}
+inline void StaleRead::_internal_set_max_lag_ms(int32_t value) {
+  
+  _impl_.max_lag_ms_ = value;
+}
+inline void StaleRead::set_max_lag_ms(int32_t value) {
+  _internal_set_max_lag_ms(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.StaleRead.max_lag_ms)
+}
+
+// int64 min_applied_index = 3;
+inline void StaleRead::clear_min_applied_index() {
+  _impl_.min_applied_index_ = int64_t{0};
+}
+inline int64_t StaleRead::_internal_min_applied_index() const {
+  return _impl_.min_applied_index_;
+}
+inline int64_t StaleRead::min_applied_index() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.StaleRead.min_applied_index)
+  return _internal_min_applied_index();
+}
+inline void StaleRead::_internal_set_min_applied_index(int64_t value) {
+  
+  _impl_.min_applied_index_ = value;
+}
+inline void StaleRead::set_min_applied_index(int64_t value) {
+  _internal_set_min_applied_index(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.StaleRead.min_applied_index)
+}
+
+// -------------------------------------------------------------------
+
+// GetRequest
+
+// string key = 1;
+inline void GetRequest::clear_key() {
+  _impl_.key_.ClearToEmpty();
+}
+inline const std::string& GetRequest::key() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.GetRequest.key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetRequest::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpr.chubby.GetRequest.key)
+}
+inline std::string* GetRequest::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.GetRequest.key)
+  return _s;
+}
+inline const std::string& GetRequest::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void GetRequest::_internal_set_key(const std::string& value) {
+  
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* GetRequest::_internal_mutable_key() {
+  
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* GetRequest::release_key() {
+  // @@protoc_insertion_point(field_release:mpr.chubby.GetRequest.key)
+  return _impl_.key_.Release();
+}
+inline void GetRequest::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.GetRequest.key)
+}
+
+// string uuid = 2;
+inline void GetRequest::clear_uuid() {
+  _impl_.uuid_.ClearToEmpty();
+}
+inline const std::string& GetRequest::uuid() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.GetRequest.uuid)
+  return _internal_uuid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetRequest::set_uuid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.uuid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpr.chubby.GetRequest.uuid)
+}
+inline std::string* GetRequest::mutable_uuid() {
+  std::string* _s = _internal_mutable_uuid();
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.GetRequest.uuid)
+  return _s;
+}
+inline const std::string& GetRequest::_internal_uuid() const {
+  return _impl_.uuid_.Get();
+}
+inline void GetRequest::_internal_set_uuid(const std::string& value) {
+  
+  _impl_.uuid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* GetRequest::_internal_mutable_uuid() {
+  
+  return _impl_.uuid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* GetRequest::release_uuid() {
+  // @@protoc_insertion_point(field_release:mpr.chubby.GetRequest.uuid)
+  return _impl_.uuid_.Release();
+}
+inline void GetRequest::set_allocated_uuid(std::string* uuid) {
+  if (uuid != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.uuid_.SetAllocated(uuid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.uuid_.IsDefault()) {
+    _impl_.uuid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.GetRequest.uuid)
+}
+
+// .mpr.chubby.StaleRead stale_read = 3;
+inline bool GetRequest::_internal_has_stale_read() const {
+  return this != internal_default_instance() && _impl_.stale_read_ != nullptr;
+}
+inline bool GetRequest::has_stale_read() const {
+  return _internal_has_stale_read();
+}
+inline void GetRequest::clear_stale_read() {
+  if (GetArenaForAllocation() == nullptr && _impl_.stale_read_ != nullptr) {
+    delete _impl_.stale_read_;
+  }
+  _impl_.stale_read_ = nullptr;
+}
+inline const ::mpr::chubby::StaleRead& GetRequest::_internal_stale_read() const {
+  const ::mpr::chubby::StaleRead* p = _impl_.stale_read_;
+  return p != nullptr ? *p : reinterpret_cast<const ::mpr::chubby::StaleRead&>(
+      ::mpr::chubby::_StaleRead_default_instance_);
+}
+inline const ::mpr::chubby::StaleRead& GetRequest::stale_read() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.GetRequest.stale_read)
+  return _internal_stale_read();
+}
+inline void GetRequest::unsafe_arena_set_allocated_stale_read(
+    ::mpr::chubby::StaleRead* stale_read) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.stale_read_);
+  }
+  _impl_.stale_read_ = stale_read;
+  if (stale_read) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:mpr.chubby.GetRequest.stale_read)
+}
+inline ::mpr::chubby::StaleRead* GetRequest::release_stale_read() {
+  
+  ::mpr::chubby::StaleRead* temp = _impl_.stale_read_;
+  _impl_.stale_read_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::mpr::chubby::StaleRead* GetRequest::unsafe_arena_release_stale_read() {
+  // @@protoc_insertion_point(field_release:mpr.chubby.GetRequest.stale_read)
+  
+  ::mpr::chubby::StaleRead* temp = _impl_.stale_read_;
+  _impl_.stale_read_ = nullptr;
+  return temp;
+}
+inline ::mpr::chubby::StaleRead* GetRequest::_internal_mutable_stale_read() {
+  
+  if (_impl_.stale_read_ == nullptr) {
+    auto* p = CreateMaybeMessage<::mpr::chubby::StaleRead>(GetArenaForAllocation());
+    _impl_.stale_read_ = p;
+  }
+  return _impl_.stale_read_;
+}
+inline ::mpr::chubby::StaleRead* GetRequest::mutable_stale_read() {
+  ::mpr::chubby::StaleRead* _msg = _internal_mutable_stale_read();
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.GetRequest.stale_read)
+  return _msg;
+}
+inline void GetRequest::set_allocated_stale_read(::mpr::chubby::StaleRead* stale_read) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.stale_read_;
+  }
+  if (stale_read) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(stale_read);
+    if (message_arena != submessage_arena) {
+      stale_read = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, stale_read, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.stale_read_ = stale_read;
+  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.GetRequest.stale_read)
+}
+
+// string session_id = 4;
+inline void GetRequest::clear_session_id() {
+  _impl_.session_id_.ClearToEmpty();
+}
+inline const std::string& GetRequest::session_id() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.GetRequest.session_id)
+  return _internal_session_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetRequest::set_session_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.session_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpr.chubby.GetRequest.session_id)
+}
+inline std::string* GetRequest::mutable_session_id() {
+  std::string* _s = _internal_mutable_session_id();
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.GetRequest.session_id)
+  return _s;
+}
+inline const std::string& GetRequest::_internal_session_id() const {
+  return _impl_.session_id_.Get();
+}
+inline void GetRequest::_internal_set_session_id(const std::string& value) {
+  
+  _impl_.session_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* GetRequest::_internal_mutable_session_id() {
+  
+  return _impl_.session_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* GetRequest::release_session_id() {
+  // @@protoc_insertion_point(field_release:mpr.chubby.GetRequest.session_id)
+  return _impl_.session_id_.Release();
+}
+inline void GetRequest::set_allocated_session_id(std::string* session_id) {
+  if (session_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.session_id_.SetAllocated(session_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.session_id_.IsDefault()) {
+    _impl_.session_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.GetRequest.session_id)
+}
+
+// -------------------------------------------------------------------
+
+// GetResponse
+
+// bool hit = 1;
+inline void GetResponse::clear_hit() {
+  _impl_.hit_ = false;
+}
+inline bool GetResponse::_internal_hit() const {
+  return _impl_.hit_;
+}
+inline bool GetResponse::hit() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.GetResponse.hit)
+  return _internal_hit();
+}
+inline void GetResponse::_internal_set_hit(bool value) {
+  
+  _impl_.hit_ = value;
+}
+inline void GetResponse::set_hit(bool value) {
+  _internal_set_hit(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.GetResponse.hit)
+}
+
+// bytes value = 2;
+inline void GetResponse::clear_value() {
+  _impl_.value_.ClearToEmpty();
+}
+inline const std::string& GetResponse::value() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.GetResponse.value)
+  return _internal_value();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetResponse::set_value(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.value_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpr.chubby.GetResponse.value)
+}
+inline std::string* GetResponse::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.GetResponse.value)
+  return _s;
+}
+inline const std::string& GetResponse::_internal_value() const {
+  return _impl_.value_.Get();
+}
+inline void GetResponse::_internal_set_value(const std::string& value) {
+  
+  _impl_.value_.Set(value, GetArenaForAllocation());
+}
+inline std::string* GetResponse::_internal_mutable_value() {
+  
+  return _impl_.value_.Mutable(GetArenaForAllocation());
+}
+inline std::string* GetResponse::release_value() {
+  // @@protoc_insertion_point(field_release:mpr.chubby.GetResponse.value)
+  return _impl_.value_.Release();
+}
+inline void GetResponse::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.GetResponse.value)
+}
+
+// string leader_id = 3;
+inline void GetResponse::clear_leader_id() {
+  _impl_.leader_id_.ClearToEmpty();
+}
+inline const std::string& GetResponse::leader_id() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.GetResponse.leader_id)
+  return _internal_leader_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetResponse::set_leader_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.leader_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpr.chubby.GetResponse.leader_id)
+}
+inline std::string* GetResponse::mutable_leader_id() {
+  std::string* _s = _internal_mutable_leader_id();
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.GetResponse.leader_id)
+  return _s;
+}
+inline const std::string& GetResponse::_internal_leader_id() const {
+  return _impl_.leader_id_.Get();
+}
+inline void GetResponse::_internal_set_leader_id(const std::string& value) {
+  
+  _impl_.leader_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* GetResponse::_internal_mutable_leader_id() {
+  
+  return _impl_.leader_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* GetResponse::release_leader_id() {
+  // @@protoc_insertion_point(field_release:mpr.chubby.GetResponse.leader_id)
+  return _impl_.leader_id_.Release();
+}
+inline void GetResponse::set_allocated_leader_id(std::string* leader_id) {
+  if (leader_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.leader_id_.SetAllocated(leader_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.leader_id_.IsDefault()) {
+    _impl_.leader_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.GetResponse.leader_id)
+}
+
+// bool success = 4;
+inline void GetResponse::clear_success() {
+  _impl_.success_ = false;
+}
+inline bool GetResponse::_internal_success() const {
+  return _impl_.success_;
+}
+inline bool GetResponse::success() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.GetResponse.success)
+  return _internal_success();
+}
+inline void GetResponse::_internal_set_success(bool value) {
+  
+  _impl_.success_ = value;
+}
+inline void GetResponse::set_success(bool value) {
+  _internal_set_success(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.GetResponse.success)
+}
+
+// bool uuid_expired = 5;
+inline void GetResponse::clear_uuid_expired() {
+  _impl_.uuid_expired_ = false;
+}
+inline bool GetResponse::_internal_uuid_expired() const {
+  return _impl_.uuid_expired_;
+}
+inline bool GetResponse::uuid_expired() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.GetResponse.uuid_expired)
+  return _internal_uuid_expired();
+}
+inline void GetResponse::_internal_set_uuid_expired(bool value) {
+  
+  _impl_.uuid_expired_ = value;
+}
+inline void GetResponse::set_uuid_expired(bool value) {
+  _internal_set_uuid_expired(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.GetResponse.uuid_expired)
+}
+
+// int64 last_applied = 6;
+inline void GetResponse::clear_last_applied() {
+  _impl_.last_applied_ = int64_t{0};
+}
+inline int64_t GetResponse::_internal_last_applied() const {
+  return _impl_.last_applied_;
+}
+inline int64_t GetResponse::last_applied() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.GetResponse.last_applied)
+  return _internal_last_applied();
+}
+inline void GetResponse::_internal_set_last_applied(int64_t value) {
+  
+  _impl_.last_applied_ = value;
+}
+inline void GetResponse::set_last_applied(int64_t value) {
+  _internal_set_last_applied(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.GetResponse.last_applied)
+}
+
+// bool cacheable = 7;
+inline void GetResponse::clear_cacheable() {
+  _impl_.cacheable_ = false;
+}
+inline bool GetResponse::_internal_cacheable() const {
+  return _impl_.cacheable_;
+}
+inline bool GetResponse::cacheable() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.GetResponse.cacheable)
+  return _internal_cacheable();
+}
+inline void GetResponse::_internal_set_cacheable(bool value) {
+  
+  _impl_.cacheable_ = value;
+}
+inline void GetResponse::set_cacheable(bool value) {
+  _internal_set_cacheable(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.GetResponse.cacheable)
+}
+
+// int64 cache_incarnation = 8;
+inline void GetResponse::clear_cache_incarnation() {
+  _impl_.cache_incarnation_ = int64_t{0};
+}
+inline int64_t GetResponse::_internal_cache_incarnation() const {
+  return _impl_.cache_incarnation_;
+}
+inline int64_t GetResponse::cache_incarnation() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.GetResponse.cache_incarnation)
+  return _internal_cache_incarnation();
+}
+inline void GetResponse::_internal_set_cache_incarnation(int64_t value) {
+  
+  _impl_.cache_incarnation_ = value;
+}
+inline void GetResponse::set_cache_incarnation(int64_t value) {
+  _internal_set_cache_incarnation(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.GetResponse.cache_incarnation)
+}
+
+// -------------------------------------------------------------------
+
+// DelRequest
+
+// string key = 1;
+inline void DelRequest::clear_key() {
+  _impl_.key_.ClearToEmpty();
+}
+inline const std::string& DelRequest::key() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.DelRequest.key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DelRequest::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpr.chubby.DelRequest.key)
+}
+inline std::string* DelRequest::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.DelRequest.key)
+  return _s;
+}
+inline const std::string& DelRequest::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void DelRequest::_internal_set_key(const std::string& value) {
+  
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* DelRequest::_internal_mutable_key() {
+  
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* DelRequest::release_key() {
+  // @@protoc_insertion_point(field_release:mpr.chubby.DelRequest.key)
+  return _impl_.key_.Release();
+}
+inline void DelRequest::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.DelRequest.key)
+}
+
+// string uuid = 2;
+inline void DelRequest::clear_uuid() {
+  _impl_.uuid_.ClearToEmpty();
+}
+inline const std::string& DelRequest::uuid() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.DelRequest.uuid)
+  return _internal_uuid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DelRequest::set_uuid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.uuid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpr.chubby.DelRequest.uuid)
+}
+inline std::string* DelRequest::mutable_uuid() {
+  std::string* _s = _internal_mutable_uuid();
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.DelRequest.uuid)
+  return _s;
+}
+inline const std::string& DelRequest::_internal_uuid() const {
+  return _impl_.uuid_.Get();
+}
+inline void DelRequest::_internal_set_uuid(const std::string& value) {
+  
+  _impl_.uuid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* DelRequest::_internal_mutable_uuid() {
+  
+  return _impl_.uuid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* DelRequest::release_uuid() {
+  // @@protoc_insertion_point(field_release:mpr.chubby.DelRequest.uuid)
+  return _impl_.uuid_.Release();
+}
+inline void DelRequest::set_allocated_uuid(std::string* uuid) {
+  if (uuid != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.uuid_.SetAllocated(uuid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.uuid_.IsDefault()) {
+    _impl_.uuid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.DelRequest.uuid)
+}
+
+// string session_id = 3;
+inline void DelRequest::clear_session_id() {
+  _impl_.session_id_.ClearToEmpty();
+}
+inline const std::string& DelRequest::session_id() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.DelRequest.session_id)
+  return _internal_session_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DelRequest::set_session_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.session_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpr.chubby.DelRequest.session_id)
+}
+inline std::string* DelRequest::mutable_session_id() {
+  std::string* _s = _internal_mutable_session_id();
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.DelRequest.session_id)
+  return _s;
+}
+inline const std::string& DelRequest::_internal_session_id() const {
+  return _impl_.session_id_.Get();
+}
+inline void DelRequest::_internal_set_session_id(const std::string& value) {
+  
+  _impl_.session_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* DelRequest::_internal_mutable_session_id() {
+  
+  return _impl_.session_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* DelRequest::release_session_id() {
+  // @@protoc_insertion_point(field_release:mpr.chubby.DelRequest.session_id)
+  return _impl_.session_id_.Release();
+}
+inline void DelRequest::set_allocated_session_id(std::string* session_id) {
+  if (session_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.session_id_.SetAllocated(session_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.session_id_.IsDefault()) {
+    _impl_.session_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.DelRequest.session_id)
+}
+
+// string request_id = 4;
+inline void DelRequest::clear_request_id() {
+  _impl_.request_id_.ClearToEmpty();
+}
+inline const std::string& DelRequest::request_id() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.DelRequest.request_id)
+  return _internal_request_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DelRequest::set_request_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.request_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpr.chubby.DelRequest.request_id)
+}
+inline std::string* DelRequest::mutable_request_id() {
+  std::string* _s = _internal_mutable_request_id();
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.DelRequest.request_id)
+  return _s;
+}
+inline const std::string& DelRequest::_internal_request_id() const {
+  return _impl_.request_id_.Get();
+}
+inline void DelRequest::_internal_set_request_id(const std::string& value) {
+  
+  _impl_.request_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* DelRequest::_internal_mutable_request_id() {
+  
+  return _impl_.request_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* DelRequest::release_request_id() {
+  // @@protoc_insertion_point(field_release:mpr.chubby.DelRequest.request_id)
+  return _impl_.request_id_.Release();
+}
+inline void DelRequest::set_allocated_request_id(std::string* request_id) {
+  if (request_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.request_id_.SetAllocated(request_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.request_id_.IsDefault()) {
+    _impl_.request_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.DelRequest.request_id)
+}
+
+// -------------------------------------------------------------------
+
+// DelResponse
+
+// bool success = 1;
+inline void DelResponse::clear_success() {
+  _impl_.success_ = false;
+}
+inline bool DelResponse::_internal_success() const {
+  return _impl_.success_;
+}
+inline bool DelResponse::success() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.DelResponse.success)
+  return _internal_success();
+}
+inline void DelResponse::_internal_set_success(bool value) {
+  
+  _impl_.success_ = value;
+}
+inline void DelResponse::set_success(bool value) {
+  _internal_set_success(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.DelResponse.success)
+}
+
+// string leader_id = 2;
+inline void DelResponse::clear_leader_id() {
+  _impl_.leader_id_.ClearToEmpty();
+}
+inline const std::string& DelResponse::leader_id() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.DelResponse.leader_id)
+  return _internal_leader_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DelResponse::set_leader_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.leader_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpr.chubby.DelResponse.leader_id)
+}
+inline std::string* DelResponse::mutable_leader_id() {
+  std::string* _s = _internal_mutable_leader_id();
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.DelResponse.leader_id)
+  return _s;
+}
+inline const std::string& DelResponse::_internal_leader_id() const {
+  return _impl_.leader_id_.Get();
+}
+inline void DelResponse::_internal_set_leader_id(const std::string& value) {
+  
+  _impl_.leader_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* DelResponse::_internal_mutable_leader_id() {
+  
+  return _impl_.leader_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* DelResponse::release_leader_id() {
+  // @@protoc_insertion_point(field_release:mpr.chubby.DelResponse.leader_id)
+  return _impl_.leader_id_.Release();
+}
+inline void DelResponse::set_allocated_leader_id(std::string* leader_id) {
+  if (leader_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.leader_id_.SetAllocated(leader_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.leader_id_.IsDefault()) {
+    _impl_.leader_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.DelResponse.leader_id)
+}
+
+// bool uuid_expired = 3;
+inline void DelResponse::clear_uuid_expired() {
+  _impl_.uuid_expired_ = false;
+}
+inline bool DelResponse::_internal_uuid_expired() const {
+  return _impl_.uuid_expired_;
+}
+inline bool DelResponse::uuid_expired() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.DelResponse.uuid_expired)
+  return _internal_uuid_expired();
+}
+inline void DelResponse::_internal_set_uuid_expired(bool value) {
+  
+  _impl_.uuid_expired_ = value;
+}
+inline void DelResponse::set_uuid_expired(bool value) {
+  _internal_set_uuid_expired(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.DelResponse.uuid_expired)
+}
+
+// -------------------------------------------------------------------
+
+// UnLockRequest
+
+// string key = 1;
+inline void UnLockRequest::clear_key() {
+  _impl_.key_.ClearToEmpty();
+}
+inline const std::string& UnLockRequest::key() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.UnLockRequest.key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void UnLockRequest::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpr.chubby.UnLockRequest.key)
+}
+inline std::string* UnLockRequest::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.UnLockRequest.key)
+  return _s;
+}
+inline const std::string& UnLockRequest::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void UnLockRequest::_internal_set_key(const std::string& value) {
+  
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* UnLockRequest::_internal_mutable_key() {
+  
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* UnLockRequest::release_key() {
+  // @@protoc_insertion_point(field_release:mpr.chubby.UnLockRequest.key)
+  return _impl_.key_.Release();
+}
+inline void UnLockRequest::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.UnLockRequest.key)
+}
+
+// string session_id = 2;
+inline void UnLockRequest::clear_session_id() {
+  _impl_.session_id_.ClearToEmpty();
+}
+inline const std::string& UnLockRequest::session_id() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.UnLockRequest.session_id)
+  return _internal_session_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void UnLockRequest::set_session_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.session_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpr.chubby.UnLockRequest.session_id)
+}
+inline std::string* UnLockRequest::mutable_session_id() {
+  std::string* _s = _internal_mutable_session_id();
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.UnLockRequest.session_id)
+  return _s;
+}
+inline const std::string& UnLockRequest::_internal_session_id() const {
+  return _impl_.session_id_.Get();
+}
+inline void UnLockRequest::_internal_set_session_id(const std::string& value) {
+  
+  _impl_.session_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* UnLockRequest::_internal_mutable_session_id() {
+  
+  return _impl_.session_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* UnLockRequest::release_session_id() {
+  // @@protoc_insertion_point(field_release:mpr.chubby.UnLockRequest.session_id)
+  return _impl_.session_id_.Release();
+}
+inline void UnLockRequest::set_allocated_session_id(std::string* session_id) {
+  if (session_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.session_id_.SetAllocated(session_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.session_id_.IsDefault()) {
+    _impl_.session_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.UnLockRequest.session_id)
+}
+
+// string uuid = 3;
+inline void UnLockRequest::clear_uuid() {
+  _impl_.uuid_.ClearToEmpty();
+}
+inline const std::string& UnLockRequest::uuid() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.UnLockRequest.uuid)
+  return _internal_uuid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void UnLockRequest::set_uuid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.uuid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpr.chubby.UnLockRequest.uuid)
+}
+inline std::string* UnLockRequest::mutable_uuid() {
+  std::string* _s = _internal_mutable_uuid();
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.UnLockRequest.uuid)
+  return _s;
+}
+inline const std::string& UnLockRequest::_internal_uuid() const {
+  return _impl_.uuid_.Get();
+}
+inline void UnLockRequest::_internal_set_uuid(const std::string& value) {
+  
+  _impl_.uuid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* UnLockRequest::_internal_mutable_uuid() {
+  
+  return _impl_.uuid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* UnLockRequest::release_uuid() {
+  // @@protoc_insertion_point(field_release:mpr.chubby.UnLockRequest.uuid)
+  return _impl_.uuid_.Release();
+}
+inline void UnLockRequest::set_allocated_uuid(std::string* uuid) {
+  if (uuid != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.uuid_.SetAllocated(uuid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.uuid_.IsDefault()) {
+    _impl_.uuid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.UnLockRequest.uuid)
+}
+
+// string request_id = 4;
+inline void UnLockRequest::clear_request_id() {
+  _impl_.request_id_.ClearToEmpty();
+}
+inline const std::string& UnLockRequest::request_id() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.UnLockRequest.request_id)
+  return _internal_request_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void UnLockRequest::set_request_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.request_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpr.chubby.UnLockRequest.request_id)
+}
+inline std::string* UnLockRequest::mutable_request_id() {
+  std::string* _s = _internal_mutable_request_id();
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.UnLockRequest.request_id)
+  return _s;
+}
+inline const std::string& UnLockRequest::_internal_request_id() const {
+  return _impl_.request_id_.Get();
+}
+inline void UnLockRequest::_internal_set_request_id(const std::string& value) {
+  
+  _impl_.request_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* UnLockRequest::_internal_mutable_request_id() {
+  
+  return _impl_.request_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* UnLockRequest::release_request_id() {
+  // @@protoc_insertion_point(field_release:mpr.chubby.UnLockRequest.request_id)
+  return _impl_.request_id_.Release();
+}
+inline void UnLockRequest::set_allocated_request_id(std::string* request_id) {
+  if (request_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.request_id_.SetAllocated(request_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.request_id_.IsDefault()) {
+    _impl_.request_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.UnLockRequest.request_id)
+}
+
+// -------------------------------------------------------------------
+
+// UnLockResponse
+
+// bool success = 1;
+inline void UnLockResponse::clear_success() {
+  _impl_.success_ = false;
+}
+inline bool UnLockResponse::_internal_success() const {
+  return _impl_.success_;
+}
+inline bool UnLockResponse::success() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.UnLockResponse.success)
+  return _internal_success();
+}
+inline void UnLockResponse::_internal_set_success(bool value) {
+  
+  _impl_.success_ = value;
+}
+inline void UnLockResponse::set_success(bool value) {
+  _internal_set_success(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.UnLockResponse.success)
+}
+
+// string leader_id = 2;
+inline void UnLockResponse::clear_leader_id() {
+  _impl_.leader_id_.ClearToEmpty();
+}
+inline const std::string& UnLockResponse::leader_id() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.UnLockResponse.leader_id)
+  return _internal_leader_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void UnLockResponse::set_leader_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.leader_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpr.chubby.UnLockResponse.leader_id)
+}
+inline std::string* UnLockResponse::mutable_leader_id() {
+  std::string* _s = _internal_mutable_leader_id();
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.UnLockResponse.leader_id)
+  return _s;
+}
+inline const std::string& UnLockResponse::_internal_leader_id() const {
+  return _impl_.leader_id_.Get();
+}
+inline void UnLockResponse::_internal_set_leader_id(const std::string& value) {
+  
+  _impl_.leader_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* UnLockResponse::_internal_mutable_leader_id() {
+  
+  return _impl_.leader_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* UnLockResponse::release_leader_id() {
+  // @@protoc_insertion_point(field_release:mpr.chubby.UnLockResponse.leader_id)
+  return _impl_.leader_id_.Release();
+}
+inline void UnLockResponse::set_allocated_leader_id(std::string* leader_id) {
+  if (leader_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.leader_id_.SetAllocated(leader_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.leader_id_.IsDefault()) {
+    _impl_.leader_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.UnLockResponse.leader_id)
+}
+
+// bool uuid_expired = 3;
+inline void UnLockResponse::clear_uuid_expired() {
+  _impl_.uuid_expired_ = false;
+}
+inline bool UnLockResponse::_internal_uuid_expired() const {
+  return _impl_.uuid_expired_;
+}
+inline bool UnLockResponse::uuid_expired() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.UnLockResponse.uuid_expired)
+  return _internal_uuid_expired();
+}
+inline void UnLockResponse::_internal_set_uuid_expired(bool value) {
+  
+  _impl_.uuid_expired_ = value;
+}
+inline void UnLockResponse::set_uuid_expired(bool value) {
+  _internal_set_uuid_expired(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.UnLockResponse.uuid_expired)
+}
+
+// -------------------------------------------------------------------
+
+// ShowStatusRequest
+
+// -------------------------------------------------------------------
+
+// ShowStatusResponse
+
+// .mpr.chubby.NodeStatus status = 1;
+inline void ShowStatusResponse::clear_status() {
+  _impl_.status_ = 0;
+}
+inline ::mpr::chubby::NodeStatus ShowStatusResponse::_internal_status() const {
+  return static_cast< ::mpr::chubby::NodeStatus >(_impl_.status_);
+}
+inline ::mpr::chubby::NodeStatus ShowStatusResponse::status() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.ShowStatusResponse.status)
+  return _internal_status();
+}
+inline void ShowStatusResponse::_internal_set_status(::mpr::chubby::NodeStatus value) {
+  
+  _impl_.status_ = value;
+}
+inline void ShowStatusResponse::set_status(::mpr::chubby::NodeStatus value) {
+  _internal_set_status(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.ShowStatusResponse.status)
+}
+
+// int64 term = 2;
+inline void ShowStatusResponse::clear_term() {
+  _impl_.term_ = int64_t{0};
+}
+inline int64_t ShowStatusResponse::_internal_term() const {
+  return _impl_.term_;
+}
+inline int64_t ShowStatusResponse::term() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.ShowStatusResponse.term)
+  return _internal_term();
+}
+inline void ShowStatusResponse::_internal_set_term(int64_t value) {
+  
+  _impl_.term_ = value;
+}
+inline void ShowStatusResponse::set_term(int64_t value) {
+  _internal_set_term(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.ShowStatusResponse.term)
+}
+
+// int64 last_log_index = 3;
+inline void ShowStatusResponse::clear_last_log_index() {
+  _impl_.last_log_index_ = int64_t{0};
+}
+inline int64_t ShowStatusResponse::_internal_last_log_index() const {
+  return _impl_.last_log_index_;
+}
+inline int64_t ShowStatusResponse::last_log_index() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.ShowStatusResponse.last_log_index)
+  return _internal_last_log_index();
+}
+inline void ShowStatusResponse::_internal_set_last_log_index(int64_t value) {
+  
+  _impl_.last_log_index_ = value;
+}
+inline void ShowStatusResponse::set_last_log_index(int64_t value) {
+  _internal_set_last_log_index(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.ShowStatusResponse.last_log_index)
+}
+
+// int64 last_log_term = 4;
+inline void ShowStatusResponse::clear_last_log_term() {
+  _impl_.last_log_term_ = int64_t{0};
+}
+inline int64_t ShowStatusResponse::_internal_last_log_term() const {
+  return _impl_.last_log_term_;
+}
+inline int64_t ShowStatusResponse::last_log_term() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.ShowStatusResponse.last_log_term)
+  return _internal_last_log_term();
+}
+inline void ShowStatusResponse::_internal_set_last_log_term(int64_t value) {
+  
+  _impl_.last_log_term_ = value;
+}
+inline void ShowStatusResponse::set_last_log_term(int64_t value) {
+  _internal_set_last_log_term(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.ShowStatusResponse.last_log_term)
+}
+
+// int64 commit_index = 5;
+inline void ShowStatusResponse::clear_commit_index() {
+  _impl_.commit_index_ = int64_t{0};
+}
+inline int64_t ShowStatusResponse::_internal_commit_index() const {
+  return _impl_.commit_index_;
+}
+inline int64_t ShowStatusResponse::commit_index() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.ShowStatusResponse.commit_index)
+  return _internal_commit_index();
+}
+inline void ShowStatusResponse::_internal_set_commit_index(int64_t value) {
+  
+  _impl_.commit_index_ = value;
+}
+inline void ShowStatusResponse::set_commit_index(int64_t value) {
+  _internal_set_commit_index(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.ShowStatusResponse.commit_index)
+}
+
+// int64 last_applied = 6;
+inline void ShowStatusResponse::clear_last_applied() {
+  _impl_.last_applied_ = int64_t{0};
+}
+inline int64_t ShowStatusResponse::_internal_last_applied() const {
+  return _impl_.last_applied_;
+}
+inline int64_t ShowStatusResponse::last_applied() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.ShowStatusResponse.last_applied)
+  return _internal_last_applied();
+}
+inline void ShowStatusResponse::_internal_set_last_applied(int64_t value) {
+  
+  _impl_.last_applied_ = value;
+}
+inline void ShowStatusResponse::set_last_applied(int64_t value) {
+  _internal_set_last_applied(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.ShowStatusResponse.last_applied)
+}
+
+// -------------------------------------------------------------------
+
+// ScanRequest
+
+// string start_key = 1;
+inline void ScanRequest::clear_start_key() {
+  _impl_.start_key_.ClearToEmpty();
+}
+inline const std::string& ScanRequest::start_key() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.ScanRequest.start_key)
+  return _internal_start_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ScanRequest::set_start_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.start_key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpr.chubby.ScanRequest.start_key)
+}
+inline std::string* ScanRequest::mutable_start_key() {
+  std::string* _s = _internal_mutable_start_key();
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.ScanRequest.start_key)
+  return _s;
+}
+inline const std::string& ScanRequest::_internal_start_key() const {
+  return _impl_.start_key_.Get();
+}
+inline void ScanRequest::_internal_set_start_key(const std::string& value) {
+  
+  _impl_.start_key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ScanRequest::_internal_mutable_start_key() {
+  
+  return _impl_.start_key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ScanRequest::release_start_key() {
+  // @@protoc_insertion_point(field_release:mpr.chubby.ScanRequest.start_key)
+  return _impl_.start_key_.Release();
+}
+inline void ScanRequest::set_allocated_start_key(std::string* start_key) {
+  if (start_key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.start_key_.SetAllocated(start_key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.start_key_.IsDefault()) {
+    _impl_.start_key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.ScanRequest.start_key)
+}
+
+// bytes end_key = 2;
+inline void ScanRequest::clear_end_key() {
+  _impl_.end_key_.ClearToEmpty();
+}
+inline const std::string& ScanRequest::end_key() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.ScanRequest.end_key)
+  return _internal_end_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ScanRequest::set_end_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.end_key_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpr.chubby.ScanRequest.end_key)
+}
+inline std::string* ScanRequest::mutable_end_key() {
+  std::string* _s = _internal_mutable_end_key();
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.ScanRequest.end_key)
+  return _s;
+}
+inline const std::string& ScanRequest::_internal_end_key() const {
+  return _impl_.end_key_.Get();
+}
+inline void ScanRequest::_internal_set_end_key(const std::string& value) {
+  
+  _impl_.end_key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ScanRequest::_internal_mutable_end_key() {
+  
+  return _impl_.end_key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ScanRequest::release_end_key() {
+  // @@protoc_insertion_point(field_release:mpr.chubby.ScanRequest.end_key)
+  return _impl_.end_key_.Release();
+}
+inline void ScanRequest::set_allocated_end_key(std::string* end_key) {
+  if (end_key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.end_key_.SetAllocated(end_key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.end_key_.IsDefault()) {
+    _impl_.end_key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.ScanRequest.end_key)
+}
+
+// int32 size_limit = 3;
+inline void ScanRequest::clear_size_limit() {
+  _impl_.size_limit_ = 0;
+}
+inline int32_t ScanRequest::_internal_size_limit() const {
+  return _impl_.size_limit_;
+}
+inline int32_t ScanRequest::size_limit() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.ScanRequest.size_limit)
+  return _internal_size_limit();
+}
+inline void ScanRequest::_internal_set_size_limit(int32_t value) {
+  
+  _impl_.size_limit_ = value;
+}
+inline void ScanRequest::set_size_limit(int32_t value) {
+  _internal_set_size_limit(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.ScanRequest.size_limit)
+}
+
+// string uuid = 4;
+inline void ScanRequest::clear_uuid() {
+  _impl_.uuid_.ClearToEmpty();
+}
+inline const std::string& ScanRequest::uuid() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.ScanRequest.uuid)
+  return _internal_uuid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ScanRequest::set_uuid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.uuid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpr.chubby.ScanRequest.uuid)
+}
+inline std::string* ScanRequest::mutable_uuid() {
+  std::string* _s = _internal_mutable_uuid();
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.ScanRequest.uuid)
+  return _s;
+}
+inline const std::string& ScanRequest::_internal_uuid() const {
+  return _impl_.uuid_.Get();
+}
+inline void ScanRequest::_internal_set_uuid(const std::string& value) {
+  
+  _impl_.uuid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ScanRequest::_internal_mutable_uuid() {
+  
+  return _impl_.uuid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ScanRequest::release_uuid() {
+  // @@protoc_insertion_point(field_release:mpr.chubby.ScanRequest.uuid)
+  return _impl_.uuid_.Release();
+}
+inline void ScanRequest::set_allocated_uuid(std::string* uuid) {
+  if (uuid != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.uuid_.SetAllocated(uuid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.uuid_.IsDefault()) {
+    _impl_.uuid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.ScanRequest.uuid)
+}
+
+// .mpr.chubby.StaleRead stale_read = 5;
+inline bool ScanRequest::_internal_has_stale_read() const {
+  return this != internal_default_instance() && _impl_.stale_read_ != nullptr;
+}
+inline bool ScanRequest::has_stale_read() const {
+  return _internal_has_stale_read();
+}
+inline void ScanRequest::clear_stale_read() {
+  if (GetArenaForAllocation() == nullptr && _impl_.stale_read_ != nullptr) {
+    delete _impl_.stale_read_;
+  }
+  _impl_.stale_read_ = nullptr;
+}
+inline const ::mpr::chubby::StaleRead& ScanRequest::_internal_stale_read() const {
+  const ::mpr::chubby::StaleRead* p = _impl_.stale_read_;
+  return p != nullptr ? *p : reinterpret_cast<const ::mpr::chubby::StaleRead&>(
+      ::mpr::chubby::_StaleRead_default_instance_);
+}
+inline const ::mpr::chubby::StaleRead& ScanRequest::stale_read() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.ScanRequest.stale_read)
+  return _internal_stale_read();
+}
+inline void ScanRequest::unsafe_arena_set_allocated_stale_read(
+    ::mpr::chubby::StaleRead* stale_read) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.stale_read_);
+  }
+  _impl_.stale_read_ = stale_read;
+  if (stale_read) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:mpr.chubby.ScanRequest.stale_read)
+}
+inline ::mpr::chubby::StaleRead* ScanRequest::release_stale_read() {
+  
+  ::mpr::chubby::StaleRead* temp = _impl_.stale_read_;
+  _impl_.stale_read_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::mpr::chubby::StaleRead* ScanRequest::unsafe_arena_release_stale_read() {
+  // @@protoc_insertion_point(field_release:mpr.chubby.ScanRequest.stale_read)
+  
+  ::mpr::chubby::StaleRead* temp = _impl_.stale_read_;
+  _impl_.stale_read_ = nullptr;
+  return temp;
+}
+inline ::mpr::chubby::StaleRead* ScanRequest::_internal_mutable_stale_read() {
+  
+  if (_impl_.stale_read_ == nullptr) {
+    auto* p = CreateMaybeMessage<::mpr::chubby::StaleRead>(GetArenaForAllocation());
+    _impl_.stale_read_ = p;
+  }
+  return _impl_.stale_read_;
+}
+inline ::mpr::chubby::StaleRead* ScanRequest::mutable_stale_read() {
+  ::mpr::chubby::StaleRead* _msg = _internal_mutable_stale_read();
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.ScanRequest.stale_read)
+  return _msg;
+}
+inline void ScanRequest::set_allocated_stale_read(::mpr::chubby::StaleRead* stale_read) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.stale_read_;
+  }
+  if (stale_read) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(stale_read);
+    if (message_arena != submessage_arena) {
+      stale_read = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, stale_read, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.stale_read_ = stale_read;
+  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.ScanRequest.stale_read)
+}
+
+// -------------------------------------------------------------------
+
+// ScanItem
+
+// string key = 1;
+inline void ScanItem::clear_key() {
+  _impl_.key_.ClearToEmpty();
+}
+inline const std::string& ScanItem::key() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.ScanItem.key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ScanItem::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpr.chubby.ScanItem.key)
+}
+inline std::string* ScanItem::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.ScanItem.key)
+  return _s;
+}
+inline const std::string& ScanItem::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void ScanItem::_internal_set_key(const std::string& value) {
+  
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ScanItem::_internal_mutable_key() {
+  
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ScanItem::release_key() {
+  // @@protoc_insertion_point(field_release:mpr.chubby.ScanItem.key)
+  return _impl_.key_.Release();
+}
+inline void ScanItem::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.ScanItem.key)
+}
+
+// bytes value = 2;
+inline void ScanItem::clear_value() {
+  _impl_.value_.ClearToEmpty();
+}
+inline const std::string& ScanItem::value() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.ScanItem.value)
+  return _internal_value();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ScanItem::set_value(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.value_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpr.chubby.ScanItem.value)
+}
+inline std::string* ScanItem::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.ScanItem.value)
+  return _s;
+}
+inline const std::string& ScanItem::_internal_value() const {
+  return _impl_.value_.Get();
+}
+inline void ScanItem::_internal_set_value(const std::string& value) {
+  
+  _impl_.value_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ScanItem::_internal_mutable_value() {
+  
+  return _impl_.value_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ScanItem::release_value() {
+  // @@protoc_insertion_point(field_release:mpr.chubby.ScanItem.value)
+  return _impl_.value_.Release();
+}
+inline void ScanItem::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.ScanItem.value)
+}
+
+// -------------------------------------------------------------------
+
+// ScanResponse
+
+// bool has_more = 1;
+inline void ScanResponse::clear_has_more() {
+  _impl_.has_more_ = false;
+}
+inline bool ScanResponse::_internal_has_more() const {
+  return _impl_.has_more_;
+}
+inline bool ScanResponse::has_more() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.ScanResponse.has_more)
+  return _internal_has_more();
+}
+inline void ScanResponse::_internal_set_has_more(bool value) {
+  
+  _impl_.has_more_ = value;
+}
+inline void ScanResponse::set_has_more(bool value) {
+  _internal_set_has_more(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.ScanResponse.has_more)
+}
+
+// repeated .mpr.chubby.ScanItem items = 2;
+inline int ScanResponse::_internal_items_size() const {
+  return _impl_.items_.size();
+}
+inline int ScanResponse::items_size() const {
+  return _internal_items_size();
+}
+inline void ScanResponse::clear_items() {
+  _impl_.items_.Clear();
+}
+inline ::mpr::chubby::ScanItem* ScanResponse::mutable_items(int index) {
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.ScanResponse.items)
+  return _impl_.items_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::mpr::chubby::ScanItem >*
+ScanResponse::mutable_items() {
+  // @@protoc_insertion_point(field_mutable_list:mpr.chubby.ScanResponse.items)
+  return &_impl_.items_;
+}
+inline const ::mpr::chubby::ScanItem& ScanResponse::_internal_items(int index) const {
+  return _impl_.items_.Get(index);
+}
+inline const ::mpr::chubby::ScanItem& ScanResponse::items(int index) const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.ScanResponse.items)
+  return _internal_items(index);
+}
+inline ::mpr::chubby::ScanItem* ScanResponse::_internal_add_items() {
+  return _impl_.items_.Add();
+}
+inline ::mpr::chubby::ScanItem* ScanResponse::add_items() {
+  ::mpr::chubby::ScanItem* _add = _internal_add_items();
+  // @@protoc_insertion_point(field_add:mpr.chubby.ScanResponse.items)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::mpr::chubby::ScanItem >&
+ScanResponse::items() const {
+  // @@protoc_insertion_point(field_list:mpr.chubby.ScanResponse.items)
+  return _impl_.items_;
+}
 
-// optional string username = 1;
-inline void UserInfo::clear_username() {
-  username_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// string leader_id = 3;
+inline void ScanResponse::clear_leader_id() {
+  _impl_.leader_id_.ClearToEmpty();
 }
-inline const ::std::string& UserInfo::username() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.UserInfo.username)
-  return username_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline const std::string& ScanResponse::leader_id() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.ScanResponse.leader_id)
+  return _internal_leader_id();
 }
-inline void UserInfo::set_username(const ::std::string& value) {
-  
-  username_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:mpr.chubby.UserInfo.username)
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ScanResponse::set_leader_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.leader_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpr.chubby.ScanResponse.leader_id)
 }
-inline void UserInfo::set_username(const char* value) {
-  
-  username_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:mpr.chubby.UserInfo.username)
+inline std::string* ScanResponse::mutable_leader_id() {
+  std::string* _s = _internal_mutable_leader_id();
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.ScanResponse.leader_id)
+  return _s;
 }
-inline void UserInfo::set_username(const char* value, size_t size) {
-  
-  username_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:mpr.chubby.UserInfo.username)
+inline const std::string& ScanResponse::_internal_leader_id() const {
+  return _impl_.leader_id_.Get();
 }
-inline ::std::string* UserInfo::mutable_username() {
+inline void ScanResponse::_internal_set_leader_id(const std::string& value) {
   
-  // @@protoc_insertion_point(field_mutable:mpr.chubby.UserInfo.username)
-  return username_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.leader_id_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* UserInfo::release_username() {
-  // @@protoc_insertion_point(field_release:mpr.chubby.UserInfo.username)
+inline std::string* ScanResponse::_internal_mutable_leader_id() {
   
-  return username_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.leader_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ScanResponse::release_leader_id() {
+  // @@protoc_insertion_point(field_release:mpr.chubby.ScanResponse.leader_id)
+  return _impl_.leader_id_.Release();
 }
-inline void UserInfo::set_allocated_username(::std::string* username) {
-  if (username != NULL) {
+inline void ScanResponse::set_allocated_leader_id(std::string* leader_id) {
+  if (leader_id != nullptr) {
     
   } else {
     
   }
-  username_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), username);
-  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.UserInfo.username)
+  _impl_.leader_id_.SetAllocated(leader_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.leader_id_.IsDefault()) {
+    _impl_.leader_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.ScanResponse.leader_id)
 }
 
-// optional string password = 2;
-inline void UserInfo::clear_password() {
-  password_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// bool success = 4;
+inline void ScanResponse::clear_success() {
+  _impl_.success_ = false;
 }
-inline const ::std::string& UserInfo::password() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.UserInfo.password)
-  return password_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline bool ScanResponse::_internal_success() const {
+  return _impl_.success_;
 }
-inline void UserInfo::set_password(const ::std::string& value) {
-  
-  password_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:mpr.chubby.UserInfo.password)
+inline bool ScanResponse::success() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.ScanResponse.success)
+  return _internal_success();
 }
-inline void UserInfo::set_password(const char* value) {
+inline void ScanResponse::_internal_set_success(bool value) {
   
-  password_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:mpr.chubby.UserInfo.password)
+  _impl_.success_ = value;
 }
-inline void UserInfo::set_password(const char* value, size_t size) {
-  
-  password_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:mpr.chubby.UserInfo.password)
+inline void ScanResponse::set_success(bool value) {
+  _internal_set_success(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.ScanResponse.success)
+}
+
+// bool uuid_expired = 5;
+inline void ScanResponse::clear_uuid_expired() {
+  _impl_.uuid_expired_ = false;
+}
+inline bool ScanResponse::_internal_uuid_expired() const {
+  return _impl_.uuid_expired_;
+}
+inline bool ScanResponse::uuid_expired() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.ScanResponse.uuid_expired)
+  return _internal_uuid_expired();
 }
-inline ::std::string* UserInfo::mutable_password() {
+inline void ScanResponse::_internal_set_uuid_expired(bool value) {
   
-  // @@protoc_insertion_point(field_mutable:mpr.chubby.UserInfo.password)
-  return password_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.uuid_expired_ = value;
 }
-inline ::std::string* UserInfo::release_password() {
-  // @@protoc_insertion_point(field_release:mpr.chubby.UserInfo.password)
+inline void ScanResponse::set_uuid_expired(bool value) {
+  _internal_set_uuid_expired(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.ScanResponse.uuid_expired)
+}
+
+// int64 last_applied = 6;
+inline void ScanResponse::clear_last_applied() {
+  _impl_.last_applied_ = int64_t{0};
+}
+inline int64_t ScanResponse::_internal_last_applied() const {
+  return _impl_.last_applied_;
+}
+inline int64_t ScanResponse::last_applied() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.ScanResponse.last_applied)
+  return _internal_last_applied();
+}
+inline void ScanResponse::_internal_set_last_applied(int64_t value) {
   
-  return password_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.last_applied_ = value;
 }
-inline void UserInfo::set_allocated_password(::std::string* password) {
-  if (password != NULL) {
-    
-  } else {
-    
-  }
-  password_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), password);
-  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.UserInfo.password)
+inline void ScanResponse::set_last_applied(int64_t value) {
+  _internal_set_last_applied(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.ScanResponse.last_applied)
 }
 
 // -------------------------------------------------------------------
 
-// Entry
+// LockRequest
 
-// optional string key = 1;
-inline void Entry::clear_key() {
-  key_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// string key = 1;
+inline void LockRequest::clear_key() {
+  _impl_.key_.ClearToEmpty();
 }
-inline const ::std::string& Entry::key() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.Entry.key)
-  return key_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline const std::string& LockRequest::key() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.LockRequest.key)
+  return _internal_key();
 }
-inline void Entry::set_key(const ::std::string& value) {
-  
-  key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:mpr.chubby.Entry.key)
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void LockRequest::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpr.chubby.LockRequest.key)
 }
-inline void Entry::set_key(const char* value) {
-  
-  key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:mpr.chubby.Entry.key)
+inline std::string* LockRequest::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.LockRequest.key)
+  return _s;
 }
-inline void Entry::set_key(const char* value, size_t size) {
-  
-  key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:mpr.chubby.Entry.key)
+inline const std::string& LockRequest::_internal_key() const {
+  return _impl_.key_.Get();
 }
-inline ::std::string* Entry::mutable_key() {
+inline void LockRequest::_internal_set_key(const std::string& value) {
   
-  // @@protoc_insertion_point(field_mutable:mpr.chubby.Entry.key)
-  return key_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.key_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* Entry::release_key() {
-  // @@protoc_insertion_point(field_release:mpr.chubby.Entry.key)
+inline std::string* LockRequest::_internal_mutable_key() {
   
-  return key_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* LockRequest::release_key() {
+  // @@protoc_insertion_point(field_release:mpr.chubby.LockRequest.key)
+  return _impl_.key_.Release();
 }
-inline void Entry::set_allocated_key(::std::string* key) {
-  if (key != NULL) {
+inline void LockRequest::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
     
   } else {
     
   }
-  key_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), key);
-  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.Entry.key)
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.LockRequest.key)
 }
 
-// optional bytes value = 2;
-inline void Entry::clear_value() {
-  value_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// string session_id = 2;
+inline void LockRequest::clear_session_id() {
+  _impl_.session_id_.ClearToEmpty();
 }
-inline const ::std::string& Entry::value() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.Entry.value)
-  return value_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline const std::string& LockRequest::session_id() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.LockRequest.session_id)
+  return _internal_session_id();
 }
-inline void Entry::set_value(const ::std::string& value) {
-  
-  value_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:mpr.chubby.Entry.value)
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void LockRequest::set_session_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.session_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpr.chubby.LockRequest.session_id)
 }
-inline void Entry::set_value(const char* value) {
-  
-  value_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:mpr.chubby.Entry.value)
+inline std::string* LockRequest::mutable_session_id() {
+  std::string* _s = _internal_mutable_session_id();
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.LockRequest.session_id)
+  return _s;
 }
-inline void Entry::set_value(const void* value, size_t size) {
-  
-  value_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:mpr.chubby.Entry.value)
+inline const std::string& LockRequest::_internal_session_id() const {
+  return _impl_.session_id_.Get();
 }
-inline ::std::string* Entry::mutable_value() {
+inline void LockRequest::_internal_set_session_id(const std::string& value) {
   
-  // @@protoc_insertion_point(field_mutable:mpr.chubby.Entry.value)
-  return value_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.session_id_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* Entry::release_value() {
-  // @@protoc_insertion_point(field_release:mpr.chubby.Entry.value)
+inline std::string* LockRequest::_internal_mutable_session_id() {
   
-  return value_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.session_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* LockRequest::release_session_id() {
+  // @@protoc_insertion_point(field_release:mpr.chubby.LockRequest.session_id)
+  return _impl_.session_id_.Release();
 }
-inline void Entry::set_allocated_value(::std::string* value) {
-  if (value != NULL) {
+inline void LockRequest::set_allocated_session_id(std::string* session_id) {
+  if (session_id != nullptr) {
     
   } else {
     
   }
-  value_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.Entry.value)
+  _impl_.session_id_.SetAllocated(session_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.session_id_.IsDefault()) {
+    _impl_.session_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.LockRequest.session_id)
 }
 
-// optional int64 term = 3;
-inline void Entry::clear_term() {
-  term_ = GOOGLE_LONGLONG(0);
+// string hostname = 3;
+inline void LockRequest::clear_hostname() {
+  _impl_.hostname_.ClearToEmpty();
 }
-inline ::google::protobuf::int64 Entry::term() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.Entry.term)
-  return term_;
+inline const std::string& LockRequest::hostname() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.LockRequest.hostname)
+  return _internal_hostname();
 }
-inline void Entry::set_term(::google::protobuf::int64 value) {
-  
-  term_ = value;
-  // @@protoc_insertion_point(field_set:mpr.chubby.Entry.term)
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void LockRequest::set_hostname(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.hostname_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpr.chubby.LockRequest.hostname)
 }
-
-// optional .mpr.chubby.LogOperation op = 4;
-inline void Entry::clear_op() {
-  op_ = 0;
+inline std::string* LockRequest::mutable_hostname() {
+  std::string* _s = _internal_mutable_hostname();
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.LockRequest.hostname)
+  return _s;
 }
-inline ::mpr::chubby::LogOperation Entry::op() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.Entry.op)
-  return static_cast< ::mpr::chubby::LogOperation >(op_);
+inline const std::string& LockRequest::_internal_hostname() const {
+  return _impl_.hostname_.Get();
 }
-inline void Entry::set_op(::mpr::chubby::LogOperation value) {
+inline void LockRequest::_internal_set_hostname(const std::string& value) {
   
-  op_ = value;
-  // @@protoc_insertion_point(field_set:mpr.chubby.Entry.op)
+  _impl_.hostname_.Set(value, GetArenaForAllocation());
+}
+inline std::string* LockRequest::_internal_mutable_hostname() {
+  
+  return _impl_.hostname_.Mutable(GetArenaForAllocation());
+}
+inline std::string* LockRequest::release_hostname() {
+  // @@protoc_insertion_point(field_release:mpr.chubby.LockRequest.hostname)
+  return _impl_.hostname_.Release();
+}
+inline void LockRequest::set_allocated_hostname(std::string* hostname) {
+  if (hostname != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.hostname_.SetAllocated(hostname, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.hostname_.IsDefault()) {
+    _impl_.hostname_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.LockRequest.hostname)
 }
 
-// optional string user = 5;
-inline void Entry::clear_user() {
-  user_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// string uuid = 4;
+inline void LockRequest::clear_uuid() {
+  _impl_.uuid_.ClearToEmpty();
 }
-inline const ::std::string& Entry::user() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.Entry.user)
-  return user_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline const std::string& LockRequest::uuid() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.LockRequest.uuid)
+  return _internal_uuid();
 }
-inline void Entry::set_user(const ::std::string& value) {
-  
-  user_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:mpr.chubby.Entry.user)
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void LockRequest::set_uuid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.uuid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpr.chubby.LockRequest.uuid)
 }
-inline void Entry::set_user(const char* value) {
-  
-  user_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:mpr.chubby.Entry.user)
+inline std::string* LockRequest::mutable_uuid() {
+  std::string* _s = _internal_mutable_uuid();
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.LockRequest.uuid)
+  return _s;
 }
-inline void Entry::set_user(const char* value, size_t size) {
-  
-  user_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:mpr.chubby.Entry.user)
+inline const std::string& LockRequest::_internal_uuid() const {
+  return _impl_.uuid_.Get();
 }
-inline ::std::string* Entry::mutable_user() {
+inline void LockRequest::_internal_set_uuid(const std::string& value) {
   
-  // @@protoc_insertion_point(field_mutable:mpr.chubby.Entry.user)
-  return user_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.uuid_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* Entry::release_user() {
-  // @@protoc_insertion_point(field_release:mpr.chubby.Entry.user)
+inline std::string* LockRequest::_internal_mutable_uuid() {
   
-  return user_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.uuid_.Mutable(GetArenaForAllocation());
 }
-inline void Entry::set_allocated_user(::std::string* user) {
-  if (user != NULL) {
+inline std::string* LockRequest::release_uuid() {
+  // @@protoc_insertion_point(field_release:mpr.chubby.LockRequest.uuid)
+  return _impl_.uuid_.Release();
+}
+inline void LockRequest::set_allocated_uuid(std::string* uuid) {
+  if (uuid != nullptr) {
     
   } else {
     
   }
-  user_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), user);
-  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.Entry.user)
+  _impl_.uuid_.SetAllocated(uuid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.uuid_.IsDefault()) {
+    _impl_.uuid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.LockRequest.uuid)
 }
 
-// -------------------------------------------------------------------
-
-// StatInfo
-
-// optional int64 current_stat = 1;
-inline void StatInfo::clear_current_stat() {
-  current_stat_ = GOOGLE_LONGLONG(0);
+// int64 wait_timeout_ms = 5;
+inline void LockRequest::clear_wait_timeout_ms() {
+  _impl_.wait_timeout_ms_ = int64_t{0};
 }
-inline ::google::protobuf::int64 StatInfo::current_stat() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.StatInfo.current_stat)
-  return current_stat_;
+inline int64_t LockRequest::_internal_wait_timeout_ms() const {
+  return _impl_.wait_timeout_ms_;
+}
+inline int64_t LockRequest::wait_timeout_ms() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.LockRequest.wait_timeout_ms)
+  return _internal_wait_timeout_ms();
 }
-inline void StatInfo::set_current_stat(::google::protobuf::int64 value) {
+inline void LockRequest::_internal_set_wait_timeout_ms(int64_t value) {
   
-  current_stat_ = value;
-  // @@protoc_insertion_point(field_set:mpr.chubby.StatInfo.current_stat)
+  _impl_.wait_timeout_ms_ = value;
+}
+inline void LockRequest::set_wait_timeout_ms(int64_t value) {
+  _internal_set_wait_timeout_ms(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.LockRequest.wait_timeout_ms)
 }
 
-// optional int64 average_stat = 2;
-inline void StatInfo::clear_average_stat() {
-  average_stat_ = GOOGLE_LONGLONG(0);
+// string request_id = 6;
+inline void LockRequest::clear_request_id() {
+  _impl_.request_id_.ClearToEmpty();
 }
-inline ::google::protobuf::int64 StatInfo::average_stat() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.StatInfo.average_stat)
-  return average_stat_;
+inline const std::string& LockRequest::request_id() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.LockRequest.request_id)
+  return _internal_request_id();
 }
-inline void StatInfo::set_average_stat(::google::protobuf::int64 value) {
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void LockRequest::set_request_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.request_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpr.chubby.LockRequest.request_id)
+}
+inline std::string* LockRequest::mutable_request_id() {
+  std::string* _s = _internal_mutable_request_id();
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.LockRequest.request_id)
+  return _s;
+}
+inline const std::string& LockRequest::_internal_request_id() const {
+  return _impl_.request_id_.Get();
+}
+inline void LockRequest::_internal_set_request_id(const std::string& value) {
   
-  average_stat_ = value;
-  // @@protoc_insertion_point(field_set:mpr.chubby.StatInfo.average_stat)
+  _impl_.request_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* LockRequest::_internal_mutable_request_id() {
+  
+  return _impl_.request_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* LockRequest::release_request_id() {
+  // @@protoc_insertion_point(field_release:mpr.chubby.LockRequest.request_id)
+  return _impl_.request_id_.Release();
+}
+inline void LockRequest::set_allocated_request_id(std::string* request_id) {
+  if (request_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.request_id_.SetAllocated(request_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.request_id_.IsDefault()) {
+    _impl_.request_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.LockRequest.request_id)
 }
 
 // -------------------------------------------------------------------
 
-// AppendEntriesRequest
+// LockResponse
 
-// optional int64 term = 1;
-inline void AppendEntriesRequest::clear_term() {
-  term_ = GOOGLE_LONGLONG(0);
+// bool success = 1;
+inline void LockResponse::clear_success() {
+  _impl_.success_ = false;
 }
-inline ::google::protobuf::int64 AppendEntriesRequest::term() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.AppendEntriesRequest.term)
-  return term_;
+inline bool LockResponse::_internal_success() const {
+  return _impl_.success_;
+}
+inline bool LockResponse::success() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.LockResponse.success)
+  return _internal_success();
 }
-inline void AppendEntriesRequest::set_term(::google::protobuf::int64 value) {
+inline void LockResponse::_internal_set_success(bool value) {
   
-  term_ = value;
-  // @@protoc_insertion_point(field_set:mpr.chubby.AppendEntriesRequest.term)
+  _impl_.success_ = value;
+}
+inline void LockResponse::set_success(bool value) {
+  _internal_set_success(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.LockResponse.success)
 }
 
-// optional string leader_id = 2;
-inline void AppendEntriesRequest::clear_leader_id() {
-  leader_id_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// string leader_id = 2;
+inline void LockResponse::clear_leader_id() {
+  _impl_.leader_id_.ClearToEmpty();
 }
-inline const ::std::string& AppendEntriesRequest::leader_id() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.AppendEntriesRequest.leader_id)
-  return leader_id_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline const std::string& LockResponse::leader_id() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.LockResponse.leader_id)
+  return _internal_leader_id();
 }
-inline void AppendEntriesRequest::set_leader_id(const ::std::string& value) {
-  
-  leader_id_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:mpr.chubby.AppendEntriesRequest.leader_id)
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void LockResponse::set_leader_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.leader_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpr.chubby.LockResponse.leader_id)
 }
-inline void AppendEntriesRequest::set_leader_id(const char* value) {
-  
-  leader_id_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:mpr.chubby.AppendEntriesRequest.leader_id)
+inline std::string* LockResponse::mutable_leader_id() {
+  std::string* _s = _internal_mutable_leader_id();
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.LockResponse.leader_id)
+  return _s;
 }
-inline void AppendEntriesRequest::set_leader_id(const char* value, size_t size) {
-  
-  leader_id_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:mpr.chubby.AppendEntriesRequest.leader_id)
+inline const std::string& LockResponse::_internal_leader_id() const {
+  return _impl_.leader_id_.Get();
 }
-inline ::std::string* AppendEntriesRequest::mutable_leader_id() {
+inline void LockResponse::_internal_set_leader_id(const std::string& value) {
   
-  // @@protoc_insertion_point(field_mutable:mpr.chubby.AppendEntriesRequest.leader_id)
-  return leader_id_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.leader_id_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* AppendEntriesRequest::release_leader_id() {
-  // @@protoc_insertion_point(field_release:mpr.chubby.AppendEntriesRequest.leader_id)
+inline std::string* LockResponse::_internal_mutable_leader_id() {
   
-  return leader_id_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.leader_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* LockResponse::release_leader_id() {
+  // @@protoc_insertion_point(field_release:mpr.chubby.LockResponse.leader_id)
+  return _impl_.leader_id_.Release();
 }
-inline void AppendEntriesRequest::set_allocated_leader_id(::std::string* leader_id) {
-  if (leader_id != NULL) {
+inline void LockResponse::set_allocated_leader_id(std::string* leader_id) {
+  if (leader_id != nullptr) {
     
   } else {
     
   }
-  leader_id_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), leader_id);
-  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.AppendEntriesRequest.leader_id)
+  _impl_.leader_id_.SetAllocated(leader_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.leader_id_.IsDefault()) {
+    _impl_.leader_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.LockResponse.leader_id)
 }
 
-// optional int64 prev_log_index = 3;
-inline void AppendEntriesRequest::clear_prev_log_index() {
-  prev_log_index_ = GOOGLE_LONGLONG(0);
+// bool uuid_expired = 3;
+inline void LockResponse::clear_uuid_expired() {
+  _impl_.uuid_expired_ = false;
 }
-inline ::google::protobuf::int64 AppendEntriesRequest::prev_log_index() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.AppendEntriesRequest.prev_log_index)
-  return prev_log_index_;
+inline bool LockResponse::_internal_uuid_expired() const {
+  return _impl_.uuid_expired_;
+}
+inline bool LockResponse::uuid_expired() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.LockResponse.uuid_expired)
+  return _internal_uuid_expired();
 }
-inline void AppendEntriesRequest::set_prev_log_index(::google::protobuf::int64 value) {
+inline void LockResponse::_internal_set_uuid_expired(bool value) {
   
-  prev_log_index_ = value;
-  // @@protoc_insertion_point(field_set:mpr.chubby.AppendEntriesRequest.prev_log_index)
+  _impl_.uuid_expired_ = value;
+}
+inline void LockResponse::set_uuid_expired(bool value) {
+  _internal_set_uuid_expired(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.LockResponse.uuid_expired)
 }
 
-// optional int64 prev_log_term = 4;
-inline void AppendEntriesRequest::clear_prev_log_term() {
-  prev_log_term_ = GOOGLE_LONGLONG(0);
+// -------------------------------------------------------------------
+
+// KeepAliveRequest
+
+// string session_id = 1;
+inline void KeepAliveRequest::clear_session_id() {
+  _impl_.session_id_.ClearToEmpty();
 }
-inline ::google::protobuf::int64 AppendEntriesRequest::prev_log_term() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.AppendEntriesRequest.prev_log_term)
-  return prev_log_term_;
+inline const std::string& KeepAliveRequest::session_id() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.KeepAliveRequest.session_id)
+  return _internal_session_id();
 }
-inline void AppendEntriesRequest::set_prev_log_term(::google::protobuf::int64 value) {
-  
-  prev_log_term_ = value;
-  // @@protoc_insertion_point(field_set:mpr.chubby.AppendEntriesRequest.prev_log_term)
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void KeepAliveRequest::set_session_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.session_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpr.chubby.KeepAliveRequest.session_id)
 }
-
-// optional int64 leader_commit_index = 5;
-inline void AppendEntriesRequest::clear_leader_commit_index() {
-  leader_commit_index_ = GOOGLE_LONGLONG(0);
+inline std::string* KeepAliveRequest::mutable_session_id() {
+  std::string* _s = _internal_mutable_session_id();
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.KeepAliveRequest.session_id)
+  return _s;
 }
-inline ::google::protobuf::int64 AppendEntriesRequest::leader_commit_index() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.AppendEntriesRequest.leader_commit_index)
-  return leader_commit_index_;
+inline const std::string& KeepAliveRequest::_internal_session_id() const {
+  return _impl_.session_id_.Get();
 }
-inline void AppendEntriesRequest::set_leader_commit_index(::google::protobuf::int64 value) {
+inline void KeepAliveRequest::_internal_set_session_id(const std::string& value) {
   
-  leader_commit_index_ = value;
-  // @@protoc_insertion_point(field_set:mpr.chubby.AppendEntriesRequest.leader_commit_index)
+  _impl_.session_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* KeepAliveRequest::_internal_mutable_session_id() {
+  
+  return _impl_.session_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* KeepAliveRequest::release_session_id() {
+  // @@protoc_insertion_point(field_release:mpr.chubby.KeepAliveRequest.session_id)
+  return _impl_.session_id_.Release();
+}
+inline void KeepAliveRequest::set_allocated_session_id(std::string* session_id) {
+  if (session_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.session_id_.SetAllocated(session_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.session_id_.IsDefault()) {
+    _impl_.session_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.KeepAliveRequest.session_id)
 }
 
-// repeated .mpr.chubby.Entry entries = 6;
-inline int AppendEntriesRequest::entries_size() const {
-  return entries_.size();
+// string uuid = 2;
+inline void KeepAliveRequest::clear_uuid() {
+  _impl_.uuid_.ClearToEmpty();
 }
-inline void AppendEntriesRequest::clear_entries() {
-  entries_.Clear();
+inline const std::string& KeepAliveRequest::uuid() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.KeepAliveRequest.uuid)
+  return _internal_uuid();
 }
-inline const ::mpr::chubby::Entry& AppendEntriesRequest::entries(int index) const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.AppendEntriesRequest.entries)
-  return entries_.Get(index);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void KeepAliveRequest::set_uuid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.uuid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpr.chubby.KeepAliveRequest.uuid)
 }
-inline ::mpr::chubby::Entry* AppendEntriesRequest::mutable_entries(int index) {
-  // @@protoc_insertion_point(field_mutable:mpr.chubby.AppendEntriesRequest.entries)
-  return entries_.Mutable(index);
+inline std::string* KeepAliveRequest::mutable_uuid() {
+  std::string* _s = _internal_mutable_uuid();
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.KeepAliveRequest.uuid)
+  return _s;
 }
-inline ::mpr::chubby::Entry* AppendEntriesRequest::add_entries() {
-  // @@protoc_insertion_point(field_add:mpr.chubby.AppendEntriesRequest.entries)
-  return entries_.Add();
+inline const std::string& KeepAliveRequest::_internal_uuid() const {
+  return _impl_.uuid_.Get();
 }
-inline ::google::protobuf::RepeatedPtrField< ::mpr::chubby::Entry >*
-AppendEntriesRequest::mutable_entries() {
-  // @@protoc_insertion_point(field_mutable_list:mpr.chubby.AppendEntriesRequest.entries)
-  return &entries_;
+inline void KeepAliveRequest::_internal_set_uuid(const std::string& value) {
+  
+  _impl_.uuid_.Set(value, GetArenaForAllocation());
 }
-inline const ::google::protobuf::RepeatedPtrField< ::mpr::chubby::Entry >&
-AppendEntriesRequest::entries() const {
-  // @@protoc_insertion_point(field_list:mpr.chubby.AppendEntriesRequest.entries)
-  return entries_;
+inline std::string* KeepAliveRequest::_internal_mutable_uuid() {
+  
+  return _impl_.uuid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* KeepAliveRequest::release_uuid() {
+  // @@protoc_insertion_point(field_release:mpr.chubby.KeepAliveRequest.uuid)
+  return _impl_.uuid_.Release();
+}
+inline void KeepAliveRequest::set_allocated_uuid(std::string* uuid) {
+  if (uuid != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.uuid_.SetAllocated(uuid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.uuid_.IsDefault()) {
+    _impl_.uuid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.KeepAliveRequest.uuid)
 }
 
-// -------------------------------------------------------------------
-
-// AppendEntriesResponse
-
-// optional int64 current_term = 1;
-inline void AppendEntriesResponse::clear_current_term() {
-  current_term_ = GOOGLE_LONGLONG(0);
+// repeated string locks = 3;
+inline int KeepAliveRequest::_internal_locks_size() const {
+  return _impl_.locks_.size();
+}
+inline int KeepAliveRequest::locks_size() const {
+  return _internal_locks_size();
+}
+inline void KeepAliveRequest::clear_locks() {
+  _impl_.locks_.Clear();
 }
-inline ::google::protobuf::int64 AppendEntriesResponse::current_term() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.AppendEntriesResponse.current_term)
-  return current_term_;
+inline std::string* KeepAliveRequest::add_locks() {
+  std::string* _s = _internal_add_locks();
+  // @@protoc_insertion_point(field_add_mutable:mpr.chubby.KeepAliveRequest.locks)
+  return _s;
 }
-inline void AppendEntriesResponse::set_current_term(::google::protobuf::int64 value) {
-  
-  current_term_ = value;
-  // @@protoc_insertion_point(field_set:mpr.chubby.AppendEntriesResponse.current_term)
+inline const std::string& KeepAliveRequest::_internal_locks(int index) const {
+  return _impl_.locks_.Get(index);
 }
-
-// optional bool success = 2;
-inline void AppendEntriesResponse::clear_success() {
-  success_ = false;
+inline const std::string& KeepAliveRequest::locks(int index) const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.KeepAliveRequest.locks)
+  return _internal_locks(index);
 }
-inline bool AppendEntriesResponse::success() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.AppendEntriesResponse.success)
-  return success_;
+inline std::string* KeepAliveRequest::mutable_locks(int index) {
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.KeepAliveRequest.locks)
+  return _impl_.locks_.Mutable(index);
 }
-inline void AppendEntriesResponse::set_success(bool value) {
-  
-  success_ = value;
-  // @@protoc_insertion_point(field_set:mpr.chubby.AppendEntriesResponse.success)
+inline void KeepAliveRequest::set_locks(int index, const std::string& value) {
+  _impl_.locks_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.KeepAliveRequest.locks)
 }
-
-// optional int64 log_length = 3;
-inline void AppendEntriesResponse::clear_log_length() {
-  log_length_ = GOOGLE_LONGLONG(0);
+inline void KeepAliveRequest::set_locks(int index, std::string&& value) {
+  _impl_.locks_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:mpr.chubby.KeepAliveRequest.locks)
 }
-inline ::google::protobuf::int64 AppendEntriesResponse::log_length() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.AppendEntriesResponse.log_length)
-  return log_length_;
+inline void KeepAliveRequest::set_locks(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.locks_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:mpr.chubby.KeepAliveRequest.locks)
 }
-inline void AppendEntriesResponse::set_log_length(::google::protobuf::int64 value) {
-  
-  log_length_ = value;
-  // @@protoc_insertion_point(field_set:mpr.chubby.AppendEntriesResponse.log_length)
+inline void KeepAliveRequest::set_locks(int index, const char* value, size_t size) {
+  _impl_.locks_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:mpr.chubby.KeepAliveRequest.locks)
 }
-
-// optional bool is_busy = 4;
-inline void AppendEntriesResponse::clear_is_busy() {
-  is_busy_ = false;
+inline std::string* KeepAliveRequest::_internal_add_locks() {
+  return _impl_.locks_.Add();
 }
-inline bool AppendEntriesResponse::is_busy() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.AppendEntriesResponse.is_busy)
-  return is_busy_;
+inline void KeepAliveRequest::add_locks(const std::string& value) {
+  _impl_.locks_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:mpr.chubby.KeepAliveRequest.locks)
 }
-inline void AppendEntriesResponse::set_is_busy(bool value) {
-  
-  is_busy_ = value;
-  // @@protoc_insertion_point(field_set:mpr.chubby.AppendEntriesResponse.is_busy)
+inline void KeepAliveRequest::add_locks(std::string&& value) {
+  _impl_.locks_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:mpr.chubby.KeepAliveRequest.locks)
 }
-
-// -------------------------------------------------------------------
-
-// VoteRequest
-
-// optional int64 term = 1;
-inline void VoteRequest::clear_term() {
-  term_ = GOOGLE_LONGLONG(0);
+inline void KeepAliveRequest::add_locks(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.locks_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:mpr.chubby.KeepAliveRequest.locks)
 }
-inline ::google::protobuf::int64 VoteRequest::term() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.VoteRequest.term)
-  return term_;
+inline void KeepAliveRequest::add_locks(const char* value, size_t size) {
+  _impl_.locks_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:mpr.chubby.KeepAliveRequest.locks)
 }
-inline void VoteRequest::set_term(::google::protobuf::int64 value) {
-  
-  term_ = value;
-  // @@protoc_insertion_point(field_set:mpr.chubby.VoteRequest.term)
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+KeepAliveRequest::locks() const {
+  // @@protoc_insertion_point(field_list:mpr.chubby.KeepAliveRequest.locks)
+  return _impl_.locks_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+KeepAliveRequest::mutable_locks() {
+  // @@protoc_insertion_point(field_mutable_list:mpr.chubby.KeepAliveRequest.locks)
+  return &_impl_.locks_;
 }
 
-// optional string candidate_id = 2;
-inline void VoteRequest::clear_candidate_id() {
-  candidate_id_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// bool forward_from_leader = 4;
+inline void KeepAliveRequest::clear_forward_from_leader() {
+  _impl_.forward_from_leader_ = false;
 }
-inline const ::std::string& VoteRequest::candidate_id() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.VoteRequest.candidate_id)
-  return candidate_id_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline bool KeepAliveRequest::_internal_forward_from_leader() const {
+  return _impl_.forward_from_leader_;
 }
-inline void VoteRequest::set_candidate_id(const ::std::string& value) {
-  
-  candidate_id_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:mpr.chubby.VoteRequest.candidate_id)
+inline bool KeepAliveRequest::forward_from_leader() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.KeepAliveRequest.forward_from_leader)
+  return _internal_forward_from_leader();
 }
-inline void VoteRequest::set_candidate_id(const char* value) {
+inline void KeepAliveRequest::_internal_set_forward_from_leader(bool value) {
   
-  candidate_id_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:mpr.chubby.VoteRequest.candidate_id)
+  _impl_.forward_from_leader_ = value;
 }
-inline void VoteRequest::set_candidate_id(const char* value, size_t size) {
-  
-  candidate_id_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:mpr.chubby.VoteRequest.candidate_id)
+inline void KeepAliveRequest::set_forward_from_leader(bool value) {
+  _internal_set_forward_from_leader(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.KeepAliveRequest.forward_from_leader)
 }
-inline ::std::string* VoteRequest::mutable_candidate_id() {
-  
-  // @@protoc_insertion_point(field_mutable:mpr.chubby.VoteRequest.candidate_id)
-  return candidate_id_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+
+// int64 acked_invalidation = 5;
+inline void KeepAliveRequest::clear_acked_invalidation() {
+  _impl_.acked_invalidation_ = int64_t{0};
 }
-inline ::std::string* VoteRequest::release_candidate_id() {
-  // @@protoc_insertion_point(field_release:mpr.chubby.VoteRequest.candidate_id)
+inline int64_t KeepAliveRequest::_internal_acked_invalidation() const {
+  return _impl_.acked_invalidation_;
+}
+inline int64_t KeepAliveRequest::acked_invalidation() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.KeepAliveRequest.acked_invalidation)
+  return _internal_acked_invalidation();
+}
+inline void KeepAliveRequest::_internal_set_acked_invalidation(int64_t value) {
   
-  return candidate_id_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.acked_invalidation_ = value;
 }
-inline void VoteRequest::set_allocated_candidate_id(::std::string* candidate_id) {
-  if (candidate_id != NULL) {
-    
-  } else {
-    
-  }
-  candidate_id_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), candidate_id);
-  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.VoteRequest.candidate_id)
+inline void KeepAliveRequest::set_acked_invalidation(int64_t value) {
+  _internal_set_acked_invalidation(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.KeepAliveRequest.acked_invalidation)
 }
 
-// optional int64 last_log_index = 3;
-inline void VoteRequest::clear_last_log_index() {
-  last_log_index_ = GOOGLE_LONGLONG(0);
+// int32 hold_ms = 6;
+inline void KeepAliveRequest::clear_hold_ms() {
+  _impl_.hold_ms_ = 0;
 }
-inline ::google::protobuf::int64 VoteRequest::last_log_index() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.VoteRequest.last_log_index)
-  return last_log_index_;
+inline int32_t KeepAliveRequest::_internal_hold_ms() const {
+  return _impl_.hold_ms_;
 }
-inline void VoteRequest::set_last_log_index(::google::protobuf::int64 value) {
+inline int32_t KeepAliveRequest::hold_ms() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.KeepAliveRequest.hold_ms)
+  return _internal_hold_ms();
+}
+inline void KeepAliveRequest::_internal_set_hold_ms(int32_t value) {
   
-  last_log_index_ = value;
-  // @@protoc_insertion_point(field_set:mpr.chubby.VoteRequest.last_log_index)
+  _impl_.hold_ms_ = value;
+}
+inline void KeepAliveRequest::set_hold_ms(int32_t value) {
+  _internal_set_hold_ms(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.KeepAliveRequest.hold_ms)
 }
 
-// optional int64 last_log_term = 4;
-inline void VoteRequest::clear_last_log_term() {
-  last_log_term_ = GOOGLE_LONGLONG(0);
+// int64 cache_incarnation = 7;
+inline void KeepAliveRequest::clear_cache_incarnation() {
+  _impl_.cache_incarnation_ = int64_t{0};
 }
-inline ::google::protobuf::int64 VoteRequest::last_log_term() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.VoteRequest.last_log_term)
-  return last_log_term_;
+inline int64_t KeepAliveRequest::_internal_cache_incarnation() const {
+  return _impl_.cache_incarnation_;
+}
+inline int64_t KeepAliveRequest::cache_incarnation() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.KeepAliveRequest.cache_incarnation)
+  return _internal_cache_incarnation();
 }
-inline void VoteRequest::set_last_log_term(::google::protobuf::int64 value) {
+inline void KeepAliveRequest::_internal_set_cache_incarnation(int64_t value) {
   
-  last_log_term_ = value;
-  // @@protoc_insertion_point(field_set:mpr.chubby.VoteRequest.last_log_term)
+  _impl_.cache_incarnation_ = value;
+}
+inline void KeepAliveRequest::set_cache_incarnation(int64_t value) {
+  _internal_set_cache_incarnation(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.KeepAliveRequest.cache_incarnation)
 }
 
 // -------------------------------------------------------------------
 
-// VoteResponse
+// KeepAliveResponse
 
-// optional int64 term = 1;
-inline void VoteResponse::clear_term() {
-  term_ = GOOGLE_LONGLONG(0);
-}
-inline ::google::protobuf::int64 VoteResponse::term() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.VoteResponse.term)
-  return term_;
-}
-inline void VoteResponse::set_term(::google::protobuf::int64 value) {
-  
-  term_ = value;
-  // @@protoc_insertion_point(field_set:mpr.chubby.VoteResponse.term)
+// bool success = 1;
+inline void KeepAliveResponse::clear_success() {
+  _impl_.success_ = false;
 }
-
-// optional bool vote_granted = 2;
-inline void VoteResponse::clear_vote_granted() {
-  vote_granted_ = false;
+inline bool KeepAliveResponse::_internal_success() const {
+  return _impl_.success_;
 }
-inline bool VoteResponse::vote_granted() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.VoteResponse.vote_granted)
-  return vote_granted_;
+inline bool KeepAliveResponse::success() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.KeepAliveResponse.success)
+  return _internal_success();
 }
-inline void VoteResponse::set_vote_granted(bool value) {
+inline void KeepAliveResponse::_internal_set_success(bool value) {
   
-  vote_granted_ = value;
-  // @@protoc_insertion_point(field_set:mpr.chubby.VoteResponse.vote_granted)
+  _impl_.success_ = value;
+}
+inline void KeepAliveResponse::set_success(bool value) {
+  _internal_set_success(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.KeepAliveResponse.success)
 }
 
-// -------------------------------------------------------------------
-
-// PutRequest
-
-// optional string key = 1;
-inline void PutRequest::clear_key() {
-  key_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// string leader_id = 2;
+inline void KeepAliveResponse::clear_leader_id() {
+  _impl_.leader_id_.ClearToEmpty();
 }
-inline const ::std::string& PutRequest::key() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.PutRequest.key)
-  return key_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline const std::string& KeepAliveResponse::leader_id() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.KeepAliveResponse.leader_id)
+  return _internal_leader_id();
 }
-inline void PutRequest::set_key(const ::std::string& value) {
-  
-  key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:mpr.chubby.PutRequest.key)
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void KeepAliveResponse::set_leader_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.leader_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpr.chubby.KeepAliveResponse.leader_id)
 }
-inline void PutRequest::set_key(const char* value) {
-  
-  key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:mpr.chubby.PutRequest.key)
+inline std::string* KeepAliveResponse::mutable_leader_id() {
+  std::string* _s = _internal_mutable_leader_id();
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.KeepAliveResponse.leader_id)
+  return _s;
 }
-inline void PutRequest::set_key(const char* value, size_t size) {
-  
-  key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:mpr.chubby.PutRequest.key)
+inline const std::string& KeepAliveResponse::_internal_leader_id() const {
+  return _impl_.leader_id_.Get();
 }
-inline ::std::string* PutRequest::mutable_key() {
+inline void KeepAliveResponse::_internal_set_leader_id(const std::string& value) {
   
-  // @@protoc_insertion_point(field_mutable:mpr.chubby.PutRequest.key)
-  return key_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.leader_id_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* PutRequest::release_key() {
-  // @@protoc_insertion_point(field_release:mpr.chubby.PutRequest.key)
+inline std::string* KeepAliveResponse::_internal_mutable_leader_id() {
   
-  return key_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.leader_id_.Mutable(GetArenaForAllocation());
 }
-inline void PutRequest::set_allocated_key(::std::string* key) {
-  if (key != NULL) {
+inline std::string* KeepAliveResponse::release_leader_id() {
+  // @@protoc_insertion_point(field_release:mpr.chubby.KeepAliveResponse.leader_id)
+  return _impl_.leader_id_.Release();
+}
+inline void KeepAliveResponse::set_allocated_leader_id(std::string* leader_id) {
+  if (leader_id != nullptr) {
     
   } else {
     
   }
-  key_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), key);
-  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.PutRequest.key)
+  _impl_.leader_id_.SetAllocated(leader_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.leader_id_.IsDefault()) {
+    _impl_.leader_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.KeepAliveResponse.leader_id)
 }
 
-// optional bytes value = 2;
-inline void PutRequest::clear_value() {
-  value_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-inline const ::std::string& PutRequest::value() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.PutRequest.value)
-  return value_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// repeated string invalidations = 3;
+inline int KeepAliveResponse::_internal_invalidations_size() const {
+  return _impl_.invalidations_.size();
 }
-inline void PutRequest::set_value(const ::std::string& value) {
-  
-  value_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:mpr.chubby.PutRequest.value)
+inline int KeepAliveResponse::invalidations_size() const {
+  return _internal_invalidations_size();
 }
-inline void PutRequest::set_value(const char* value) {
-  
-  value_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:mpr.chubby.PutRequest.value)
+inline void KeepAliveResponse::clear_invalidations() {
+  _impl_.invalidations_.Clear();
 }
-inline void PutRequest::set_value(const void* value, size_t size) {
-  
-  value_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:mpr.chubby.PutRequest.value)
+inline std::string* KeepAliveResponse::add_invalidations() {
+  std::string* _s = _internal_add_invalidations();
+  // @@protoc_insertion_point(field_add_mutable:mpr.chubby.KeepAliveResponse.invalidations)
+  return _s;
 }
-inline ::std::string* PutRequest::mutable_value() {
-  
-  // @@protoc_insertion_point(field_mutable:mpr.chubby.PutRequest.value)
-  return value_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline const std::string& KeepAliveResponse::_internal_invalidations(int index) const {
+  return _impl_.invalidations_.Get(index);
 }
-inline ::std::string* PutRequest::release_value() {
-  // @@protoc_insertion_point(field_release:mpr.chubby.PutRequest.value)
-  
-  return value_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline const std::string& KeepAliveResponse::invalidations(int index) const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.KeepAliveResponse.invalidations)
+  return _internal_invalidations(index);
 }
-inline void PutRequest::set_allocated_value(::std::string* value) {
-  if (value != NULL) {
-    
-  } else {
-    
-  }
-  value_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.PutRequest.value)
+inline std::string* KeepAliveResponse::mutable_invalidations(int index) {
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.KeepAliveResponse.invalidations)
+  return _impl_.invalidations_.Mutable(index);
 }
-
-// optional string uuid = 3;
-inline void PutRequest::clear_uuid() {
-  uuid_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void KeepAliveResponse::set_invalidations(int index, const std::string& value) {
+  _impl_.invalidations_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.KeepAliveResponse.invalidations)
 }
-inline const ::std::string& PutRequest::uuid() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.PutRequest.uuid)
-  return uuid_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void KeepAliveResponse::set_invalidations(int index, std::string&& value) {
+  _impl_.invalidations_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:mpr.chubby.KeepAliveResponse.invalidations)
 }
-inline void PutRequest::set_uuid(const ::std::string& value) {
-  
-  uuid_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:mpr.chubby.PutRequest.uuid)
+inline void KeepAliveResponse::set_invalidations(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.invalidations_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:mpr.chubby.KeepAliveResponse.invalidations)
 }
-inline void PutRequest::set_uuid(const char* value) {
-  
-  uuid_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:mpr.chubby.PutRequest.uuid)
+inline void KeepAliveResponse::set_invalidations(int index, const char* value, size_t size) {
+  _impl_.invalidations_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:mpr.chubby.KeepAliveResponse.invalidations)
 }
-inline void PutRequest::set_uuid(const char* value, size_t size) {
-  
-  uuid_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:mpr.chubby.PutRequest.uuid)
+inline std::string* KeepAliveResponse::_internal_add_invalidations() {
+  return _impl_.invalidations_.Add();
 }
-inline ::std::string* PutRequest::mutable_uuid() {
-  
-  // @@protoc_insertion_point(field_mutable:mpr.chubby.PutRequest.uuid)
-  return uuid_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void KeepAliveResponse::add_invalidations(const std::string& value) {
+  _impl_.invalidations_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:mpr.chubby.KeepAliveResponse.invalidations)
 }
-inline ::std::string* PutRequest::release_uuid() {
-  // @@protoc_insertion_point(field_release:mpr.chubby.PutRequest.uuid)
-  
-  return uuid_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void KeepAliveResponse::add_invalidations(std::string&& value) {
+  _impl_.invalidations_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:mpr.chubby.KeepAliveResponse.invalidations)
 }
-inline void PutRequest::set_allocated_uuid(::std::string* uuid) {
-  if (uuid != NULL) {
-    
-  } else {
-    
-  }
-  uuid_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), uuid);
-  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.PutRequest.uuid)
+inline void KeepAliveResponse::add_invalidations(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.invalidations_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:mpr.chubby.KeepAliveResponse.invalidations)
 }
-
-// -------------------------------------------------------------------
-
-// PutResponse
-
-// optional bool success = 1;
-inline void PutResponse::clear_success() {
-  success_ = false;
+inline void KeepAliveResponse::add_invalidations(const char* value, size_t size) {
+  _impl_.invalidations_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:mpr.chubby.KeepAliveResponse.invalidations)
 }
-inline bool PutResponse::success() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.PutResponse.success)
-  return success_;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+KeepAliveResponse::invalidations() const {
+  // @@protoc_insertion_point(field_list:mpr.chubby.KeepAliveResponse.invalidations)
+  return _impl_.invalidations_;
 }
-inline void PutResponse::set_success(bool value) {
-  
-  success_ = value;
-  // @@protoc_insertion_point(field_set:mpr.chubby.PutResponse.success)
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+KeepAliveResponse::mutable_invalidations() {
+  // @@protoc_insertion_point(field_mutable_list:mpr.chubby.KeepAliveResponse.invalidations)
+  return &_impl_.invalidations_;
 }
 
-// optional string leader_id = 2;
-inline void PutResponse::clear_leader_id() {
-  leader_id_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-inline const ::std::string& PutResponse::leader_id() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.PutResponse.leader_id)
-  return leader_id_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-inline void PutResponse::set_leader_id(const ::std::string& value) {
-  
-  leader_id_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:mpr.chubby.PutResponse.leader_id)
-}
-inline void PutResponse::set_leader_id(const char* value) {
-  
-  leader_id_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:mpr.chubby.PutResponse.leader_id)
+// int64 invalidation_seq = 4;
+inline void KeepAliveResponse::clear_invalidation_seq() {
+  _impl_.invalidation_seq_ = int64_t{0};
 }
-inline void PutResponse::set_leader_id(const char* value, size_t size) {
-  
-  leader_id_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:mpr.chubby.PutResponse.leader_id)
+inline int64_t KeepAliveResponse::_internal_invalidation_seq() const {
+  return _impl_.invalidation_seq_;
 }
-inline ::std::string* PutResponse::mutable_leader_id() {
-  
-  // @@protoc_insertion_point(field_mutable:mpr.chubby.PutResponse.leader_id)
-  return leader_id_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline int64_t KeepAliveResponse::invalidation_seq() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.KeepAliveResponse.invalidation_seq)
+  return _internal_invalidation_seq();
 }
-inline ::std::string* PutResponse::release_leader_id() {
-  // @@protoc_insertion_point(field_release:mpr.chubby.PutResponse.leader_id)
+inline void KeepAliveResponse::_internal_set_invalidation_seq(int64_t value) {
   
-  return leader_id_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.invalidation_seq_ = value;
 }
-inline void PutResponse::set_allocated_leader_id(::std::string* leader_id) {
-  if (leader_id != NULL) {
-    
-  } else {
-    
-  }
-  leader_id_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), leader_id);
-  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.PutResponse.leader_id)
+inline void KeepAliveResponse::set_invalidation_seq(int64_t value) {
+  _internal_set_invalidation_seq(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.KeepAliveResponse.invalidation_seq)
 }
 
-// optional bool uuid_expired = 3;
-inline void PutResponse::clear_uuid_expired() {
-  uuid_expired_ = false;
+// int64 cache_incarnation = 5;
+inline void KeepAliveResponse::clear_cache_incarnation() {
+  _impl_.cache_incarnation_ = int64_t{0};
 }
-inline bool PutResponse::uuid_expired() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.PutResponse.uuid_expired)
-  return uuid_expired_;
+inline int64_t KeepAliveResponse::_internal_cache_incarnation() const {
+  return _impl_.cache_incarnation_;
 }
-inline void PutResponse::set_uuid_expired(bool value) {
+inline int64_t KeepAliveResponse::cache_incarnation() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.KeepAliveResponse.cache_incarnation)
+  return _internal_cache_incarnation();
+}
+inline void KeepAliveResponse::_internal_set_cache_incarnation(int64_t value) {
   
-  uuid_expired_ = value;
-  // @@protoc_insertion_point(field_set:mpr.chubby.PutResponse.uuid_expired)
+  _impl_.cache_incarnation_ = value;
+}
+inline void KeepAliveResponse::set_cache_incarnation(int64_t value) {
+  _internal_set_cache_incarnation(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.KeepAliveResponse.cache_incarnation)
 }
 
 // -------------------------------------------------------------------
 
-// GetRequest
+// KeepAliveBatchRequest
 
-// optional string key = 1;
-inline void GetRequest::clear_key() {
-  key_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// string forwarder_id = 1;
+inline void KeepAliveBatchRequest::clear_forwarder_id() {
+  _impl_.forwarder_id_.ClearToEmpty();
 }
-inline const ::std::string& GetRequest::key() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.GetRequest.key)
-  return key_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline const std::string& KeepAliveBatchRequest::forwarder_id() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.KeepAliveBatchRequest.forwarder_id)
+  return _internal_forwarder_id();
 }
-inline void GetRequest::set_key(const ::std::string& value) {
-  
-  key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:mpr.chubby.GetRequest.key)
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void KeepAliveBatchRequest::set_forwarder_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.forwarder_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpr.chubby.KeepAliveBatchRequest.forwarder_id)
 }
-inline void GetRequest::set_key(const char* value) {
-  
-  key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:mpr.chubby.GetRequest.key)
+inline std::string* KeepAliveBatchRequest::mutable_forwarder_id() {
+  std::string* _s = _internal_mutable_forwarder_id();
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.KeepAliveBatchRequest.forwarder_id)
+  return _s;
 }
-inline void GetRequest::set_key(const char* value, size_t size) {
-  
-  key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:mpr.chubby.GetRequest.key)
+inline const std::string& KeepAliveBatchRequest::_internal_forwarder_id() const {
+  return _impl_.forwarder_id_.Get();
 }
-inline ::std::string* GetRequest::mutable_key() {
+inline void KeepAliveBatchRequest::_internal_set_forwarder_id(const std::string& value) {
   
-  // @@protoc_insertion_point(field_mutable:mpr.chubby.GetRequest.key)
-  return key_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.forwarder_id_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* GetRequest::release_key() {
-  // @@protoc_insertion_point(field_release:mpr.chubby.GetRequest.key)
+inline std::string* KeepAliveBatchRequest::_internal_mutable_forwarder_id() {
   
-  return key_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.forwarder_id_.Mutable(GetArenaForAllocation());
 }
-inline void GetRequest::set_allocated_key(::std::string* key) {
-  if (key != NULL) {
+inline std::string* KeepAliveBatchRequest::release_forwarder_id() {
+  // @@protoc_insertion_point(field_release:mpr.chubby.KeepAliveBatchRequest.forwarder_id)
+  return _impl_.forwarder_id_.Release();
+}
+inline void KeepAliveBatchRequest::set_allocated_forwarder_id(std::string* forwarder_id) {
+  if (forwarder_id != nullptr) {
     
   } else {
     
   }
-  key_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), key);
-  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.GetRequest.key)
+  _impl_.forwarder_id_.SetAllocated(forwarder_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.forwarder_id_.IsDefault()) {
+    _impl_.forwarder_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.KeepAliveBatchRequest.forwarder_id)
 }
 
-// optional string uuid = 2;
-inline void GetRequest::clear_uuid() {
-  uuid_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// repeated .mpr.chubby.KeepAliveRequest sessions = 2;
+inline int KeepAliveBatchRequest::_internal_sessions_size() const {
+  return _impl_.sessions_.size();
 }
-inline const ::std::string& GetRequest::uuid() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.GetRequest.uuid)
-  return uuid_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline int KeepAliveBatchRequest::sessions_size() const {
+  return _internal_sessions_size();
 }
-inline void GetRequest::set_uuid(const ::std::string& value) {
-  
-  uuid_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:mpr.chubby.GetRequest.uuid)
+inline void KeepAliveBatchRequest::clear_sessions() {
+  _impl_.sessions_.Clear();
 }
-inline void GetRequest::set_uuid(const char* value) {
-  
-  uuid_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:mpr.chubby.GetRequest.uuid)
+inline ::mpr::chubby::KeepAliveRequest* KeepAliveBatchRequest::mutable_sessions(int index) {
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.KeepAliveBatchRequest.sessions)
+  return _impl_.sessions_.Mutable(index);
 }
-inline void GetRequest::set_uuid(const char* value, size_t size) {
-  
-  uuid_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:mpr.chubby.GetRequest.uuid)
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::mpr::chubby::KeepAliveRequest >*
+KeepAliveBatchRequest::mutable_sessions() {
+  // @@protoc_insertion_point(field_mutable_list:mpr.chubby.KeepAliveBatchRequest.sessions)
+  return &_impl_.sessions_;
 }
-inline ::std::string* GetRequest::mutable_uuid() {
-  
-  // @@protoc_insertion_point(field_mutable:mpr.chubby.GetRequest.uuid)
-  return uuid_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline const ::mpr::chubby::KeepAliveRequest& KeepAliveBatchRequest::_internal_sessions(int index) const {
+  return _impl_.sessions_.Get(index);
 }
-inline ::std::string* GetRequest::release_uuid() {
-  // @@protoc_insertion_point(field_release:mpr.chubby.GetRequest.uuid)
-  
-  return uuid_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline const ::mpr::chubby::KeepAliveRequest& KeepAliveBatchRequest::sessions(int index) const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.KeepAliveBatchRequest.sessions)
+  return _internal_sessions(index);
 }
-inline void GetRequest::set_allocated_uuid(::std::string* uuid) {
-  if (uuid != NULL) {
-    
-  } else {
-    
-  }
-  uuid_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), uuid);
-  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.GetRequest.uuid)
+inline ::mpr::chubby::KeepAliveRequest* KeepAliveBatchRequest::_internal_add_sessions() {
+  return _impl_.sessions_.Add();
+}
+inline ::mpr::chubby::KeepAliveRequest* KeepAliveBatchRequest::add_sessions() {
+  ::mpr::chubby::KeepAliveRequest* _add = _internal_add_sessions();
+  // @@protoc_insertion_point(field_add:mpr.chubby.KeepAliveBatchRequest.sessions)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::mpr::chubby::KeepAliveRequest >&
+KeepAliveBatchRequest::sessions() const {
+  // @@protoc_insertion_point(field_list:mpr.chubby.KeepAliveBatchRequest.sessions)
+  return _impl_.sessions_;
 }
 
 // -------------------------------------------------------------------
 
-// GetResponse
-
-// optional bool hit = 1;
-inline void GetResponse::clear_hit() {
-  hit_ = false;
-}
-inline bool GetResponse::hit() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.GetResponse.hit)
-  return hit_;
-}
-inline void GetResponse::set_hit(bool value) {
-  
-  hit_ = value;
-  // @@protoc_insertion_point(field_set:mpr.chubby.GetResponse.hit)
-}
+// KeepAliveBatchResponse
 
-// optional bytes value = 2;
-inline void GetResponse::clear_value() {
-  value_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-inline const ::std::string& GetResponse::value() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.GetResponse.value)
-  return value_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-inline void GetResponse::set_value(const ::std::string& value) {
-  
-  value_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:mpr.chubby.GetResponse.value)
-}
-inline void GetResponse::set_value(const char* value) {
-  
-  value_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:mpr.chubby.GetResponse.value)
+// bool success = 1;
+inline void KeepAliveBatchResponse::clear_success() {
+  _impl_.success_ = false;
 }
-inline void GetResponse::set_value(const void* value, size_t size) {
-  
-  value_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:mpr.chubby.GetResponse.value)
+inline bool KeepAliveBatchResponse::_internal_success() const {
+  return _impl_.success_;
 }
-inline ::std::string* GetResponse::mutable_value() {
-  
-  // @@protoc_insertion_point(field_mutable:mpr.chubby.GetResponse.value)
-  return value_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline bool KeepAliveBatchResponse::success() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.KeepAliveBatchResponse.success)
+  return _internal_success();
 }
-inline ::std::string* GetResponse::release_value() {
-  // @@protoc_insertion_point(field_release:mpr.chubby.GetResponse.value)
+inline void KeepAliveBatchResponse::_internal_set_success(bool value) {
   
-  return value_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.success_ = value;
 }
-inline void GetResponse::set_allocated_value(::std::string* value) {
-  if (value != NULL) {
-    
-  } else {
-    
-  }
-  value_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.GetResponse.value)
+inline void KeepAliveBatchResponse::set_success(bool value) {
+  _internal_set_success(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.KeepAliveBatchResponse.success)
 }
 
-// optional string leader_id = 3;
-inline void GetResponse::clear_leader_id() {
-  leader_id_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// string leader_id = 2;
+inline void KeepAliveBatchResponse::clear_leader_id() {
+  _impl_.leader_id_.ClearToEmpty();
 }
-inline const ::std::string& GetResponse::leader_id() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.GetResponse.leader_id)
-  return leader_id_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline const std::string& KeepAliveBatchResponse::leader_id() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.KeepAliveBatchResponse.leader_id)
+  return _internal_leader_id();
 }
-inline void GetResponse::set_leader_id(const ::std::string& value) {
-  
-  leader_id_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:mpr.chubby.GetResponse.leader_id)
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void KeepAliveBatchResponse::set_leader_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.leader_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpr.chubby.KeepAliveBatchResponse.leader_id)
 }
-inline void GetResponse::set_leader_id(const char* value) {
-  
-  leader_id_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:mpr.chubby.GetResponse.leader_id)
+inline std::string* KeepAliveBatchResponse::mutable_leader_id() {
+  std::string* _s = _internal_mutable_leader_id();
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.KeepAliveBatchResponse.leader_id)
+  return _s;
+}
+inline const std::string& KeepAliveBatchResponse::_internal_leader_id() const {
+  return _impl_.leader_id_.Get();
 }
-inline void GetResponse::set_leader_id(const char* value, size_t size) {
+inline void KeepAliveBatchResponse::_internal_set_leader_id(const std::string& value) {
   
-  leader_id_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:mpr.chubby.GetResponse.leader_id)
+  _impl_.leader_id_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* GetResponse::mutable_leader_id() {
+inline std::string* KeepAliveBatchResponse::_internal_mutable_leader_id() {
   
-  // @@protoc_insertion_point(field_mutable:mpr.chubby.GetResponse.leader_id)
-  return leader_id_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.leader_id_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* GetResponse::release_leader_id() {
-  // @@protoc_insertion_point(field_release:mpr.chubby.GetResponse.leader_id)
-  
-  return leader_id_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline std::string* KeepAliveBatchResponse::release_leader_id() {
+  // @@protoc_insertion_point(field_release:mpr.chubby.KeepAliveBatchResponse.leader_id)
+  return _impl_.leader_id_.Release();
 }
-inline void GetResponse::set_allocated_leader_id(::std::string* leader_id) {
-  if (leader_id != NULL) {
+inline void KeepAliveBatchResponse::set_allocated_leader_id(std::string* leader_id) {
+  if (leader_id != nullptr) {
     
   } else {
     
   }
-  leader_id_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), leader_id);
-  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.GetResponse.leader_id)
+  _impl_.leader_id_.SetAllocated(leader_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.leader_id_.IsDefault()) {
+    _impl_.leader_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.KeepAliveBatchResponse.leader_id)
 }
 
-// optional bool success = 4;
-inline void GetResponse::clear_success() {
-  success_ = false;
+// int32 renewed = 3;
+inline void KeepAliveBatchResponse::clear_renewed() {
+  _impl_.renewed_ = 0;
 }
-inline bool GetResponse::success() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.GetResponse.success)
-  return success_;
+inline int32_t KeepAliveBatchResponse::_internal_renewed() const {
+  return _impl_.renewed_;
 }
-inline void GetResponse::set_success(bool value) {
+inline int32_t KeepAliveBatchResponse::renewed() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.KeepAliveBatchResponse.renewed)
+  return _internal_renewed();
+}
+inline void KeepAliveBatchResponse::_internal_set_renewed(int32_t value) {
   
-  success_ = value;
-  // @@protoc_insertion_point(field_set:mpr.chubby.GetResponse.success)
+  _impl_.renewed_ = value;
+}
+inline void KeepAliveBatchResponse::set_renewed(int32_t value) {
+  _internal_set_renewed(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.KeepAliveBatchResponse.renewed)
 }
 
-// optional bool uuid_expired = 5;
-inline void GetResponse::clear_uuid_expired() {
-  uuid_expired_ = false;
+// repeated .mpr.chubby.KeepAliveResponse responses = 4;
+inline int KeepAliveBatchResponse::_internal_responses_size() const {
+  return _impl_.responses_.size();
 }
-inline bool GetResponse::uuid_expired() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.GetResponse.uuid_expired)
-  return uuid_expired_;
+inline int KeepAliveBatchResponse::responses_size() const {
+  return _internal_responses_size();
 }
-inline void GetResponse::set_uuid_expired(bool value) {
-  
-  uuid_expired_ = value;
-  // @@protoc_insertion_point(field_set:mpr.chubby.GetResponse.uuid_expired)
+inline void KeepAliveBatchResponse::clear_responses() {
+  _impl_.responses_.Clear();
+}
+inline ::mpr::chubby::KeepAliveResponse* KeepAliveBatchResponse::mutable_responses(int index) {
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.KeepAliveBatchResponse.responses)
+  return _impl_.responses_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::mpr::chubby::KeepAliveResponse >*
+KeepAliveBatchResponse::mutable_responses() {
+  // @@protoc_insertion_point(field_mutable_list:mpr.chubby.KeepAliveBatchResponse.responses)
+  return &_impl_.responses_;
+}
+inline const ::mpr::chubby::KeepAliveResponse& KeepAliveBatchResponse::_internal_responses(int index) const {
+  return _impl_.responses_.Get(index);
+}
+inline const ::mpr::chubby::KeepAliveResponse& KeepAliveBatchResponse::responses(int index) const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.KeepAliveBatchResponse.responses)
+  return _internal_responses(index);
+}
+inline ::mpr::chubby::KeepAliveResponse* KeepAliveBatchResponse::_internal_add_responses() {
+  return _impl_.responses_.Add();
+}
+inline ::mpr::chubby::KeepAliveResponse* KeepAliveBatchResponse::add_responses() {
+  ::mpr::chubby::KeepAliveResponse* _add = _internal_add_responses();
+  // @@protoc_insertion_point(field_add:mpr.chubby.KeepAliveBatchResponse.responses)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::mpr::chubby::KeepAliveResponse >&
+KeepAliveBatchResponse::responses() const {
+  // @@protoc_insertion_point(field_list:mpr.chubby.KeepAliveBatchResponse.responses)
+  return _impl_.responses_;
 }
 
 // -------------------------------------------------------------------
 
-// DelRequest
+// WatchEvent
 
-// optional string key = 1;
-inline void DelRequest::clear_key() {
-  key_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// string key = 1;
+inline void WatchEvent::clear_key() {
+  _impl_.key_.ClearToEmpty();
 }
-inline const ::std::string& DelRequest::key() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.DelRequest.key)
-  return key_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline const std::string& WatchEvent::key() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.WatchEvent.key)
+  return _internal_key();
 }
-inline void DelRequest::set_key(const ::std::string& value) {
-  
-  key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:mpr.chubby.DelRequest.key)
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void WatchEvent::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpr.chubby.WatchEvent.key)
 }
-inline void DelRequest::set_key(const char* value) {
-  
-  key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:mpr.chubby.DelRequest.key)
+inline std::string* WatchEvent::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.WatchEvent.key)
+  return _s;
 }
-inline void DelRequest::set_key(const char* value, size_t size) {
-  
-  key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:mpr.chubby.DelRequest.key)
+inline const std::string& WatchEvent::_internal_key() const {
+  return _impl_.key_.Get();
 }
-inline ::std::string* DelRequest::mutable_key() {
+inline void WatchEvent::_internal_set_key(const std::string& value) {
   
-  // @@protoc_insertion_point(field_mutable:mpr.chubby.DelRequest.key)
-  return key_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.key_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* DelRequest::release_key() {
-  // @@protoc_insertion_point(field_release:mpr.chubby.DelRequest.key)
+inline std::string* WatchEvent::_internal_mutable_key() {
   
-  return key_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.key_.Mutable(GetArenaForAllocation());
 }
-inline void DelRequest::set_allocated_key(::std::string* key) {
-  if (key != NULL) {
+inline std::string* WatchEvent::release_key() {
+  // @@protoc_insertion_point(field_release:mpr.chubby.WatchEvent.key)
+  return _impl_.key_.Release();
+}
+inline void WatchEvent::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
     
   } else {
     
   }
-  key_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), key);
-  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.DelRequest.key)
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.WatchEvent.key)
 }
 
-// optional string uuid = 2;
-inline void DelRequest::clear_uuid() {
-  uuid_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// .mpr.chubby.LogOperation op = 2;
+inline void WatchEvent::clear_op() {
+  _impl_.op_ = 0;
 }
-inline const ::std::string& DelRequest::uuid() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.DelRequest.uuid)
-  return uuid_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline ::mpr::chubby::LogOperation WatchEvent::_internal_op() const {
+  return static_cast< ::mpr::chubby::LogOperation >(_impl_.op_);
 }
-inline void DelRequest::set_uuid(const ::std::string& value) {
-  
-  uuid_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:mpr.chubby.DelRequest.uuid)
+inline ::mpr::chubby::LogOperation WatchEvent::op() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.WatchEvent.op)
+  return _internal_op();
 }
-inline void DelRequest::set_uuid(const char* value) {
+inline void WatchEvent::_internal_set_op(::mpr::chubby::LogOperation value) {
   
-  uuid_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:mpr.chubby.DelRequest.uuid)
+  _impl_.op_ = value;
 }
-inline void DelRequest::set_uuid(const char* value, size_t size) {
-  
-  uuid_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:mpr.chubby.DelRequest.uuid)
+inline void WatchEvent::set_op(::mpr::chubby::LogOperation value) {
+  _internal_set_op(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.WatchEvent.op)
+}
+
+// bytes value = 3;
+inline void WatchEvent::clear_value() {
+  _impl_.value_.ClearToEmpty();
+}
+inline const std::string& WatchEvent::value() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.WatchEvent.value)
+  return _internal_value();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void WatchEvent::set_value(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.value_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpr.chubby.WatchEvent.value)
+}
+inline std::string* WatchEvent::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.WatchEvent.value)
+  return _s;
+}
+inline const std::string& WatchEvent::_internal_value() const {
+  return _impl_.value_.Get();
 }
-inline ::std::string* DelRequest::mutable_uuid() {
+inline void WatchEvent::_internal_set_value(const std::string& value) {
   
-  // @@protoc_insertion_point(field_mutable:mpr.chubby.DelRequest.uuid)
-  return uuid_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.value_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* DelRequest::release_uuid() {
-  // @@protoc_insertion_point(field_release:mpr.chubby.DelRequest.uuid)
+inline std::string* WatchEvent::_internal_mutable_value() {
   
-  return uuid_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.value_.Mutable(GetArenaForAllocation());
 }
-inline void DelRequest::set_allocated_uuid(::std::string* uuid) {
-  if (uuid != NULL) {
+inline std::string* WatchEvent::release_value() {
+  // @@protoc_insertion_point(field_release:mpr.chubby.WatchEvent.value)
+  return _impl_.value_.Release();
+}
+inline void WatchEvent::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
     
   } else {
     
   }
-  uuid_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), uuid);
-  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.DelRequest.uuid)
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.WatchEvent.value)
 }
 
-// -------------------------------------------------------------------
-
-// DelResponse
-
-// optional bool success = 1;
-inline void DelResponse::clear_success() {
-  success_ = false;
+// int64 index = 4;
+inline void WatchEvent::clear_index() {
+  _impl_.index_ = int64_t{0};
 }
-inline bool DelResponse::success() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.DelResponse.success)
-  return success_;
+inline int64_t WatchEvent::_internal_index() const {
+  return _impl_.index_;
 }
-inline void DelResponse::set_success(bool value) {
+inline int64_t WatchEvent::index() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.WatchEvent.index)
+  return _internal_index();
+}
+inline void WatchEvent::_internal_set_index(int64_t value) {
   
-  success_ = value;
-  // @@protoc_insertion_point(field_set:mpr.chubby.DelResponse.success)
+  _impl_.index_ = value;
+}
+inline void WatchEvent::set_index(int64_t value) {
+  _internal_set_index(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.WatchEvent.index)
 }
 
-// optional string leader_id = 2;
-inline void DelResponse::clear_leader_id() {
-  leader_id_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// -------------------------------------------------------------------
+
+// WatchRequest
+
+// string key = 1;
+inline void WatchRequest::clear_key() {
+  _impl_.key_.ClearToEmpty();
 }
-inline const ::std::string& DelResponse::leader_id() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.DelResponse.leader_id)
-  return leader_id_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline const std::string& WatchRequest::key() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.WatchRequest.key)
+  return _internal_key();
 }
-inline void DelResponse::set_leader_id(const ::std::string& value) {
-  
-  leader_id_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:mpr.chubby.DelResponse.leader_id)
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void WatchRequest::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpr.chubby.WatchRequest.key)
 }
-inline void DelResponse::set_leader_id(const char* value) {
-  
-  leader_id_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:mpr.chubby.DelResponse.leader_id)
+inline std::string* WatchRequest::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.WatchRequest.key)
+  return _s;
 }
-inline void DelResponse::set_leader_id(const char* value, size_t size) {
-  
-  leader_id_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:mpr.chubby.DelResponse.leader_id)
+inline const std::string& WatchRequest::_internal_key() const {
+  return _impl_.key_.Get();
 }
-inline ::std::string* DelResponse::mutable_leader_id() {
+inline void WatchRequest::_internal_set_key(const std::string& value) {
   
-  // @@protoc_insertion_point(field_mutable:mpr.chubby.DelResponse.leader_id)
-  return leader_id_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.key_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* DelResponse::release_leader_id() {
-  // @@protoc_insertion_point(field_release:mpr.chubby.DelResponse.leader_id)
+inline std::string* WatchRequest::_internal_mutable_key() {
   
-  return leader_id_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* WatchRequest::release_key() {
+  // @@protoc_insertion_point(field_release:mpr.chubby.WatchRequest.key)
+  return _impl_.key_.Release();
 }
-inline void DelResponse::set_allocated_leader_id(::std::string* leader_id) {
-  if (leader_id != NULL) {
+inline void WatchRequest::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
     
   } else {
     
   }
-  leader_id_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), leader_id);
-  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.DelResponse.leader_id)
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.WatchRequest.key)
 }
 
-// optional bool uuid_expired = 3;
-inline void DelResponse::clear_uuid_expired() {
-  uuid_expired_ = false;
+// bool prefix = 2;
+inline void WatchRequest::clear_prefix() {
+  _impl_.prefix_ = false;
 }
-inline bool DelResponse::uuid_expired() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.DelResponse.uuid_expired)
-  return uuid_expired_;
+inline bool WatchRequest::_internal_prefix() const {
+  return _impl_.prefix_;
 }
-inline void DelResponse::set_uuid_expired(bool value) {
+inline bool WatchRequest::prefix() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.WatchRequest.prefix)
+  return _internal_prefix();
+}
+inline void WatchRequest::_internal_set_prefix(bool value) {
   
-  uuid_expired_ = value;
-  // @@protoc_insertion_point(field_set:mpr.chubby.DelResponse.uuid_expired)
+  _impl_.prefix_ = value;
+}
+inline void WatchRequest::set_prefix(bool value) {
+  _internal_set_prefix(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.WatchRequest.prefix)
 }
 
-// -------------------------------------------------------------------
-
-// UnLockRequest
-
-// optional string key = 1;
-inline void UnLockRequest::clear_key() {
-  key_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// string uuid = 3;
+inline void WatchRequest::clear_uuid() {
+  _impl_.uuid_.ClearToEmpty();
 }
-inline const ::std::string& UnLockRequest::key() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.UnLockRequest.key)
-  return key_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline const std::string& WatchRequest::uuid() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.WatchRequest.uuid)
+  return _internal_uuid();
 }
-inline void UnLockRequest::set_key(const ::std::string& value) {
-  
-  key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:mpr.chubby.UnLockRequest.key)
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void WatchRequest::set_uuid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.uuid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpr.chubby.WatchRequest.uuid)
 }
-inline void UnLockRequest::set_key(const char* value) {
-  
-  key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:mpr.chubby.UnLockRequest.key)
+inline std::string* WatchRequest::mutable_uuid() {
+  std::string* _s = _internal_mutable_uuid();
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.WatchRequest.uuid)
+  return _s;
 }
-inline void UnLockRequest::set_key(const char* value, size_t size) {
-  
-  key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:mpr.chubby.UnLockRequest.key)
+inline const std::string& WatchRequest::_internal_uuid() const {
+  return _impl_.uuid_.Get();
 }
-inline ::std::string* UnLockRequest::mutable_key() {
+inline void WatchRequest::_internal_set_uuid(const std::string& value) {
   
-  // @@protoc_insertion_point(field_mutable:mpr.chubby.UnLockRequest.key)
-  return key_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.uuid_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* UnLockRequest::release_key() {
-  // @@protoc_insertion_point(field_release:mpr.chubby.UnLockRequest.key)
+inline std::string* WatchRequest::_internal_mutable_uuid() {
   
-  return key_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.uuid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* WatchRequest::release_uuid() {
+  // @@protoc_insertion_point(field_release:mpr.chubby.WatchRequest.uuid)
+  return _impl_.uuid_.Release();
 }
-inline void UnLockRequest::set_allocated_key(::std::string* key) {
-  if (key != NULL) {
+inline void WatchRequest::set_allocated_uuid(std::string* uuid) {
+  if (uuid != nullptr) {
     
   } else {
     
   }
-  key_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), key);
-  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.UnLockRequest.key)
+  _impl_.uuid_.SetAllocated(uuid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.uuid_.IsDefault()) {
+    _impl_.uuid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.WatchRequest.uuid)
 }
 
-// optional string session_id = 2;
-inline void UnLockRequest::clear_session_id() {
-  session_id_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// string session_id = 4;
+inline void WatchRequest::clear_session_id() {
+  _impl_.session_id_.ClearToEmpty();
 }
-inline const ::std::string& UnLockRequest::session_id() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.UnLockRequest.session_id)
-  return session_id_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline const std::string& WatchRequest::session_id() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.WatchRequest.session_id)
+  return _internal_session_id();
 }
-inline void UnLockRequest::set_session_id(const ::std::string& value) {
-  
-  session_id_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:mpr.chubby.UnLockRequest.session_id)
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void WatchRequest::set_session_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.session_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpr.chubby.WatchRequest.session_id)
 }
-inline void UnLockRequest::set_session_id(const char* value) {
-  
-  session_id_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:mpr.chubby.UnLockRequest.session_id)
+inline std::string* WatchRequest::mutable_session_id() {
+  std::string* _s = _internal_mutable_session_id();
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.WatchRequest.session_id)
+  return _s;
 }
-inline void UnLockRequest::set_session_id(const char* value, size_t size) {
-  
-  session_id_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:mpr.chubby.UnLockRequest.session_id)
+inline const std::string& WatchRequest::_internal_session_id() const {
+  return _impl_.session_id_.Get();
 }
-inline ::std::string* UnLockRequest::mutable_session_id() {
+inline void WatchRequest::_internal_set_session_id(const std::string& value) {
   
-  // @@protoc_insertion_point(field_mutable:mpr.chubby.UnLockRequest.session_id)
-  return session_id_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.session_id_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* UnLockRequest::release_session_id() {
-  // @@protoc_insertion_point(field_release:mpr.chubby.UnLockRequest.session_id)
+inline std::string* WatchRequest::_internal_mutable_session_id() {
   
-  return session_id_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.session_id_.Mutable(GetArenaForAllocation());
 }
-inline void UnLockRequest::set_allocated_session_id(::std::string* session_id) {
-  if (session_id != NULL) {
+inline std::string* WatchRequest::release_session_id() {
+  // @@protoc_insertion_point(field_release:mpr.chubby.WatchRequest.session_id)
+  return _impl_.session_id_.Release();
+}
+inline void WatchRequest::set_allocated_session_id(std::string* session_id) {
+  if (session_id != nullptr) {
     
   } else {
     
   }
-  session_id_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), session_id);
-  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.UnLockRequest.session_id)
+  _impl_.session_id_.SetAllocated(session_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.session_id_.IsDefault()) {
+    _impl_.session_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.WatchRequest.session_id)
 }
 
-// optional string uuid = 3;
-inline void UnLockRequest::clear_uuid() {
-  uuid_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// int64 watch_id = 5;
+inline void WatchRequest::clear_watch_id() {
+  _impl_.watch_id_ = int64_t{0};
 }
-inline const ::std::string& UnLockRequest::uuid() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.UnLockRequest.uuid)
-  return uuid_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline int64_t WatchRequest::_internal_watch_id() const {
+  return _impl_.watch_id_;
 }
-inline void UnLockRequest::set_uuid(const ::std::string& value) {
-  
-  uuid_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:mpr.chubby.UnLockRequest.uuid)
+inline int64_t WatchRequest::watch_id() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.WatchRequest.watch_id)
+  return _internal_watch_id();
 }
-inline void UnLockRequest::set_uuid(const char* value) {
+inline void WatchRequest::_internal_set_watch_id(int64_t value) {
   
-  uuid_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:mpr.chubby.UnLockRequest.uuid)
+  _impl_.watch_id_ = value;
 }
-inline void UnLockRequest::set_uuid(const char* value, size_t size) {
-  
-  uuid_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:mpr.chubby.UnLockRequest.uuid)
+inline void WatchRequest::set_watch_id(int64_t value) {
+  _internal_set_watch_id(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.WatchRequest.watch_id)
+}
+
+// int64 start_index = 6;
+inline void WatchRequest::clear_start_index() {
+  _impl_.start_index_ = int64_t{0};
+}
+inline int64_t WatchRequest::_internal_start_index() const {
+  return _impl_.start_index_;
+}
+inline int64_t WatchRequest::start_index() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.WatchRequest.start_index)
+  return _internal_start_index();
 }
-inline ::std::string* UnLockRequest::mutable_uuid() {
+inline void WatchRequest::_internal_set_start_index(int64_t value) {
   
-  // @@protoc_insertion_point(field_mutable:mpr.chubby.UnLockRequest.uuid)
-  return uuid_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.start_index_ = value;
 }
-inline ::std::string* UnLockRequest::release_uuid() {
-  // @@protoc_insertion_point(field_release:mpr.chubby.UnLockRequest.uuid)
+inline void WatchRequest::set_start_index(int64_t value) {
+  _internal_set_start_index(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.WatchRequest.start_index)
+}
+
+// int32 timeout_ms = 7;
+inline void WatchRequest::clear_timeout_ms() {
+  _impl_.timeout_ms_ = 0;
+}
+inline int32_t WatchRequest::_internal_timeout_ms() const {
+  return _impl_.timeout_ms_;
+}
+inline int32_t WatchRequest::timeout_ms() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.WatchRequest.timeout_ms)
+  return _internal_timeout_ms();
+}
+inline void WatchRequest::_internal_set_timeout_ms(int32_t value) {
   
-  return uuid_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.timeout_ms_ = value;
 }
-inline void UnLockRequest::set_allocated_uuid(::std::string* uuid) {
-  if (uuid != NULL) {
-    
-  } else {
-    
-  }
-  uuid_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), uuid);
-  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.UnLockRequest.uuid)
+inline void WatchRequest::set_timeout_ms(int32_t value) {
+  _internal_set_timeout_ms(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.WatchRequest.timeout_ms)
 }
 
 // -------------------------------------------------------------------
 
-// UnLockResponse
+// WatchResponse
 
-// optional bool success = 1;
-inline void UnLockResponse::clear_success() {
-  success_ = false;
+// bool success = 1;
+inline void WatchResponse::clear_success() {
+  _impl_.success_ = false;
 }
-inline bool UnLockResponse::success() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.UnLockResponse.success)
-  return success_;
+inline bool WatchResponse::_internal_success() const {
+  return _impl_.success_;
 }
-inline void UnLockResponse::set_success(bool value) {
+inline bool WatchResponse::success() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.WatchResponse.success)
+  return _internal_success();
+}
+inline void WatchResponse::_internal_set_success(bool value) {
   
-  success_ = value;
-  // @@protoc_insertion_point(field_set:mpr.chubby.UnLockResponse.success)
+  _impl_.success_ = value;
+}
+inline void WatchResponse::set_success(bool value) {
+  _internal_set_success(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.WatchResponse.success)
 }
 
-// optional string leader_id = 2;
-inline void UnLockResponse::clear_leader_id() {
-  leader_id_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// string leader_id = 2;
+inline void WatchResponse::clear_leader_id() {
+  _impl_.leader_id_.ClearToEmpty();
 }
-inline const ::std::string& UnLockResponse::leader_id() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.UnLockResponse.leader_id)
-  return leader_id_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline const std::string& WatchResponse::leader_id() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.WatchResponse.leader_id)
+  return _internal_leader_id();
 }
-inline void UnLockResponse::set_leader_id(const ::std::string& value) {
-  
-  leader_id_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:mpr.chubby.UnLockResponse.leader_id)
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void WatchResponse::set_leader_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.leader_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpr.chubby.WatchResponse.leader_id)
 }
-inline void UnLockResponse::set_leader_id(const char* value) {
-  
-  leader_id_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:mpr.chubby.UnLockResponse.leader_id)
+inline std::string* WatchResponse::mutable_leader_id() {
+  std::string* _s = _internal_mutable_leader_id();
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.WatchResponse.leader_id)
+  return _s;
 }
-inline void UnLockResponse::set_leader_id(const char* value, size_t size) {
-  
-  leader_id_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:mpr.chubby.UnLockResponse.leader_id)
+inline const std::string& WatchResponse::_internal_leader_id() const {
+  return _impl_.leader_id_.Get();
 }
-inline ::std::string* UnLockResponse::mutable_leader_id() {
+inline void WatchResponse::_internal_set_leader_id(const std::string& value) {
   
-  // @@protoc_insertion_point(field_mutable:mpr.chubby.UnLockResponse.leader_id)
-  return leader_id_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.leader_id_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* UnLockResponse::release_leader_id() {
-  // @@protoc_insertion_point(field_release:mpr.chubby.UnLockResponse.leader_id)
+inline std::string* WatchResponse::_internal_mutable_leader_id() {
   
-  return leader_id_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.leader_id_.Mutable(GetArenaForAllocation());
 }
-inline void UnLockResponse::set_allocated_leader_id(::std::string* leader_id) {
-  if (leader_id != NULL) {
+inline std::string* WatchResponse::release_leader_id() {
+  // @@protoc_insertion_point(field_release:mpr.chubby.WatchResponse.leader_id)
+  return _impl_.leader_id_.Release();
+}
+inline void WatchResponse::set_allocated_leader_id(std::string* leader_id) {
+  if (leader_id != nullptr) {
     
   } else {
     
   }
-  leader_id_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), leader_id);
-  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.UnLockResponse.leader_id)
+  _impl_.leader_id_.SetAllocated(leader_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.leader_id_.IsDefault()) {
+    _impl_.leader_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.WatchResponse.leader_id)
 }
 
-// optional bool uuid_expired = 3;
-inline void UnLockResponse::clear_uuid_expired() {
-  uuid_expired_ = false;
+// bool uuid_expired = 3;
+inline void WatchResponse::clear_uuid_expired() {
+  _impl_.uuid_expired_ = false;
 }
-inline bool UnLockResponse::uuid_expired() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.UnLockResponse.uuid_expired)
-  return uuid_expired_;
+inline bool WatchResponse::_internal_uuid_expired() const {
+  return _impl_.uuid_expired_;
 }
-inline void UnLockResponse::set_uuid_expired(bool value) {
+inline bool WatchResponse::uuid_expired() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.WatchResponse.uuid_expired)
+  return _internal_uuid_expired();
+}
+inline void WatchResponse::_internal_set_uuid_expired(bool value) {
   
-  uuid_expired_ = value;
-  // @@protoc_insertion_point(field_set:mpr.chubby.UnLockResponse.uuid_expired)
+  _impl_.uuid_expired_ = value;
+}
+inline void WatchResponse::set_uuid_expired(bool value) {
+  _internal_set_uuid_expired(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.WatchResponse.uuid_expired)
 }
 
-// -------------------------------------------------------------------
-
-// ShowStatusRequest
-
-// -------------------------------------------------------------------
-
-// ShowStatusResponse
-
-// optional .mpr.chubby.NodeStatus status = 1;
-inline void ShowStatusResponse::clear_status() {
-  status_ = 0;
+// int64 watch_id = 4;
+inline void WatchResponse::clear_watch_id() {
+  _impl_.watch_id_ = int64_t{0};
 }
-inline ::mpr::chubby::NodeStatus ShowStatusResponse::status() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.ShowStatusResponse.status)
-  return static_cast< ::mpr::chubby::NodeStatus >(status_);
+inline int64_t WatchResponse::_internal_watch_id() const {
+  return _impl_.watch_id_;
 }
-inline void ShowStatusResponse::set_status(::mpr::chubby::NodeStatus value) {
+inline int64_t WatchResponse::watch_id() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.WatchResponse.watch_id)
+  return _internal_watch_id();
+}
+inline void WatchResponse::_internal_set_watch_id(int64_t value) {
   
-  status_ = value;
-  // @@protoc_insertion_point(field_set:mpr.chubby.ShowStatusResponse.status)
+  _impl_.watch_id_ = value;
+}
+inline void WatchResponse::set_watch_id(int64_t value) {
+  _internal_set_watch_id(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.WatchResponse.watch_id)
 }
 
-// optional int64 term = 2;
-inline void ShowStatusResponse::clear_term() {
-  term_ = GOOGLE_LONGLONG(0);
+// repeated .mpr.chubby.WatchEvent events = 5;
+inline int WatchResponse::_internal_events_size() const {
+  return _impl_.events_.size();
 }
-inline ::google::protobuf::int64 ShowStatusResponse::term() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.ShowStatusResponse.term)
-  return term_;
+inline int WatchResponse::events_size() const {
+  return _internal_events_size();
 }
-inline void ShowStatusResponse::set_term(::google::protobuf::int64 value) {
-  
-  term_ = value;
-  // @@protoc_insertion_point(field_set:mpr.chubby.ShowStatusResponse.term)
+inline void WatchResponse::clear_events() {
+  _impl_.events_.Clear();
 }
-
-// optional int64 last_log_index = 3;
-inline void ShowStatusResponse::clear_last_log_index() {
-  last_log_index_ = GOOGLE_LONGLONG(0);
+inline ::mpr::chubby::WatchEvent* WatchResponse::mutable_events(int index) {
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.WatchResponse.events)
+  return _impl_.events_.Mutable(index);
 }
-inline ::google::protobuf::int64 ShowStatusResponse::last_log_index() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.ShowStatusResponse.last_log_index)
-  return last_log_index_;
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::mpr::chubby::WatchEvent >*
+WatchResponse::mutable_events() {
+  // @@protoc_insertion_point(field_mutable_list:mpr.chubby.WatchResponse.events)
+  return &_impl_.events_;
 }
-inline void ShowStatusResponse::set_last_log_index(::google::protobuf::int64 value) {
-  
-  last_log_index_ = value;
-  // @@protoc_insertion_point(field_set:mpr.chubby.ShowStatusResponse.last_log_index)
+inline const ::mpr::chubby::WatchEvent& WatchResponse::_internal_events(int index) const {
+  return _impl_.events_.Get(index);
+}
+inline const ::mpr::chubby::WatchEvent& WatchResponse::events(int index) const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.WatchResponse.events)
+  return _internal_events(index);
+}
+inline ::mpr::chubby::WatchEvent* WatchResponse::_internal_add_events() {
+  return _impl_.events_.Add();
+}
+inline ::mpr::chubby::WatchEvent* WatchResponse::add_events() {
+  ::mpr::chubby::WatchEvent* _add = _internal_add_events();
+  // @@protoc_insertion_point(field_add:mpr.chubby.WatchResponse.events)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::mpr::chubby::WatchEvent >&
+WatchResponse::events() const {
+  // @@protoc_insertion_point(field_list:mpr.chubby.WatchResponse.events)
+  return _impl_.events_;
 }
 
-// optional int64 last_log_term = 4;
-inline void ShowStatusResponse::clear_last_log_term() {
-  last_log_term_ = GOOGLE_LONGLONG(0);
+// bool overflow = 6;
+inline void WatchResponse::clear_overflow() {
+  _impl_.overflow_ = false;
 }
-inline ::google::protobuf::int64 ShowStatusResponse::last_log_term() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.ShowStatusResponse.last_log_term)
-  return last_log_term_;
+inline bool WatchResponse::_internal_overflow() const {
+  return _impl_.overflow_;
 }
-inline void ShowStatusResponse::set_last_log_term(::google::protobuf::int64 value) {
+inline bool WatchResponse::overflow() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.WatchResponse.overflow)
+  return _internal_overflow();
+}
+inline void WatchResponse::_internal_set_overflow(bool value) {
   
-  last_log_term_ = value;
-  // @@protoc_insertion_point(field_set:mpr.chubby.ShowStatusResponse.last_log_term)
+  _impl_.overflow_ = value;
+}
+inline void WatchResponse::set_overflow(bool value) {
+  _internal_set_overflow(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.WatchResponse.overflow)
 }
 
-// optional int64 commit_index = 5;
-inline void ShowStatusResponse::clear_commit_index() {
-  commit_index_ = GOOGLE_LONGLONG(0);
+// int64 last_index = 7;
+inline void WatchResponse::clear_last_index() {
+  _impl_.last_index_ = int64_t{0};
 }
-inline ::google::protobuf::int64 ShowStatusResponse::commit_index() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.ShowStatusResponse.commit_index)
-  return commit_index_;
+inline int64_t WatchResponse::_internal_last_index() const {
+  return _impl_.last_index_;
+}
+inline int64_t WatchResponse::last_index() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.WatchResponse.last_index)
+  return _internal_last_index();
 }
-inline void ShowStatusResponse::set_commit_index(::google::protobuf::int64 value) {
+inline void WatchResponse::_internal_set_last_index(int64_t value) {
   
-  commit_index_ = value;
-  // @@protoc_insertion_point(field_set:mpr.chubby.ShowStatusResponse.commit_index)
+  _impl_.last_index_ = value;
+}
+inline void WatchResponse::set_last_index(int64_t value) {
+  _internal_set_last_index(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.WatchResponse.last_index)
 }
 
-// optional int64 last_applied = 6;
-inline void ShowStatusResponse::clear_last_applied() {
-  last_applied_ = GOOGLE_LONGLONG(0);
+// bool compacted = 8;
+inline void WatchResponse::clear_compacted() {
+  _impl_.compacted_ = false;
 }
-inline ::google::protobuf::int64 ShowStatusResponse::last_applied() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.ShowStatusResponse.last_applied)
-  return last_applied_;
+inline bool WatchResponse::_internal_compacted() const {
+  return _impl_.compacted_;
 }
-inline void ShowStatusResponse::set_last_applied(::google::protobuf::int64 value) {
+inline bool WatchResponse::compacted() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.WatchResponse.compacted)
+  return _internal_compacted();
+}
+inline void WatchResponse::_internal_set_compacted(bool value) {
   
-  last_applied_ = value;
-  // @@protoc_insertion_point(field_set:mpr.chubby.ShowStatusResponse.last_applied)
+  _impl_.compacted_ = value;
+}
+inline void WatchResponse::set_compacted(bool value) {
+  _internal_set_compacted(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.WatchResponse.compacted)
 }
 
 // -------------------------------------------------------------------
 
-// ScanRequest
+// LoginRequest
 
-// optional string start_key = 1;
-inline void ScanRequest::clear_start_key() {
-  start_key_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// string username = 1;
+inline void LoginRequest::clear_username() {
+  _impl_.username_.ClearToEmpty();
 }
-inline const ::std::string& ScanRequest::start_key() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.ScanRequest.start_key)
-  return start_key_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline const std::string& LoginRequest::username() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.LoginRequest.username)
+  return _internal_username();
 }
-inline void ScanRequest::set_start_key(const ::std::string& value) {
-  
-  start_key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:mpr.chubby.ScanRequest.start_key)
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void LoginRequest::set_username(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.username_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpr.chubby.LoginRequest.username)
 }
-inline void ScanRequest::set_start_key(const char* value) {
-  
-  start_key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:mpr.chubby.ScanRequest.start_key)
+inline std::string* LoginRequest::mutable_username() {
+  std::string* _s = _internal_mutable_username();
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.LoginRequest.username)
+  return _s;
 }
-inline void ScanRequest::set_start_key(const char* value, size_t size) {
-  
-  start_key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:mpr.chubby.ScanRequest.start_key)
+inline const std::string& LoginRequest::_internal_username() const {
+  return _impl_.username_.Get();
 }
-inline ::std::string* ScanRequest::mutable_start_key() {
+inline void LoginRequest::_internal_set_username(const std::string& value) {
   
-  // @@protoc_insertion_point(field_mutable:mpr.chubby.ScanRequest.start_key)
-  return start_key_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.username_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* ScanRequest::release_start_key() {
-  // @@protoc_insertion_point(field_release:mpr.chubby.ScanRequest.start_key)
+inline std::string* LoginRequest::_internal_mutable_username() {
   
-  return start_key_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.username_.Mutable(GetArenaForAllocation());
+}
+inline std::string* LoginRequest::release_username() {
+  // @@protoc_insertion_point(field_release:mpr.chubby.LoginRequest.username)
+  return _impl_.username_.Release();
 }
-inline void ScanRequest::set_allocated_start_key(::std::string* start_key) {
-  if (start_key != NULL) {
+inline void LoginRequest::set_allocated_username(std::string* username) {
+  if (username != nullptr) {
     
   } else {
     
   }
-  start_key_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), start_key);
-  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.ScanRequest.start_key)
+  _impl_.username_.SetAllocated(username, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.username_.IsDefault()) {
+    _impl_.username_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.LoginRequest.username)
 }
 
-// optional bytes end_key = 2;
-inline void ScanRequest::clear_end_key() {
-  end_key_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// string passwd = 2;
+inline void LoginRequest::clear_passwd() {
+  _impl_.passwd_.ClearToEmpty();
 }
-inline const ::std::string& ScanRequest::end_key() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.ScanRequest.end_key)
-  return end_key_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline const std::string& LoginRequest::passwd() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.LoginRequest.passwd)
+  return _internal_passwd();
 }
-inline void ScanRequest::set_end_key(const ::std::string& value) {
-  
-  end_key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:mpr.chubby.ScanRequest.end_key)
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void LoginRequest::set_passwd(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.passwd_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpr.chubby.LoginRequest.passwd)
 }
-inline void ScanRequest::set_end_key(const char* value) {
-  
-  end_key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:mpr.chubby.ScanRequest.end_key)
+inline std::string* LoginRequest::mutable_passwd() {
+  std::string* _s = _internal_mutable_passwd();
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.LoginRequest.passwd)
+  return _s;
 }
-inline void ScanRequest::set_end_key(const void* value, size_t size) {
-  
-  end_key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:mpr.chubby.ScanRequest.end_key)
+inline const std::string& LoginRequest::_internal_passwd() const {
+  return _impl_.passwd_.Get();
 }
-inline ::std::string* ScanRequest::mutable_end_key() {
+inline void LoginRequest::_internal_set_passwd(const std::string& value) {
   
-  // @@protoc_insertion_point(field_mutable:mpr.chubby.ScanRequest.end_key)
-  return end_key_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.passwd_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* ScanRequest::release_end_key() {
-  // @@protoc_insertion_point(field_release:mpr.chubby.ScanRequest.end_key)
+inline std::string* LoginRequest::_internal_mutable_passwd() {
   
-  return end_key_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.passwd_.Mutable(GetArenaForAllocation());
 }
-inline void ScanRequest::set_allocated_end_key(::std::string* end_key) {
-  if (end_key != NULL) {
+inline std::string* LoginRequest::release_passwd() {
+  // @@protoc_insertion_point(field_release:mpr.chubby.LoginRequest.passwd)
+  return _impl_.passwd_.Release();
+}
+inline void LoginRequest::set_allocated_passwd(std::string* passwd) {
+  if (passwd != nullptr) {
     
   } else {
     
   }
-  end_key_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), end_key);
-  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.ScanRequest.end_key)
+  _impl_.passwd_.SetAllocated(passwd, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.passwd_.IsDefault()) {
+    _impl_.passwd_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.LoginRequest.passwd)
 }
 
-// optional int32 size_limit = 3;
-inline void ScanRequest::clear_size_limit() {
-  size_limit_ = 0;
+// -------------------------------------------------------------------
+
+// Status
+
+// int64 code = 1;
+inline void Status::clear_code() {
+  _impl_.code_ = int64_t{0};
 }
-inline ::google::protobuf::int32 ScanRequest::size_limit() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.ScanRequest.size_limit)
-  return size_limit_;
+inline int64_t Status::_internal_code() const {
+  return _impl_.code_;
 }
-inline void ScanRequest::set_size_limit(::google::protobuf::int32 value) {
+inline int64_t Status::code() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.Status.code)
+  return _internal_code();
+}
+inline void Status::_internal_set_code(int64_t value) {
   
-  size_limit_ = value;
-  // @@protoc_insertion_point(field_set:mpr.chubby.ScanRequest.size_limit)
+  _impl_.code_ = value;
+}
+inline void Status::set_code(int64_t value) {
+  _internal_set_code(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.Status.code)
 }
 
-// optional string uuid = 4;
-inline void ScanRequest::clear_uuid() {
-  uuid_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// string message = 2;
+inline void Status::clear_message() {
+  _impl_.message_.ClearToEmpty();
 }
-inline const ::std::string& ScanRequest::uuid() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.ScanRequest.uuid)
-  return uuid_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline const std::string& Status::message() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.Status.message)
+  return _internal_message();
 }
-inline void ScanRequest::set_uuid(const ::std::string& value) {
-  
-  uuid_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:mpr.chubby.ScanRequest.uuid)
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Status::set_message(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.message_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpr.chubby.Status.message)
 }
-inline void ScanRequest::set_uuid(const char* value) {
-  
-  uuid_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:mpr.chubby.ScanRequest.uuid)
+inline std::string* Status::mutable_message() {
+  std::string* _s = _internal_mutable_message();
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.Status.message)
+  return _s;
 }
-inline void ScanRequest::set_uuid(const char* value, size_t size) {
-  
-  uuid_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:mpr.chubby.ScanRequest.uuid)
+inline const std::string& Status::_internal_message() const {
+  return _impl_.message_.Get();
 }
-inline ::std::string* ScanRequest::mutable_uuid() {
+inline void Status::_internal_set_message(const std::string& value) {
   
-  // @@protoc_insertion_point(field_mutable:mpr.chubby.ScanRequest.uuid)
-  return uuid_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.message_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* ScanRequest::release_uuid() {
-  // @@protoc_insertion_point(field_release:mpr.chubby.ScanRequest.uuid)
+inline std::string* Status::_internal_mutable_message() {
   
-  return uuid_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.message_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Status::release_message() {
+  // @@protoc_insertion_point(field_release:mpr.chubby.Status.message)
+  return _impl_.message_.Release();
 }
-inline void ScanRequest::set_allocated_uuid(::std::string* uuid) {
-  if (uuid != NULL) {
+inline void Status::set_allocated_message(std::string* message) {
+  if (message != nullptr) {
     
   } else {
     
   }
-  uuid_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), uuid);
-  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.ScanRequest.uuid)
+  _impl_.message_.SetAllocated(message, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.message_.IsDefault()) {
+    _impl_.message_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.Status.message)
 }
 
 // -------------------------------------------------------------------
 
-// ScanItem
+// LoginResponse
 
-// optional string key = 1;
-inline void ScanItem::clear_key() {
-  key_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-inline const ::std::string& ScanItem::key() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.ScanItem.key)
-  return key_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-inline void ScanItem::set_key(const ::std::string& value) {
-  
-  key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:mpr.chubby.ScanItem.key)
+// .mpr.chubby.Status status = 1;
+inline bool LoginResponse::_internal_has_status() const {
+  return this != internal_default_instance() && _impl_.status_ != nullptr;
 }
-inline void ScanItem::set_key(const char* value) {
-  
-  key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:mpr.chubby.ScanItem.key)
+inline bool LoginResponse::has_status() const {
+  return _internal_has_status();
 }
-inline void ScanItem::set_key(const char* value, size_t size) {
-  
-  key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:mpr.chubby.ScanItem.key)
+inline void LoginResponse::clear_status() {
+  if (GetArenaForAllocation() == nullptr && _impl_.status_ != nullptr) {
+    delete _impl_.status_;
+  }
+  _impl_.status_ = nullptr;
 }
-inline ::std::string* ScanItem::mutable_key() {
-  
-  // @@protoc_insertion_point(field_mutable:mpr.chubby.ScanItem.key)
-  return key_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline const ::mpr::chubby::Status& LoginResponse::_internal_status() const {
+  const ::mpr::chubby::Status* p = _impl_.status_;
+  return p != nullptr ? *p : reinterpret_cast<const ::mpr::chubby::Status&>(
+      ::mpr::chubby::_Status_default_instance_);
 }
-inline ::std::string* ScanItem::release_key() {
-  // @@protoc_insertion_point(field_release:mpr.chubby.ScanItem.key)
-  
-  return key_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline const ::mpr::chubby::Status& LoginResponse::status() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.LoginResponse.status)
+  return _internal_status();
 }
-inline void ScanItem::set_allocated_key(::std::string* key) {
-  if (key != NULL) {
+inline void LoginResponse::unsafe_arena_set_allocated_status(
+    ::mpr::chubby::Status* status) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.status_);
+  }
+  _impl_.status_ = status;
+  if (status) {
     
   } else {
     
   }
-  key_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), key);
-  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.ScanItem.key)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:mpr.chubby.LoginResponse.status)
 }
-
-// optional bytes value = 2;
-inline void ScanItem::clear_value() {
-  value_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-inline const ::std::string& ScanItem::value() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.ScanItem.value)
-  return value_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-inline void ScanItem::set_value(const ::std::string& value) {
-  
-  value_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:mpr.chubby.ScanItem.value)
-}
-inline void ScanItem::set_value(const char* value) {
+inline ::mpr::chubby::Status* LoginResponse::release_status() {
   
-  value_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:mpr.chubby.ScanItem.value)
+  ::mpr::chubby::Status* temp = _impl_.status_;
+  _impl_.status_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline void ScanItem::set_value(const void* value, size_t size) {
+inline ::mpr::chubby::Status* LoginResponse::unsafe_arena_release_status() {
+  // @@protoc_insertion_point(field_release:mpr.chubby.LoginResponse.status)
   
-  value_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:mpr.chubby.ScanItem.value)
+  ::mpr::chubby::Status* temp = _impl_.status_;
+  _impl_.status_ = nullptr;
+  return temp;
 }
-inline ::std::string* ScanItem::mutable_value() {
+inline ::mpr::chubby::Status* LoginResponse::_internal_mutable_status() {
   
-  // @@protoc_insertion_point(field_mutable:mpr.chubby.ScanItem.value)
-  return value_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (_impl_.status_ == nullptr) {
+    auto* p = CreateMaybeMessage<::mpr::chubby::Status>(GetArenaForAllocation());
+    _impl_.status_ = p;
+  }
+  return _impl_.status_;
 }
-inline ::std::string* ScanItem::release_value() {
-  // @@protoc_insertion_point(field_release:mpr.chubby.ScanItem.value)
-  
-  return value_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline ::mpr::chubby::Status* LoginResponse::mutable_status() {
+  ::mpr::chubby::Status* _msg = _internal_mutable_status();
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.LoginResponse.status)
+  return _msg;
 }
-inline void ScanItem::set_allocated_value(::std::string* value) {
-  if (value != NULL) {
+inline void LoginResponse::set_allocated_status(::mpr::chubby::Status* status) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.status_;
+  }
+  if (status) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(status);
+    if (message_arena != submessage_arena) {
+      status = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, status, submessage_arena);
+    }
     
   } else {
     
   }
-  value_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.ScanItem.value)
+  _impl_.status_ = status;
+  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.LoginResponse.status)
 }
 
-// -------------------------------------------------------------------
-
-// ScanResponse
-
-// optional bool has_more = 1;
-inline void ScanResponse::clear_has_more() {
-  has_more_ = false;
-}
-inline bool ScanResponse::has_more() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.ScanResponse.has_more)
-  return has_more_;
+// string uuid = 2;
+inline void LoginResponse::clear_uuid() {
+  _impl_.uuid_.ClearToEmpty();
 }
-inline void ScanResponse::set_has_more(bool value) {
-  
-  has_more_ = value;
-  // @@protoc_insertion_point(field_set:mpr.chubby.ScanResponse.has_more)
+inline const std::string& LoginResponse::uuid() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.LoginResponse.uuid)
+  return _internal_uuid();
 }
-
-// repeated .mpr.chubby.ScanItem items = 2;
-inline int ScanResponse::items_size() const {
-  return items_.size();
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void LoginResponse::set_uuid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.uuid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpr.chubby.LoginResponse.uuid)
 }
-inline void ScanResponse::clear_items() {
-  items_.Clear();
+inline std::string* LoginResponse::mutable_uuid() {
+  std::string* _s = _internal_mutable_uuid();
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.LoginResponse.uuid)
+  return _s;
 }
-inline const ::mpr::chubby::ScanItem& ScanResponse::items(int index) const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.ScanResponse.items)
-  return items_.Get(index);
+inline const std::string& LoginResponse::_internal_uuid() const {
+  return _impl_.uuid_.Get();
 }
-inline ::mpr::chubby::ScanItem* ScanResponse::mutable_items(int index) {
-  // @@protoc_insertion_point(field_mutable:mpr.chubby.ScanResponse.items)
-  return items_.Mutable(index);
+inline void LoginResponse::_internal_set_uuid(const std::string& value) {
+  
+  _impl_.uuid_.Set(value, GetArenaForAllocation());
 }
-inline ::mpr::chubby::ScanItem* ScanResponse::add_items() {
-  // @@protoc_insertion_point(field_add:mpr.chubby.ScanResponse.items)
-  return items_.Add();
+inline std::string* LoginResponse::_internal_mutable_uuid() {
+  
+  return _impl_.uuid_.Mutable(GetArenaForAllocation());
 }
-inline ::google::protobuf::RepeatedPtrField< ::mpr::chubby::ScanItem >*
-ScanResponse::mutable_items() {
-  // @@protoc_insertion_point(field_mutable_list:mpr.chubby.ScanResponse.items)
-  return &items_;
+inline std::string* LoginResponse::release_uuid() {
+  // @@protoc_insertion_point(field_release:mpr.chubby.LoginResponse.uuid)
+  return _impl_.uuid_.Release();
 }
-inline const ::google::protobuf::RepeatedPtrField< ::mpr::chubby::ScanItem >&
-ScanResponse::items() const {
-  // @@protoc_insertion_point(field_list:mpr.chubby.ScanResponse.items)
-  return items_;
+inline void LoginResponse::set_allocated_uuid(std::string* uuid) {
+  if (uuid != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.uuid_.SetAllocated(uuid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.uuid_.IsDefault()) {
+    _impl_.uuid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.LoginResponse.uuid)
 }
 
-// optional string leader_id = 3;
-inline void ScanResponse::clear_leader_id() {
-  leader_id_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// string leader_id = 3;
+inline void LoginResponse::clear_leader_id() {
+  _impl_.leader_id_.ClearToEmpty();
 }
-inline const ::std::string& ScanResponse::leader_id() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.ScanResponse.leader_id)
-  return leader_id_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline const std::string& LoginResponse::leader_id() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.LoginResponse.leader_id)
+  return _internal_leader_id();
 }
-inline void ScanResponse::set_leader_id(const ::std::string& value) {
-  
-  leader_id_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:mpr.chubby.ScanResponse.leader_id)
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void LoginResponse::set_leader_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.leader_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpr.chubby.LoginResponse.leader_id)
 }
-inline void ScanResponse::set_leader_id(const char* value) {
-  
-  leader_id_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:mpr.chubby.ScanResponse.leader_id)
+inline std::string* LoginResponse::mutable_leader_id() {
+  std::string* _s = _internal_mutable_leader_id();
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.LoginResponse.leader_id)
+  return _s;
 }
-inline void ScanResponse::set_leader_id(const char* value, size_t size) {
-  
-  leader_id_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:mpr.chubby.ScanResponse.leader_id)
+inline const std::string& LoginResponse::_internal_leader_id() const {
+  return _impl_.leader_id_.Get();
 }
-inline ::std::string* ScanResponse::mutable_leader_id() {
+inline void LoginResponse::_internal_set_leader_id(const std::string& value) {
   
-  // @@protoc_insertion_point(field_mutable:mpr.chubby.ScanResponse.leader_id)
-  return leader_id_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.leader_id_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* ScanResponse::release_leader_id() {
-  // @@protoc_insertion_point(field_release:mpr.chubby.ScanResponse.leader_id)
+inline std::string* LoginResponse::_internal_mutable_leader_id() {
   
-  return leader_id_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.leader_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* LoginResponse::release_leader_id() {
+  // @@protoc_insertion_point(field_release:mpr.chubby.LoginResponse.leader_id)
+  return _impl_.leader_id_.Release();
 }
-inline void ScanResponse::set_allocated_leader_id(::std::string* leader_id) {
-  if (leader_id != NULL) {
+inline void LoginResponse::set_allocated_leader_id(std::string* leader_id) {
+  if (leader_id != nullptr) {
     
   } else {
     
   }
-  leader_id_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), leader_id);
-  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.ScanResponse.leader_id)
-}
-
-// optional bool success = 4;
-inline void ScanResponse::clear_success() {
-  success_ = false;
-}
-inline bool ScanResponse::success() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.ScanResponse.success)
-  return success_;
-}
-inline void ScanResponse::set_success(bool value) {
-  
-  success_ = value;
-  // @@protoc_insertion_point(field_set:mpr.chubby.ScanResponse.success)
-}
-
-// optional bool uuid_expired = 5;
-inline void ScanResponse::clear_uuid_expired() {
-  uuid_expired_ = false;
-}
-inline bool ScanResponse::uuid_expired() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.ScanResponse.uuid_expired)
-  return uuid_expired_;
-}
-inline void ScanResponse::set_uuid_expired(bool value) {
-  
-  uuid_expired_ = value;
-  // @@protoc_insertion_point(field_set:mpr.chubby.ScanResponse.uuid_expired)
+  _impl_.leader_id_.SetAllocated(leader_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.leader_id_.IsDefault()) {
+    _impl_.leader_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.LoginResponse.leader_id)
 }
 
 // -------------------------------------------------------------------
 
-// LockRequest
+// LogoutRequest
 
-// optional string key = 1;
-inline void LockRequest::clear_key() {
-  key_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// string uuid = 1;
+inline void LogoutRequest::clear_uuid() {
+  _impl_.uuid_.ClearToEmpty();
 }
-inline const ::std::string& LockRequest::key() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.LockRequest.key)
-  return key_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline const std::string& LogoutRequest::uuid() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.LogoutRequest.uuid)
+  return _internal_uuid();
 }
-inline void LockRequest::set_key(const ::std::string& value) {
-  
-  key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:mpr.chubby.LockRequest.key)
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void LogoutRequest::set_uuid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.uuid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpr.chubby.LogoutRequest.uuid)
 }
-inline void LockRequest::set_key(const char* value) {
-  
-  key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:mpr.chubby.LockRequest.key)
+inline std::string* LogoutRequest::mutable_uuid() {
+  std::string* _s = _internal_mutable_uuid();
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.LogoutRequest.uuid)
+  return _s;
 }
-inline void LockRequest::set_key(const char* value, size_t size) {
-  
-  key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:mpr.chubby.LockRequest.key)
+inline const std::string& LogoutRequest::_internal_uuid() const {
+  return _impl_.uuid_.Get();
 }
-inline ::std::string* LockRequest::mutable_key() {
+inline void LogoutRequest::_internal_set_uuid(const std::string& value) {
   
-  // @@protoc_insertion_point(field_mutable:mpr.chubby.LockRequest.key)
-  return key_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.uuid_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* LockRequest::release_key() {
-  // @@protoc_insertion_point(field_release:mpr.chubby.LockRequest.key)
+inline std::string* LogoutRequest::_internal_mutable_uuid() {
   
-  return key_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.uuid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* LogoutRequest::release_uuid() {
+  // @@protoc_insertion_point(field_release:mpr.chubby.LogoutRequest.uuid)
+  return _impl_.uuid_.Release();
 }
-inline void LockRequest::set_allocated_key(::std::string* key) {
-  if (key != NULL) {
+inline void LogoutRequest::set_allocated_uuid(std::string* uuid) {
+  if (uuid != nullptr) {
     
   } else {
     
   }
-  key_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), key);
-  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.LockRequest.key)
+  _impl_.uuid_.SetAllocated(uuid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.uuid_.IsDefault()) {
+    _impl_.uuid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.LogoutRequest.uuid)
 }
 
-// optional string session_id = 2;
-inline void LockRequest::clear_session_id() {
-  session_id_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-inline const ::std::string& LockRequest::session_id() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.LockRequest.session_id)
-  return session_id_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-inline void LockRequest::set_session_id(const ::std::string& value) {
-  
-  session_id_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:mpr.chubby.LockRequest.session_id)
+// -------------------------------------------------------------------
+
+// LogoutResponse
+
+// .mpr.chubby.Status status = 1;
+inline bool LogoutResponse::_internal_has_status() const {
+  return this != internal_default_instance() && _impl_.status_ != nullptr;
 }
-inline void LockRequest::set_session_id(const char* value) {
-  
-  session_id_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:mpr.chubby.LockRequest.session_id)
+inline bool LogoutResponse::has_status() const {
+  return _internal_has_status();
 }
-inline void LockRequest::set_session_id(const char* value, size_t size) {
-  
-  session_id_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:mpr.chubby.LockRequest.session_id)
+inline void LogoutResponse::clear_status() {
+  if (GetArenaForAllocation() == nullptr && _impl_.status_ != nullptr) {
+    delete _impl_.status_;
+  }
+  _impl_.status_ = nullptr;
 }
-inline ::std::string* LockRequest::mutable_session_id() {
-  
-  // @@protoc_insertion_point(field_mutable:mpr.chubby.LockRequest.session_id)
-  return session_id_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline const ::mpr::chubby::Status& LogoutResponse::_internal_status() const {
+  const ::mpr::chubby::Status* p = _impl_.status_;
+  return p != nullptr ? *p : reinterpret_cast<const ::mpr::chubby::Status&>(
+      ::mpr::chubby::_Status_default_instance_);
 }
-inline ::std::string* LockRequest::release_session_id() {
-  // @@protoc_insertion_point(field_release:mpr.chubby.LockRequest.session_id)
-  
-  return session_id_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline const ::mpr::chubby::Status& LogoutResponse::status() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.LogoutResponse.status)
+  return _internal_status();
 }
-inline void LockRequest::set_allocated_session_id(::std::string* session_id) {
-  if (session_id != NULL) {
+inline void LogoutResponse::unsafe_arena_set_allocated_status(
+    ::mpr::chubby::Status* status) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.status_);
+  }
+  _impl_.status_ = status;
+  if (status) {
     
   } else {
     
   }
-  session_id_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), session_id);
-  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.LockRequest.session_id)
-}
-
-// optional string hostname = 3;
-inline void LockRequest::clear_hostname() {
-  hostname_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-inline const ::std::string& LockRequest::hostname() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.LockRequest.hostname)
-  return hostname_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-inline void LockRequest::set_hostname(const ::std::string& value) {
-  
-  hostname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:mpr.chubby.LockRequest.hostname)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:mpr.chubby.LogoutResponse.status)
 }
-inline void LockRequest::set_hostname(const char* value) {
+inline ::mpr::chubby::Status* LogoutResponse::release_status() {
   
-  hostname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:mpr.chubby.LockRequest.hostname)
+  ::mpr::chubby::Status* temp = _impl_.status_;
+  _impl_.status_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline void LockRequest::set_hostname(const char* value, size_t size) {
+inline ::mpr::chubby::Status* LogoutResponse::unsafe_arena_release_status() {
+  // @@protoc_insertion_point(field_release:mpr.chubby.LogoutResponse.status)
   
-  hostname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:mpr.chubby.LockRequest.hostname)
+  ::mpr::chubby::Status* temp = _impl_.status_;
+  _impl_.status_ = nullptr;
+  return temp;
 }
-inline ::std::string* LockRequest::mutable_hostname() {
+inline ::mpr::chubby::Status* LogoutResponse::_internal_mutable_status() {
   
-  // @@protoc_insertion_point(field_mutable:mpr.chubby.LockRequest.hostname)
-  return hostname_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (_impl_.status_ == nullptr) {
+    auto* p = CreateMaybeMessage<::mpr::chubby::Status>(GetArenaForAllocation());
+    _impl_.status_ = p;
+  }
+  return _impl_.status_;
 }
-inline ::std::string* LockRequest::release_hostname() {
-  // @@protoc_insertion_point(field_release:mpr.chubby.LockRequest.hostname)
-  
-  return hostname_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline ::mpr::chubby::Status* LogoutResponse::mutable_status() {
+  ::mpr::chubby::Status* _msg = _internal_mutable_status();
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.LogoutResponse.status)
+  return _msg;
 }
-inline void LockRequest::set_allocated_hostname(::std::string* hostname) {
-  if (hostname != NULL) {
+inline void LogoutResponse::set_allocated_status(::mpr::chubby::Status* status) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.status_;
+  }
+  if (status) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(status);
+    if (message_arena != submessage_arena) {
+      status = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, status, submessage_arena);
+    }
     
   } else {
     
   }
-  hostname_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), hostname);
-  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.LockRequest.hostname)
+  _impl_.status_ = status;
+  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.LogoutResponse.status)
 }
 
-// optional string uuid = 4;
-inline void LockRequest::clear_uuid() {
-  uuid_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// string leader_id = 2;
+inline void LogoutResponse::clear_leader_id() {
+  _impl_.leader_id_.ClearToEmpty();
 }
-inline const ::std::string& LockRequest::uuid() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.LockRequest.uuid)
-  return uuid_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline const std::string& LogoutResponse::leader_id() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.LogoutResponse.leader_id)
+  return _internal_leader_id();
 }
-inline void LockRequest::set_uuid(const ::std::string& value) {
-  
-  uuid_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:mpr.chubby.LockRequest.uuid)
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void LogoutResponse::set_leader_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.leader_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpr.chubby.LogoutResponse.leader_id)
 }
-inline void LockRequest::set_uuid(const char* value) {
-  
-  uuid_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:mpr.chubby.LockRequest.uuid)
+inline std::string* LogoutResponse::mutable_leader_id() {
+  std::string* _s = _internal_mutable_leader_id();
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.LogoutResponse.leader_id)
+  return _s;
 }
-inline void LockRequest::set_uuid(const char* value, size_t size) {
-  
-  uuid_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:mpr.chubby.LockRequest.uuid)
+inline const std::string& LogoutResponse::_internal_leader_id() const {
+  return _impl_.leader_id_.Get();
 }
-inline ::std::string* LockRequest::mutable_uuid() {
+inline void LogoutResponse::_internal_set_leader_id(const std::string& value) {
   
-  // @@protoc_insertion_point(field_mutable:mpr.chubby.LockRequest.uuid)
-  return uuid_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.leader_id_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* LockRequest::release_uuid() {
-  // @@protoc_insertion_point(field_release:mpr.chubby.LockRequest.uuid)
+inline std::string* LogoutResponse::_internal_mutable_leader_id() {
   
-  return uuid_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.leader_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* LogoutResponse::release_leader_id() {
+  // @@protoc_insertion_point(field_release:mpr.chubby.LogoutResponse.leader_id)
+  return _impl_.leader_id_.Release();
 }
-inline void LockRequest::set_allocated_uuid(::std::string* uuid) {
-  if (uuid != NULL) {
+inline void LogoutResponse::set_allocated_leader_id(std::string* leader_id) {
+  if (leader_id != nullptr) {
     
   } else {
     
   }
-  uuid_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), uuid);
-  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.LockRequest.uuid)
+  _impl_.leader_id_.SetAllocated(leader_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.leader_id_.IsDefault()) {
+    _impl_.leader_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.LogoutResponse.leader_id)
 }
 
 // -------------------------------------------------------------------
 
-// LockResponse
+// RegisterRequest
 
-// optional bool success = 1;
-inline void LockResponse::clear_success() {
-  success_ = false;
-}
-inline bool LockResponse::success() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.LockResponse.success)
-  return success_;
-}
-inline void LockResponse::set_success(bool value) {
-  
-  success_ = value;
-  // @@protoc_insertion_point(field_set:mpr.chubby.LockResponse.success)
+// string username = 1;
+inline void RegisterRequest::clear_username() {
+  _impl_.username_.ClearToEmpty();
 }
-
-// optional string leader_id = 2;
-inline void LockResponse::clear_leader_id() {
-  leader_id_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline const std::string& RegisterRequest::username() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.RegisterRequest.username)
+  return _internal_username();
 }
-inline const ::std::string& LockResponse::leader_id() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.LockResponse.leader_id)
-  return leader_id_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RegisterRequest::set_username(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.username_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpr.chubby.RegisterRequest.username)
 }
-inline void LockResponse::set_leader_id(const ::std::string& value) {
-  
-  leader_id_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:mpr.chubby.LockResponse.leader_id)
+inline std::string* RegisterRequest::mutable_username() {
+  std::string* _s = _internal_mutable_username();
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.RegisterRequest.username)
+  return _s;
 }
-inline void LockResponse::set_leader_id(const char* value) {
-  
-  leader_id_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:mpr.chubby.LockResponse.leader_id)
+inline const std::string& RegisterRequest::_internal_username() const {
+  return _impl_.username_.Get();
 }
-inline void LockResponse::set_leader_id(const char* value, size_t size) {
+inline void RegisterRequest::_internal_set_username(const std::string& value) {
   
-  leader_id_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:mpr.chubby.LockResponse.leader_id)
+  _impl_.username_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* LockResponse::mutable_leader_id() {
+inline std::string* RegisterRequest::_internal_mutable_username() {
   
-  // @@protoc_insertion_point(field_mutable:mpr.chubby.LockResponse.leader_id)
-  return leader_id_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.username_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* LockResponse::release_leader_id() {
-  // @@protoc_insertion_point(field_release:mpr.chubby.LockResponse.leader_id)
-  
-  return leader_id_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline std::string* RegisterRequest::release_username() {
+  // @@protoc_insertion_point(field_release:mpr.chubby.RegisterRequest.username)
+  return _impl_.username_.Release();
 }
-inline void LockResponse::set_allocated_leader_id(::std::string* leader_id) {
-  if (leader_id != NULL) {
+inline void RegisterRequest::set_allocated_username(std::string* username) {
+  if (username != nullptr) {
     
   } else {
     
   }
-  leader_id_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), leader_id);
-  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.LockResponse.leader_id)
-}
-
-// optional bool uuid_expired = 3;
-inline void LockResponse::clear_uuid_expired() {
-  uuid_expired_ = false;
-}
-inline bool LockResponse::uuid_expired() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.LockResponse.uuid_expired)
-  return uuid_expired_;
-}
-inline void LockResponse::set_uuid_expired(bool value) {
-  
-  uuid_expired_ = value;
-  // @@protoc_insertion_point(field_set:mpr.chubby.LockResponse.uuid_expired)
-}
-
-// -------------------------------------------------------------------
-
-// KeepAliveRequest
+  _impl_.username_.SetAllocated(username, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.username_.IsDefault()) {
+    _impl_.username_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.RegisterRequest.username)
+}
 
-// optional string session_id = 1;
-inline void KeepAliveRequest::clear_session_id() {
-  session_id_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// string passwd = 2;
+inline void RegisterRequest::clear_passwd() {
+  _impl_.passwd_.ClearToEmpty();
 }
-inline const ::std::string& KeepAliveRequest::session_id() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.KeepAliveRequest.session_id)
-  return session_id_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline const std::string& RegisterRequest::passwd() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.RegisterRequest.passwd)
+  return _internal_passwd();
 }
-inline void KeepAliveRequest::set_session_id(const ::std::string& value) {
-  
-  session_id_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:mpr.chubby.KeepAliveRequest.session_id)
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RegisterRequest::set_passwd(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.passwd_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpr.chubby.RegisterRequest.passwd)
 }
-inline void KeepAliveRequest::set_session_id(const char* value) {
-  
-  session_id_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:mpr.chubby.KeepAliveRequest.session_id)
+inline std::string* RegisterRequest::mutable_passwd() {
+  std::string* _s = _internal_mutable_passwd();
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.RegisterRequest.passwd)
+  return _s;
 }
-inline void KeepAliveRequest::set_session_id(const char* value, size_t size) {
-  
-  session_id_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:mpr.chubby.KeepAliveRequest.session_id)
+inline const std::string& RegisterRequest::_internal_passwd() const {
+  return _impl_.passwd_.Get();
 }
-inline ::std::string* KeepAliveRequest::mutable_session_id() {
+inline void RegisterRequest::_internal_set_passwd(const std::string& value) {
   
-  // @@protoc_insertion_point(field_mutable:mpr.chubby.KeepAliveRequest.session_id)
-  return session_id_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.passwd_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* KeepAliveRequest::release_session_id() {
-  // @@protoc_insertion_point(field_release:mpr.chubby.KeepAliveRequest.session_id)
+inline std::string* RegisterRequest::_internal_mutable_passwd() {
   
-  return session_id_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.passwd_.Mutable(GetArenaForAllocation());
+}
+inline std::string* RegisterRequest::release_passwd() {
+  // @@protoc_insertion_point(field_release:mpr.chubby.RegisterRequest.passwd)
+  return _impl_.passwd_.Release();
 }
-inline void KeepAliveRequest::set_allocated_session_id(::std::string* session_id) {
-  if (session_id != NULL) {
+inline void RegisterRequest::set_allocated_passwd(std::string* passwd) {
+  if (passwd != nullptr) {
     
   } else {
     
   }
-  session_id_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), session_id);
-  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.KeepAliveRequest.session_id)
+  _impl_.passwd_.SetAllocated(passwd, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.passwd_.IsDefault()) {
+    _impl_.passwd_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.RegisterRequest.passwd)
 }
 
-// optional string uuid = 2;
-inline void KeepAliveRequest::clear_uuid() {
-  uuid_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// -------------------------------------------------------------------
+
+// RegisterResponse
+
+// .mpr.chubby.Status status = 1;
+inline bool RegisterResponse::_internal_has_status() const {
+  return this != internal_default_instance() && _impl_.status_ != nullptr;
 }
-inline const ::std::string& KeepAliveRequest::uuid() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.KeepAliveRequest.uuid)
-  return uuid_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline bool RegisterResponse::has_status() const {
+  return _internal_has_status();
 }
-inline void KeepAliveRequest::set_uuid(const ::std::string& value) {
-  
-  uuid_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:mpr.chubby.KeepAliveRequest.uuid)
+inline void RegisterResponse::clear_status() {
+  if (GetArenaForAllocation() == nullptr && _impl_.status_ != nullptr) {
+    delete _impl_.status_;
+  }
+  _impl_.status_ = nullptr;
 }
-inline void KeepAliveRequest::set_uuid(const char* value) {
-  
-  uuid_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:mpr.chubby.KeepAliveRequest.uuid)
+inline const ::mpr::chubby::Status& RegisterResponse::_internal_status() const {
+  const ::mpr::chubby::Status* p = _impl_.status_;
+  return p != nullptr ? *p : reinterpret_cast<const ::mpr::chubby::Status&>(
+      ::mpr::chubby::_Status_default_instance_);
+}
+inline const ::mpr::chubby::Status& RegisterResponse::status() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.RegisterResponse.status)
+  return _internal_status();
+}
+inline void RegisterResponse::unsafe_arena_set_allocated_status(
+    ::mpr::chubby::Status* status) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.status_);
+  }
+  _impl_.status_ = status;
+  if (status) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:mpr.chubby.RegisterResponse.status)
 }
-inline void KeepAliveRequest::set_uuid(const char* value, size_t size) {
+inline ::mpr::chubby::Status* RegisterResponse::release_status() {
   
-  uuid_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:mpr.chubby.KeepAliveRequest.uuid)
+  ::mpr::chubby::Status* temp = _impl_.status_;
+  _impl_.status_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline ::std::string* KeepAliveRequest::mutable_uuid() {
+inline ::mpr::chubby::Status* RegisterResponse::unsafe_arena_release_status() {
+  // @@protoc_insertion_point(field_release:mpr.chubby.RegisterResponse.status)
   
-  // @@protoc_insertion_point(field_mutable:mpr.chubby.KeepAliveRequest.uuid)
-  return uuid_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::mpr::chubby::Status* temp = _impl_.status_;
+  _impl_.status_ = nullptr;
+  return temp;
 }
-inline ::std::string* KeepAliveRequest::release_uuid() {
-  // @@protoc_insertion_point(field_release:mpr.chubby.KeepAliveRequest.uuid)
+inline ::mpr::chubby::Status* RegisterResponse::_internal_mutable_status() {
   
-  return uuid_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (_impl_.status_ == nullptr) {
+    auto* p = CreateMaybeMessage<::mpr::chubby::Status>(GetArenaForAllocation());
+    _impl_.status_ = p;
+  }
+  return _impl_.status_;
+}
+inline ::mpr::chubby::Status* RegisterResponse::mutable_status() {
+  ::mpr::chubby::Status* _msg = _internal_mutable_status();
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.RegisterResponse.status)
+  return _msg;
 }
-inline void KeepAliveRequest::set_allocated_uuid(::std::string* uuid) {
-  if (uuid != NULL) {
+inline void RegisterResponse::set_allocated_status(::mpr::chubby::Status* status) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.status_;
+  }
+  if (status) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(status);
+    if (message_arena != submessage_arena) {
+      status = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, status, submessage_arena);
+    }
     
   } else {
     
   }
-  uuid_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), uuid);
-  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.KeepAliveRequest.uuid)
+  _impl_.status_ = status;
+  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.RegisterResponse.status)
 }
 
-// repeated string locks = 3;
-inline int KeepAliveRequest::locks_size() const {
-  return locks_.size();
+// string leader_id = 2;
+inline void RegisterResponse::clear_leader_id() {
+  _impl_.leader_id_.ClearToEmpty();
 }
-inline void KeepAliveRequest::clear_locks() {
-  locks_.Clear();
+inline const std::string& RegisterResponse::leader_id() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.RegisterResponse.leader_id)
+  return _internal_leader_id();
 }
-inline const ::std::string& KeepAliveRequest::locks(int index) const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.KeepAliveRequest.locks)
-  return locks_.Get(index);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RegisterResponse::set_leader_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.leader_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpr.chubby.RegisterResponse.leader_id)
 }
-inline ::std::string* KeepAliveRequest::mutable_locks(int index) {
-  // @@protoc_insertion_point(field_mutable:mpr.chubby.KeepAliveRequest.locks)
-  return locks_.Mutable(index);
+inline std::string* RegisterResponse::mutable_leader_id() {
+  std::string* _s = _internal_mutable_leader_id();
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.RegisterResponse.leader_id)
+  return _s;
 }
-inline void KeepAliveRequest::set_locks(int index, const ::std::string& value) {
-  // @@protoc_insertion_point(field_set:mpr.chubby.KeepAliveRequest.locks)
-  locks_.Mutable(index)->assign(value);
+inline const std::string& RegisterResponse::_internal_leader_id() const {
+  return _impl_.leader_id_.Get();
 }
-inline void KeepAliveRequest::set_locks(int index, const char* value) {
-  locks_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set_char:mpr.chubby.KeepAliveRequest.locks)
+inline void RegisterResponse::_internal_set_leader_id(const std::string& value) {
+  
+  _impl_.leader_id_.Set(value, GetArenaForAllocation());
 }
-inline void KeepAliveRequest::set_locks(int index, const char* value, size_t size) {
-  locks_.Mutable(index)->assign(
-    reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:mpr.chubby.KeepAliveRequest.locks)
+inline std::string* RegisterResponse::_internal_mutable_leader_id() {
+  
+  return _impl_.leader_id_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* KeepAliveRequest::add_locks() {
-  // @@protoc_insertion_point(field_add_mutable:mpr.chubby.KeepAliveRequest.locks)
-  return locks_.Add();
+inline std::string* RegisterResponse::release_leader_id() {
+  // @@protoc_insertion_point(field_release:mpr.chubby.RegisterResponse.leader_id)
+  return _impl_.leader_id_.Release();
 }
-inline void KeepAliveRequest::add_locks(const ::std::string& value) {
-  locks_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add:mpr.chubby.KeepAliveRequest.locks)
+inline void RegisterResponse::set_allocated_leader_id(std::string* leader_id) {
+  if (leader_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.leader_id_.SetAllocated(leader_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.leader_id_.IsDefault()) {
+    _impl_.leader_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.RegisterResponse.leader_id)
 }
-inline void KeepAliveRequest::add_locks(const char* value) {
-  locks_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add_char:mpr.chubby.KeepAliveRequest.locks)
+
+// -------------------------------------------------------------------
+
+// CleanBinlogRequest
+
+// int64 end_index = 1;
+inline void CleanBinlogRequest::clear_end_index() {
+  _impl_.end_index_ = int64_t{0};
 }
-inline void KeepAliveRequest::add_locks(const char* value, size_t size) {
-  locks_.Add()->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_add_pointer:mpr.chubby.KeepAliveRequest.locks)
+inline int64_t CleanBinlogRequest::_internal_end_index() const {
+  return _impl_.end_index_;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::std::string>&
-KeepAliveRequest::locks() const {
-  // @@protoc_insertion_point(field_list:mpr.chubby.KeepAliveRequest.locks)
-  return locks_;
+inline int64_t CleanBinlogRequest::end_index() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.CleanBinlogRequest.end_index)
+  return _internal_end_index();
 }
-inline ::google::protobuf::RepeatedPtrField< ::std::string>*
-KeepAliveRequest::mutable_locks() {
-  // @@protoc_insertion_point(field_mutable_list:mpr.chubby.KeepAliveRequest.locks)
-  return &locks_;
+inline void CleanBinlogRequest::_internal_set_end_index(int64_t value) {
+  
+  _impl_.end_index_ = value;
+}
+inline void CleanBinlogRequest::set_end_index(int64_t value) {
+  _internal_set_end_index(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.CleanBinlogRequest.end_index)
 }
 
-// optional bool forward_from_leader = 4;
-inline void KeepAliveRequest::clear_forward_from_leader() {
-  forward_from_leader_ = false;
+// -------------------------------------------------------------------
+
+// CleanBinlogResponse
+
+// bool success = 1;
+inline void CleanBinlogResponse::clear_success() {
+  _impl_.success_ = false;
 }
-inline bool KeepAliveRequest::forward_from_leader() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.KeepAliveRequest.forward_from_leader)
-  return forward_from_leader_;
+inline bool CleanBinlogResponse::_internal_success() const {
+  return _impl_.success_;
 }
-inline void KeepAliveRequest::set_forward_from_leader(bool value) {
+inline bool CleanBinlogResponse::success() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.CleanBinlogResponse.success)
+  return _internal_success();
+}
+inline void CleanBinlogResponse::_internal_set_success(bool value) {
   
-  forward_from_leader_ = value;
-  // @@protoc_insertion_point(field_set:mpr.chubby.KeepAliveRequest.forward_from_leader)
+  _impl_.success_ = value;
+}
+inline void CleanBinlogResponse::set_success(bool value) {
+  _internal_set_success(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.CleanBinlogResponse.success)
 }
 
 // -------------------------------------------------------------------
 
-// KeepAliveResponse
+// RpcStatRequest
 
-// optional bool success = 1;
-inline void KeepAliveResponse::clear_success() {
-  success_ = false;
+// repeated .mpr.chubby.StatOperation op = 1;
+inline int RpcStatRequest::_internal_op_size() const {
+  return _impl_.op_.size();
 }
-inline bool KeepAliveResponse::success() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.KeepAliveResponse.success)
-  return success_;
+inline int RpcStatRequest::op_size() const {
+  return _internal_op_size();
 }
-inline void KeepAliveResponse::set_success(bool value) {
-  
-  success_ = value;
-  // @@protoc_insertion_point(field_set:mpr.chubby.KeepAliveResponse.success)
+inline void RpcStatRequest::clear_op() {
+  _impl_.op_.Clear();
 }
-
-// optional string leader_id = 2;
-inline void KeepAliveResponse::clear_leader_id() {
-  leader_id_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline ::mpr::chubby::StatOperation RpcStatRequest::_internal_op(int index) const {
+  return static_cast< ::mpr::chubby::StatOperation >(_impl_.op_.Get(index));
 }
-inline const ::std::string& KeepAliveResponse::leader_id() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.KeepAliveResponse.leader_id)
-  return leader_id_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline ::mpr::chubby::StatOperation RpcStatRequest::op(int index) const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.RpcStatRequest.op)
+  return _internal_op(index);
 }
-inline void KeepAliveResponse::set_leader_id(const ::std::string& value) {
-  
-  leader_id_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:mpr.chubby.KeepAliveResponse.leader_id)
+inline void RpcStatRequest::set_op(int index, ::mpr::chubby::StatOperation value) {
+  _impl_.op_.Set(index, value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.RpcStatRequest.op)
 }
-inline void KeepAliveResponse::set_leader_id(const char* value) {
-  
-  leader_id_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:mpr.chubby.KeepAliveResponse.leader_id)
+inline void RpcStatRequest::_internal_add_op(::mpr::chubby::StatOperation value) {
+  _impl_.op_.Add(value);
 }
-inline void KeepAliveResponse::set_leader_id(const char* value, size_t size) {
-  
-  leader_id_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:mpr.chubby.KeepAliveResponse.leader_id)
+inline void RpcStatRequest::add_op(::mpr::chubby::StatOperation value) {
+  _internal_add_op(value);
+  // @@protoc_insertion_point(field_add:mpr.chubby.RpcStatRequest.op)
 }
-inline ::std::string* KeepAliveResponse::mutable_leader_id() {
-  
-  // @@protoc_insertion_point(field_mutable:mpr.chubby.KeepAliveResponse.leader_id)
-  return leader_id_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>&
+RpcStatRequest::op() const {
+  // @@protoc_insertion_point(field_list:mpr.chubby.RpcStatRequest.op)
+  return _impl_.op_;
 }
-inline ::std::string* KeepAliveResponse::release_leader_id() {
-  // @@protoc_insertion_point(field_release:mpr.chubby.KeepAliveResponse.leader_id)
-  
-  return leader_id_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>*
+RpcStatRequest::_internal_mutable_op() {
+  return &_impl_.op_;
 }
-inline void KeepAliveResponse::set_allocated_leader_id(::std::string* leader_id) {
-  if (leader_id != NULL) {
-    
-  } else {
-    
-  }
-  leader_id_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), leader_id);
-  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.KeepAliveResponse.leader_id)
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>*
+RpcStatRequest::mutable_op() {
+  // @@protoc_insertion_point(field_mutable_list:mpr.chubby.RpcStatRequest.op)
+  return _internal_mutable_op();
 }
 
 // -------------------------------------------------------------------
 
-// LoginRequest
+// RpcStatResponse
 
-// optional string username = 1;
-inline void LoginRequest::clear_username() {
-  username_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-inline const ::std::string& LoginRequest::username() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.LoginRequest.username)
-  return username_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// .mpr.chubby.NodeStatus status = 1;
+inline void RpcStatResponse::clear_status() {
+  _impl_.status_ = 0;
 }
-inline void LoginRequest::set_username(const ::std::string& value) {
-  
-  username_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:mpr.chubby.LoginRequest.username)
+inline ::mpr::chubby::NodeStatus RpcStatResponse::_internal_status() const {
+  return static_cast< ::mpr::chubby::NodeStatus >(_impl_.status_);
 }
-inline void LoginRequest::set_username(const char* value) {
-  
-  username_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:mpr.chubby.LoginRequest.username)
+inline ::mpr::chubby::NodeStatus RpcStatResponse::status() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.RpcStatResponse.status)
+  return _internal_status();
 }
-inline void LoginRequest::set_username(const char* value, size_t size) {
+inline void RpcStatResponse::_internal_set_status(::mpr::chubby::NodeStatus value) {
   
-  username_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:mpr.chubby.LoginRequest.username)
+  _impl_.status_ = value;
 }
-inline ::std::string* LoginRequest::mutable_username() {
-  
-  // @@protoc_insertion_point(field_mutable:mpr.chubby.LoginRequest.username)
-  return username_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void RpcStatResponse::set_status(::mpr::chubby::NodeStatus value) {
+  _internal_set_status(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.RpcStatResponse.status)
 }
-inline ::std::string* LoginRequest::release_username() {
-  // @@protoc_insertion_point(field_release:mpr.chubby.LoginRequest.username)
-  
-  return username_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+
+// repeated .mpr.chubby.StatInfo stats = 2;
+inline int RpcStatResponse::_internal_stats_size() const {
+  return _impl_.stats_.size();
 }
-inline void LoginRequest::set_allocated_username(::std::string* username) {
-  if (username != NULL) {
-    
-  } else {
-    
-  }
-  username_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), username);
-  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.LoginRequest.username)
+inline int RpcStatResponse::stats_size() const {
+  return _internal_stats_size();
 }
-
-// optional string passwd = 2;
-inline void LoginRequest::clear_passwd() {
-  passwd_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void RpcStatResponse::clear_stats() {
+  _impl_.stats_.Clear();
 }
-inline const ::std::string& LoginRequest::passwd() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.LoginRequest.passwd)
-  return passwd_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline ::mpr::chubby::StatInfo* RpcStatResponse::mutable_stats(int index) {
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.RpcStatResponse.stats)
+  return _impl_.stats_.Mutable(index);
 }
-inline void LoginRequest::set_passwd(const ::std::string& value) {
-  
-  passwd_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:mpr.chubby.LoginRequest.passwd)
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::mpr::chubby::StatInfo >*
+RpcStatResponse::mutable_stats() {
+  // @@protoc_insertion_point(field_mutable_list:mpr.chubby.RpcStatResponse.stats)
+  return &_impl_.stats_;
 }
-inline void LoginRequest::set_passwd(const char* value) {
-  
-  passwd_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:mpr.chubby.LoginRequest.passwd)
+inline const ::mpr::chubby::StatInfo& RpcStatResponse::_internal_stats(int index) const {
+  return _impl_.stats_.Get(index);
 }
-inline void LoginRequest::set_passwd(const char* value, size_t size) {
-  
-  passwd_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:mpr.chubby.LoginRequest.passwd)
+inline const ::mpr::chubby::StatInfo& RpcStatResponse::stats(int index) const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.RpcStatResponse.stats)
+  return _internal_stats(index);
 }
-inline ::std::string* LoginRequest::mutable_passwd() {
-  
-  // @@protoc_insertion_point(field_mutable:mpr.chubby.LoginRequest.passwd)
-  return passwd_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline ::mpr::chubby::StatInfo* RpcStatResponse::_internal_add_stats() {
+  return _impl_.stats_.Add();
 }
-inline ::std::string* LoginRequest::release_passwd() {
-  // @@protoc_insertion_point(field_release:mpr.chubby.LoginRequest.passwd)
-  
-  return passwd_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline ::mpr::chubby::StatInfo* RpcStatResponse::add_stats() {
+  ::mpr::chubby::StatInfo* _add = _internal_add_stats();
+  // @@protoc_insertion_point(field_add:mpr.chubby.RpcStatResponse.stats)
+  return _add;
 }
-inline void LoginRequest::set_allocated_passwd(::std::string* passwd) {
-  if (passwd != NULL) {
-    
-  } else {
-    
-  }
-  passwd_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), passwd);
-  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.LoginRequest.passwd)
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::mpr::chubby::StatInfo >&
+RpcStatResponse::stats() const {
+  // @@protoc_insertion_point(field_list:mpr.chubby.RpcStatResponse.stats)
+  return _impl_.stats_;
 }
 
 // -------------------------------------------------------------------
 
-// Status
+// GroupHeartbeat
 
-// optional int64 code = 1;
-inline void Status::clear_code() {
-  code_ = GOOGLE_LONGLONG(0);
+// int32 group_id = 1;
+inline void GroupHeartbeat::clear_group_id() {
+  _impl_.group_id_ = 0;
 }
-inline ::google::protobuf::int64 Status::code() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.Status.code)
-  return code_;
+inline int32_t GroupHeartbeat::_internal_group_id() const {
+  return _impl_.group_id_;
+}
+inline int32_t GroupHeartbeat::group_id() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.GroupHeartbeat.group_id)
+  return _internal_group_id();
 }
-inline void Status::set_code(::google::protobuf::int64 value) {
+inline void GroupHeartbeat::_internal_set_group_id(int32_t value) {
   
-  code_ = value;
-  // @@protoc_insertion_point(field_set:mpr.chubby.Status.code)
+  _impl_.group_id_ = value;
+}
+inline void GroupHeartbeat::set_group_id(int32_t value) {
+  _internal_set_group_id(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.GroupHeartbeat.group_id)
 }
 
-// optional string message = 2;
-inline void Status::clear_message() {
-  message_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// int64 term = 2;
+inline void GroupHeartbeat::clear_term() {
+  _impl_.term_ = int64_t{0};
 }
-inline const ::std::string& Status::message() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.Status.message)
-  return message_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline int64_t GroupHeartbeat::_internal_term() const {
+  return _impl_.term_;
 }
-inline void Status::set_message(const ::std::string& value) {
-  
-  message_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:mpr.chubby.Status.message)
+inline int64_t GroupHeartbeat::term() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.GroupHeartbeat.term)
+  return _internal_term();
 }
-inline void Status::set_message(const char* value) {
+inline void GroupHeartbeat::_internal_set_term(int64_t value) {
   
-  message_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:mpr.chubby.Status.message)
+  _impl_.term_ = value;
 }
-inline void Status::set_message(const char* value, size_t size) {
-  
-  message_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:mpr.chubby.Status.message)
+inline void GroupHeartbeat::set_term(int64_t value) {
+  _internal_set_term(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.GroupHeartbeat.term)
+}
+
+// int64 commit_index = 3;
+inline void GroupHeartbeat::clear_commit_index() {
+  _impl_.commit_index_ = int64_t{0};
+}
+inline int64_t GroupHeartbeat::_internal_commit_index() const {
+  return _impl_.commit_index_;
 }
-inline ::std::string* Status::mutable_message() {
+inline int64_t GroupHeartbeat::commit_index() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.GroupHeartbeat.commit_index)
+  return _internal_commit_index();
+}
+inline void GroupHeartbeat::_internal_set_commit_index(int64_t value) {
   
-  // @@protoc_insertion_point(field_mutable:mpr.chubby.Status.message)
-  return message_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.commit_index_ = value;
 }
-inline ::std::string* Status::release_message() {
-  // @@protoc_insertion_point(field_release:mpr.chubby.Status.message)
+inline void GroupHeartbeat::set_commit_index(int64_t value) {
+  _internal_set_commit_index(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.GroupHeartbeat.commit_index)
+}
+
+// int64 heartbeat_interval_micros = 4;
+inline void GroupHeartbeat::clear_heartbeat_interval_micros() {
+  _impl_.heartbeat_interval_micros_ = int64_t{0};
+}
+inline int64_t GroupHeartbeat::_internal_heartbeat_interval_micros() const {
+  return _impl_.heartbeat_interval_micros_;
+}
+inline int64_t GroupHeartbeat::heartbeat_interval_micros() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.GroupHeartbeat.heartbeat_interval_micros)
+  return _internal_heartbeat_interval_micros();
+}
+inline void GroupHeartbeat::_internal_set_heartbeat_interval_micros(int64_t value) {
   
-  return message_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.heartbeat_interval_micros_ = value;
 }
-inline void Status::set_allocated_message(::std::string* message) {
-  if (message != NULL) {
-    
-  } else {
-    
-  }
-  message_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), message);
-  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.Status.message)
+inline void GroupHeartbeat::set_heartbeat_interval_micros(int64_t value) {
+  _internal_set_heartbeat_interval_micros(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.GroupHeartbeat.heartbeat_interval_micros)
 }
 
 // -------------------------------------------------------------------
 
-// LoginResponse
+// GroupHeartbeatResponse
 
-// optional .mpr.chubby.Status status = 1;
-inline bool LoginResponse::has_status() const {
-  return !_is_default_instance_ && status_ != NULL;
+// int64 current_term = 1;
+inline void GroupHeartbeatResponse::clear_current_term() {
+  _impl_.current_term_ = int64_t{0};
 }
-inline void LoginResponse::clear_status() {
-  if (GetArenaNoVirtual() == NULL && status_ != NULL) delete status_;
-  status_ = NULL;
+inline int64_t GroupHeartbeatResponse::_internal_current_term() const {
+  return _impl_.current_term_;
 }
-inline const ::mpr::chubby::Status& LoginResponse::status() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.LoginResponse.status)
-  return status_ != NULL ? *status_ : *default_instance_->status_;
+inline int64_t GroupHeartbeatResponse::current_term() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.GroupHeartbeatResponse.current_term)
+  return _internal_current_term();
 }
-inline ::mpr::chubby::Status* LoginResponse::mutable_status() {
+inline void GroupHeartbeatResponse::_internal_set_current_term(int64_t value) {
   
-  if (status_ == NULL) {
-    status_ = new ::mpr::chubby::Status;
-  }
-  // @@protoc_insertion_point(field_mutable:mpr.chubby.LoginResponse.status)
-  return status_;
+  _impl_.current_term_ = value;
 }
-inline ::mpr::chubby::Status* LoginResponse::release_status() {
-  // @@protoc_insertion_point(field_release:mpr.chubby.LoginResponse.status)
+inline void GroupHeartbeatResponse::set_current_term(int64_t value) {
+  _internal_set_current_term(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.GroupHeartbeatResponse.current_term)
+}
+
+// bool success = 2;
+inline void GroupHeartbeatResponse::clear_success() {
+  _impl_.success_ = false;
+}
+inline bool GroupHeartbeatResponse::_internal_success() const {
+  return _impl_.success_;
+}
+inline bool GroupHeartbeatResponse::success() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.GroupHeartbeatResponse.success)
+  return _internal_success();
+}
+inline void GroupHeartbeatResponse::_internal_set_success(bool value) {
   
-  ::mpr::chubby::Status* temp = status_;
-  status_ = NULL;
-  return temp;
+  _impl_.success_ = value;
 }
-inline void LoginResponse::set_allocated_status(::mpr::chubby::Status* status) {
-  delete status_;
-  status_ = status;
-  if (status) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.LoginResponse.status)
+inline void GroupHeartbeatResponse::set_success(bool value) {
+  _internal_set_success(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.GroupHeartbeatResponse.success)
 }
 
-// optional string uuid = 2;
-inline void LoginResponse::clear_uuid() {
-  uuid_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// -------------------------------------------------------------------
+
+// CoalescedHeartbeatRequest
+
+// string leader_id = 1;
+inline void CoalescedHeartbeatRequest::clear_leader_id() {
+  _impl_.leader_id_.ClearToEmpty();
 }
-inline const ::std::string& LoginResponse::uuid() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.LoginResponse.uuid)
-  return uuid_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline const std::string& CoalescedHeartbeatRequest::leader_id() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.CoalescedHeartbeatRequest.leader_id)
+  return _internal_leader_id();
 }
-inline void LoginResponse::set_uuid(const ::std::string& value) {
-  
-  uuid_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:mpr.chubby.LoginResponse.uuid)
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CoalescedHeartbeatRequest::set_leader_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.leader_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpr.chubby.CoalescedHeartbeatRequest.leader_id)
 }
-inline void LoginResponse::set_uuid(const char* value) {
-  
-  uuid_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:mpr.chubby.LoginResponse.uuid)
+inline std::string* CoalescedHeartbeatRequest::mutable_leader_id() {
+  std::string* _s = _internal_mutable_leader_id();
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.CoalescedHeartbeatRequest.leader_id)
+  return _s;
 }
-inline void LoginResponse::set_uuid(const char* value, size_t size) {
-  
-  uuid_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:mpr.chubby.LoginResponse.uuid)
+inline const std::string& CoalescedHeartbeatRequest::_internal_leader_id() const {
+  return _impl_.leader_id_.Get();
 }
-inline ::std::string* LoginResponse::mutable_uuid() {
+inline void CoalescedHeartbeatRequest::_internal_set_leader_id(const std::string& value) {
   
-  // @@protoc_insertion_point(field_mutable:mpr.chubby.LoginResponse.uuid)
-  return uuid_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.leader_id_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* LoginResponse::release_uuid() {
-  // @@protoc_insertion_point(field_release:mpr.chubby.LoginResponse.uuid)
+inline std::string* CoalescedHeartbeatRequest::_internal_mutable_leader_id() {
   
-  return uuid_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.leader_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CoalescedHeartbeatRequest::release_leader_id() {
+  // @@protoc_insertion_point(field_release:mpr.chubby.CoalescedHeartbeatRequest.leader_id)
+  return _impl_.leader_id_.Release();
 }
-inline void LoginResponse::set_allocated_uuid(::std::string* uuid) {
-  if (uuid != NULL) {
+inline void CoalescedHeartbeatRequest::set_allocated_leader_id(std::string* leader_id) {
+  if (leader_id != nullptr) {
     
   } else {
     
   }
-  uuid_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), uuid);
-  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.LoginResponse.uuid)
+  _impl_.leader_id_.SetAllocated(leader_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.leader_id_.IsDefault()) {
+    _impl_.leader_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.CoalescedHeartbeatRequest.leader_id)
 }
 
-// optional string leader_id = 3;
-inline void LoginResponse::clear_leader_id() {
-  leader_id_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// repeated .mpr.chubby.GroupHeartbeat heartbeats = 2;
+inline int CoalescedHeartbeatRequest::_internal_heartbeats_size() const {
+  return _impl_.heartbeats_.size();
 }
-inline const ::std::string& LoginResponse::leader_id() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.LoginResponse.leader_id)
-  return leader_id_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline int CoalescedHeartbeatRequest::heartbeats_size() const {
+  return _internal_heartbeats_size();
 }
-inline void LoginResponse::set_leader_id(const ::std::string& value) {
-  
-  leader_id_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:mpr.chubby.LoginResponse.leader_id)
+inline void CoalescedHeartbeatRequest::clear_heartbeats() {
+  _impl_.heartbeats_.Clear();
 }
-inline void LoginResponse::set_leader_id(const char* value) {
-  
-  leader_id_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:mpr.chubby.LoginResponse.leader_id)
+inline ::mpr::chubby::GroupHeartbeat* CoalescedHeartbeatRequest::mutable_heartbeats(int index) {
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.CoalescedHeartbeatRequest.heartbeats)
+  return _impl_.heartbeats_.Mutable(index);
 }
-inline void LoginResponse::set_leader_id(const char* value, size_t size) {
-  
-  leader_id_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:mpr.chubby.LoginResponse.leader_id)
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::mpr::chubby::GroupHeartbeat >*
+CoalescedHeartbeatRequest::mutable_heartbeats() {
+  // @@protoc_insertion_point(field_mutable_list:mpr.chubby.CoalescedHeartbeatRequest.heartbeats)
+  return &_impl_.heartbeats_;
 }
-inline ::std::string* LoginResponse::mutable_leader_id() {
-  
-  // @@protoc_insertion_point(field_mutable:mpr.chubby.LoginResponse.leader_id)
-  return leader_id_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline const ::mpr::chubby::GroupHeartbeat& CoalescedHeartbeatRequest::_internal_heartbeats(int index) const {
+  return _impl_.heartbeats_.Get(index);
 }
-inline ::std::string* LoginResponse::release_leader_id() {
-  // @@protoc_insertion_point(field_release:mpr.chubby.LoginResponse.leader_id)
-  
-  return leader_id_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline const ::mpr::chubby::GroupHeartbeat& CoalescedHeartbeatRequest::heartbeats(int index) const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.CoalescedHeartbeatRequest.heartbeats)
+  return _internal_heartbeats(index);
 }
-inline void LoginResponse::set_allocated_leader_id(::std::string* leader_id) {
-  if (leader_id != NULL) {
-    
-  } else {
-    
-  }
-  leader_id_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), leader_id);
-  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.LoginResponse.leader_id)
+inline ::mpr::chubby::GroupHeartbeat* CoalescedHeartbeatRequest::_internal_add_heartbeats() {
+  return _impl_.heartbeats_.Add();
+}
+inline ::mpr::chubby::GroupHeartbeat* CoalescedHeartbeatRequest::add_heartbeats() {
+  ::mpr::chubby::GroupHeartbeat* _add = _internal_add_heartbeats();
+  // @@protoc_insertion_point(field_add:mpr.chubby.CoalescedHeartbeatRequest.heartbeats)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::mpr::chubby::GroupHeartbeat >&
+CoalescedHeartbeatRequest::heartbeats() const {
+  // @@protoc_insertion_point(field_list:mpr.chubby.CoalescedHeartbeatRequest.heartbeats)
+  return _impl_.heartbeats_;
 }
 
 // -------------------------------------------------------------------
 
-// LogoutRequest
+// CoalescedHeartbeatResponse
 
-// optional string uuid = 1;
-inline void LogoutRequest::clear_uuid() {
-  uuid_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// repeated .mpr.chubby.GroupHeartbeatResponse responses = 1;
+inline int CoalescedHeartbeatResponse::_internal_responses_size() const {
+  return _impl_.responses_.size();
 }
-inline const ::std::string& LogoutRequest::uuid() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.LogoutRequest.uuid)
-  return uuid_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline int CoalescedHeartbeatResponse::responses_size() const {
+  return _internal_responses_size();
 }
-inline void LogoutRequest::set_uuid(const ::std::string& value) {
-  
-  uuid_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:mpr.chubby.LogoutRequest.uuid)
+inline void CoalescedHeartbeatResponse::clear_responses() {
+  _impl_.responses_.Clear();
 }
-inline void LogoutRequest::set_uuid(const char* value) {
-  
-  uuid_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:mpr.chubby.LogoutRequest.uuid)
+inline ::mpr::chubby::GroupHeartbeatResponse* CoalescedHeartbeatResponse::mutable_responses(int index) {
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.CoalescedHeartbeatResponse.responses)
+  return _impl_.responses_.Mutable(index);
 }
-inline void LogoutRequest::set_uuid(const char* value, size_t size) {
-  
-  uuid_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:mpr.chubby.LogoutRequest.uuid)
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::mpr::chubby::GroupHeartbeatResponse >*
+CoalescedHeartbeatResponse::mutable_responses() {
+  // @@protoc_insertion_point(field_mutable_list:mpr.chubby.CoalescedHeartbeatResponse.responses)
+  return &_impl_.responses_;
 }
-inline ::std::string* LogoutRequest::mutable_uuid() {
-  
-  // @@protoc_insertion_point(field_mutable:mpr.chubby.LogoutRequest.uuid)
-  return uuid_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline const ::mpr::chubby::GroupHeartbeatResponse& CoalescedHeartbeatResponse::_internal_responses(int index) const {
+  return _impl_.responses_.Get(index);
 }
-inline ::std::string* LogoutRequest::release_uuid() {
-  // @@protoc_insertion_point(field_release:mpr.chubby.LogoutRequest.uuid)
-  
-  return uuid_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline const ::mpr::chubby::GroupHeartbeatResponse& CoalescedHeartbeatResponse::responses(int index) const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.CoalescedHeartbeatResponse.responses)
+  return _internal_responses(index);
 }
-inline void LogoutRequest::set_allocated_uuid(::std::string* uuid) {
-  if (uuid != NULL) {
-    
-  } else {
-    
-  }
-  uuid_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), uuid);
-  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.LogoutRequest.uuid)
+inline ::mpr::chubby::GroupHeartbeatResponse* CoalescedHeartbeatResponse::_internal_add_responses() {
+  return _impl_.responses_.Add();
+}
+inline ::mpr::chubby::GroupHeartbeatResponse* CoalescedHeartbeatResponse::add_responses() {
+  ::mpr::chubby::GroupHeartbeatResponse* _add = _internal_add_responses();
+  // @@protoc_insertion_point(field_add:mpr.chubby.CoalescedHeartbeatResponse.responses)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::mpr::chubby::GroupHeartbeatResponse >&
+CoalescedHeartbeatResponse::responses() const {
+  // @@protoc_insertion_point(field_list:mpr.chubby.CoalescedHeartbeatResponse.responses)
+  return _impl_.responses_;
 }
 
 // -------------------------------------------------------------------
 
-// LogoutResponse
+// ShardInfo
 
-// optional .mpr.chubby.Status status = 1;
-inline bool LogoutResponse::has_status() const {
-  return !_is_default_instance_ && status_ != NULL;
-}
-inline void LogoutResponse::clear_status() {
-  if (GetArenaNoVirtual() == NULL && status_ != NULL) delete status_;
-  status_ = NULL;
+// int32 group_id = 1;
+inline void ShardInfo::clear_group_id() {
+  _impl_.group_id_ = 0;
 }
-inline const ::mpr::chubby::Status& LogoutResponse::status() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.LogoutResponse.status)
-  return status_ != NULL ? *status_ : *default_instance_->status_;
+inline int32_t ShardInfo::_internal_group_id() const {
+  return _impl_.group_id_;
 }
-inline ::mpr::chubby::Status* LogoutResponse::mutable_status() {
-  
-  if (status_ == NULL) {
-    status_ = new ::mpr::chubby::Status;
-  }
-  // @@protoc_insertion_point(field_mutable:mpr.chubby.LogoutResponse.status)
-  return status_;
+inline int32_t ShardInfo::group_id() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.ShardInfo.group_id)
+  return _internal_group_id();
 }
-inline ::mpr::chubby::Status* LogoutResponse::release_status() {
-  // @@protoc_insertion_point(field_release:mpr.chubby.LogoutResponse.status)
+inline void ShardInfo::_internal_set_group_id(int32_t value) {
   
-  ::mpr::chubby::Status* temp = status_;
-  status_ = NULL;
-  return temp;
+  _impl_.group_id_ = value;
 }
-inline void LogoutResponse::set_allocated_status(::mpr::chubby::Status* status) {
-  delete status_;
-  status_ = status;
-  if (status) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.LogoutResponse.status)
+inline void ShardInfo::set_group_id(int32_t value) {
+  _internal_set_group_id(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.ShardInfo.group_id)
 }
 
-// optional string leader_id = 2;
-inline void LogoutResponse::clear_leader_id() {
-  leader_id_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// bytes start_key = 2;
+inline void ShardInfo::clear_start_key() {
+  _impl_.start_key_.ClearToEmpty();
 }
-inline const ::std::string& LogoutResponse::leader_id() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.LogoutResponse.leader_id)
-  return leader_id_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline const std::string& ShardInfo::start_key() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.ShardInfo.start_key)
+  return _internal_start_key();
 }
-inline void LogoutResponse::set_leader_id(const ::std::string& value) {
-  
-  leader_id_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:mpr.chubby.LogoutResponse.leader_id)
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ShardInfo::set_start_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.start_key_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpr.chubby.ShardInfo.start_key)
 }
-inline void LogoutResponse::set_leader_id(const char* value) {
-  
-  leader_id_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:mpr.chubby.LogoutResponse.leader_id)
+inline std::string* ShardInfo::mutable_start_key() {
+  std::string* _s = _internal_mutable_start_key();
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.ShardInfo.start_key)
+  return _s;
 }
-inline void LogoutResponse::set_leader_id(const char* value, size_t size) {
-  
-  leader_id_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:mpr.chubby.LogoutResponse.leader_id)
+inline const std::string& ShardInfo::_internal_start_key() const {
+  return _impl_.start_key_.Get();
 }
-inline ::std::string* LogoutResponse::mutable_leader_id() {
+inline void ShardInfo::_internal_set_start_key(const std::string& value) {
   
-  // @@protoc_insertion_point(field_mutable:mpr.chubby.LogoutResponse.leader_id)
-  return leader_id_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.start_key_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* LogoutResponse::release_leader_id() {
-  // @@protoc_insertion_point(field_release:mpr.chubby.LogoutResponse.leader_id)
+inline std::string* ShardInfo::_internal_mutable_start_key() {
   
-  return leader_id_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.start_key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ShardInfo::release_start_key() {
+  // @@protoc_insertion_point(field_release:mpr.chubby.ShardInfo.start_key)
+  return _impl_.start_key_.Release();
 }
-inline void LogoutResponse::set_allocated_leader_id(::std::string* leader_id) {
-  if (leader_id != NULL) {
+inline void ShardInfo::set_allocated_start_key(std::string* start_key) {
+  if (start_key != nullptr) {
     
   } else {
     
   }
-  leader_id_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), leader_id);
-  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.LogoutResponse.leader_id)
+  _impl_.start_key_.SetAllocated(start_key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.start_key_.IsDefault()) {
+    _impl_.start_key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.ShardInfo.start_key)
 }
 
-// -------------------------------------------------------------------
-
-// RegisterRequest
-
-// optional string username = 1;
-inline void RegisterRequest::clear_username() {
-  username_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// bytes end_key = 3;
+inline void ShardInfo::clear_end_key() {
+  _impl_.end_key_.ClearToEmpty();
 }
-inline const ::std::string& RegisterRequest::username() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.RegisterRequest.username)
-  return username_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline const std::string& ShardInfo::end_key() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.ShardInfo.end_key)
+  return _internal_end_key();
 }
-inline void RegisterRequest::set_username(const ::std::string& value) {
-  
-  username_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:mpr.chubby.RegisterRequest.username)
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ShardInfo::set_end_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.end_key_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpr.chubby.ShardInfo.end_key)
 }
-inline void RegisterRequest::set_username(const char* value) {
-  
-  username_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:mpr.chubby.RegisterRequest.username)
+inline std::string* ShardInfo::mutable_end_key() {
+  std::string* _s = _internal_mutable_end_key();
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.ShardInfo.end_key)
+  return _s;
 }
-inline void RegisterRequest::set_username(const char* value, size_t size) {
-  
-  username_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:mpr.chubby.RegisterRequest.username)
+inline const std::string& ShardInfo::_internal_end_key() const {
+  return _impl_.end_key_.Get();
 }
-inline ::std::string* RegisterRequest::mutable_username() {
+inline void ShardInfo::_internal_set_end_key(const std::string& value) {
   
-  // @@protoc_insertion_point(field_mutable:mpr.chubby.RegisterRequest.username)
-  return username_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.end_key_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* RegisterRequest::release_username() {
-  // @@protoc_insertion_point(field_release:mpr.chubby.RegisterRequest.username)
+inline std::string* ShardInfo::_internal_mutable_end_key() {
   
-  return username_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.end_key_.Mutable(GetArenaForAllocation());
 }
-inline void RegisterRequest::set_allocated_username(::std::string* username) {
-  if (username != NULL) {
+inline std::string* ShardInfo::release_end_key() {
+  // @@protoc_insertion_point(field_release:mpr.chubby.ShardInfo.end_key)
+  return _impl_.end_key_.Release();
+}
+inline void ShardInfo::set_allocated_end_key(std::string* end_key) {
+  if (end_key != nullptr) {
     
   } else {
     
   }
-  username_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), username);
-  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.RegisterRequest.username)
+  _impl_.end_key_.SetAllocated(end_key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.end_key_.IsDefault()) {
+    _impl_.end_key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.ShardInfo.end_key)
 }
 
-// optional string passwd = 2;
-inline void RegisterRequest::clear_passwd() {
-  passwd_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// repeated string replicas = 4;
+inline int ShardInfo::_internal_replicas_size() const {
+  return _impl_.replicas_.size();
 }
-inline const ::std::string& RegisterRequest::passwd() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.RegisterRequest.passwd)
-  return passwd_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline int ShardInfo::replicas_size() const {
+  return _internal_replicas_size();
 }
-inline void RegisterRequest::set_passwd(const ::std::string& value) {
-  
-  passwd_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:mpr.chubby.RegisterRequest.passwd)
+inline void ShardInfo::clear_replicas() {
+  _impl_.replicas_.Clear();
 }
-inline void RegisterRequest::set_passwd(const char* value) {
-  
-  passwd_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:mpr.chubby.RegisterRequest.passwd)
+inline std::string* ShardInfo::add_replicas() {
+  std::string* _s = _internal_add_replicas();
+  // @@protoc_insertion_point(field_add_mutable:mpr.chubby.ShardInfo.replicas)
+  return _s;
 }
-inline void RegisterRequest::set_passwd(const char* value, size_t size) {
-  
-  passwd_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:mpr.chubby.RegisterRequest.passwd)
+inline const std::string& ShardInfo::_internal_replicas(int index) const {
+  return _impl_.replicas_.Get(index);
 }
-inline ::std::string* RegisterRequest::mutable_passwd() {
-  
-  // @@protoc_insertion_point(field_mutable:mpr.chubby.RegisterRequest.passwd)
-  return passwd_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline const std::string& ShardInfo::replicas(int index) const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.ShardInfo.replicas)
+  return _internal_replicas(index);
 }
-inline ::std::string* RegisterRequest::release_passwd() {
-  // @@protoc_insertion_point(field_release:mpr.chubby.RegisterRequest.passwd)
-  
-  return passwd_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline std::string* ShardInfo::mutable_replicas(int index) {
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.ShardInfo.replicas)
+  return _impl_.replicas_.Mutable(index);
 }
-inline void RegisterRequest::set_allocated_passwd(::std::string* passwd) {
-  if (passwd != NULL) {
-    
-  } else {
-    
-  }
-  passwd_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), passwd);
-  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.RegisterRequest.passwd)
+inline void ShardInfo::set_replicas(int index, const std::string& value) {
+  _impl_.replicas_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.ShardInfo.replicas)
 }
-
-// -------------------------------------------------------------------
-
-// RegisterResponse
-
-// optional .mpr.chubby.Status status = 1;
-inline bool RegisterResponse::has_status() const {
-  return !_is_default_instance_ && status_ != NULL;
+inline void ShardInfo::set_replicas(int index, std::string&& value) {
+  _impl_.replicas_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:mpr.chubby.ShardInfo.replicas)
 }
-inline void RegisterResponse::clear_status() {
-  if (GetArenaNoVirtual() == NULL && status_ != NULL) delete status_;
-  status_ = NULL;
+inline void ShardInfo::set_replicas(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.replicas_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:mpr.chubby.ShardInfo.replicas)
 }
-inline const ::mpr::chubby::Status& RegisterResponse::status() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.RegisterResponse.status)
-  return status_ != NULL ? *status_ : *default_instance_->status_;
+inline void ShardInfo::set_replicas(int index, const char* value, size_t size) {
+  _impl_.replicas_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:mpr.chubby.ShardInfo.replicas)
 }
-inline ::mpr::chubby::Status* RegisterResponse::mutable_status() {
-  
-  if (status_ == NULL) {
-    status_ = new ::mpr::chubby::Status;
-  }
-  // @@protoc_insertion_point(field_mutable:mpr.chubby.RegisterResponse.status)
-  return status_;
+inline std::string* ShardInfo::_internal_add_replicas() {
+  return _impl_.replicas_.Add();
 }
-inline ::mpr::chubby::Status* RegisterResponse::release_status() {
-  // @@protoc_insertion_point(field_release:mpr.chubby.RegisterResponse.status)
-  
-  ::mpr::chubby::Status* temp = status_;
-  status_ = NULL;
-  return temp;
+inline void ShardInfo::add_replicas(const std::string& value) {
+  _impl_.replicas_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:mpr.chubby.ShardInfo.replicas)
 }
-inline void RegisterResponse::set_allocated_status(::mpr::chubby::Status* status) {
-  delete status_;
-  status_ = status;
-  if (status) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.RegisterResponse.status)
+inline void ShardInfo::add_replicas(std::string&& value) {
+  _impl_.replicas_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:mpr.chubby.ShardInfo.replicas)
+}
+inline void ShardInfo::add_replicas(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.replicas_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:mpr.chubby.ShardInfo.replicas)
+}
+inline void ShardInfo::add_replicas(const char* value, size_t size) {
+  _impl_.replicas_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:mpr.chubby.ShardInfo.replicas)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+ShardInfo::replicas() const {
+  // @@protoc_insertion_point(field_list:mpr.chubby.ShardInfo.replicas)
+  return _impl_.replicas_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+ShardInfo::mutable_replicas() {
+  // @@protoc_insertion_point(field_mutable_list:mpr.chubby.ShardInfo.replicas)
+  return &_impl_.replicas_;
 }
 
-// optional string leader_id = 2;
-inline void RegisterResponse::clear_leader_id() {
-  leader_id_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// string leader_id = 5;
+inline void ShardInfo::clear_leader_id() {
+  _impl_.leader_id_.ClearToEmpty();
 }
-inline const ::std::string& RegisterResponse::leader_id() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.RegisterResponse.leader_id)
-  return leader_id_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline const std::string& ShardInfo::leader_id() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.ShardInfo.leader_id)
+  return _internal_leader_id();
 }
-inline void RegisterResponse::set_leader_id(const ::std::string& value) {
-  
-  leader_id_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:mpr.chubby.RegisterResponse.leader_id)
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ShardInfo::set_leader_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.leader_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpr.chubby.ShardInfo.leader_id)
 }
-inline void RegisterResponse::set_leader_id(const char* value) {
-  
-  leader_id_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:mpr.chubby.RegisterResponse.leader_id)
+inline std::string* ShardInfo::mutable_leader_id() {
+  std::string* _s = _internal_mutable_leader_id();
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.ShardInfo.leader_id)
+  return _s;
 }
-inline void RegisterResponse::set_leader_id(const char* value, size_t size) {
-  
-  leader_id_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:mpr.chubby.RegisterResponse.leader_id)
+inline const std::string& ShardInfo::_internal_leader_id() const {
+  return _impl_.leader_id_.Get();
 }
-inline ::std::string* RegisterResponse::mutable_leader_id() {
+inline void ShardInfo::_internal_set_leader_id(const std::string& value) {
   
-  // @@protoc_insertion_point(field_mutable:mpr.chubby.RegisterResponse.leader_id)
-  return leader_id_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.leader_id_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* RegisterResponse::release_leader_id() {
-  // @@protoc_insertion_point(field_release:mpr.chubby.RegisterResponse.leader_id)
+inline std::string* ShardInfo::_internal_mutable_leader_id() {
   
-  return leader_id_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.leader_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ShardInfo::release_leader_id() {
+  // @@protoc_insertion_point(field_release:mpr.chubby.ShardInfo.leader_id)
+  return _impl_.leader_id_.Release();
 }
-inline void RegisterResponse::set_allocated_leader_id(::std::string* leader_id) {
-  if (leader_id != NULL) {
+inline void ShardInfo::set_allocated_leader_id(std::string* leader_id) {
+  if (leader_id != nullptr) {
     
   } else {
     
   }
-  leader_id_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), leader_id);
-  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.RegisterResponse.leader_id)
+  _impl_.leader_id_.SetAllocated(leader_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.leader_id_.IsDefault()) {
+    _impl_.leader_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpr.chubby.ShardInfo.leader_id)
 }
 
-// -------------------------------------------------------------------
-
-// CleanBinlogRequest
-
-// optional int64 end_index = 1;
-inline void CleanBinlogRequest::clear_end_index() {
-  end_index_ = GOOGLE_LONGLONG(0);
+// repeated string learners = 6;
+inline int ShardInfo::_internal_learners_size() const {
+  return _impl_.learners_.size();
 }
-inline ::google::protobuf::int64 CleanBinlogRequest::end_index() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.CleanBinlogRequest.end_index)
-  return end_index_;
+inline int ShardInfo::learners_size() const {
+  return _internal_learners_size();
 }
-inline void CleanBinlogRequest::set_end_index(::google::protobuf::int64 value) {
-  
-  end_index_ = value;
-  // @@protoc_insertion_point(field_set:mpr.chubby.CleanBinlogRequest.end_index)
+inline void ShardInfo::clear_learners() {
+  _impl_.learners_.Clear();
 }
-
-// -------------------------------------------------------------------
-
-// CleanBinlogResponse
-
-// optional bool success = 1;
-inline void CleanBinlogResponse::clear_success() {
-  success_ = false;
+inline std::string* ShardInfo::add_learners() {
+  std::string* _s = _internal_add_learners();
+  // @@protoc_insertion_point(field_add_mutable:mpr.chubby.ShardInfo.learners)
+  return _s;
 }
-inline bool CleanBinlogResponse::success() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.CleanBinlogResponse.success)
-  return success_;
+inline const std::string& ShardInfo::_internal_learners(int index) const {
+  return _impl_.learners_.Get(index);
 }
-inline void CleanBinlogResponse::set_success(bool value) {
-  
-  success_ = value;
-  // @@protoc_insertion_point(field_set:mpr.chubby.CleanBinlogResponse.success)
+inline const std::string& ShardInfo::learners(int index) const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.ShardInfo.learners)
+  return _internal_learners(index);
 }
-
-// -------------------------------------------------------------------
-
-// RpcStatRequest
-
-// repeated .mpr.chubby.StatOperation op = 1;
-inline int RpcStatRequest::op_size() const {
-  return op_.size();
+inline std::string* ShardInfo::mutable_learners(int index) {
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.ShardInfo.learners)
+  return _impl_.learners_.Mutable(index);
 }
-inline void RpcStatRequest::clear_op() {
-  op_.Clear();
+inline void ShardInfo::set_learners(int index, const std::string& value) {
+  _impl_.learners_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.ShardInfo.learners)
 }
-inline ::mpr::chubby::StatOperation RpcStatRequest::op(int index) const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.RpcStatRequest.op)
-  return static_cast< ::mpr::chubby::StatOperation >(op_.Get(index));
+inline void ShardInfo::set_learners(int index, std::string&& value) {
+  _impl_.learners_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:mpr.chubby.ShardInfo.learners)
 }
-inline void RpcStatRequest::set_op(int index, ::mpr::chubby::StatOperation value) {
-  op_.Set(index, value);
-  // @@protoc_insertion_point(field_set:mpr.chubby.RpcStatRequest.op)
+inline void ShardInfo::set_learners(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.learners_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:mpr.chubby.ShardInfo.learners)
 }
-inline void RpcStatRequest::add_op(::mpr::chubby::StatOperation value) {
-  op_.Add(value);
-  // @@protoc_insertion_point(field_add:mpr.chubby.RpcStatRequest.op)
+inline void ShardInfo::set_learners(int index, const char* value, size_t size) {
+  _impl_.learners_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:mpr.chubby.ShardInfo.learners)
 }
-inline const ::google::protobuf::RepeatedField<int>&
-RpcStatRequest::op() const {
-  // @@protoc_insertion_point(field_list:mpr.chubby.RpcStatRequest.op)
-  return op_;
+inline std::string* ShardInfo::_internal_add_learners() {
+  return _impl_.learners_.Add();
 }
-inline ::google::protobuf::RepeatedField<int>*
-RpcStatRequest::mutable_op() {
-  // @@protoc_insertion_point(field_mutable_list:mpr.chubby.RpcStatRequest.op)
-  return &op_;
+inline void ShardInfo::add_learners(const std::string& value) {
+  _impl_.learners_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:mpr.chubby.ShardInfo.learners)
+}
+inline void ShardInfo::add_learners(std::string&& value) {
+  _impl_.learners_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:mpr.chubby.ShardInfo.learners)
+}
+inline void ShardInfo::add_learners(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.learners_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:mpr.chubby.ShardInfo.learners)
+}
+inline void ShardInfo::add_learners(const char* value, size_t size) {
+  _impl_.learners_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:mpr.chubby.ShardInfo.learners)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+ShardInfo::learners() const {
+  // @@protoc_insertion_point(field_list:mpr.chubby.ShardInfo.learners)
+  return _impl_.learners_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+ShardInfo::mutable_learners() {
+  // @@protoc_insertion_point(field_mutable_list:mpr.chubby.ShardInfo.learners)
+  return &_impl_.learners_;
 }
 
 // -------------------------------------------------------------------
 
-// RpcStatResponse
+// ShardMapInfo
 
-// optional .mpr.chubby.NodeStatus status = 1;
-inline void RpcStatResponse::clear_status() {
-  status_ = 0;
+// int64 version = 1;
+inline void ShardMapInfo::clear_version() {
+  _impl_.version_ = int64_t{0};
 }
-inline ::mpr::chubby::NodeStatus RpcStatResponse::status() const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.RpcStatResponse.status)
-  return static_cast< ::mpr::chubby::NodeStatus >(status_);
+inline int64_t ShardMapInfo::_internal_version() const {
+  return _impl_.version_;
 }
-inline void RpcStatResponse::set_status(::mpr::chubby::NodeStatus value) {
+inline int64_t ShardMapInfo::version() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.ShardMapInfo.version)
+  return _internal_version();
+}
+inline void ShardMapInfo::_internal_set_version(int64_t value) {
   
-  status_ = value;
-  // @@protoc_insertion_point(field_set:mpr.chubby.RpcStatResponse.status)
+  _impl_.version_ = value;
+}
+inline void ShardMapInfo::set_version(int64_t value) {
+  _internal_set_version(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.ShardMapInfo.version)
 }
 
-// repeated .mpr.chubby.StatInfo stats = 2;
-inline int RpcStatResponse::stats_size() const {
-  return stats_.size();
+// bool hash_partition = 2;
+inline void ShardMapInfo::clear_hash_partition() {
+  _impl_.hash_partition_ = false;
 }
-inline void RpcStatResponse::clear_stats() {
-  stats_.Clear();
+inline bool ShardMapInfo::_internal_hash_partition() const {
+  return _impl_.hash_partition_;
 }
-inline const ::mpr::chubby::StatInfo& RpcStatResponse::stats(int index) const {
-  // @@protoc_insertion_point(field_get:mpr.chubby.RpcStatResponse.stats)
-  return stats_.Get(index);
+inline bool ShardMapInfo::hash_partition() const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.ShardMapInfo.hash_partition)
+  return _internal_hash_partition();
 }
-inline ::mpr::chubby::StatInfo* RpcStatResponse::mutable_stats(int index) {
-  // @@protoc_insertion_point(field_mutable:mpr.chubby.RpcStatResponse.stats)
-  return stats_.Mutable(index);
+inline void ShardMapInfo::_internal_set_hash_partition(bool value) {
+  
+  _impl_.hash_partition_ = value;
 }
-inline ::mpr::chubby::StatInfo* RpcStatResponse::add_stats() {
-  // @@protoc_insertion_point(field_add:mpr.chubby.RpcStatResponse.stats)
-  return stats_.Add();
+inline void ShardMapInfo::set_hash_partition(bool value) {
+  _internal_set_hash_partition(value);
+  // @@protoc_insertion_point(field_set:mpr.chubby.ShardMapInfo.hash_partition)
 }
-inline ::google::protobuf::RepeatedPtrField< ::mpr::chubby::StatInfo >*
-RpcStatResponse::mutable_stats() {
-  // @@protoc_insertion_point(field_mutable_list:mpr.chubby.RpcStatResponse.stats)
-  return &stats_;
+
+// repeated .mpr.chubby.ShardInfo shards = 3;
+inline int ShardMapInfo::_internal_shards_size() const {
+  return _impl_.shards_.size();
 }
-inline const ::google::protobuf::RepeatedPtrField< ::mpr::chubby::StatInfo >&
-RpcStatResponse::stats() const {
-  // @@protoc_insertion_point(field_list:mpr.chubby.RpcStatResponse.stats)
-  return stats_;
+inline int ShardMapInfo::shards_size() const {
+  return _internal_shards_size();
+}
+inline void ShardMapInfo::clear_shards() {
+  _impl_.shards_.Clear();
+}
+inline ::mpr::chubby::ShardInfo* ShardMapInfo::mutable_shards(int index) {
+  // @@protoc_insertion_point(field_mutable:mpr.chubby.ShardMapInfo.shards)
+  return _impl_.shards_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::mpr::chubby::ShardInfo >*
+ShardMapInfo::mutable_shards() {
+  // @@protoc_insertion_point(field_mutable_list:mpr.chubby.ShardMapInfo.shards)
+  return &_impl_.shards_;
+}
+inline const ::mpr::chubby::ShardInfo& ShardMapInfo::_internal_shards(int index) const {
+  return _impl_.shards_.Get(index);
+}
+inline const ::mpr::chubby::ShardInfo& ShardMapInfo::shards(int index) const {
+  // @@protoc_insertion_point(field_get:mpr.chubby.ShardMapInfo.shards)
+  return _internal_shards(index);
+}
+inline ::mpr::chubby::ShardInfo* ShardMapInfo::_internal_add_shards() {
+  return _impl_.shards_.Add();
+}
+inline ::mpr::chubby::ShardInfo* ShardMapInfo::add_shards() {
+  ::mpr::chubby::ShardInfo* _add = _internal_add_shards();
+  // @@protoc_insertion_point(field_add:mpr.chubby.ShardMapInfo.shards)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::mpr::chubby::ShardInfo >&
+ShardMapInfo::shards() const {
+  // @@protoc_insertion_point(field_list:mpr.chubby.ShardMapInfo.shards)
+  return _impl_.shards_;
 }
 
-#endif  // !PROTOBUF_INLINE_NOT_IN_HEADERS
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 // -------------------------------------------------------------------
 
 // -------------------------------------------------------------------
@@ -6883,30 +16701,27 @@ RpcStatResponse::stats() const {
 }  // namespace chubby
 }  // namespace mpr
 
-#ifndef SWIG
-namespace google {
-namespace protobuf {
+PROTOBUF_NAMESPACE_OPEN
 
-template <> struct is_proto_enum< ::mpr::chubby::NodeStatus> : ::google::protobuf::internal::true_type {};
+template <> struct is_proto_enum< ::mpr::chubby::NodeStatus> : ::std::true_type {};
 template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::mpr::chubby::NodeStatus>() {
   return ::mpr::chubby::NodeStatus_descriptor();
 }
-template <> struct is_proto_enum< ::mpr::chubby::LogOperation> : ::google::protobuf::internal::true_type {};
+template <> struct is_proto_enum< ::mpr::chubby::LogOperation> : ::std::true_type {};
 template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::mpr::chubby::LogOperation>() {
   return ::mpr::chubby::LogOperation_descriptor();
 }
-template <> struct is_proto_enum< ::mpr::chubby::StatOperation> : ::google::protobuf::internal::true_type {};
+template <> struct is_proto_enum< ::mpr::chubby::StatOperation> : ::std::true_type {};
 template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::mpr::chubby::StatOperation>() {
   return ::mpr::chubby::StatOperation_descriptor();
 }
 
-}  // namespace protobuf
-}  // namespace google
-#endif  // SWIG
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
 
-#endif  // PROTOBUF_service_2eproto__INCLUDED
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_service_2eproto
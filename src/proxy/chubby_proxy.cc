@@ -0,0 +1,373 @@
+#include "proxy/chubby_proxy.h"
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+
+#include "base/errors.h"
+#include "base/logging.h"
+
+#include <gflags/gflags.h>
+
+DECLARE_int32(chubby_session_lease);
+DECLARE_int32(chubby_session_tick);
+DECLARE_int32(chubby_proxy_upstream_sessions);
+DECLARE_int32(chubby_proxy_keepalive_interval);
+DECLARE_int32(chubby_proxy_cache_entries);
+
+namespace mpr {
+namespace chubby {
+
+ChubbyProxy::Options::Options()
+  : tokens(nullptr),
+    upstream_sessions(FLAGS_chubby_proxy_upstream_sessions),
+    keepalive_interval_micros(FLAGS_chubby_proxy_keepalive_interval * 1000LL),
+    max_cache_entries(FLAGS_chubby_proxy_cache_entries),
+    lease_micros(FLAGS_chubby_session_lease * 1000LL),
+    tick_micros(FLAGS_chubby_session_tick * 1000LL),
+    env(base::Env::Default()),
+    start_thread(true) {}
+
+ChubbyProxy::ChubbyProxy(const Options& options, ClientChannel* upstream)
+  : options_(options),
+    upstream_(upstream),
+    stopping_(false),
+    next_upstream_(0) {
+  DCHECK(upstream_ != nullptr);
+  DCHECK(options_.tokens != nullptr);
+  DCHECK_GT(options_.upstream_sessions, 0);
+  SessionManager::Options session_options;
+  session_options.lease_micros = options_.lease_micros;
+  session_options.tick_micros = options_.tick_micros;
+  session_options.env = options_.env;
+  session_options.start_thread = options_.start_thread;
+  sessions_.reset(new SessionManager(session_options,
+      [this](std::vector<SessionManager::Expired>* expired) {
+        HandleExpired(expired);
+      }));
+  if (options_.start_thread) {
+    thread_.reset(options_.env->StartThread(base::ThreadOptions(),
+                                            "chubby_proxy_keepalive",
+                                            [this]() { KeepAliveLoop(); }));
+  }
+}
+
+ChubbyProxy::~ChubbyProxy() {
+  {
+    base::mutex_lock l(mu_);
+    stopping_ = true;
+    stop_cv_.notify_all();
+  }
+  thread_.reset(nullptr);
+  // 再停止会话过期, 它会使用上游会话
+  sessions_.reset();
+}
+
+void ChubbyProxy::Get(const GetRequest& request, GetResponse* response) {
+  base::Status status = Authenticate(request.uuid(), "");
+  if (!status.ok()) {
+    Reply(status, response);
+    return;
+  }
+  std::string value;
+  status = Upstream(request.key())->Get(request.key(), &value);
+  // 客户端收不到失效通知, 不能缓存
+  response->set_cacheable(false);
+  if (base::errors::IsNotFound(status)) {
+    response->set_hit(false);
+    status = base::Status::OK();
+  } else if (status.ok()) {
+    response->set_hit(true);
+    response->set_value(value);
+  }
+  Reply(status, response);
+}
+
+void ChubbyProxy::Put(const PutRequest& request, PutResponse* response) {
+  base::Status status = Authenticate(request.uuid(), "");
+  if (!status.ok()) {
+    Reply(status, response);
+    return;
+  }
+  Reply(Upstream(request.key())->Put(request.key(), request.value()), response);
+}
+
+void ChubbyProxy::Delete(const DelRequest& request, DelResponse* response) {
+  base::Status status = Authenticate(request.uuid(), "");
+  if (!status.ok()) {
+    Reply(status, response);
+    return;
+  }
+  Reply(Upstream(request.key())->Delete(request.key()), response);
+}
+
+void ChubbyProxy::Lock(const LockRequest& request, LockResponse* response) {
+  base::Status status = Authenticate(request.uuid(), request.session_id());
+  if (!status.ok()) {
+    Reply(status, response);
+    return;
+  }
+  const std::string& key = request.key();
+  const auto deadline = std::chrono::steady_clock::now() +
+                        std::chrono::milliseconds(request.wait_timeout_ms());
+  std::shared_ptr<ChubbyClient> upstream;
+  {
+    base::mutex_lock l(mu_);
+    while (true) {
+      upstream = DoUpstream(key);
+      auto it = locks_.find(key);
+      if (it == locks_.end()) {
+        break;
+      }
+      if (!it->second.pending && !upstream->HoldsLock(key)) {
+        // 上游会话已经丢失了这把锁
+        DoEraseLock(it);
+        break;
+      }
+      if (!it->second.pending && it->second.session_id == request.session_id()) {
+        response->set_success(true);
+        response->set_leader_id(options_.proxy_id);
+        return;
+      }
+      // 被 proxy 的其他客户端持有或者正在获取, 在本地排队, 同一把锁只有一个
+      // 请求在 leader 上排队
+      if (request.wait_timeout_ms() <= 0 ||
+          lock_cv_.wait_until(l, deadline) == std::cv_status::timeout) {
+        response->set_leader_id(options_.proxy_id);
+        return;
+      }
+    }
+    LockOwner& owner = locks_[key];
+    owner.session_id = request.session_id();
+    owner.pending = true;
+  }
+
+  int64_t wait_timeout_ms = 0;
+  if (request.wait_timeout_ms() > 0) {
+    wait_timeout_ms = std::max<int64_t>(1,
+        std::chrono::duration_cast<std::chrono::milliseconds>(
+            deadline - std::chrono::steady_clock::now()).count());
+  }
+  status = upstream->Lock(key, wait_timeout_ms);
+  {
+    base::mutex_lock l(mu_);
+    auto it = locks_.find(key);
+    DCHECK(it != locks_.end());
+    if (status.ok()) {
+      it->second.pending = false;
+    } else {
+      DoEraseLock(it);
+    }
+  }
+  if (status.ok()) {
+    sessions_->AddLock(request.session_id(), key);
+  }
+  Reply(status, response);
+}
+
+void ChubbyProxy::UnLock(const UnLockRequest& request, UnLockResponse* response) {
+  base::Status status = Authenticate(request.uuid(), request.session_id());
+  if (!status.ok()) {
+    Reply(status, response);
+    return;
+  }
+  {
+    base::mutex_lock l(mu_);
+    auto it = locks_.find(request.key());
+    if (it == locks_.end() || it->second.pending ||
+        it->second.session_id != request.session_id()) {
+      response->set_leader_id(options_.proxy_id);
+      return;
+    }
+  }
+  Reply(ReleaseLock(request.key(), request.session_id()), response);
+}
+
+void ChubbyProxy::KeepAlive(const KeepAliveRequest& request,
+                            KeepAliveResponse* response) {
+  response->set_leader_id(options_.proxy_id);
+  base::Status status = Authenticate(request.uuid(), request.session_id());
+  if (!status.ok()) {
+    VLOG(1) << "[ChubbyProxy] keepalive of " << request.session_id() << ": "
+            << status.ToString();
+    return;
+  }
+  sessions_->KeepAlive(request);
+  response->set_success(true);
+  response->set_leader_id(options_.proxy_id);
+}
+
+size_t ChubbyProxy::sessions() const {
+  return sessions_->size();
+}
+
+size_t ChubbyProxy::upstreams() const {
+  base::mutex_lock l(mu_);
+  return upstreams_.size();
+}
+
+int64_t ChubbyProxy::cache_hits() const {
+  base::mutex_lock l(mu_);
+  int64_t hits = 0;
+  for (const auto& client : upstreams_) {
+    hits += client->cache_hits();
+  }
+  return hits;
+}
+
+base::Status ChubbyProxy::KeepAliveUpstreams(int64_t hold_micros) {
+  std::vector<std::shared_ptr<ChubbyClient>> clients;
+  {
+    base::mutex_lock l(mu_);
+    clients = upstreams_;
+  }
+  base::Status result;
+  for (const auto& client : clients) {
+    base::Status status = client->KeepAliveOnce(hold_micros);
+    if (result.ok()) {
+      result = status;
+    }
+  }
+  return result;
+}
+
+void ChubbyProxy::KeepAliveLoop() {
+  base::mutex_lock l(mu_);
+  while (!stopping_) {
+    l.unlock();
+    // 不挂起, 一轮之内依次处理所有上游会话的失效
+    base::Status status = KeepAliveUpstreams(0);
+    if (!status.ok()) {
+      VLOG(1) << "[ChubbyProxy] keepalive: " << status.ToString();
+    }
+    l.lock();
+    if (!stopping_) {
+      stop_cv_.wait_for(l, std::chrono::microseconds(
+          options_.keepalive_interval_micros));
+    }
+  }
+}
+
+base::Status ChubbyProxy::Authenticate(const std::string& uuid,
+                                       const std::string& session_id) {
+  std::string username;
+  RETURN_IF_ERROR(options_.tokens->Verify(uuid, nullptr, &username));
+  if (username != options_.username) {
+    return base::errors::PermissionDenied("proxy serves user ", options_.username,
+                                          ", not ", username);
+  }
+  if (session_id.empty()) {
+    return base::Status::OK();
+  }
+  base::mutex_lock l(mu_);
+  auto result = session_tokens_.emplace(session_id, uuid);
+  if (!result.second && result.first->second != uuid) {
+    return base::errors::PermissionDenied("session ", session_id,
+                                          " belongs to another client");
+  }
+  return base::Status::OK();
+}
+
+std::shared_ptr<ChubbyClient> ChubbyProxy::DoUpstream(const std::string& key) {
+  if (upstreams_.empty()) {
+    for (int i = 0; i < options_.upstream_sessions; ++i) {
+      ChubbyClient::Options client_options;
+      client_options.nodes = options_.nodes;
+      client_options.uuid = options_.uuid;
+      client_options.session_id =
+          options_.proxy_id + "/" + std::to_string(next_upstream_++);
+      client_options.hostname = options_.hostname;
+      client_options.max_cache_entries = options_.max_cache_entries;
+      client_options.env = options_.env;
+      // KeepAlive 由 proxy 的线程统一发送
+      client_options.start_thread = false;
+      upstreams_.emplace_back(new ChubbyClient(client_options, upstream_));
+    }
+  }
+  return upstreams_[std::hash<std::string>()(key) % upstreams_.size()];
+}
+
+std::shared_ptr<ChubbyClient> ChubbyProxy::Upstream(const std::string& key) {
+  base::mutex_lock l(mu_);
+  return DoUpstream(key);
+}
+
+void ChubbyProxy::HandleExpired(std::vector<SessionManager::Expired>* expired) {
+  for (const SessionManager::Expired& session : *expired) {
+    for (const std::string& key : session.locks) {
+      std::shared_ptr<ChubbyClient> upstream;
+      {
+        base::mutex_lock l(mu_);
+        auto it = locks_.find(key);
+        if (it == locks_.end() || it->second.pending ||
+            it->second.session_id != session.session_id) {
+          continue;
+        }
+        // 上游解锁失败时, 锁仍属于上游会话, 之后的 Lock 可以直接拿到
+        DoEraseLock(it);
+        upstream = DoUpstream(key);
+      }
+      base::Status status = upstream->UnLock(key);
+      if (!status.ok()) {
+        LOG(WARNING) << "[ChubbyProxy] release " << key << " of expired session "
+                     << session.session_id << ": " << status.ToString();
+      }
+    }
+  }
+
+  // 没有客户端之后不再占用 leader 上的会话, leader 上的会话随 lease 过期
+  std::vector<std::shared_ptr<ChubbyClient>> released;
+  {
+    base::mutex_lock l(mu_);
+    for (const SessionManager::Expired& session : *expired) {
+      session_tokens_.erase(session.session_id);
+    }
+    if (locks_.empty() && sessions_->size() == 0) {
+      released.swap(upstreams_);
+    }
+  }
+  if (!released.empty()) {
+    LOG(INFO) << "[ChubbyProxy] no client sessions, released "
+              << released.size() << " upstream sessions";
+  }
+}
+
+base::Status ChubbyProxy::ReleaseLock(const std::string& key,
+                                      const std::string& session_id) {
+  RETURN_IF_ERROR(Upstream(key)->UnLock(key));
+  {
+    base::mutex_lock l(mu_);
+    auto it = locks_.find(key);
+    if (it != locks_.end() && it->second.session_id == session_id) {
+      DoEraseLock(it);
+    }
+  }
+  sessions_->RemoveLock(session_id, key);
+  return base::Status::OK();
+}
+
+void ChubbyProxy::DoEraseLock(
+    std::unordered_map<std::string, LockOwner>::iterator it) {
+  locks_.erase(it);
+  lock_cv_.notify_all();
+}
+
+template <typename Response>
+void ChubbyProxy::Reply(const base::Status& status, Response* response) {
+  if (status.ok()) {
+    response->set_success(true);
+    response->set_leader_id(options_.proxy_id);
+  } else if (base::errors::IsFailedPrecondition(status) ||
+             base::errors::IsPermissionDenied(status)) {
+    // leader 或 proxy 拒绝了请求
+    response->set_leader_id(options_.proxy_id);
+  } else if (base::errors::IsUnauthenticated(status)) {
+    // 客户端需要重新登录, 换一个 proxy 也没有用
+    response->set_uuid_expired(true);
+    response->set_leader_id(options_.proxy_id);
+  }
+  // 上游不可用时 leader_id 留空
+}
+
+} // namespace chubby
+} // namespace mpr
@@ -0,0 +1,147 @@
+#ifndef MPR_CHUBBY_PROXY_CHUBBY_PROXY_H_
+#define MPR_CHUBBY_PROXY_CHUBBY_PROXY_H_
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "base/macros.h"
+#include "base/status.h"
+#include "base/platform/env.h"
+#include "base/platform/mutex.h"
+#include "client/chubby_client.h"
+#include "proto/service.pb.h"
+#include "server/session_manager.h"
+#include "server/session_token.h"
+
+namespace mpr {
+namespace chubby {
+
+// 聚合客户端会话的 proxy.
+//
+// 客户端的会话终止在 proxy 上: KeepAlive 由本地的 SessionManager 续约, 不发给
+// leader. 整个 proxy 在 leader 上只有 upstream_sessions 个会话 (ChubbyClient),
+// 以 Options.uuid 登录, 按 key 的 hash 选择, 同一个 key 的读写和锁总是走同一个
+// 上游会话. 客户端的 uuid 每次登录都不同, 不用来区分上游会话, 也不发给 leader.
+//
+// 上游会话以 proxy 的用户身份读写, 所以 proxy 只服务这一个用户: 每个请求的
+// uuid 必须是 SessionTokens 签发给 Options.username 的 token, proxy 只用密钥
+// 验证, 不问 leader. token 无效时响应设置 uuid_expired. 客户端会话绑定到第一次
+// 使用它的 token, 其他客户端即使知道 session_id 也不能续约, 加锁或解锁; 会话
+// 过期后绑定解除. 需要按用户区分权限时每个用户使用单独的 proxy.
+//
+// 读经过上游会话的缓存, 由 leader 的失效通知保证一致; 写和锁转发给 leader.
+// leader 上的会话数由客户端数降为 proxy 数 * upstream_sessions. 上游会话的
+// KeepAlive 都由同一个线程每隔 keepalive_interval_micros 发送, 它也是 proxy
+// 上的缓存确认失效的最大延迟. 最后一个客户端会话过期后上游会话被释放, 之后的
+// 请求重新建立.
+//
+// 客户端在 proxy 上不缓存 (GetResponse.cacheable 总是 false), proxy 本身就是
+// 缓存. 锁在 leader 上属于上游会话, proxy 记录实际持有它的客户端会话, 客户端
+// 会话过期时由 proxy 释放. 锁被 proxy 的其他客户端持有时, 带 wait_timeout_ms
+// 的请求在 proxy 上排队, 锁释放后再发给 leader, leader 上同一把锁最多只有一个
+// 来自这个 proxy 的请求.
+//
+// 方法都是同步的, 可以在多个线程上并发调用. 响应的 leader_id 是 proxy_id, 上游
+// 不可用时留空, 客户端会尝试下一个 proxy.
+class ChubbyProxy {
+ public:
+  struct Options {
+    // 响应中的 leader_id, 也是上游会话 id 的前缀
+    std::string proxy_id;
+    // 集群中的节点
+    std::vector<std::string> nodes;
+    // proxy 登录集群得到的 uuid, 所有上游会话使用
+    std::string uuid;
+    // uuid 所属的用户, 只接受这个用户的客户端
+    std::string username;
+    // 验证客户端的 token, 必须设置, 由调用者持有
+    const SessionTokens* tokens;
+    std::string hostname;
+    // 上游会话数
+    int upstream_sessions;
+    // 两轮上游 KeepAlive 之间的间隔
+    int64_t keepalive_interval_micros;
+    // 每个上游会话的缓存大小
+    size_t max_cache_entries;
+    // 客户端会话的 lease
+    int64_t lease_micros;
+    int64_t tick_micros;
+    base::Env* env;
+    // 为 false 时由调用者调用 AdvanceTo 和 KeepAliveUpstreams
+    bool start_thread;
+
+    Options();
+  };
+
+  // upstream 必须比 proxy 活得长
+  ChubbyProxy(const Options& options, ClientChannel* upstream);
+  ~ChubbyProxy();
+
+  void Get(const GetRequest& request, GetResponse* response);
+  void Put(const PutRequest& request, PutResponse* response);
+  void Delete(const DelRequest& request, DelResponse* response);
+  void Lock(const LockRequest& request, LockResponse* response);
+  void UnLock(const UnLockRequest& request, UnLockResponse* response);
+  // 只在本地续约, 立即返回
+  void KeepAlive(const KeepAliveRequest& request, KeepAliveResponse* response);
+
+  // 客户端会话数
+  size_t sessions() const;
+  // 上游会话数
+  size_t upstreams() const;
+  // 所有上游会话的缓存命中数
+  int64_t cache_hits() const;
+
+  void AdvanceTo(uint64_t now_micros) { sessions_->AdvanceTo(now_micros); }
+  // 给每个上游会话依次发送一次 KeepAlive
+  base::Status KeepAliveUpstreams(int64_t hold_micros);
+
+ private:
+  struct LockOwner {
+    std::string session_id;
+    // 请求还在上游排队
+    bool pending;
+  };
+
+  // 验证客户端的 token 属于 options_.username. session_id 不为空时检查会话
+  // 绑定的 token, 会话第一次出现时绑定. 调用时不持有 mu_
+  base::Status Authenticate(const std::string& uuid, const std::string& session_id);
+  std::shared_ptr<ChubbyClient> DoUpstream(const std::string& key);
+  std::shared_ptr<ChubbyClient> Upstream(const std::string& key);
+  // 释放过期会话持有的锁, 没有客户端会话时释放上游会话. 调用时不持有 mu_
+  void HandleExpired(std::vector<SessionManager::Expired>* expired);
+  base::Status ReleaseLock(const std::string& key, const std::string& session_id);
+  // 删除 locks_ 中的记录并唤醒排队的 Lock
+  void DoEraseLock(std::unordered_map<std::string, LockOwner>::iterator it);
+  void KeepAliveLoop();
+  // 上游的结果转为响应
+  template <typename Response>
+  void Reply(const base::Status& status, Response* response);
+
+  const Options options_;
+  ClientChannel* upstream_;
+
+  mutable base::mutex mu_;
+  // 锁被释放时通知在 proxy 上排队的 Lock
+  base::condition_variable lock_cv_;
+  // 通知 KeepAlive 线程退出
+  base::condition_variable stop_cv_;
+  bool stopping_;
+  int next_upstream_;
+  // 正在进行的请求持有引用, 释放上游会话时不必等待它们
+  std::vector<std::shared_ptr<ChubbyClient>> upstreams_;
+  // key -> 持有锁的客户端会话
+  std::unordered_map<std::string, LockOwner> locks_;
+  // 客户端会话 -> 打开它的 token
+  std::unordered_map<std::string, std::string> session_tokens_;
+  std::unique_ptr<SessionManager> sessions_;
+  std::unique_ptr<base::Thread> thread_;
+
+  DISALLOW_COPY_AND_ASSIGN(ChubbyProxy);
+};
+
+} // namespace chubby
+} // namespace mpr
+#endif // MPR_CHUBBY_PROXY_CHUBBY_PROXY_H_
@@ -0,0 +1,283 @@
+#include <gtest/gtest.h>
+#include <map>
+#include <thread>
+
+#include "proxy/chubby_proxy.h"
+#include "base/errors.h"
+#include "base/platform/env_test_util.h"
+#include "client/client_test_util.h"
+
+namespace mpr {
+namespace chubby {
+
+namespace {
+
+class ChubbyProxyTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    SessionTokens::Options token_options;
+    token_options.key = SessionTokens::GenerateKey();
+    token_options.epoch = 1;
+    token_options.env = &env_;
+    tokens_.reset(new SessionTokens(token_options));
+
+    ChubbyProxy::Options options;
+    options.proxy_id = "p1";
+    options.nodes = {"n1"};
+    options.uuid = "proxy";
+    options.username = "alice";
+    options.tokens = tokens_.get();
+    options.upstream_sessions = 2;
+    options.lease_micros = 1000 * 1000;
+    options.tick_micros = 10 * 1000;
+    options.env = &env_;
+    options.start_thread = false;
+    proxy_.reset(new ChubbyProxy(options, &cluster_));
+  }
+
+  // 每个客户端登录得到自己的 token
+  const std::string& Token(const std::string& client) {
+    std::string& token = client_tokens_[client];
+    if (token.empty()) {
+      // 签发时间不同, token 也不同
+      env_.AdvanceMillis(1);
+      token = tokens_->Issue("alice");
+    }
+    return token;
+  }
+
+  void KeepAlive(const std::string& session_id) {
+    KeepAliveRequest request;
+    request.set_session_id(session_id);
+    request.set_uuid(Token(session_id));
+    KeepAliveResponse response;
+    proxy_->KeepAlive(request, &response);
+    EXPECT_TRUE(response.success());
+    EXPECT_EQ("p1", response.leader_id());
+  }
+
+  GetResponse Get(const std::string& key, const std::string& client = "reader") {
+    GetRequest request;
+    request.set_key(key);
+    request.set_uuid(Token(client));
+    GetResponse response;
+    proxy_->Get(request, &response);
+    return response;
+  }
+
+  LockResponse Lock(const std::string& session_id, const std::string& key,
+                    int64_t wait_timeout_ms = 0) {
+    LockRequest request;
+    request.set_key(key);
+    request.set_session_id(session_id);
+    request.set_uuid(Token(session_id));
+    request.set_wait_timeout_ms(wait_timeout_ms);
+    LockResponse response;
+    proxy_->Lock(request, &response);
+    return response;
+  }
+
+  base::FakeClockEnv env_;
+  FakeCluster cluster_;
+  std::unique_ptr<SessionTokens> tokens_;
+  std::map<std::string, std::string> client_tokens_;
+  std::unique_ptr<ChubbyProxy> proxy_;
+};
+
+} // namespace
+
+TEST_F(ChubbyProxyTest, AggregatesSessionsAndReads) {
+  for (int i = 0; i < 100; ++i) {
+    KeepAlive("c" + std::to_string(i));
+  }
+  EXPECT_EQ(100u, proxy_->sessions());
+  EXPECT_EQ(0, cluster_.keepalives());
+
+  PutRequest put;
+  put.set_key("/a");
+  put.set_value("1");
+  put.set_uuid(Token("writer"));
+  PutResponse put_response;
+  proxy_->Put(put, &put_response);
+  ASSERT_TRUE(put_response.success());
+  EXPECT_EQ("p1", put_response.leader_id());
+
+  for (int i = 0; i < 100; ++i) {
+    // 每个客户端登录得到不同的 uuid, 共用上游会话
+    GetResponse response = Get("/a", "c" + std::to_string(i));
+    ASSERT_TRUE(response.success());
+    EXPECT_TRUE(response.hit());
+    EXPECT_EQ("1", response.value());
+    // proxy 是缓存, 客户端不缓存
+    EXPECT_FALSE(response.cacheable());
+    EXPECT_FALSE(Get("/missing").hit());
+  }
+  EXPECT_EQ(2, cluster_.gets());
+  EXPECT_EQ(198, proxy_->cache_hits());
+
+  // leader 上只有上游会话
+  EXPECT_EQ(2u, proxy_->upstreams());
+  ASSERT_TRUE(proxy_->KeepAliveUpstreams(0).ok());
+  EXPECT_EQ(2, cluster_.keepalives());
+}
+
+TEST_F(ChubbyProxyTest, CacheInvalidatedByOtherWriters) {
+  PutRequest put;
+  put.set_key("/a");
+  put.set_value("1");
+  put.set_uuid(Token("writer"));
+  PutResponse put_response;
+  proxy_->Put(put, &put_response);
+  EXPECT_EQ("1", Get("/a").value());
+  EXPECT_EQ(1u, cluster_.tracker_->readers("/a"));
+
+  // 另一个 proxy 或直连的客户端写入
+  std::thread write([this]() {
+    PutRequest request;
+    request.set_key("/a");
+    request.set_value("2");
+    request.set_session_id("direct");
+    PutResponse response;
+    cluster_.Put("n1", request, &response);
+  });
+  while (cluster_.tracker_->pending_writes() == 0) {
+    std::this_thread::yield();
+  }
+  EXPECT_EQ("1", Get("/a").value());
+  ASSERT_TRUE(proxy_->KeepAliveUpstreams(0).ok());
+  ASSERT_TRUE(proxy_->KeepAliveUpstreams(0).ok());
+  write.join();
+  EXPECT_EQ("2", Get("/a").value());
+}
+
+TEST_F(ChubbyProxyTest, LocksReleasedWhenClientSessionExpires) {
+  KeepAlive("c1");
+  KeepAlive("c2");
+  ASSERT_TRUE(Lock("c1", "/lock").success());
+  const std::string upstream = cluster_.lock_owner("/lock");
+  EXPECT_EQ(0u, upstream.find("p1/"));
+
+  // 同一个上游会话, 由 proxy 拒绝
+  LockResponse rejected = Lock("c2", "/lock");
+  EXPECT_FALSE(rejected.success());
+  EXPECT_EQ("p1", rejected.leader_id());
+  UnLockRequest unlock;
+  unlock.set_key("/lock");
+  unlock.set_session_id("c2");
+  unlock.set_uuid(Token("c2"));
+  UnLockResponse unlock_response;
+  proxy_->UnLock(unlock, &unlock_response);
+  EXPECT_FALSE(unlock_response.success());
+  EXPECT_EQ(upstream, cluster_.lock_owner("/lock"));
+
+  // c1 不再续约, 过期后 proxy 在 leader 上释放锁
+  env_.AdvanceMillis(600);
+  KeepAlive("c2");
+  env_.AdvanceMillis(600);
+  proxy_->AdvanceTo(env_.NowMicros());
+  EXPECT_EQ(1u, proxy_->sessions());
+  EXPECT_EQ("", cluster_.lock_owner("/lock"));
+  ASSERT_TRUE(Lock("c2", "/lock").success());
+
+  unlock.set_session_id("c2");
+  proxy_->UnLock(unlock, &unlock_response);
+  EXPECT_TRUE(unlock_response.success());
+  EXPECT_EQ("", cluster_.lock_owner("/lock"));
+}
+
+TEST_F(ChubbyProxyTest, LockWaitersQueueOnProxy) {
+  KeepAlive("c1");
+  KeepAlive("c2");
+  ASSERT_TRUE(Lock("c1", "/lock").success());
+  const std::string upstream = cluster_.lock_owner("/lock");
+  // 超时之前锁没有释放
+  EXPECT_FALSE(Lock("c2", "/lock", 20).success());
+
+  LockResponse waited;
+  std::thread wait([this, &waited]() { waited = Lock("c2", "/lock", 60000); });
+  env_.SleepForMicroseconds(20000);
+  EXPECT_FALSE(waited.success());
+  EXPECT_EQ(upstream, cluster_.lock_owner("/lock"));
+
+  UnLockRequest unlock;
+  unlock.set_key("/lock");
+  unlock.set_session_id("c1");
+  unlock.set_uuid(Token("c1"));
+  UnLockResponse unlock_response;
+  proxy_->UnLock(unlock, &unlock_response);
+  EXPECT_TRUE(unlock_response.success());
+  wait.join();
+  EXPECT_TRUE(waited.success());
+  EXPECT_EQ(upstream, cluster_.lock_owner("/lock"));
+  // c1 不再持有
+  EXPECT_FALSE(Lock("c1", "/lock").success());
+}
+
+TEST_F(ChubbyProxyTest, AuthenticatesClients) {
+  // 不是 token 的 uuid 需要重新登录
+  GetRequest get;
+  get.set_key("/a");
+  get.set_uuid("u1");
+  GetResponse get_response;
+  proxy_->Get(get, &get_response);
+  EXPECT_FALSE(get_response.success());
+  EXPECT_TRUE(get_response.uuid_expired());
+
+  // 其他用户不能借用 proxy 的身份
+  PutRequest put;
+  put.set_key("/a");
+  put.set_value("1");
+  put.set_uuid(tokens_->Issue("bob"));
+  PutResponse put_response;
+  proxy_->Put(put, &put_response);
+  EXPECT_FALSE(put_response.success());
+  EXPECT_FALSE(put_response.uuid_expired());
+  EXPECT_EQ("p1", put_response.leader_id());
+  EXPECT_FALSE(Get("/a").hit());
+
+  // 知道 c1 的 session_id 也不能替它解锁或者续约
+  KeepAlive("c1");
+  ASSERT_TRUE(Lock("c1", "/lock").success());
+  const std::string upstream = cluster_.lock_owner("/lock");
+  UnLockRequest unlock;
+  unlock.set_key("/lock");
+  unlock.set_session_id("c1");
+  unlock.set_uuid(Token("c2"));
+  UnLockResponse unlock_response;
+  proxy_->UnLock(unlock, &unlock_response);
+  EXPECT_FALSE(unlock_response.success());
+  EXPECT_EQ(upstream, cluster_.lock_owner("/lock"));
+  KeepAliveRequest keepalive;
+  keepalive.set_session_id("c1");
+  keepalive.set_uuid(Token("c2"));
+  KeepAliveResponse keepalive_response;
+  proxy_->KeepAlive(keepalive, &keepalive_response);
+  EXPECT_FALSE(keepalive_response.success());
+
+  // c1 过期后绑定解除
+  env_.AdvanceMillis(1200);
+  proxy_->AdvanceTo(env_.NowMicros());
+  EXPECT_EQ("", cluster_.lock_owner("/lock"));
+  keepalive_response.Clear();
+  proxy_->KeepAlive(keepalive, &keepalive_response);
+  EXPECT_TRUE(keepalive_response.success());
+}
+
+TEST_F(ChubbyProxyTest, UpstreamsReleasedWithLastSession) {
+  KeepAlive("c1");
+  EXPECT_FALSE(Get("/a").hit());
+  EXPECT_EQ(2u, proxy_->upstreams());
+
+  env_.AdvanceMillis(1200);
+  proxy_->AdvanceTo(env_.NowMicros());
+  EXPECT_EQ(0u, proxy_->sessions());
+  EXPECT_EQ(0u, proxy_->upstreams());
+
+  // 新的客户端重新建立上游会话
+  KeepAlive("c2");
+  EXPECT_FALSE(Get("/a").hit());
+  EXPECT_EQ(2u, proxy_->upstreams());
+}
+
+} // namespace chubby
+} // namespace mpr
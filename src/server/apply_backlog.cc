@@ -0,0 +1,108 @@
+#include "server/apply_backlog.h"
+
+#include <algorithm>
+
+#include "base/monitoring/monitoring.h"
+
+#include <gflags/gflags.h>
+
+DECLARE_int32(chubby_busy_apply_lag);
+DECLARE_int32(chubby_busy_pending_size);
+
+namespace mpr {
+namespace chubby {
+
+namespace {
+
+base::monitoring::Gauge<std::string>* backlog_bytes_gauge =
+    base::monitoring::Gauge<std::string>::New(
+        "chubby_apply_backlog_bytes", "name",
+        "Bytes of appended entries not yet applied on a follower");
+
+base::monitoring::Gauge<std::string>* busy_gauge =
+    base::monitoring::Gauge<std::string>::New(
+        "chubby_follower_busy", "name",
+        "1 while the follower asks the leader to slow down");
+
+} // namespace
+
+ApplyBacklog::Options::Options()
+  : max_entries(FLAGS_chubby_busy_apply_lag),
+    max_bytes(static_cast<int64_t>(FLAGS_chubby_busy_pending_size) * 1024 * 1024) {}
+
+ApplyBacklog::ApplyBacklog(const Options& options)
+  : options_(options),
+    applied_index_(-1),
+    bytes_(0),
+    busy_(false) {}
+
+void ApplyBacklog::Appended(int64_t first_index, int64_t last_index,
+                            int64_t bytes) {
+  base::mutex_lock l(mu_);
+  if (last_index <= applied_index_) {
+    return;
+  }
+  // 被覆盖的日志不再积压. 部分覆盖的批次保留原来的字节数, 只是估计.
+  while (!batches_.empty() && batches_.back().first_index >= first_index) {
+    bytes_ -= batches_.back().bytes;
+    batches_.pop_back();
+  }
+  if (!batches_.empty() && batches_.back().last_index >= first_index) {
+    batches_.back().last_index = first_index - 1;
+  }
+  batches_.push_back(Batch{first_index, last_index, bytes});
+  bytes_ += bytes;
+  DoUpdate();
+}
+
+void ApplyBacklog::Applied(int64_t index) {
+  base::mutex_lock l(mu_);
+  if (index <= applied_index_) {
+    return;
+  }
+  applied_index_ = index;
+  while (!batches_.empty() && batches_.front().last_index <= index) {
+    bytes_ -= batches_.front().bytes;
+    batches_.pop_front();
+  }
+  DoUpdate();
+}
+
+bool ApplyBacklog::busy() const {
+  base::mutex_lock l(mu_);
+  return busy_;
+}
+
+int64_t ApplyBacklog::entries() const {
+  base::mutex_lock l(mu_);
+  return DoEntries();
+}
+
+int64_t ApplyBacklog::bytes() const {
+  base::mutex_lock l(mu_);
+  return bytes_;
+}
+
+int64_t ApplyBacklog::DoEntries() const {
+  if (batches_.empty()) {
+    return 0;
+  }
+  return batches_.back().last_index - std::max(applied_index_,
+                                               batches_.front().first_index - 1);
+}
+
+void ApplyBacklog::DoUpdate() {
+  const int64_t entries = DoEntries();
+  if (busy_) {
+    busy_ = (options_.max_entries > 0 && entries > options_.max_entries / 2) ||
+            (options_.max_bytes > 0 && bytes_ > options_.max_bytes / 2);
+  } else {
+    busy_ = (options_.max_entries > 0 && entries > options_.max_entries) ||
+            (options_.max_bytes > 0 && bytes_ > options_.max_bytes);
+  }
+  backlog_bytes_gauge->Set(options_.name, bytes_);
+  busy_gauge->Set(options_.name, busy_ ? 1 : 0);
+}
+
+} // namespace chubby
+} // namespace mpr
@@ -0,0 +1,64 @@
+#ifndef MPR_CHUBBY_SERVER_APPLY_BACKLOG_H_
+#define MPR_CHUBBY_SERVER_APPLY_BACKLOG_H_
+
+#include <deque>
+#include <string>
+
+#include "base/macros.h"
+#include "base/platform/mutex.h"
+
+namespace mpr {
+namespace chubby {
+
+// Follower 端已写入 binlog 但还没有 apply 的日志.
+//
+// 积压的条数或字节数超过上限时 busy() 为 true, 通过
+// AppendEntriesResponse.is_busy 让 leader 缩小发送窗口; 降到上限的一半以下
+// 才恢复, 避免在边界上来回切换.
+class ApplyBacklog {
+ public:
+  struct Options {
+    // 用于 metrics 的标签
+    std::string name;
+    // <= 0 表示不限制
+    int64_t max_entries;
+    int64_t max_bytes;
+
+    Options();
+  };
+
+  explicit ApplyBacklog(const Options& options);
+
+  // [first_index, last_index] 写入了 binlog, first_index 之后原有的日志被覆盖
+  void Appended(int64_t first_index, int64_t last_index, int64_t bytes);
+  // index 之前 (含) 的日志已经 apply
+  void Applied(int64_t index);
+
+  bool busy() const;
+  int64_t entries() const;
+  int64_t bytes() const;
+
+ private:
+  struct Batch {
+    int64_t first_index;
+    int64_t last_index;
+    int64_t bytes;
+  };
+
+  int64_t DoEntries() const;
+  void DoUpdate();
+
+  const Options options_;
+
+  mutable base::mutex mu_;
+  std::deque<Batch> batches_;
+  int64_t applied_index_;
+  int64_t bytes_;
+  bool busy_;
+
+  DISALLOW_COPY_AND_ASSIGN(ApplyBacklog);
+};
+
+} // namespace chubby
+} // namespace mpr
+#endif // MPR_CHUBBY_SERVER_APPLY_BACKLOG_H_
@@ -0,0 +1,78 @@
+#include <gtest/gtest.h>
+
+#include "server/apply_backlog.h"
+
+namespace mpr {
+namespace chubby {
+
+namespace {
+
+ApplyBacklog::Options TestOptions(int64_t max_entries, int64_t max_bytes) {
+  ApplyBacklog::Options options;
+  options.name = "test";
+  options.max_entries = max_entries;
+  options.max_bytes = max_bytes;
+  return options;
+}
+
+} // namespace
+
+TEST(ApplyBacklog, BusyByEntries) {
+  ApplyBacklog backlog(TestOptions(100, 0));
+  backlog.Appended(0, 49, 1000);
+  EXPECT_EQ(50, backlog.entries());
+  EXPECT_FALSE(backlog.busy());
+
+  backlog.Appended(50, 149, 1000);
+  EXPECT_EQ(150, backlog.entries());
+  EXPECT_TRUE(backlog.busy());
+
+  // 降到上限的一半以下才恢复
+  backlog.Applied(79);
+  EXPECT_EQ(70, backlog.entries());
+  EXPECT_TRUE(backlog.busy());
+  backlog.Applied(109);
+  EXPECT_EQ(40, backlog.entries());
+  EXPECT_FALSE(backlog.busy());
+}
+
+TEST(ApplyBacklog, BusyByBytes) {
+  ApplyBacklog backlog(TestOptions(0, 1000));
+  backlog.Appended(0, 0, 600);
+  backlog.Appended(1, 1, 600);
+  EXPECT_EQ(1200, backlog.bytes());
+  EXPECT_TRUE(backlog.busy());
+
+  backlog.Applied(0);
+  EXPECT_EQ(600, backlog.bytes());
+  EXPECT_TRUE(backlog.busy());
+  backlog.Applied(1);
+  EXPECT_EQ(0, backlog.bytes());
+  EXPECT_EQ(0, backlog.entries());
+  EXPECT_FALSE(backlog.busy());
+}
+
+TEST(ApplyBacklog, OverwrittenEntries) {
+  ApplyBacklog backlog(TestOptions(0, 0));
+  backlog.Appended(0, 9, 100);
+  backlog.Appended(10, 19, 100);
+  // 新 leader 覆盖了 [10, 19], 只保留一份
+  backlog.Appended(10, 14, 50);
+  EXPECT_EQ(15, backlog.entries());
+  EXPECT_EQ(150, backlog.bytes());
+
+  // 部分覆盖时截断之前的批次
+  backlog.Appended(5, 7, 30);
+  EXPECT_EQ(8, backlog.entries());
+  EXPECT_EQ(130, backlog.bytes());
+
+  // 已经 apply 的日志被重发时忽略
+  backlog.Applied(7);
+  backlog.Appended(0, 7, 80);
+  EXPECT_EQ(0, backlog.entries());
+  EXPECT_EQ(0, backlog.bytes());
+  EXPECT_FALSE(backlog.busy());
+}
+
+} // namespace chubby
+} // namespace mpr
@@ -0,0 +1,286 @@
+#include "server/apply_pipeline.h"
+
+#include <map>
+
+#include "base/errors.h"
+#include "base/logging.h"
+#include "base/monitoring/monitoring.h"
+#include "server/dedup_table.h"
+#include "storage/bulk_loader.h"
+
+#include <gflags/gflags.h>
+#include <leveldb/write_batch.h>
+
+DECLARE_int32(chubby_apply_batch_entries);
+DECLARE_int32(chubby_apply_batch_size);
+DECLARE_string(chubby_ingest_dir);
+
+namespace mpr {
+namespace chubby {
+
+namespace {
+
+base::monitoring::Gauge<std::string>* apply_lag_gauge =
+    base::monitoring::Gauge<std::string>::New(
+        "chubby_apply_lag", "name",
+        "Committed entries not yet applied to the database");
+
+base::monitoring::Counter<std::string>* applied_counter =
+    base::monitoring::Counter<std::string>::New(
+        "chubby_applied_entries", "name",
+        "Entries applied to the database");
+
+base::monitoring::Counter<std::string>* apply_batch_counter =
+    base::monitoring::Counter<std::string>::New(
+        "chubby_apply_write_batches", "name",
+        "leveldb WriteBatches written by apply");
+
+base::monitoring::Counter<std::string>* ingest_failure_counter =
+    base::monitoring::Counter<std::string>::New(
+        "chubby_ingest_failures", "name",
+        "kIngest entries skipped because their tables are missing or corrupt");
+
+// 失败后重试的间隔
+const int64_t kRetryMicros = 100 * 1000;
+
+} // namespace
+
+ApplyPipeline::Options::Options()
+  : max_batch_entries(FLAGS_chubby_apply_batch_entries),
+    max_batch_bytes(static_cast<int64_t>(FLAGS_chubby_apply_batch_size) * 1024 * 1024),
+    env(base::Env::Default()),
+    ingest_dir(FLAGS_chubby_ingest_dir) {}
+
+ApplyPipeline::ApplyPipeline(const Options& options, BinLogger* bin_logger,
+                             Database* database, int64_t last_applied)
+  : options_(options),
+    bin_logger_(bin_logger),
+    database_(database),
+    last_applied_(last_applied),
+    commit_index_(last_applied),
+    stopping_(false) {
+  DCHECK(bin_logger_ != nullptr);
+  DCHECK(database_ != nullptr);
+  thread_.reset(options_.env->StartThread(base::ThreadOptions(), "apply_pipeline",
+                                          [this]() { ApplyLoop(); }));
+}
+
+ApplyPipeline::~ApplyPipeline() {
+  {
+    base::mutex_lock l(mu_);
+    stopping_ = true;
+    commit_cv_.notify_all();
+    applied_cv_.notify_all();
+  }
+  thread_.reset(nullptr);
+}
+
+void ApplyPipeline::Commit(int64_t commit_index) {
+  base::mutex_lock l(mu_);
+  if (commit_index > commit_index_) {
+    commit_index_ = commit_index;
+    apply_lag_gauge->Set(options_.name, commit_index_ - last_applied());
+    commit_cv_.notify_one();
+  }
+}
+
+bool ApplyPipeline::WaitApplied(int64_t index, int64_t timeout_micros) {
+  uint64_t deadline = options_.env->NowMicros() + timeout_micros;
+  base::mutex_lock l(mu_);
+  while (last_applied() < index && !stopping_) {
+    uint64_t now = options_.env->NowMicros();
+    if (now >= deadline) {
+      return false;
+    }
+    applied_cv_.wait_for(l, std::chrono::microseconds(deadline - now));
+  }
+  return last_applied() >= index;
+}
+
+void ApplyPipeline::ApplyLoop() {
+  base::mutex_lock l(mu_);
+  while (!stopping_) {
+    int64_t first_index = last_applied() + 1;
+    if (commit_index_ < first_index) {
+      commit_cv_.wait(l);
+      continue;
+    }
+    int64_t last_index = std::min(commit_index_,
+                                  first_index + options_.max_batch_entries - 1);
+    l.unlock();
+    base::Status status = ApplyRange(first_index, last_index);
+    if (!status.ok()) {
+      LOG(ERROR) << "[ApplyPipeline] " << options_.name << " failed to apply ["
+                 << first_index << ", " << last_index << "]: " << status.ToString();
+      options_.env->SleepForMicroseconds(kRetryMicros);
+    }
+    l.lock();
+  }
+}
+
+// static
+Entry ApplyPipeline::PutEntry(const PutRequest& request, const std::string& user) {
+  Entry entry;
+  entry.set_op(kPut);
+  entry.set_user(user);
+  entry.set_key(request.key());
+  entry.set_value(request.value());
+  entry.set_dedup_key(DedupTable::Key(request.session_id(), request.request_id()));
+  return entry;
+}
+
+// static
+Entry ApplyPipeline::DelEntry(const DelRequest& request, const std::string& user) {
+  Entry entry;
+  entry.set_op(kDel);
+  entry.set_user(user);
+  entry.set_key(request.key());
+  entry.set_dedup_key(DedupTable::Key(request.session_id(), request.request_id()));
+  return entry;
+}
+
+// static
+Entry ApplyPipeline::IngestEntry(const std::string& user,
+                                 const std::vector<IngestTable>& tables) {
+  Entry entry;
+  entry.set_op(kIngest);
+  entry.set_user(user);
+  entry.set_value(EncodeIngestTables(tables));
+  return entry;
+}
+
+base::Status ApplyPipeline::ApplyRange(int64_t first_index, int64_t last_index) {
+  std::map<std::string, leveldb::WriteBatch> batches;
+  int64_t batch_bytes = 0;
+  Changes changes;
+  // batch 中带 dedup_key 的日志, 写入后回复
+  std::vector<std::pair<std::string, int64_t>> results;
+  int64_t applied = first_index - 1;
+
+  auto flush = [&]() -> base::Status {
+    for (auto& kv : batches) {
+      if (!database_->Open(kv.first)) {
+        return base::errors::Internal("failed to open namespace ", kv.first);
+      }
+      RETURN_IF_ERROR(database_->Write(kv.first, &kv.second));
+      apply_batch_counter->Increment(options_.name);
+    }
+    batches.clear();
+    batch_bytes = 0;
+    if (!changes.empty()) {
+      options_.change_callback(&changes);
+      changes.clear();
+    }
+    if (options_.result_callback) {
+      for (auto& result : results) {
+        options_.result_callback(result.first, result.second, base::Status::OK());
+      }
+    }
+    results.clear();
+    return base::Status::OK();
+  };
+  auto advance = [&](int64_t index) {
+    applied_counter->IncrementBy(options_.name, index - last_applied());
+    {
+      base::mutex_lock l(mu_);
+      last_applied_.store(index, std::memory_order_release);
+      apply_lag_gauge->Set(options_.name, commit_index_ - index);
+      applied_cv_.notify_all();
+    }
+    if (options_.applied_callback) {
+      options_.applied_callback(index);
+    }
+  };
+
+  for (int64_t index = first_index; index <= last_index; ++index) {
+    LogEntry log_entry;
+    if (!bin_logger_->ReadSlot(index, &log_entry)) {
+      // 已经写入的部分仍然有效
+      RETURN_IF_ERROR(flush());
+      if (applied > last_applied()) {
+        advance(applied);
+      }
+      return base::errors::Internal("failed to read slot ", index);
+    }
+    if (!log_entry.dedup_key.empty() && options_.dedup_callback &&
+        !options_.dedup_callback(log_entry.dedup_key, index)) {
+      // 重试的请求已经在之前的 index apply 过
+      applied = index;
+      continue;
+    }
+    if (log_entry.log_operation == kPut || log_entry.log_operation == kDel) {
+      leveldb::WriteBatch& batch = batches[log_entry.user];
+      if (log_entry.log_operation == kPut) {
+        batch.Put(log_entry.key, log_entry.value);
+      } else {
+        batch.Delete(log_entry.key);
+      }
+      batch_bytes += log_entry.key.size() + log_entry.value.size();
+      applied = index;
+      if (!log_entry.dedup_key.empty()) {
+        results.emplace_back(log_entry.dedup_key, index);
+      }
+      if (options_.change_callback) {
+        changes.emplace_back(index, std::move(log_entry));
+      }
+      if (batch_bytes >= options_.max_batch_bytes) {
+        RETURN_IF_ERROR(flush());
+      }
+      continue;
+    }
+    // 其他操作可能读取之前的写入, 先写入已经攒下的 batch
+    RETURN_IF_ERROR(flush());
+    if (log_entry.log_operation == kIngest) {
+      base::Status status = ApplyIngest(log_entry, index);
+      if (!status.ok()) {
+        if (applied > last_applied()) {
+          advance(applied);
+        }
+        return status;
+      }
+    } else if (options_.apply_callback) {
+      base::Status status = options_.apply_callback(log_entry, index);
+      if (!log_entry.dedup_key.empty() && options_.result_callback) {
+        options_.result_callback(log_entry.dedup_key, index, status);
+      }
+    }
+    // 不一定幂等, 立即推进, 失败重试时不会再次 apply
+    applied = index;
+    advance(applied);
+  }
+  RETURN_IF_ERROR(flush());
+  if (applied > last_applied()) {
+    advance(applied);
+  }
+  return base::Status::OK();
+}
+
+base::Status ApplyPipeline::ApplyIngest(const LogEntry& log_entry, int64_t index) {
+  std::vector<IngestTable> tables;
+  if (!DecodeIngestTables(log_entry.value, &tables)) {
+    // 所有副本读到的是同样的内容, 一起跳过
+    LOG(ERROR) << "[ApplyPipeline] " << options_.name << " skips corrupted ingest at "
+               << index << ", namespace: " << log_entry.user;
+    return base::Status::OK();
+  }
+  base::Status status;
+  if (options_.ingest_dir.empty()) {
+    status = base::errors::FailedPrecondition("no ingest_dir");
+  } else {
+    // 整体替换 namespace, 失败后重试同一条日志得到相同的结果
+    status = database_->Ingest(log_entry.user, options_.ingest_dir, tables);
+  }
+  if (base::errors::IsNotFound(status) || base::errors::IsDataLoss(status) ||
+      base::errors::IsInvalidArgument(status) ||
+      base::errors::IsFailedPrecondition(status)) {
+    // 重试也不会成功, 不能让后面的日志一直等待
+    LOG(ERROR) << "[ApplyPipeline] " << options_.name << " skips ingest at " << index
+               << ", namespace: " << log_entry.user << ": " << status.ToString();
+    ingest_failure_counter->Increment(options_.name);
+    return base::Status::OK();
+  }
+  return status;
+}
+
+} // namespace chubby
+} // namespace mpr
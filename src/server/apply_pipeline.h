@@ -0,0 +1,115 @@
+#ifndef MPR_CHUBBY_SERVER_APPLY_PIPELINE_H_
+#define MPR_CHUBBY_SERVER_APPLY_PIPELINE_H_
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base/macros.h"
+#include "base/status.h"
+#include "base/platform/env.h"
+#include "base/platform/mutex.h"
+#include "proto/service.pb.h"
+#include "storage/bin_logger.h"
+#include "storage/bulk_loader.h"
+#include "storage/database.h"
+
+namespace mpr {
+namespace chubby {
+
+// 把已提交的日志 apply 到 Database 的独立线程.
+//
+// 共识线程只调用 Commit 通知新的 commit_index, 不等待磁盘. apply 线程从
+// BinLogger 读出已提交的区间, 把连续的 kPut/kDel 按 namespace (即
+// LogEntry::user) 合并为一个 leveldb::WriteBatch, 写完后推进 last_applied.
+// kIngest 调用 Database::Ingest 用 ingest_dir 下的表替换 user 的 namespace.
+// 读写失败时和写入失败一样重试; 表不存在, 大小不符, 内容损坏等重试也不会
+// 成功的错误记录日志和 metric 后跳过, 这个副本上 namespace 保留原有内容,
+// 与导入成功的副本不一致, 需要修复表文件后重新提交 kIngest. kIngest 不产生
+// 逐个 key 的变更, watch 和客户端缓存不会收到通知. 其他操作按顺序交给
+// apply_callback, 之前攒下的 batch 会先写入.
+//
+// kPut/kDel 是幂等的, 崩溃后从更早的位置重新 apply 也能得到相同的结果.
+// 带 dedup_key 的日志先交给 dedup_callback, 客户端重试导致的重复日志被跳过;
+// 没有跳过的日志 apply 之后 (kPut/kDel 在 batch 写入之后) 以结果调用
+// result_callback.
+class ApplyPipeline {
+ public:
+  // 返回请求的结果 (例如锁被其他会话持有), 不会重试
+  typedef std::function<base::Status(const LogEntry& log_entry, int64_t index)> ApplyCallback;
+  // 一个 WriteBatch 写入后, 其中的 kPut/kDel 和它们的 index
+  typedef std::vector<std::pair<int64_t, LogEntry>> Changes;
+  typedef std::function<void(Changes* changes)> ChangeCallback;
+
+  struct Options {
+    // 用于 metrics 的标签
+    std::string name;
+    int32_t max_batch_entries;
+    int64_t max_batch_bytes;
+    base::Env* env;
+    // kPut/kDel/kIngest 以外的日志, 在 apply 线程中按顺序调用
+    ApplyCallback apply_callback;
+    // 设置时才保留写入的 kPut/kDel, 例如 WatchManager::Apply
+    ChangeCallback change_callback;
+    // 带 dedup_key 的日志 apply 之前调用, 返回 false 时跳过, 例如
+    // DedupTable::Record
+    std::function<bool(const std::string& dedup_key, int64_t index)> dedup_callback;
+    // 设置 dedup_callback 时也要设置, 例如 DedupTable::Finish
+    std::function<void(const std::string& dedup_key, int64_t index,
+                       const base::Status& status)> result_callback;
+    // last_applied 前进后调用, 例如 ReadIndex::Applied, DedupTable::Applied
+    std::function<void(int64_t last_applied)> applied_callback;
+    // kIngest 的表所在的共享目录, 每个副本上挂载的位置可以不同
+    std::string ingest_dir;
+
+    Options();
+  };
+
+  // last_applied: 上次已经 apply 的位置
+  ApplyPipeline(const Options& options, BinLogger* bin_logger,
+                Database* database, int64_t last_applied);
+  ~ApplyPipeline();
+
+  // 生成写入 user 的 namespace 的提案, 带 request_id 时填写 dedup_key
+  static Entry PutEntry(const PutRequest& request, const std::string& user);
+  static Entry DelEntry(const DelRequest& request, const std::string& user);
+  // 用 tables 替换 user 的 namespace 的提案, 见 MakeIngestTables
+  static Entry IngestEntry(const std::string& user,
+                           const std::vector<IngestTable>& tables);
+
+  // commit_index 前进后调用, 不阻塞
+  void Commit(int64_t commit_index);
+
+  int64_t last_applied() const {
+    return last_applied_.load(std::memory_order_acquire);
+  }
+
+  // 等待 apply 到 index, 超时返回 false
+  bool WaitApplied(int64_t index, int64_t timeout_micros);
+
+ private:
+  void ApplyLoop();
+  base::Status ApplyRange(int64_t first_index, int64_t last_index);
+  base::Status ApplyIngest(const LogEntry& log_entry, int64_t index);
+
+  const Options options_;
+  BinLogger* bin_logger_;
+  Database* database_;
+  std::atomic<int64_t> last_applied_;
+
+  base::mutex mu_;
+  base::condition_variable commit_cv_;
+  base::condition_variable applied_cv_;
+  int64_t commit_index_;
+  bool stopping_;
+  std::unique_ptr<base::Thread> thread_;
+
+  DISALLOW_COPY_AND_ASSIGN(ApplyPipeline);
+};
+
+} // namespace chubby
+} // namespace mpr
+#endif // MPR_CHUBBY_SERVER_APPLY_PIPELINE_H_
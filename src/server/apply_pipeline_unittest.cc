@@ -0,0 +1,240 @@
+#include <gtest/gtest.h>
+
+#include "server/apply_pipeline.h"
+#include "server/dedup_table.h"
+#include "storage/bulk_loader.h"
+#include "base/io/path.h"
+#include "base/platform/env.h"
+
+namespace mpr {
+namespace chubby {
+
+namespace {
+
+const char kTestDir[] = "/tmp/apply_pipeline_test";
+
+class ApplyPipelineTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    base::int64 undeleted_files, undeleted_dirs;
+    base::Env::Default()->DeleteDirectoryRecursively(kTestDir, &undeleted_files,
+                                                     &undeleted_dirs);
+    ASSERT_TRUE(base::Env::Default()->CreateDirectoryRecursively(kTestDir).ok());
+    bin_logger_.reset(new BinLogger(BinLogger::Options(kTestDir)));
+    database_.reset(new Database(base::io::JoinPath(kTestDir, "data")));
+  }
+
+  void Append(LogOperation op, const std::string& user, const std::string& key,
+              const std::string& value, const std::string& dedup_key = "") {
+    LogEntry log_entry;
+    log_entry.dedup_key = dedup_key;
+    log_entry.log_operation = op;
+    log_entry.user = user;
+    log_entry.key = key;
+    log_entry.value = value;
+    log_entry.term = 1;
+    bin_logger_->AppendEntry(log_entry);
+  }
+
+  std::string Get(const std::string& user, const std::string& key) {
+    std::string value;
+    database_->Get(user, key, &value);
+    return value;
+  }
+
+  std::unique_ptr<BinLogger> bin_logger_;
+  std::unique_ptr<Database> database_;
+};
+
+} // namespace
+
+TEST_F(ApplyPipelineTest, CoalescesWritesPerNamespace) {
+  for (int i = 0; i < 100; ++i) {
+    Append(kPut, i % 2 == 0 ? "alice" : "bob", "key" + std::to_string(i / 2), "v");
+  }
+  Append(kDel, "alice", "key0", "");
+
+  std::vector<int64_t> applied;
+  ApplyPipeline::Options options;
+  options.name = "test";
+  options.applied_callback = [&applied](int64_t index) { applied.push_back(index); };
+  {
+    ApplyPipeline pipeline(options, bin_logger_.get(), database_.get(), -1);
+    EXPECT_FALSE(pipeline.WaitApplied(0, 1000));
+
+    pipeline.Commit(100);
+    ASSERT_TRUE(pipeline.WaitApplied(100, 10 * 1000 * 1000));
+    EXPECT_EQ(100, pipeline.last_applied());
+  }
+  // applied_callback 在唤醒等待者之后调用, 停止 pipeline 后再检查.
+  // 一个区间只推进一次
+  ASSERT_EQ(1u, applied.size());
+  EXPECT_EQ(100, applied[0]);
+
+  EXPECT_EQ("", Get("alice", "key0"));
+  EXPECT_EQ("v", Get("alice", "key1"));
+  EXPECT_EQ("v", Get("bob", "key0"));
+  EXPECT_EQ("v", Get("bob", "key49"));
+}
+
+TEST_F(ApplyPipelineTest, OtherOperationsSeePreviousWrites) {
+  Append(kPut, "", "a", "1");
+  Append(kLock, "", "a", "session");
+  Append(kPut, "", "a", "2");
+
+  std::vector<std::string> seen;
+  ApplyPipeline::Options options;
+  options.name = "test";
+  options.apply_callback = [this, &seen](const LogEntry& log_entry, int64_t index) {
+    EXPECT_EQ(1, index);
+    EXPECT_EQ(kLock, log_entry.log_operation);
+    seen.push_back(Get("", "a"));
+    return base::Status::OK();
+  };
+  ApplyPipeline pipeline(options, bin_logger_.get(), database_.get(), -1);
+  pipeline.Commit(2);
+  ASSERT_TRUE(pipeline.WaitApplied(2, 10 * 1000 * 1000));
+  ASSERT_EQ(1u, seen.size());
+  EXPECT_EQ("1", seen[0]);
+  EXPECT_EQ("2", Get("", "a"));
+}
+
+TEST_F(ApplyPipelineTest, ReportsChangesAfterWrite) {
+  Append(kPut, "", "a", "1");
+  Append(kDel, "", "b", "");
+  Append(kLock, "", "a", "session");
+  Append(kPut, "alice", "a", "2");
+
+  std::vector<int64_t> indexes;
+  ApplyPipeline::Options options;
+  options.name = "test";
+  options.change_callback = [this, &indexes](ApplyPipeline::Changes* changes) {
+    for (const auto& change : *changes) {
+      // 回调时已经写入 Database
+      if (change.second.log_operation == kPut) {
+        EXPECT_EQ(change.second.value, Get(change.second.user, change.second.key));
+      }
+      indexes.push_back(change.first);
+    }
+  };
+  ApplyPipeline pipeline(options, bin_logger_.get(), database_.get(), -1);
+  pipeline.Commit(3);
+  ASSERT_TRUE(pipeline.WaitApplied(3, 10 * 1000 * 1000));
+  EXPECT_EQ(std::vector<int64_t>({0, 1, 3}), indexes);
+}
+
+TEST_F(ApplyPipelineTest, SkipsDuplicateRetries) {
+  PutRequest put;
+  put.set_key("a");
+  put.set_value("1");
+  put.set_session_id("s1");
+  put.set_request_id("1");
+  const Entry entry = ApplyPipeline::PutEntry(put, "");
+  EXPECT_EQ(DedupTable::Key("s1", "1"), entry.dedup_key());
+  put.clear_request_id();
+  EXPECT_EQ("", ApplyPipeline::PutEntry(put, "").dedup_key());
+
+  Append(kPut, "", "a", "1", entry.dedup_key());
+  Append(kPut, "", "a", "2");
+  // 换主后客户端重试, 同一个请求再次进入日志
+  Append(kPut, "", "a", "1", entry.dedup_key());
+  Append(kLock, "", "a", "session", "s1/2");
+  Append(kLock, "", "a", "session", "s1/2");
+
+  DedupTable dedup{DedupTable::Options()};
+  int locks = 0;
+  ApplyPipeline::Options options;
+  options.name = "test";
+  options.apply_callback = [&locks](const LogEntry&, int64_t index) {
+    EXPECT_EQ(3, index);
+    locks++;
+    return base::errors::FailedPrecondition("held by another session");
+  };
+  options.dedup_callback = [&dedup](const std::string& key, int64_t index) {
+    return dedup.Record(key, index);
+  };
+  options.result_callback = [&dedup](const std::string& key, int64_t index,
+                                     const base::Status& status) {
+    dedup.Finish(key, index, status);
+  };
+  options.applied_callback = [&dedup](int64_t last_applied) {
+    dedup.Applied(last_applied);
+  };
+  ApplyPipeline pipeline(options, bin_logger_.get(), database_.get(), -1);
+  pipeline.Commit(4);
+  ASSERT_TRUE(pipeline.WaitApplied(4, 10 * 1000 * 1000));
+  EXPECT_EQ("2", Get("", "a"));
+  EXPECT_EQ(1, locks);
+  int64_t index = -1;
+  // 最近一次出现的位置, apply 到这里时原请求已经生效
+  ASSERT_TRUE(dedup.Lookup(entry.dedup_key(), &index));
+  EXPECT_EQ(2, index);
+
+  // 重试得到原请求的结果
+  base::Status put_status = base::errors::Unknown("not called");
+  EXPECT_TRUE(dedup.Begin(entry.dedup_key(),
+                          [&put_status](const base::Status& s, int64_t) {
+                            put_status = s;
+                          }));
+  EXPECT_TRUE(put_status.ok());
+  base::Status lock_status;
+  EXPECT_TRUE(dedup.Begin("s1/2", [&lock_status](const base::Status& s, int64_t) {
+    lock_status = s;
+  }));
+  EXPECT_TRUE(base::errors::IsFailedPrecondition(lock_status));
+}
+
+TEST_F(ApplyPipelineTest, ResumesFromLastApplied) {
+  Append(kPut, "", "a", "old");
+  Append(kPut, "", "b", "new");
+  ApplyPipeline::Options options;
+  options.name = "test";
+  ApplyPipeline pipeline(options, bin_logger_.get(), database_.get(), 0);
+  pipeline.Commit(1);
+  ASSERT_TRUE(pipeline.WaitApplied(1, 10 * 1000 * 1000));
+  EXPECT_EQ("", Get("", "a"));
+  EXPECT_EQ("new", Get("", "b"));
+}
+
+TEST_F(ApplyPipelineTest, IngestReplacesNamespace) {
+  std::string dump;
+  AppendDumpRecord("a", "table", &dump);
+  AppendDumpRecord("b", "table", &dump);
+  const std::string dump_path = base::io::JoinPath(kTestDir, "dump");
+  ASSERT_TRUE(base::WriteStringToFile(base::Env::Default(), dump_path, dump).ok());
+  std::vector<std::string> table_files;
+  ASSERT_TRUE(BuildTablesFromDump(dump_path, base::io::JoinPath(kTestDir, "tables"),
+                                  "t", BulkLoadOptions(), &table_files).ok());
+  std::vector<IngestTable> tables;
+  ASSERT_TRUE(MakeIngestTables(kTestDir, table_files, &tables).ok());
+
+  Append(kPut, "alice", "a", "old");
+  Append(kPut, "alice", "stale", "old");
+  Entry ingest = ApplyPipeline::IngestEntry("alice", tables);
+  Append(kIngest, ingest.user(), "", ingest.value());
+  Append(kPut, "alice", "b", "new");
+  // 内容损坏的导入在所有副本上都被跳过
+  Append(kIngest, "alice", "", "\x05");
+  // 表不存在, 重试也不会成功, 跳过而不是一直重试
+  IngestTable missing;
+  missing.name = "tables/missing.table";
+  Append(kIngest, "alice", "", EncodeIngestTables({missing}));
+  Append(kPut, "alice", "c", "after");
+  ApplyPipeline::Options options;
+  options.name = "test";
+  options.ingest_dir = kTestDir;
+  options.apply_callback = [](const LogEntry& log_entry, int64_t index) {
+    ADD_FAILURE() << "unexpected apply_callback at " << index;
+    return base::Status::OK();
+  };
+  ApplyPipeline pipeline(options, bin_logger_.get(), database_.get(), -1);
+  pipeline.Commit(6);
+  ASSERT_TRUE(pipeline.WaitApplied(6, 10 * 1000 * 1000));
+  EXPECT_EQ("table", Get("alice", "a"));
+  EXPECT_EQ("", Get("alice", "stale"));
+  EXPECT_EQ("new", Get("alice", "b"));
+  EXPECT_EQ("after", Get("alice", "c"));
+}
+
+} // namespace chubby
+} // namespace mpr
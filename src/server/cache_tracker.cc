@@ -0,0 +1,305 @@
+#include "server/cache_tracker.h"
+
+#include "base/errors.h"
+#include "base/logging.h"
+#include "base/monitoring/monitoring.h"
+#include "base/random/random.h"
+
+#include <gflags/gflags.h>
+
+DECLARE_int32(chubby_session_lease);
+
+namespace mpr {
+namespace chubby {
+
+namespace {
+
+base::monitoring::Counter<>* invalidation_counter =
+    base::monitoring::Counter<>::New("chubby_cache_invalidations",
+                                     "Cache invalidations sent to sessions");
+
+base::monitoring::Gauge<>* pending_writes_gauge =
+    base::monitoring::Gauge<>::New("chubby_cache_pending_writes",
+                                   "Writes waiting for cache invalidation acks");
+
+} // namespace
+
+CacheTracker::Options::Options()
+  : tick_micros(10000),
+    grace_micros(static_cast<int64_t>(FLAGS_chubby_session_lease) * 1000),
+    env(base::Env::Default()),
+    start_thread(true) {}
+
+CacheTracker::CacheTracker(const Options& options)
+  : options_(options),
+    // 0 留给还没有见过 leader 的客户端
+    incarnation_(static_cast<int64_t>(base::random::New64() >> 1) | 1),
+    next_session_id_(0),
+    next_seq_(0),
+    grace_over_(options.grace_micros <= 0) {
+  base::thread::TimingWheel::Options wheel_options;
+  wheel_options.tick_micros = options_.tick_micros;
+  wheel_options.env = options_.env;
+  wheel_options.start_thread = options_.start_thread;
+  wheel_.reset(new base::thread::TimingWheel(wheel_options,
+      [this](std::vector<base::uint64>* ids) { HandleTimeouts(ids); }));
+  if (!grace_over_) {
+    wheel_->Schedule(kGraceTimer, options_.grace_micros);
+  }
+}
+
+CacheTracker::~CacheTracker() {
+  wheel_.reset();
+  Replies replies;
+  std::vector<InvalidateCallback> aborted;
+  {
+    base::mutex_lock l(mu_);
+    for (auto& kv : sessions_) {
+      DoReply(&kv.second, base::errors::Cancelled("cache tracker shutdown"),
+              &replies);
+    }
+    for (auto& kv : writes_) {
+      aborted.push_back(std::move(kv.second.done));
+    }
+    writes_.clear();
+  }
+  Completions none;
+  Run(&replies, &none);
+  for (auto& done : aborted) {
+    done(base::errors::Aborted("cache tracker shutdown"));
+  }
+}
+
+bool CacheTracker::AddReader(const std::string& session_id,
+                             const std::string& key) {
+  base::mutex_lock l(mu_);
+  if (invalidating_.count(key) > 0) {
+    return false;
+  }
+  DoGetSession(session_id)->keys.insert(key);
+  readers_[key].insert(session_id);
+  return true;
+}
+
+void CacheTracker::Invalidate(const std::string& key, const std::string& writer,
+                              InvalidateCallback done) {
+  Replies replies;
+  InvalidateCallback immediate;
+  {
+    base::mutex_lock l(mu_);
+    std::set<std::string> targets;
+    auto readers = readers_.find(key);
+    if (readers != readers_.end()) {
+      targets.swap(readers->second);
+      readers_.erase(readers);
+    }
+    // 还没有确认之前失效的会话可能仍在使用更早的值
+    auto invalidating = invalidating_.find(key);
+    if (invalidating != invalidating_.end()) {
+      targets.insert(invalidating->second.begin(), invalidating->second.end());
+    }
+    const int64_t seq = ++next_seq_;
+    int waiting = 0;
+    for (const std::string& session_id : targets) {
+      auto it = sessions_.find(session_id);
+      if (it == sessions_.end()) {
+        continue;
+      }
+      Session* session = &it->second;
+      session->keys.erase(key);
+      if (session_id == writer) {
+        continue;
+      }
+      session->pending[seq] = key;
+      invalidating_[key].insert(session_id);
+      waiting++;
+      DoReply(session, base::Status::OK(), &replies);
+    }
+    invalidation_counter->IncrementBy(waiting);
+    if (!grace_over_) {
+      // 之前的 leader 上登记的缓存者还可能在使用旧值
+      grace_writes_.push_back(seq);
+      waiting++;
+    }
+    if (waiting > 0) {
+      Write& write = writes_[seq];
+      write.waiting = waiting;
+      write.done = std::move(done);
+      pending_writes_gauge->Set(writes_.size());
+    } else {
+      immediate = std::move(done);
+    }
+  }
+  Completions none;
+  Run(&replies, &none);
+  if (immediate) {
+    immediate(base::Status::OK());
+  }
+}
+
+void CacheTracker::KeepAlive(const KeepAliveRequest& request,
+                             int64_t hold_micros, KeepAliveCallback done) {
+  Replies replies;
+  Completions completions;
+  {
+    base::mutex_lock l(mu_);
+    Session* session = DoGetSession(request.session_id());
+    // 其他 leader 的失效序号, 客户端收到响应后会清空缓存
+    if (request.cache_incarnation() == incarnation_) {
+      DoAck(request.session_id(), session, request.acked_invalidation(),
+            &completions);
+    }
+    if (session->hold) {
+      // 之前的请求已经没有人等待, 失效留给新的请求
+      replies.push_back(Reply());
+      replies.back().response.set_cache_incarnation(incarnation_);
+      replies.back().done = std::move(session->hold);
+      session->hold = nullptr;
+      wheel_->Cancel(session->id);
+    }
+    session->hold = std::move(done);
+    if (!session->pending.empty() || hold_micros <= 0) {
+      DoReply(session, base::Status::OK(), &replies);
+    } else {
+      wheel_->Schedule(session->id, hold_micros);
+    }
+  }
+  Run(&replies, &completions);
+}
+
+void CacheTracker::DropSession(const std::string& session_id) {
+  Replies replies;
+  Completions completions;
+  {
+    base::mutex_lock l(mu_);
+    auto it = sessions_.find(session_id);
+    if (it == sessions_.end()) {
+      return;
+    }
+    Session* session = &it->second;
+    DoAck(session_id, session, next_seq_, &completions);
+    DoReply(session, base::errors::Cancelled("session ", session_id, " closed"),
+            &replies);
+    for (const std::string& key : session->keys) {
+      auto readers = readers_.find(key);
+      if (readers != readers_.end()) {
+        readers->second.erase(session_id);
+        if (readers->second.empty()) {
+          readers_.erase(readers);
+        }
+      }
+    }
+    wheel_->Cancel(session->id);
+    session_ids_.erase(session->id);
+    sessions_.erase(it);
+  }
+  Run(&replies, &completions);
+}
+
+size_t CacheTracker::readers(const std::string& key) const {
+  base::mutex_lock l(mu_);
+  auto it = readers_.find(key);
+  return it == readers_.end() ? 0 : it->second.size();
+}
+
+size_t CacheTracker::pending_writes() const {
+  base::mutex_lock l(mu_);
+  return writes_.size();
+}
+
+CacheTracker::Session* CacheTracker::DoGetSession(const std::string& session_id) {
+  auto it = sessions_.find(session_id);
+  if (it == sessions_.end()) {
+    it = sessions_.emplace(session_id, Session()).first;
+    it->second.id = next_session_id_++;
+    session_ids_[it->second.id] = session_id;
+  }
+  return &it->second;
+}
+
+void CacheTracker::DoAck(const std::string& session_id, Session* session,
+                         int64_t acked, Completions* completions) {
+  auto end = session->pending.upper_bound(acked);
+  for (auto it = session->pending.begin(); it != end; ++it) {
+    auto invalidating = invalidating_.find(it->second);
+    if (invalidating != invalidating_.end()) {
+      auto sessions = &invalidating->second;
+      auto entry = sessions->find(session_id);
+      if (entry != sessions->end()) {
+        sessions->erase(entry);
+      }
+      if (sessions->empty()) {
+        invalidating_.erase(invalidating);
+      }
+    }
+    auto write = writes_.find(it->first);
+    if (write != writes_.end() && --write->second.waiting == 0) {
+      completions->push_back(std::move(write->second.done));
+      writes_.erase(write);
+    }
+  }
+  session->pending.erase(session->pending.begin(), end);
+  pending_writes_gauge->Set(writes_.size());
+}
+
+void CacheTracker::DoReply(Session* session, const base::Status& status,
+                           Replies* replies) {
+  if (!session->hold) {
+    return;
+  }
+  wheel_->Cancel(session->id);
+  replies->push_back(Reply());
+  Reply& reply = replies->back();
+  reply.done = std::move(session->hold);
+  session->hold = nullptr;
+  reply.status = status;
+  if (!status.ok()) {
+    return;
+  }
+  reply.response.set_cache_incarnation(incarnation_);
+  for (const auto& kv : session->pending) {
+    reply.response.add_invalidations(kv.second);
+    reply.response.set_invalidation_seq(kv.first);
+  }
+}
+
+void CacheTracker::HandleTimeouts(std::vector<base::uint64>* ids) {
+  Replies replies;
+  Completions completions;
+  {
+    base::mutex_lock l(mu_);
+    for (base::uint64 id : *ids) {
+      if (id == kGraceTimer) {
+        grace_over_ = true;
+        for (int64_t seq : grace_writes_) {
+          auto write = writes_.find(seq);
+          if (write != writes_.end() && --write->second.waiting == 0) {
+            completions.push_back(std::move(write->second.done));
+            writes_.erase(write);
+          }
+        }
+        grace_writes_.clear();
+        pending_writes_gauge->Set(writes_.size());
+        continue;
+      }
+      auto session_id = session_ids_.find(id);
+      if (session_id != session_ids_.end()) {
+        DoReply(&sessions_[session_id->second], base::Status::OK(), &replies);
+      }
+    }
+  }
+  Run(&replies, &completions);
+}
+
+// static
+void CacheTracker::Run(Replies* replies, Completions* completions) {
+  for (Reply& reply : *replies) {
+    reply.done(reply.status, &reply.response);
+  }
+  for (auto& done : *completions) {
+    done(base::Status::OK());
+  }
+}
+
+} // namespace chubby
+} // namespace mpr
@@ -0,0 +1,142 @@
+#ifndef MPR_CHUBBY_SERVER_CACHE_TRACKER_H_
+#define MPR_CHUBBY_SERVER_CACHE_TRACKER_H_
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "base/macros.h"
+#include "base/status.h"
+#include "base/platform/env.h"
+#include "base/platform/mutex.h"
+#include "base/thread/timing_wheel.h"
+#include "proto/service.pb.h"
+
+namespace mpr {
+namespace chubby {
+
+// leader 上记录哪些会话缓存了哪些 key, 写入之前使它们的缓存失效.
+//
+// 带 session_id 的 Get 登记该会话为 key 的缓存者. 写 key 之前调用
+// Invalidate: 每个缓存者 (写入者自己除外) 得到一个失效序号, 由 KeepAlive 的
+// 响应带给客户端, 客户端删除缓存后在下一次 KeepAlive 中确认. 所有缓存者确认
+// 或者会话结束后, 写入才能提议. 失效未完成期间 key 的读结果不能缓存.
+//
+// KeepAlive 没有失效需要发送时最多挂起 hold 的时间, 有新的失效时立即返回,
+// 写入等待的时间约为一个 RTT.
+//
+// 登记只保存在 leader 的内存中, 每次成为 leader 时创建新的 CacheTracker.
+// 每个 CacheTracker 有不同的 incarnation, 由 Get 和 KeepAlive 的响应带给
+// 客户端, 变化时客户端清空缓存并从头计算失效序号, 其他 incarnation 的确认
+// 不处理. 新 leader 不知道之前的缓存者, 创建后 grace_micros 之内的写入等到
+// grace 结束: 此时还没有联系上新 leader 的客户端已经超过 lease 没有成功的
+// KeepAlive, 自己丢弃了缓存.
+//
+// key 由调用者加上 namespace.
+class CacheTracker {
+ public:
+  typedef std::function<void(const base::Status& status)> InvalidateCallback;
+  // response 中填写 invalidations 和 invalidation_seq
+  typedef std::function<void(const base::Status& status,
+                             KeepAliveResponse* response)> KeepAliveCallback;
+
+  struct Options {
+    // KeepAlive 挂起时间的精度
+    int64_t tick_micros;
+    // 不小于客户端的 lease, 默认为 chubby_session_lease. 只有一个 leader
+    // 的测试中可以为 0
+    int64_t grace_micros;
+    base::Env* env;
+    // 为 false 时由调用者调用 AdvanceTo
+    bool start_thread;
+
+    Options();
+  };
+
+  explicit CacheTracker(const Options& options);
+  // 挂起的 KeepAlive 以 Cancelled 结束, 等待中的写入以 Aborted 结束
+  ~CacheTracker();
+
+  // 读取 key 之前调用, 之后提交的写入都会通知这个会话. key 有尚未完成的失效
+  // 时返回 false, 不登记, 读到的值不能缓存. 响应中同时带上 incarnation().
+  bool AddReader(const std::string& session_id, const std::string& key);
+  // 写 key 之前调用, 缓存者都确认之后调用 done. writer 的缓存由它自己维护.
+  // done 可能在本次调用中执行, 不在内部锁中调用.
+  void Invalidate(const std::string& key, const std::string& writer,
+                  InvalidateCallback done);
+
+  int64_t incarnation() const { return incarnation_; }
+
+  // 处理 request.acked_invalidation 的确认, 返回还没有确认的失效; 没有时最多
+  // 挂起 hold_micros. 同一个会话新的 KeepAlive 以空结果结束之前挂起的.
+  void KeepAlive(const KeepAliveRequest& request, int64_t hold_micros,
+                 KeepAliveCallback done);
+  // 会话结束 (关闭或者 lease 过期), 视为确认所有失效
+  void DropSession(const std::string& session_id);
+
+  size_t readers(const std::string& key) const;
+  // 等待确认的写入数
+  size_t pending_writes() const;
+  void AdvanceTo(uint64_t now_micros) { wheel_->AdvanceTo(now_micros); }
+
+ private:
+  struct Session {
+    // TimingWheel 中的 key
+    base::uint64 id;
+    std::set<std::string> keys;
+    // 还没有确认的失效: 序号 -> key
+    std::map<int64_t, std::string> pending;
+    // 挂起的 KeepAlive
+    KeepAliveCallback hold;
+  };
+  struct Write {
+    int waiting;
+    InvalidateCallback done;
+  };
+  struct Reply {
+    KeepAliveCallback done;
+    base::Status status;
+    KeepAliveResponse response;
+  };
+  typedef std::vector<Reply> Replies;
+  typedef std::vector<InvalidateCallback> Completions;
+
+  // grace 计时器在 TimingWheel 中的 key, 不与会话冲突
+  static const base::uint64 kGraceTimer = ~0ULL;
+
+  Session* DoGetSession(const std::string& session_id);
+  void DoAck(const std::string& session_id, Session* session, int64_t acked,
+             Completions* completions);
+  void DoReply(Session* session, const base::Status& status, Replies* replies);
+  void HandleTimeouts(std::vector<base::uint64>* ids);
+  static void Run(Replies* replies, Completions* completions);
+
+  const Options options_;
+  const int64_t incarnation_;
+
+  mutable base::mutex mu_;
+  base::uint64 next_session_id_;
+  int64_t next_seq_;
+  std::unordered_map<std::string, Session> sessions_;
+  std::unordered_map<base::uint64, std::string> session_ids_;
+  // key -> 缓存它的会话
+  std::unordered_map<std::string, std::set<std::string>> readers_;
+  // key -> 还没有确认它的失效的会话, 每个失效一项
+  std::unordered_map<std::string, std::multiset<std::string>> invalidating_;
+  std::unordered_map<int64_t, Write> writes_;
+  // grace 结束之前的写入
+  bool grace_over_;
+  std::vector<int64_t> grace_writes_;
+  // 最先析构: tick 线程退出之后才能释放上面的成员
+  std::unique_ptr<base::thread::TimingWheel> wheel_;
+
+  DISALLOW_COPY_AND_ASSIGN(CacheTracker);
+};
+
+} // namespace chubby
+} // namespace mpr
+#endif // MPR_CHUBBY_SERVER_CACHE_TRACKER_H_
@@ -0,0 +1,180 @@
+#include <gtest/gtest.h>
+
+#include "server/cache_tracker.h"
+#include "base/errors.h"
+#include "base/platform/env_test_util.h"
+
+namespace mpr {
+namespace chubby {
+
+namespace {
+
+class CacheTrackerTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    CacheTracker::Options options;
+    options.env = &env_;
+    options.grace_micros = 0;
+    options.start_thread = false;
+    tracker_.reset(new CacheTracker(options));
+  }
+
+  struct KeepAliveResult {
+    bool done = false;
+    base::Status status;
+    KeepAliveResponse response;
+  };
+
+  void KeepAlive(const std::string& session_id, int64_t acked,
+                 int64_t hold_ms, KeepAliveResult* result) {
+    KeepAliveRequest request;
+    request.set_session_id(session_id);
+    request.set_acked_invalidation(acked);
+    request.set_cache_incarnation(tracker_->incarnation());
+    *result = KeepAliveResult();
+    tracker_->KeepAlive(request, hold_ms * 1000,
+        [result](const base::Status& status, KeepAliveResponse* response) {
+          result->done = true;
+          result->status = status;
+          result->response.Swap(response);
+        });
+  }
+
+  CacheTracker::InvalidateCallback Done(int* completed) {
+    return [completed](const base::Status& status) {
+      EXPECT_TRUE(status.ok());
+      (*completed)++;
+    };
+  }
+
+  base::FakeClockEnv env_;
+  std::unique_ptr<CacheTracker> tracker_;
+};
+
+} // namespace
+
+TEST_F(CacheTrackerTest, WriteWaitsForAcks) {
+  EXPECT_TRUE(tracker_->AddReader("s1", "/a"));
+  EXPECT_TRUE(tracker_->AddReader("s2", "/a"));
+  EXPECT_TRUE(tracker_->AddReader("s3", "/a"));
+  int completed = 0;
+  // s3 是写入者, 不等待它
+  tracker_->Invalidate("/a", "s3", Done(&completed));
+  EXPECT_EQ(0, completed);
+  EXPECT_EQ(0u, tracker_->readers("/a"));
+  // 失效完成之前读到的值不能缓存
+  EXPECT_FALSE(tracker_->AddReader("s4", "/a"));
+
+  KeepAliveResult s1, s2;
+  KeepAlive("s1", 0, 0, &s1);
+  ASSERT_TRUE(s1.done);
+  ASSERT_EQ(1, s1.response.invalidations_size());
+  EXPECT_EQ("/a", s1.response.invalidations(0));
+  KeepAlive("s1", s1.response.invalidation_seq(), 0, &s1);
+  EXPECT_EQ(0, s1.response.invalidations_size());
+  EXPECT_EQ(0, completed);
+
+  KeepAlive("s2", 0, 0, &s2);
+  KeepAlive("s2", s2.response.invalidation_seq(), 0, &s2);
+  EXPECT_EQ(1, completed);
+  EXPECT_EQ(0u, tracker_->pending_writes());
+  EXPECT_TRUE(tracker_->AddReader("s4", "/a"));
+
+  // 没有缓存者时立即完成
+  tracker_->Invalidate("/b", "", Done(&completed));
+  EXPECT_EQ(2, completed);
+}
+
+TEST_F(CacheTrackerTest, HeldKeepAliveReturnsOnInvalidation) {
+  tracker_->AddReader("s1", "/a");
+  KeepAliveResult result;
+  KeepAlive("s1", 0, 1000, &result);
+  EXPECT_FALSE(result.done);
+  int completed = 0;
+  tracker_->Invalidate("/a", "", Done(&completed));
+  ASSERT_TRUE(result.done);
+  EXPECT_EQ(1, result.response.invalidations_size());
+
+  // 没有失效时挂起到超时
+  KeepAlive("s1", result.response.invalidation_seq(), 1000, &result);
+  EXPECT_EQ(1, completed);
+  EXPECT_FALSE(result.done);
+  env_.AdvanceMillis(1010);
+  tracker_->AdvanceTo(env_.NowMicros());
+  ASSERT_TRUE(result.done);
+  EXPECT_TRUE(result.status.ok());
+  EXPECT_EQ(0, result.response.invalidations_size());
+}
+
+TEST_F(CacheTrackerTest, OverlappingWritesWaitForStaleSessions) {
+  tracker_->AddReader("s1", "/a");
+  int first = 0, second = 0;
+  tracker_->Invalidate("/a", "", Done(&first));
+  // s1 还没有确认第一次失效, 可能仍在使用更早的值
+  tracker_->Invalidate("/a", "", Done(&second));
+  EXPECT_EQ(0, second);
+  KeepAliveResult result;
+  KeepAlive("s1", 0, 0, &result);
+  EXPECT_EQ(2, result.response.invalidations_size());
+  KeepAlive("s1", result.response.invalidation_seq(), 0, &result);
+  EXPECT_EQ(1, first);
+  EXPECT_EQ(1, second);
+}
+
+TEST_F(CacheTrackerTest, DropSessionCompletesWrites) {
+  tracker_->AddReader("s1", "/a");
+  tracker_->AddReader("s1", "/b");
+  KeepAliveResult result;
+  KeepAlive("s1", 0, 1000, &result);
+  int completed = 0;
+  tracker_->Invalidate("/a", "", Done(&completed));
+  EXPECT_TRUE(result.done);
+  KeepAlive("s1", 0, 1000, &result);
+  EXPECT_TRUE(result.done);
+
+  tracker_->DropSession("s1");
+  EXPECT_EQ(1, completed);
+  EXPECT_EQ(0u, tracker_->readers("/b"));
+  EXPECT_EQ(0u, tracker_->pending_writes());
+}
+
+TEST_F(CacheTrackerTest, NewIncarnation) {
+  tracker_->AddReader("s1", "/a");
+  int completed = 0;
+  tracker_->Invalidate("/a", "", Done(&completed));
+  EXPECT_NE(0, tracker_->incarnation());
+
+  // 其他 leader 上的确认序号不能确认这里的失效
+  KeepAliveRequest request;
+  request.set_session_id("s1");
+  request.set_acked_invalidation(100);
+  request.set_cache_incarnation(tracker_->incarnation() + 1);
+  KeepAliveResponse response;
+  tracker_->KeepAlive(request, 0,
+      [&response](const base::Status&, KeepAliveResponse* r) { response.Swap(r); });
+  EXPECT_EQ(0, completed);
+  EXPECT_EQ(tracker_->incarnation(), response.cache_incarnation());
+  EXPECT_EQ(1, response.invalidations_size());
+  KeepAliveResult result;
+  KeepAlive("s1", response.invalidation_seq(), 0, &result);
+  EXPECT_EQ(1, completed);
+
+  // 新 leader 在 grace 之内的写入等待之前的缓存者丢弃缓存
+  CacheTracker::Options options;
+  options.grace_micros = 1000 * 1000;
+  options.env = &env_;
+  options.start_thread = false;
+  CacheTracker next(options);
+  EXPECT_NE(tracker_->incarnation(), next.incarnation());
+  int after_grace = 0;
+  next.Invalidate("/a", "", Done(&after_grace));
+  EXPECT_EQ(1u, next.pending_writes());
+  env_.AdvanceMillis(1010);
+  next.AdvanceTo(env_.NowMicros());
+  EXPECT_EQ(1, after_grace);
+  next.Invalidate("/a", "", Done(&after_grace));
+  EXPECT_EQ(2, after_grace);
+}
+
+} // namespace chubby
+} // namespace mpr
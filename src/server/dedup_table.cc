@@ -0,0 +1,240 @@
+#include "server/dedup_table.h"
+
+#include <algorithm>
+
+#include "base/errors.h"
+#include "base/logging.h"
+#include "base/monitoring/monitoring.h"
+
+#include <gflags/gflags.h>
+
+DECLARE_int32(chubby_dedup_window);
+
+namespace mpr {
+namespace chubby {
+
+namespace {
+
+base::monitoring::Counter<>* hit_counter =
+    base::monitoring::Counter<>::New("chubby_dedup_hits",
+                                     "Retried writes answered without proposing");
+
+base::monitoring::Counter<>* skipped_counter =
+    base::monitoring::Counter<>::New("chubby_dedup_skipped_entries",
+                                     "Duplicate log entries skipped by apply");
+
+base::monitoring::Gauge<>* entries_gauge =
+    base::monitoring::Gauge<>::New("chubby_dedup_entries",
+                                   "Request results kept for retries");
+
+} // namespace
+
+DedupTable::Options::Options()
+  : window_entries(FLAGS_chubby_dedup_window) {}
+
+DedupTable::DedupTable(const Options& options)
+  : options_(options) {
+  DCHECK_GT(options_.window_entries, 0);
+}
+
+DedupTable::~DedupTable() {
+  std::vector<DoneCallback> aborted;
+  {
+    base::mutex_lock l(mu_);
+    for (auto& kv : in_flight_) {
+      for (auto& done : kv.second) {
+        aborted.push_back(std::move(done));
+      }
+    }
+    in_flight_.clear();
+  }
+  for (auto& done : aborted) {
+    done(base::errors::Cancelled("dedup table shutdown"), 0);
+  }
+}
+
+// static
+std::string DedupTable::Key(const std::string& session_id,
+                            const std::string& request_id) {
+  if (request_id.empty()) {
+    return std::string();
+  }
+  std::string key(session_id);
+  key.push_back('\0');
+  key.append(request_id);
+  return key;
+}
+
+void DedupTable::Rebuild(BinLogger* bin_logger, int64_t last_applied) {
+  int64_t recorded = 0;
+  for (int64_t index = std::max<int64_t>(0, last_applied - options_.window_entries + 1);
+       index <= last_applied; ++index) {
+    LogEntry log_entry;
+    if (!bin_logger->ReadSlot(index, &log_entry) || log_entry.dedup_key.empty()) {
+      continue;
+    }
+    if (Record(log_entry.dedup_key, index)) {
+      // 结果没有持久化, kPut/kDel 在 apply 时不会失败
+      const bool write = log_entry.log_operation == kPut ||
+                         log_entry.log_operation == kDel;
+      Finish(log_entry.dedup_key, index,
+             write ? base::Status::OK()
+                   : base::errors::Unknown("result lost after restart"));
+    }
+    recorded++;
+  }
+  Applied(last_applied);
+  LOG(INFO) << "[DedupTable] rebuilt " << recorded << " requests up to "
+            << last_applied;
+}
+
+// static
+base::Status DedupTable::ResultStatus(const Result& result) {
+  if (result.code == base::error::OK) {
+    return base::Status::OK();
+  }
+  return base::Status(result.code, "deduplicated request failed at index " +
+                                    std::to_string(result.index));
+}
+
+bool DedupTable::Begin(const std::string& key, DoneCallback done) {
+  Result result{0, false, base::error::OK};
+  {
+    base::mutex_lock l(mu_);
+    auto it = results_.find(key);
+    if (it == results_.end() || !it->second.back().finished) {
+      auto waiting = in_flight_.find(key);
+      if (waiting == in_flight_.end() && it == results_.end()) {
+        in_flight_[key];
+        return false;
+      }
+      // 原请求还在共识中或者正在 apply
+      in_flight_[key].push_back(std::move(done));
+      hit_counter->Increment();
+      return true;
+    }
+    result = it->second.back();
+  }
+  hit_counter->Increment();
+  done(ResultStatus(result), result.index);
+  return true;
+}
+
+void DedupTable::Abort(const std::string& key, const base::Status& status) {
+  std::vector<DoneCallback> waiters;
+  {
+    base::mutex_lock l(mu_);
+    auto it = in_flight_.find(key);
+    if (it == in_flight_.end()) {
+      return;
+    }
+    waiters.swap(it->second);
+    in_flight_.erase(it);
+  }
+  for (auto& done : waiters) {
+    done(status, 0);
+  }
+}
+
+void DedupTable::DoFinish(Result* result, base::error::Code code,
+                          std::vector<DoneCallback>* waiters,
+                          const std::string& key) {
+  result->finished = true;
+  result->code = code;
+  auto waiting = in_flight_.find(key);
+  if (waiting != in_flight_.end()) {
+    waiters->swap(waiting->second);
+    in_flight_.erase(waiting);
+  }
+}
+
+bool DedupTable::Record(const std::string& key, int64_t index) {
+  std::vector<DoneCallback> waiters;
+  Result result{index, false, base::error::OK};
+  bool duplicate;
+  {
+    base::mutex_lock l(mu_);
+    std::deque<Result>& seen = results_[key];
+    auto it = std::lower_bound(seen.begin(), seen.end(), index,
+                               [](const Result& r, int64_t i) { return r.index < i; });
+    // 窗口内更早的出现, apply 失败后重试同一段日志时结果不变
+    duplicate = it != seen.begin() && (it - 1)->index >= index - options_.window_entries;
+    if (it == seen.end()) {
+      it = seen.insert(it, Result{index, false, base::error::OK});
+      order_.emplace_back(index, key);
+      entries_gauge->Set(order_.size());
+    } else {
+      // 重试时 index 不小于 last_applied + 1, 第一次 apply 时已经记录过
+      DCHECK_EQ(it->index, index);
+    }
+    if (duplicate) {
+      // 换主前后同一个请求被提议了两次. apply 是顺序的, 更早的出现已经有结果
+      skipped_counter->Increment();
+      const Result& original = *(it - 1);
+      DoFinish(&*it, original.finished ? original.code : base::error::OK,
+               &waiters, key);
+      result = *it;
+    }
+  }
+  for (auto& done : waiters) {
+    done(ResultStatus(result), index);
+  }
+  return !duplicate;
+}
+
+void DedupTable::Finish(const std::string& key, int64_t index,
+                        const base::Status& status) {
+  std::vector<DoneCallback> waiters;
+  Result result{0, false, base::error::OK};
+  {
+    base::mutex_lock l(mu_);
+    auto it = results_.find(key);
+    if (it == results_.end()) {
+      return;
+    }
+    for (Result& r : it->second) {
+      if (r.index == index) {
+        DoFinish(&r, status.code(), &waiters, key);
+        result = r;
+        break;
+      }
+    }
+  }
+  for (auto& done : waiters) {
+    done(ResultStatus(result), index);
+  }
+}
+
+void DedupTable::Applied(int64_t last_applied) {
+  // 之后的日志 index 至少为 last_applied + 1, 比窗口更早的记录不会再用到
+  const int64_t oldest = last_applied + 1 - options_.window_entries;
+  base::mutex_lock l(mu_);
+  while (!order_.empty() && order_.front().first < oldest) {
+    auto it = results_.find(order_.front().second);
+    DCHECK(it != results_.end());
+    it->second.pop_front();
+    if (it->second.empty()) {
+      results_.erase(it);
+    }
+    order_.pop_front();
+  }
+  entries_gauge->Set(order_.size());
+}
+
+bool DedupTable::Lookup(const std::string& key, int64_t* index) {
+  base::mutex_lock l(mu_);
+  auto it = results_.find(key);
+  if (it == results_.end()) {
+    return false;
+  }
+  *index = it->second.back().index;
+  return true;
+}
+
+size_t DedupTable::size() const {
+  base::mutex_lock l(mu_);
+  return results_.size();
+}
+
+} // namespace chubby
+} // namespace mpr
@@ -0,0 +1,112 @@
+#ifndef MPR_CHUBBY_SERVER_DEDUP_TABLE_H_
+#define MPR_CHUBBY_SERVER_DEDUP_TABLE_H_
+
+#include <deque>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "base/macros.h"
+#include "base/status.h"
+#include "base/platform/mutex.h"
+#include "storage/bin_logger.h"
+
+namespace mpr {
+namespace chubby {
+
+// 写请求的去重表, 以 (会话, request_id) 为 key.
+//
+// leader 提议之前调用 Begin: 已经 apply 过的请求直接回复, 同一个请求还在共识中
+// 时等待它, 都不会再次进入日志. key 写在 Entry.dedup_key 中随日志复制, 每个副本
+// 的 apply 路径调用 Record, 所以换主后新 leader 上也有这张表.
+//
+// 是否跳过一条日志只取决于日志本身: index 为 i 的日志, 当同一个 key 在
+// [i - window_entries, i) 内出现过 (无论那一条是否被跳过) 时跳过. 表中只保存
+// 窗口内每个 key 出现的 index, 不依赖时钟和访问顺序, 所有副本对同一段日志做出
+// 相同的决定. 重启后用 Rebuild 从 binlog 恢复窗口内的记录, 日志回收需要在
+// last_applied 之前保留至少 window_entries 条. 客户端的重试需要在
+// window_entries 条日志之内到达, 更晚的重试会再次 apply.
+//
+// 每次出现还记录 apply 的结果 (只保存错误码), 重试得到原请求的结果而不总是
+// OK. Rebuild 时结果已经丢失: kPut/kDel 在 apply 时不会失败, 记为 OK, 其他
+// 操作记为 Unknown.
+//
+// request_id 需要在会话的每个化身中唯一 (ChubbyClient 带随机前缀), 否则重启
+// 后的新请求会被当成窗口内的重试.
+class DedupTable {
+ public:
+  // 请求的日志 apply 或者被跳过后以原请求的结果和这条日志的 index 调用, apply
+  // 到这个 index 时原请求已经生效; 原请求没有进入日志时以 Abort 的 status 调用
+  typedef std::function<void(const base::Status& status, int64_t index)> DoneCallback;
+
+  struct Options {
+    int64_t window_entries;
+
+    Options();
+  };
+
+  explicit DedupTable(const Options& options);
+  // 等待中的重试以 Cancelled 结束
+  ~DedupTable();
+
+  // request_id 为空时返回空串, 表示不去重
+  static std::string Key(const std::string& session_id,
+                         const std::string& request_id);
+
+  // 启动时调用, 重新记录 (last_applied - window_entries, last_applied] 内带
+  // dedup_key 的日志. 读不到的日志 (已经回收) 跳过.
+  void Rebuild(BinLogger* bin_logger, int64_t last_applied);
+
+  // 返回 true 表示不需要提议, done 立即 (已经 apply) 或者在原请求 apply 后调用.
+  // 返回 false 时 key 记为进行中, done 不会被调用, 调用者把 key 填入
+  // Entry.dedup_key 后提议, 提议失败时调用 Abort.
+  bool Begin(const std::string& key, DoneCallback done);
+  void Abort(const std::string& key, const base::Status& status);
+
+  // apply 路径调用, 可以作为 ApplyPipeline 的 dedup_callback. 返回 false 表示
+  // 同一个请求在窗口内更早的 index 出现过, 这条日志应当跳过, 等待的重试得到
+  // 原请求的结果. 对同一个 index 重复调用 (apply 失败后重试) 返回相同的结果.
+  bool Record(const std::string& key, int64_t index);
+  // Record 返回 true 的日志 apply 之后调用, 可以作为 ApplyPipeline 的
+  // result_callback. 保存结果并回复等待的重试.
+  void Finish(const std::string& key, int64_t index, const base::Status& status);
+
+  // apply 到 last_applied 后调用, 例如在 ApplyPipeline 的 applied_callback 中.
+  // 只回收内存, 不影响 Record 的结果: 失败重试时 apply 从 last_applied 之后
+  // 开始, 需要的记录都还在.
+  void Applied(int64_t last_applied);
+
+  // 窗口内出现过时返回 true, index 为最近一次出现的位置
+  bool Lookup(const std::string& key, int64_t* index);
+  size_t size() const;
+
+ private:
+  struct Result {
+    int64_t index;
+    // Finish 之前为 false
+    bool finished;
+    base::error::Code code;
+  };
+
+  static base::Status ResultStatus(const Result& result);
+  void DoFinish(Result* result, base::error::Code code,
+                std::vector<DoneCallback>* waiters, const std::string& key);
+
+  const Options options_;
+
+  mutable base::mutex mu_;
+  // 每个 key 在窗口内出现的 index 和结果, index 递增
+  std::unordered_map<std::string, std::deque<Result>> results_;
+  // 按 index 排列, 用于回收
+  std::deque<std::pair<int64_t, std::string>> order_;
+  // 进行中的请求和等待它的重试
+  std::unordered_map<std::string, std::vector<DoneCallback>> in_flight_;
+
+  DISALLOW_COPY_AND_ASSIGN(DedupTable);
+};
+
+} // namespace chubby
+} // namespace mpr
+#endif // MPR_CHUBBY_SERVER_DEDUP_TABLE_H_
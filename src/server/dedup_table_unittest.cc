@@ -0,0 +1,168 @@
+#include <gtest/gtest.h>
+
+#include "server/dedup_table.h"
+#include "base/errors.h"
+#include "base/platform/env.h"
+
+namespace mpr {
+namespace chubby {
+
+namespace {
+
+struct Reply {
+  int calls = 0;
+  base::Status status;
+  int64_t index = -1;
+};
+
+DedupTable::DoneCallback Done(Reply* reply) {
+  return [reply](const base::Status& status, int64_t index) {
+    reply->calls++;
+    reply->status = status;
+    reply->index = index;
+  };
+}
+
+DedupTable::Options TestOptions(int64_t window_entries) {
+  DedupTable::Options options;
+  options.window_entries = window_entries;
+  return options;
+}
+
+} // namespace
+
+TEST(DedupTable, RetriesAnsweredFromMemory) {
+  DedupTable table(TestOptions(100));
+  EXPECT_EQ("", DedupTable::Key("s1", ""));
+  const std::string key = DedupTable::Key("s1", "1");
+  Reply first, retry, late;
+  // 第一次需要提议
+  EXPECT_FALSE(table.Begin(key, Done(&first)));
+  // 还在共识中的重试等待原请求
+  EXPECT_TRUE(table.Begin(key, Done(&retry)));
+  EXPECT_EQ(0, retry.calls);
+
+  EXPECT_TRUE(table.Record(key, 7));
+  // apply 完成之前继续等待
+  EXPECT_EQ(0, retry.calls);
+  Reply applying;
+  EXPECT_TRUE(table.Begin(key, Done(&applying)));
+  EXPECT_EQ(0, applying.calls);
+  table.Finish(key, 7, base::Status::OK());
+  EXPECT_EQ(0, first.calls);
+  EXPECT_EQ(1, retry.calls);
+  EXPECT_TRUE(retry.status.ok());
+  EXPECT_EQ(7, retry.index);
+  EXPECT_EQ(1, applying.calls);
+
+  // apply 之后的重试立即回复
+  EXPECT_TRUE(table.Begin(key, Done(&late)));
+  EXPECT_EQ(1, late.calls);
+  EXPECT_EQ(7, late.index);
+
+  // 同一段日志重新 apply 不是重复, 其他 index 上的同一个请求是重复
+  EXPECT_TRUE(table.Record(key, 7));
+  EXPECT_FALSE(table.Record(key, 9));
+}
+
+TEST(DedupTable, RetriesGetOriginalResult) {
+  DedupTable table(TestOptions(100));
+  const std::string key = DedupTable::Key("s1", "1");
+  Reply first, retry, late, duplicate;
+  EXPECT_FALSE(table.Begin(key, Done(&first)));
+  EXPECT_TRUE(table.Begin(key, Done(&retry)));
+  EXPECT_TRUE(table.Record(key, 3));
+  table.Finish(key, 3, base::errors::FailedPrecondition("lock held"));
+  EXPECT_TRUE(base::errors::IsFailedPrecondition(retry.status));
+  EXPECT_TRUE(table.Begin(key, Done(&late)));
+  EXPECT_TRUE(base::errors::IsFailedPrecondition(late.status));
+  EXPECT_EQ(3, late.index);
+
+  // 换主后重复进入日志的请求被跳过, 之后的重试同样得到原请求的结果
+  EXPECT_FALSE(table.Record(key, 5));
+  EXPECT_TRUE(table.Begin(key, Done(&duplicate)));
+  EXPECT_TRUE(base::errors::IsFailedPrecondition(duplicate.status));
+  EXPECT_EQ(5, duplicate.index);
+}
+
+TEST(DedupTable, AbortWakesRetries) {
+  DedupTable table(TestOptions(100));
+  const std::string key = DedupTable::Key("s1", "1");
+  Reply first, retry;
+  EXPECT_FALSE(table.Begin(key, Done(&first)));
+  EXPECT_TRUE(table.Begin(key, Done(&retry)));
+  table.Abort(key, base::errors::Unavailable("not leader"));
+  EXPECT_TRUE(base::errors::IsUnavailable(retry.status));
+  // 没有进入日志, 下一次重试重新提议
+  EXPECT_FALSE(table.Begin(key, Done(&first)));
+  EXPECT_EQ(0, first.calls);
+}
+
+TEST(DedupTable, WindowInLogIndexes) {
+  DedupTable table(TestOptions(3));
+  const std::string a = DedupTable::Key("s1", "a");
+  const std::string b = DedupTable::Key("s1", "b");
+  EXPECT_TRUE(table.Record(a, 0));
+  EXPECT_FALSE(table.Record(a, 3));
+  EXPECT_TRUE(table.Record(b, 4));
+  // 距离上一次出现超过窗口的重试再次 apply
+  EXPECT_TRUE(table.Record(a, 7));
+  // apply 失败后重试得到相同的结果
+  EXPECT_FALSE(table.Record(a, 3));
+  EXPECT_TRUE(table.Record(a, 7));
+
+  // 回收只释放之后的日志用不到的记录
+  table.Applied(4);
+  EXPECT_EQ(2u, table.size());
+  table.Applied(7);
+  EXPECT_EQ(1u, table.size());
+  int64_t index;
+  EXPECT_FALSE(table.Lookup(b, &index));
+  EXPECT_TRUE(table.Lookup(a, &index));
+  EXPECT_EQ(7, index);
+}
+
+TEST(DedupTable, RebuildFromLog) {
+  const std::string path = "/tmp/dedup_table_test";
+  base::int64 undeleted_files, undeleted_dirs;
+  base::Env::Default()->DeleteDirectoryRecursively(path, &undeleted_files,
+                                                   &undeleted_dirs);
+  BinLogger bin_logger{BinLogger::Options(path)};
+  const std::vector<std::string> keys = {
+      "a", "", "b", "a", "c", "", "b", "d", "c", "a"};
+  for (const std::string& id : keys) {
+    LogEntry log_entry;
+    log_entry.log_operation = kPut;
+    log_entry.term = 1;
+    log_entry.dedup_key = DedupTable::Key("s1", id);
+    bin_logger.AppendEntry(log_entry);
+  }
+
+  // 一直运行的副本和在 index 5 重启的副本对之后的日志做出相同的决定
+  DedupTable running(TestOptions(4));
+  std::vector<bool> expected;
+  for (int64_t i = 0; i < static_cast<int64_t>(keys.size()); ++i) {
+    if (!keys[i].empty()) {
+      expected.push_back(running.Record(DedupTable::Key("s1", keys[i]), i));
+    }
+    running.Applied(i);
+  }
+  EXPECT_EQ(std::vector<bool>({true, true, false, true, false, true, false, true}),
+            expected);
+
+  DedupTable restarted(TestOptions(4));
+  restarted.Rebuild(&bin_logger, 5);
+  // 重启后 kPut 的结果记为 OK
+  Reply rebuilt;
+  EXPECT_TRUE(restarted.Begin(DedupTable::Key("s1", "c"), Done(&rebuilt)));
+  EXPECT_TRUE(rebuilt.status.ok());
+  std::vector<bool> replayed;
+  for (int64_t i = 6; i < static_cast<int64_t>(keys.size()); ++i) {
+    replayed.push_back(restarted.Record(DedupTable::Key("s1", keys[i]), i));
+  }
+  EXPECT_EQ(std::vector<bool>(expected.end() - replayed.size(), expected.end()),
+            replayed);
+}
+
+} // namespace chubby
+} // namespace mpr
@@ -0,0 +1,50 @@
+#include "server/election_timer.h"
+
+#include <algorithm>
+
+#include <gflags/gflags.h>
+
+DECLARE_int32(chubby_election_timeout_min);
+DECLARE_int32(chubby_election_timeout_max);
+DECLARE_int32(chubby_heartbeat_max_interval);
+
+namespace mpr {
+namespace chubby {
+
+namespace {
+
+// 超时与心跳间隔的比例, 连续丢失几个心跳才认为 leader 故障
+const int64_t kElectionHeartbeatMultiple = 4;
+
+} // namespace
+
+ElectionTimer::Options::Options()
+  : min_timeout_micros(static_cast<int64_t>(FLAGS_chubby_election_timeout_min) * 1000),
+    max_timeout_micros(static_cast<int64_t>(FLAGS_chubby_election_timeout_max) * 1000),
+    heartbeat_interval_micros(
+        static_cast<int64_t>(FLAGS_chubby_heartbeat_max_interval) * 1000),
+    seed(0) {}
+
+ElectionTimer::ElectionTimer(const Options& options)
+  : options_(options),
+    philox_(options.seed),
+    random_(&philox_),
+    timeout_micros_(0),
+    last_reset_micros_(0),
+    deadline_micros_(0) {
+  Reset(0, options_.heartbeat_interval_micros);
+}
+
+void ElectionTimer::Reset(uint64_t now_micros, int64_t heartbeat_interval_micros) {
+  if (heartbeat_interval_micros > 0) {
+    timeout_micros_ = std::min(heartbeat_interval_micros * kElectionHeartbeatMultiple,
+                               options_.max_timeout_micros);
+    timeout_micros_ = std::max(timeout_micros_, options_.min_timeout_micros);
+  }
+  last_reset_micros_ = now_micros;
+  deadline_micros_ = now_micros + timeout_micros_ +
+                     random_.Uniform64(static_cast<uint64_t>(timeout_micros_));
+}
+
+} // namespace chubby
+} // namespace mpr
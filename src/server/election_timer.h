@@ -0,0 +1,61 @@
+#ifndef MPR_CHUBBY_SERVER_ELECTION_TIMER_H_
+#define MPR_CHUBBY_SERVER_ELECTION_TIMER_H_
+
+#include "base/macros.h"
+#include "base/random/philox_random.h"
+#include "base/random/simple_philox.h"
+
+namespace mpr {
+namespace chubby {
+
+// follower 的选举超时.
+//
+// leader 在每个请求中带上它给本节点的心跳间隔 (随 RTT 调整), 超时取其
+// kElectionHeartbeatMultiple 倍, 限制在 [min, max] 之间, 每次重置时在
+// [T, 2T) 之间随机, 避免多个节点同时发起选举. 低延迟链路上几个心跳间隔
+// 即可发现 leader 故障, 高延迟链路上也不会因为正常的延迟误判.
+//
+// 非线程安全, 由调用者加锁.
+class ElectionTimer {
+ public:
+  struct Options {
+    int64_t min_timeout_micros;
+    int64_t max_timeout_micros;
+    // 还没有收到 leader 的心跳间隔时使用
+    int64_t heartbeat_interval_micros;
+    // 同样的 seed 得到同样的超时序列
+    uint64_t seed;
+
+    Options();
+  };
+
+  explicit ElectionTimer(const Options& options);
+
+  // 收到当前 leader 的请求或投出选票时调用. heartbeat_interval_micros 为 0
+  // 时沿用上一次的间隔.
+  void Reset(uint64_t now_micros, int64_t heartbeat_interval_micros = 0);
+
+  bool Expired(uint64_t now_micros) const { return now_micros >= deadline_micros_; }
+  // 距离上次重置不到 T, 即最近还收到过 leader 的请求
+  bool Recent(uint64_t now_micros) const {
+    return now_micros < last_reset_micros_ + timeout_micros_;
+  }
+
+  uint64_t deadline_micros() const { return deadline_micros_; }
+  // 随机化之前的超时 T
+  int64_t timeout_micros() const { return timeout_micros_; }
+
+ private:
+  const Options options_;
+  base::random::PhiloxRandom philox_;
+  base::random::SimplePhilox random_;
+  int64_t timeout_micros_;
+  uint64_t last_reset_micros_;
+  uint64_t deadline_micros_;
+
+  DISALLOW_COPY_AND_ASSIGN(ElectionTimer);
+};
+
+} // namespace chubby
+} // namespace mpr
+#endif // MPR_CHUBBY_SERVER_ELECTION_TIMER_H_
@@ -0,0 +1,65 @@
+#include <gtest/gtest.h>
+
+#include "server/election_timer.h"
+
+namespace mpr {
+namespace chubby {
+
+namespace {
+
+ElectionTimer::Options TestOptions(uint64_t seed) {
+  ElectionTimer::Options options;
+  options.min_timeout_micros = 150000;
+  options.max_timeout_micros = 3000000;
+  options.heartbeat_interval_micros = 300000;
+  options.seed = seed;
+  return options;
+}
+
+} // namespace
+
+TEST(ElectionTimer, FollowsHeartbeatInterval) {
+  ElectionTimer timer(TestOptions(1));
+  // 还没有 leader 时使用默认的心跳间隔
+  EXPECT_EQ(1200000, timer.timeout_micros());
+
+  timer.Reset(1000000, 50000);
+  EXPECT_EQ(200000, timer.timeout_micros());
+  EXPECT_FALSE(timer.Expired(1199999));
+  EXPECT_TRUE(timer.Expired(1400000));
+  EXPECT_TRUE(timer.Recent(1199999));
+  EXPECT_FALSE(timer.Recent(1200000));
+
+  // 沿用上一次的间隔
+  timer.Reset(2000000);
+  EXPECT_EQ(200000, timer.timeout_micros());
+
+  // 限制在 [min, max] 之间
+  timer.Reset(3000000, 10000);
+  EXPECT_EQ(150000, timer.timeout_micros());
+  timer.Reset(3000000, 10000000);
+  EXPECT_EQ(3000000, timer.timeout_micros());
+}
+
+TEST(ElectionTimer, Randomized) {
+  ElectionTimer a(TestOptions(1));
+  ElectionTimer b(TestOptions(2));
+  ElectionTimer c(TestOptions(1));
+  int differ = 0;
+  for (int i = 0; i < 100; ++i) {
+    a.Reset(0, 50000);
+    b.Reset(0, 50000);
+    c.Reset(0, 50000);
+    EXPECT_GE(a.deadline_micros(), 200000u);
+    EXPECT_LT(a.deadline_micros(), 400000u);
+    // 同样的 seed 得到同样的序列
+    EXPECT_EQ(a.deadline_micros(), c.deadline_micros());
+    if (a.deadline_micros() != b.deadline_micros()) {
+      differ++;
+    }
+  }
+  EXPECT_GT(differ, 90);
+}
+
+} // namespace chubby
+} // namespace mpr
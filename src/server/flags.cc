@@ -4,3 +4,59 @@ DEFINE_bool(chubby_data_compress, true, "enable snappy compression on leveldb st
 DEFINE_int32(chubby_data_block_size, 4, "for data, leveldb block_size, KB");
 DEFINE_int32(chubby_data_write_buffer_size, 4, "for data, leveldb write_buffer_size, MB");
 
+
+// replication
+DEFINE_int32(chubby_replication_window, 8, "max outstanding AppendEntries per follower");
+DEFINE_int32(chubby_replication_batch_entries, 512, "max entries per AppendEntries");
+DEFINE_int32(chubby_replication_batch_size, 4, "max bytes of entries per AppendEntries, MB");
+DEFINE_int32(chubby_heartbeat_min_interval, 50, "heartbeat interval on low-latency links, ms");
+DEFINE_int32(chubby_heartbeat_max_interval, 300, "heartbeat interval cap for high-latency links, ms");
+
+// flow control
+DEFINE_int32(chubby_busy_apply_lag, 100000, "follower reports busy above this many unapplied entries");
+DEFINE_int32(chubby_busy_pending_size, 64, "follower reports busy above this size of unapplied entries, MB");
+
+// election
+DEFINE_int32(chubby_election_timeout_min, 150, "lower bound of the randomized election timeout, ms");
+DEFINE_int32(chubby_election_timeout_max, 3000, "upper bound of the randomized election timeout, ms");
+DEFINE_bool(chubby_pre_vote, true, "check that a majority would vote before bumping the term");
+DEFINE_int32(chubby_transfer_leader_timeout, 1000, "give up a leadership transfer after this long, ms");
+
+// sessions
+DEFINE_int32(chubby_session_lease, 12000, "session lease renewed by KeepAlive, ms");
+DEFINE_int32(chubby_session_tick, 10, "granularity of session expiry, ms");
+DEFINE_int32(chubby_keepalive_batch_delay, 20, "max time a forwarded KeepAlive waits for its batch, ms");
+DEFINE_int32(chubby_keepalive_batch_sessions, 10000, "max sessions of a forwarded KeepAlive batch");
+
+// locks
+DEFINE_int32(chubby_lock_stripes, 64, "hash stripes of the in-memory lock table");
+DEFINE_int32(chubby_lock_grant_timeout, 1000, "a woken lock waiter must acquire within this long, ms");
+
+// watches
+DEFINE_int32(chubby_watch_queue_limit, 1000, "max pending keys per watch before it overflows");
+DEFINE_int32(chubby_watch_history, 10000, "recent changes kept for resuming watches");
+
+// proxy
+DEFINE_int32(chubby_proxy_upstream_sessions, 4, "sessions a proxy opens to the cell");
+DEFINE_int32(chubby_proxy_keepalive_interval, 50, "interval between rounds of proxy upstream KeepAlives, ms");
+DEFINE_int32(chubby_proxy_cache_entries, 100000, "max cached keys of each proxy upstream session");
+
+// users
+DEFINE_int32(chubby_session_token_ttl, 3600, "lifetime of signed session tokens, s");
+
+// retries
+DEFINE_int32(chubby_dedup_window, 1000000, "a retried write is applied once if it reaches the log within this many entries of the original");
+
+// proposal batching
+DEFINE_int32(chubby_proposal_batch_delay, 500, "max time a proposal waits for its batch, us");
+DEFINE_int32(chubby_proposal_batch_size, 1024, "max bytes of a proposal batch, KB");
+DEFINE_int32(chubby_proposal_batch_entries, 1024, "max entries of a proposal batch");
+
+// linearizable reads
+DEFINE_bool(chubby_lease_read, false, "serve reads under leader lease without a heartbeat round");
+DEFINE_int32(chubby_leader_lease, 800, "leader lease, ms; must be shorter than the min election timeout");
+
+// apply
+DEFINE_int32(chubby_apply_batch_entries, 4096, "max committed entries applied in one round");
+DEFINE_int32(chubby_apply_batch_size, 4, "max bytes of a leveldb WriteBatch built by apply, MB");
+DEFINE_string(chubby_ingest_dir, "", "shared storage every replica reads bulk-load tables from; kIngest names tables relative to it");
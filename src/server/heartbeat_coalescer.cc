@@ -0,0 +1,133 @@
+#include "server/heartbeat_coalescer.h"
+
+#include "base/errors.h"
+#include "base/logging.h"
+
+namespace mpr {
+namespace chubby {
+
+class HeartbeatCoalescer::GroupPeer : public PeerClient {
+ public:
+  GroupPeer(HeartbeatCoalescer* coalescer, int32_t group_id)
+    : coalescer_(coalescer), group_id_(group_id) {
+    AppendEntriesRequest group;
+    group.set_group_id(group_id);
+    group.SerializeToString(&group_field_);
+  }
+
+  const std::string& peer_id() const override {
+    return coalescer_->client_->peer_id();
+  }
+
+  void AppendEntries(const AppendEntriesRequest& request,
+                     AppendEntriesCallback done) override {
+    if (request.entries_size() == 0) {
+      coalescer_->Enqueue(group_id_, request, std::move(done));
+      return;
+    }
+    AppendEntriesRequest group_request = request;
+    group_request.set_group_id(group_id_);
+    coalescer_->client_->AppendEntries(group_request, std::move(done));
+  }
+
+  void RequestVote(const VoteRequest& request, VoteCallback done) override {
+    VoteRequest group_request = request;
+    group_request.set_group_id(group_id_);
+    coalescer_->client_->RequestVote(group_request, std::move(done));
+  }
+
+  void TimeoutNow(const TimeoutNowRequest& request,
+                  TimeoutNowCallback done) override {
+    TimeoutNowRequest group_request = request;
+    group_request.set_group_id(group_id_);
+    coalescer_->client_->TimeoutNow(group_request, std::move(done));
+  }
+
+  void SendAppendEntries(const std::string& header,
+                         const scoped_refptr<EncodedEntries>& entries,
+                         AppendEntriesCallback done) override {
+    if (!entries) {
+      PeerClient::SendAppendEntries(header, entries, std::move(done));
+      return;
+    }
+    // 在 header 后追加 group_id 字段, 共享的 entries 保持不变
+    coalescer_->client_->SendAppendEntries(header + group_field_, entries,
+                                           std::move(done));
+  }
+
+ private:
+  HeartbeatCoalescer* coalescer_;
+  const int32_t group_id_;
+  std::string group_field_;
+
+  DISALLOW_COPY_AND_ASSIGN(GroupPeer);
+};
+
+HeartbeatCoalescer::HeartbeatCoalescer(const std::string& leader_id,
+                                       NodeClient* client)
+  : leader_id_(leader_id),
+    client_(client) {
+  DCHECK(client_ != nullptr);
+}
+
+HeartbeatCoalescer::~HeartbeatCoalescer() {}
+
+PeerClient* HeartbeatCoalescer::ForGroup(int32_t group_id) {
+  base::mutex_lock l(mu_);
+  std::unique_ptr<GroupPeer>& peer = groups_[group_id];
+  if (!peer) {
+    peer.reset(new GroupPeer(this, group_id));
+  }
+  return peer.get();
+}
+
+void HeartbeatCoalescer::Enqueue(int32_t group_id,
+                                 const AppendEntriesRequest& request,
+                                 PeerClient::AppendEntriesCallback done) {
+  base::mutex_lock l(mu_);
+  // 只保留 term 和 commit_index, leader_commit_index 已被 Replicator 限制在
+  // match_index 之内
+  GroupHeartbeat* heartbeat = pending_.add_heartbeats();
+  heartbeat->set_group_id(group_id);
+  heartbeat->set_term(request.term());
+  heartbeat->set_commit_index(request.leader_commit_index());
+  heartbeat->set_heartbeat_interval_micros(request.heartbeat_interval_micros());
+  callbacks_.push_back(std::move(done));
+}
+
+void HeartbeatCoalescer::Flush() {
+  CoalescedHeartbeatRequest request;
+  std::shared_ptr<std::vector<PeerClient::AppendEntriesCallback>> callbacks(
+      new std::vector<PeerClient::AppendEntriesCallback>());
+  {
+    base::mutex_lock l(mu_);
+    if (callbacks_.empty()) {
+      return;
+    }
+    request.Swap(&pending_);
+    callbacks->swap(callbacks_);
+  }
+  request.set_leader_id(leader_id_);
+  VLOG(1) << "[HeartbeatCoalescer] " << request.heartbeats_size()
+          << " heartbeats to " << client_->peer_id();
+  client_->Heartbeat(request,
+      [callbacks](const base::Status& status,
+                  const CoalescedHeartbeatResponse& response) {
+        base::Status result = status;
+        if (result.ok() &&
+            response.responses_size() != static_cast<int>(callbacks->size())) {
+          result = base::errors::Internal("heartbeat response size mismatch");
+        }
+        AppendEntriesResponse group_response;
+        for (size_t i = 0; i < callbacks->size(); ++i) {
+          if (result.ok()) {
+            group_response.set_current_term(response.responses(i).current_term());
+            group_response.set_success(response.responses(i).success());
+          }
+          (*callbacks)[i](result, group_response);
+        }
+      });
+}
+
+} // namespace chubby
+} // namespace mpr
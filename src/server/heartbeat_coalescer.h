@@ -0,0 +1,68 @@
+#ifndef MPR_CHUBBY_SERVER_HEARTBEAT_COALESCER_H_
+#define MPR_CHUBBY_SERVER_HEARTBEAT_COALESCER_H_
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base/macros.h"
+#include "base/platform/mutex.h"
+#include "proto/service.pb.h"
+#include "server/peer_client.h"
+
+namespace mpr {
+namespace chubby {
+
+// 到另一个节点的 RPC 通道, 该节点上所有共识组共用. AppendEntries 的请求中
+// 带有 group_id.
+class NodeClient : public PeerClient {
+ public:
+  typedef std::function<void(const base::Status&,
+                             const CoalescedHeartbeatResponse&)> HeartbeatCallback;
+
+  virtual void Heartbeat(const CoalescedHeartbeatRequest& request,
+                         HeartbeatCallback done) = 0;
+};
+
+// 合并发往同一节点的心跳.
+//
+// 每个共识组的 Replicator 通过 ForGroup 得到的 PeerClient 发送请求: 带日志的
+// AppendEntries 加上 group_id 后直接发出, 空的 AppendEntries (心跳) 先排队,
+// Flush 时合并为一个 CoalescedHeartbeatRequest, 每个组只带 group_id, term 和
+// commit_index. 节点上的组越多, 省下的 RPC 越多.
+class HeartbeatCoalescer {
+ public:
+  // client 由调用者持有, 生命周期需要长于 HeartbeatCoalescer.
+  HeartbeatCoalescer(const std::string& leader_id, NodeClient* client);
+  ~HeartbeatCoalescer();
+
+  // 返回的 PeerClient 由 HeartbeatCoalescer 持有
+  PeerClient* ForGroup(int32_t group_id);
+
+  // 发出排队的心跳, 没有心跳时什么也不做
+  void Flush();
+
+  const std::string& node_id() const { return client_->peer_id(); }
+
+ private:
+  class GroupPeer;
+
+  void Enqueue(int32_t group_id, const AppendEntriesRequest& request,
+               PeerClient::AppendEntriesCallback done);
+
+  const std::string leader_id_;
+  NodeClient* client_;
+
+  base::mutex mu_;
+  std::map<int32_t, std::unique_ptr<GroupPeer>> groups_;
+  CoalescedHeartbeatRequest pending_;
+  std::vector<PeerClient::AppendEntriesCallback> callbacks_;
+
+  DISALLOW_COPY_AND_ASSIGN(HeartbeatCoalescer);
+};
+
+} // namespace chubby
+} // namespace mpr
+#endif // MPR_CHUBBY_SERVER_HEARTBEAT_COALESCER_H_
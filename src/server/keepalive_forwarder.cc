@@ -0,0 +1,189 @@
+#include "server/keepalive_forwarder.h"
+
+#include <iterator>
+
+#include "base/errors.h"
+#include "base/logging.h"
+#include "base/monitoring/monitoring.h"
+
+#include <gflags/gflags.h>
+
+DECLARE_int32(chubby_keepalive_batch_delay);
+DECLARE_int32(chubby_keepalive_batch_sessions);
+
+namespace mpr {
+namespace chubby {
+
+namespace {
+
+base::monitoring::Counter<>* forwarded_counter =
+    base::monitoring::Counter<>::New("chubby_forwarded_keepalives",
+                                     "Session renewals forwarded to the leader");
+
+base::monitoring::Counter<>* batch_counter =
+    base::monitoring::Counter<>::New("chubby_keepalive_batches",
+                                     "KeepAliveBatch requests sent to the leader");
+
+} // namespace
+
+KeepAliveForwarder::Options::Options()
+  : max_delay_micros(FLAGS_chubby_keepalive_batch_delay * 1000LL),
+    max_batch_sessions(FLAGS_chubby_keepalive_batch_sessions),
+    env(base::Env::Default()) {}
+
+KeepAliveForwarder::KeepAliveForwarder(const Options& options, SendCallback send)
+  : options_(options),
+    send_(std::move(send)),
+    stopping_(false),
+    first_pending_micros_(0) {
+  DCHECK(send_);
+  if (options_.max_delay_micros > 0) {
+    thread_.reset(options_.env->StartThread(base::ThreadOptions(),
+                                            "keepalive_forwarder",
+                                            [this]() { FlushLoop(); }));
+  }
+}
+
+KeepAliveForwarder::~KeepAliveForwarder() {
+  std::vector<Pending> pending;
+  {
+    base::mutex_lock l(mu_);
+    stopping_ = true;
+    cv_.notify_all();
+  }
+  thread_.reset(nullptr);
+  {
+    base::mutex_lock l(mu_);
+    pending.swap(pending_);
+    pending_index_.clear();
+  }
+  const base::Status status = base::errors::Cancelled("keepalive forwarder shutdown");
+  for (auto& session : pending) {
+    for (auto& done : session.dones) {
+      done(status, KeepAliveResponse());
+    }
+  }
+}
+
+void KeepAliveForwarder::KeepAlive(const KeepAliveRequest& request,
+                                   DoneCallback done) {
+  base::mutex_lock l(mu_);
+  auto it = pending_index_.find(request.session_id());
+  if (it != pending_index_.end()) {
+    // 后一次续约带的锁是客户端最新的视图
+    Pending& pending = pending_[it->second];
+    pending.request = request;
+    pending.dones.push_back(std::move(done));
+    return;
+  }
+  if (pending_.empty()) {
+    first_pending_micros_ = options_.env->NowMicros();
+  }
+  pending_index_[request.session_id()] = pending_.size();
+  pending_.push_back(Pending());
+  pending_.back().request = request;
+  pending_.back().dones.push_back(std::move(done));
+
+  if (options_.max_delay_micros <= 0) {
+    DoFlush(&l);
+  } else if (pending_.size() == 1 ||
+             pending_.size() >= static_cast<size_t>(options_.max_batch_sessions)) {
+    cv_.notify_all();
+  }
+}
+
+void KeepAliveForwarder::Flush() {
+  base::mutex_lock l(mu_);
+  DoFlush(&l);
+}
+
+size_t KeepAliveForwarder::pending() const {
+  base::mutex_lock l(mu_);
+  return pending_.size();
+}
+
+void KeepAliveForwarder::FlushLoop() {
+  base::mutex_lock l(mu_);
+  while (!stopping_) {
+    if (pending_.empty()) {
+      cv_.wait(l);
+      continue;
+    }
+    if (pending_.size() < static_cast<size_t>(options_.max_batch_sessions)) {
+      uint64_t deadline = first_pending_micros_ + options_.max_delay_micros;
+      uint64_t now = options_.env->NowMicros();
+      if (deadline > now) {
+        cv_.wait_for(l, std::chrono::microseconds(deadline - now));
+        continue;
+      }
+    }
+    DoFlush(&l);
+  }
+}
+
+void KeepAliveForwarder::DoFlush(base::mutex_lock* l) {
+  // 续约之间没有顺序要求, 多个线程可以同时发送各自取走的批次
+  while (!pending_.empty()) {
+    std::vector<Pending> batch;
+    if (pending_.size() <= static_cast<size_t>(options_.max_batch_sessions)) {
+      batch.swap(pending_);
+      pending_index_.clear();
+    } else {
+      auto end = pending_.begin() + options_.max_batch_sessions;
+      batch.assign(std::make_move_iterator(pending_.begin()),
+                   std::make_move_iterator(end));
+      pending_.erase(pending_.begin(), end);
+      pending_index_.clear();
+      for (size_t i = 0; i < pending_.size(); ++i) {
+        pending_index_[pending_[i].request.session_id()] = i;
+      }
+    }
+    first_pending_micros_ = options_.env->NowMicros();
+    l->unlock();
+    Send(&batch);
+    l->lock();
+  }
+}
+
+void KeepAliveForwarder::Send(std::vector<Pending>* batch) {
+  KeepAliveBatchRequest request;
+  request.set_forwarder_id(options_.forwarder_id);
+  // 按会话的顺序, 与 request.sessions 和响应中的 responses 对应
+  std::shared_ptr<std::vector<std::vector<DoneCallback>>> dones =
+      std::make_shared<std::vector<std::vector<DoneCallback>>>();
+  for (auto& pending : *batch) {
+    KeepAliveRequest* session = request.add_sessions();
+    session->Swap(&pending.request);
+    session->set_hold_ms(0);
+    dones->push_back(std::move(pending.dones));
+  }
+  forwarded_counter->IncrementBy(request.sessions_size());
+  batch_counter->Increment();
+  VLOG(2) << "[KeepAliveForwarder] forward " << request.sessions_size()
+          << " sessions";
+  send_(request, [dones](const base::Status& status,
+                         const KeepAliveBatchResponse& batch_response) {
+    base::Status result = status;
+    if (result.ok() && batch_response.success() &&
+        batch_response.responses_size() != static_cast<int>(dones->size())) {
+      // 各个会话的失效通知无法对应, 不能当作成功
+      result = base::errors::Internal("KeepAliveBatchResponse has ",
+                                      batch_response.responses_size(),
+                                      " responses for ", dones->size(), " sessions");
+    }
+    for (size_t i = 0; i < dones->size(); ++i) {
+      KeepAliveResponse response;
+      if (result.ok() && batch_response.success()) {
+        response = batch_response.responses(i);
+      } else {
+        response.set_leader_id(batch_response.leader_id());
+      }
+      for (auto& done : (*dones)[i]) {
+        done(result, response);
+      }
+    }
+  });
+}
+
+} // namespace chubby
+} // namespace mpr
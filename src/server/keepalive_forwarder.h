@@ -0,0 +1,86 @@
+#ifndef MPR_CHUBBY_SERVER_KEEPALIVE_FORWARDER_H_
+#define MPR_CHUBBY_SERVER_KEEPALIVE_FORWARDER_H_
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "base/macros.h"
+#include "base/status.h"
+#include "base/platform/env.h"
+#include "base/platform/mutex.h"
+#include "proto/service.pb.h"
+
+namespace mpr {
+namespace chubby {
+
+// follower/proxy 端的 KeepAlive 合并转发.
+//
+// 客户端的续约先排队, 攒够 max_delay_micros 或 max_batch_sessions 后合并为一个
+// KeepAliveBatchRequest 发给 leader. 同一个会话在窗口内多次续约只转发最后一次,
+// 这个会话的所有请求都得到 KeepAliveBatchResponse.responses 中对应的响应,
+// 包括其中的失效通知. 一个会话的挂起会拖住整批, 转发时清除 hold_ms. leader
+// 上的 RPC 数由会话数降为节点数.
+class KeepAliveForwarder {
+ public:
+  typedef std::function<void(const base::Status& status,
+                             const KeepAliveResponse& response)> DoneCallback;
+  typedef std::function<void(const base::Status& status,
+                             const KeepAliveBatchResponse& response)> BatchCallback;
+  // 把一批续约发给 leader, 调用时不持有内部锁
+  typedef std::function<void(const KeepAliveBatchRequest& request,
+                             BatchCallback done)> SendCallback;
+
+  struct Options {
+    // 填入 KeepAliveBatchRequest.forwarder_id
+    std::string forwarder_id;
+    // <= 0 时不启动后台线程, KeepAlive 直接转发.
+    int64_t max_delay_micros;
+    int32_t max_batch_sessions;
+    base::Env* env;
+
+    Options();
+  };
+
+  KeepAliveForwarder(const Options& options, SendCallback send);
+  // 排队中的续约以 Cancelled 结束
+  ~KeepAliveForwarder();
+
+  void KeepAlive(const KeepAliveRequest& request, DoneCallback done);
+
+  // 立即转发排队的续约
+  void Flush();
+
+  // 排队中的会话数
+  size_t pending() const;
+
+ private:
+  struct Pending {
+    KeepAliveRequest request;
+    std::vector<DoneCallback> dones;
+  };
+
+  void FlushLoop();
+  void DoFlush(base::mutex_lock* l);
+  void Send(std::vector<Pending>* batch);
+
+  const Options options_;
+  const SendCallback send_;
+
+  mutable base::mutex mu_;
+  base::condition_variable cv_;
+  bool stopping_;
+  std::vector<Pending> pending_;
+  // session_id -> pending_ 中的下标
+  std::unordered_map<std::string, size_t> pending_index_;
+  uint64_t first_pending_micros_;
+  std::unique_ptr<base::Thread> thread_;
+
+  DISALLOW_COPY_AND_ASSIGN(KeepAliveForwarder);
+};
+
+} // namespace chubby
+} // namespace mpr
+#endif // MPR_CHUBBY_SERVER_KEEPALIVE_FORWARDER_H_
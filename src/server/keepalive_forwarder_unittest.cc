@@ -0,0 +1,200 @@
+#include <gtest/gtest.h>
+
+#include "server/keepalive_forwarder.h"
+#include "base/errors.h"
+
+namespace mpr {
+namespace chubby {
+
+namespace {
+
+// 记录发给 leader 的请求, 由测试决定何时响应
+class FakeLeader {
+ public:
+  KeepAliveForwarder::SendCallback Sender() {
+    return [this](const KeepAliveBatchRequest& request,
+                  KeepAliveForwarder::BatchCallback done) {
+      base::mutex_lock l(mu_);
+      requests_.push_back(request);
+      dones_.push_back(std::move(done));
+      cv_.notify_all();
+    };
+  }
+
+  bool WaitForRequests(size_t n) {
+    base::mutex_lock l(mu_);
+    while (requests_.size() < n) {
+      if (base::WaitForMilliseconds(&l, &cv_, 5000) == base::kCondTimeout) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // 每个会话的响应带一个以会话命名的失效, responses 为 -1 时按会话数填写
+  void Reply(size_t i, const base::Status& status, int responses = -1) {
+    KeepAliveBatchResponse response;
+    response.set_success(status.ok());
+    response.set_leader_id("leader");
+    response.set_renewed(requests_[i].sessions_size());
+    if (responses < 0) {
+      responses = requests_[i].sessions_size();
+    }
+    for (int j = 0; j < responses; ++j) {
+      KeepAliveResponse* session = response.add_responses();
+      session->set_success(true);
+      session->set_leader_id("leader");
+      session->add_invalidations(requests_[i].sessions(j).session_id());
+      session->set_invalidation_seq(j + 1);
+    }
+    dones_[i](status, response);
+  }
+
+  base::mutex mu_;
+  base::condition_variable cv_;
+  std::vector<KeepAliveBatchRequest> requests_;
+  std::vector<KeepAliveForwarder::BatchCallback> dones_;
+};
+
+struct Results {
+  std::vector<std::pair<base::Status, KeepAliveResponse>> responses;
+
+  KeepAliveForwarder::DoneCallback Done() {
+    return [this](const base::Status& status, const KeepAliveResponse& response) {
+      responses.emplace_back(status, response);
+    };
+  }
+};
+
+KeepAliveRequest Renewal(const std::string& session_id,
+                         const std::vector<std::string>& locks) {
+  KeepAliveRequest request;
+  request.set_session_id(session_id);
+  for (const std::string& lock : locks) {
+    request.add_locks(lock);
+  }
+  return request;
+}
+
+KeepAliveForwarder::Options ManualOptions() {
+  KeepAliveForwarder::Options options;
+  options.forwarder_id = "follower1";
+  // 只在测试调用 Flush 时转发
+  options.max_delay_micros = 3600 * 1000000LL;
+  options.max_batch_sessions = 100;
+  return options;
+}
+
+} // namespace
+
+TEST(KeepAliveForwarder, CoalescesSessions) {
+  FakeLeader leader;
+  Results results;
+  KeepAliveForwarder forwarder(ManualOptions(), leader.Sender());
+  forwarder.KeepAlive(Renewal("s1", {"/a"}), results.Done());
+  forwarder.KeepAlive(Renewal("s2", {}), results.Done());
+  KeepAliveRequest held = Renewal("s1", {"/a", "/b"});
+  held.set_hold_ms(5000);
+  forwarder.KeepAlive(held, results.Done());
+  EXPECT_EQ(2u, forwarder.pending());
+
+  forwarder.Flush();
+  EXPECT_EQ(0u, forwarder.pending());
+  ASSERT_EQ(1u, leader.requests_.size());
+  const KeepAliveBatchRequest& request = leader.requests_[0];
+  EXPECT_EQ("follower1", request.forwarder_id());
+  ASSERT_EQ(2, request.sessions_size());
+  EXPECT_EQ("s1", request.sessions(0).session_id());
+  EXPECT_EQ(2, request.sessions(0).locks_size());
+  // 合并的请求不挂起
+  EXPECT_EQ(0, request.sessions(0).hold_ms());
+  EXPECT_EQ("s2", request.sessions(1).session_id());
+  EXPECT_TRUE(results.responses.empty());
+
+  // 一个批次的响应完成所有合并的请求, 每个会话得到自己的失效
+  leader.Reply(0, base::Status::OK());
+  ASSERT_EQ(3u, results.responses.size());
+  const std::vector<std::string> sessions = {"s1", "s1", "s2"};
+  for (size_t i = 0; i < results.responses.size(); ++i) {
+    const KeepAliveResponse& response = results.responses[i].second;
+    EXPECT_TRUE(results.responses[i].first.ok());
+    EXPECT_TRUE(response.success());
+    EXPECT_EQ("leader", response.leader_id());
+    ASSERT_EQ(1, response.invalidations_size());
+    EXPECT_EQ(sessions[i], response.invalidations(0));
+    EXPECT_EQ(sessions[i] == "s1" ? 1 : 2, response.invalidation_seq());
+  }
+}
+
+TEST(KeepAliveForwarder, MismatchedResponsesFail) {
+  FakeLeader leader;
+  Results results;
+  KeepAliveForwarder forwarder(ManualOptions(), leader.Sender());
+  forwarder.KeepAlive(Renewal("s1", {}), results.Done());
+  forwarder.KeepAlive(Renewal("s2", {}), results.Done());
+  forwarder.Flush();
+  leader.Reply(0, base::Status::OK(), 1);
+  ASSERT_EQ(2u, results.responses.size());
+  for (const auto& response : results.responses) {
+    EXPECT_FALSE(response.first.ok());
+    EXPECT_FALSE(response.second.success());
+    EXPECT_EQ(0, response.second.invalidations_size());
+  }
+}
+
+TEST(KeepAliveForwarder, SplitsLargeBatches) {
+  FakeLeader leader;
+  KeepAliveForwarder::Options options = ManualOptions();
+  options.max_batch_sessions = 3;
+  KeepAliveForwarder forwarder(options, leader.Sender());
+  for (int i = 0; i < 7; ++i) {
+    forwarder.KeepAlive(Renewal("s" + std::to_string(i), {}),
+                        [](const base::Status&, const KeepAliveResponse&) {});
+  }
+  forwarder.Flush();
+  ASSERT_EQ(3u, leader.requests_.size());
+  EXPECT_EQ(3, leader.requests_[0].sessions_size());
+  EXPECT_EQ(3, leader.requests_[1].sessions_size());
+  ASSERT_EQ(1, leader.requests_[2].sessions_size());
+  EXPECT_EQ("s6", leader.requests_[2].sessions(0).session_id());
+}
+
+TEST(KeepAliveForwarder, FailuresAndShutdown) {
+  FakeLeader leader;
+  Results results;
+  {
+    KeepAliveForwarder forwarder(ManualOptions(), leader.Sender());
+    forwarder.KeepAlive(Renewal("s1", {}), results.Done());
+    forwarder.Flush();
+    leader.Reply(0, base::errors::Unavailable("not leader"));
+    ASSERT_EQ(1u, results.responses.size());
+    EXPECT_TRUE(base::errors::IsUnavailable(results.responses[0].first));
+    EXPECT_FALSE(results.responses[0].second.success());
+
+    forwarder.KeepAlive(Renewal("s2", {}), results.Done());
+  }
+  ASSERT_EQ(2u, results.responses.size());
+  EXPECT_TRUE(base::errors::IsCancelled(results.responses[1].first));
+  EXPECT_EQ(1u, leader.requests_.size());
+}
+
+TEST(KeepAliveForwarder, FlushesAfterDelay) {
+  FakeLeader leader;
+  KeepAliveForwarder::Options options = ManualOptions();
+  options.max_delay_micros = 10000;
+  KeepAliveForwarder forwarder(options, leader.Sender());
+  for (int i = 0; i < 10; ++i) {
+    forwarder.KeepAlive(Renewal("s" + std::to_string(i), {}),
+                        [](const base::Status&, const KeepAliveResponse&) {});
+  }
+  ASSERT_TRUE(leader.WaitForRequests(1));
+  base::mutex_lock l(leader.mu_);
+  int sessions = 0;
+  for (const auto& request : leader.requests_) {
+    sessions += request.sessions_size();
+  }
+  EXPECT_EQ(10, sessions);
+}
+
+} // namespace chubby
+} // namespace mpr
@@ -0,0 +1,420 @@
+#include "server/lock_manager.h"
+
+#include <algorithm>
+#include <deque>
+#include <functional>
+
+#include "base/errors.h"
+#include "base/logging.h"
+#include "server/dedup_table.h"
+
+#include <gflags/gflags.h>
+
+DECLARE_int32(chubby_lock_stripes);
+DECLARE_int32(chubby_lock_grant_timeout);
+
+namespace mpr {
+namespace chubby {
+
+namespace {
+
+size_t RoundUpToPowerOfTwo(int32_t n) {
+  size_t result = 1;
+  while (result < static_cast<size_t>(std::max(n, 1))) {
+    result <<= 1;
+  }
+  return result;
+}
+
+} // namespace
+
+struct LockManager::Waiter {
+  base::uint64 id;
+  std::string session_id;
+  WaitCallback done;
+};
+
+struct LockManager::LockStripe {
+  mutable base::mutex mu;
+  std::unordered_map<std::string, LockInfo> locks;
+  // 只在 leader 上使用
+  std::unordered_map<std::string, std::deque<Waiter>> waiters;
+  // 被唤醒的等待者: 会话和定时器 id
+  std::unordered_map<std::string, std::pair<std::string, base::uint64>> reserved;
+  // 等待者或保留的 id 到锁名的映射, 用于处理超时
+  std::unordered_map<base::uint64, std::string> timers;
+};
+
+struct LockManager::SessionStripe {
+  mutable base::mutex mu;
+  std::unordered_map<std::string, std::set<std::string>> sessions;
+};
+
+LockManager::Options::Options()
+  : stripes(FLAGS_chubby_lock_stripes),
+    grant_timeout_micros(FLAGS_chubby_lock_grant_timeout * 1000LL),
+    wait_tick_micros(10000),
+    env(base::Env::Default()),
+    start_thread(true) {}
+
+LockManager::LockManager(const Options& options)
+  : options_(options),
+    mask_(RoundUpToPowerOfTwo(options.stripes) - 1),
+    stripe_bits_(0),
+    lock_stripes_(new LockStripe[mask_ + 1]),
+    session_stripes_(new SessionStripe[mask_ + 1]),
+    size_(0),
+    next_waiter_(0) {
+  while ((1ULL << stripe_bits_) <= mask_) {
+    stripe_bits_++;
+  }
+  base::thread::TimingWheel::Options wheel_options;
+  wheel_options.tick_micros = options_.wait_tick_micros;
+  wheel_options.env = options_.env;
+  wheel_options.start_thread = options_.start_thread;
+  wheel_.reset(new base::thread::TimingWheel(wheel_options,
+      [this](std::vector<base::uint64>* ids) { HandleTimeouts(ids); }));
+}
+
+LockManager::~LockManager() {
+  wheel_.reset();
+  Wakeups wakeups;
+  for (size_t i = 0; i <= mask_; ++i) {
+    base::mutex_lock l(lock_stripes_[i].mu);
+    for (auto& kv : lock_stripes_[i].waiters) {
+      for (Waiter& waiter : kv.second) {
+        wakeups.emplace_back(std::move(waiter.done),
+                             base::errors::Cancelled("lock manager shutdown"));
+      }
+    }
+    lock_stripes_[i].waiters.clear();
+  }
+  RunWakeups(&wakeups);
+}
+
+// static
+Entry LockManager::LockEntry(const LockRequest& request) {
+  LockRequest lock;
+  lock.set_key(request.key());
+  lock.set_session_id(request.session_id());
+  lock.set_hostname(request.hostname());
+  Entry entry;
+  entry.set_op(kLock);
+  entry.set_key(request.key());
+  entry.set_value(lock.SerializeAsString());
+  entry.set_dedup_key(DedupTable::Key(request.session_id(), request.request_id()));
+  return entry;
+}
+
+// static
+Entry LockManager::UnLockEntry(const UnLockRequest& request) {
+  UnLockRequest unlock;
+  unlock.set_key(request.key());
+  unlock.set_session_id(request.session_id());
+  Entry entry;
+  entry.set_op(kUnLock);
+  entry.set_key(request.key());
+  entry.set_value(unlock.SerializeAsString());
+  entry.set_dedup_key(DedupTable::Key(request.session_id(), request.request_id()));
+  return entry;
+}
+
+base::Status LockManager::Acquire(const std::string& key,
+                                  const std::string& session_id,
+                                  const std::string& hostname, int64_t index) {
+  LockStripe* stripe = LockStripeOf(key);
+  base::mutex_lock l(stripe->mu);
+  auto it = stripe->locks.find(key);
+  if (it != stripe->locks.end()) {
+    if (it->second.session_id != session_id) {
+      return base::errors::FailedPrecondition("lock ", key, " held by session ",
+                                              it->second.session_id);
+    }
+    return base::Status::OK();
+  }
+  stripe->locks[key] = LockInfo{session_id, hostname, index};
+  size_.fetch_add(1, std::memory_order_relaxed);
+  auto reserved = stripe->reserved.find(key);
+  if (reserved != stripe->reserved.end() && reserved->second.first == session_id) {
+    wheel_->Cancel(reserved->second.second);
+    stripe->timers.erase(reserved->second.second);
+    stripe->reserved.erase(reserved);
+  }
+
+  SessionStripe* sessions = SessionStripeOf(session_id);
+  base::mutex_lock sl(sessions->mu);
+  sessions->sessions[session_id].insert(key);
+  return base::Status::OK();
+}
+
+base::Status LockManager::Release(const std::string& key,
+                                  const std::string& session_id) {
+  Wakeups wakeups;
+  {
+    LockStripe* stripe = LockStripeOf(key);
+    base::mutex_lock l(stripe->mu);
+    auto it = stripe->locks.find(key);
+    if (it == stripe->locks.end()) {
+      return base::errors::NotFound("lock ", key, " not held");
+    }
+    if (it->second.session_id != session_id) {
+      return base::errors::FailedPrecondition("lock ", key, " held by session ",
+                                              it->second.session_id);
+    }
+    stripe->locks.erase(it);
+    size_.fetch_sub(1, std::memory_order_relaxed);
+    DoWakeNext(stripe, key, &wakeups);
+
+    SessionStripe* sessions = SessionStripeOf(session_id);
+    base::mutex_lock sl(sessions->mu);
+    auto session = sessions->sessions.find(session_id);
+    if (session != sessions->sessions.end()) {
+      session->second.erase(key);
+      if (session->second.empty()) {
+        sessions->sessions.erase(session);
+      }
+    }
+  }
+  RunWakeups(&wakeups);
+  return base::Status::OK();
+}
+
+std::vector<std::string> LockManager::ReleaseSession(const std::string& session_id) {
+  std::vector<std::string> released;
+  // 不能在持有会话 stripe 时锁名字的 stripe, 逐个释放
+  for (const std::string& key : GetLocks(session_id)) {
+    if (Release(key, session_id).ok()) {
+      released.push_back(key);
+    }
+  }
+  return released;
+}
+
+void LockManager::Wait(const std::string& key, const std::string& session_id,
+                       int64_t timeout_micros, WaitCallback done) {
+  const size_t index = StripeIndexOf(key);
+  LockStripe* stripe = &lock_stripes_[index];
+  const base::uint64 id = (next_waiter_.fetch_add(1) << stripe_bits_) | index;
+  {
+    base::mutex_lock l(stripe->mu);
+    auto it = stripe->locks.find(key);
+    const bool held = it != stripe->locks.end();
+    if (held && it->second.session_id == session_id) {
+      l.unlock();
+      done(base::Status::OK());
+      return;
+    }
+    auto reserved = stripe->reserved.find(key);
+    auto queue = stripe->waiters.find(key);
+    if (!held && reserved == stripe->reserved.end() &&
+        (queue == stripe->waiters.end() || queue->second.empty())) {
+      // 立即可以加锁, 同样为它保留, 避免同时到达的等待者都去提议
+      DoReserve(stripe, key, session_id, id);
+      l.unlock();
+      done(base::Status::OK());
+      return;
+    }
+    if (reserved != stripe->reserved.end() && reserved->second.first == session_id) {
+      l.unlock();
+      done(base::Status::OK());
+      return;
+    }
+    stripe->waiters[key].push_back(Waiter{id, session_id, std::move(done)});
+    stripe->timers[id] = key;
+    wheel_->Schedule(id, timeout_micros);
+  }
+}
+
+size_t LockManager::waiters(const std::string& key) const {
+  LockStripe* stripe = LockStripeOf(key);
+  base::mutex_lock l(stripe->mu);
+  auto it = stripe->waiters.find(key);
+  return it == stripe->waiters.end() ? 0 : it->second.size();
+}
+
+bool LockManager::CanAcquire(const std::string& key,
+                             const std::string& session_id) const {
+  LockStripe* stripe = LockStripeOf(key);
+  base::mutex_lock l(stripe->mu);
+  auto it = stripe->locks.find(key);
+  if (it != stripe->locks.end()) {
+    return it->second.session_id == session_id;
+  }
+  auto reserved = stripe->reserved.find(key);
+  if (reserved != stripe->reserved.end()) {
+    return reserved->second.first == session_id;
+  }
+  auto queue = stripe->waiters.find(key);
+  return queue == stripe->waiters.end() || queue->second.empty();
+}
+
+bool LockManager::GetOwner(const std::string& key, LockInfo* info) const {
+  LockStripe* stripe = LockStripeOf(key);
+  base::mutex_lock l(stripe->mu);
+  auto it = stripe->locks.find(key);
+  if (it == stripe->locks.end()) {
+    return false;
+  }
+  if (info != nullptr) {
+    *info = it->second;
+  }
+  return true;
+}
+
+std::vector<std::string> LockManager::GetLocks(const std::string& session_id) const {
+  SessionStripe* sessions = SessionStripeOf(session_id);
+  base::mutex_lock l(sessions->mu);
+  auto it = sessions->sessions.find(session_id);
+  if (it == sessions->sessions.end()) {
+    return std::vector<std::string>();
+  }
+  return std::vector<std::string>(it->second.begin(), it->second.end());
+}
+
+base::Status LockManager::Apply(const LogEntry& log_entry, int64_t index) {
+  base::Status status;
+  if (log_entry.log_operation == kLock) {
+    LockRequest request;
+    if (!request.ParseFromString(log_entry.value)) {
+      LOG(WARNING) << "[LockManager] Bad lock entry at " << index;
+      return base::errors::DataLoss("bad lock entry at ", index);
+    }
+    status = Acquire(log_entry.key, request.session_id(), request.hostname(), index);
+    VLOG(1) << "[LockManager] lock " << log_entry.key << " by "
+            << request.session_id() << ": " << status.ToString();
+  } else if (log_entry.log_operation == kUnLock) {
+    UnLockRequest request;
+    if (!request.ParseFromString(log_entry.value)) {
+      LOG(WARNING) << "[LockManager] Bad unlock entry at " << index;
+      return base::errors::DataLoss("bad unlock entry at ", index);
+    }
+    status = Release(log_entry.key, request.session_id());
+    VLOG(1) << "[LockManager] unlock " << log_entry.key << " by "
+            << request.session_id() << ": " << status.ToString();
+  }
+  return status;
+}
+
+void LockManager::Rebuild(BinLogger* bin_logger, int64_t last_applied) {
+  Clear();
+  LogEntry log_entry;
+  for (int64_t index = 0; index <= last_applied; ++index) {
+    // 已经被回收的日志
+    if (!bin_logger->ReadSlot(index, &log_entry)) {
+      continue;
+    }
+    Apply(log_entry, index);
+  }
+  LOG(INFO) << "[LockManager] Rebuilt " << size() << " locks from "
+            << last_applied + 1 << " entries";
+}
+
+LockManager::LockStripe* LockManager::LockStripeOf(const std::string& key) const {
+  return &lock_stripes_[StripeIndexOf(key)];
+}
+
+size_t LockManager::StripeIndexOf(const std::string& key) const {
+  return std::hash<std::string>()(key) & mask_;
+}
+
+void LockManager::DoWakeNext(LockStripe* stripe, const std::string& key,
+                             Wakeups* wakeups) {
+  if (stripe->locks.count(key) > 0 || stripe->reserved.count(key) > 0) {
+    return;
+  }
+  auto queue = stripe->waiters.find(key);
+  if (queue == stripe->waiters.end()) {
+    return;
+  }
+  // 只唤醒一个, 它没有按时加锁时由超时唤醒下一个
+  Waiter waiter = std::move(queue->second.front());
+  queue->second.pop_front();
+  if (queue->second.empty()) {
+    stripe->waiters.erase(queue);
+  }
+  DoReserve(stripe, key, waiter.session_id, waiter.id);
+  wakeups->emplace_back(std::move(waiter.done), base::Status::OK());
+}
+
+void LockManager::DoReserve(LockStripe* stripe, const std::string& key,
+                            const std::string& session_id, base::uint64 id) {
+  stripe->reserved[key] = std::make_pair(session_id, id);
+  stripe->timers[id] = key;
+  wheel_->Schedule(id, options_.grant_timeout_micros);
+}
+
+void LockManager::HandleTimeouts(std::vector<base::uint64>* ids) {
+  Wakeups wakeups;
+  for (base::uint64 id : *ids) {
+    LockStripe* stripe = &lock_stripes_[id & mask_];
+    base::mutex_lock l(stripe->mu);
+    auto timer = stripe->timers.find(id);
+    if (timer == stripe->timers.end()) {
+      continue;
+    }
+    const std::string key = timer->second;
+    stripe->timers.erase(timer);
+    auto reserved = stripe->reserved.find(key);
+    if (reserved != stripe->reserved.end() && reserved->second.second == id) {
+      // 被唤醒的等待者没有加锁
+      stripe->reserved.erase(reserved);
+      DoWakeNext(stripe, key, &wakeups);
+      continue;
+    }
+    auto queue = stripe->waiters.find(key);
+    if (queue == stripe->waiters.end()) {
+      continue;
+    }
+    for (auto it = queue->second.begin(); it != queue->second.end(); ++it) {
+      if (it->id == id) {
+        wakeups.emplace_back(std::move(it->done), base::errors::DeadlineExceeded(
+            "timed out waiting for lock ", key));
+        queue->second.erase(it);
+        break;
+      }
+    }
+    if (queue->second.empty()) {
+      stripe->waiters.erase(queue);
+    }
+  }
+  RunWakeups(&wakeups);
+}
+
+// static
+void LockManager::RunWakeups(Wakeups* wakeups) {
+  for (auto& wakeup : *wakeups) {
+    wakeup.first(wakeup.second);
+  }
+  wakeups->clear();
+}
+
+LockManager::SessionStripe* LockManager::SessionStripeOf(
+    const std::string& session_id) const {
+  return &session_stripes_[std::hash<std::string>()(session_id) & mask_];
+}
+
+std::vector<std::string> LockManager::GetSessions() const {
+  std::vector<std::string> sessions;
+  for (size_t i = 0; i <= mask_; ++i) {
+    base::mutex_lock l(session_stripes_[i].mu);
+    for (const auto& kv : session_stripes_[i].sessions) {
+      sessions.push_back(kv.first);
+    }
+  }
+  return sessions;
+}
+
+void LockManager::Clear() {
+  for (size_t i = 0; i <= mask_; ++i) {
+    {
+      base::mutex_lock l(lock_stripes_[i].mu);
+      lock_stripes_[i].locks.clear();
+    }
+    base::mutex_lock l(session_stripes_[i].mu);
+    session_stripes_[i].sessions.clear();
+  }
+  size_.store(0, std::memory_order_relaxed);
+}
+
+} // namespace chubby
+} // namespace mpr
@@ -0,0 +1,133 @@
+#ifndef MPR_CHUBBY_SERVER_LOCK_MANAGER_H_
+#define MPR_CHUBBY_SERVER_LOCK_MANAGER_H_
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "base/macros.h"
+#include "base/status.h"
+#include "base/platform/env.h"
+#include "base/platform/mutex.h"
+#include "base/thread/timing_wheel.h"
+#include "proto/service.pb.h"
+#include "storage/bin_logger.h"
+
+namespace mpr {
+namespace chubby {
+
+// 内存中的锁表, 由已提交的 kLock/kUnLock 日志驱动.
+//
+// 锁按名字的 hash 分到多个 stripe, 每个 stripe 有自己的 mutex, 不同 stripe
+// 上的加锁解锁互不竞争. 另有按会话分 stripe 的反向索引, 会话过期时只需访问它
+// 持有的锁. 需要同时持有两种锁时总是先锁名字所在的 stripe.
+//
+// 日志中的 value 是序列化的 LockRequest/UnLockRequest, 重启时从 binlog 重放
+// 重建. binlog 截断之前的锁需要快照恢复, 这里不处理.
+//
+// leader 上被占用的锁可以排队等待 (Wait): 每把锁一个 FIFO 队列, 锁释放 (解锁
+// 或者持有者的会话过期) 时只唤醒队首, 并为它保留一段时间, 其他会话的预检
+// 在此期间失败. 等待队列不复制, 换主后客户端重新等待.
+class LockManager {
+ public:
+  // OK 表示可以提议 kLock, 超时返回 DeadlineExceeded
+  typedef std::function<void(const base::Status& status)> WaitCallback;
+
+  struct LockInfo {
+    std::string session_id;
+    std::string hostname;
+    // 加锁日志的 index, 可以作为 fencing token
+    int64_t index;
+  };
+
+  struct Options {
+    // 取整到 2 的幂
+    int32_t stripes;
+    // 被唤醒的等待者在这段时间内没有加锁时唤醒下一个
+    int64_t grant_timeout_micros;
+    // 等待超时的精度
+    int64_t wait_tick_micros;
+    base::Env* env;
+    // 为 false 时由调用者调用 AdvanceTo
+    bool start_thread;
+
+    Options();
+  };
+
+  explicit LockManager(const Options& options);
+  ~LockManager();
+
+  // 生成提案, 只保留 key, session_id 和 hostname, 带 request_id 时填写
+  // dedup_key
+  static Entry LockEntry(const LockRequest& request);
+  static Entry UnLockEntry(const UnLockRequest& request);
+
+  // 锁空闲或者已经被同一个会话持有时成功, 被其他会话持有时返回
+  // FailedPrecondition.
+  base::Status Acquire(const std::string& key, const std::string& session_id,
+                       const std::string& hostname, int64_t index);
+  // 锁不存在时返回 NotFound, 不是持有者时返回 FailedPrecondition
+  base::Status Release(const std::string& key, const std::string& session_id);
+  // 释放会话持有的所有锁, 返回被释放的锁
+  std::vector<std::string> ReleaseSession(const std::string& session_id);
+
+  // 锁空闲 (或者已被本会话持有) 并且没有人排队时立即以 OK 调用 done, 否则排队
+  // 直到被唤醒或 timeout_micros 后超时. done 不在内部锁中调用. 被唤醒后提议的
+  // kLock 在 apply 时仍可能失败 (换主前其他会话的提案), 此时需要重新等待.
+  void Wait(const std::string& key, const std::string& session_id,
+            int64_t timeout_micros, WaitCallback done);
+  size_t waiters(const std::string& key) const;
+  void AdvanceTo(uint64_t now_micros) { wheel_->AdvanceTo(now_micros); }
+
+  // leader 提案之前的预检, 以 apply 的结果为准. 有人排队或者锁为其他会话保留时
+  // 失败, 不等待的请求不能插队.
+  bool CanAcquire(const std::string& key, const std::string& session_id) const;
+  bool GetOwner(const std::string& key, LockInfo* info) const;
+  std::vector<std::string> GetLocks(const std::string& session_id) const;
+  // 持有锁的会话, 成为 leader 时交给 SessionManager::Restore
+  std::vector<std::string> GetSessions() const;
+  int64_t size() const { return size_.load(std::memory_order_relaxed); }
+
+  // ApplyPipeline 的 apply_callback, 返回加锁/解锁的结果, 由 DedupTable 记下
+  // 给重试的请求. 其他操作被忽略
+  base::Status Apply(const LogEntry& log_entry, int64_t index);
+  // 清空后重放 binlog 中 [0, last_applied] 的日志
+  void Rebuild(BinLogger* bin_logger, int64_t last_applied);
+
+ private:
+  struct LockStripe;
+  struct SessionStripe;
+  struct Waiter;
+  typedef std::vector<std::pair<WaitCallback, base::Status>> Wakeups;
+
+  LockStripe* LockStripeOf(const std::string& key) const;
+  size_t StripeIndexOf(const std::string& key) const;
+  void DoWakeNext(LockStripe* stripe, const std::string& key, Wakeups* wakeups);
+  void DoReserve(LockStripe* stripe, const std::string& key,
+                 const std::string& session_id, base::uint64 id);
+  void HandleTimeouts(std::vector<base::uint64>* ids);
+  static void RunWakeups(Wakeups* wakeups);
+  SessionStripe* SessionStripeOf(const std::string& session_id) const;
+  void Clear();
+
+  const Options options_;
+  const size_t mask_;
+  int stripe_bits_;
+  std::unique_ptr<LockStripe[]> lock_stripes_;
+  std::unique_ptr<SessionStripe[]> session_stripes_;
+  std::atomic<int64_t> size_;
+  // 等待者和保留的 id, 低 stripe_bits_ 位是 stripe
+  std::atomic<base::uint64> next_waiter_;
+  // 最先析构: tick 线程退出之后才能释放 stripe
+  std::unique_ptr<base::thread::TimingWheel> wheel_;
+
+  DISALLOW_COPY_AND_ASSIGN(LockManager);
+};
+
+} // namespace chubby
+} // namespace mpr
+#endif // MPR_CHUBBY_SERVER_LOCK_MANAGER_H_
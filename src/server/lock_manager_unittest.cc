@@ -0,0 +1,253 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <thread>
+
+#include "server/lock_manager.h"
+#include "base/platform/env.h"
+#include "base/platform/env_test_util.h"
+
+namespace mpr {
+namespace chubby {
+
+namespace {
+
+LockManager::Options TestOptions(base::Env* env = base::Env::Default()) {
+  LockManager::Options options;
+  options.stripes = 8;
+  options.grant_timeout_micros = 100000;
+  options.env = env;
+  options.start_thread = false;
+  return options;
+}
+
+// 记录每个等待者的结果
+struct WaitResults {
+  std::vector<std::pair<std::string, base::Status>> results;
+
+  LockManager::WaitCallback For(const std::string& session) {
+    return [this, session](const base::Status& status) {
+      results.emplace_back(session, status);
+    };
+  }
+};
+
+LogEntry ToLogEntry(const Entry& entry) {
+  LogEntry log_entry;
+  log_entry.log_operation = entry.op();
+  log_entry.key = entry.key();
+  log_entry.value = entry.value();
+  return log_entry;
+}
+
+} // namespace
+
+TEST(LockManager, AcquireAndRelease) {
+  LockManager locks(TestOptions());
+  ASSERT_TRUE(locks.Acquire("/a", "s1", "host1", 10).ok());
+  // 同一个会话重复加锁成功, 不改变加锁的 index
+  ASSERT_TRUE(locks.Acquire("/a", "s1", "host1", 11).ok());
+  EXPECT_FALSE(locks.CanAcquire("/a", "s2"));
+  EXPECT_TRUE(base::errors::IsFailedPrecondition(
+      locks.Acquire("/a", "s2", "host2", 12)));
+
+  LockManager::LockInfo info;
+  ASSERT_TRUE(locks.GetOwner("/a", &info));
+  EXPECT_EQ("s1", info.session_id);
+  EXPECT_EQ("host1", info.hostname);
+  EXPECT_EQ(10, info.index);
+  EXPECT_EQ(1, locks.size());
+
+  EXPECT_TRUE(base::errors::IsFailedPrecondition(locks.Release("/a", "s2")));
+  EXPECT_TRUE(locks.Release("/a", "s1").ok());
+  EXPECT_TRUE(base::errors::IsNotFound(locks.Release("/a", "s1")));
+  EXPECT_FALSE(locks.GetOwner("/a", &info));
+  EXPECT_TRUE(locks.CanAcquire("/a", "s2"));
+  EXPECT_TRUE(locks.GetLocks("s1").empty());
+  EXPECT_EQ(0, locks.size());
+}
+
+TEST(LockManager, ReleaseSession) {
+  LockManager locks(TestOptions());
+  for (int i = 0; i < 100; ++i) {
+    const std::string session = i % 2 == 0 ? "even" : "odd";
+    ASSERT_TRUE(locks.Acquire("/lock/" + std::to_string(i), session, "", i).ok());
+  }
+  EXPECT_EQ(50u, locks.GetLocks("even").size());
+  std::vector<std::string> sessions = locks.GetSessions();
+  std::sort(sessions.begin(), sessions.end());
+  EXPECT_EQ(std::vector<std::string>({"even", "odd"}), sessions);
+  std::vector<std::string> released = locks.ReleaseSession("even");
+  EXPECT_EQ(50u, released.size());
+  EXPECT_EQ(50, locks.size());
+  EXPECT_TRUE(locks.GetLocks("even").empty());
+  EXPECT_EQ(std::vector<std::string>({"odd"}), locks.GetSessions());
+  EXPECT_TRUE(locks.CanAcquire("/lock/0", "odd"));
+  EXPECT_FALSE(locks.CanAcquire("/lock/1", "even"));
+}
+
+TEST(LockManager, RebuildFromLog) {
+  const std::string path = "/tmp/lock_manager_test";
+  base::int64 undeleted_files, undeleted_dirs;
+  base::Env::Default()->DeleteDirectoryRecursively(path, &undeleted_files,
+                                                   &undeleted_dirs);
+  BinLogger bin_logger((BinLogger::Options(path)));
+
+  LockRequest lock;
+  lock.set_key("/a");
+  lock.set_session_id("s1");
+  lock.set_hostname("host1");
+  lock.set_uuid("token");
+  bin_logger.AppendEntry(ToLogEntry(LockManager::LockEntry(lock)));
+  lock.set_key("/b");
+  bin_logger.AppendEntry(ToLogEntry(LockManager::LockEntry(lock)));
+  LogEntry put;
+  put.log_operation = kPut;
+  put.key = "/c";
+  bin_logger.AppendEntry(put);
+  UnLockRequest unlock;
+  unlock.set_key("/a");
+  unlock.set_session_id("s1");
+  bin_logger.AppendEntry(ToLogEntry(LockManager::UnLockEntry(unlock)));
+  lock.set_key("/a");
+  lock.set_session_id("s2");
+  bin_logger.AppendEntry(ToLogEntry(LockManager::LockEntry(lock)));
+
+  LockManager locks(TestOptions());
+  ASSERT_TRUE(locks.Acquire("/stale", "s3", "", 0).ok());
+  locks.Rebuild(&bin_logger, bin_logger.GetLength() - 1);
+  EXPECT_EQ(2, locks.size());
+  EXPECT_FALSE(locks.GetOwner("/stale", nullptr));
+  LockManager::LockInfo info;
+  ASSERT_TRUE(locks.GetOwner("/a", &info));
+  EXPECT_EQ("s2", info.session_id);
+  EXPECT_EQ(4, info.index);
+  ASSERT_TRUE(locks.GetOwner("/b", &info));
+  EXPECT_EQ("s1", info.session_id);
+  EXPECT_EQ("host1", info.hostname);
+  EXPECT_EQ(1, info.index);
+
+  // 只重放到 index 1
+  locks.Rebuild(&bin_logger, 1);
+  ASSERT_TRUE(locks.GetOwner("/a", &info));
+  EXPECT_EQ("s1", info.session_id);
+}
+
+// apply 的结果交给 DedupTable, 重试的请求要拿到同样的失败
+TEST(LockManager, ApplyReturnsResult) {
+  LockManager locks(TestOptions());
+  LockRequest lock;
+  lock.set_key("/a");
+  lock.set_session_id("s1");
+  EXPECT_TRUE(locks.Apply(ToLogEntry(LockManager::LockEntry(lock)), 0).ok());
+  lock.set_session_id("s2");
+  EXPECT_TRUE(base::errors::IsFailedPrecondition(
+      locks.Apply(ToLogEntry(LockManager::LockEntry(lock)), 1)));
+  UnLockRequest unlock;
+  unlock.set_key("/b");
+  unlock.set_session_id("s1");
+  EXPECT_TRUE(base::errors::IsNotFound(
+      locks.Apply(ToLogEntry(LockManager::UnLockEntry(unlock)), 2)));
+  LogEntry put;
+  put.log_operation = kPut;
+  EXPECT_TRUE(locks.Apply(put, 3).ok());
+}
+
+TEST(LockManager, ConcurrentSessions) {
+  LockManager locks(TestOptions());
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 8; ++t) {
+    threads.emplace_back([&locks, t]() {
+      const std::string session = "session" + std::to_string(t);
+      for (int round = 0; round < 100; ++round) {
+        for (int i = 0; i < 20; ++i) {
+          const std::string key = "/" + session + "/" + std::to_string(i);
+          EXPECT_TRUE(locks.Acquire(key, session, "", i).ok());
+          // 所有会话竞争同一把锁
+          locks.Acquire("/shared", session, "", i);
+        }
+        locks.ReleaseSession(session);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(0, locks.size());
+}
+
+TEST(LockManager, WaitersGrantedInOrder) {
+  base::FakeClockEnv env;
+  LockManager locks(TestOptions(&env));
+  WaitResults waits;
+  // 锁空闲时立即返回
+  locks.Wait("/a", "s1", 1000000, waits.For("s1"));
+  ASSERT_EQ(1u, waits.results.size());
+  EXPECT_TRUE(waits.results[0].second.ok());
+  // 已经为 s1 保留, 不等待的请求不能抢
+  EXPECT_FALSE(locks.CanAcquire("/a", "s9"));
+  ASSERT_TRUE(locks.Acquire("/a", "s1", "", 1).ok());
+
+  locks.Wait("/a", "s2", 1000000, waits.For("s2"));
+  locks.Wait("/a", "s3", 1000000, waits.For("s3"));
+  EXPECT_EQ(2u, locks.waiters("/a"));
+  EXPECT_EQ(1u, waits.results.size());
+
+  // 释放时只唤醒队首
+  ASSERT_TRUE(locks.Release("/a", "s1").ok());
+  ASSERT_EQ(2u, waits.results.size());
+  EXPECT_EQ("s2", waits.results[1].first);
+  EXPECT_TRUE(waits.results[1].second.ok());
+  EXPECT_TRUE(locks.CanAcquire("/a", "s2"));
+  EXPECT_FALSE(locks.CanAcquire("/a", "s3"));
+  ASSERT_TRUE(locks.Acquire("/a", "s2", "", 2).ok());
+
+  // 持有者的会话过期同样唤醒下一个
+  locks.ReleaseSession("s2");
+  ASSERT_EQ(3u, waits.results.size());
+  EXPECT_EQ("s3", waits.results[2].first);
+  EXPECT_EQ(0u, locks.waiters("/a"));
+}
+
+TEST(LockManager, WaitTimesOut) {
+  base::FakeClockEnv env;
+  LockManager locks(TestOptions(&env));
+  ASSERT_TRUE(locks.Acquire("/a", "s1", "", 1).ok());
+  WaitResults waits;
+  locks.Wait("/a", "s2", 50000, waits.For("s2"));
+  locks.Wait("/a", "s3", 500000, waits.For("s3"));
+
+  env.AdvanceMillis(50);
+  locks.AdvanceTo(env.NowMicros());
+  ASSERT_EQ(1u, waits.results.size());
+  EXPECT_EQ("s2", waits.results[0].first);
+  EXPECT_TRUE(base::errors::IsDeadlineExceeded(waits.results[0].second));
+  EXPECT_EQ(1u, locks.waiters("/a"));
+
+  ASSERT_TRUE(locks.Release("/a", "s1").ok());
+  ASSERT_EQ(2u, waits.results.size());
+  EXPECT_EQ("s3", waits.results[1].first);
+  EXPECT_TRUE(waits.results[1].second.ok());
+}
+
+TEST(LockManager, UnclaimedGrantPassesOn) {
+  base::FakeClockEnv env;
+  LockManager locks(TestOptions(&env));
+  ASSERT_TRUE(locks.Acquire("/a", "s1", "", 1).ok());
+  WaitResults waits;
+  locks.Wait("/a", "s2", 1000000, waits.For("s2"));
+  locks.Wait("/a", "s3", 1000000, waits.For("s3"));
+  ASSERT_TRUE(locks.Release("/a", "s1").ok());
+  ASSERT_EQ(1u, waits.results.size());
+
+  // s2 被唤醒后没有在 grant_timeout 内加锁
+  env.AdvanceMillis(100);
+  locks.AdvanceTo(env.NowMicros());
+  ASSERT_EQ(2u, waits.results.size());
+  EXPECT_EQ("s3", waits.results[1].first);
+  EXPECT_TRUE(waits.results[1].second.ok());
+  EXPECT_FALSE(locks.CanAcquire("/a", "s2"));
+  EXPECT_TRUE(locks.CanAcquire("/a", "s3"));
+}
+
+} // namespace chubby
+} // namespace mpr
@@ -0,0 +1,65 @@
+#include "server/log_appender.h"
+
+#include "base/logging.h"
+
+namespace mpr {
+namespace chubby {
+
+LogAppender::LogAppender(BinLogger* bin_logger)
+  : bin_logger_(bin_logger) {
+  DCHECK(bin_logger_ != nullptr);
+}
+
+void LogAppender::Append(const AppendEntriesRequest& request,
+                         AppendEntriesResponse* response) {
+  int64_t length = bin_logger_->GetLength();
+  int64_t prev_log_index = request.prev_log_index();
+  response->set_success(false);
+  response->set_log_length(length);
+
+  if (prev_log_index >= length) {
+    // 日志太短, leader 根据 log_length 回退
+    return;
+  }
+  if (prev_log_index >= 0) {
+    LogEntry log_entry;
+    if (!bin_logger_->ReadSlot(prev_log_index, &log_entry)) {
+      LOG(WARNING) << "[LogAppender] Failed to read slot: " << prev_log_index;
+      return;
+    }
+    if (log_entry.term != request.prev_log_term()) {
+      response->set_conflict_term(log_entry.term);
+      response->set_conflict_index(
+          bin_logger_->FindFirstIndexOfTerm(log_entry.term, prev_log_index));
+      return;
+    }
+  }
+
+  // 跳过已经存在的日志, 从第一条 term 不同的日志开始覆盖
+  int first = 0;
+  for (; first < request.entries_size(); ++first) {
+    int64_t index = prev_log_index + 1 + first;
+    if (index >= length) {
+      break;
+    }
+    LogEntry log_entry;
+    if (!bin_logger_->ReadSlot(index, &log_entry) ||
+        log_entry.term != request.entries(first).term()) {
+      VLOG(1) << "[LogAppender] truncate log after " << index - 1;
+      break;
+    }
+  }
+  if (first < request.entries_size()) {
+    ::google::protobuf::RepeatedPtrField<Entry> entries(
+        request.entries().begin() + first, request.entries().end());
+    if (!bin_logger_->WriteEntryList(prev_log_index + 1 + first, entries)) {
+      response->set_log_length(bin_logger_->GetLength());
+      return;
+    }
+  }
+  response->set_success(true);
+  response->set_log_length(bin_logger_->GetLength());
+}
+
+} // namespace chubby
+} // namespace mpr
@@ -0,0 +1,33 @@
+#ifndef MPR_CHUBBY_SERVER_LOG_APPENDER_H_
+#define MPR_CHUBBY_SERVER_LOG_APPENDER_H_
+
+#include "base/macros.h"
+#include "proto/service.pb.h"
+#include "storage/bin_logger.h"
+
+namespace mpr {
+namespace chubby {
+
+// Follower 端处理 AppendEntries 中与日志相关的部分.
+//
+// prev_log_index 处的 term 不一致时, 在响应中带上 conflict_term 和该 term 的
+// 第一条日志, leader 可以一次跳过整个 term, 而不是每个 RTT 回退一条.
+class LogAppender {
+ public:
+  explicit LogAppender(BinLogger* bin_logger);
+
+  // term 与 leader 身份由调用者检查. 填写 success, log_length 以及冲突提示.
+  // 与本地一致的日志不会被截断, 日志写在请求指定的 index 上. 调用者需要把
+  // 同一个日志上的 Append 串行化, 并在同一个临界区内检查 term; 串行执行时
+  // 重复或乱序到达的请求是安全的.
+  void Append(const AppendEntriesRequest& request, AppendEntriesResponse* response);
+
+ private:
+  BinLogger* bin_logger_;
+
+  DISALLOW_COPY_AND_ASSIGN(LogAppender);
+};
+
+} // namespace chubby
+} // namespace mpr
+#endif // MPR_CHUBBY_SERVER_LOG_APPENDER_H_
@@ -0,0 +1,169 @@
+#include <gtest/gtest.h>
+#include <deque>
+
+#include "server/log_appender.h"
+#include "server/replicator.h"
+#include "base/platform/env.h"
+
+namespace mpr {
+namespace chubby {
+
+namespace {
+
+std::unique_ptr<BinLogger> NewBinLogger(const std::string& path,
+                                        const std::vector<std::pair<int64_t, int64_t>>& runs) {
+  base::int64 undeleted_files, undeleted_dirs;
+  base::Env::Default()->DeleteDirectoryRecursively(path, &undeleted_files,
+                                                   &undeleted_dirs);
+  std::unique_ptr<BinLogger> bin_logger(new BinLogger(BinLogger::Options(path)));
+  // runs: (term, count)
+  for (auto& run : runs) {
+    for (int64_t i = 0; i < run.second; ++i) {
+      LogEntry log_entry;
+      log_entry.log_operation = kPut;
+      log_entry.key = "key";
+      log_entry.term = run.first;
+      bin_logger->AppendEntry(log_entry);
+    }
+  }
+  return bin_logger;
+}
+
+// 在本地的 LogAppender 上执行请求, 由测试驱动.
+class LocalPeerClient : public PeerClient {
+ public:
+  LocalPeerClient(const std::string& id, LogAppender* appender, bool hints)
+    : id_(id), appender_(appender), hints_(hints), rejected_(0) {}
+
+  const std::string& peer_id() const override { return id_; }
+
+  void AppendEntries(const AppendEntriesRequest& request,
+                     AppendEntriesCallback done) override {
+    pending_.emplace_back(request, done);
+  }
+
+  void Run() {
+    while (!pending_.empty()) {
+      auto call = pending_.front();
+      pending_.pop_front();
+      AppendEntriesResponse response;
+      response.set_current_term(call.first.term());
+      appender_->Append(call.first, &response);
+      if (!hints_) {
+        response.clear_conflict_term();
+        response.clear_conflict_index();
+      }
+      if (!response.success()) {
+        rejected_++;
+      }
+      call.second(base::Status::OK(), response);
+    }
+  }
+
+  int rejected() const { return rejected_; }
+
+ private:
+  std::string id_;
+  LogAppender* appender_;
+  bool hints_;
+  int rejected_;
+  std::deque<std::pair<AppendEntriesRequest, AppendEntriesCallback>> pending_;
+};
+
+void ExpectSameLog(BinLogger* a, BinLogger* b) {
+  ASSERT_EQ(a->GetLength(), b->GetLength());
+  for (int64_t i = 0; i < a->GetLength(); ++i) {
+    LogEntry x, y;
+    ASSERT_TRUE(a->ReadSlot(i, &x));
+    ASSERT_TRUE(b->ReadSlot(i, &y));
+    ASSERT_EQ(x.term, y.term) << "index: " << i;
+  }
+}
+
+int Converge(bool hints) {
+  std::unique_ptr<BinLogger> leader_log = NewBinLogger(
+      "/tmp/log_appender_test_leader", {{1, 5}, {4, 500}});
+  std::unique_ptr<BinLogger> follower_log = NewBinLogger(
+      "/tmp/log_appender_test_follower", {{1, 5}, {2, 1000}, {3, 1000}});
+  LogAppender appender(follower_log.get());
+  LocalPeerClient peer("peer", &appender, hints);
+
+  Replicator::Options options;
+  options.leader_id = "leader";
+  options.max_inflight = 1;
+  options.max_batch_entries = 100;
+  Replicator replicator(options, leader_log.get(), {&peer});
+  replicator.Start(5, -1);
+  LogEntry log_entry;
+  log_entry.term = 5;
+  leader_log->AppendEntry(log_entry);
+  replicator.Replicate();
+  peer.Run();
+
+  ExpectSameLog(leader_log.get(), follower_log.get());
+  EXPECT_EQ(505, replicator.commit_index());
+  return peer.rejected();
+}
+
+} // namespace
+
+TEST(LogAppender, RejectsWithConflictHint) {
+  std::unique_ptr<BinLogger> bin_logger = NewBinLogger(
+      "/tmp/log_appender_test1", {{1, 3}, {2, 4}});
+  LogAppender appender(bin_logger.get());
+
+  AppendEntriesRequest request;
+  request.set_prev_log_index(5);
+  request.set_prev_log_term(3);
+  AppendEntriesResponse response;
+  appender.Append(request, &response);
+  EXPECT_FALSE(response.success());
+  EXPECT_EQ(2, response.conflict_term());
+  EXPECT_EQ(3, response.conflict_index());
+
+  request.set_prev_log_index(10);
+  response.Clear();
+  appender.Append(request, &response);
+  EXPECT_FALSE(response.success());
+  EXPECT_EQ(7, response.log_length());
+  EXPECT_EQ(0, response.conflict_term());
+}
+
+TEST(LogAppender, TruncatesOnlyOnConflict) {
+  std::unique_ptr<BinLogger> bin_logger = NewBinLogger(
+      "/tmp/log_appender_test2", {{1, 3}, {2, 4}});
+  LogAppender appender(bin_logger.get());
+
+  // 重复的旧请求不截断已有日志
+  AppendEntriesRequest request;
+  request.set_prev_log_index(2);
+  request.set_prev_log_term(1);
+  request.add_entries()->set_term(2);
+  request.add_entries()->set_term(2);
+  AppendEntriesResponse response;
+  appender.Append(request, &response);
+  EXPECT_TRUE(response.success());
+  EXPECT_EQ(7, bin_logger->GetLength());
+
+  request.add_entries()->set_term(3);
+  appender.Append(request, &response);
+  EXPECT_TRUE(response.success());
+  EXPECT_EQ(6, bin_logger->GetLength());
+  int64_t last_log_index, last_log_term;
+  bin_logger->GetLastLogIndexAndTerm(&last_log_index, &last_log_term);
+  EXPECT_EQ(3, last_log_term);
+}
+
+TEST(LogAppender, SkipsWholeTerms) {
+  // follower 多出两个 term 共 2000 条日志, 一次拒绝后即可找到一致的位置
+  EXPECT_EQ(1, Converge(true));
+}
+
+TEST(LogAppender, BinarySearchWithoutHints) {
+  int rejected = Converge(false);
+  EXPECT_GT(rejected, 1);
+  EXPECT_LE(rejected, 10);
+}
+
+} // namespace chubby
+} // namespace mpr
@@ -0,0 +1,274 @@
+#include "server/multi_raft.h"
+
+#include <set>
+
+#include "base/errors.h"
+#include "base/logging.h"
+
+namespace mpr {
+namespace chubby {
+
+MultiRaft::MultiRaft(const Options& options, Database* database)
+  : options_(options),
+    database_(database) {
+  DCHECK(database_ != nullptr);
+}
+
+MultiRaft::~MultiRaft() {
+  // 组的 Replicator 引用 coalescer 中的 PeerClient, 先销毁组
+  groups_.clear();
+}
+
+void MultiRaft::AddNode(NodeClient* client) {
+  base::mutex_lock l(mu_);
+  coalescers_[client->peer_id()].reset(
+      new HeartbeatCoalescer(options_.node_id, client));
+}
+
+base::Status MultiRaft::SetShardMap(const ShardMapInfo& info) {
+  std::unique_ptr<ShardMap> shard_map;
+  RETURN_IF_ERROR(ShardMap::Create(info, &shard_map));
+
+  base::mutex_lock l(mu_);
+  if (shard_map_ && shard_map_->version() > info.version()) {
+    return base::errors::FailedPrecondition("stale shard map version ",
+                                            info.version());
+  }
+  // 先检查所有分片, 出错时不创建也不修改任何组
+  for (const ShardInfo& shard : info.shards()) {
+    for (const auto* replicas : {&shard.replicas(), &shard.learners()}) {
+      for (const std::string& replica : *replicas) {
+        if (replica != options_.node_id && coalescers_.count(replica) == 0) {
+          return base::errors::NotFound("unknown node ", replica);
+        }
+      }
+    }
+  }
+  std::set<int32_t> members;
+  for (const ShardInfo& shard : info.shards()) {
+    bool voter = false;
+    bool learner = false;
+    std::vector<PeerClient*> peers;
+    std::map<std::string, PeerClient*> learners;
+    for (const std::string& replica : shard.replicas()) {
+      if (replica == options_.node_id) {
+        voter = true;
+        continue;
+      }
+      auto it = coalescers_.find(replica);
+      DCHECK(it != coalescers_.end());
+      peers.push_back(it->second->ForGroup(shard.group_id()));
+    }
+    for (const std::string& replica : shard.learners()) {
+      if (replica == options_.node_id) {
+        learner = true;
+        continue;
+      }
+      auto it = coalescers_.find(replica);
+      DCHECK(it != coalescers_.end());
+      learners[replica] = it->second->ForGroup(shard.group_id());
+    }
+    if (!voter && !learner) {
+      continue;
+    }
+    members.insert(shard.group_id());
+
+    std::unique_ptr<RaftGroup>& group = groups_[shard.group_id()];
+    auto removed = removed_.find(shard.group_id());
+    if (!group && removed != removed_.end()) {
+      group = std::move(removed->second);
+      removed_.erase(removed);
+      LOG(INFO) << "[MultiRaft] " << options_.node_id << " rejoins group "
+                << shard.group_id();
+    }
+    if (!group) {
+      RaftGroup::Options group_options = options_.group;
+      group_options.group_id = shard.group_id();
+      group_options.node_id = options_.node_id;
+      group_options.data_dir = options_.data_dir;
+      group_options.learner = learner;
+      group.reset(new RaftGroup(group_options, database_, peers));
+      LOG(INFO) << "[MultiRaft] " << options_.node_id << " joins group "
+                << shard.group_id() << (learner ? " as learner" : "")
+                << " with " << peers.size() << " peers";
+    }
+    if (group->is_learner()) {
+      if (voter) {
+        LOG(WARNING) << "[MultiRaft] " << options_.node_id
+                     << " stays learner of group " << shard.group_id()
+                     << ", promotion needs membership change";
+      }
+      continue;
+    }
+    // learner 不影响多数派, 可以直接增减
+    for (const std::string& peer_id : group->GetLearners()) {
+      if (learners.erase(peer_id) == 0) {
+        group->RemoveLearner(peer_id);
+      }
+    }
+    for (auto& kv : learners) {
+      group->AddLearner(kv.second);
+    }
+  }
+  for (auto it = groups_.begin(); it != groups_.end();) {
+    if (members.count(it->first) > 0) {
+      ++it;
+      continue;
+    }
+    if (!it->second->is_learner()) {
+      LOG(WARNING) << "[MultiRaft] " << options_.node_id << " stays in group "
+                   << it->first << ", removing a voter needs membership change";
+      ++it;
+      continue;
+    }
+    LOG(INFO) << "[MultiRaft] " << options_.node_id << " leaves group "
+              << it->first << " as learner";
+    removed_[it->first] = std::move(it->second);
+    it = groups_.erase(it);
+  }
+  shard_map_ = std::move(shard_map);
+  return base::Status::OK();
+}
+
+RaftGroup* MultiRaft::Route(const std::string& key, ShardInfo* shard) {
+  base::mutex_lock l(mu_);
+  if (!shard_map_) {
+    return nullptr;
+  }
+  const ShardInfo& info = shard_map_->Lookup(key);
+  auto it = groups_.find(info.group_id());
+  if (shard != nullptr) {
+    shard->CopyFrom(info);
+    if (it != groups_.end()) {
+      shard->set_leader_id(it->second->leader_id());
+    }
+  }
+  return it == groups_.end() ? nullptr : it->second.get();
+}
+
+RaftGroup* MultiRaft::GetGroup(int32_t group_id) {
+  base::mutex_lock l(mu_);
+  auto it = groups_.find(group_id);
+  return it == groups_.end() ? nullptr : it->second.get();
+}
+
+std::vector<RaftGroup*> MultiRaft::GetGroups() {
+  base::mutex_lock l(mu_);
+  std::vector<RaftGroup*> groups;
+  for (auto& kv : groups_) {
+    groups.push_back(kv.second.get());
+  }
+  return groups;
+}
+
+void MultiRaft::HandleAppendEntries(const AppendEntriesRequest& request,
+                                    AppendEntriesResponse* response) {
+  RaftGroup* group = GetGroup(request.group_id());
+  if (group == nullptr) {
+    response->set_success(false);
+    return;
+  }
+  group->HandleAppendEntries(request, response);
+}
+
+void MultiRaft::HandleHeartbeat(const CoalescedHeartbeatRequest& request,
+                                CoalescedHeartbeatResponse* response) {
+  for (const GroupHeartbeat& heartbeat : request.heartbeats()) {
+    GroupHeartbeatResponse* group_response = response->add_responses();
+    RaftGroup* group = GetGroup(heartbeat.group_id());
+    if (group == nullptr) {
+      group_response->set_success(false);
+      continue;
+    }
+    group->HandleHeartbeat(request.leader_id(), heartbeat, group_response);
+  }
+}
+
+void MultiRaft::HandleVote(const VoteRequest& request, VoteResponse* response) {
+  RaftGroup* group = GetGroup(request.group_id());
+  if (group == nullptr) {
+    response->set_vote_granted(false);
+    return;
+  }
+  group->HandleVote(request, response);
+}
+
+void MultiRaft::HandleTimeoutNow(const TimeoutNowRequest& request,
+                                 TimeoutNowResponse* response) {
+  RaftGroup* group = GetGroup(request.group_id());
+  if (group == nullptr) {
+    response->set_success(false);
+    return;
+  }
+  group->HandleTimeoutNow(request, response);
+}
+
+void MultiRaft::TransferLeadership(int32_t group_id, const std::string& target_id,
+                                   RaftGroup::TransferCallback done) {
+  RaftGroup* group = GetGroup(group_id);
+  if (group == nullptr) {
+    done(base::errors::NotFound("group ", group_id, " not on ", options_.node_id));
+    return;
+  }
+  group->TransferLeadership(target_id, std::move(done));
+}
+
+int MultiRaft::BalanceLeaders() {
+  std::vector<RaftGroup*> groups = GetGroups();
+  std::map<std::string, int> leaders;
+  for (RaftGroup* group : groups) {
+    for (const std::string& voter : group->GetVoters()) {
+      leaders[voter];
+    }
+    const std::string leader_id = group->leader_id();
+    if (!leader_id.empty()) {
+      leaders[leader_id]++;
+    }
+  }
+
+  int transfers = 0;
+  for (RaftGroup* group : groups) {
+    if (!group->is_leader() || !group->transfer_target().empty()) {
+      continue;
+    }
+    std::string target;
+    for (const std::string& voter : group->GetVoters()) {
+      if (voter != options_.node_id &&
+          (target.empty() || leaders[voter] < leaders[target])) {
+        target = voter;
+      }
+    }
+    if (target.empty() || leaders[options_.node_id] <= leaders[target] + 1) {
+      continue;
+    }
+    leaders[options_.node_id]--;
+    leaders[target]++;
+    transfers++;
+    const int32_t group_id = group->group_id();
+    group->TransferLeadership(target, [group_id, target](const base::Status& status) {
+      LOG_IF(WARNING, !status.ok()) << "[MultiRaft] Failed to move group " << group_id
+                                    << " to " << target << ": " << status.ToString();
+    });
+  }
+  return transfers;
+}
+
+void MultiRaft::Tick() {
+  for (RaftGroup* group : GetGroups()) {
+    group->Tick();
+  }
+  std::vector<HeartbeatCoalescer*> coalescers;
+  {
+    base::mutex_lock l(mu_);
+    for (auto& kv : coalescers_) {
+      coalescers.push_back(kv.second.get());
+    }
+  }
+  // 响应可能在当前线程回调, 不持有 mu_
+  for (HeartbeatCoalescer* coalescer : coalescers) {
+    coalescer->Flush();
+  }
+}
+
+} // namespace chubby
+} // namespace mpr
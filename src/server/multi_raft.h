@@ -0,0 +1,92 @@
+#ifndef MPR_CHUBBY_SERVER_MULTI_RAFT_H_
+#define MPR_CHUBBY_SERVER_MULTI_RAFT_H_
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base/macros.h"
+#include "base/status.h"
+#include "base/platform/mutex.h"
+#include "proto/service.pb.h"
+#include "server/heartbeat_coalescer.h"
+#include "server/raft_group.h"
+#include "server/shard_map.h"
+#include "storage/database.h"
+
+namespace mpr {
+namespace chubby {
+
+// 一个节点上的多个共识组.
+//
+// key 空间按 ShardMap 划分给多个互相独立的共识组, 每个组有自己的 binlog,
+// namespace 和 leader, 写吞吐随节点数增长. 发往同一节点的心跳由
+// HeartbeatCoalescer 合并.
+class MultiRaft {
+ public:
+  struct Options {
+    std::string node_id;
+    std::string data_dir;
+    // 各组共用的配置, group_id/node_id/data_dir 由 MultiRaft 填写
+    RaftGroup::Options group;
+  };
+
+  MultiRaft(const Options& options, Database* database);
+  ~MultiRaft();
+
+  // client 由调用者持有. 需要在 SetShardMap 之前添加所有节点.
+  void AddNode(NodeClient* client);
+
+  // 创建 shard map 中包含本节点的组, 已经存在的组按新的 shard map 增减
+  // learner. 本节点不再是某个组的 learner 时, 该组不再接收请求, 数据留在
+  // 磁盘上. voter 的变更 (包括把 learner 提升为 voter) 需要成员变更协议,
+  // 这里不处理, 只打印警告. 引用了未添加的节点时返回 NotFound, 不创建也不
+  // 修改任何组.
+  base::Status SetShardMap(const ShardMapInfo& info);
+
+  // key 所在的组在本节点上时返回该组, 否则返回 nullptr. shard 用于重定向.
+  RaftGroup* Route(const std::string& key, ShardInfo* shard);
+  RaftGroup* GetGroup(int32_t group_id);
+  std::vector<RaftGroup*> GetGroups();
+
+  // follower 端
+  void HandleAppendEntries(const AppendEntriesRequest& request,
+                           AppendEntriesResponse* response);
+  void HandleHeartbeat(const CoalescedHeartbeatRequest& request,
+                       CoalescedHeartbeatResponse* response);
+  void HandleVote(const VoteRequest& request, VoteResponse* response);
+  void HandleTimeoutNow(const TimeoutNowRequest& request,
+                        TimeoutNowResponse* response);
+
+  // 本节点不是该组的 leader 时以 Unavailable 调用 done
+  void TransferLeadership(int32_t group_id, const std::string& target_id,
+                          RaftGroup::TransferCallback done);
+
+  // 本节点领导的组比某个副本多 2 个以上时, 把多出来的组转移给领导最少的副本,
+  // 返回开始转移的组数. 只能看到本节点所在的组, 各节点分别调用后逐渐均衡.
+  int BalanceLeaders();
+
+  // 周期调用, 间隔不大于最小心跳间隔, 并远小于最小选举超时: 本节点为 leader
+  // 的组只给空闲的 follower 发心跳, 发往同一节点的心跳合并为一个请求, 所有组
+  // 都有复制流量时不发送心跳; 其他组在选举超时后发起选举.
+  void Tick();
+
+ private:
+  const Options options_;
+  Database* database_;
+
+  base::mutex mu_;
+  std::unique_ptr<ShardMap> shard_map_;
+  std::map<std::string, std::unique_ptr<HeartbeatCoalescer>> coalescers_;
+  std::map<int32_t, std::unique_ptr<RaftGroup>> groups_;
+  // 本节点退出的 learner 组. GetGroup 返回的指针可能还在使用, 保留到析构;
+  // 重新加入时继续使用, 避免两个 BinLogger 打开同一个目录.
+  std::map<int32_t, std::unique_ptr<RaftGroup>> removed_;
+
+  DISALLOW_COPY_AND_ASSIGN(MultiRaft);
+};
+
+} // namespace chubby
+} // namespace mpr
+#endif // MPR_CHUBBY_SERVER_MULTI_RAFT_H_
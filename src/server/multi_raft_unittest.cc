@@ -0,0 +1,792 @@
+#include <gtest/gtest.h>
+#include <deque>
+#include <map>
+#include <set>
+#include <thread>
+#include <unistd.h>
+
+#include "server/multi_raft.h"
+#include "server/apply_pipeline.h"
+#include "server/user_manager.h"
+#include "base/io/path.h"
+#include "base/platform/env.h"
+#include "base/platform/env_test_util.h"
+
+namespace mpr {
+namespace chubby {
+
+namespace {
+
+const char kTestDir[] = "/tmp/multi_raft_test";
+
+// 把请求排队, Pump 时交给目标节点处理.
+class LocalNodeClient : public NodeClient {
+ public:
+  LocalNodeClient(const std::string& id, MultiRaft** target)
+    : id_(id), target_(target), heartbeat_rpcs_(0) {}
+
+  const std::string& peer_id() const override { return id_; }
+
+  void AppendEntries(const AppendEntriesRequest& request,
+                     AppendEntriesCallback done) override {
+    calls_.push_back([this, request, done]() {
+      AppendEntriesResponse response;
+      (*target_)->HandleAppendEntries(request, &response);
+      done(base::Status::OK(), response);
+    });
+  }
+
+  void Heartbeat(const CoalescedHeartbeatRequest& request,
+                 HeartbeatCallback done) override {
+    heartbeat_rpcs_++;
+    calls_.push_back([this, request, done]() {
+      CoalescedHeartbeatResponse response;
+      (*target_)->HandleHeartbeat(request, &response);
+      done(base::Status::OK(), response);
+    });
+  }
+
+  void RequestVote(const VoteRequest& request, VoteCallback done) override {
+    calls_.push_back([this, request, done]() {
+      VoteResponse response;
+      (*target_)->HandleVote(request, &response);
+      done(base::Status::OK(), response);
+    });
+  }
+
+  void TimeoutNow(const TimeoutNowRequest& request,
+                  TimeoutNowCallback done) override {
+    calls_.push_back([this, request, done]() {
+      TimeoutNowResponse response;
+      (*target_)->HandleTimeoutNow(request, &response);
+      done(base::Status::OK(), response);
+    });
+  }
+
+  bool Pump() {
+    bool pumped = !calls_.empty();
+    while (!calls_.empty()) {
+      std::function<void()> call = calls_.front();
+      calls_.pop_front();
+      call();
+    }
+    return pumped;
+  }
+
+  int heartbeat_rpcs() const { return heartbeat_rpcs_; }
+
+ private:
+  std::string id_;
+  MultiRaft** target_;
+  int heartbeat_rpcs_;
+  std::deque<std::function<void()>> calls_;
+};
+
+// 把请求排队, Pump 时全部成功应答
+class AckingPeerClient : public PeerClient {
+ public:
+  explicit AckingPeerClient(const std::string& id) : id_(id) {}
+
+  const std::string& peer_id() const override { return id_; }
+
+  void AppendEntries(const AppendEntriesRequest& request,
+                     AppendEntriesCallback done) override {
+    pending_.emplace_back(request, done);
+  }
+
+  void Pump() {
+    while (!pending_.empty()) {
+      auto call = pending_.front();
+      pending_.pop_front();
+      AppendEntriesResponse response;
+      response.set_current_term(call.first.term());
+      response.set_success(true);
+      response.set_log_length(call.first.prev_log_index() + 1 +
+                              call.first.entries_size());
+      call.second(base::Status::OK(), response);
+    }
+  }
+
+ private:
+  std::string id_;
+  std::deque<std::pair<AppendEntriesRequest, AppendEntriesCallback>> pending_;
+};
+
+class MultiRaftTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    base::int64 undeleted_files, undeleted_dirs;
+    base::Env::Default()->DeleteDirectoryRecursively(kTestDir, &undeleted_files,
+                                                     &undeleted_dirs);
+    const std::vector<std::string> nodes = {"a", "b", "c"};
+    nodes_.resize(nodes.size(), nullptr);
+    for (size_t i = 0; i < nodes.size(); ++i) {
+      std::string dir = base::io::JoinPath(kTestDir, nodes[i]);
+      ASSERT_TRUE(base::Env::Default()->CreateDirectoryRecursively(dir).ok());
+      databases_.emplace_back(new Database(dir));
+      MultiRaft::Options options;
+      options.node_id = nodes[i];
+      options.data_dir = dir;
+      options.group.proposal.max_delay_micros = 0;
+      multi_rafts_.emplace_back(new MultiRaft(options, databases_.back().get()));
+      nodes_[i] = multi_rafts_.back().get();
+    }
+    for (size_t i = 0; i < nodes.size(); ++i) {
+      for (size_t j = 0; j < nodes.size(); ++j) {
+        if (i != j) {
+          clients_.emplace_back(new LocalNodeClient(nodes[j], &nodes_[j]));
+          multi_rafts_[i]->AddNode(clients_.back().get());
+        }
+      }
+    }
+    info_ = ShardMap::MakeHashShards(6, nodes);
+    // 组 0 只有 a, b 两个 voter
+    info_.mutable_shards(0)->mutable_replicas()->RemoveLast();
+    for (auto& multi_raft : multi_rafts_) {
+      ASSERT_TRUE(multi_raft->SetShardMap(info_).ok());
+    }
+    // 每个组由首选 leader 当选
+    for (const ShardInfo& shard : info_.shards()) {
+      for (size_t i = 0; i < nodes.size(); ++i) {
+        RaftGroup* group = multi_rafts_[i]->GetGroup(shard.group_id());
+        if (group == nullptr) {
+          continue;
+        }
+        if (nodes[i] == shard.replicas(0)) {
+          group->BecomeLeader(1);
+        } else {
+          group->BecomeFollower(1, shard.replicas(0));
+        }
+      }
+    }
+  }
+
+  void TearDown() override {
+    multi_rafts_.clear();
+  }
+
+  void PumpAll() {
+    bool pumped = true;
+    while (pumped) {
+      pumped = false;
+      for (auto& client : clients_) {
+        pumped = client->Pump() || pumped;
+      }
+    }
+  }
+
+  std::vector<std::unique_ptr<Database>> databases_;
+  std::vector<std::unique_ptr<MultiRaft>> multi_rafts_;
+  std::vector<MultiRaft*> nodes_;
+  std::vector<std::unique_ptr<LocalNodeClient>> clients_;
+  ShardMapInfo info_;
+};
+
+} // namespace
+
+TEST(RaftGroup, StaleReadFollowsLeaderContact) {
+  const std::string dir = base::io::JoinPath(kTestDir, "stale");
+  base::int64 undeleted_files, undeleted_dirs;
+  base::Env::Default()->DeleteDirectoryRecursively(dir, &undeleted_files,
+                                                   &undeleted_dirs);
+  ASSERT_TRUE(base::Env::Default()->CreateDirectoryRecursively(dir).ok());
+  base::FakeClockEnv env;
+  Database database(base::io::JoinPath(dir, "data"));
+  UserInfo root;
+  root.set_username("root");
+  root.set_password("secret");
+  UserManager users(base::io::JoinPath(dir, "users"), root);
+  ASSERT_TRUE(users.Register("alice", "pw").ok());
+  ASSERT_TRUE(users.Login("alice", "pw", "u1").ok());
+  RaftGroup::Options options;
+  options.group_id = 1;
+  options.node_id = "b";
+  options.data_dir = dir;
+  options.replicator.env = &env;
+  options.users = &users;
+  RaftGroup group(options, &database, {});
+  group.BecomeFollower(1, "a");
+
+  GetRequest get;
+  get.set_key("k");
+  get.set_uuid("u1");
+  get.mutable_stale_read()->set_max_lag_ms(100);
+  GetResponse response;
+  // 还没有收到 leader 的日志
+  group.StaleGet(get, &response);
+  EXPECT_FALSE(response.success());
+
+  PutRequest put;
+  put.set_key("k");
+  put.set_value("v");
+  AppendEntriesRequest append;
+  append.set_term(1);
+  append.set_leader_id("a");
+  append.set_prev_log_index(-1);
+  append.set_leader_commit_index(0);
+  Entry* entry = append.add_entries();
+  *entry = ApplyPipeline::PutEntry(put, "alice");
+  entry->set_term(1);
+  AppendEntriesResponse append_response;
+  group.HandleAppendEntries(append, &append_response);
+  ASSERT_TRUE(append_response.success());
+  // apply 之前数据的新旧未知
+  group.StaleGet(get, &response);
+  EXPECT_FALSE(response.success());
+  EXPECT_EQ("a", response.leader_id());
+
+  // 经过 ApplyPipeline 写入 alice 的 namespace
+  {
+    ApplyPipeline::Options apply_options;
+    apply_options.name = "stale";
+    ApplyPipeline pipeline(apply_options, group.bin_logger(), &database, -1);
+    pipeline.Commit(0);
+    ASSERT_TRUE(pipeline.WaitApplied(0, 10 * 1000 * 1000));
+  }
+  group.Applied(0);
+  response.Clear();
+  group.StaleGet(get, &response);
+  EXPECT_TRUE(response.success());
+  EXPECT_TRUE(response.hit());
+  EXPECT_EQ("v", response.value());
+  EXPECT_EQ(0, response.last_applied());
+
+  // 没有登录的 uuid 读不到任何用户的数据
+  get.set_uuid("nobody");
+  response.Clear();
+  group.StaleGet(get, &response);
+  EXPECT_FALSE(response.success());
+  EXPECT_TRUE(response.uuid_expired());
+  EXPECT_FALSE(response.hit());
+  get.set_uuid("u1");
+
+  // 心跳推迟到达, 超过 max_lag_ms 后重定向到 leader
+  env.AdvanceMillis(150);
+  response.Clear();
+  group.StaleGet(get, &response);
+  EXPECT_FALSE(response.success());
+  EXPECT_EQ("a", response.leader_id());
+  ScanRequest scan;
+  scan.set_uuid("u1");
+  scan.mutable_stale_read()->set_max_lag_ms(200);
+  ScanResponse scan_response;
+  group.StaleScan(scan, &scan_response);
+  EXPECT_TRUE(scan_response.success());
+  ASSERT_EQ(1, scan_response.items_size());
+  EXPECT_EQ("k", scan_response.items(0).key());
+  scan.clear_uuid();
+  scan_response.Clear();
+  group.StaleScan(scan, &scan_response);
+  EXPECT_FALSE(scan_response.success());
+  EXPECT_TRUE(scan_response.uuid_expired());
+  EXPECT_EQ(0, scan_response.items_size());
+
+  GroupHeartbeat heartbeat;
+  heartbeat.set_group_id(1);
+  heartbeat.set_term(1);
+  heartbeat.set_commit_index(0);
+  GroupHeartbeatResponse heartbeat_response;
+  group.HandleHeartbeat("a", heartbeat, &heartbeat_response);
+  response.Clear();
+  group.StaleGet(get, &response);
+  EXPECT_TRUE(response.success());
+
+  // 没有 stale_read 的读只能由 leader 服务
+  get.clear_stale_read();
+  response.Clear();
+  group.StaleGet(get, &response);
+  EXPECT_FALSE(response.success());
+  EXPECT_EQ("a", response.leader_id());
+}
+
+TEST(RaftGroup, LeaderReadsWaitForApply) {
+  const std::string dir = base::io::JoinPath(kTestDir, "leader_read");
+  base::int64 undeleted_files, undeleted_dirs;
+  base::Env::Default()->DeleteDirectoryRecursively(dir, &undeleted_files,
+                                                   &undeleted_dirs);
+  ASSERT_TRUE(base::Env::Default()->CreateDirectoryRecursively(dir).ok());
+  Database database(base::io::JoinPath(dir, "data"));
+  UserInfo root;
+  root.set_username("root");
+  root.set_password("secret");
+  UserManager users(base::io::JoinPath(dir, "users"), root);
+  ASSERT_TRUE(users.Register("alice", "pw").ok());
+  ASSERT_TRUE(users.Login("alice", "pw", "u1").ok());
+  RaftGroup::Options options;
+  options.group_id = 1;
+  options.node_id = "a";
+  options.data_dir = dir;
+  options.proposal.max_delay_micros = 0;
+  options.read_index.lease_read = false;
+  options.users = &users;
+  AckingPeerClient peer("b");
+  RaftGroup group(options, &database, {&peer});
+
+  GetRequest get;
+  get.set_key("k");
+  get.set_uuid("u1");
+  GetResponse response;
+  bool done = false;
+  // follower 不服务线性一致读
+  group.BecomeFollower(1, "b");
+  group.Get(get, &response, [&done]() { done = true; });
+  EXPECT_TRUE(done);
+  EXPECT_FALSE(response.success());
+  EXPECT_EQ("b", response.leader_id());
+
+  group.BecomeLeader(2);
+  PutRequest put;
+  put.set_key("k");
+  put.set_value("v");
+  base::Status result = base::errors::Unknown("pending");
+  ASSERT_TRUE(group.Propose(ApplyPipeline::PutEntry(put, "alice"),
+                            [&result](const base::Status& s, int64_t) {
+    result = s;
+  }).ok());
+  peer.Pump();
+  ASSERT_TRUE(result.ok()) << result.ToString();
+  const int64_t commit_index = group.commit_index();
+  ASSERT_GE(commit_index, 0);
+
+  // 心跳确认 leader 身份之后还要等 apply 到 read_index
+  done = false;
+  response.Clear();
+  group.Get(get, &response, [&done]() { done = true; });
+  EXPECT_FALSE(done);
+  peer.Pump();
+  EXPECT_FALSE(done);
+  {
+    ApplyPipeline::Options apply_options;
+    apply_options.name = "leader_read";
+    ApplyPipeline pipeline(apply_options, group.bin_logger(), &database, -1);
+    pipeline.Commit(commit_index);
+    ASSERT_TRUE(pipeline.WaitApplied(commit_index, 10 * 1000 * 1000));
+  }
+  group.Applied(commit_index);
+  ASSERT_TRUE(done);
+  EXPECT_TRUE(response.success());
+  EXPECT_TRUE(response.hit());
+  EXPECT_EQ("v", response.value());
+  EXPECT_EQ(commit_index, response.last_applied());
+  EXPECT_EQ("a", response.leader_id());
+
+  ScanRequest scan;
+  scan.set_uuid("u1");
+  ScanResponse scan_response;
+  done = false;
+  group.Scan(scan, &scan_response, [&done]() { done = true; });
+  peer.Pump();
+  ASSERT_TRUE(done);
+  EXPECT_TRUE(scan_response.success());
+  ASSERT_EQ(1, scan_response.items_size());
+  EXPECT_EQ("k", scan_response.items(0).key());
+
+  // leader 拒绝陈旧读, 客户端应改用线性一致读
+  get.mutable_stale_read()->set_max_lag_ms(100);
+  response.Clear();
+  group.StaleGet(get, &response);
+  EXPECT_FALSE(response.success());
+  EXPECT_EQ("a", response.leader_id());
+  get.clear_stale_read();
+
+  // 心跳在途时退位, 读以失败结束
+  done = false;
+  response.Clear();
+  group.Get(get, &response, [&done]() { done = true; });
+  EXPECT_FALSE(done);
+  group.BecomeFollower(3, "b");
+  ASSERT_TRUE(done);
+  EXPECT_FALSE(response.success());
+  EXPECT_EQ("b", response.leader_id());
+  peer.Pump();
+}
+
+TEST(RaftGroup, VotesStickToLiveLeader) {
+  const std::string dir = base::io::JoinPath(kTestDir, "sticky");
+  base::int64 undeleted_files, undeleted_dirs;
+  base::Env::Default()->DeleteDirectoryRecursively(dir, &undeleted_files,
+                                                   &undeleted_dirs);
+  ASSERT_TRUE(base::Env::Default()->CreateDirectoryRecursively(dir).ok());
+  base::FakeClockEnv env;
+  Database database(dir);
+  RaftGroup::Options options;
+  options.group_id = 1;
+  options.node_id = "b";
+  options.data_dir = dir;
+  options.replicator.env = &env;
+  RaftGroup group(options, &database, {});
+  group.BecomeFollower(1, "a");
+
+  VoteRequest request;
+  request.set_term(2);
+  request.set_candidate_id("c");
+  request.set_last_log_index(-1);
+  request.set_last_log_term(-1);
+  request.set_group_id(1);
+  VoteResponse response;
+  // 没有开启 pre-vote 的候选者也不能打断存活的 leader, term 不变
+  group.HandleVote(request, &response);
+  EXPECT_FALSE(response.vote_granted());
+  EXPECT_EQ(1, response.term());
+  EXPECT_EQ(1, group.current_term());
+  EXPECT_EQ("a", group.leader_id());
+
+  // TimeoutNow 发起的选举不受限制
+  request.set_transfer(true);
+  response.Clear();
+  group.HandleVote(request, &response);
+  EXPECT_TRUE(response.vote_granted());
+  EXPECT_EQ(2, group.current_term());
+  EXPECT_EQ("c", group.voted_for());
+
+  // leader 失联超过选举超时后正常投票
+  group.BecomeFollower(3, "c");
+  request.set_term(4);
+  request.set_candidate_id("d");
+  request.set_transfer(false);
+  response.Clear();
+  group.HandleVote(request, &response);
+  EXPECT_FALSE(response.vote_granted());
+  env.AdvanceMillis(60 * 1000);
+  response.Clear();
+  group.HandleVote(request, &response);
+  EXPECT_TRUE(response.vote_granted());
+  EXPECT_EQ(4, group.current_term());
+}
+
+TEST(RaftGroup, UnpersistedTermAbortsTransition) {
+  const std::string dir = base::io::JoinPath(kTestDir, "term_full");
+  base::int64 undeleted_files, undeleted_dirs;
+  base::Env::Default()->DeleteDirectoryRecursively(dir, &undeleted_files,
+                                                   &undeleted_dirs);
+  // term 的写入总是失败
+  const std::string meta_dir =
+      base::io::JoinPath(dir, RaftGroup::NamespaceOf(1) + ".meta");
+  ASSERT_TRUE(base::Env::Default()->CreateDirectoryRecursively(meta_dir).ok());
+  ASSERT_EQ(0, symlink("/dev/full", base::io::JoinPath(meta_dir, "term.data").c_str()));
+  Database database(dir);
+  RaftGroup::Options options;
+  options.group_id = 1;
+  options.node_id = "b";
+  options.data_dir = dir;
+  RaftGroup group(options, &database, {});
+  const int64_t term = group.current_term();
+
+  VoteRequest vote;
+  vote.set_term(term + 1);
+  vote.set_candidate_id("c");
+  vote.set_last_log_index(-1);
+  vote.set_last_log_term(-1);
+  vote.set_group_id(1);
+  VoteResponse vote_response;
+  group.HandleVote(vote, &vote_response);
+  EXPECT_FALSE(vote_response.vote_granted());
+  EXPECT_EQ(term, vote_response.term());
+  EXPECT_EQ("", group.voted_for());
+
+  AppendEntriesRequest append;
+  append.set_term(term + 1);
+  append.set_leader_id("a");
+  append.set_prev_log_index(-1);
+  append.add_entries()->set_term(term + 1);
+  AppendEntriesResponse append_response;
+  group.HandleAppendEntries(append, &append_response);
+  EXPECT_FALSE(append_response.success());
+  EXPECT_EQ(0, group.bin_logger()->GetLength());
+  EXPECT_EQ("", group.leader_id());
+
+  group.BecomeLeader(term + 1);
+  EXPECT_FALSE(group.is_leader());
+  EXPECT_EQ(term, group.current_term());
+}
+
+TEST(RaftGroup, ConcurrentAppendsKeepIndexes) {
+  const std::string dir = base::io::JoinPath(kTestDir, "concurrent");
+  base::int64 undeleted_files, undeleted_dirs;
+  base::Env::Default()->DeleteDirectoryRecursively(dir, &undeleted_files,
+                                                   &undeleted_dirs);
+  ASSERT_TRUE(base::Env::Default()->CreateDirectoryRecursively(dir).ok());
+  Database database(dir);
+  RaftGroup::Options options;
+  options.group_id = 1;
+  options.node_id = "b";
+  options.data_dir = dir;
+  RaftGroup group(options, &database, {});
+  group.BecomeFollower(2, "a");
+
+  // 互相重叠的流水线请求, 每个覆盖 [2k, 2k + 5)
+  const int kRequests = 20;
+  std::vector<AppendEntriesRequest> requests(kRequests);
+  for (int k = 0; k < kRequests; ++k) {
+    AppendEntriesRequest& request = requests[k];
+    request.set_term(2);
+    request.set_leader_id("a");
+    request.set_prev_log_index(2 * k - 1);
+    request.set_prev_log_term(2);
+    for (int i = 2 * k; i < 2 * k + 5; ++i) {
+      Entry* entry = request.add_entries();
+      entry->set_term(2);
+      entry->set_key("key" + std::to_string(i));
+    }
+  }
+  // 旧 term 的请求总是被拒绝, 不会截断新 leader 的日志
+  AppendEntriesRequest stale;
+  stale.set_term(1);
+  stale.set_leader_id("c");
+  stale.set_prev_log_index(-1);
+  stale.add_entries()->set_term(1);
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([&group, &requests, &stale, t]() {
+      for (int round = 0; round < 3; ++round) {
+        for (size_t k = 0; k < requests.size(); ++k) {
+          // 一半的线程倒序发送, 制造乱序和重传
+          const size_t i = t % 2 == 0 ? k : requests.size() - 1 - k;
+          AppendEntriesResponse response;
+          group.HandleAppendEntries(requests[i], &response);
+          AppendEntriesResponse stale_response;
+          group.HandleAppendEntries(stale, &stale_response);
+          EXPECT_FALSE(stale_response.success());
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  ASSERT_EQ(2 * kRequests + 3, group.bin_logger()->GetLength());
+  for (int64_t i = 0; i < group.bin_logger()->GetLength(); ++i) {
+    LogEntry log_entry;
+    ASSERT_TRUE(group.bin_logger()->ReadSlot(i, &log_entry));
+    EXPECT_EQ("key" + std::to_string(i), log_entry.key);
+    EXPECT_EQ(2, log_entry.term);
+  }
+}
+
+TEST_F(MultiRaftTest, GroupsCommitIndependently) {
+  std::set<std::string> leaders;
+  std::vector<int64_t> indexes;
+  for (int i = 0; i < 30; ++i) {
+    std::string key = "key" + std::to_string(i);
+    ShardInfo shard;
+    RaftGroup* group = multi_rafts_[0]->Route(key, &shard);
+    ASSERT_NE(nullptr, group);
+    // 路由到 leader 所在的节点
+    RaftGroup* leader = nullptr;
+    for (auto& multi_raft : multi_rafts_) {
+      RaftGroup* g = multi_raft->GetGroup(shard.group_id());
+      if (g != nullptr && g->is_leader()) {
+        leader = g;
+      }
+    }
+    ASSERT_NE(nullptr, leader);
+    EXPECT_EQ(shard.replicas(0), leader->leader_id());
+    leaders.insert(leader->leader_id());
+
+    Entry entry;
+    entry.set_op(kPut);
+    entry.set_key(key);
+    base::Status result = base::errors::Unknown("pending");
+    ASSERT_TRUE(leader->Propose(entry, [&result](const base::Status& s, int64_t) {
+      result = s;
+    }).ok());
+    PumpAll();
+    EXPECT_TRUE(result.ok()) << result.ToString();
+  }
+  // leader 分布在所有节点上
+  EXPECT_EQ(3u, leaders.size());
+
+  // 各组的日志互相独立
+  int64_t total = 0;
+  for (const ShardInfo& shard : info_.shards()) {
+    RaftGroup* group = multi_rafts_[1]->GetGroup(shard.group_id());
+    total += group->bin_logger()->GetLength();
+    EXPECT_GE(group->commit_index(), -1);
+  }
+  EXPECT_EQ(30, total);
+}
+
+TEST_F(MultiRaftTest, CoalescesHeartbeats) {
+  // a 是 6 个组中 2 个组的 leader, 每个 follower 只收到一个心跳 RPC
+  multi_rafts_[0]->Tick();
+  int rpcs = 0;
+  for (auto& client : clients_) {
+    rpcs += client->heartbeat_rpcs();
+  }
+  EXPECT_EQ(2, rpcs);
+  PumpAll();
+
+  for (const ShardInfo& shard : info_.shards()) {
+    if (shard.replicas(0) == "a") {
+      RaftGroup* group = multi_rafts_[1]->GetGroup(shard.group_id());
+      EXPECT_EQ("a", group->leader_id());
+    }
+  }
+}
+
+TEST_F(MultiRaftTest, LearnerJoinsAtRuntime) {
+  // c 作为 learner 加入 a 为 leader 的组 0
+  ShardMapInfo info = info_;
+  info.set_version(2);
+  info.mutable_shards(0)->add_learners("c");
+  for (auto& multi_raft : multi_rafts_) {
+    ASSERT_TRUE(multi_raft->SetShardMap(info).ok());
+  }
+  EXPECT_EQ(kLearner, multi_rafts_[2]->GetGroup(0)->status());
+
+  RaftGroup* leader = multi_rafts_[0]->GetGroup(0);
+  std::vector<std::string> learners = leader->GetLearners();
+  ASSERT_EQ(1u, learners.size());
+  EXPECT_EQ("c", learners[0]);
+
+  Entry entry;
+  entry.set_op(kPut);
+  entry.set_key("key");
+  base::Status result = base::errors::Unknown("pending");
+  ASSERT_TRUE(leader->Propose(entry, [&result](const base::Status& s, int64_t) {
+    result = s;
+  }).ok());
+  PumpAll();
+  EXPECT_TRUE(result.ok());
+  EXPECT_EQ(1, multi_rafts_[2]->GetGroup(0)->bin_logger()->GetLength());
+
+  // 把 c 提升为 voter 需要成员变更, c 仍然是 learner
+  RaftGroup* learner = multi_rafts_[2]->GetGroup(0);
+  ShardMapInfo promoted = info;
+  promoted.set_version(3);
+  promoted.mutable_shards(0)->clear_learners();
+  promoted.mutable_shards(0)->add_replicas("c");
+  ASSERT_TRUE(multi_rafts_[2]->SetShardMap(promoted).ok());
+  EXPECT_EQ(kLearner, learner->status());
+
+  info.set_version(4);
+  info.mutable_shards(0)->clear_learners();
+  for (auto& multi_raft : multi_rafts_) {
+    ASSERT_TRUE(multi_raft->SetShardMap(info).ok());
+  }
+  EXPECT_TRUE(leader->GetLearners().empty());
+  // c 上的 learner 组不再接收请求
+  EXPECT_EQ(nullptr, multi_rafts_[2]->GetGroup(0));
+  AppendEntriesRequest request;
+  request.set_group_id(0);
+  AppendEntriesResponse response;
+  multi_rafts_[2]->HandleAppendEntries(request, &response);
+  EXPECT_FALSE(response.success());
+
+  // 重新加入时继续使用原来的日志
+  info.set_version(5);
+  info.mutable_shards(0)->add_learners("c");
+  ASSERT_TRUE(multi_rafts_[2]->SetShardMap(info).ok());
+  EXPECT_EQ(learner, multi_rafts_[2]->GetGroup(0));
+  EXPECT_EQ(1, learner->bin_logger()->GetLength());
+}
+
+TEST_F(MultiRaftTest, RejectedShardMapChangesNothing) {
+  ShardMapInfo info = info_;
+  info.set_version(2);
+  info.mutable_shards(0)->add_learners("c");
+  ShardInfo* added = info.add_shards();
+  *added = info.shards(1);
+  added->set_group_id(6);
+  // 排在最后的分片引用了未知节点
+  ShardInfo* unknown = info.add_shards();
+  *unknown = info.shards(1);
+  unknown->set_group_id(7);
+  unknown->add_learners("d");
+  EXPECT_TRUE(base::errors::IsNotFound(multi_rafts_[0]->SetShardMap(info)));
+  EXPECT_EQ(nullptr, multi_rafts_[0]->GetGroup(6));
+  EXPECT_TRUE(multi_rafts_[0]->GetGroup(0)->GetLearners().empty());
+
+  info.mutable_shards()->RemoveLast();
+  ASSERT_TRUE(multi_rafts_[0]->SetShardMap(info).ok());
+  EXPECT_NE(nullptr, multi_rafts_[0]->GetGroup(6));
+  EXPECT_EQ(1u, multi_rafts_[0]->GetGroup(0)->GetLearners().size());
+}
+
+TEST_F(MultiRaftTest, TransferLeadership) {
+  RaftGroup* a = multi_rafts_[0]->GetGroup(0);
+  RaftGroup* b = multi_rafts_[1]->GetGroup(0);
+  ASSERT_TRUE(a->is_leader());
+
+  // c 不是组 0 的 voter
+  base::Status result = base::errors::Unknown("pending");
+  multi_rafts_[0]->TransferLeadership(0, "c", [&result](const base::Status& s) {
+    result = s;
+  });
+  EXPECT_TRUE(base::errors::IsInvalidArgument(result)) << result.ToString();
+
+  result = base::errors::Unknown("pending");
+  multi_rafts_[0]->TransferLeadership(0, "b", [&result](const base::Status& s) {
+    result = s;
+  });
+  EXPECT_EQ("b", a->transfer_target());
+  // 转移期间不接受提案
+  Entry entry;
+  entry.set_op(kPut);
+  entry.set_key("key");
+  EXPECT_TRUE(base::errors::IsUnavailable(
+      a->Propose(entry, [](const base::Status&, int64_t) {})));
+
+  PumpAll();
+  EXPECT_TRUE(result.ok()) << result.ToString();
+  EXPECT_FALSE(a->is_leader());
+  EXPECT_TRUE(b->is_leader());
+  EXPECT_EQ("b", a->leader_id());
+  EXPECT_EQ(2, b->current_term());
+  EXPECT_TRUE(a->transfer_target().empty());
+
+  // 新 leader 的空日志已经提交
+  base::Status proposed = base::errors::Unknown("pending");
+  ASSERT_TRUE(b->Propose(entry, [&proposed](const base::Status& s, int64_t) {
+    proposed = s;
+  }).ok());
+  PumpAll();
+  EXPECT_TRUE(proposed.ok()) << proposed.ToString();
+  EXPECT_EQ(2, a->bin_logger()->GetLength());
+
+  // 非 leader 不能转移
+  result = base::errors::Unknown("pending");
+  multi_rafts_[0]->TransferLeadership(0, "b", [&result](const base::Status& s) {
+    result = s;
+  });
+  EXPECT_TRUE(base::errors::IsUnavailable(result)) << result.ToString();
+}
+
+TEST_F(MultiRaftTest, BalanceLeaders) {
+  // a 领导所有的组
+  for (const ShardInfo& shard : info_.shards()) {
+    for (size_t i = 0; i < multi_rafts_.size(); ++i) {
+      RaftGroup* group = multi_rafts_[i]->GetGroup(shard.group_id());
+      if (group == nullptr) {
+        continue;
+      }
+      if (i == 0) {
+        group->BecomeLeader(2);
+      } else {
+        group->BecomeFollower(2, "a");
+      }
+    }
+  }
+  EXPECT_EQ(4, multi_rafts_[0]->BalanceLeaders());
+  PumpAll();
+
+  std::map<std::string, int> leaders;
+  for (const ShardInfo& shard : info_.shards()) {
+    for (auto& multi_raft : multi_rafts_) {
+      RaftGroup* group = multi_raft->GetGroup(shard.group_id());
+      if (group != nullptr && group->is_leader()) {
+        leaders[group->leader_id()]++;
+      }
+    }
+  }
+  EXPECT_EQ(2, leaders["a"]);
+  EXPECT_EQ(2, leaders["b"]);
+  EXPECT_EQ(2, leaders["c"]);
+  // 已经均衡
+  EXPECT_EQ(0, multi_rafts_[0]->BalanceLeaders());
+}
+
+} // namespace chubby
+} // namespace mpr
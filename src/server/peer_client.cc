@@ -0,0 +1,36 @@
+#include "server/peer_client.h"
+
+#include "base/errors.h"
+
+namespace mpr {
+namespace chubby {
+
+void PeerClient::SendAppendEntries(const std::string& header,
+                                   const scoped_refptr<EncodedEntries>& entries,
+                                   AppendEntriesCallback done) {
+  AppendEntriesRequest request;
+  bool ok = request.ParseFromString(header);
+  if (ok && entries) {
+    ok = request.MergeFromString(entries->data());
+  }
+  if (!ok) {
+    done(base::errors::Internal("malformed AppendEntriesRequest"),
+         AppendEntriesResponse());
+    return;
+  }
+  AppendEntries(request, std::move(done));
+}
+
+void PeerClient::RequestVote(const VoteRequest& request, VoteCallback done) {
+  done(base::errors::Unimplemented("RequestVote not supported by ", peer_id()),
+       VoteResponse());
+}
+
+void PeerClient::TimeoutNow(const TimeoutNowRequest& request,
+                            TimeoutNowCallback done) {
+  done(base::errors::Unimplemented("TimeoutNow not supported by ", peer_id()),
+       TimeoutNowResponse());
+}
+
+} // namespace chubby
+} // namespace mpr
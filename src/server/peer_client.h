@@ -0,0 +1,52 @@
+#ifndef MPR_CHUBBY_SERVER_PEER_CLIENT_H_
+#define MPR_CHUBBY_SERVER_PEER_CLIENT_H_
+
+#include <functional>
+#include <string>
+
+#include "base/macros.h"
+#include "base/status.h"
+#include "proto/service.pb.h"
+#include "server/replication_encoder.h"
+
+namespace mpr {
+namespace chubby {
+
+// 节点之间的 RPC 通道. 所有调用都是异步的, done 可能在任意线程被调用,
+// 并且必须恰好调用一次. 使用者在销毁前需要保证不会再有回调.
+class PeerClient {
+ public:
+  typedef std::function<void(const base::Status&,
+                             const AppendEntriesResponse&)> AppendEntriesCallback;
+  typedef std::function<void(const base::Status&,
+                             const VoteResponse&)> VoteCallback;
+  typedef std::function<void(const base::Status&,
+                             const TimeoutNowResponse&)> TimeoutNowCallback;
+
+  PeerClient() {}
+  virtual ~PeerClient() {}
+
+  virtual const std::string& peer_id() const = 0;
+
+  virtual void AppendEntries(const AppendEntriesRequest& request,
+                             AppendEntriesCallback done) = 0;
+
+  // 已编码的 AppendEntriesRequest: header 之后接 entries->data(), entries 可以
+  // 为空. 传输层应直接发送这两段数据而不是重新解析, entries 在多个 follower
+  // 之间共享, 发送完成前需要持有引用. 默认实现解析后调用 AppendEntries.
+  virtual void SendAppendEntries(const std::string& header,
+                                 const scoped_refptr<EncodedEntries>& entries,
+                                 AppendEntriesCallback done);
+
+  // 选举和 pre-vote 共用, 默认实现返回 Unimplemented.
+  virtual void RequestVote(const VoteRequest& request, VoteCallback done);
+  // 转移领导权, 默认实现返回 Unimplemented.
+  virtual void TimeoutNow(const TimeoutNowRequest& request, TimeoutNowCallback done);
+
+ private:
+  DISALLOW_COPY_AND_ASSIGN(PeerClient);
+};
+
+} // namespace chubby
+} // namespace mpr
+#endif // MPR_CHUBBY_SERVER_PEER_CLIENT_H_
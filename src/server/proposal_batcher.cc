@@ -0,0 +1,223 @@
+#include "server/proposal_batcher.h"
+
+#include "base/errors.h"
+#include "base/logging.h"
+
+#include <gflags/gflags.h>
+
+DECLARE_int32(chubby_proposal_batch_delay);
+DECLARE_int32(chubby_proposal_batch_size);
+DECLARE_int32(chubby_proposal_batch_entries);
+
+namespace mpr {
+namespace chubby {
+
+namespace {
+
+int64_t EntryBytes(const Entry& entry) {
+  return entry.user().size() + entry.key().size() + entry.value().size() +
+         entry.dedup_key().size();
+}
+
+} // namespace
+
+ProposalBatcher::Options::Options()
+  : max_delay_micros(FLAGS_chubby_proposal_batch_delay),
+    max_batch_bytes(static_cast<int64_t>(FLAGS_chubby_proposal_batch_size) * 1024),
+    max_batch_entries(FLAGS_chubby_proposal_batch_entries),
+    env(base::Env::Default()) {}
+
+ProposalBatcher::ProposalBatcher(const Options& options, BinLogger* bin_logger)
+  : options_(options),
+    bin_logger_(bin_logger),
+    running_(false),
+    stopping_(false),
+    flushing_(false),
+    appending_(false),
+    term_(-1),
+    pending_bytes_(0),
+    first_pending_micros_(0),
+    committed_index_(-1) {
+  DCHECK(bin_logger_ != nullptr);
+  if (options_.max_delay_micros > 0) {
+    thread_.reset(options_.env->StartThread(base::ThreadOptions(),
+                                            "proposal_batcher",
+                                            [this]() { FlushLoop(); }));
+  }
+}
+
+ProposalBatcher::~ProposalBatcher() {
+  {
+    base::mutex_lock l(mu_);
+    stopping_ = true;
+    cv_.notify_all();
+  }
+  thread_.reset(nullptr);
+  Stop(base::errors::Cancelled("proposal batcher shutdown"));
+}
+
+void ProposalBatcher::Start(int64_t term) {
+  base::mutex_lock l(mu_);
+  running_ = true;
+  term_ = term;
+}
+
+void ProposalBatcher::Stop(const base::Status& status) {
+  std::vector<DoneCallback> dones;
+  {
+    base::mutex_lock l(mu_);
+    running_ = false;
+    // 否则旧 term 的批次可能追加在新 leader 的日志之后
+    while (appending_) {
+      cv_.wait(l);
+    }
+    for (auto& pending : pending_) {
+      dones.push_back(std::move(pending.done));
+    }
+    pending_.clear();
+    pending_bytes_ = 0;
+    for (auto& kv : waiting_) {
+      dones.push_back(std::move(kv.second));
+    }
+    waiting_.clear();
+  }
+  for (auto& done : dones) {
+    done(status, -1);
+  }
+}
+
+base::Status ProposalBatcher::Propose(const Entry& entry, DoneCallback done) {
+  base::mutex_lock l(mu_);
+  if (!running_) {
+    return base::errors::Unavailable("not leader");
+  }
+  if (pending_.empty()) {
+    first_pending_micros_ = options_.env->NowMicros();
+  }
+  pending_.push_back(Pending());
+  Pending& pending = pending_.back();
+  pending.entry = entry;
+  pending.entry.set_term(term_);
+  pending.done = std::move(done);
+  pending_bytes_ += EntryBytes(entry);
+
+  if (options_.max_delay_micros <= 0) {
+    DoFlush(&l);
+  } else if (pending_.size() == 1 || DoShouldFlush()) {
+    cv_.notify_all();
+  }
+  return base::Status::OK();
+}
+
+void ProposalBatcher::Commit(int64_t commit_index) {
+  std::vector<std::pair<int64_t, DoneCallback>> dones;
+  {
+    base::mutex_lock l(mu_);
+    if (commit_index > committed_index_) {
+      committed_index_ = commit_index;
+    }
+    auto end = waiting_.upper_bound(commit_index);
+    for (auto it = waiting_.begin(); it != end; ++it) {
+      dones.emplace_back(it->first, std::move(it->second));
+    }
+    waiting_.erase(waiting_.begin(), end);
+  }
+  for (auto& done : dones) {
+    done.second(base::Status::OK(), done.first);
+  }
+}
+
+void ProposalBatcher::Flush() {
+  base::mutex_lock l(mu_);
+  while (flushing_) {
+    cv_.wait(l);
+  }
+  DoFlush(&l);
+}
+
+void ProposalBatcher::FlushLoop() {
+  base::mutex_lock l(mu_);
+  while (!stopping_) {
+    if (pending_.empty() || flushing_) {
+      cv_.wait(l);
+      continue;
+    }
+    if (!DoShouldFlush()) {
+      uint64_t deadline = first_pending_micros_ + options_.max_delay_micros;
+      uint64_t now = options_.env->NowMicros();
+      if (deadline > now) {
+        cv_.wait_for(l, std::chrono::microseconds(deadline - now));
+        continue;
+      }
+    }
+    DoFlush(&l);
+  }
+}
+
+bool ProposalBatcher::DoShouldFlush() const {
+  return pending_bytes_ >= options_.max_batch_bytes ||
+         pending_.size() >= static_cast<size_t>(options_.max_batch_entries);
+}
+
+void ProposalBatcher::DoFlush(base::mutex_lock* l) {
+  // 同一时间只有一个线程写 binlog, 保证 index 的顺序与 pending_ 一致;
+  // 写入期间新到的请求由正在 flush 的线程继续处理.
+  if (flushing_) {
+    return;
+  }
+  flushing_ = true;
+  while (!pending_.empty() && running_) {
+    std::deque<Pending> batch;
+    int64_t batch_bytes = 0;
+    while (!pending_.empty() &&
+           batch.size() < static_cast<size_t>(options_.max_batch_entries) &&
+           batch_bytes < options_.max_batch_bytes) {
+      batch_bytes += EntryBytes(pending_.front().entry);
+      batch.push_back(std::move(pending_.front()));
+      pending_.pop_front();
+    }
+    pending_bytes_ -= batch_bytes;
+    first_pending_micros_ = options_.env->NowMicros();
+    const int64_t term = term_;
+    appending_ = true;
+    l->unlock();
+
+    ::google::protobuf::RepeatedPtrField<Entry> entries;
+    for (auto& pending : batch) {
+      entries.Add()->Swap(&pending.entry);
+    }
+    int64_t first_index = bin_logger_->AppendEntryList(entries);
+
+    std::vector<std::pair<int64_t, DoneCallback>> completed;
+    l->lock();
+    appending_ = false;
+    cv_.notify_all();
+    bool lost = !running_ || term != term_;
+    for (size_t i = 0; i < batch.size(); ++i) {
+      int64_t index = first_index + i;
+      if (lost || index <= committed_index_) {
+        completed.emplace_back(index, std::move(batch[i].done));
+      } else {
+        waiting_[index] = std::move(batch[i].done);
+      }
+    }
+    l->unlock();
+
+    if (!lost && options_.replicate_callback) {
+      options_.replicate_callback();
+    }
+    for (auto& done : completed) {
+      if (lost) {
+        done.second(base::errors::Unavailable("leadership lost"), done.first);
+      } else {
+        done.second(base::Status::OK(), done.first);
+      }
+    }
+    l->lock();
+  }
+  flushing_ = false;
+  cv_.notify_all();
+}
+
+} // namespace chubby
+} // namespace mpr
@@ -0,0 +1,96 @@
+#ifndef MPR_CHUBBY_SERVER_PROPOSAL_BATCHER_H_
+#define MPR_CHUBBY_SERVER_PROPOSAL_BATCHER_H_
+
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "base/macros.h"
+#include "base/status.h"
+#include "base/platform/env.h"
+#include "base/platform/mutex.h"
+#include "proto/service.pb.h"
+#include "storage/bin_logger.h"
+
+namespace mpr {
+namespace chubby {
+
+// Leader 端的写请求合并.
+//
+// Put/Delete/Lock/UnLock/Login 等写请求先进入 pending 队列, 攒够
+// max_delay_micros 或 max_batch_bytes 后用一次 AppendEntryList 写入 binlog,
+// 再调用 replicate_callback 让 Replicator 用一个 AppendEntriesRequest 发出.
+// 每个请求的 done 在它的日志提交 (Commit) 后被调用.
+class ProposalBatcher {
+ public:
+  typedef std::function<void(const base::Status& status, int64_t index)> DoneCallback;
+
+  struct Options {
+    // <= 0 时不启动后台线程, Propose 直接写入.
+    int64_t max_delay_micros;
+    int64_t max_batch_bytes;
+    int32_t max_batch_entries;
+    base::Env* env;
+    // 一批日志写入 binlog 后调用, 调用时不持有内部锁.
+    std::function<void()> replicate_callback;
+
+    Options();
+  };
+
+  ProposalBatcher(const Options& options, BinLogger* bin_logger);
+  ~ProposalBatcher();
+
+  // 成为 term 的 leader 后调用
+  void Start(int64_t term);
+  // 失去 leader 身份, 所有尚未提交的请求以 status 结束. 返回时没有正在写入
+  // binlog 的批次, 之后也不会再写入, follower 可以开始追加新 leader 的日志.
+  // 不在写入期间调用回调, 可以在 done 和 replicate_callback 中调用.
+  void Stop(const base::Status& status);
+
+  // entry 的 term 由 ProposalBatcher 填写. 非 leader 时返回 Unavailable,
+  // 此时 done 不会被调用.
+  base::Status Propose(const Entry& entry, DoneCallback done);
+
+  // commit_index 之前 (含) 的请求完成
+  void Commit(int64_t commit_index);
+
+  // 立即写入 pending 队列, 返回时之前 Propose 的请求都已写入 binlog
+  void Flush();
+
+ private:
+  struct Pending {
+    Entry entry;
+    DoneCallback done;
+  };
+
+  void FlushLoop();
+  bool DoShouldFlush() const;
+  void DoFlush(base::mutex_lock* l);
+
+  const Options options_;
+  BinLogger* bin_logger_;
+
+  base::mutex mu_;
+  base::condition_variable cv_;
+  bool running_;
+  bool stopping_;
+  bool flushing_;
+  // 取出批次到 AppendEntryList 返回之间, Stop 等待它结束
+  bool appending_;
+  int64_t term_;
+  std::deque<Pending> pending_;
+  int64_t pending_bytes_;
+  uint64_t first_pending_micros_;
+  int64_t committed_index_;
+  // 已写入 binlog 等待提交的请求, index -> done
+  std::map<int64_t, DoneCallback> waiting_;
+  std::unique_ptr<base::Thread> thread_;
+
+  DISALLOW_COPY_AND_ASSIGN(ProposalBatcher);
+};
+
+} // namespace chubby
+} // namespace mpr
+#endif // MPR_CHUBBY_SERVER_PROPOSAL_BATCHER_H_
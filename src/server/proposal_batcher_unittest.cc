@@ -0,0 +1,163 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
+
+#include "server/proposal_batcher.h"
+#include "base/platform/env.h"
+
+namespace mpr {
+namespace chubby {
+
+namespace {
+
+std::unique_ptr<BinLogger> NewBinLogger(const std::string& path) {
+  base::int64 undeleted_files, undeleted_dirs;
+  base::Env::Default()->DeleteDirectoryRecursively(path, &undeleted_files,
+                                                   &undeleted_dirs);
+  return std::unique_ptr<BinLogger>(new BinLogger(BinLogger::Options(path)));
+}
+
+Entry PutEntry(const std::string& key) {
+  Entry entry;
+  entry.set_op(kPut);
+  entry.set_key(key);
+  entry.set_value("value");
+  return entry;
+}
+
+} // namespace
+
+TEST(ProposalBatcher, NotLeader) {
+  std::unique_ptr<BinLogger> bin_logger = NewBinLogger("/tmp/proposal_batcher_test1");
+  ProposalBatcher::Options options;
+  options.max_delay_micros = 0;
+  ProposalBatcher batcher(options, bin_logger.get());
+  base::Status status = batcher.Propose(PutEntry("a"), nullptr);
+  EXPECT_EQ(base::error::UNAVAILABLE, status.code());
+}
+
+TEST(ProposalBatcher, CommitInOrder) {
+  std::unique_ptr<BinLogger> bin_logger = NewBinLogger("/tmp/proposal_batcher_test2");
+  int replicated = 0;
+  ProposalBatcher::Options options;
+  options.max_delay_micros = 0;
+  options.replicate_callback = [&replicated]() { replicated++; };
+  ProposalBatcher batcher(options, bin_logger.get());
+  batcher.Start(3);
+
+  std::vector<int64_t> done_indexes;
+  for (int i = 0; i < 5; ++i) {
+    EXPECT_TRUE(batcher.Propose(PutEntry(std::to_string(i)),
+        [&done_indexes](const base::Status& status, int64_t index) {
+          EXPECT_TRUE(status.ok());
+          done_indexes.push_back(index);
+        }).ok());
+  }
+  EXPECT_EQ(5, replicated);
+  EXPECT_EQ(5, bin_logger->GetLength());
+  LogEntry log_entry;
+  EXPECT_TRUE(bin_logger->ReadSlot(4, &log_entry));
+  EXPECT_EQ(3, log_entry.term);
+  EXPECT_EQ("4", log_entry.key);
+
+  batcher.Commit(2);
+  EXPECT_EQ(std::vector<int64_t>({0, 1, 2}), done_indexes);
+  batcher.Commit(4);
+  EXPECT_EQ(5u, done_indexes.size());
+}
+
+TEST(ProposalBatcher, BatchesConcurrentProposals) {
+  std::unique_ptr<BinLogger> bin_logger = NewBinLogger("/tmp/proposal_batcher_test3");
+  std::atomic<int> replicated(0);
+  ProposalBatcher::Options options;
+  options.max_delay_micros = 20000;
+  options.max_batch_entries = 64;
+  options.replicate_callback = [&replicated]() { replicated++; };
+  ProposalBatcher batcher(options, bin_logger.get());
+  batcher.Start(1);
+
+  const int kThreads = 8;
+  const int kProposals = 32;
+  std::atomic<int> done_count(0);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&batcher, &done_count, t]() {
+      for (int i = 0; i < kProposals; ++i) {
+        batcher.Propose(PutEntry(std::to_string(t) + "_" + std::to_string(i)),
+            [&done_count](const base::Status& status, int64_t index) {
+              done_count++;
+            });
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  batcher.Flush();
+  EXPECT_EQ(kThreads * kProposals, bin_logger->GetLength());
+  EXPECT_LT(replicated.load(), kThreads * kProposals / 4);
+
+  batcher.Commit(bin_logger->GetLength() - 1);
+  EXPECT_EQ(kThreads * kProposals, done_count.load());
+}
+
+TEST(ProposalBatcher, StopFailsWaiting) {
+  std::unique_ptr<BinLogger> bin_logger = NewBinLogger("/tmp/proposal_batcher_test4");
+  ProposalBatcher::Options options;
+  options.max_delay_micros = 0;
+  ProposalBatcher batcher(options, bin_logger.get());
+  batcher.Start(1);
+  base::Status result;
+  EXPECT_TRUE(batcher.Propose(PutEntry("a"),
+      [&result](const base::Status& status, int64_t index) {
+        result = status;
+      }).ok());
+  batcher.Stop(base::errors::Unavailable("step down"));
+  EXPECT_EQ(base::error::UNAVAILABLE, result.code());
+}
+
+TEST(ProposalBatcher, NoAppendAfterStop) {
+  std::unique_ptr<BinLogger> bin_logger = NewBinLogger("/tmp/proposal_batcher_test5");
+  ProposalBatcher::Options options;
+  options.max_delay_micros = 0;
+  options.max_batch_entries = 1;
+  ProposalBatcher* self = nullptr;
+  std::atomic<int> replicated(0);
+  // 第二轮在刷写线程的回调中退位, 不会死锁
+  options.replicate_callback = [&self, &replicated]() {
+    if (++replicated == 20 && self != nullptr) {
+      self->Stop(base::errors::Unavailable("step down"));
+    }
+  };
+  ProposalBatcher batcher(options, bin_logger.get());
+
+  for (int round = 0; round < 2; ++round) {
+    batcher.Start(round + 1);
+    std::atomic<bool> done(false);
+    std::thread proposer([&batcher, &done]() {
+      while (!done.load()) {
+        batcher.Propose(PutEntry("a"), [](const base::Status&, int64_t) {});
+      }
+    });
+    if (round == 0) {
+      while (bin_logger->GetLength() < 10) {
+        std::this_thread::yield();
+      }
+    } else {
+      self = &batcher;
+      while (replicated.load() < 20) {
+        std::this_thread::yield();
+      }
+    }
+    batcher.Stop(base::errors::Unavailable("step down"));
+    // Stop 返回后 follower 开始追加新 leader 的日志, 旧 term 的批次不能再写入
+    const int64_t length = bin_logger->GetLength();
+    base::Env::Default()->SleepForMicroseconds(10000);
+    EXPECT_EQ(length, bin_logger->GetLength());
+    done = true;
+    proposer.join();
+  }
+}
+
+} // namespace chubby
+} // namespace mpr
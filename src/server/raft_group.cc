@@ -0,0 +1,941 @@
+#include "server/raft_group.h"
+
+#include <algorithm>
+
+#include "base/errors.h"
+#include "base/logging.h"
+#include "base/io/path.h"
+#include "base/monitoring/monitoring.h"
+#include "base/platform/env.h"
+
+#include <gflags/gflags.h>
+
+DECLARE_bool(chubby_pre_vote);
+DECLARE_int32(chubby_transfer_leader_timeout);
+
+namespace mpr {
+namespace chubby {
+
+namespace {
+
+base::monitoring::Counter<>* stale_read_counter =
+    base::monitoring::Counter<>::New("chubby_stale_reads",
+                                     "Reads served by followers within the requested lag");
+
+ElectionTimer::Options ElectionOptions(const RaftGroup::Options& options) {
+  ElectionTimer::Options election = options.election;
+  // lease 内不能选出新 leader, 另外留出 1/4 给时钟漂移
+  const int64_t lease_micros = options.replicator.lease_micros;
+  if (lease_micros > 0) {
+    election.min_timeout_micros = std::max(election.min_timeout_micros,
+                                           lease_micros + lease_micros / 4);
+    election.max_timeout_micros = std::max(election.max_timeout_micros,
+                                           election.min_timeout_micros);
+  }
+  // 各节点的随机序列不能相同, 否则会同时超时并反复平票
+  election.seed ^= std::hash<std::string>()(options.node_id) +
+                   static_cast<uint64_t>(options.group_id);
+  return election;
+}
+
+} // namespace
+
+RaftGroup::Options::Options()
+  : group_id(0),
+    learner(false),
+    storage_env(nullptr),
+    pre_vote(FLAGS_chubby_pre_vote),
+    transfer_timeout_micros(FLAGS_chubby_transfer_leader_timeout * 1000LL),
+    users(nullptr) {}
+
+RaftGroup::RaftGroup(const Options& options, Database* database,
+                     const std::vector<PeerClient*>& peers)
+  : options_(options),
+    namespace_(NamespaceOf(options.group_id)),
+    database_(database),
+    peers_(peers),
+    env_(options.replicator.env),
+    stale_reads_(options.replicator.env),
+    term_(0),
+    leader_(false),
+    commit_index_(-1),
+    election_timer_(ElectionOptions(options)),
+    election_id_(0),
+    campaigning_(false),
+    pre_voting_(false),
+    transfer_deadline_micros_(0),
+    transfer_id_(0) {
+  std::string log_path = base::io::JoinPath(options_.data_dir, namespace_);
+  BinLogger::Options log_options(log_path);
+  log_options.env = options_.storage_env;
+  if (log_options.env == nullptr) {
+    base::Status status = base::Env::Default()->CreateDirectoryRecursively(log_path);
+    DCHECK(status.ok()) << status.ToString();
+    // 与 binlog 同级, binlog 目录下只有日志文件
+    meta_.reset(new Meta(log_path + ".meta"));
+    std::map<int64_t, std::string> votes;
+    meta_->ReadVotedFor(votes);
+    term_ = meta_->ReadCurrentTerm();
+    if (!votes.empty() && votes.rbegin()->first >= term_) {
+      term_ = votes.rbegin()->first;
+      voted_for_ = votes.rbegin()->second;
+    }
+  }
+  election_timer_.Reset(env_->NowMicros());
+  bin_logger_.reset(new BinLogger(log_options));
+  appender_.reset(new LogAppender(bin_logger_.get()));
+  database_->Open(namespace_);
+
+  Replicator::Options replicator_options = options_.replicator;
+  replicator_options.leader_id = options_.node_id;
+  replicator_options.commit_callback = [this](int64_t commit_index) {
+    HandleCommit(commit_index);
+  };
+  replicator_options.step_down_callback = [this](int64_t term) {
+    BecomeFollower(term, "");
+  };
+  replicator_.reset(new Replicator(replicator_options, bin_logger_.get(), peers));
+  ReadIndex::Options read_options = options_.read_index;
+  read_options.env = options_.replicator.env;
+  read_index_.reset(new ReadIndex(read_options, replicator_.get()));
+
+  ProposalBatcher::Options proposal_options = options_.proposal;
+  proposal_options.replicate_callback = [this]() { replicator_->Replicate(); };
+  proposals_.reset(new ProposalBatcher(proposal_options, bin_logger_.get()));
+
+  ApplyBacklog::Options backlog_options = options_.backlog;
+  if (backlog_options.name.empty()) {
+    backlog_options.name = options_.node_id + "/" + namespace_;
+  }
+  backlog_.reset(new ApplyBacklog(backlog_options));
+}
+
+RaftGroup::~RaftGroup() {
+  int64_t transfer_id;
+  {
+    base::mutex_lock l(mu_);
+    transfer_id = transfer_id_;
+  }
+  FinishTransfer(transfer_id, base::errors::Cancelled("group ", options_.group_id,
+                                                      " shutdown"));
+  read_index_->Stop(base::errors::Cancelled("group ", options_.group_id,
+                                            " shutdown"));
+  replicator_->Stop();
+  proposals_->Stop(base::errors::Cancelled("group ", options_.group_id,
+                                           " shutdown"));
+}
+
+// static
+std::string RaftGroup::NamespaceOf(int32_t group_id) {
+  return "group-" + std::to_string(group_id);
+}
+
+void RaftGroup::BecomeLeader(int64_t term) {
+  if (options_.learner) {
+    LOG(ERROR) << "[RaftGroup] learner " << options_.node_id
+               << " can not lead group " << options_.group_id;
+    return;
+  }
+  int64_t commit_index;
+  {
+    base::mutex_lock l(mu_);
+    // 当选后到这里之间可能已经看到了更大的 term
+    if (term < term_ || (term == term_ && leader_)) {
+      return;
+    }
+    if (!DoSetTerm(term).ok()) {
+      campaigning_ = false;
+      return;
+    }
+    campaigning_ = false;
+    leader_ = true;
+    leader_id_ = options_.node_id;
+    commit_index = commit_index_;
+  }
+  LOG(INFO) << "[RaftGroup] " << options_.node_id << " leads group "
+            << options_.group_id << ", term: " << term;
+  stale_reads_.Reset();
+  replicator_->Start(term, commit_index);
+  read_index_->Start();
+  proposals_->Start(term);
+}
+
+base::Status RaftGroup::BecomeFollower(int64_t term, const std::string& leader_id) {
+  bool was_leader;
+  TransferCallback transfer_done;
+  base::Status status;
+  {
+    base::mutex_lock l(mu_);
+    if (term < term_) {
+      return base::Status::OK();
+    }
+    was_leader = leader_;
+    status = DoSetTerm(term);
+    leader_ = false;
+    // term 没有落盘时不认可这个 leader
+    leader_id_ = status.ok() ? leader_id : std::string();
+    campaigning_ = false;
+    // 退位的 leader 和新 leader 的 follower 从现在开始计时. 只是看到更大
+    // term 的节点不重置, 日志更新的节点应该尽快发起选举.
+    if (was_leader || !leader_id.empty()) {
+      election_timer_.Reset(env_->NowMicros());
+    }
+    // 退位即完成转移, 之后 Replicator 停止时的回调被忽略
+    if (was_leader && !transfer_target_.empty()) {
+      transfer_target_.clear();
+      transfer_done = std::move(transfer_done_);
+      transfer_done_ = nullptr;
+    }
+  }
+  if (leader_id.empty()) {
+    stale_reads_.Reset();
+  }
+  if (was_leader) {
+    LOG(INFO) << "[RaftGroup] " << options_.node_id << " steps down from group "
+              << options_.group_id << ", term: " << term;
+    read_index_->Stop(base::errors::Unavailable("leadership lost"));
+    replicator_->Stop();
+    proposals_->Stop(base::errors::Unavailable("leadership lost"));
+  }
+  if (transfer_done) {
+    transfer_done(base::Status::OK());
+  }
+  return status;
+}
+
+void RaftGroup::AddLearner(PeerClient* peer) {
+  replicator_->AddLearner(peer);
+}
+
+bool RaftGroup::RemoveLearner(const std::string& peer_id) {
+  return replicator_->RemoveLearner(peer_id);
+}
+
+std::vector<std::string> RaftGroup::GetLearners() const {
+  std::vector<std::string> learners;
+  for (const auto& follower : replicator_->GetFollowerStatus()) {
+    if (follower.learner) {
+      learners.push_back(follower.peer_id);
+    }
+  }
+  return learners;
+}
+
+void RaftGroup::HandleAppendEntries(const AppendEntriesRequest& request,
+                                    AppendEntriesResponse* response) {
+  {
+    base::mutex_lock l(mu_);
+    if (request.term() < term_) {
+      response->set_current_term(term_);
+      response->set_success(false);
+      response->set_log_length(bin_logger_->GetLength());
+      return;
+    }
+  }
+  if (request.term() > current_term() || is_leader()) {
+    if (!BecomeFollower(request.term(), request.leader_id()).ok()) {
+      base::mutex_lock l(mu_);
+      response->set_current_term(term_);
+      response->set_success(false);
+      response->set_log_length(bin_logger_->GetLength());
+      return;
+    }
+  }
+  // 退位可能发生在其他线程 (Replicator 的 step_down_callback) 并且还没有
+  // 停止 ProposalBatcher; 已经停止时只检查没有正在写入的批次
+  proposals_->Stop(base::errors::Unavailable("leadership lost"));
+
+  {
+    // 同一组的 Append 串行执行. 等待期间可能已经处理了更大 term 的请求, 过期
+    // 的请求不能再截断新 leader 复制的日志.
+    base::mutex_lock append_lock(append_mu_);
+    {
+      base::mutex_lock l(mu_);
+      if (request.term() < term_ || leader_) {
+        response->set_current_term(term_);
+        response->set_success(false);
+        response->set_log_length(bin_logger_->GetLength());
+        return;
+      }
+    }
+    appender_->Append(request, response);
+  }
+  if (response->success() && request.entries_size() > 0) {
+    backlog_->Appended(request.prev_log_index() + 1,
+                       request.prev_log_index() + request.entries_size(),
+                       request.ByteSizeLong());
+  }
+  response->set_is_busy(backlog_->busy());
+  stale_reads_.LeaderContact(request.leader_id(), request.leader_commit_index());
+
+  base::mutex_lock l(mu_);
+  leader_id_ = request.leader_id();
+  campaigning_ = false;
+  election_timer_.Reset(env_->NowMicros(), request.heartbeat_interval_micros());
+  response->set_current_term(term_);
+  if (response->success()) {
+    // 只能提交与 leader 确认一致的部分
+    int64_t last_index = request.prev_log_index() + request.entries_size();
+    int64_t commit_index = std::min(request.leader_commit_index(), last_index);
+    commit_index_ = std::max(commit_index_, commit_index);
+  }
+}
+
+void RaftGroup::HandleHeartbeat(const std::string& leader_id,
+                                const GroupHeartbeat& heartbeat,
+                                GroupHeartbeatResponse* response) {
+  {
+    base::mutex_lock l(mu_);
+    if (heartbeat.term() < term_) {
+      response->set_current_term(term_);
+      response->set_success(false);
+      return;
+    }
+  }
+  if (heartbeat.term() > current_term() || is_leader()) {
+    if (!BecomeFollower(heartbeat.term(), leader_id).ok()) {
+      base::mutex_lock l(mu_);
+      response->set_current_term(term_);
+      response->set_success(false);
+      return;
+    }
+  }
+
+  // commit_index 不超过 leader 确认过的 match_index, 本地日志在此之前与
+  // leader 一致; 本地日志丢失了尾部时以实际长度为准.
+  int64_t commit_index = std::min(heartbeat.commit_index(),
+                                  bin_logger_->GetLength() - 1);
+  stale_reads_.LeaderContact(leader_id, heartbeat.commit_index());
+  base::mutex_lock l(mu_);
+  leader_id_ = leader_id;
+  campaigning_ = false;
+  election_timer_.Reset(env_->NowMicros(), heartbeat.heartbeat_interval_micros());
+  response->set_current_term(term_);
+  response->set_success(true);
+  commit_index_ = std::max(commit_index_, commit_index);
+}
+
+void RaftGroup::HandleVote(const VoteRequest& request, VoteResponse* response) {
+  int64_t last_log_index = -1;
+  int64_t last_log_term = -1;
+  bin_logger_->GetLastLogIndexAndTerm(&last_log_index, &last_log_term);
+  const bool up_to_date = request.last_log_term() > last_log_term ||
+      (request.last_log_term() == last_log_term &&
+       request.last_log_index() >= last_log_index);
+
+  if (request.pre_vote()) {
+    // 只回答是否会投票, 不改变任何状态. 最近还收到过 leader 的请求时拒绝.
+    base::mutex_lock l(mu_);
+    response->set_term(term_);
+    response->set_vote_granted(request.term() > term_ && up_to_date &&
+                               !DoLeaderAlive() && !options_.learner);
+    return;
+  }
+
+  if (!request.transfer()) {
+    // 没有开启 pre-vote 的节点也不能打断仍然存活的 leader: 直接拒绝, 不采用
+    // 请求中更大的 term
+    base::mutex_lock l(mu_);
+    if (DoLeaderAlive()) {
+      response->set_term(term_);
+      response->set_vote_granted(false);
+      VLOG(1) << "[RaftGroup] " << options_.node_id << " group " << options_.group_id
+              << " rejects vote for " << request.candidate_id()
+              << ", term: " << request.term() << ", leader " << leader_id_
+              << " alive";
+      return;
+    }
+  }
+
+  if (request.term() > current_term()) {
+    if (!BecomeFollower(request.term(), "").ok()) {
+      base::mutex_lock l(mu_);
+      response->set_term(term_);
+      response->set_vote_granted(false);
+      return;
+    }
+  }
+  base::mutex_lock l(mu_);
+  response->set_term(term_);
+  bool granted = request.term() == term_ && !leader_ && !options_.learner &&
+                 up_to_date && (voted_for_.empty() ||
+                                voted_for_ == request.candidate_id());
+  if (granted && voted_for_.empty()) {
+    // 投票必须先落盘再回复
+    if (meta_) {
+      base::Status status = meta_->WriteVotedFor(term_, request.candidate_id());
+      if (!status.ok()) {
+        LOG(ERROR) << "[RaftGroup] Failed to persist vote: " << status.ToString();
+        granted = false;
+      }
+    }
+    if (granted) {
+      voted_for_ = request.candidate_id();
+    }
+  }
+  if (granted) {
+    election_timer_.Reset(env_->NowMicros());
+  }
+  response->set_vote_granted(granted);
+  VLOG(1) << "[RaftGroup] " << options_.node_id << " group " << options_.group_id
+          << (granted ? " grants" : " rejects") << " vote for "
+          << request.candidate_id() << ", term: " << request.term();
+}
+
+void RaftGroup::TransferLeadership(const std::string& target_id,
+                                   TransferCallback done) {
+  std::string target = target_id;
+  if (target.empty()) {
+    int64_t match_index = -2;
+    for (const auto& follower : replicator_->GetFollowerStatus()) {
+      if (!follower.learner && follower.match_index > match_index) {
+        match_index = follower.match_index;
+        target = follower.peer_id;
+      }
+    }
+  }
+  base::Status status;
+  int64_t transfer_id = -1;
+  {
+    base::mutex_lock l(mu_);
+    if (!leader_) {
+      status = base::errors::Unavailable("not leader of group ", options_.group_id);
+    } else if (!transfer_target_.empty()) {
+      status = base::errors::FailedPrecondition("leadership transfer to ",
+                                                transfer_target_, " in progress");
+    } else if (target == options_.node_id) {
+      // 已经是 leader
+    } else if (FindPeer(target) == nullptr) {
+      status = base::errors::InvalidArgument("'", target, "' is not a voter of group ",
+                                             options_.group_id);
+    } else {
+      transfer_target_ = target;
+      transfer_deadline_micros_ = env_->NowMicros() + options_.transfer_timeout_micros;
+      transfer_done_ = std::move(done);
+      transfer_id = ++transfer_id_;
+    }
+  }
+  if (transfer_id < 0) {
+    if (done) {
+      done(status);
+    }
+    return;
+  }
+  LOG(INFO) << "[RaftGroup] " << options_.node_id << " transfers leadership of group "
+            << options_.group_id << " to " << target;
+  // 目标收到 TimeoutNow 后不受 lease 约束, 在发出之前放弃 lease, 之后的读走
+  // ReadIndex 的心跳确认
+  replicator_->SuspendLease();
+  WaitForTransferTarget(transfer_id);
+}
+
+void RaftGroup::WaitForTransferTarget(int64_t transfer_id) {
+  std::string target;
+  {
+    base::mutex_lock l(mu_);
+    if (transfer_id != transfer_id_ || transfer_target_.empty()) {
+      return;
+    }
+    target = transfer_target_;
+  }
+  int64_t last_log_index = -1;
+  int64_t last_log_term = -1;
+  bin_logger_->GetLastLogIndexAndTerm(&last_log_index, &last_log_term);
+  replicator_->WaitForMatch(target, last_log_index,
+      [this, transfer_id, last_log_index](const base::Status& status) {
+        HandleTransferTargetMatched(transfer_id, last_log_index, status);
+      });
+}
+
+void RaftGroup::HandleTransferTargetMatched(int64_t transfer_id, int64_t index,
+                                            const base::Status& status) {
+  if (!status.ok()) {
+    FinishTransfer(transfer_id, status);
+    return;
+  }
+  // 暂停之前已经进入 ProposalBatcher 的提案仍会追加, 需要等目标追上这些日志
+  int64_t last_log_index = -1;
+  int64_t last_log_term = -1;
+  bin_logger_->GetLastLogIndexAndTerm(&last_log_index, &last_log_term);
+  if (last_log_index > index) {
+    WaitForTransferTarget(transfer_id);
+    return;
+  }
+  TimeoutNowRequest request;
+  PeerClient* peer;
+  {
+    base::mutex_lock l(mu_);
+    if (transfer_id != transfer_id_ || transfer_target_.empty() || !leader_) {
+      return;
+    }
+    request.set_group_id(options_.group_id);
+    request.set_term(term_);
+    request.set_leader_id(options_.node_id);
+    peer = FindPeer(transfer_target_);
+  }
+  peer->TimeoutNow(request,
+      [this, transfer_id](const base::Status& status,
+                          const TimeoutNowResponse& response) {
+        // 成功时等待目标的 vote 请求使本节点退位
+        if (!status.ok()) {
+          FinishTransfer(transfer_id, status);
+        } else if (!response.success()) {
+          FinishTransfer(transfer_id, base::errors::Aborted(
+              "transfer target rejected TimeoutNow, term: ", response.term()));
+        }
+      });
+}
+
+void RaftGroup::FinishTransfer(int64_t transfer_id, const base::Status& status) {
+  TransferCallback done;
+  std::string target;
+  {
+    base::mutex_lock l(mu_);
+    if (transfer_id != transfer_id_ || transfer_target_.empty()) {
+      return;
+    }
+    target.swap(transfer_target_);
+    done = std::move(transfer_done_);
+    transfer_done_ = nullptr;
+  }
+  replicator_->ResumeLease();
+  LOG(WARNING) << "[RaftGroup] " << options_.node_id << " gives up transferring group "
+               << options_.group_id << " to " << target << ": " << status.ToString();
+  if (done) {
+    done(status);
+  }
+}
+
+void RaftGroup::HandleTimeoutNow(const TimeoutNowRequest& request,
+                                 TimeoutNowResponse* response) {
+  {
+    base::mutex_lock l(mu_);
+    response->set_term(term_);
+    if (request.term() != term_ || leader_ || options_.learner) {
+      response->set_success(false);
+      return;
+    }
+    response->set_success(true);
+  }
+  LOG(INFO) << "[RaftGroup] " << options_.node_id << " takes over group "
+            << options_.group_id << " from " << request.leader_id();
+  // leader 已经暂停提案, 不需要 pre-vote 确认它失效
+  Campaign(false, true);
+}
+
+void RaftGroup::Tick() {
+  if (is_leader()) {
+    replicator_->KeepAlive();
+    int64_t transfer_id = -1;
+    {
+      base::mutex_lock l(mu_);
+      if (!transfer_target_.empty() &&
+          env_->NowMicros() >= transfer_deadline_micros_) {
+        transfer_id = transfer_id_;
+      }
+    }
+    if (transfer_id >= 0) {
+      FinishTransfer(transfer_id, base::errors::DeadlineExceeded(
+          "leadership transfer timed out"));
+    }
+    return;
+  }
+  if (options_.learner) {
+    return;
+  }
+  {
+    base::mutex_lock l(mu_);
+    const uint64_t now = env_->NowMicros();
+    if (!election_timer_.Expired(now)) {
+      return;
+    }
+    // 选举没有结果时下一次超时重新开始
+    election_timer_.Reset(now);
+  }
+  Campaign(options_.pre_vote);
+}
+
+void RaftGroup::Campaign(bool pre_vote, bool transfer) {
+  VoteRequest request;
+  int64_t election_id;
+  bool quorum;
+  int64_t term;
+  {
+    base::mutex_lock l(mu_);
+    if (leader_) {
+      return;
+    }
+    election_id = ++election_id_;
+    campaigning_ = true;
+    pre_voting_ = pre_vote;
+    votes_.clear();
+    votes_.insert(options_.node_id);
+    if (!pre_vote) {
+      if (!DoSetTerm(term_ + 1).ok()) {
+        campaigning_ = false;
+        return;
+      }
+      leader_id_.clear();
+      if (meta_) {
+        base::Status status = meta_->WriteVotedFor(term_, options_.node_id);
+        if (!status.ok()) {
+          LOG(ERROR) << "[RaftGroup] Failed to persist vote: " << status.ToString();
+          campaigning_ = false;
+          return;
+        }
+      }
+      voted_for_ = options_.node_id;
+    }
+    term = pre_vote ? term_ + 1 : term_;
+    int64_t last_log_index = -1;
+    int64_t last_log_term = -1;
+    bin_logger_->GetLastLogIndexAndTerm(&last_log_index, &last_log_term);
+    request.set_term(term);
+    request.set_candidate_id(options_.node_id);
+    request.set_last_log_index(last_log_index);
+    request.set_last_log_term(last_log_term);
+    request.set_group_id(options_.group_id);
+    request.set_pre_vote(pre_vote);
+    request.set_transfer(transfer);
+    // 单节点的组不需要其他节点的投票
+    quorum = DoHasQuorum();
+  }
+  LOG(INFO) << "[RaftGroup] " << options_.node_id << " starts "
+            << (pre_vote ? "pre-vote" : "election") << " for group "
+            << options_.group_id << ", term: " << term;
+  if (quorum) {
+    if (pre_vote) {
+      Campaign(false);
+    } else {
+      WinElection(term);
+    }
+    return;
+  }
+  for (PeerClient* peer : peers_) {
+    const std::string peer_id = peer->peer_id();
+    peer->RequestVote(request,
+        [this, election_id, peer_id](const base::Status& status,
+                                     const VoteResponse& response) {
+          HandleVoteResponse(election_id, peer_id, status, response);
+        });
+  }
+}
+
+void RaftGroup::HandleVoteResponse(int64_t election_id, const std::string& peer_id,
+                                   const base::Status& status,
+                                   const VoteResponse& response) {
+  bool vote = false;
+  bool won = false;
+  int64_t term;
+  {
+    base::mutex_lock l(mu_);
+    if (election_id != election_id_ || !campaigning_ || leader_) {
+      return;
+    }
+    if (!status.ok()) {
+      VLOG(1) << "[RaftGroup] Vote request to " << peer_id << " failed: "
+              << status.ToString();
+      return;
+    }
+    if (response.term() > term_) {
+      // 本节点落后了, 退回 follower 等待新 leader 的请求. term 没有落盘时
+      // 同样放弃这次选举, 错误已经记录
+      DoSetTerm(response.term());
+      leader_id_.clear();
+      campaigning_ = false;
+      return;
+    }
+    if (!response.vote_granted()) {
+      return;
+    }
+    votes_.insert(peer_id);
+    if (!DoHasQuorum()) {
+      return;
+    }
+    campaigning_ = false;
+    term = term_;
+    if (pre_voting_) {
+      vote = true;
+    } else {
+      won = true;
+    }
+  }
+  if (vote) {
+    Campaign(false);
+  } else if (won) {
+    WinElection(term);
+  }
+}
+
+void RaftGroup::WinElection(int64_t term) {
+  BecomeLeader(term);
+  // 通过计数只能提交当前 term 的日志, 立即提交一条空日志以确认之前的日志
+  if (is_leader()) {
+    Entry entry;
+    entry.set_op(kNop);
+    proposals_->Propose(entry, [](const base::Status&, int64_t) {});
+  }
+}
+
+base::Status RaftGroup::DoSetTerm(int64_t term) {
+  if (term <= term_) {
+    return base::Status::OK();
+  }
+  // 先落盘再修改内存中的 term, 失败时保持原来的 term
+  if (meta_) {
+    base::Status status = meta_->WriteCurrentTerm(term);
+    if (!status.ok()) {
+      LOG(ERROR) << "[RaftGroup] Failed to persist term " << term << ": "
+                 << status.ToString();
+      return status;
+    }
+  }
+  term_ = term;
+  voted_for_.clear();
+  return base::Status::OK();
+}
+
+bool RaftGroup::DoLeaderAlive() const {
+  return leader_ ||
+      (!leader_id_.empty() && election_timer_.Recent(env_->NowMicros()));
+}
+
+bool RaftGroup::DoHasQuorum() const {
+  return votes_.size() >= (peers_.size() + 1) / 2 + 1;
+}
+
+void RaftGroup::Applied(int64_t index) {
+  backlog_->Applied(index);
+  stale_reads_.Applied(index);
+  read_index_->Applied(index);
+}
+
+base::Status RaftGroup::CheckStaleRead(bool has_stale_read,
+                                       const StaleRead& stale_read,
+                                       int64_t* last_applied,
+                                       std::string* leader_id) const {
+  if (is_leader()) {
+    *last_applied = -1;
+    *leader_id = options_.node_id;
+    return base::errors::FailedPrecondition("leader reads through Get/Scan");
+  }
+  base::Status status = stale_reads_.CheckRead(stale_read, last_applied, leader_id);
+  if (status.ok() && !has_stale_read) {
+    return base::errors::Unavailable("not leader");
+  }
+  return status;
+}
+
+std::string RaftGroup::ResolveUser(const std::string& uuid) const {
+  if (options_.users == nullptr || uuid.empty()) {
+    return std::string();
+  }
+  return options_.users->GetUsernameFromUUID(uuid);
+}
+
+void RaftGroup::Get(const GetRequest& request, GetResponse* response,
+                    ReadDone done) {
+  read_index_->Read([this, request, response, done](const base::Status& status,
+                                                    int64_t read_index) {
+    if (!status.ok()) {
+      response->set_leader_id(leader_id());
+      response->set_success(false);
+    } else {
+      response->set_leader_id(options_.node_id);
+      response->set_last_applied(read_index);
+      LocalGet(request, response);
+    }
+    done();
+  });
+}
+
+void RaftGroup::Scan(const ScanRequest& request, ScanResponse* response,
+                     ReadDone done) {
+  read_index_->Read([this, request, response, done](const base::Status& status,
+                                                    int64_t read_index) {
+    if (!status.ok()) {
+      response->set_leader_id(leader_id());
+      response->set_success(false);
+    } else {
+      response->set_leader_id(options_.node_id);
+      response->set_last_applied(read_index);
+      LocalScan(request, response);
+    }
+    done();
+  });
+}
+
+void RaftGroup::StaleGet(const GetRequest& request, GetResponse* response) {
+  int64_t last_applied;
+  std::string leader_id;
+  base::Status status = CheckStaleRead(request.has_stale_read(),
+                                       request.stale_read(), &last_applied,
+                                       &leader_id);
+  response->set_leader_id(leader_id);
+  response->set_last_applied(last_applied);
+  if (!status.ok()) {
+    response->set_success(false);
+    return;
+  }
+  LocalGet(request, response);
+  if (response->success()) {
+    stale_read_counter->Increment();
+  }
+}
+
+void RaftGroup::StaleScan(const ScanRequest& request, ScanResponse* response) {
+  int64_t last_applied;
+  std::string leader_id;
+  base::Status status = CheckStaleRead(request.has_stale_read(),
+                                       request.stale_read(), &last_applied,
+                                       &leader_id);
+  response->set_leader_id(leader_id);
+  response->set_last_applied(last_applied);
+  if (!status.ok()) {
+    response->set_success(false);
+    return;
+  }
+  LocalScan(request, response);
+  if (response->success()) {
+    stale_read_counter->Increment();
+  }
+}
+
+void RaftGroup::LocalGet(const GetRequest& request, GetResponse* response) {
+  const std::string user = ResolveUser(request.uuid());
+  if (user.empty()) {
+    response->set_uuid_expired(true);
+    response->set_success(false);
+    return;
+  }
+  std::string value;
+  // 没有写入过的用户没有 namespace, 同样是未命中
+  base::Status status = database_->Get(user, request.key(), &value);
+  if (!status.ok() && !base::errors::IsNotFound(status)) {
+    LOG(ERROR) << "[RaftGroup] get failed: " << status.ToString();
+    response->set_success(false);
+    return;
+  }
+  response->set_success(true);
+  response->set_hit(status.ok());
+  if (status.ok()) {
+    response->set_value(value);
+  }
+}
+
+void RaftGroup::LocalScan(const ScanRequest& request, ScanResponse* response) {
+  const std::string user = ResolveUser(request.uuid());
+  if (user.empty()) {
+    response->set_uuid_expired(true);
+    response->set_success(false);
+    return;
+  }
+  std::unique_ptr<Database::Iterator> it(database_->NewIterator(user));
+  if (!it) {
+    // 没有写入过的用户
+    response->set_success(true);
+    return;
+  }
+  for (it->Seek(request.start_key()); it->Valid(); it->Next()) {
+    std::string key = it->key();
+    if (!request.end_key().empty() && key >= request.end_key()) {
+      break;
+    }
+    if (request.size_limit() > 0 && response->items_size() >= request.size_limit()) {
+      response->set_has_more(true);
+      break;
+    }
+    ScanItem* item = response->add_items();
+    item->set_key(std::move(key));
+    item->set_value(it->value());
+  }
+  if (!it->status().ok()) {
+    LOG(ERROR) << "[RaftGroup] scan failed: " << it->status().ToString();
+    response->clear_items();
+    response->set_has_more(false);
+    response->set_success(false);
+    return;
+  }
+  response->set_success(true);
+}
+
+base::Status RaftGroup::Propose(const Entry& entry,
+                                ProposalBatcher::DoneCallback done) {
+  {
+    base::mutex_lock l(mu_);
+    if (!transfer_target_.empty()) {
+      return base::errors::Unavailable("leadership transfer to ", transfer_target_,
+                                       " in progress");
+    }
+  }
+  return proposals_->Propose(entry, std::move(done));
+}
+
+int64_t RaftGroup::current_term() const {
+  base::mutex_lock l(mu_);
+  return term_;
+}
+
+bool RaftGroup::is_leader() const {
+  base::mutex_lock l(mu_);
+  return leader_;
+}
+
+NodeStatus RaftGroup::status() const {
+  base::mutex_lock l(mu_);
+  if (leader_) {
+    return kLeader;
+  }
+  return options_.learner ? kLearner : kFollower;
+}
+
+std::string RaftGroup::leader_id() const {
+  base::mutex_lock l(mu_);
+  return leader_id_;
+}
+
+int64_t RaftGroup::commit_index() const {
+  base::mutex_lock l(mu_);
+  return commit_index_;
+}
+
+std::string RaftGroup::voted_for() const {
+  base::mutex_lock l(mu_);
+  return voted_for_;
+}
+
+std::vector<std::string> RaftGroup::GetVoters() const {
+  std::vector<std::string> voters;
+  if (!options_.learner) {
+    voters.push_back(options_.node_id);
+  }
+  for (PeerClient* peer : peers_) {
+    voters.push_back(peer->peer_id());
+  }
+  return voters;
+}
+
+std::string RaftGroup::transfer_target() const {
+  base::mutex_lock l(mu_);
+  return transfer_target_;
+}
+
+PeerClient* RaftGroup::FindPeer(const std::string& peer_id) const {
+  for (PeerClient* peer : peers_) {
+    if (peer->peer_id() == peer_id) {
+      return peer;
+    }
+  }
+  return nullptr;
+}
+
+void RaftGroup::HandleCommit(int64_t commit_index) {
+  {
+    base::mutex_lock l(mu_);
+    commit_index_ = std::max(commit_index_, commit_index);
+  }
+  proposals_->Commit(commit_index);
+}
+
+} // namespace chubby
+} // namespace mpr
@@ -0,0 +1,224 @@
+#ifndef MPR_CHUBBY_SERVER_RAFT_GROUP_H_
+#define MPR_CHUBBY_SERVER_RAFT_GROUP_H_
+
+#include <functional>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "base/macros.h"
+#include "base/status.h"
+#include "base/platform/mutex.h"
+#include "proto/service.pb.h"
+#include "server/apply_backlog.h"
+#include "server/election_timer.h"
+#include "server/log_appender.h"
+#include "server/peer_client.h"
+#include "server/proposal_batcher.h"
+#include "server/read_index.h"
+#include "server/replicator.h"
+#include "server/stale_read.h"
+#include "server/user_manager.h"
+#include "storage/bin_logger.h"
+#include "storage/database.h"
+#include "storage/meta.h"
+
+namespace mpr {
+namespace chubby {
+
+// 一个共识组在本节点上的副本: 独立的 binlog, Database 中独立的 namespace,
+// 以及作为 leader 时的 Replicator 和 ProposalBatcher.
+//
+// 选举由 Tick 驱动: follower 的 ElectionTimer 超时后先发起 pre-vote, 多数派
+// 认为 leader 已经失效并且本节点日志足够新时才增加 term 正式选举. 被隔离后
+// 重新加入的节点因此不会打断正常工作的 leader. 正式的投票请求同样在 leader
+// 存活时被拒绝, 不依赖候选者是否开启 pre-vote. term 和投票在回复之前持久化.
+//
+// leader 可以主动转移领导权 (滚动重启, 均衡各节点上的 leader): 暂停接受提案,
+// 等目标节点追上日志后发送 TimeoutNow, 目标跳过 pre-vote 立即发起选举, 投票
+// 请求带有 transfer 标记, 投票者不检查 leader 是否存活.
+// 这次选举不等待 lease 过期, 所以转移期间 leader 不使用也不续约 lease.
+class RaftGroup {
+ public:
+  typedef std::function<void(const base::Status& status)> TransferCallback;
+  typedef std::function<void()> ReadDone;
+
+  struct Options {
+    int32_t group_id;
+    std::string node_id;
+    // binlog 存放在 data_dir/group-<id>
+    std::string data_dir;
+    // learner 只接收日志, 不会成为 leader
+    bool learner;
+    // binlog 使用的 leveldb Env, 为空时使用磁盘
+    leveldb::Env* storage_env;
+    Replicator::Options replicator;
+    ProposalBatcher::Options proposal;
+    // env 使用 replicator.env
+    ReadIndex::Options read_index;
+    // follower 端 apply 积压超过上限时让 leader 限流
+    ApplyBacklog::Options backlog;
+    // 选举超时的下限会被提高到 replicator.lease_micros 之上
+    ElectionTimer::Options election;
+    bool pre_vote;
+    // 领导权转移在这段时间内没有完成时放弃, 恢复接受提案
+    int64_t transfer_timeout_micros;
+    // 陈旧读用它把请求的 uuid 解析为用户, 读取该用户的 namespace. 为空时
+    // 拒绝所有陈旧读. 由调用者持有
+    UserManager* users;
+
+    Options();
+  };
+
+  // peers 由调用者持有, 生命周期需要长于 RaftGroup.
+  RaftGroup(const Options& options, Database* database,
+            const std::vector<PeerClient*>& peers);
+  ~RaftGroup();
+
+  static std::string NamespaceOf(int32_t group_id);
+
+  // 当选后调用, 也可以由调用者直接指定 leader. term 小于当前 term 时忽略.
+  // 新的 term 无法持久化时放弃当选.
+  void BecomeLeader(int64_t term);
+  // 新的 term 无法持久化时仍然退位, 但保持原来的 term 并返回错误
+  base::Status BecomeFollower(int64_t term, const std::string& leader_id);
+
+  // 作为 leader 时增减 learner, 不影响多数派
+  void AddLearner(PeerClient* peer);
+  bool RemoveLearner(const std::string& peer_id);
+  std::vector<std::string> GetLearners() const;
+
+  // follower 端处理 leader 的 AppendEntries 或心跳
+  void HandleAppendEntries(const AppendEntriesRequest& request,
+                           AppendEntriesResponse* response);
+  // 合并心跳中本组的部分, 不做日志一致性检查
+  void HandleHeartbeat(const std::string& leader_id, const GroupHeartbeat& heartbeat,
+                       GroupHeartbeatResponse* response);
+
+  // 处理其他节点的 vote 或 pre-vote
+  void HandleVote(const VoteRequest& request, VoteResponse* response);
+
+  // 把领导权交给 target_id, 为空时选择日志最新的 voter. 本节点退位后以 OK
+  // 调用 done; 超时或目标拒绝时恢复接受提案并返回错误. 转移期间 Propose
+  // 返回 Unavailable.
+  void TransferLeadership(const std::string& target_id, TransferCallback done);
+  // 目标端: term 与 leader 一致时立即发起选举
+  void HandleTimeoutNow(const TimeoutNowRequest& request,
+                        TimeoutNowResponse* response);
+
+  // 周期调用, 间隔应远小于最小选举超时: leader 保持 follower 不超时,
+  // follower 选举超时后发起选举.
+  void Tick();
+
+  // apply 到 index 之后调用, 释放 follower 端的积压和等待 apply 的 leader 读
+  void Applied(int64_t index);
+
+  // leader 端的线性一致读: 由 ReadIndex 确认 leader 身份, 等本地 apply 到
+  // read_index 后读取. 完成后调用 done, 可能在调用线程, 心跳回调或 Applied
+  // 的线程中. 非 leader 时 success 为 false, leader_id 供客户端重定向.
+  // response 需要在 done 之前保持有效.
+  void Get(const GetRequest& request, GetResponse* response, ReadDone done);
+  void Scan(const ScanRequest& request, ScanResponse* response, ReadDone done);
+
+  // follower (包括 learner) 端的有界陈旧读, 落后程度由 StaleReadTracker 根据
+  // leader 的 AppendEntries 和心跳估计. 请求没有 stale_read, 本地数据不满足
+  // 要求或者本节点是 leader (应当调用 Get/Scan) 时 success 为 false, leader_id
+  // 供客户端重定向. 读取 uuid 所属用户的 namespace, 即 ApplyPipeline 写入
+  // kPut/kDel 的位置; uuid 无效时 success 为 false 并设置 uuid_expired.
+  void StaleGet(const GetRequest& request, GetResponse* response);
+  // 返回 [start_key, end_key) 内最多 size_limit 项, end_key 为空表示不限,
+  // size_limit 不大于 0 表示不限
+  void StaleScan(const ScanRequest& request, ScanResponse* response);
+
+  // 非 leader 时返回 Unavailable
+  base::Status Propose(const Entry& entry, ProposalBatcher::DoneCallback done);
+
+  int32_t group_id() const { return options_.group_id; }
+  const std::string& namespace_name() const { return namespace_; }
+  int64_t current_term() const;
+  bool is_leader() const;
+  bool is_learner() const { return options_.learner; }
+  NodeStatus status() const;
+  std::string leader_id() const;
+  int64_t commit_index() const;
+  std::string voted_for() const;
+  // 包括本节点在内有投票权的成员
+  std::vector<std::string> GetVoters() const;
+  // 正在转移领导权时返回目标节点
+  std::string transfer_target() const;
+
+  BinLogger* bin_logger() { return bin_logger_.get(); }
+  Replicator* replicator() { return replicator_.get(); }
+  const ApplyBacklog* backlog() const { return backlog_.get(); }
+
+ private:
+  void HandleCommit(int64_t commit_index);
+  // transfer 为 true 时是 TimeoutNow 发起的选举, 投票者跳过 leader 存活检查
+  void Campaign(bool pre_vote, bool transfer = false);
+  void HandleVoteResponse(int64_t election_id, const std::string& peer_id,
+                          const base::Status& status, const VoteResponse& response);
+  void WinElection(int64_t term);
+  void WaitForTransferTarget(int64_t transfer_id);
+  void HandleTransferTargetMatched(int64_t transfer_id, int64_t index,
+                                   const base::Status& status);
+  void FinishTransfer(int64_t transfer_id, const base::Status& status);
+  PeerClient* FindPeer(const std::string& peer_id) const;
+  // term 不大于当前 term 时不做任何事. 持久化失败时返回错误, term 不变
+  base::Status DoSetTerm(int64_t term);
+  bool DoHasQuorum() const;
+  // 本节点是 leader, 或者选举超时内收到过 leader 的请求
+  bool DoLeaderAlive() const;
+  base::Status CheckStaleRead(bool has_stale_read, const StaleRead& stale_read,
+                              int64_t* last_applied, std::string* leader_id) const;
+  // 没有登录或者没有设置 users 时返回空串
+  std::string ResolveUser(const std::string& uuid) const;
+  // 读本地状态机, 不检查数据的新旧
+  void LocalGet(const GetRequest& request, GetResponse* response);
+  void LocalScan(const ScanRequest& request, ScanResponse* response);
+
+  const Options options_;
+  const std::string namespace_;
+  Database* database_;
+  std::unique_ptr<BinLogger> bin_logger_;
+  std::unique_ptr<LogAppender> appender_;
+  std::unique_ptr<Replicator> replicator_;
+  // leader 端的线性一致读
+  std::unique_ptr<ReadIndex> read_index_;
+  std::unique_ptr<ProposalBatcher> proposals_;
+  std::unique_ptr<ApplyBacklog> backlog_;
+  // 为空时 term 和投票不持久化
+  std::unique_ptr<Meta> meta_;
+  // 有投票权的其他成员
+  const std::vector<PeerClient*> peers_;
+  base::Env* env_;
+  // follower 端的数据落后程度
+  StaleReadTracker stale_reads_;
+  // 串行化 follower 端的日志写入, 在 mu_ 之前获取
+  base::mutex append_mu_;
+
+  mutable base::mutex mu_;
+  int64_t term_;
+  std::string voted_for_;
+  bool leader_;
+  std::string leader_id_;
+  int64_t commit_index_;
+  ElectionTimer election_timer_;
+  // 每次发起 (pre-)vote 时递增, 之前的响应被忽略
+  int64_t election_id_;
+  bool campaigning_;
+  bool pre_voting_;
+  std::set<std::string> votes_;
+  // 非空时正在把领导权转移给该节点
+  std::string transfer_target_;
+  uint64_t transfer_deadline_micros_;
+  TransferCallback transfer_done_;
+  // 每次转移递增, 之前的回调被忽略
+  int64_t transfer_id_;
+
+  DISALLOW_COPY_AND_ASSIGN(RaftGroup);
+};
+
+} // namespace chubby
+} // namespace mpr
+#endif // MPR_CHUBBY_SERVER_RAFT_GROUP_H_
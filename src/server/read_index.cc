@@ -0,0 +1,159 @@
+#include "server/read_index.h"
+
+#include <memory>
+
+#include "base/errors.h"
+#include "base/logging.h"
+
+#include <gflags/gflags.h>
+
+DECLARE_bool(chubby_lease_read);
+
+namespace mpr {
+namespace chubby {
+
+ReadIndex::Options::Options()
+  : lease_read(FLAGS_chubby_lease_read),
+    env(base::Env::Default()) {}
+
+ReadIndex::ReadIndex(const Options& options, Replicator* replicator)
+  : options_(options),
+    replicator_(replicator),
+    running_(false),
+    confirming_(false),
+    applied_index_(-1) {
+  DCHECK(replicator_ != nullptr);
+}
+
+ReadIndex::~ReadIndex() {
+  Stop(base::errors::Cancelled("read index shutdown"));
+}
+
+void ReadIndex::Start() {
+  base::mutex_lock l(mu_);
+  running_ = true;
+}
+
+void ReadIndex::Stop(const base::Status& status) {
+  std::vector<ReadCallback> dones;
+  {
+    base::mutex_lock l(mu_);
+    running_ = false;
+    dones.swap(next_reads_);
+    for (auto& kv : waiting_) {
+      dones.push_back(std::move(kv.second));
+    }
+    waiting_.clear();
+  }
+  // 在途一轮中的请求由 HandleConfirm 结束
+  for (auto& done : dones) {
+    done(status, -1);
+  }
+}
+
+void ReadIndex::Read(ReadCallback done) {
+  std::vector<std::pair<int64_t, ReadCallback>> ready;
+  std::vector<ReadCallback> reads;
+  {
+    base::mutex_lock l(mu_);
+    if (!running_) {
+      l.unlock();
+      done(base::errors::Unavailable("not leader"), -1);
+      return;
+    }
+    if (options_.lease_read &&
+        options_.env->NowMicros() < replicator_->lease_expiry_micros()) {
+      DoWaitApply(replicator_->commit_index(), std::move(done), &ready);
+    } else {
+      next_reads_.push_back(std::move(done));
+      if (!confirming_) {
+        confirming_ = true;
+        reads.swap(next_reads_);
+      }
+    }
+  }
+  for (auto& read : ready) {
+    read.second(base::Status::OK(), read.first);
+  }
+  if (!reads.empty()) {
+    StartRound(&reads);
+  }
+}
+
+void ReadIndex::Applied(int64_t applied_index) {
+  std::vector<std::pair<int64_t, ReadCallback>> ready;
+  {
+    base::mutex_lock l(mu_);
+    if (applied_index <= applied_index_) {
+      return;
+    }
+    applied_index_ = applied_index;
+    auto end = waiting_.upper_bound(applied_index);
+    for (auto it = waiting_.begin(); it != end; ++it) {
+      ready.emplace_back(it->first, std::move(it->second));
+    }
+    waiting_.erase(waiting_.begin(), end);
+  }
+  for (auto& read : ready) {
+    read.second(base::Status::OK(), read.first);
+  }
+}
+
+void ReadIndex::StartRound(std::vector<ReadCallback>* reads) {
+  // Heartbeat 可能在当前线程直接回调, 调用时不能持有 mu_.
+  std::shared_ptr<std::vector<ReadCallback>> batch(
+      new std::vector<ReadCallback>());
+  batch->swap(*reads);
+  VLOG(1) << "[ReadIndex] confirm leadership for " << batch->size() << " reads";
+  replicator_->Heartbeat(
+      [this, batch](const base::Status& status, int64_t commit_index) {
+        HandleConfirm(batch.get(), status, commit_index);
+      });
+}
+
+void ReadIndex::HandleConfirm(std::vector<ReadCallback>* reads,
+                              const base::Status& status, int64_t read_index) {
+  std::vector<std::pair<int64_t, ReadCallback>> ready;
+  std::vector<ReadCallback> failed;
+  std::vector<ReadCallback> next_reads;
+  base::Status result = status;
+  {
+    base::mutex_lock l(mu_);
+    if (!running_ && result.ok()) {
+      result = base::errors::Unavailable("not leader");
+    }
+    if (result.ok()) {
+      for (auto& done : *reads) {
+        DoWaitApply(read_index, std::move(done), &ready);
+      }
+    } else {
+      failed.swap(*reads);
+    }
+    confirming_ = false;
+    if (running_ && !next_reads_.empty()) {
+      confirming_ = true;
+      next_reads.swap(next_reads_);
+    }
+  }
+  for (auto& done : failed) {
+    done(result, -1);
+  }
+  for (auto& read : ready) {
+    read.second(base::Status::OK(), read.first);
+  }
+  if (!next_reads.empty()) {
+    StartRound(&next_reads);
+  }
+}
+
+void ReadIndex::DoWaitApply(int64_t read_index, ReadCallback done,
+                            std::vector<std::pair<int64_t, ReadCallback>>* ready) {
+  if (read_index <= applied_index_) {
+    ready->emplace_back(read_index, std::move(done));
+  } else {
+    waiting_.emplace(read_index, std::move(done));
+  }
+}
+
+} // namespace chubby
+} // namespace mpr
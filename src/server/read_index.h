@@ -0,0 +1,79 @@
+#ifndef MPR_CHUBBY_SERVER_READ_INDEX_H_
+#define MPR_CHUBBY_SERVER_READ_INDEX_H_
+
+#include <functional>
+#include <map>
+#include <utility>
+#include <vector>
+
+#include "base/macros.h"
+#include "base/status.h"
+#include "base/platform/env.h"
+#include "base/platform/mutex.h"
+#include "server/replicator.h"
+
+namespace mpr {
+namespace chubby {
+
+// Leader 端的线性一致读, 读请求不写 binlog.
+//
+// ReadIndex: 记下当前 commit_index 作为 read_index, 用一轮心跳确认自己仍是
+// leader, 等状态机 apply 到 read_index 后在本地读取. 心跳进行期间到达的读
+// 请求合并到下一轮, 所以一轮心跳可以服务任意多个并发读.
+//
+// Lease read: 上一轮心跳确认后的 lease 内不会出现新 leader, 直接使用当前的
+// commit_index, 省掉一轮心跳. 依赖各节点时钟漂移有界, 默认关闭.
+class ReadIndex {
+ public:
+  typedef std::function<void(const base::Status& status, int64_t read_index)> ReadCallback;
+
+  struct Options {
+    bool lease_read;
+    base::Env* env;
+
+    Options();
+  };
+
+  // replicator 由调用者持有, 生命周期需要长于 ReadIndex, 并且在 ReadIndex
+  // 销毁前停止.
+  ReadIndex(const Options& options, Replicator* replicator);
+  ~ReadIndex();
+
+  // 成为 leader 后调用
+  void Start();
+  // 失去 leader 身份, 所有尚未完成的读请求以 status 结束
+  void Stop(const base::Status& status);
+
+  // done 在 read_index 之前 (含) 的日志都已 apply 后调用, 此时读本地状态机
+  // 满足线性一致. 非 leader 时 done 以 Unavailable 调用.
+  void Read(ReadCallback done);
+
+  // 状态机 apply 到 applied_index 后调用
+  void Applied(int64_t applied_index);
+
+ private:
+  void StartRound(std::vector<ReadCallback>* reads);
+  void HandleConfirm(std::vector<ReadCallback>* reads,
+                     const base::Status& status, int64_t read_index);
+  void DoWaitApply(int64_t read_index, ReadCallback done,
+                   std::vector<std::pair<int64_t, ReadCallback>>* ready);
+
+  const Options options_;
+  Replicator* replicator_;
+
+  base::mutex mu_;
+  bool running_;
+  // 是否有一轮心跳在途
+  bool confirming_;
+  // 等待下一轮心跳的读请求
+  std::vector<ReadCallback> next_reads_;
+  int64_t applied_index_;
+  // 已确认 leader 身份, 等待 apply 的读请求, read_index -> done
+  std::multimap<int64_t, ReadCallback> waiting_;
+
+  DISALLOW_COPY_AND_ASSIGN(ReadIndex);
+};
+
+} // namespace chubby
+} // namespace mpr
+#endif // MPR_CHUBBY_SERVER_READ_INDEX_H_
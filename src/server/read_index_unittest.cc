@@ -0,0 +1,189 @@
+#include <gtest/gtest.h>
+#include <deque>
+
+#include "server/read_index.h"
+#include "base/errors.h"
+#include "base/platform/env.h"
+
+namespace mpr {
+namespace chubby {
+
+namespace {
+
+class FakePeerClient : public PeerClient {
+ public:
+  explicit FakePeerClient(const std::string& id) : id_(id) {}
+
+  const std::string& peer_id() const override { return id_; }
+
+  void AppendEntries(const AppendEntriesRequest& request,
+                     AppendEntriesCallback done) override {
+    pending_.emplace_back(request, done);
+  }
+
+  size_t pending() const { return pending_.size(); }
+
+  void Reply(bool success) {
+    auto call = pending_.front();
+    pending_.pop_front();
+    AppendEntriesResponse response;
+    response.set_current_term(call.first.term());
+    response.set_success(success);
+    response.set_log_length(call.first.prev_log_index() + 1 +
+                            call.first.entries_size());
+    call.second(base::Status::OK(), response);
+  }
+
+  void Fail() {
+    auto call = pending_.front();
+    pending_.pop_front();
+    call.second(base::errors::Unavailable("connection refused"),
+                AppendEntriesResponse());
+  }
+
+ private:
+  std::string id_;
+  std::deque<std::pair<AppendEntriesRequest, AppendEntriesCallback>> pending_;
+};
+
+struct ReadResult {
+  int count = 0;
+  base::Status status;
+  int64_t read_index = -1;
+
+  ReadIndex::ReadCallback Callback() {
+    return [this](const base::Status& s, int64_t index) {
+      count++;
+      status = s;
+      read_index = index;
+    };
+  }
+};
+
+class ReadIndexTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    base::int64 undeleted_files, undeleted_dirs;
+    base::Env::Default()->DeleteDirectoryRecursively(
+        "/tmp/read_index_test", &undeleted_files, &undeleted_dirs);
+    bin_logger_.reset(new BinLogger(BinLogger::Options("/tmp/read_index_test")));
+  }
+
+  void StartLeader(int64_t lease_micros, bool lease_read) {
+    Replicator::Options options;
+    options.leader_id = "leader";
+    options.lease_micros = lease_micros;
+    replicator_.reset(new Replicator(options, bin_logger_.get(),
+                                     {&peer1_, &peer2_}));
+    ReadIndex::Options read_options;
+    read_options.lease_read = lease_read;
+    read_index_.reset(new ReadIndex(read_options, replicator_.get()));
+    replicator_->Start(1, -1);
+    read_index_->Start();
+  }
+
+  // 提交一条当前 term 的日志
+  void CommitEntry() {
+    LogEntry log_entry;
+    log_entry.term = 1;
+    bin_logger_->AppendEntry(log_entry);
+    replicator_->Replicate();
+    peer1_.Reply(true);
+    peer2_.Reply(true);
+  }
+
+  void TearDown() override {
+    replicator_->Stop();
+    read_index_.reset();
+  }
+
+  FakePeerClient peer1_{"peer1"};
+  FakePeerClient peer2_{"peer2"};
+  std::unique_ptr<BinLogger> bin_logger_;
+  std::unique_ptr<Replicator> replicator_;
+  std::unique_ptr<ReadIndex> read_index_;
+};
+
+} // namespace
+
+TEST_F(ReadIndexTest, BatchesConcurrentReads) {
+  StartLeader(0, false);
+  CommitEntry();
+  ASSERT_EQ(0, replicator_->commit_index());
+
+  ReadResult r1, r2, r3;
+  read_index_->Read(r1.Callback());
+  ASSERT_EQ(1u, peer1_.pending());
+  // 心跳在途时到达的请求合并到下一轮
+  read_index_->Read(r2.Callback());
+  read_index_->Read(r3.Callback());
+  EXPECT_EQ(1u, peer1_.pending());
+
+  // 一个 follower 确认即构成多数派, 但还要等 apply
+  peer1_.Reply(true);
+  EXPECT_EQ(0, r1.count);
+  ASSERT_EQ(1u, peer1_.pending());
+  peer1_.Reply(true);
+  read_index_->Applied(0);
+  EXPECT_EQ(1, r1.count);
+  EXPECT_TRUE(r1.status.ok());
+  EXPECT_EQ(0, r1.read_index);
+  EXPECT_EQ(1, r2.count);
+  EXPECT_EQ(1, r3.count);
+  EXPECT_EQ(2u, peer2_.pending());
+}
+
+TEST_F(ReadIndexTest, RequiresCommitInTerm) {
+  StartLeader(0, false);
+  ReadResult r;
+  read_index_->Read(r.Callback());
+  peer1_.Reply(true);
+  EXPECT_EQ(1, r.count);
+  EXPECT_TRUE(base::errors::IsUnavailable(r.status));
+}
+
+TEST_F(ReadIndexTest, QuorumUnreachable) {
+  StartLeader(0, false);
+  CommitEntry();
+  read_index_->Applied(0);
+  ReadResult r;
+  read_index_->Read(r.Callback());
+  peer1_.Fail();
+  EXPECT_EQ(0, r.count);
+  // 被拒绝的心跳同样说明对方承认当前 term
+  peer2_.Reply(false);
+  EXPECT_EQ(1, r.count);
+  EXPECT_TRUE(r.status.ok());
+
+  read_index_->Read(r.Callback());
+  peer1_.Fail();
+  peer2_.Fail();
+  EXPECT_EQ(2, r.count);
+  EXPECT_TRUE(base::errors::IsUnavailable(r.status));
+}
+
+TEST_F(ReadIndexTest, LeaseRead) {
+  StartLeader(10 * 1000 * 1000, true);
+  CommitEntry();
+  read_index_->Applied(0);
+  EXPECT_EQ(0u, replicator_->lease_expiry_micros());
+
+  ReadResult r;
+  read_index_->Read(r.Callback());
+  ASSERT_EQ(1u, peer1_.pending());
+  peer1_.Reply(true);
+  EXPECT_EQ(1, r.count);
+  EXPECT_GT(replicator_->lease_expiry_micros(), base::Env::Default()->NowMicros());
+
+  // lease 内不再发送心跳
+  read_index_->Read(r.Callback());
+  EXPECT_EQ(2, r.count);
+  EXPECT_TRUE(r.status.ok());
+  EXPECT_EQ(0u, peer1_.pending());
+
+  replicator_->Stop();
+  EXPECT_EQ(0u, replicator_->lease_expiry_micros());
+}
+
+} // namespace chubby
+} // namespace mpr
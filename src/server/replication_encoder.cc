@@ -0,0 +1,121 @@
+#include "server/replication_encoder.h"
+
+#include "base/coding.h"
+#include "base/logging.h"
+
+namespace mpr {
+namespace chubby {
+
+namespace {
+
+// AppendEntriesRequest.entries 的 tag: field 6, length-delimited
+const char kEntriesTag = (6 << 3) | 2;
+
+void LogEntryToEntry(const LogEntry& log_entry, Entry* entry) {
+  entry->set_key(log_entry.key);
+  entry->set_value(log_entry.value);
+  entry->set_term(log_entry.term);
+  entry->set_op(log_entry.log_operation);
+  entry->set_user(log_entry.user);
+  if (!log_entry.dedup_key.empty()) {
+    entry->set_dedup_key(log_entry.dedup_key);
+  }
+}
+
+} // namespace
+
+ReplicationEncoder::ReplicationEncoder(BinLogger* bin_logger,
+                                       int32_t max_batch_entries,
+                                       int64_t max_batch_bytes,
+                                       int64_t max_cached_bytes)
+  : bin_logger_(bin_logger),
+    max_batch_entries_(max_batch_entries),
+    max_batch_bytes_(max_batch_bytes),
+    max_cached_bytes_(max_cached_bytes),
+    cached_bytes_(0) {
+  DCHECK(bin_logger_ != nullptr);
+}
+
+scoped_refptr<EncodedEntries> ReplicationEncoder::Encode(int64_t first_index,
+                                                         int64_t last_log_index) {
+  bool cache = true;
+  auto it = cache_.find(first_index);
+  if (it != cache_.end()) {
+    const EncodedEntries& cached = *it->second;
+    // 被限流的 follower 要求的批次比缓存的小, 单独编码, 不替换共享的批次
+    if (cached.last_index() > last_log_index) {
+      cache = false;
+      it = cache_.end();
+    }
+  }
+  if (it != cache_.end()) {
+    const EncodedEntries& cached = *it->second;
+    // 编码时日志还不够一批的, 有新日志后重新编码
+    if (cached.count() >= max_batch_entries_ ||
+        static_cast<int64_t>(cached.data().size()) >= max_batch_bytes_ ||
+        cached.last_index() >= last_log_index) {
+      return it->second;
+    }
+    cached_bytes_ -= cached.data().size();
+    cache_.erase(it);
+  }
+
+  scoped_refptr<EncodedEntries> encoded(new EncodedEntries(first_index));
+  std::string* data = &encoded->data_;
+  Entry entry;
+  for (int64_t index = first_index;
+       index <= last_log_index && encoded->count_ < max_batch_entries_ &&
+       static_cast<int64_t>(data->size()) < max_batch_bytes_; ++index) {
+    LogEntry log_entry;
+    if (!bin_logger_->ReadSlot(index, &log_entry)) {
+      LOG(WARNING) << "[ReplicationEncoder] Failed to read slot: " << index;
+      break;
+    }
+    LogEntryToEntry(log_entry, &entry);
+    data->push_back(kEntriesTag);
+    base::PutVarint32(data, entry.ByteSizeLong());
+    entry.AppendToString(data);
+    encoded->count_++;
+  }
+  if (encoded->count_ == 0) {
+    return scoped_refptr<EncodedEntries>();
+  }
+  if (!cache) {
+    return encoded;
+  }
+
+  cache_[first_index] = encoded;
+  cached_bytes_ += data->size();
+  Evict();
+  return encoded;
+}
+
+void ReplicationEncoder::Clear() {
+  cache_.clear();
+  cached_bytes_ = 0;
+}
+
+// static
+void ReplicationEncoder::EncodeHeader(const AppendEntriesRequest& header,
+                                      std::string* out) {
+  if (header.entries_size() == 0) {
+    header.SerializeToString(out);
+    return;
+  }
+  AppendEntriesRequest copy;
+  copy.CopyFrom(header);
+  copy.clear_entries();
+  copy.SerializeToString(out);
+}
+
+void ReplicationEncoder::Evict() {
+  // 正在发送的批次由 scoped_refptr 持有, 淘汰只影响之后的复用
+  while (cached_bytes_ > max_cached_bytes_ && cache_.size() > 1) {
+    auto it = cache_.begin();
+    cached_bytes_ -= it->second->data().size();
+    cache_.erase(it);
+  }
+}
+
+} // namespace chubby
+} // namespace mpr
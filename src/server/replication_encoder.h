@@ -0,0 +1,80 @@
+#ifndef MPR_CHUBBY_SERVER_REPLICATION_ENCODER_H_
+#define MPR_CHUBBY_SERVER_REPLICATION_ENCODER_H_
+
+#include <map>
+#include <string>
+
+#include "base/macros.h"
+#include "base/ref_counted.h"
+#include "proto/service.pb.h"
+#include "storage/bin_logger.h"
+
+namespace mpr {
+namespace chubby {
+
+// 一批序列化好的日志, 即 AppendEntriesRequest 中 repeated entries 字段的
+// 编码. 同一批日志发往多个 follower 时共享同一份.
+class EncodedEntries : public base::RefCounted<EncodedEntries> {
+ public:
+  int64_t first_index() const { return first_index_; }
+  int64_t last_index() const { return first_index_ + count_ - 1; }
+  int32_t count() const { return count_; }
+  const std::string& data() const { return data_; }
+
+ private:
+  friend class ReplicationEncoder;
+  friend class base::RefCounted<EncodedEntries>;
+
+  explicit EncodedEntries(int64_t first_index)
+    : first_index_(first_index), count_(0) {}
+  ~EncodedEntries() {}
+
+  int64_t first_index_;
+  int32_t count_;
+  std::string data_;
+
+  DISALLOW_COPY_AND_ASSIGN(EncodedEntries);
+};
+
+// 按起始 index 缓存最近编码的日志批次.
+//
+// protobuf 的编码可以直接拼接: 只包含 term/prev_log_index 等字段的 header
+// 编码后接上 EncodedEntries::data() 就是完整的 AppendEntriesRequest. 进度相同
+// 的 follower 得到同一个批次, 每批日志只读取和序列化一次.
+//
+// 非线程安全, 由调用者加锁.
+class ReplicationEncoder {
+ public:
+  // max_cached_bytes 限制缓存的总大小, 超过时淘汰起始 index 最小的批次.
+  ReplicationEncoder(BinLogger* bin_logger, int32_t max_batch_entries,
+                     int64_t max_batch_bytes, int64_t max_cached_bytes);
+
+  // 返回从 first_index 开始, 不超过 last_log_index 的一批日志. 读取失败时
+  // 返回空指针. 缓存的批次超出 last_log_index 时另行编码, 不进入缓存.
+  scoped_refptr<EncodedEntries> Encode(int64_t first_index, int64_t last_log_index);
+
+  // 日志被截断或换了 leader 时调用
+  void Clear();
+
+  int64_t cached_bytes() const { return cached_bytes_; }
+
+  // header 中的 entries 字段被忽略
+  static void EncodeHeader(const AppendEntriesRequest& header, std::string* out);
+
+ private:
+  void Evict();
+
+  BinLogger* bin_logger_;
+  const int32_t max_batch_entries_;
+  const int64_t max_batch_bytes_;
+  const int64_t max_cached_bytes_;
+
+  std::map<int64_t, scoped_refptr<EncodedEntries>> cache_;
+  int64_t cached_bytes_;
+
+  DISALLOW_COPY_AND_ASSIGN(ReplicationEncoder);
+};
+
+} // namespace chubby
+} // namespace mpr
+#endif // MPR_CHUBBY_SERVER_REPLICATION_ENCODER_H_
@@ -0,0 +1,100 @@
+#include <gtest/gtest.h>
+
+#include "server/replication_encoder.h"
+#include "base/platform/env.h"
+
+namespace mpr {
+namespace chubby {
+
+namespace {
+
+std::unique_ptr<BinLogger> NewBinLogger(const std::string& path, int64_t n) {
+  base::int64 undeleted_files, undeleted_dirs;
+  base::Env::Default()->DeleteDirectoryRecursively(path, &undeleted_files,
+                                                   &undeleted_dirs);
+  std::unique_ptr<BinLogger> bin_logger(new BinLogger(BinLogger::Options(path)));
+  for (int64_t i = 0; i < n; ++i) {
+    LogEntry log_entry;
+    log_entry.log_operation = kPut;
+    log_entry.user = "user";
+    log_entry.key = "key" + std::to_string(i);
+    log_entry.value = std::string(100, 'v');
+    log_entry.term = 1;
+    bin_logger->AppendEntry(log_entry);
+  }
+  return bin_logger;
+}
+
+} // namespace
+
+TEST(ReplicationEncoder, HeaderAndEntriesConcatenate) {
+  std::unique_ptr<BinLogger> bin_logger = NewBinLogger("/tmp/replication_encoder_test1", 10);
+  ReplicationEncoder encoder(bin_logger.get(), 4, 1 << 20, 1 << 20);
+  scoped_refptr<EncodedEntries> entries = encoder.Encode(3, 9);
+  ASSERT_TRUE(entries);
+  EXPECT_EQ(3, entries->first_index());
+  EXPECT_EQ(6, entries->last_index());
+
+  AppendEntriesRequest header;
+  header.set_term(2);
+  header.set_leader_id("leader");
+  header.set_prev_log_index(2);
+  header.set_prev_log_term(1);
+  header.set_leader_commit_index(1);
+  header.set_group_id(3);
+  header.set_heartbeat_interval_micros(50000);
+  // header 中的 entries 被忽略, 其他字段都保留
+  header.add_entries()->set_key("ignored");
+  std::string data;
+  ReplicationEncoder::EncodeHeader(header, &data);
+  data += entries->data();
+
+  AppendEntriesRequest request;
+  ASSERT_TRUE(request.ParseFromString(data));
+  EXPECT_EQ(2, request.term());
+  EXPECT_EQ("leader", request.leader_id());
+  EXPECT_EQ(2, request.prev_log_index());
+  EXPECT_EQ(3, request.group_id());
+  EXPECT_EQ(50000, request.heartbeat_interval_micros());
+  ASSERT_EQ(4, request.entries_size());
+  EXPECT_EQ("key3", request.entries(0).key());
+  EXPECT_EQ("user", request.entries(0).user());
+  EXPECT_EQ(kPut, request.entries(0).op());
+  EXPECT_EQ("key6", request.entries(3).key());
+}
+
+TEST(ReplicationEncoder, SharesBatches) {
+  std::unique_ptr<BinLogger> bin_logger = NewBinLogger("/tmp/replication_encoder_test2", 10);
+  ReplicationEncoder encoder(bin_logger.get(), 4, 1 << 20, 1 << 20);
+
+  scoped_refptr<EncodedEntries> a = encoder.Encode(8, 9);
+  EXPECT_EQ(2, a->count());
+  // 相同进度的 follower 得到同一份编码
+  scoped_refptr<EncodedEntries> b = encoder.Encode(8, 9);
+  EXPECT_TRUE(a == b);
+
+  // 不满一批时有新日志则重新编码
+  LogEntry log_entry;
+  log_entry.term = 1;
+  bin_logger->AppendEntry(log_entry);
+  scoped_refptr<EncodedEntries> c = encoder.Encode(8, 10);
+  EXPECT_TRUE(a != c);
+  EXPECT_EQ(3, c->count());
+  // 旧的批次仍然有效
+  EXPECT_EQ(2, a->count());
+
+  EXPECT_FALSE(encoder.Encode(11, 10));
+}
+
+TEST(ReplicationEncoder, EvictsOldest) {
+  std::unique_ptr<BinLogger> bin_logger = NewBinLogger("/tmp/replication_encoder_test3", 10);
+  ReplicationEncoder encoder(bin_logger.get(), 2, 1 << 20, 500);
+  scoped_refptr<EncodedEntries> first = encoder.Encode(0, 9);
+  encoder.Encode(2, 9);
+  encoder.Encode(4, 9);
+  EXPECT_LE(encoder.cached_bytes(), 500);
+  EXPECT_FALSE(encoder.Encode(0, 9) == first);
+}
+
+} // namespace chubby
+} // namespace mpr
@@ -0,0 +1,809 @@
+#include "server/replicator.h"
+
+#include <algorithm>
+
+#include "base/logging.h"
+#include "base/monitoring/monitoring.h"
+
+#include <gflags/gflags.h>
+
+DECLARE_int32(chubby_replication_window);
+DECLARE_int32(chubby_replication_batch_entries);
+DECLARE_int32(chubby_replication_batch_size);
+DECLARE_bool(chubby_lease_read);
+DECLARE_int32(chubby_leader_lease);
+DECLARE_int32(chubby_heartbeat_min_interval);
+DECLARE_int32(chubby_heartbeat_max_interval);
+
+namespace mpr {
+namespace chubby {
+
+namespace {
+
+base::monitoring::Gauge<std::string, std::string>* inflight_gauge =
+    base::monitoring::Gauge<std::string, std::string>::New(
+        "chubby_replication_inflight", "leader", "follower",
+        "Outstanding AppendEntries requests per follower");
+
+base::monitoring::Gauge<std::string, std::string>* rtt_gauge =
+    base::monitoring::Gauge<std::string, std::string>::New(
+        "chubby_replication_rtt_ms", "leader", "follower",
+        "Smoothed AppendEntries round-trip time per follower, ms");
+
+base::monitoring::Gauge<std::string, std::string>* window_gauge =
+    base::monitoring::Gauge<std::string, std::string>::New(
+        "chubby_replication_window", "leader", "follower",
+        "Flow-controlled AppendEntries window per follower");
+
+base::monitoring::Gauge<std::string, std::string>* batch_gauge =
+    base::monitoring::Gauge<std::string, std::string>::New(
+        "chubby_replication_batch_entries", "leader", "follower",
+        "Flow-controlled entries per AppendEntries per follower");
+
+base::monitoring::Gauge<std::string, std::string>* throttled_gauge =
+    base::monitoring::Gauge<std::string, std::string>::New(
+        "chubby_replication_throttled", "leader", "follower",
+        "1 while the follower reports busy");
+
+// RTT 平滑系数, 同 TCP 的 SRTT.
+const double kRttAlpha = 0.125;
+
+// 心跳间隔与 RTT 的比例. 高延迟链路上心跳的作用主要是防止选举超时,
+// 更频繁的心跳并不能更早地发现故障.
+const int64_t kHeartbeatRttMultiple = 10;
+
+} // namespace
+
+struct Replicator::Follower {
+  PeerClient* client;
+  // 下一条要发送的日志, 发送时乐观推进.
+  int64_t next_index;
+  // 已确认与 leader 一致的最大 index.
+  int64_t match_index;
+  int32_t inflight;
+  // 在途的心跳, 不占用复制窗口
+  int32_t heartbeats;
+  // 已经回答过 (确认或失败) 的最新心跳轮次, 每轮每个 follower 只计一次
+  int64_t answered_round;
+  // 最近一次发送请求的时间, 复制请求也算作心跳
+  uint64_t last_send_micros;
+  // 每次回退 next_index 时递增, 旧 epoch 的拒绝不再触发回退.
+  int64_t epoch;
+  double rtt_ms;
+  // 流控: 允许的在途请求数和每批条数, 至少为 1
+  double window;
+  double batch_entries;
+  // 上一次因 busy 减半的时间, 之前发出的请求的 busy 不再减半
+  uint64_t throttle_micros;
+  bool busy;
+  bool learner;
+  bool removed;
+  // WaitForMatch 的等待者, match_index 到达 wait_index 后调用
+  int64_t wait_index;
+  MatchCallback wait_done;
+
+  Follower(PeerClient* c, bool l)
+    : client(c), next_index(0), match_index(-1), inflight(0), heartbeats(0),
+      answered_round(-1), last_send_micros(0), epoch(0), rtt_ms(0), window(0),
+      batch_entries(0), throttle_micros(0), busy(false), learner(l),
+      removed(false), wait_index(-1) {}
+};
+
+Replicator::Options::Options()
+  : max_inflight(FLAGS_chubby_replication_window),
+    max_batch_entries(FLAGS_chubby_replication_batch_entries),
+    max_batch_bytes(static_cast<int64_t>(FLAGS_chubby_replication_batch_size) * 1024 * 1024),
+    // 不使用 lease read 时不需要 lease, 选举超时也不受它限制
+    lease_micros(FLAGS_chubby_lease_read ?
+                 static_cast<int64_t>(FLAGS_chubby_leader_lease) * 1000 : 0),
+    min_heartbeat_interval_micros(
+        static_cast<int64_t>(FLAGS_chubby_heartbeat_min_interval) * 1000),
+    max_heartbeat_interval_micros(
+        static_cast<int64_t>(FLAGS_chubby_heartbeat_max_interval) * 1000),
+    env(base::Env::Default()) {}
+
+Replicator::Replicator(const Options& options, BinLogger* bin_logger,
+                       const std::vector<PeerClient*>& peers)
+  : options_(options),
+    bin_logger_(bin_logger),
+    running_(false),
+    term_(-1),
+    commit_index_(-1),
+    encoder_(bin_logger, options.max_batch_entries, options.max_batch_bytes,
+             options.max_batch_bytes * options.max_inflight),
+    term_first_index_(0),
+    next_round_(0),
+    lease_expiry_micros_(0),
+    lease_suspended_(false),
+    lease_floor_micros_(0) {
+  DCHECK(bin_logger_ != nullptr);
+  DCHECK_GT(options_.max_inflight, 0);
+  DCHECK_GT(options_.max_batch_entries, 0);
+  for (PeerClient* peer : peers) {
+    followers_.emplace_back(new Follower(peer, false));
+    followers_.back()->window = options_.max_inflight;
+    followers_.back()->batch_entries = options_.max_batch_entries;
+  }
+}
+
+Replicator::~Replicator() {
+  Stop();
+}
+
+void Replicator::Start(int64_t term, int64_t commit_index) {
+  int64_t last_log_index = -1;
+  int64_t last_log_term = -1;
+  bin_logger_->GetLastLogIndexAndTerm(&last_log_index, &last_log_term);
+
+  std::vector<Match> matches;
+  {
+    base::mutex_lock l(mu_);
+    // 上一个 term 的等待者
+    DoFailMatches(base::errors::Unavailable("replicator restarted"), &matches);
+    running_ = true;
+    term_ = term;
+    commit_index_ = commit_index;
+    term_first_index_ = last_log_index + 1;
+    lease_expiry_micros_ = 0;
+    lease_suspended_ = false;
+    encoder_.Clear();
+    for (auto& follower : followers_) {
+      follower->next_index = last_log_index + 1;
+      follower->match_index = -1;
+      follower->epoch++;
+      follower->window = options_.max_inflight;
+      follower->batch_entries = options_.max_batch_entries;
+      follower->throttle_micros = 0;
+      follower->busy = false;
+      DoExportMetrics(*follower);
+    }
+  }
+  RunMatches(&matches);
+  LOG(INFO) << "[Replicator] " << options_.leader_id << " start, term: " << term
+            << ", last_log_index: " << last_log_index;
+}
+
+void Replicator::Stop() {
+  std::vector<Confirm> confirms;
+  std::vector<Match> matches;
+  {
+    base::mutex_lock l(mu_);
+    running_ = false;
+    lease_expiry_micros_ = 0;
+    DoFailRounds(base::errors::Unavailable("replicator stopped"), &confirms);
+    DoFailMatches(base::errors::Unavailable("replicator stopped"), &matches);
+  }
+  RunConfirms(&confirms);
+  RunMatches(&matches);
+}
+
+void Replicator::Replicate() {
+  std::vector<Send> sends;
+  {
+    base::mutex_lock l(mu_);
+    for (auto& follower : followers_) {
+      DoFillWindow(follower.get(), &sends);
+    }
+  }
+  IssueSends(&sends);
+}
+
+void Replicator::AddLearner(PeerClient* peer) {
+  std::vector<Send> sends;
+  {
+    base::mutex_lock l(mu_);
+    int64_t last_log_index = -1;
+    int64_t last_log_term = -1;
+    bin_logger_->GetLastLogIndexAndTerm(&last_log_index, &last_log_term);
+    followers_.emplace_back(new Follower(peer, true));
+    Follower* follower = followers_.back().get();
+    follower->next_index = last_log_index + 1;
+    follower->window = options_.max_inflight;
+    follower->batch_entries = options_.max_batch_entries;
+    DoFillWindow(follower, &sends);
+  }
+  LOG(INFO) << "[Replicator] " << options_.leader_id << " add learner "
+            << peer->peer_id();
+  IssueSends(&sends);
+}
+
+bool Replicator::RemoveLearner(const std::string& peer_id) {
+  std::vector<Match> matches;
+  bool removed = false;
+  {
+    base::mutex_lock l(mu_);
+    for (auto it = followers_.begin(); it != followers_.end(); ++it) {
+      Follower* follower = it->get();
+      if (!follower->learner || follower->client->peer_id() != peer_id) {
+        continue;
+      }
+      follower->removed = true;
+      if (follower->wait_done) {
+        matches.push_back({std::move(follower->wait_done),
+                           base::errors::NotFound("learner removed: ", peer_id)});
+        follower->wait_done = nullptr;
+      }
+      inflight_gauge->Set(options_.leader_id, peer_id, 0);
+      throttled_gauge->Set(options_.leader_id, peer_id, 0);
+      // 在途请求的回调仍会访问 follower
+      if (follower->inflight > 0 || follower->heartbeats > 0) {
+        removed_.push_back(std::move(*it));
+      }
+      followers_.erase(it);
+      removed = true;
+      break;
+    }
+  }
+  RunMatches(&matches);
+  if (removed) {
+    LOG(INFO) << "[Replicator] " << options_.leader_id << " remove learner "
+              << peer_id;
+  }
+  return removed;
+}
+
+void Replicator::Heartbeat(ConfirmCallback done) {
+  std::vector<Send> sends;
+  std::vector<Confirm> confirms;
+  {
+    base::mutex_lock l(mu_);
+    if (!running_) {
+      if (done) {
+        confirms.push_back({done, base::errors::Unavailable("not leader"), -1});
+      }
+    } else {
+      DoStartRound(std::move(done), &confirms);
+      for (auto& follower : followers_) {
+        Send send;
+        DoBuildHeartbeat(follower.get(), &send);
+        sends.push_back(std::move(send));
+      }
+    }
+  }
+  RunConfirms(&confirms);
+  IssueSends(&sends);
+}
+
+void Replicator::KeepAlive() {
+  std::vector<Send> sends;
+  std::vector<Confirm> confirms;
+  {
+    base::mutex_lock l(mu_);
+    if (!running_) {
+      return;
+    }
+    if (options_.lease_micros > 0) {
+      DoStartRound(nullptr, &confirms);
+    }
+    uint64_t now = options_.env->NowMicros();
+    for (auto& follower : followers_) {
+      // 请求失败后不会立即重试, 在这里补发落后的日志, 同时起到心跳的作用
+      DoFillWindow(follower.get(), &sends);
+      // 还有心跳在途时不再叠加, 避免对不可达的节点堆积请求
+      if (follower->heartbeats > 0 ||
+          now < follower->last_send_micros + DoHeartbeatInterval(*follower)) {
+        continue;
+      }
+      Send send;
+      DoBuildHeartbeat(follower.get(), &send);
+      sends.push_back(std::move(send));
+    }
+  }
+  RunConfirms(&confirms);
+  IssueSends(&sends);
+}
+
+void Replicator::WaitForMatch(const std::string& peer_id, int64_t index,
+                              MatchCallback done) {
+  std::vector<Send> sends;
+  std::vector<Match> matches;
+  {
+    base::mutex_lock l(mu_);
+    Follower* target = nullptr;
+    for (auto& follower : followers_) {
+      if (follower->client->peer_id() == peer_id) {
+        target = follower.get();
+        break;
+      }
+    }
+    if (!running_) {
+      matches.push_back({std::move(done), base::errors::Unavailable("not leader")});
+    } else if (target == nullptr) {
+      matches.push_back({std::move(done),
+                         base::errors::NotFound("unknown follower: ", peer_id)});
+    } else {
+      if (target->wait_done) {
+        matches.push_back({std::move(target->wait_done),
+                           base::errors::Aborted("replaced by a newer waiter")});
+      }
+      target->wait_index = index;
+      target->wait_done = std::move(done);
+      DoCheckMatch(target, &matches);
+      DoFillWindow(target, &sends);
+    }
+  }
+  RunMatches(&matches);
+  IssueSends(&sends);
+}
+
+uint64_t Replicator::lease_expiry_micros() const {
+  base::mutex_lock l(mu_);
+  if (!running_ || !DoCommittedInTerm()) {
+    return 0;
+  }
+  return lease_expiry_micros_;
+}
+
+void Replicator::SuspendLease() {
+  base::mutex_lock l(mu_);
+  lease_suspended_ = true;
+  lease_expiry_micros_ = 0;
+}
+
+void Replicator::ResumeLease() {
+  base::mutex_lock l(mu_);
+  lease_suspended_ = false;
+  lease_floor_micros_ = options_.env->NowMicros();
+}
+
+int64_t Replicator::commit_index() const {
+  base::mutex_lock l(mu_);
+  return commit_index_;
+}
+
+std::vector<Replicator::FollowerStatus> Replicator::GetFollowerStatus() const {
+  std::vector<FollowerStatus> result;
+  base::mutex_lock l(mu_);
+  for (const auto& follower : followers_) {
+    FollowerStatus status;
+    status.peer_id = follower->client->peer_id();
+    status.next_index = follower->next_index;
+    status.match_index = follower->match_index;
+    status.inflight = follower->inflight;
+    status.rtt_ms = follower->rtt_ms;
+    status.heartbeat_interval_micros = DoHeartbeatInterval(*follower);
+    status.window = static_cast<int32_t>(follower->window);
+    status.batch_entries = static_cast<int32_t>(follower->batch_entries);
+    status.busy = follower->busy;
+    status.learner = follower->learner;
+    result.push_back(status);
+  }
+  return result;
+}
+
+void Replicator::DoFillWindow(Follower* follower, std::vector<Send>* sends) {
+  if (!running_) {
+    return;
+  }
+  int64_t last_log_index = -1;
+  int64_t last_log_term = -1;
+  bin_logger_->GetLastLogIndexAndTerm(&last_log_index, &last_log_term);
+  while (follower->inflight < static_cast<int32_t>(follower->window) &&
+         follower->next_index <= last_log_index) {
+    Send send;
+    if (!DoBuildRequest(follower, last_log_index, &send)) {
+      break;
+    }
+    follower->next_index = send.inflight.last_index + 1;
+    follower->inflight++;
+    sends->push_back(std::move(send));
+  }
+  DoExportMetrics(*follower);
+}
+
+bool Replicator::DoBuildRequest(Follower* follower, int64_t last_log_index,
+                                Send* send) {
+  AppendEntriesRequest* request = &send->request;
+  int64_t prev_log_index = follower->next_index - 1;
+  int64_t prev_log_term = -1;
+  if (prev_log_index >= 0) {
+    LogEntry log_entry;
+    if (!bin_logger_->ReadSlot(prev_log_index, &log_entry)) {
+      if (prev_log_index < bin_logger_->GetFirstIndex()) {
+        // 没有快照, 这个 follower 需要人工用其他副本的数据重建
+        LOG(ERROR) << "[Replicator] " << follower->client->peer_id() << " needs slot "
+                   << prev_log_index << " which was removed, can not catch up";
+      } else {
+        LOG(WARNING) << "[Replicator] Failed to read slot: " << prev_log_index;
+      }
+      return false;
+    }
+    prev_log_term = log_entry.term;
+  }
+  request->set_term(term_);
+  request->set_leader_id(options_.leader_id);
+  request->set_prev_log_index(prev_log_index);
+  request->set_prev_log_term(prev_log_term);
+  request->set_leader_commit_index(commit_index_);
+  request->set_heartbeat_interval_micros(DoHeartbeatInterval(*follower));
+
+  int64_t last_index = std::min(last_log_index, follower->next_index +
+      static_cast<int64_t>(follower->batch_entries) - 1);
+  send->entries = encoder_.Encode(follower->next_index, last_index);
+  if (!send->entries) {
+    return false;
+  }
+
+  send->inflight.follower = follower;
+  send->inflight.heartbeat = false;
+  send->inflight.term = term_;
+  send->inflight.round = next_round_ - 1;
+  send->inflight.epoch = follower->epoch;
+  send->inflight.prev_log_index = prev_log_index;
+  send->inflight.last_index = send->entries->last_index();
+  send->inflight.send_micros = options_.env->NowMicros();
+  follower->last_send_micros = send->inflight.send_micros;
+  return true;
+}
+
+void Replicator::DoBuildHeartbeat(Follower* follower, Send* send) {
+  // 以已确认的 match_index 作为 prev_log_index, 一定能通过一致性检查,
+  // 不会干扰乐观推进的 next_index.
+  AppendEntriesRequest* request = &send->request;
+  int64_t prev_log_index = follower->match_index;
+  int64_t prev_log_term = -1;
+  LogEntry log_entry;
+  if (prev_log_index >= 0 && bin_logger_->ReadSlot(prev_log_index, &log_entry)) {
+    prev_log_term = log_entry.term;
+  }
+  request->set_term(term_);
+  request->set_leader_id(options_.leader_id);
+  request->set_prev_log_index(prev_log_index);
+  request->set_prev_log_term(prev_log_term);
+  request->set_leader_commit_index(std::min(commit_index_, prev_log_index));
+  request->set_heartbeat_interval_micros(DoHeartbeatInterval(*follower));
+
+  send->inflight.follower = follower;
+  send->inflight.heartbeat = true;
+  send->inflight.term = term_;
+  send->inflight.round = next_round_ - 1;
+  send->inflight.epoch = follower->epoch;
+  send->inflight.prev_log_index = prev_log_index;
+  send->inflight.last_index = prev_log_index;
+  send->inflight.send_micros = options_.env->NowMicros();
+  follower->last_send_micros = send->inflight.send_micros;
+  follower->heartbeats++;
+}
+
+void Replicator::IssueSends(std::vector<Send>* sends) {
+  std::string header;
+  for (auto& send : *sends) {
+    Inflight inflight = send.inflight;
+    ReplicationEncoder::EncodeHeader(send.request, &header);
+    inflight.follower->client->SendAppendEntries(header, send.entries,
+        [this, inflight](const base::Status& status,
+                         const AppendEntriesResponse& response) {
+          HandleResponse(inflight, status, response);
+        });
+  }
+  sends->clear();
+}
+
+void Replicator::HandleResponse(const Inflight& inflight,
+                                const base::Status& status,
+                                const AppendEntriesResponse& response) {
+  Follower* follower = inflight.follower;
+  std::vector<Send> sends;
+  std::vector<Confirm> confirms;
+  std::vector<Match> matches;
+  bool step_down = false;
+  bool committed = false;
+  int64_t commit_index = -1;
+  {
+    base::mutex_lock l(mu_);
+    if (inflight.heartbeat) {
+      follower->heartbeats--;
+    } else {
+      follower->inflight--;
+    }
+    if (follower->removed) {
+      if (follower->inflight == 0 && follower->heartbeats == 0) {
+        for (auto it = removed_.begin(); it != removed_.end(); ++it) {
+          if (it->get() == follower) {
+            removed_.erase(it);
+            break;
+          }
+        }
+      }
+      return;
+    }
+    uint64_t now = options_.env->NowMicros();
+    if (now >= inflight.send_micros) {
+      double sample = (now - inflight.send_micros) / 1000.0;
+      follower->rtt_ms = follower->rtt_ms == 0 ? sample :
+          (1 - kRttAlpha) * follower->rtt_ms + kRttAlpha * sample;
+    }
+
+    // 之前 term 发出的请求: 日志可能已经被截断并由新 term 的日志覆盖,
+    // 它的确认不能用于推进 match_index
+    if (!running_ || inflight.term != term_ ||
+        (status.ok() && response.current_term() < term_)) {
+      DoExportMetrics(*follower);
+      return;
+    }
+
+    if (status.ok() && response.current_term() > term_) {
+      running_ = false;
+      lease_expiry_micros_ = 0;
+      step_down = true;
+      DoFailRounds(base::errors::Unavailable("not leader"), &confirms);
+      DoFailMatches(base::errors::Unavailable("not leader"), &matches);
+    } else if (inflight.heartbeat) {
+      // 心跳: 无论日志是否匹配, 同 term 的响应都说明对方承认当前 leader.
+      DoAnswerRounds(follower, inflight.round, status.ok(), &confirms);
+    } else if (!status.ok()) {
+      // 请求可能丢失, 从已确认的位置重新发送. 不立即重试, 等待下一次
+      // Replicate() 以免对不可达的节点空转.
+      if (inflight.epoch == follower->epoch) {
+        follower->next_index = follower->match_index + 1;
+        follower->epoch++;
+      }
+      VLOG(1) << "[Replicator] AppendEntries to " << follower->client->peer_id()
+              << " failed: " << status.ToString();
+    } else {
+      // 复制请求的响应同样说明对方在请求发出后仍承认当前 leader, 顺带确认
+      // 发出之前开始的心跳轮次.
+      DoAnswerRounds(follower, inflight.round, true, &confirms);
+      DoAdjustFlow(follower, inflight, response.is_busy());
+      if (response.success()) {
+        if (inflight.last_index > follower->match_index) {
+          follower->match_index = inflight.last_index;
+        }
+        follower->next_index = std::max(follower->next_index,
+                                        follower->match_index + 1);
+        committed = DoAdvanceCommitIndex();
+        commit_index = commit_index_;
+        DoCheckMatch(follower, &matches);
+        DoFillWindow(follower, &sends);
+      } else if (inflight.epoch == follower->epoch) {
+        follower->next_index = DoBacktrack(*follower, inflight, response);
+        follower->epoch++;
+        DoFillWindow(follower, &sends);
+      }
+    }
+    DoExportMetrics(*follower);
+  }
+
+  RunConfirms(&confirms);
+  RunMatches(&matches);
+  if (step_down) {
+    LOG(INFO) << "[Replicator] " << options_.leader_id << " step down, term: "
+              << response.current_term();
+    if (options_.step_down_callback) {
+      options_.step_down_callback(response.current_term());
+    }
+    return;
+  }
+  IssueSends(&sends);
+  if (committed && options_.commit_callback) {
+    options_.commit_callback(commit_index);
+  }
+}
+
+int64_t Replicator::DoBacktrack(const Follower& follower,
+                                const Inflight& inflight,
+                                const AppendEntriesResponse& response) {
+  const int64_t prev_log_index = inflight.prev_log_index;
+  int64_t next_index;
+  if (response.log_length() <= prev_log_index) {
+    // follower 的日志比 prev_log_index 短, 直接退到它的末尾
+    next_index = response.log_length();
+  } else if (response.conflict_term() > 0) {
+    // leader 也有 conflict_term 时从它在 leader 上的最后一条之后开始,
+    // 否则跳过 follower 上的整个 conflict_term
+    next_index = response.conflict_index();
+    int64_t last = bin_logger_->FindLastIndexOfTerm(response.conflict_term(),
+                                                    prev_log_index);
+    LogEntry log_entry;
+    if (last >= 0 && bin_logger_->ReadSlot(last, &log_entry) &&
+        log_entry.term == response.conflict_term()) {
+      next_index = last + 1;
+    }
+  } else {
+    // 没有提示时在 (match_index, prev_log_index) 之间二分查找. 被接受的
+    // 请求会覆盖 follower 上不一致的日志, 所以 prev_log_index 偏小也是正确的.
+    next_index = follower.match_index + (prev_log_index - follower.match_index) / 2 + 1;
+  }
+  next_index = std::min(next_index, prev_log_index);
+  return std::max(next_index, follower.match_index + 1);
+}
+
+int64_t Replicator::DoStartRound(ConfirmCallback done,
+                                 std::vector<Confirm>* confirms) {
+  int64_t round = next_round_++;
+  Round& r = rounds_[round];
+  r.start_micros = options_.env->NowMicros();
+  r.commit_index = commit_index_;
+  r.acks = 1;  // leader 自己
+  r.failures = 0;
+  r.done = std::move(done);
+  // 单节点时立即完成
+  DoFinishRound(round, confirms);
+  return round;
+}
+
+void Replicator::DoAnswerRounds(Follower* follower, int64_t round, bool ack,
+                                std::vector<Confirm>* confirms) {
+  if (follower->learner || round <= follower->answered_round) {
+    return;
+  }
+  auto it = rounds_.upper_bound(follower->answered_round);
+  follower->answered_round = round;
+  std::vector<int64_t> answered;
+  for (; it != rounds_.end() && it->first <= round; ++it) {
+    if (ack) {
+      it->second.acks++;
+    } else {
+      it->second.failures++;
+    }
+    answered.push_back(it->first);
+  }
+  for (int64_t r : answered) {
+    DoFinishRound(r, confirms);
+  }
+}
+
+void Replicator::DoFinishRound(int64_t round, std::vector<Confirm>* confirms) {
+  auto it = rounds_.find(round);
+  if (it == rounds_.end()) {
+    return;
+  }
+  Round& r = it->second;
+  const int32_t members = DoCountVoters();
+  const int32_t quorum = members / 2 + 1;
+  if (r.acks >= quorum) {
+    if (options_.lease_micros > 0 && !lease_suspended_ &&
+        r.start_micros >= lease_floor_micros_) {
+      lease_expiry_micros_ = std::max(lease_expiry_micros_,
+                                      r.start_micros + options_.lease_micros);
+    }
+    if (r.done) {
+      if (DoCommittedInTerm()) {
+        confirms->push_back({std::move(r.done), base::Status::OK(),
+                             std::max(r.commit_index, term_first_index_)});
+      } else {
+        confirms->push_back({std::move(r.done),
+            base::errors::Unavailable("no entry committed in current term"), -1});
+      }
+    }
+    rounds_.erase(it);
+  } else if (r.failures > members - quorum) {
+    if (r.done) {
+      confirms->push_back({std::move(r.done),
+          base::errors::Unavailable("heartbeat not acknowledged by quorum"), -1});
+    }
+    rounds_.erase(it);
+  }
+}
+
+void Replicator::DoFailRounds(const base::Status& status,
+                              std::vector<Confirm>* confirms) {
+  for (auto& kv : rounds_) {
+    if (kv.second.done) {
+      confirms->push_back({std::move(kv.second.done), status, -1});
+    }
+  }
+  rounds_.clear();
+}
+
+void Replicator::DoCheckMatch(Follower* follower, std::vector<Match>* matches) {
+  if (follower->wait_done && follower->match_index >= follower->wait_index) {
+    matches->push_back({std::move(follower->wait_done), base::Status::OK()});
+    follower->wait_done = nullptr;
+  }
+}
+
+void Replicator::DoFailMatches(const base::Status& status,
+                               std::vector<Match>* matches) {
+  for (auto& follower : followers_) {
+    if (follower->wait_done) {
+      matches->push_back({std::move(follower->wait_done), status});
+      follower->wait_done = nullptr;
+    }
+  }
+}
+
+int32_t Replicator::DoCountVoters() const {
+  int32_t voters = 1;  // leader 自己
+  for (const auto& follower : followers_) {
+    if (!follower->learner) {
+      voters++;
+    }
+  }
+  return voters;
+}
+
+int64_t Replicator::DoHeartbeatInterval(const Follower& follower) const {
+  int64_t interval = static_cast<int64_t>(follower.rtt_ms * 1000) *
+                     kHeartbeatRttMultiple;
+  interval = std::min(interval, options_.max_heartbeat_interval_micros);
+  return std::max(interval, options_.min_heartbeat_interval_micros);
+}
+
+void Replicator::DoAdjustFlow(Follower* follower, const Inflight& inflight,
+                              bool busy) {
+  follower->busy = busy;
+  if (busy) {
+    // 减半之前发出的请求还会带回 busy, 每个 RTT 只减一次
+    if (inflight.send_micros < follower->throttle_micros) {
+      return;
+    }
+    follower->throttle_micros = options_.env->NowMicros();
+    follower->window = std::max(1.0, follower->window / 2);
+    follower->batch_entries = std::max(1.0, follower->batch_entries / 2);
+    VLOG(1) << "[Replicator] " << follower->client->peer_id()
+            << " is busy, window: " << follower->window
+            << ", batch_entries: " << follower->batch_entries;
+    return;
+  }
+  // 加性增长: 大约每个 RTT 窗口加 1, 批次加上限的 1/16
+  follower->window = std::min<double>(options_.max_inflight,
+      follower->window + 1 / follower->window);
+  follower->batch_entries = std::min<double>(options_.max_batch_entries,
+      follower->batch_entries +
+      options_.max_batch_entries / 16.0 / follower->window);
+}
+
+bool Replicator::DoCommittedInTerm() const {
+  return commit_index_ >= term_first_index_;
+}
+
+// static
+void Replicator::RunConfirms(std::vector<Confirm>* confirms) {
+  for (auto& confirm : *confirms) {
+    confirm.done(confirm.status, confirm.commit_index);
+  }
+  confirms->clear();
+}
+
+void Replicator::RunMatches(std::vector<Match>* matches) {
+  for (auto& match : *matches) {
+    match.done(match.status);
+  }
+  matches->clear();
+}
+
+bool Replicator::DoAdvanceCommitIndex() {
+  int64_t last_log_index = -1;
+  int64_t last_log_term = -1;
+  bin_logger_->GetLastLogIndexAndTerm(&last_log_index, &last_log_term);
+
+  std::vector<int64_t> match_indexes;
+  match_indexes.push_back(last_log_index);
+  for (const auto& follower : followers_) {
+    if (!follower->learner) {
+      match_indexes.push_back(follower->match_index);
+    }
+  }
+  // 多数派都已复制的最大 index
+  size_t quorum = match_indexes.size() / 2;
+  std::nth_element(match_indexes.begin(), match_indexes.begin() + quorum,
+                   match_indexes.end(), std::greater<int64_t>());
+  int64_t index = match_indexes[quorum];
+  if (index <= commit_index_) {
+    return false;
+  }
+  // 只能通过计数提交当前 term 的日志
+  LogEntry log_entry;
+  if (!bin_logger_->ReadSlot(index, &log_entry) || log_entry.term != term_) {
+    return false;
+  }
+  commit_index_ = index;
+  return true;
+}
+
+void Replicator::DoExportMetrics(const Follower& follower) {
+  inflight_gauge->Set(options_.leader_id, follower.client->peer_id(),
+                      follower.inflight);
+  rtt_gauge->Set(options_.leader_id, follower.client->peer_id(),
+                 follower.rtt_ms);
+  window_gauge->Set(options_.leader_id, follower.client->peer_id(),
+                    static_cast<int64_t>(follower.window));
+  batch_gauge->Set(options_.leader_id, follower.client->peer_id(),
+                   static_cast<int64_t>(follower.batch_entries));
+  throttled_gauge->Set(options_.leader_id, follower.client->peer_id(),
+                       follower.busy ? 1 : 0);
+}
+
+} // namespace chubby
+} // namespace mpr
@@ -0,0 +1,206 @@
+#ifndef MPR_CHUBBY_SERVER_REPLICATOR_H_
+#define MPR_CHUBBY_SERVER_REPLICATOR_H_
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base/macros.h"
+#include "base/platform/env.h"
+#include "base/platform/mutex.h"
+#include "proto/service.pb.h"
+#include "server/peer_client.h"
+#include "server/replication_encoder.h"
+#include "storage/bin_logger.h"
+
+namespace mpr {
+namespace chubby {
+
+// Leader 端的日志复制.
+//
+// 每个 follower 最多同时有 max_inflight 个 AppendEntries 在途. 发送时乐观地
+// 推进 next_index, 不等待上一批的响应; 被拒绝时根据响应里的 log_length
+// 和冲突提示回退 next_index, 并丢弃回退之前发出的请求的结果. 日志批次只编码一次,
+// 在进度相同的 follower 之间共享.
+//
+// follower 的 apply 跟不上时在响应中设置 is_busy. leader 对每个 follower 按
+// AIMD 调整窗口和批次大小: busy 时减半 (每个 RTT 最多一次), 否则缓慢增长到
+// max_inflight 和 max_batch_entries. 一个慢副本只会拖慢自己的复制.
+//
+// 复制请求同时起到心跳的作用: KeepAlive 只给最近一个心跳间隔内没有发送过
+// 请求的 follower 发心跳, 心跳间隔随该 follower 的 RTT 调整.
+class Replicator {
+ public:
+  typedef std::function<void(const base::Status& status,
+                             int64_t commit_index)> ConfirmCallback;
+  typedef std::function<void(const base::Status& status)> MatchCallback;
+
+  struct Options {
+    std::string leader_id;
+    int32_t max_inflight;
+    int32_t max_batch_entries;
+    int64_t max_batch_bytes;
+    // 一轮心跳被多数派确认后, leader 在 lease_micros 内不会被取代. 必须小于
+    // follower 的最小选举超时 (减去时钟漂移), 0 表示不使用 lease.
+    int64_t lease_micros;
+    // 心跳间隔取 kHeartbeatRttMultiple 倍 RTT, 限制在 [min, max] 之间.
+    // follower 的选举超时需要是 max_heartbeat_interval_micros 的数倍.
+    int64_t min_heartbeat_interval_micros;
+    int64_t max_heartbeat_interval_micros;
+    base::Env* env;
+    // commit_index 前进后调用, 调用时不持有内部锁.
+    std::function<void(int64_t commit_index)> commit_callback;
+    // 发现更大的 term, leader 需要退位.
+    std::function<void(int64_t term)> step_down_callback;
+
+    Options();
+  };
+
+  struct FollowerStatus {
+    std::string peer_id;
+    int64_t next_index;
+    int64_t match_index;
+    int32_t inflight;
+    double rtt_ms;
+    int64_t heartbeat_interval_micros;
+    // 流控后的窗口和批次大小
+    int32_t window;
+    int32_t batch_entries;
+    bool busy;
+    bool learner;
+  };
+
+  // peers 由调用者持有, 生命周期需要长于 Replicator.
+  Replicator(const Options& options, BinLogger* bin_logger,
+             const std::vector<PeerClient*>& peers);
+  ~Replicator();
+
+  // 成为 term 的 leader 后调用, follower 的 next_index 从本地日志末尾开始.
+  void Start(int64_t term, int64_t commit_index);
+  void Stop();
+
+  // 本地追加日志后调用, 在窗口允许的范围内向每个 follower 发送新日志.
+  void Replicate();
+
+  // learner 接收日志但不计入提交和心跳的多数派, 可以在运行中增减. peer
+  // 由调用者持有, 移除后仍需保持有效直到 Replicator 销毁.
+  void AddLearner(PeerClient* peer);
+  bool RemoveLearner(const std::string& peer_id);
+
+  // 向所有 follower 发送一轮心跳 (空的 AppendEntries, 不占用复制窗口).
+  // 多数派确认当前 term 后, 以本轮开始时的 commit_index 调用 done; 当前
+  // term 还没有提交过日志时返回 Unavailable, 此时 commit_index 可能落后.
+  void Heartbeat(ConfirmCallback done);
+
+  // 周期性调用 (间隔不大于 min_heartbeat_interval_micros), 保持 follower 不
+  // 超时, 并给请求失败后落后的 follower 补发日志. 最近有复制请求的 follower
+  // 不再单独发心跳; 使用 lease 时同时开始新的一轮以延长 lease, 复制请求的
+  // 响应也可以确认这一轮.
+  void KeepAlive();
+
+  // peer 确认了 index 及之前的日志后以 OK 调用 done, 已经确认时立即调用.
+  // 每个 follower 只保留一个等待者, 新的等待者使之前的以 Aborted 结束;
+  // Stop 或者不再是 leader 时以 Unavailable 结束, 找不到 peer 时返回 NotFound.
+  void WaitForMatch(const std::string& peer_id, int64_t index, MatchCallback done);
+
+  // 最近一次被多数派确认的心跳得到的 lease 到期时间, 没有 lease 时返回 0.
+  uint64_t lease_expiry_micros() const;
+
+  // 转移 leader 期间目标收到 TimeoutNow 后不等 lease 过期就发起选举, 开始转移
+  // 时调用 SuspendLease 放弃当前的 lease 并停止续约. 转移失败后调用
+  // ResumeLease, 只有之后开始的一轮心跳才能重新得到 lease. Start 时恢复.
+  void SuspendLease();
+  void ResumeLease();
+
+  int64_t commit_index() const;
+  std::vector<FollowerStatus> GetFollowerStatus() const;
+
+ private:
+  struct Follower;
+  struct Inflight {
+    Follower* follower;
+    bool heartbeat;
+    // 发出请求时的 term, 重新 Start 之后旧 term 的响应全部丢弃
+    int64_t term;
+    // 请求发出时最新的心跳轮次, 同 term 的响应可以确认它及之前的轮次
+    int64_t round;
+    int64_t epoch;
+    int64_t prev_log_index;
+    int64_t last_index;
+    uint64_t send_micros;
+  };
+  struct Send {
+    Inflight inflight;
+    // 不含 entries, 发送时与共享的 entries 拼接
+    AppendEntriesRequest request;
+    scoped_refptr<EncodedEntries> entries;
+  };
+  struct Round {
+    uint64_t start_micros;
+    int64_t commit_index;
+    int32_t acks;
+    int32_t failures;
+    ConfirmCallback done;
+  };
+  struct Confirm {
+    ConfirmCallback done;
+    base::Status status;
+    int64_t commit_index;
+  };
+  struct Match {
+    MatchCallback done;
+    base::Status status;
+  };
+
+  void DoFillWindow(Follower* follower, std::vector<Send>* sends);
+  bool DoBuildRequest(Follower* follower, int64_t last_log_index, Send* send);
+  void DoBuildHeartbeat(Follower* follower, Send* send);
+  int64_t DoStartRound(ConfirmCallback done, std::vector<Confirm>* confirms);
+  void DoAnswerRounds(Follower* follower, int64_t round, bool ack,
+                      std::vector<Confirm>* confirms);
+  void DoFinishRound(int64_t round, std::vector<Confirm>* confirms);
+  void DoFailRounds(const base::Status& status, std::vector<Confirm>* confirms);
+  void DoCheckMatch(Follower* follower, std::vector<Match>* matches);
+  void DoFailMatches(const base::Status& status, std::vector<Match>* matches);
+  int32_t DoCountVoters() const;
+  int64_t DoHeartbeatInterval(const Follower& follower) const;
+  void DoAdjustFlow(Follower* follower, const Inflight& inflight, bool busy);
+  bool DoCommittedInTerm() const;
+  int64_t DoBacktrack(const Follower& follower, const Inflight& inflight,
+                      const AppendEntriesResponse& response);
+  bool DoAdvanceCommitIndex();
+  void DoExportMetrics(const Follower& follower);
+  void IssueSends(std::vector<Send>* sends);
+  void HandleResponse(const Inflight& inflight, const base::Status& status,
+                      const AppendEntriesResponse& response);
+  static void RunConfirms(std::vector<Confirm>* confirms);
+  static void RunMatches(std::vector<Match>* matches);
+
+  const Options options_;
+  BinLogger* bin_logger_;
+
+  mutable base::mutex mu_;
+  bool running_;
+  int64_t term_;
+  int64_t commit_index_;
+  ReplicationEncoder encoder_;
+  // 当前 term 的第一条日志
+  int64_t term_first_index_;
+  std::vector<std::unique_ptr<Follower>> followers_;
+  // 已移除但还有请求在途的 learner
+  std::vector<std::unique_ptr<Follower>> removed_;
+  int64_t next_round_;
+  std::map<int64_t, Round> rounds_;
+  uint64_t lease_expiry_micros_;
+  bool lease_suspended_;
+  // 早于这个时间开始的一轮不延长 lease
+  uint64_t lease_floor_micros_;
+
+  DISALLOW_COPY_AND_ASSIGN(Replicator);
+};
+
+} // namespace chubby
+} // namespace mpr
+#endif // MPR_CHUBBY_SERVER_REPLICATOR_H_
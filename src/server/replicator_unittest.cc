@@ -0,0 +1,484 @@
+#include <gtest/gtest.h>
+#include <deque>
+
+#include "server/replicator.h"
+#include "base/platform/env.h"
+#include "base/platform/env_test_util.h"
+
+namespace mpr {
+namespace chubby {
+
+namespace {
+
+// 记录请求, 由测试决定何时以及如何响应.
+class FakePeerClient : public PeerClient {
+ public:
+  explicit FakePeerClient(const std::string& id) : id_(id) {}
+
+  const std::string& peer_id() const override { return id_; }
+
+  void AppendEntries(const AppendEntriesRequest& request,
+                     AppendEntriesCallback done) override {
+    pending_.emplace_back(request, done);
+  }
+
+  size_t pending() const { return pending_.size(); }
+  const AppendEntriesRequest& front() const { return pending_.front().first; }
+
+  void Reply(bool success, int64_t log_length, int64_t term = -1,
+             bool busy = false) {
+    auto call = pending_.front();
+    pending_.pop_front();
+    AppendEntriesResponse response;
+    response.set_current_term(term < 0 ? call.first.term() : term);
+    response.set_success(success);
+    response.set_log_length(log_length);
+    response.set_is_busy(busy);
+    call.second(base::Status::OK(), response);
+  }
+
+ private:
+  std::string id_;
+  std::deque<std::pair<AppendEntriesRequest, AppendEntriesCallback>> pending_;
+};
+
+std::unique_ptr<BinLogger> NewBinLogger(const std::string& path, int64_t n,
+                                        int64_t term) {
+  base::int64 undeleted_files, undeleted_dirs;
+  base::Env::Default()->DeleteDirectoryRecursively(path, &undeleted_files,
+                                                   &undeleted_dirs);
+  std::unique_ptr<BinLogger> bin_logger(new BinLogger(BinLogger::Options(path)));
+  for (int64_t i = 0; i < n; ++i) {
+    LogEntry log_entry;
+    log_entry.log_operation = kPut;
+    log_entry.key = "key" + std::to_string(i);
+    log_entry.value = "value";
+    log_entry.term = term;
+    bin_logger->AppendEntry(log_entry);
+  }
+  return bin_logger;
+}
+
+} // namespace
+
+TEST(Replicator, PipelinesUpToWindow) {
+  std::unique_ptr<BinLogger> bin_logger = NewBinLogger("/tmp/replicator_test1", 100, 1);
+  FakePeerClient peer1("peer1"), peer2("peer2");
+  int64_t committed = -1;
+
+  Replicator::Options options;
+  options.leader_id = "leader";
+  options.max_inflight = 4;
+  options.max_batch_entries = 10;
+  options.commit_callback = [&committed](int64_t index) { committed = index; };
+  Replicator replicator(options, bin_logger.get(), {&peer1, &peer2});
+  replicator.Start(2, -1);
+
+  // 新 leader 从日志末尾开始, 先回退到 follower 的末尾
+  LogEntry log_entry;
+  log_entry.term = 2;
+  bin_logger->AppendEntry(log_entry);
+  replicator.Replicate();
+  ASSERT_EQ(1u, peer1.pending());
+  EXPECT_EQ(99, peer1.front().prev_log_index());
+  peer1.Reply(false, 0);
+
+  // 回退后不等待响应, 一次发出窗口内的 4 个请求
+  ASSERT_EQ(4u, peer1.pending());
+  EXPECT_EQ(-1, peer1.front().prev_log_index());
+  EXPECT_EQ(10, peer1.front().entries_size());
+  std::vector<Replicator::FollowerStatus> status = replicator.GetFollowerStatus();
+  EXPECT_EQ(4, status[0].inflight);
+  EXPECT_EQ(40, status[0].next_index);
+
+  // 每收到一个响应补发一个
+  peer1.Reply(true, 10);
+  EXPECT_EQ(4u, peer1.pending());
+  EXPECT_EQ(-1, committed);  // 只有当前 term 的日志才能通过计数提交
+
+  while (peer1.pending() > 0) {
+    peer1.Reply(true, 0);
+  }
+  EXPECT_EQ(100, committed);
+  status = replicator.GetFollowerStatus();
+  EXPECT_EQ(100, status[0].match_index);
+  EXPECT_EQ(0, status[0].inflight);
+  EXPECT_EQ(-1, status[1].match_index);
+}
+
+TEST(Replicator, StaleRejectionsIgnored) {
+  std::unique_ptr<BinLogger> bin_logger = NewBinLogger("/tmp/replicator_test2", 0, 1);
+  FakePeerClient peer("peer");
+  Replicator::Options options;
+  options.leader_id = "leader";
+  options.max_inflight = 3;
+  options.max_batch_entries = 5;
+  Replicator replicator(options, bin_logger.get(), {&peer});
+  replicator.Start(2, -1);
+
+  for (int i = 0; i < 30; ++i) {
+    LogEntry log_entry;
+    log_entry.term = 2;
+    bin_logger->AppendEntry(log_entry);
+  }
+  replicator.Replicate();
+  ASSERT_EQ(3u, peer.pending());
+  peer.Reply(true, 5);
+  ASSERT_EQ(3u, peer.pending());
+  // 第二批被拒绝, 后面在途的请求的拒绝不会再次回退
+  peer.Reply(false, 5);
+  peer.Reply(false, 5);
+  peer.Reply(false, 5);
+  std::vector<Replicator::FollowerStatus> status = replicator.GetFollowerStatus();
+  EXPECT_EQ(4, status[0].match_index);
+  EXPECT_EQ(peer.pending(), static_cast<size_t>(status[0].inflight));
+  ASSERT_GT(peer.pending(), 0u);
+  EXPECT_EQ(4, peer.front().prev_log_index());
+}
+
+TEST(Replicator, StepDownOnHigherTerm) {
+  std::unique_ptr<BinLogger> bin_logger = NewBinLogger("/tmp/replicator_test3", 1, 1);
+  FakePeerClient peer("peer");
+  int64_t new_term = -1;
+  Replicator::Options options;
+  options.step_down_callback = [&new_term](int64_t term) { new_term = term; };
+  Replicator replicator(options, bin_logger.get(), {&peer});
+  replicator.Start(1, -1);
+  LogEntry log_entry;
+  log_entry.term = 1;
+  bin_logger->AppendEntry(log_entry);
+  replicator.Replicate();
+  ASSERT_EQ(1u, peer.pending());
+
+  peer.Reply(false, 0, 5);
+  EXPECT_EQ(5, new_term);
+
+  // 退位后不再发送
+  bin_logger->AppendEntry(log_entry);
+  replicator.Replicate();
+  EXPECT_EQ(0u, peer.pending());
+}
+
+TEST(Replicator, LearnersDoNotCountTowardQuorum) {
+  std::unique_ptr<BinLogger> bin_logger = NewBinLogger("/tmp/replicator_test4", 0, 1);
+  FakePeerClient voter1("voter1"), voter2("voter2"), learner("learner");
+  int64_t committed = -1;
+  Replicator::Options options;
+  options.commit_callback = [&committed](int64_t index) { committed = index; };
+  Replicator replicator(options, bin_logger.get(), {&voter1, &voter2});
+  replicator.Start(2, -1);
+  replicator.AddLearner(&learner);
+
+  LogEntry log_entry;
+  log_entry.term = 2;
+  bin_logger->AppendEntry(log_entry);
+  replicator.Replicate();
+  ASSERT_EQ(1u, learner.pending());
+  learner.Reply(true, 1);
+  EXPECT_EQ(-1, committed);
+  voter1.Reply(true, 1);
+  EXPECT_EQ(0, committed);
+
+  // learner 的心跳确认不计入多数派
+  int confirmed = 0;
+  replicator.Heartbeat([&confirmed](const base::Status& s, int64_t) {
+    confirmed += s.ok() ? 1 : 0;
+  });
+  learner.Reply(true, 1);
+  EXPECT_EQ(0, confirmed);
+  voter2.Reply(true, 1);  // 日志
+  voter2.Reply(true, 1);  // 心跳
+  EXPECT_EQ(1, confirmed);
+
+  // 移除后在途请求的响应被忽略
+  bin_logger->AppendEntry(log_entry);
+  replicator.Replicate();
+  ASSERT_EQ(1u, learner.pending());
+  EXPECT_TRUE(replicator.RemoveLearner("learner"));
+  EXPECT_FALSE(replicator.RemoveLearner("voter1"));
+  learner.Reply(true, 2);
+  EXPECT_EQ(2u, replicator.GetFollowerStatus().size());
+}
+
+TEST(Replicator, KeepAliveSkipsBusyFollowers) {
+  std::unique_ptr<BinLogger> bin_logger = NewBinLogger("/tmp/replicator_test5", 0, 1);
+  base::FakeClockEnv env;
+  FakePeerClient peer1("peer1"), peer2("peer2");
+  Replicator::Options options;
+  options.env = &env;
+  options.lease_micros = 0;
+  options.min_heartbeat_interval_micros = 50000;
+  options.max_heartbeat_interval_micros = 300000;
+  Replicator replicator(options, bin_logger.get(), {&peer1, &peer2});
+  replicator.Start(1, -1);
+
+  LogEntry log_entry;
+  log_entry.term = 1;
+  bin_logger->AppendEntry(log_entry);
+  replicator.Replicate();
+  peer1.Reply(true, 1);
+
+  // 刚发过复制请求, 不需要心跳
+  replicator.KeepAlive();
+  EXPECT_EQ(0u, peer1.pending());
+  EXPECT_EQ(1u, peer2.pending());
+
+  // 空闲一个心跳间隔后, 包括请求还在途的 peer2 都需要心跳
+  env.AdvanceMillis(50);
+  replicator.KeepAlive();
+  ASSERT_EQ(1u, peer1.pending());
+  EXPECT_EQ(0, peer1.front().entries_size());
+  EXPECT_EQ(2u, peer2.pending());
+
+  // 心跳在途时不再叠加
+  env.AdvanceMillis(50);
+  replicator.KeepAlive();
+  EXPECT_EQ(1u, peer1.pending());
+}
+
+TEST(Replicator, HeartbeatIntervalFollowsRtt) {
+  std::unique_ptr<BinLogger> bin_logger = NewBinLogger("/tmp/replicator_test6", 0, 1);
+  base::FakeClockEnv env;
+  FakePeerClient near("near"), far("far"), distant("distant");
+  Replicator::Options options;
+  options.env = &env;
+  options.min_heartbeat_interval_micros = 50000;
+  options.max_heartbeat_interval_micros = 300000;
+  Replicator replicator(options, bin_logger.get(), {&near, &far, &distant});
+  replicator.Start(1, -1);
+
+  replicator.Heartbeat(nullptr);
+  near.Reply(true, 0);
+  env.AdvanceMillis(20);
+  far.Reply(true, 0);
+  env.AdvanceMillis(80);
+  distant.Reply(true, 0);
+
+  std::vector<Replicator::FollowerStatus> status = replicator.GetFollowerStatus();
+  ASSERT_EQ(3u, status.size());
+  EXPECT_EQ(50000, status[0].heartbeat_interval_micros);
+  EXPECT_EQ(200000, status[1].heartbeat_interval_micros);
+  EXPECT_EQ(300000, status[2].heartbeat_interval_micros);
+}
+
+TEST(Replicator, ReplicationExtendsLease) {
+  std::unique_ptr<BinLogger> bin_logger = NewBinLogger("/tmp/replicator_test7", 0, 1);
+  base::FakeClockEnv env;
+  FakePeerClient peer1("peer1"), peer2("peer2");
+  Replicator::Options options;
+  options.env = &env;
+  options.lease_micros = 800000;
+  Replicator replicator(options, bin_logger.get(), {&peer1, &peer2});
+  replicator.Start(1, -1);
+
+  LogEntry log_entry;
+  log_entry.term = 1;
+  bin_logger->AppendEntry(log_entry);
+  replicator.Replicate();
+  peer1.Reply(true, 1);
+  EXPECT_EQ(0, replicator.commit_index());
+
+  // 新的一轮开始于 start, 两个 peer 都刚收到过请求, 不发心跳
+  const uint64_t start = env.NowMicros();
+  replicator.KeepAlive();
+  EXPECT_EQ(0u, peer1.pending());
+  EXPECT_EQ(0u, replicator.lease_expiry_micros());
+
+  // 在这一轮之前发出的请求不能确认它
+  peer2.Reply(true, 1);
+  EXPECT_EQ(0u, replicator.lease_expiry_micros());
+
+  // 之后的复制请求的响应可以
+  env.AdvanceMillis(10);
+  bin_logger->AppendEntry(log_entry);
+  replicator.Replicate();
+  peer2.Reply(true, 2);
+  EXPECT_EQ(start + 800000, replicator.lease_expiry_micros());
+}
+
+TEST(Replicator, SuspendedLeaseNotExtended) {
+  std::unique_ptr<BinLogger> bin_logger = NewBinLogger("/tmp/replicator_test11", 0, 1);
+  base::FakeClockEnv env;
+  FakePeerClient peer1("peer1"), peer2("peer2");
+  Replicator::Options options;
+  options.env = &env;
+  options.lease_micros = 800000;
+  Replicator replicator(options, bin_logger.get(), {&peer1, &peer2});
+  replicator.Start(1, -1);
+
+  LogEntry log_entry;
+  log_entry.term = 1;
+  // peer1 确认一条新的日志, 同时确认之前开始的各轮
+  auto confirm = [&]() {
+    env.AdvanceMillis(10);
+    bin_logger->AppendEntry(log_entry);
+    replicator.Replicate();
+    while (peer1.pending() > 0) {
+      peer1.Reply(true, bin_logger->GetLength());
+    }
+  };
+  bin_logger->AppendEntry(log_entry);
+  replicator.Replicate();
+  peer1.Reply(true, 1);
+  EXPECT_EQ(0, replicator.commit_index());
+
+  uint64_t start = env.NowMicros();
+  replicator.KeepAlive();
+  confirm();
+  EXPECT_EQ(start + 800000, replicator.lease_expiry_micros());
+
+  // 开始转移: lease 立即失效, 之后确认的一轮也不续约
+  replicator.SuspendLease();
+  EXPECT_EQ(0u, replicator.lease_expiry_micros());
+  replicator.KeepAlive();
+  confirm();
+  EXPECT_EQ(0u, replicator.lease_expiry_micros());
+
+  // 转移失败后恢复, 恢复之前开始的一轮不算
+  replicator.KeepAlive();
+  env.AdvanceMillis(10);
+  replicator.ResumeLease();
+  confirm();
+  EXPECT_EQ(0u, replicator.lease_expiry_micros());
+  start = env.NowMicros();
+  replicator.KeepAlive();
+  confirm();
+  EXPECT_EQ(start + 800000, replicator.lease_expiry_micros());
+}
+
+TEST(Replicator, BusyFollowerIsThrottled) {
+  std::unique_ptr<BinLogger> bin_logger = NewBinLogger("/tmp/replicator_test8", 0, 1);
+  FakePeerClient peer("peer");
+  base::FakeClockEnv env;
+  Replicator::Options options;
+  options.leader_id = "leader";
+  options.max_inflight = 8;
+  options.max_batch_entries = 16;
+  options.env = &env;
+  Replicator replicator(options, bin_logger.get(), {&peer});
+  replicator.Start(2, -1);
+
+  for (int i = 0; i < 200; ++i) {
+    LogEntry log_entry;
+    log_entry.term = 2;
+    bin_logger->AppendEntry(log_entry);
+  }
+  replicator.Replicate();
+  ASSERT_EQ(8u, peer.pending());
+
+  // 第一个 busy 响应让窗口和批次减半, 同一个 RTT 内的其他 busy 响应不再减半
+  env.AdvanceMillis(1);
+  for (int i = 0; i < 8; ++i) {
+    peer.Reply(true, 0, -1, true);
+  }
+  std::vector<Replicator::FollowerStatus> status = replicator.GetFollowerStatus();
+  EXPECT_TRUE(status[0].busy);
+  EXPECT_EQ(4, status[0].window);
+  EXPECT_EQ(8, status[0].batch_entries);
+  ASSERT_EQ(4u, peer.pending());
+  EXPECT_EQ(8, peer.front().entries_size());
+
+  env.AdvanceMillis(1);
+  peer.Reply(true, 0, -1, true);
+  status = replicator.GetFollowerStatus();
+  EXPECT_EQ(2, status[0].window);
+  EXPECT_EQ(4, status[0].batch_entries);
+
+  // 恢复后逐渐放开
+  while (peer.pending() > 0) {
+    peer.Reply(true, 0);
+  }
+  status = replicator.GetFollowerStatus();
+  EXPECT_FALSE(status[0].busy);
+  EXPECT_GT(status[0].window, 2);
+  EXPECT_GT(status[0].batch_entries, 4);
+  EXPECT_EQ(199, status[0].match_index);
+}
+
+TEST(Replicator, WaitForMatch) {
+  std::unique_ptr<BinLogger> bin_logger = NewBinLogger("/tmp/replicator_test9", 0, 1);
+  FakePeerClient peer1("peer1"), peer2("peer2");
+  Replicator::Options options;
+  options.leader_id = "leader";
+  options.max_batch_entries = 5;
+  Replicator replicator(options, bin_logger.get(), {&peer1, &peer2});
+  replicator.Start(2, -1);
+  for (int i = 0; i < 10; ++i) {
+    LogEntry log_entry;
+    log_entry.term = 2;
+    bin_logger->AppendEntry(log_entry);
+  }
+
+  std::vector<base::Status> results;
+  auto record = [&results](const base::Status& s) { results.push_back(s); };
+  replicator.WaitForMatch("nobody", 9, record);
+  ASSERT_EQ(1u, results.size());
+  EXPECT_TRUE(base::errors::IsNotFound(results[0]));
+
+  // 等待时立即发送日志, 确认到 index 之后才回调
+  replicator.WaitForMatch("peer1", 9, record);
+  ASSERT_EQ(2u, peer1.pending());
+  peer1.Reply(true, 0);
+  EXPECT_EQ(1u, results.size());
+  peer1.Reply(true, 0);
+  ASSERT_EQ(2u, results.size());
+  EXPECT_TRUE(results[1].ok());
+
+  // 已经满足时立即回调
+  replicator.WaitForMatch("peer1", 9, record);
+  ASSERT_EQ(3u, results.size());
+  EXPECT_TRUE(results[2].ok());
+
+  // 新的等待者取代旧的, Stop 时未完成的等待者失败
+  replicator.WaitForMatch("peer2", 9, record);
+  replicator.WaitForMatch("peer2", 9, record);
+  ASSERT_EQ(4u, results.size());
+  EXPECT_TRUE(base::errors::IsAborted(results[3]));
+  replicator.Stop();
+  ASSERT_EQ(5u, results.size());
+  EXPECT_TRUE(base::errors::IsUnavailable(results[4]));
+}
+
+TEST(Replicator, StaleTermAcksIgnored) {
+  std::unique_ptr<BinLogger> bin_logger = NewBinLogger("/tmp/replicator_test10", 0, 1);
+  FakePeerClient peer1("peer1"), peer2("peer2");
+  int64_t committed = -1;
+  Replicator::Options options;
+  options.leader_id = "leader";
+  options.commit_callback = [&committed](int64_t index) { committed = index; };
+  Replicator replicator(options, bin_logger.get(), {&peer1, &peer2});
+  replicator.Start(1, -1);
+  LogEntry log_entry;
+  log_entry.term = 1;
+  bin_logger->AppendEntry(log_entry);
+  bin_logger->AppendEntry(log_entry);
+  replicator.Replicate();
+  ASSERT_EQ(1u, peer1.pending());
+
+  // 退位后再次当选, index 1 被截断并由 term 3 的日志覆盖
+  replicator.Stop();
+  bin_logger->Truncate(0);
+  replicator.Start(3, -1);
+  log_entry.term = 3;
+  bin_logger->AppendEntry(log_entry);
+
+  // 延迟到达的 term 1 的确认不能提交 term 3 的 index 1
+  peer1.Reply(true, 2);
+  peer2.Reply(true, 2);
+  EXPECT_EQ(-1, committed);
+  EXPECT_EQ(-1, replicator.GetFollowerStatus()[0].match_index);
+  EXPECT_EQ(-1, replicator.commit_index());
+
+  replicator.Replicate();
+  ASSERT_EQ(1u, peer2.pending());
+  // 比当前 term 小的响应同样忽略
+  peer2.Reply(true, 2, 2);
+  EXPECT_EQ(-1, committed);
+  ASSERT_EQ(1u, peer1.pending());
+  EXPECT_EQ(3, peer1.front().term());
+  peer1.Reply(true, 2);
+  EXPECT_EQ(1, committed);
+}
+
+} // namespace chubby
+} // namespace mpr
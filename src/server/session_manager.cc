@@ -0,0 +1,181 @@
+#include "server/session_manager.h"
+
+#include "base/logging.h"
+#include "base/monitoring/monitoring.h"
+
+#include <gflags/gflags.h>
+
+DECLARE_int32(chubby_session_lease);
+DECLARE_int32(chubby_session_tick);
+
+namespace mpr {
+namespace chubby {
+
+namespace {
+
+base::monitoring::Gauge<>* sessions_gauge =
+    base::monitoring::Gauge<>::New("chubby_sessions", "Live client sessions");
+
+base::monitoring::Counter<>* expired_counter =
+    base::monitoring::Counter<>::New("chubby_expired_sessions",
+                                     "Sessions expired without KeepAlive");
+
+} // namespace
+
+SessionManager::Options::Options()
+  : lease_micros(FLAGS_chubby_session_lease * 1000LL),
+    tick_micros(FLAGS_chubby_session_tick * 1000LL),
+    env(base::Env::Default()),
+    start_thread(true) {}
+
+SessionManager::SessionManager(const Options& options, ExpireCallback expired)
+  : options_(options),
+    expired_(std::move(expired)),
+    next_id_(0) {
+  base::thread::TimingWheel::Options wheel_options;
+  wheel_options.tick_micros = options_.tick_micros;
+  wheel_options.env = options_.env;
+  wheel_options.start_thread = options_.start_thread;
+  wheel_.reset(new base::thread::TimingWheel(wheel_options,
+      [this](std::vector<base::uint64>* ids) { HandleExpired(ids); }));
+}
+
+SessionManager::~SessionManager() {
+  wheel_.reset();
+}
+
+void SessionManager::KeepAlive(const KeepAliveRequest& request) {
+  base::mutex_lock l(mu_);
+  DoRenew(request.session_id());
+}
+
+int32_t SessionManager::KeepAliveBatch(const KeepAliveBatchRequest& request) {
+  base::mutex_lock l(mu_);
+  for (const KeepAliveRequest& session : request.sessions()) {
+    DoRenew(session.session_id());
+  }
+  return request.sessions_size();
+}
+
+void SessionManager::Restore(const std::vector<std::string>& session_ids) {
+  {
+    base::mutex_lock l(mu_);
+    for (const std::string& session_id : session_ids) {
+      DoRenew(session_id);
+    }
+  }
+  LOG(INFO) << "[SessionManager] restored " << session_ids.size()
+            << " sessions holding locks";
+}
+
+void SessionManager::AddLock(const std::string& session_id,
+                             const std::string& key) {
+  base::mutex_lock l(mu_);
+  DoRenew(session_id)->locks.insert(key);
+}
+
+void SessionManager::RemoveLock(const std::string& session_id,
+                                const std::string& key) {
+  base::mutex_lock l(mu_);
+  auto it = sessions_.find(session_id);
+  if (it != sessions_.end()) {
+    it->second.locks.erase(key);
+  }
+}
+
+bool SessionManager::Close(const std::string& session_id,
+                           std::vector<std::string>* locks) {
+  base::mutex_lock l(mu_);
+  auto it = sessions_.find(session_id);
+  if (it == sessions_.end()) {
+    return false;
+  }
+  wheel_->Cancel(it->second.id);
+  if (locks != nullptr) {
+    locks->assign(it->second.locks.begin(), it->second.locks.end());
+  }
+  session_ids_.erase(it->second.id);
+  sessions_.erase(it);
+  sessions_gauge->Set(sessions_.size());
+  return true;
+}
+
+bool SessionManager::Alive(const std::string& session_id) const {
+  base::mutex_lock l(mu_);
+  return sessions_.count(session_id) > 0;
+}
+
+std::vector<std::string> SessionManager::GetLocks(
+    const std::string& session_id) const {
+  base::mutex_lock l(mu_);
+  auto it = sessions_.find(session_id);
+  if (it == sessions_.end()) {
+    return std::vector<std::string>();
+  }
+  return std::vector<std::string>(it->second.locks.begin(),
+                                  it->second.locks.end());
+}
+
+size_t SessionManager::size() const {
+  base::mutex_lock l(mu_);
+  return sessions_.size();
+}
+
+SessionManager::Session* SessionManager::DoRenew(const std::string& session_id) {
+  auto it = sessions_.find(session_id);
+  if (it == sessions_.end()) {
+    it = sessions_.emplace(session_id, Session()).first;
+    it->second.id = next_id_++;
+    session_ids_[it->second.id] = session_id;
+    sessions_gauge->Set(sessions_.size());
+  }
+  Session* session = &it->second;
+  session->expire_micros = options_.env->NowMicros() + options_.lease_micros;
+  wheel_->Schedule(session->id, options_.lease_micros);
+  return session;
+}
+
+void SessionManager::HandleExpired(std::vector<base::uint64>* ids) {
+  std::vector<Expired> expired;
+  {
+    base::mutex_lock l(mu_);
+    const uint64_t now = options_.env->NowMicros();
+    for (base::uint64 id : *ids) {
+      auto id_it = session_ids_.find(id);
+      if (id_it == session_ids_.end()) {
+        continue;
+      }
+      auto it = sessions_.find(id_it->second);
+      // 时间轮取出定时器之后, 加锁之前可能刚刚续约过
+      if (now < it->second.expire_micros) {
+        if (!wheel_->Contains(id)) {
+          wheel_->Schedule(id, it->second.expire_micros - now);
+        }
+        continue;
+      }
+      Expired session;
+      session.session_id = it->first;
+      session.locks.assign(it->second.locks.begin(), it->second.locks.end());
+      expired.push_back(std::move(session));
+      session_ids_.erase(id_it);
+      sessions_.erase(it);
+    }
+    sessions_gauge->Set(sessions_.size());
+  }
+  if (expired.empty()) {
+    return;
+  }
+  if (options_.lock_source) {
+    for (Expired& session : expired) {
+      session.locks = options_.lock_source(session.session_id);
+    }
+  }
+  expired_counter->IncrementBy(expired.size());
+  VLOG(1) << "[SessionManager] " << expired.size() << " sessions expired";
+  if (expired_) {
+    expired_(&expired);
+  }
+}
+
+} // namespace chubby
+} // namespace mpr
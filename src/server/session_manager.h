@@ -0,0 +1,101 @@
+#ifndef MPR_CHUBBY_SERVER_SESSION_MANAGER_H_
+#define MPR_CHUBBY_SERVER_SESSION_MANAGER_H_
+
+#include <functional>
+#include <memory>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "base/macros.h"
+#include "base/platform/env.h"
+#include "base/platform/mutex.h"
+#include "base/thread/timing_wheel.h"
+#include "proto/service.pb.h"
+
+namespace mpr {
+namespace chubby {
+
+// 客户端会话的 lease 以及会话持有的锁.
+//
+// 每个会话在 TimingWheel 中有一个定时器, KeepAlive 续约是 O(1) 的. 同一个
+// tick 到期的会话一次交给 ExpireCallback, 由调用者批量释放它们持有的锁 (例如
+// 合并为一批 kUnLock 提案). follower 和 proxy 用 KeepAliveForwarder 合并转发
+// 续约, leader 用 KeepAliveBatch 批量处理.
+//
+// 会话只在 leader 的内存中, 不复制. 锁的归属以 Options.lock_source (leader 上
+// 为 LockManager::GetLocks) 为准, KeepAlive 中客户端自称持有的锁不被采信.
+// 换主后新 leader 调用 Restore(LockManager::GetSessions()), 为每个持有锁的
+// 会话建立一个完整 lease 的会话: 客户端在 lease 内找到新 leader 续约就保留
+// 它的锁, 否则锁随会话过期释放, 不会因为新 leader 不知道会话而永远不释放.
+class SessionManager {
+ public:
+  struct Expired {
+    std::string session_id;
+    std::vector<std::string> locks;
+  };
+  // 调用时不持有内部锁
+  typedef std::function<void(std::vector<Expired>* sessions)> ExpireCallback;
+
+  struct Options {
+    int64_t lease_micros;
+    // lease 到期的精度
+    int64_t tick_micros;
+    base::Env* env;
+    // 为 false 时由调用者调用 AdvanceTo
+    bool start_thread;
+    // 设置时过期会话的锁由它给出, 否则使用 AddLock/RemoveLock 记录的锁
+    std::function<std::vector<std::string>(const std::string& session_id)> lock_source;
+
+    Options();
+  };
+
+  SessionManager(const Options& options, ExpireCallback expired);
+  ~SessionManager();
+
+  // 创建或续约会话. request.locks 只是客户端的视图, 被忽略.
+  void KeepAlive(const KeepAliveRequest& request);
+  // 转发来的一批续约, 只加一次锁. 返回续约的会话数.
+  int32_t KeepAliveBatch(const KeepAliveBatchRequest& request);
+  // 成为 leader 后调用, 为每个会话建立或续约一个完整的 lease
+  void Restore(const std::vector<std::string>& session_ids);
+  // 加锁/解锁成功后调用, 会话不存在时创建
+  void AddLock(const std::string& session_id, const std::string& key);
+  void RemoveLock(const std::string& session_id, const std::string& key);
+  // 客户端主动结束会话, 返回它持有的锁; 会话不存在时返回 false
+  bool Close(const std::string& session_id, std::vector<std::string>* locks);
+
+  bool Alive(const std::string& session_id) const;
+  std::vector<std::string> GetLocks(const std::string& session_id) const;
+  size_t size() const;
+
+  void AdvanceTo(uint64_t now_micros) { wheel_->AdvanceTo(now_micros); }
+
+ private:
+  struct Session {
+    // TimingWheel 中的 key
+    base::uint64 id;
+    uint64_t expire_micros;
+    std::set<std::string> locks;
+  };
+
+  Session* DoRenew(const std::string& session_id);
+  void HandleExpired(std::vector<base::uint64>* ids);
+
+  const Options options_;
+  const ExpireCallback expired_;
+
+  mutable base::mutex mu_;
+  base::uint64 next_id_;
+  std::unordered_map<std::string, Session> sessions_;
+  std::unordered_map<base::uint64, std::string> session_ids_;
+  // 最先析构: tick 线程退出之后才能释放上面的成员
+  std::unique_ptr<base::thread::TimingWheel> wheel_;
+
+  DISALLOW_COPY_AND_ASSIGN(SessionManager);
+};
+
+} // namespace chubby
+} // namespace mpr
+#endif // MPR_CHUBBY_SERVER_SESSION_MANAGER_H_
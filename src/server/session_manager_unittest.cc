@@ -0,0 +1,155 @@
+#include <gtest/gtest.h>
+#include <map>
+
+#include "server/session_manager.h"
+#include "base/platform/env_test_util.h"
+
+namespace mpr {
+namespace chubby {
+
+namespace {
+
+class SessionManagerTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    Recreate(nullptr);
+  }
+
+  void Recreate(std::function<std::vector<std::string>(const std::string&)> lock_source) {
+    SessionManager::Options options;
+    options.lease_micros = 1000000;
+    options.tick_micros = 10000;
+    options.env = &env_;
+    options.start_thread = false;
+    options.lock_source = std::move(lock_source);
+    sessions_.reset(new SessionManager(options,
+        [this](std::vector<SessionManager::Expired>* sessions) {
+          batches_.push_back(*sessions);
+        }));
+  }
+
+  void AdvanceMillis(int64_t ms) {
+    env_.AdvanceMillis(ms);
+    sessions_->AdvanceTo(env_.NowMicros());
+  }
+
+  void KeepAlive(const std::string& session_id,
+                 const std::vector<std::string>& locks) {
+    KeepAliveRequest request;
+    request.set_session_id(session_id);
+    for (const std::string& lock : locks) {
+      request.add_locks(lock);
+    }
+    sessions_->KeepAlive(request);
+  }
+
+  base::FakeClockEnv env_;
+  std::unique_ptr<SessionManager> sessions_;
+  std::vector<std::vector<SessionManager::Expired>> batches_;
+};
+
+} // namespace
+
+TEST_F(SessionManagerTest, ExpiresWithoutKeepAlive) {
+  KeepAlive("s1", {"/lock/a"});
+  KeepAlive("s2", {});
+  sessions_->AddLock("s2", "/lock/b");
+  sessions_->AddLock("s2", "/lock/c");
+  sessions_->RemoveLock("s2", "/lock/c");
+  EXPECT_EQ(2u, sessions_->size());
+
+  AdvanceMillis(500);
+  KeepAlive("s1", {"/lock/a"});
+  AdvanceMillis(500);
+  // s2 到期, 持有的锁一起交给回调
+  EXPECT_TRUE(sessions_->Alive("s1"));
+  EXPECT_FALSE(sessions_->Alive("s2"));
+  ASSERT_EQ(1u, batches_.size());
+  ASSERT_EQ(1u, batches_[0].size());
+  EXPECT_EQ("s2", batches_[0][0].session_id);
+  ASSERT_EQ(1u, batches_[0][0].locks.size());
+  EXPECT_EQ("/lock/b", batches_[0][0].locks[0]);
+
+  AdvanceMillis(500);
+  EXPECT_FALSE(sessions_->Alive("s1"));
+  EXPECT_EQ(2u, batches_.size());
+  EXPECT_EQ(0u, sessions_->size());
+}
+
+TEST_F(SessionManagerTest, ExpiresInBatches) {
+  for (int i = 0; i < 1000; ++i) {
+    KeepAlive("session" + std::to_string(i), {"/lock/" + std::to_string(i)});
+  }
+  AdvanceMillis(999);
+  EXPECT_TRUE(batches_.empty());
+  AdvanceMillis(1);
+  ASSERT_EQ(1u, batches_.size());
+  EXPECT_EQ(1000u, batches_[0].size());
+}
+
+TEST_F(SessionManagerTest, KeepAliveBatch) {
+  KeepAlive("s1", {"/lock/a"});
+  AdvanceMillis(600);
+  KeepAliveBatchRequest request;
+  request.set_forwarder_id("follower1");
+  for (int i = 0; i < 100; ++i) {
+    KeepAliveRequest* session = request.add_sessions();
+    session->set_session_id("session" + std::to_string(i));
+  }
+  KeepAliveRequest* s1 = request.add_sessions();
+  s1->set_session_id("s1");
+  s1->add_locks("/lock/b");
+  EXPECT_EQ(101, sessions_->KeepAliveBatch(request));
+  EXPECT_EQ(101u, sessions_->size());
+  // 客户端自称持有的锁不被采信
+  EXPECT_TRUE(sessions_->GetLocks("s1").empty());
+
+  // s1 随批次一起续约
+  AdvanceMillis(600);
+  EXPECT_TRUE(sessions_->Alive("s1"));
+  AdvanceMillis(400);
+  EXPECT_EQ(0u, sessions_->size());
+  ASSERT_EQ(1u, batches_.size());
+  EXPECT_EQ(101u, batches_[0].size());
+}
+
+TEST_F(SessionManagerTest, Close) {
+  KeepAlive("s1", {});
+  sessions_->AddLock("s1", "/lock/a");
+  sessions_->AddLock("s1", "/lock/b");
+  std::vector<std::string> locks;
+  EXPECT_TRUE(sessions_->Close("s1", &locks));
+  EXPECT_EQ(2u, locks.size());
+  EXPECT_FALSE(sessions_->Close("s1", &locks));
+  AdvanceMillis(2000);
+  EXPECT_TRUE(batches_.empty());
+}
+
+TEST_F(SessionManagerTest, RestoresLockOwnersFromLockTable) {
+  // 新 leader 只有复制过来的锁表
+  std::map<std::string, std::vector<std::string>> owners = {
+      {"s1", {"/lock/a"}}, {"s2", {"/lock/b", "/lock/c"}}};
+  Recreate([&owners](const std::string& session_id) {
+    return owners[session_id];
+  });
+  sessions_->Restore({"s1", "s2"});
+  EXPECT_EQ(2u, sessions_->size());
+
+  // s1 在 lease 内找到新 leader 续约, 自称持有的锁被忽略
+  AdvanceMillis(600);
+  KeepAlive("s1", {"/lock/x"});
+  AdvanceMillis(400);
+  EXPECT_TRUE(sessions_->Alive("s1"));
+  EXPECT_FALSE(sessions_->Alive("s2"));
+  ASSERT_EQ(1u, batches_.size());
+  ASSERT_EQ(1u, batches_[0].size());
+  EXPECT_EQ("s2", batches_[0][0].session_id);
+  EXPECT_EQ(owners["s2"], batches_[0][0].locks);
+
+  AdvanceMillis(600);
+  ASSERT_EQ(2u, batches_.size());
+  EXPECT_EQ(std::vector<std::string>({"/lock/a"}), batches_[1][0].locks);
+}
+
+} // namespace chubby
+} // namespace mpr
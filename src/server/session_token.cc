@@ -0,0 +1,193 @@
+#include "server/session_token.h"
+
+#include <openssl/crypto.h>
+#include <openssl/evp.h>
+#include <openssl/hmac.h>
+#include <openssl/rand.h>
+
+#include "base/coding.h"
+#include "base/errors.h"
+#include "base/logging.h"
+#include "base/raw_coding.h"
+#include "base/strings/base64.h"
+#include "storage/meta.h"
+
+#include <gflags/gflags.h>
+
+DECLARE_int32(chubby_session_token_ttl);
+
+namespace mpr {
+namespace chubby {
+
+namespace {
+
+const char kTokenPrefix[] = "t1.";
+const size_t kTokenPrefixSize = sizeof(kTokenPrefix) - 1;
+// epoch 和过期时间
+const size_t kHeaderSize = 16;
+const size_t kKeySize = 32;
+
+} // namespace
+
+SessionTokens::Options::Options()
+  : epoch(0),
+    ttl_micros(FLAGS_chubby_session_token_ttl * 1000LL * 1000LL),
+    env(base::Env::Default()),
+    meta(nullptr) {}
+
+SessionTokens::SessionTokens(const Options& options)
+  : options_(options),
+    key_(options.key),
+    epoch_(options.epoch) {}
+
+// static
+std::string SessionTokens::GenerateKey() {
+  std::string key(kKeySize, '\0');
+  CHECK_EQ(1, RAND_bytes(reinterpret_cast<unsigned char*>(&key[0]), key.size()));
+  return key;
+}
+
+// static
+bool SessionTokens::IsToken(const std::string& uuid) {
+  return uuid.compare(0, kTokenPrefixSize, kTokenPrefix) == 0;
+}
+
+// static
+LogEntry SessionTokens::KeyEntry(int64_t epoch, const std::string& key) {
+  LogEntry log_entry;
+  log_entry.log_operation = kTokenKey;
+  base::PutFixed64(&log_entry.value, epoch);
+  log_entry.value.append(key);
+  return log_entry;
+}
+
+bool SessionTokens::Apply(const LogEntry& log_entry) {
+  if (log_entry.log_operation != kTokenKey) {
+    return false;
+  }
+  if (log_entry.value.size() <= 8) {
+    LOG(ERROR) << "[SessionTokens] malformed token key entry";
+    return true;
+  }
+  const int64_t epoch =
+      static_cast<int64_t>(base::DecodeFixed64(log_entry.value.data()));
+  {
+    base::mutex_lock l(mu_);
+    if (epoch <= epoch_) {
+      return true;
+    }
+    key_.assign(log_entry.value, 8, std::string::npos);
+    epoch_ = epoch;
+  }
+  if (options_.meta != nullptr) {
+    base::Status status =
+        options_.meta->WriteTokenKey(epoch, log_entry.value.substr(8));
+    if (!status.ok()) {
+      LOG(ERROR) << "[SessionTokens] failed to persist token key: " << status;
+    }
+  }
+  LOG(INFO) << "[SessionTokens] token key epoch " << epoch;
+  return true;
+}
+
+int64_t SessionTokens::epoch() const {
+  base::mutex_lock l(mu_);
+  return epoch_;
+}
+
+std::string SessionTokens::Issue(const std::string& username) const {
+  std::string key;
+  int64_t epoch;
+  {
+    base::mutex_lock l(mu_);
+    key = key_;
+    epoch = epoch_;
+  }
+  if (key.empty()) {
+    return std::string();
+  }
+  std::string payload;
+  base::PutFixed64(&payload, epoch);
+  base::PutFixed64(&payload, options_.env->NowMicros() + options_.ttl_micros);
+  payload.append(username);
+
+  std::string token(kTokenPrefix);
+  std::string encoded;
+  base::strings::Base64Encode(payload, &encoded);
+  token.append(encoded);
+  token.push_back('.');
+  base::strings::Base64Encode(Sign(key, payload), &encoded);
+  token.append(encoded);
+  return token;
+}
+
+base::Status SessionTokens::Verify(const std::string& token, Cache* cache,
+                                   std::string* username) const {
+  std::string key;
+  int64_t current_epoch;
+  {
+    base::mutex_lock l(mu_);
+    key = key_;
+    current_epoch = epoch_;
+  }
+  if (key.empty()) {
+    return base::errors::Unauthenticated("no session token key");
+  }
+  const uint64_t now = options_.env->NowMicros();
+  if (cache != nullptr && cache->token == token && now < cache->expire_micros &&
+      cache->epoch >= current_epoch) {
+    *username = cache->username;
+    return base::Status::OK();
+  }
+
+  const size_t dot = token.rfind('.');
+  if (!IsToken(token) || dot < kTokenPrefixSize) {
+    return base::errors::Unauthenticated("malformed session token");
+  }
+  std::string payload, signature;
+  if (!base::strings::Base64Decode(
+          base::StringPiece(token.data() + kTokenPrefixSize,
+                            dot - kTokenPrefixSize),
+          &payload) ||
+      !base::strings::Base64Decode(
+          base::StringPiece(token.data() + dot + 1, token.size() - dot - 1),
+          &signature) ||
+      payload.size() < kHeaderSize) {
+    return base::errors::Unauthenticated("malformed session token");
+  }
+  const std::string expected = Sign(key, payload);
+  if (signature.size() != expected.size() ||
+      CRYPTO_memcmp(signature.data(), expected.data(), expected.size()) != 0) {
+    return base::errors::Unauthenticated("bad session token signature");
+  }
+  const int64_t epoch = static_cast<int64_t>(base::DecodeFixed64(payload.data()));
+  const uint64_t expire_micros = base::DecodeFixed64(payload.data() + 8);
+  if (epoch < current_epoch) {
+    return base::errors::Unauthenticated("session token revoked");
+  }
+  if (now >= expire_micros) {
+    return base::errors::Unauthenticated("session token expired");
+  }
+  username->assign(payload, kHeaderSize, std::string::npos);
+  if (cache != nullptr) {
+    cache->token = token;
+    cache->username = *username;
+    cache->expire_micros = expire_micros;
+    cache->epoch = epoch;
+  }
+  return base::Status::OK();
+}
+
+// static
+std::string SessionTokens::Sign(const std::string& key,
+                                const std::string& payload) {
+  unsigned char mac[EVP_MAX_MD_SIZE];
+  unsigned int size = 0;
+  HMAC(EVP_sha256(), key.data(), key.size(),
+       reinterpret_cast<const unsigned char*>(payload.data()), payload.size(),
+       mac, &size);
+  return std::string(reinterpret_cast<const char*>(mac), size);
+}
+
+} // namespace chubby
+} // namespace mpr
@@ -0,0 +1,86 @@
+#ifndef MPR_CHUBBY_SERVER_SESSION_TOKEN_H_
+#define MPR_CHUBBY_SERVER_SESSION_TOKEN_H_
+
+#include <string>
+
+#include "base/macros.h"
+#include "base/status.h"
+#include "base/platform/env.h"
+#include "base/platform/mutex.h"
+#include "storage/bin_logger.h"
+
+namespace mpr {
+namespace chubby {
+
+class Meta;
+
+// 无状态的会话 token.
+//
+// 用户名, 过期时间和 epoch 用集群共享的密钥做 HMAC-SHA256 签名, 任何副本只用
+// 密钥就能验证, 不需要查登录表, 也不需要问 leader.
+//
+// 密钥和 epoch 随日志复制: leader 提议 KeyEntry 生成的 kTokenKey 日志, 每个
+// 副本在 apply 路径调用 Apply, 只接受更大的 epoch, 并写入 Meta 以便重启后从
+// Meta::ReadTokenKey 恢复 (之前的日志可能已经回收). 提议一个更大的 epoch
+// (可以换新密钥) 使之前签发的 token 在所有副本上失效. 还没有 apply 过密钥时
+// 不能签发, 所有 token 验证失败.
+//
+// 格式: "t1." + base64(fixed64 epoch, fixed64 过期时间, 用户名) + "." +
+// base64(签名). 请求的 uuid 字段可以直接携带 token.
+class SessionTokens {
+ public:
+  // 每个连接一个. 同一个连接上的请求通常带同一个 token, 只验证一次签名.
+  struct Cache {
+    std::string token;
+    std::string username;
+    uint64_t expire_micros = 0;
+    int64_t epoch = 0;
+  };
+
+  struct Options {
+    // 启动时从 Meta 读出的密钥, 可以为空
+    std::string key;
+    int64_t epoch;
+    int64_t ttl_micros;
+    base::Env* env;
+    // 不为空时 Apply 接受的密钥写入 Meta
+    Meta* meta;
+
+    Options();
+  };
+
+  explicit SessionTokens(const Options& options);
+
+  // 生成随机密钥
+  static std::string GenerateKey();
+  // uuid 是否是 token 格式, 不验证签名
+  static bool IsToken(const std::string& uuid);
+  // 更换密钥和 epoch 的日志, 由 leader 提议
+  static LogEntry KeyEntry(int64_t epoch, const std::string& key);
+
+  // apply 路径调用, 不是 kTokenKey 时返回 false. epoch 不大于当前值的日志
+  // (重启后重放) 被忽略.
+  bool Apply(const LogEntry& log_entry);
+  int64_t epoch() const;
+
+  // 还没有密钥时返回空串
+  std::string Issue(const std::string& username) const;
+  // 格式或签名错误, 过期, epoch 过旧时返回 Unauthenticated. cache 可以为空.
+  base::Status Verify(const std::string& token, Cache* cache,
+                      std::string* username) const;
+
+ private:
+  static std::string Sign(const std::string& key, const std::string& payload);
+
+  const Options options_;
+
+  mutable base::mutex mu_;
+  std::string key_;
+  int64_t epoch_;
+
+  DISALLOW_COPY_AND_ASSIGN(SessionTokens);
+};
+
+} // namespace chubby
+} // namespace mpr
+#endif // MPR_CHUBBY_SERVER_SESSION_TOKEN_H_
@@ -0,0 +1,139 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include "server/session_token.h"
+#include "base/errors.h"
+#include "storage/meta.h"
+#include "base/platform/env_test_util.h"
+
+namespace mpr {
+namespace chubby {
+
+namespace {
+
+SessionTokens::Options TestOptions(const std::string& key, int64_t epoch,
+                                   base::Env* env) {
+  SessionTokens::Options options;
+  options.key = key;
+  options.epoch = epoch;
+  options.ttl_micros = 1000 * 1000;
+  options.env = env;
+  return options;
+}
+
+} // namespace
+
+TEST(SessionTokens, IssueAndVerify) {
+  base::FakeClockEnv env;
+  const std::string key = SessionTokens::GenerateKey();
+  SessionTokens leader(TestOptions(key, 1, &env));
+  // 其他副本只需要相同的密钥
+  SessionTokens follower(TestOptions(key, 1, &env));
+
+  const std::string token = leader.Issue("alice");
+  EXPECT_TRUE(SessionTokens::IsToken(token));
+  EXPECT_FALSE(SessionTokens::IsToken("0123456789abcdef"));
+  std::string name;
+  ASSERT_TRUE(follower.Verify(token, nullptr, &name).ok());
+  EXPECT_EQ("alice", name);
+
+  // 其他密钥签发的 token
+  SessionTokens other(TestOptions(SessionTokens::GenerateKey(), 1, &env));
+  EXPECT_TRUE(base::errors::IsUnauthenticated(
+      follower.Verify(other.Issue("alice"), nullptr, &name)));
+
+  // 修改用户名后签名不匹配
+  std::string forged = token;
+  forged[5] ^= 1;
+  EXPECT_TRUE(base::errors::IsUnauthenticated(
+      follower.Verify(forged, nullptr, &name)));
+  EXPECT_TRUE(base::errors::IsUnauthenticated(
+      follower.Verify("t1.", nullptr, &name)));
+  EXPECT_TRUE(base::errors::IsUnauthenticated(
+      follower.Verify("t1.abc.", nullptr, &name)));
+}
+
+TEST(SessionTokens, ExpiryAndEpoch) {
+  base::FakeClockEnv env;
+  const std::string key = SessionTokens::GenerateKey();
+  SessionTokens tokens(TestOptions(key, 1, &env));
+  const std::string token = tokens.Issue("alice");
+  std::string name;
+
+  SessionTokens::Cache cache;
+  ASSERT_TRUE(tokens.Verify(token, &cache, &name).ok());
+  EXPECT_EQ(token, cache.token);
+  ASSERT_TRUE(tokens.Verify(token, &cache, &name).ok());
+  EXPECT_EQ("alice", name);
+
+  // 缓存的 token 同样会过期
+  env.AdvanceMillis(1000);
+  EXPECT_TRUE(base::errors::IsUnauthenticated(tokens.Verify(token, &cache, &name)));
+  EXPECT_TRUE(base::errors::IsUnauthenticated(tokens.Verify(token, nullptr, &name)));
+
+  // epoch 递增后之前的 token 失效
+  const std::string old_epoch = tokens.Issue("alice");
+  SessionTokens rotated(TestOptions(key, 2, &env));
+  EXPECT_TRUE(base::errors::IsUnauthenticated(
+      rotated.Verify(old_epoch, nullptr, &name)));
+  ASSERT_TRUE(rotated.Verify(rotated.Issue("bob"), nullptr, &name).ok());
+  EXPECT_EQ("bob", name);
+}
+
+TEST(SessionTokens, KeyReplicatedThroughLog) {
+  base::FakeClockEnv env;
+  const std::string path = "/tmp/session_token_test";
+  base::int64 undeleted_files, undeleted_dirs;
+  base::Env::Default()->DeleteDirectoryRecursively(path, &undeleted_files,
+                                                   &undeleted_dirs);
+  std::unique_ptr<Meta> meta(new Meta(path));
+  SessionTokens::Options options = TestOptions("", 0, &env);
+  options.meta = meta.get();
+  SessionTokens leader(options);
+  SessionTokens follower(TestOptions("", 0, &env));
+  std::string name;
+
+  // 还没有密钥
+  EXPECT_EQ("", leader.Issue("alice"));
+  EXPECT_TRUE(base::errors::IsUnauthenticated(
+      follower.Verify("t1.abc.def", nullptr, &name)));
+
+  LogEntry log_entry;
+  log_entry.log_operation = kPut;
+  EXPECT_FALSE(leader.Apply(log_entry));
+
+  const LogEntry first = SessionTokens::KeyEntry(1, SessionTokens::GenerateKey());
+  EXPECT_TRUE(leader.Apply(first));
+  EXPECT_TRUE(follower.Apply(first));
+  const std::string token = leader.Issue("alice");
+  SessionTokens::Cache cache;
+  ASSERT_TRUE(follower.Verify(token, &cache, &name).ok());
+  EXPECT_EQ("alice", name);
+
+  // 新 epoch 在所有副本上撤销之前的 token, 包括连接上缓存的
+  const LogEntry second = SessionTokens::KeyEntry(2, SessionTokens::GenerateKey());
+  EXPECT_TRUE(leader.Apply(second));
+  EXPECT_TRUE(follower.Apply(second));
+  EXPECT_TRUE(base::errors::IsUnauthenticated(
+      follower.Verify(token, &cache, &name)));
+  ASSERT_TRUE(follower.Verify(leader.Issue("bob"), nullptr, &name).ok());
+
+  // 重放旧日志不会回退
+  EXPECT_TRUE(follower.Apply(first));
+  EXPECT_EQ(2, follower.epoch());
+  ASSERT_TRUE(follower.Verify(leader.Issue("bob"), nullptr, &name).ok());
+
+  // 重启后从 Meta 恢复
+  meta.reset(new Meta(path));
+  int64_t epoch = 0;
+  std::string key;
+  ASSERT_TRUE(meta->ReadTokenKey(&epoch, &key).ok());
+  EXPECT_EQ(2, epoch);
+  SessionTokens restarted(TestOptions(key, epoch, &env));
+  ASSERT_TRUE(restarted.Verify(leader.Issue("carol"), nullptr, &name).ok());
+  EXPECT_EQ("carol", name);
+}
+
+} // namespace chubby
+} // namespace mpr
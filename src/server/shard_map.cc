@@ -0,0 +1,111 @@
+#include "server/shard_map.h"
+
+#include "base/errors.h"
+#include "base/logging.h"
+#include "base/hash/hash.h"
+
+namespace mpr {
+namespace chubby {
+
+namespace {
+
+void AddShard(ShardMapInfo* info, int32_t group_id,
+              const std::vector<std::string>& nodes) {
+  ShardInfo* shard = info->add_shards();
+  shard->set_group_id(group_id);
+  for (size_t i = 0; i < nodes.size(); ++i) {
+    shard->add_replicas(nodes[(group_id + i) % nodes.size()]);
+  }
+}
+
+} // namespace
+
+// static
+base::Status ShardMap::Create(const ShardMapInfo& info,
+                              std::unique_ptr<ShardMap>* result) {
+  if (info.shards_size() == 0) {
+    return base::errors::InvalidArgument("empty shard map");
+  }
+  std::unique_ptr<ShardMap> shard_map(new ShardMap(info));
+  for (int i = 0; i < info.shards_size(); ++i) {
+    const ShardInfo& shard = info.shards(i);
+    if (shard.replicas_size() == 0) {
+      return base::errors::InvalidArgument("group ", shard.group_id(),
+                                           " has no replica");
+    }
+    for (const std::string& learner : shard.learners()) {
+      for (const std::string& replica : shard.replicas()) {
+        if (learner == replica) {
+          return base::errors::InvalidArgument(learner, " is both voter and "
+                                               "learner of group ", shard.group_id());
+        }
+      }
+    }
+    if (!shard_map->groups_.emplace(shard.group_id(), i).second) {
+      return base::errors::InvalidArgument("duplicated group ", shard.group_id());
+    }
+    if (info.hash_partition()) {
+      continue;
+    }
+    // 范围必须首尾相接
+    const std::string expected_start = i == 0 ? "" : info.shards(i - 1).end_key();
+    if (shard.start_key() != expected_start ||
+        (i + 1 < info.shards_size() && shard.end_key() <= shard.start_key()) ||
+        (i + 1 == info.shards_size() && !shard.end_key().empty())) {
+      return base::errors::InvalidArgument("bad key range of group ",
+                                           shard.group_id());
+    }
+    shard_map->ranges_[shard.start_key()] = i;
+  }
+  result->reset(shard_map.release());
+  return base::Status::OK();
+}
+
+// static
+ShardMapInfo ShardMap::MakeHashShards(int32_t num_groups,
+                                      const std::vector<std::string>& nodes) {
+  ShardMapInfo info;
+  info.set_version(1);
+  info.set_hash_partition(true);
+  for (int32_t group_id = 0; group_id < num_groups; ++group_id) {
+    AddShard(&info, group_id, nodes);
+  }
+  return info;
+}
+
+// static
+ShardMapInfo ShardMap::MakeRangeShards(const std::vector<std::string>& split_keys,
+                                       const std::vector<std::string>& nodes) {
+  ShardMapInfo info;
+  info.set_version(1);
+  for (size_t i = 0; i <= split_keys.size(); ++i) {
+    AddShard(&info, i, nodes);
+    ShardInfo* shard = info.mutable_shards(i);
+    shard->set_start_key(i == 0 ? "" : split_keys[i - 1]);
+    shard->set_end_key(i == split_keys.size() ? "" : split_keys[i]);
+  }
+  return info;
+}
+
+ShardMap::ShardMap(const ShardMapInfo& info) : info_(info) {}
+
+const ShardInfo& ShardMap::Lookup(const std::string& key) const {
+  if (info_.hash_partition()) {
+    return info_.shards(base::hash::Hash64(key) % info_.shards_size());
+  }
+  auto it = ranges_.upper_bound(key);
+  DCHECK(it != ranges_.begin());
+  --it;
+  return info_.shards(it->second);
+}
+
+const ShardInfo* ShardMap::GetShard(int32_t group_id) const {
+  auto it = groups_.find(group_id);
+  if (it == groups_.end()) {
+    return nullptr;
+  }
+  return &info_.shards(it->second);
+}
+
+} // namespace chubby
+} // namespace mpr
@@ -0,0 +1,54 @@
+#ifndef MPR_CHUBBY_SERVER_SHARD_MAP_H_
+#define MPR_CHUBBY_SERVER_SHARD_MAP_H_
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base/macros.h"
+#include "base/status.h"
+#include "proto/service.pb.h"
+
+namespace mpr {
+namespace chubby {
+
+// key -> 共识组的路由表.
+//
+// 按 key 范围划分时, shards 的范围必须连续并覆盖整个 key 空间; 按 hash
+// 划分时 key 由 Hash64(key) % shards_size() 决定所在的组. 只读, 更新时
+// 整体替换.
+class ShardMap {
+ public:
+  static base::Status Create(const ShardMapInfo& info,
+                             std::unique_ptr<ShardMap>* result);
+
+  // 按 hash 划分为 num_groups 个组, 每个组的副本是全部 nodes. 各组的首选
+  // leader 在 nodes 之间轮转, 写负载均匀分布到所有节点.
+  static ShardMapInfo MakeHashShards(int32_t num_groups,
+                                     const std::vector<std::string>& nodes);
+  // 按 split_keys 划分为 split_keys.size() + 1 个范围, 同样轮转首选 leader
+  static ShardMapInfo MakeRangeShards(const std::vector<std::string>& split_keys,
+                                      const std::vector<std::string>& nodes);
+
+  const ShardInfo& Lookup(const std::string& key) const;
+  // 不存在时返回 nullptr
+  const ShardInfo* GetShard(int32_t group_id) const;
+
+  const ShardMapInfo& info() const { return info_; }
+  int64_t version() const { return info_.version(); }
+
+ private:
+  explicit ShardMap(const ShardMapInfo& info);
+
+  ShardMapInfo info_;
+  // start_key -> shards 中的下标
+  std::map<std::string, int> ranges_;
+  std::map<int32_t, int> groups_;
+
+  DISALLOW_COPY_AND_ASSIGN(ShardMap);
+};
+
+} // namespace chubby
+} // namespace mpr
+#endif // MPR_CHUBBY_SERVER_SHARD_MAP_H_
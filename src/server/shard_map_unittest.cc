@@ -0,0 +1,56 @@
+#include <gtest/gtest.h>
+#include <set>
+
+#include "server/shard_map.h"
+#include "base/errors.h"
+
+namespace mpr {
+namespace chubby {
+
+TEST(ShardMap, RangeLookup) {
+  std::unique_ptr<ShardMap> shard_map;
+  ASSERT_TRUE(ShardMap::Create(ShardMap::MakeRangeShards({"g", "p"}, {"a", "b", "c"}),
+                               &shard_map).ok());
+  EXPECT_EQ(0, shard_map->Lookup("").group_id());
+  EXPECT_EQ(0, shard_map->Lookup("apple").group_id());
+  EXPECT_EQ(1, shard_map->Lookup("g").group_id());
+  EXPECT_EQ(1, shard_map->Lookup("orange").group_id());
+  EXPECT_EQ(2, shard_map->Lookup("p").group_id());
+  EXPECT_EQ(2, shard_map->Lookup("zzz").group_id());
+
+  // 首选 leader 轮转
+  EXPECT_EQ("a", shard_map->GetShard(0)->replicas(0));
+  EXPECT_EQ("b", shard_map->GetShard(1)->replicas(0));
+  EXPECT_EQ("c", shard_map->GetShard(2)->replicas(0));
+  EXPECT_EQ(nullptr, shard_map->GetShard(3));
+}
+
+TEST(ShardMap, HashSpreadsKeys) {
+  std::unique_ptr<ShardMap> shard_map;
+  ASSERT_TRUE(ShardMap::Create(ShardMap::MakeHashShards(8, {"a", "b"}),
+                               &shard_map).ok());
+  std::set<int32_t> groups;
+  for (int i = 0; i < 1000; ++i) {
+    const ShardInfo& shard = shard_map->Lookup("key" + std::to_string(i));
+    EXPECT_EQ(&shard, &shard_map->Lookup("key" + std::to_string(i)));
+    groups.insert(shard.group_id());
+  }
+  EXPECT_EQ(8u, groups.size());
+}
+
+TEST(ShardMap, RejectsBadRanges) {
+  std::unique_ptr<ShardMap> shard_map;
+  EXPECT_TRUE(base::errors::IsInvalidArgument(
+      ShardMap::Create(ShardMapInfo(), &shard_map)));
+
+  ShardMapInfo info = ShardMap::MakeRangeShards({"g", "p"}, {"a"});
+  info.mutable_shards(1)->set_start_key("h");
+  EXPECT_TRUE(base::errors::IsInvalidArgument(ShardMap::Create(info, &shard_map)));
+
+  info = ShardMap::MakeRangeShards({"g", "p"}, {"a"});
+  info.mutable_shards(2)->set_group_id(0);
+  EXPECT_TRUE(base::errors::IsInvalidArgument(ShardMap::Create(info, &shard_map)));
+}
+
+} // namespace chubby
+} // namespace mpr
@@ -0,0 +1,80 @@
+#include "server/stale_read.h"
+
+#include "base/errors.h"
+
+namespace mpr {
+namespace chubby {
+
+StaleReadTracker::StaleReadTracker(base::Env* env)
+  : env_(env),
+    leader_commit_index_(-1),
+    last_applied_(-1),
+    fresh_micros_(0) {}
+
+void StaleReadTracker::LeaderContact(const std::string& leader_id,
+                                     int64_t leader_commit_index) {
+  uint64_t now = env_->NowMicros();
+  base::mutex_lock l(mu_);
+  if (leader_id != leader_id_) {
+    leader_id_ = leader_id;
+    pending_.clear();
+  }
+  if (leader_commit_index > leader_commit_index_) {
+    leader_commit_index_ = leader_commit_index;
+  }
+  if (last_applied_ >= leader_commit_index) {
+    fresh_micros_ = now;
+  } else if (pending_.empty() || pending_.back().first < leader_commit_index) {
+    pending_.emplace_back(leader_commit_index, now);
+  }
+}
+
+void StaleReadTracker::Applied(int64_t last_applied) {
+  base::mutex_lock l(mu_);
+  if (last_applied <= last_applied_) {
+    return;
+  }
+  last_applied_ = last_applied;
+  while (!pending_.empty() && pending_.front().first <= last_applied) {
+    fresh_micros_ = pending_.front().second;
+    pending_.pop_front();
+  }
+}
+
+void StaleReadTracker::Reset() {
+  base::mutex_lock l(mu_);
+  leader_id_.clear();
+  fresh_micros_ = 0;
+  pending_.clear();
+}
+
+base::Status StaleReadTracker::CheckRead(const StaleRead& stale_read,
+                                         int64_t* last_applied,
+                                         std::string* leader_id) const {
+  uint64_t now = env_->NowMicros();
+  base::mutex_lock l(mu_);
+  *leader_id = leader_id_;
+  *last_applied = last_applied_;
+  if (last_applied_ < stale_read.min_applied_index()) {
+    return base::errors::Unavailable("last_applied ", last_applied_,
+                                     " behind ", stale_read.min_applied_index());
+  }
+  if (stale_read.max_lag_entries() > 0 &&
+      leader_commit_index_ - last_applied_ > stale_read.max_lag_entries()) {
+    return base::errors::Unavailable("lag ", leader_commit_index_ - last_applied_,
+                                     " entries");
+  }
+  if (stale_read.max_lag_ms() > 0) {
+    if (fresh_micros_ == 0) {
+      return base::errors::Unavailable("no contact with leader");
+    }
+    uint64_t lag_micros = now > fresh_micros_ ? now - fresh_micros_ : 0;
+    if (lag_micros > static_cast<uint64_t>(stale_read.max_lag_ms()) * 1000) {
+      return base::errors::Unavailable("lag ", lag_micros / 1000, " ms");
+    }
+  }
+  return base::Status::OK();
+}
+
+} // namespace chubby
+} // namespace mpr
@@ -0,0 +1,56 @@
+#ifndef MPR_CHUBBY_SERVER_STALE_READ_H_
+#define MPR_CHUBBY_SERVER_STALE_READ_H_
+
+#include <deque>
+#include <string>
+#include <utility>
+
+#include "base/macros.h"
+#include "base/status.h"
+#include "base/platform/env.h"
+#include "base/platform/mutex.h"
+#include "proto/service.pb.h"
+
+namespace mpr {
+namespace chubby {
+
+// Follower 端的有界陈旧读.
+//
+// 记录从 leader 得知的 commit_index 以及收到它的时间. 状态机 apply 到某个
+// commit_index 时, 本地数据至少和 leader 当时的状态一样新, 以此估计数据落后
+// 的时间. 客户端通过 StaleRead 声明能接受的落后程度, 满足时由本节点服务,
+// 否则重定向到 leader.
+class StaleReadTracker {
+ public:
+  explicit StaleReadTracker(base::Env* env = base::Env::Default());
+
+  // 收到 leader 的 AppendEntries (包括心跳) 后调用
+  void LeaderContact(const std::string& leader_id, int64_t leader_commit_index);
+  // 状态机 apply 到 last_applied 后调用
+  void Applied(int64_t last_applied);
+  // 失去与 leader 的联系, 例如开始选举
+  void Reset();
+
+  // 可以由本节点服务时返回 OK 并填写 last_applied, 否则返回 Unavailable.
+  // leader_id 总是填写, 供客户端重定向.
+  base::Status CheckRead(const StaleRead& stale_read, int64_t* last_applied,
+                         std::string* leader_id) const;
+
+ private:
+  base::Env* env_;
+
+  mutable base::mutex mu_;
+  std::string leader_id_;
+  int64_t leader_commit_index_;
+  int64_t last_applied_;
+  // 本地数据与 leader 一致的最近时间, 0 表示未知
+  uint64_t fresh_micros_;
+  // 尚未 apply 到的 leader commit_index 及收到的时间, 按 index 递增
+  std::deque<std::pair<int64_t, uint64_t>> pending_;
+
+  DISALLOW_COPY_AND_ASSIGN(StaleReadTracker);
+};
+
+} // namespace chubby
+} // namespace mpr
+#endif // MPR_CHUBBY_SERVER_STALE_READ_H_
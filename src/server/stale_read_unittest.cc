@@ -0,0 +1,72 @@
+#include <gtest/gtest.h>
+
+#include "server/stale_read.h"
+#include "base/errors.h"
+#include "base/platform/env_test_util.h"
+
+namespace mpr {
+namespace chubby {
+
+namespace {
+
+StaleRead MaxLag(int64_t entries, int32_t ms, int64_t min_applied = 0) {
+  StaleRead stale_read;
+  stale_read.set_max_lag_entries(entries);
+  stale_read.set_max_lag_ms(ms);
+  stale_read.set_min_applied_index(min_applied);
+  return stale_read;
+}
+
+} // namespace
+
+TEST(StaleReadTracker, LagByEntries) {
+  base::FakeClockEnv env;
+  StaleReadTracker tracker(&env);
+  int64_t last_applied;
+  std::string leader_id;
+
+  tracker.LeaderContact("leader", 100);
+  tracker.Applied(90);
+  EXPECT_TRUE(tracker.CheckRead(MaxLag(10, 0), &last_applied, &leader_id).ok());
+  EXPECT_EQ(90, last_applied);
+  EXPECT_EQ("leader", leader_id);
+  EXPECT_TRUE(base::errors::IsUnavailable(
+      tracker.CheckRead(MaxLag(5, 0), &last_applied, &leader_id)));
+  // 单调读
+  EXPECT_TRUE(base::errors::IsUnavailable(
+      tracker.CheckRead(MaxLag(0, 0, 95), &last_applied, &leader_id)));
+}
+
+TEST(StaleReadTracker, LagByTime) {
+  base::FakeClockEnv env;
+  StaleReadTracker tracker(&env);
+  int64_t last_applied;
+  std::string leader_id;
+
+  // 没有联系过 leader 时无法估计
+  EXPECT_FALSE(tracker.CheckRead(MaxLag(0, 100), &last_applied, &leader_id).ok());
+
+  tracker.LeaderContact("leader", 10);
+  env.AdvanceMillis(50);
+  tracker.LeaderContact("leader", 20);
+  env.AdvanceMillis(50);
+  // apply 越过 10, 数据与 100ms 前的 leader 一致
+  tracker.Applied(15);
+  EXPECT_TRUE(tracker.CheckRead(MaxLag(0, 100), &last_applied, &leader_id).ok());
+  EXPECT_FALSE(tracker.CheckRead(MaxLag(0, 80), &last_applied, &leader_id).ok());
+  tracker.Applied(20);
+  EXPECT_TRUE(tracker.CheckRead(MaxLag(0, 80), &last_applied, &leader_id).ok());
+
+  // 追上后每次联系都刷新
+  env.AdvanceMillis(200);
+  EXPECT_FALSE(tracker.CheckRead(MaxLag(0, 100), &last_applied, &leader_id).ok());
+  tracker.LeaderContact("leader", 20);
+  EXPECT_TRUE(tracker.CheckRead(MaxLag(0, 100), &last_applied, &leader_id).ok());
+
+  tracker.Reset();
+  EXPECT_FALSE(tracker.CheckRead(MaxLag(0, 100), &last_applied, &leader_id).ok());
+  EXPECT_TRUE(tracker.CheckRead(MaxLag(0, 0), &last_applied, &leader_id).ok());
+}
+
+} // namespace chubby
+} // namespace mpr
@@ -0,0 +1,378 @@
+#include "server/user_manager.h"
+
+#include <thread>
+
+#include "base/errors.h"
+#include "base/logging.h"
+#include "base/hash/hash.h"
+#include "base/random/random.h"
+#include "base/strings/stringprintf.h"
+#include <leveldb/iterator.h>
+#include <leveldb/write_batch.h>
+
+namespace mpr {
+namespace chubby {
+
+namespace {
+
+// 登录表的分片数, 2 的幂
+const size_t kSessionShards = 64;
+
+} // namespace
+
+UserManager::UserManager(const std::string& db_path, const UserInfo& root,
+                         const SessionTokens* tokens)
+  : root_(root),
+    tokens_(tokens),
+    logged_users_(new SessionSlot[kSessionShards]),
+    db_path_(db_path),
+    db_(nullptr) {
+  leveldb::Options options;
+  options.create_if_missing = true;
+  leveldb::Status status = leveldb::DB::Open(options, db_path_, &db_);
+  CHECK(status.ok()) << "Failed to open user db " << db_path_ << ": "
+                     << status.ToString();
+  CHECK(DoRecoverFromDatabase()) << "Failed to recover users from " << db_path_;
+}
+
+UserManager::~UserManager() {
+  delete db_;
+}
+
+base::Status UserManager::Login(const std::string& name,
+                                const std::string& password,
+                                const std::string& uuid) {
+  base::mutex_lock l(mu_);
+  RETURN_IF_ERROR(DoCheckPassword(name, password));
+  const SessionShard& shard = DoGetShard(uuid);
+  auto it = shard.find(uuid);
+  if (it != shard.end()) {
+    if (it->second == name) {
+      return base::Status::OK();
+    }
+    return base::errors::AlreadyExists("uuid ", uuid, " is used by another user");
+  }
+  DoUpdateShard(uuid, [&name, &uuid](SessionShard* sessions) {
+    (*sessions)[uuid] = name;
+  });
+  return base::Status::OK();
+}
+
+base::Status UserManager::IssueToken(const std::string& name,
+                                     const std::string& password,
+                                     std::string* token) {
+  if (tokens_ == nullptr) {
+    return base::errors::FailedPrecondition("session tokens are not enabled");
+  }
+  {
+    base::mutex_lock l(mu_);
+    RETURN_IF_ERROR(DoCheckPassword(name, password));
+  }
+  *token = tokens_->Issue(name);
+  if (token->empty()) {
+    return base::errors::Unavailable("no session token key");
+  }
+  return base::Status::OK();
+}
+
+base::Status UserManager::Logout(const std::string& uuid) {
+  base::mutex_lock l(mu_);
+  if (DoGetShard(uuid).count(uuid) == 0) {
+    return base::errors::NotFound("uuid ", uuid, " is not logged in");
+  }
+  DoUpdateShard(uuid, [&uuid](SessionShard* sessions) {
+    sessions->erase(uuid);
+  });
+  return base::Status::OK();
+}
+
+base::Status UserManager::Register(const std::string& name,
+                                   const std::string& password) {
+  if (name.empty()) {
+    return base::errors::InvalidArgument("empty user name");
+  }
+  base::mutex_lock l(mu_);
+  if (name == root_.username() || user_list_.count(name) > 0) {
+    return base::errors::AlreadyExists("user ", name);
+  }
+  if (!DoWriteToDatabase(name, password)) {
+    return base::errors::Internal("failed to save user ", name);
+  }
+  UserInfo& user = user_list_[name];
+  user.set_username(name);
+  user.set_password(password);
+  return base::Status::OK();
+}
+
+base::Status UserManager::ForceOffline(const std::string& myid,
+                                       const std::string& name) {
+  if (!IsValidUser(myid)) {
+    return base::errors::PermissionDenied("only root can force users offline");
+  }
+  base::mutex_lock l(mu_);
+  DoRemoveSessions([&name](const std::string&, const std::string& user) {
+    return user == name;
+  });
+  return base::Status::OK();
+}
+
+base::Status UserManager::DeleteUser(const std::string& myid,
+                                     const std::string& name) {
+  if (!IsValidUser(myid)) {
+    return base::errors::PermissionDenied("only root can delete users");
+  }
+  if (name == root_.username()) {
+    return base::errors::InvalidArgument("can not delete root");
+  }
+  base::mutex_lock l(mu_);
+  if (user_list_.count(name) == 0) {
+    return base::errors::NotFound("user ", name);
+  }
+  if (!DoDeleteUserFromDatabase(name)) {
+    return base::errors::Internal("failed to delete user ", name);
+  }
+  user_list_.erase(name);
+  DoRemoveSessions([&name](const std::string&, const std::string& user) {
+    return user == name;
+  });
+  return base::Status::OK();
+}
+
+bool UserManager::IsLoggedIn(const std::string& uuid,
+                             SessionTokens::Cache* cache) {
+  if (tokens_ != nullptr && SessionTokens::IsToken(uuid)) {
+    std::string name;
+    return tokens_->Verify(uuid, cache, &name).ok();
+  }
+  return FindSession(uuid, nullptr);
+}
+
+bool UserManager::IsValidUser(const std::string& myid) {
+  return !root_.username().empty() &&
+         GetUsernameFromUUID(myid) == root_.username();
+}
+
+base::Status UserManager::TruncateOnlineUsers(const std::string& myid) {
+  if (!IsValidUser(myid)) {
+    return base::errors::PermissionDenied("only root can truncate online users");
+  }
+  base::mutex_lock l(mu_);
+  // 保留发起者自己的会话
+  DoRemoveSessions([&myid](const std::string& uuid, const std::string&) {
+    return uuid != myid;
+  });
+  return base::Status::OK();
+}
+
+base::Status UserManager::TruncateAllUsers(const std::string& myid) {
+  if (!IsValidUser(myid)) {
+    return base::errors::PermissionDenied("only root can truncate users");
+  }
+  base::mutex_lock l(mu_);
+  if (!DoTruncateDatabase()) {
+    return base::errors::Internal("failed to truncate users");
+  }
+  user_list_.clear();
+  const std::string& root = root_.username();
+  DoRemoveSessions([&root](const std::string&, const std::string& user) {
+    return user != root;
+  });
+  return base::Status::OK();
+}
+
+std::string UserManager::GetUsernameFromUUID(const std::string& uuid,
+                                             SessionTokens::Cache* cache) {
+  if (tokens_ != nullptr && SessionTokens::IsToken(uuid)) {
+    std::string name;
+    return tokens_->Verify(uuid, cache, &name).ok() ? name : std::string();
+  }
+  std::string name;
+  FindSession(uuid, &name);
+  return name;
+}
+
+// static
+std::string UserManager::CalculateUUID(const std::string& name) {
+  const base::uint64 high =
+      base::hash::Hash64Combine(base::hash::Hash64(name), base::random::New64());
+  return base::strings::SPrintf("%016llx%016llx",
+                                static_cast<unsigned long long>(high),
+                                static_cast<unsigned long long>(base::random::New64()));
+}
+
+UserManager::SessionSlot::SessionSlot()
+  : shard(new SessionShard()),
+    epoch(0) {
+  readers[0] = 0;
+  readers[1] = 0;
+}
+
+UserManager::SessionSlot::~SessionSlot() {
+  delete shard.load();
+}
+
+bool UserManager::FindSession(const std::string& uuid, std::string* name) const {
+  SessionSlot& slot = logged_users_[ShardIndex(uuid)];
+  // 计数之后 epoch 没有变化, 写者推进 epoch 后一定会等到这次读取结束
+  uint64_t epoch;
+  for (;;) {
+    epoch = slot.epoch.load();
+    slot.readers[epoch & 1].fetch_add(1);
+    if (slot.epoch.load() == epoch) {
+      break;
+    }
+    slot.readers[epoch & 1].fetch_sub(1);
+  }
+  const SessionShard* shard = slot.shard.load();
+  auto it = shard->find(uuid);
+  const bool found = it != shard->end();
+  if (found && name != nullptr) {
+    *name = it->second;
+  }
+  slot.readers[epoch & 1].fetch_sub(1);
+  return found;
+}
+
+const UserManager::SessionShard& UserManager::DoGetShard(
+    const std::string& uuid) const {
+  return *logged_users_[ShardIndex(uuid)].shard.load();
+}
+
+void UserManager::DoUpdateShard(
+    const std::string& uuid, const std::function<void(SessionShard*)>& update) {
+  SessionSlot* slot = &logged_users_[ShardIndex(uuid)];
+  SessionShard* copy = new SessionShard(*slot->shard.load());
+  update(copy);
+  DoPublish(slot, copy);
+}
+
+void UserManager::DoRemoveSessions(
+    const std::function<bool(const std::string& uuid,
+                             const std::string& name)>& pred) {
+  for (size_t i = 0; i < kSessionShards; ++i) {
+    SessionSlot* slot = &logged_users_[i];
+    const SessionShard* shard = slot->shard.load();
+    SessionShard* copy = nullptr;
+    for (const auto& kv : *shard) {
+      if (!pred(kv.first, kv.second)) {
+        continue;
+      }
+      if (copy == nullptr) {
+        copy = new SessionShard(*shard);
+      }
+      copy->erase(kv.first);
+    }
+    if (copy != nullptr) {
+      DoPublish(slot, copy);
+    }
+  }
+}
+
+void UserManager::DoPublish(SessionSlot* slot, const SessionShard* shard) {
+  const SessionShard* old = slot->shard.exchange(shard);
+  // 之后进入的读者计入另一半, 只能看到新快照. 上一次发布已经等空了这一半.
+  const uint64_t epoch = slot->epoch.fetch_add(1);
+  while (slot->readers[epoch & 1].load() != 0) {
+    std::this_thread::yield();
+  }
+  delete old;
+}
+
+size_t UserManager::ShardIndex(const std::string& uuid) const {
+  return base::hash::Hash64(uuid) & (kSessionShards - 1);
+}
+
+base::Status UserManager::DoCheckPassword(const std::string& name,
+                                          const std::string& password) {
+  if (name == root_.username()) {
+    if (password != root_.password()) {
+      return base::errors::Unauthenticated("wrong password of ", name);
+    }
+    return base::Status::OK();
+  }
+  auto it = user_list_.find(name);
+  if (it == user_list_.end()) {
+    return base::errors::NotFound("user ", name);
+  }
+  if (password != it->second.password()) {
+    return base::errors::Unauthenticated("wrong password of ", name);
+  }
+  return base::Status::OK();
+}
+
+bool UserManager::DoWriteToDatabase(const UserInfo& user) {
+  std::string value;
+  if (!user.SerializeToString(&value)) {
+    return false;
+  }
+  leveldb::WriteOptions options;
+  options.sync = true;
+  leveldb::Status status = db_->Put(options, user.username(), value);
+  if (!status.ok()) {
+    LOG(ERROR) << "[UserManager] Failed to write user " << user.username()
+               << ": " << status.ToString();
+    return false;
+  }
+  return true;
+}
+
+bool UserManager::DoWriteToDatabase(const std::string& name,
+                                    const std::string& password) {
+  UserInfo user;
+  user.set_username(name);
+  user.set_password(password);
+  return DoWriteToDatabase(user);
+}
+
+bool UserManager::DoDeleteUserFromDatabase(const std::string& name) {
+  leveldb::WriteOptions options;
+  options.sync = true;
+  leveldb::Status status = db_->Delete(options, name);
+  if (!status.ok()) {
+    LOG(ERROR) << "[UserManager] Failed to delete user " << name << ": "
+               << status.ToString();
+    return false;
+  }
+  return true;
+}
+
+bool UserManager::DoTruncateDatabase() {
+  leveldb::WriteBatch batch;
+  std::unique_ptr<leveldb::Iterator> it(db_->NewIterator(leveldb::ReadOptions()));
+  for (it->SeekToFirst(); it->Valid(); it->Next()) {
+    batch.Delete(it->key());
+  }
+  if (!it->status().ok()) {
+    LOG(ERROR) << "[UserManager] Failed to scan users: " << it->status().ToString();
+    return false;
+  }
+  leveldb::WriteOptions options;
+  options.sync = true;
+  leveldb::Status status = db_->Write(options, &batch);
+  if (!status.ok()) {
+    LOG(ERROR) << "[UserManager] Failed to truncate users: " << status.ToString();
+    return false;
+  }
+  return true;
+}
+
+bool UserManager::DoRecoverFromDatabase() {
+  std::unique_ptr<leveldb::Iterator> it(db_->NewIterator(leveldb::ReadOptions()));
+  for (it->SeekToFirst(); it->Valid(); it->Next()) {
+    UserInfo user;
+    if (!user.ParseFromArray(it->value().data(), it->value().size())) {
+      LOG(WARNING) << "[UserManager] Skip corrupted user " << it->key().ToString();
+      continue;
+    }
+    user_list_[user.username()] = user;
+  }
+  if (!it->status().ok()) {
+    LOG(ERROR) << "[UserManager] Failed to recover users: " << it->status().ToString();
+    return false;
+  }
+  LOG(INFO) << "[UserManager] Recovered " << user_list_.size() << " users";
+  return true;
+}
+
+} // namespace chubby
+} // namespace mpr
@@ -1,40 +1,101 @@
 #ifndef MPR_CHUBBY_SERVER_USER_MANAGER_H_
 #define MPR_CHUBBY_SERVER_USER_MANAGER_H_
 
+#include <atomic>
+#include <functional>
+#include <memory>
 #include <string>
 #include <unordered_map>
+#include <vector>
 #include "base/platform/mutex.h"
 #include "proto/service.pb.h"
+#include "server/session_token.h"
 #include "storage/meta.h"
 #include <leveldb/db.h>
 
 namespace mpr {
 namespace chubby {
 
+// 用户和登录会话.
+//
+// 每个请求都要用 uuid 检查登录状态, IsLoggedIn 和 GetUsernameFromUUID 不加锁:
+// 登录表按 uuid 的 hash 分片, 每个分片是不可变的快照, 由一个原子指针发布.
+// 读者在分片当前 epoch 的计数上加一, 读取指针指向的快照, 查找后减一, 只有
+// 原子操作, 不会阻塞. Login/Logout 等写操作在 mu_ 下复制所在分片, 修改后发布
+// 新快照, 再推进 epoch 并等待旧 epoch 的读者离开 (RCU 的 grace period), 之后
+// 释放旧快照. 写操作只复制一个分片, 等待的只是正在查找的读者.
+//
+// root 用户不保存在数据库中, 只有 root 可以调用需要 myid 的管理接口.
+//
+// 设置了 tokens 时, uuid 也可以是 IssueToken 签发的 token, 验证只用密钥,
+// 不查登录表, follower 也可以验证. token 在过期或 epoch 递增之前一直有效,
+// Logout/ForceOffline/DeleteUser 不影响已签发的 token.
 class UserManager {
  public:
-  UserManager(const std::string& db_path, const UserInfo& root);
-  virtual ~UserManager() {}
+  // tokens 可以为空, 不为空时必须比 UserManager 活得长
+  UserManager(const std::string& db_path, const UserInfo& root,
+              const SessionTokens* tokens = nullptr);
+  virtual ~UserManager();
 
-  base::Status Login(const std::string& name, 
-                     const std::string& password, 
+  base::Status Login(const std::string& name,
+                     const std::string& password,
                      const std::string& uuid);
+  // 验证密码并签发 token, 没有设置 tokens 时返回 FailedPrecondition, 还没有
+  // apply 过密钥时返回 Unavailable
+  base::Status IssueToken(const std::string& name,
+                          const std::string& password,
+                          std::string* token);
   base::Status Logout(const std::string& uuid);
   base::Status Register(const std::string& name, const std::string& password);
   base::Status ForceOffline(const std::string& myid, const std::string& name);
   base::Status DeleteUser(const std::string& myid, const std::string& name);
 
-  bool IsLoggedIn(const std::string& uuid);
+  // 不加锁. cache 是连接上的 token 缓存, 可以为空.
+  bool IsLoggedIn(const std::string& uuid,
+                  SessionTokens::Cache* cache = nullptr);
+  // myid 以 root 登录
   bool IsValidUser(const std::string& myid);
 
   base::Status TruncateOnlineUsers(const std::string& myid);
   base::Status TruncateAllUsers(const std::string& myid);
 
-  std::string GetUsernameFromUUID(const std::string& uuid);
-  
+  // 不加锁, 没有登录时返回空串
+  std::string GetUsernameFromUUID(const std::string& uuid,
+                                  SessionTokens::Cache* cache = nullptr);
+
   static std::string CalculateUUID(const std::string& name);
 
  private:
+  // uuid -> 用户名
+  typedef std::unordered_map<std::string, std::string> SessionShard;
+
+  // 一个分片的当前快照和读者计数
+  struct SessionSlot {
+    std::atomic<const SessionShard*> shard;
+    std::atomic<uint64_t> epoch;
+    // 按进入时 epoch 的奇偶分别计数
+    std::atomic<int64_t> readers[2];
+
+    SessionSlot();
+    ~SessionSlot();
+  };
+
+  // 不加锁. name 可以为空
+  bool FindSession(const std::string& uuid, std::string* name) const;
+  // 调用者持有 mu_, 快照不会被并发替换
+  const SessionShard& DoGetShard(const std::string& uuid) const;
+  // 复制 uuid 所在分片, 修改后发布
+  void DoUpdateShard(const std::string& uuid,
+                     const std::function<void(SessionShard*)>& update);
+  // 发布新快照, 等待可能还在读旧快照的读者离开后释放旧快照
+  void DoPublish(SessionSlot* slot, const SessionShard* shard);
+  // 删除满足条件的会话, 只复制有变化的分片
+  void DoRemoveSessions(const std::function<bool(const std::string& uuid,
+                                                 const std::string& name)>& pred);
+  size_t ShardIndex(const std::string& uuid) const;
+  base::Status DoCheckPassword(const std::string& name,
+                               const std::string& password);
+
   bool DoWriteToDatabase(const UserInfo& user);
   bool DoWriteToDatabase(const std::string& name, const std::string& password);
   bool DoDeleteUserFromDatabase(const std::string& name);
@@ -42,8 +103,12 @@ class UserManager {
   bool DoRecoverFromDatabase();
 
  private:
+  const UserInfo root_;
+  const SessionTokens* tokens_;
+  // 写者之间互斥, 保护 user_list_ 和 db_
   base::mutex mu_;
-  std::unordered_map<std::string, std::string> logged_users_;
+  // 长度为 kSessionShards
+  std::unique_ptr<SessionSlot[]> logged_users_;
   std::unordered_map<std::string, UserInfo> user_list_;
   std::string db_path_;
   leveldb::DB* db_;
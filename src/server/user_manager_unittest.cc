@@ -0,0 +1,153 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
+
+#include "server/user_manager.h"
+#include "base/errors.h"
+#include "base/platform/env.h"
+
+namespace mpr {
+namespace chubby {
+
+namespace {
+
+const char kDbPath[] = "/tmp/user_manager_test";
+
+UserInfo Root() {
+  UserInfo root;
+  root.set_username("root");
+  root.set_password("secret");
+  return root;
+}
+
+void ClearDb() {
+  base::int64 undeleted_files, undeleted_dirs;
+  base::Env::Default()->DeleteDirectoryRecursively(kDbPath, &undeleted_files,
+                                                   &undeleted_dirs);
+}
+
+} // namespace
+
+TEST(UserManager, LoginLogout) {
+  ClearDb();
+  UserManager users(kDbPath, Root());
+  ASSERT_TRUE(users.Register("alice", "pw").ok());
+  EXPECT_TRUE(base::errors::IsAlreadyExists(users.Register("alice", "pw")));
+  EXPECT_TRUE(base::errors::IsUnauthenticated(users.Login("alice", "bad", "u1")));
+  EXPECT_TRUE(base::errors::IsNotFound(users.Login("bob", "pw", "u1")));
+  EXPECT_FALSE(users.IsLoggedIn("u1"));
+
+  ASSERT_TRUE(users.Login("alice", "pw", "u1").ok());
+  EXPECT_TRUE(users.IsLoggedIn("u1"));
+  EXPECT_EQ("alice", users.GetUsernameFromUUID("u1"));
+  EXPECT_TRUE(base::errors::IsAlreadyExists(users.Login("root", "secret", "u1")));
+  // 普通用户不能使用管理接口
+  EXPECT_TRUE(base::errors::IsPermissionDenied(users.ForceOffline("u1", "alice")));
+
+  ASSERT_TRUE(users.Logout("u1").ok());
+  EXPECT_FALSE(users.IsLoggedIn("u1"));
+  EXPECT_EQ("", users.GetUsernameFromUUID("u1"));
+  EXPECT_TRUE(base::errors::IsNotFound(users.Logout("u1")));
+}
+
+TEST(UserManager, AdminAndRecovery) {
+  ClearDb();
+  {
+    UserManager users(kDbPath, Root());
+    ASSERT_TRUE(users.Register("alice", "pw").ok());
+    ASSERT_TRUE(users.Register("bob", "pw").ok());
+    ASSERT_TRUE(users.Login("root", "secret", "admin").ok());
+    ASSERT_TRUE(users.Login("alice", "pw", "a1").ok());
+    ASSERT_TRUE(users.Login("alice", "pw", "a2").ok());
+    ASSERT_TRUE(users.Login("bob", "pw", "b1").ok());
+
+    ASSERT_TRUE(users.ForceOffline("admin", "alice").ok());
+    EXPECT_FALSE(users.IsLoggedIn("a1"));
+    EXPECT_FALSE(users.IsLoggedIn("a2"));
+    EXPECT_TRUE(users.IsLoggedIn("b1"));
+
+    ASSERT_TRUE(users.DeleteUser("admin", "bob").ok());
+    EXPECT_FALSE(users.IsLoggedIn("b1"));
+    EXPECT_TRUE(base::errors::IsNotFound(users.Login("bob", "pw", "b1")));
+    EXPECT_TRUE(users.IsLoggedIn("admin"));
+  }
+  // 用户保存在数据库中, 登录会话不保存
+  UserManager users(kDbPath, Root());
+  EXPECT_FALSE(users.IsLoggedIn("a1"));
+  ASSERT_TRUE(users.Login("alice", "pw", "a1").ok());
+  EXPECT_TRUE(base::errors::IsNotFound(users.Login("bob", "pw", "b1")));
+
+  ASSERT_TRUE(users.Login("root", "secret", "admin").ok());
+  ASSERT_TRUE(users.TruncateAllUsers("admin").ok());
+  EXPECT_FALSE(users.IsLoggedIn("a1"));
+  EXPECT_TRUE(users.IsLoggedIn("admin"));
+  EXPECT_TRUE(base::errors::IsNotFound(users.Login("alice", "pw", "a1")));
+}
+
+TEST(UserManager, SessionTokens) {
+  ClearDb();
+  SessionTokens::Options options;
+  options.key = SessionTokens::GenerateKey();
+  SessionTokens tokens(options);
+  std::string token;
+  {
+    UserManager users(kDbPath, Root());
+    EXPECT_TRUE(base::errors::IsFailedPrecondition(
+        users.IssueToken("root", "secret", &token)));
+  }
+  UserManager users(kDbPath, Root(), &tokens);
+  ASSERT_TRUE(users.Register("alice", "pw").ok());
+  EXPECT_TRUE(base::errors::IsUnauthenticated(
+      users.IssueToken("alice", "bad", &token)));
+  ASSERT_TRUE(users.IssueToken("alice", "pw", &token).ok());
+
+  // 不需要登录表
+  SessionTokens::Cache cache;
+  EXPECT_TRUE(users.IsLoggedIn(token, &cache));
+  EXPECT_EQ("alice", users.GetUsernameFromUUID(token, &cache));
+  EXPECT_EQ(token, cache.token);
+  EXPECT_FALSE(users.IsLoggedIn(token.substr(0, token.size() - 2)));
+
+  std::string root_token;
+  ASSERT_TRUE(users.IssueToken("root", "secret", &root_token).ok());
+  EXPECT_TRUE(users.IsValidUser(root_token));
+  EXPECT_FALSE(users.IsValidUser(token));
+}
+
+TEST(UserManager, ReadersDuringLogins) {
+  ClearDb();
+  UserManager users(kDbPath, Root());
+  ASSERT_TRUE(users.Register("alice", "pw").ok());
+  ASSERT_TRUE(users.Login("alice", "pw", "stable").ok());
+
+  std::atomic<bool> stop(false);
+  std::atomic<int> misses(0);
+  std::vector<std::thread> readers;
+  for (int i = 0; i < 4; ++i) {
+    readers.emplace_back([&users, &stop, &misses]() {
+      while (!stop) {
+        if (users.GetUsernameFromUUID("stable") != "alice") {
+          misses++;
+        }
+      }
+    });
+  }
+  // 写入者替换分片时, 读者仍然看到完整的快照
+  for (int i = 0; i < 2000; ++i) {
+    const std::string uuid = "u" + std::to_string(i);
+    ASSERT_TRUE(users.Login("alice", "pw", uuid).ok());
+    if (i % 2 == 0) {
+      ASSERT_TRUE(users.Logout(uuid).ok());
+    }
+  }
+  stop = true;
+  for (auto& reader : readers) {
+    reader.join();
+  }
+  EXPECT_EQ(0, misses);
+  EXPECT_TRUE(users.IsLoggedIn("u1999"));
+  EXPECT_FALSE(users.IsLoggedIn("u1998"));
+}
+
+} // namespace chubby
+} // namespace mpr
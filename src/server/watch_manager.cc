@@ -0,0 +1,371 @@
+#include "server/watch_manager.h"
+
+#include <algorithm>
+
+#include "base/errors.h"
+#include "base/logging.h"
+#include "base/monitoring/monitoring.h"
+
+#include <gflags/gflags.h>
+
+DECLARE_int32(chubby_watch_queue_limit);
+DECLARE_int32(chubby_watch_history);
+
+namespace mpr {
+namespace chubby {
+
+namespace {
+
+base::monitoring::Gauge<>* watchers_gauge =
+    base::monitoring::Gauge<>::New("chubby_watchers", "Active watches");
+
+base::monitoring::Counter<>* delivered_counter =
+    base::monitoring::Counter<>::New("chubby_watch_events",
+                                     "Watch events delivered to clients");
+
+base::monitoring::Counter<>* overflow_counter =
+    base::monitoring::Counter<>::New("chubby_watch_overflows",
+                                     "Watch queues that exceeded max_queue");
+
+} // namespace
+
+struct WatchManager::Watcher {
+  int64_t id;
+  std::string ns;
+  std::string session_id;
+  std::string key;
+  bool prefix;
+  // 只交付 index 大于它的变化
+  int64_t min_index;
+  // 合并后的事件, 同一个 key 只保留最后一次
+  std::unordered_map<std::string, WatchEvent> events;
+  bool overflow;
+  // 挂起的 Poll, 定时器的 key 是 watch id
+  PollCallback poll;
+};
+
+WatchManager::Options::Options()
+  : max_queue(FLAGS_chubby_watch_queue_limit),
+    max_history(FLAGS_chubby_watch_history),
+    tick_micros(10000),
+    env(base::Env::Default()),
+    start_thread(true) {}
+
+WatchManager::WatchManager(const Options& options, int64_t last_applied)
+  : options_(options),
+    next_watch_id_(0),
+    last_index_(last_applied),
+    history_floor_(last_applied) {
+  base::thread::TimingWheel::Options wheel_options;
+  wheel_options.tick_micros = options_.tick_micros;
+  wheel_options.env = options_.env;
+  wheel_options.start_thread = options_.start_thread;
+  wheel_.reset(new base::thread::TimingWheel(wheel_options,
+      [this](std::vector<base::uint64>* ids) { HandleTimeouts(ids); }));
+}
+
+WatchManager::~WatchManager() {
+  wheel_.reset();
+  Deliveries deliveries;
+  {
+    base::mutex_lock l(mu_);
+    for (auto& kv : watchers_) {
+      DoDeliver(kv.second.get(), true,
+                base::errors::Cancelled("watch manager shutdown"), &deliveries);
+    }
+  }
+  RunDeliveries(&deliveries);
+}
+
+base::Status WatchManager::Watch(const std::string& ns,
+                                 const std::string& session_id,
+                                 const std::string& key, bool prefix,
+                                 int64_t start_index, int64_t* watch_id) {
+  base::mutex_lock l(mu_);
+  if (start_index > 0 && start_index < history_floor_) {
+    return base::errors::OutOfRange("start_index ", start_index,
+                                    " is older than watch history ",
+                                    history_floor_);
+  }
+  std::unique_ptr<Watcher> watcher(new Watcher());
+  watcher->id = ++next_watch_id_;
+  watcher->ns = ns;
+  watcher->session_id = session_id;
+  watcher->key = key;
+  watcher->prefix = prefix;
+  watcher->min_index = start_index > 0 ? start_index : last_index_;
+  watcher->overflow = false;
+
+  Namespace& index = namespaces_[ns];
+  if (prefix) {
+    index.prefixes[key].insert(watcher->id);
+    index.prefix_lengths[key.size()]++;
+  } else {
+    index.keys[key].insert(watcher->id);
+  }
+  if (!session_id.empty()) {
+    sessions_[session_id].insert(watcher->id);
+  }
+  for (const Change& change : history_) {
+    if (Matches(*watcher, change)) {
+      DoEnqueue(watcher.get(), change.event);
+    }
+  }
+  *watch_id = watcher->id;
+  watchers_[watcher->id] = std::move(watcher);
+  watchers_gauge->Set(watchers_.size());
+  return base::Status::OK();
+}
+
+void WatchManager::Poll(int64_t watch_id, int64_t timeout_micros,
+                        PollCallback done) {
+  Deliveries deliveries;
+  {
+    base::mutex_lock l(mu_);
+    auto it = watchers_.find(watch_id);
+    if (it == watchers_.end()) {
+      l.unlock();
+      WatchResponse response;
+      done(base::errors::NotFound("watch ", watch_id, " not found"), &response);
+      return;
+    }
+    Watcher* watcher = it->second.get();
+    if (watcher->poll) {
+      // 客户端重试时之前的 Poll 已经没有人等待, 事件留给新的 Poll
+      deliveries.push_back(Delivery());
+      deliveries.back().done = std::move(watcher->poll);
+      deliveries.back().response.set_watch_id(watch_id);
+      deliveries.back().response.set_last_index(watcher->min_index);
+    }
+    watcher->poll = std::move(done);
+    if (!watcher->events.empty() || watcher->overflow || timeout_micros <= 0) {
+      DoDeliver(watcher, true, base::Status::OK(), &deliveries);
+    } else {
+      wheel_->Schedule(watch_id, timeout_micros);
+    }
+  }
+  RunDeliveries(&deliveries);
+}
+
+bool WatchManager::Cancel(int64_t watch_id) {
+  Deliveries deliveries;
+  {
+    base::mutex_lock l(mu_);
+    if (watchers_.count(watch_id) == 0) {
+      return false;
+    }
+    DoRemove(watch_id, &deliveries);
+  }
+  RunDeliveries(&deliveries);
+  return true;
+}
+
+void WatchManager::CancelSession(const std::string& session_id) {
+  Deliveries deliveries;
+  {
+    base::mutex_lock l(mu_);
+    auto it = sessions_.find(session_id);
+    if (it == sessions_.end()) {
+      return;
+    }
+    const std::set<int64_t> ids = it->second;
+    for (int64_t id : ids) {
+      DoRemove(id, &deliveries);
+    }
+  }
+  RunDeliveries(&deliveries);
+}
+
+void WatchManager::Apply(ApplyPipeline::Changes* changes) {
+  Deliveries deliveries;
+  {
+    base::mutex_lock l(mu_);
+    std::set<Watcher*> touched;
+    auto notify = [&](const std::set<int64_t>& ids, const WatchEvent& event) {
+      for (int64_t id : ids) {
+        Watcher* watcher = watchers_[id].get();
+        DoEnqueue(watcher, event);
+        touched.insert(watcher);
+      }
+    };
+    for (auto& kv : *changes) {
+      // 失败重试时可能重新 apply 已经处理过的日志
+      if (kv.first <= last_index_) {
+        continue;
+      }
+      last_index_ = kv.first;
+      const LogEntry& log_entry = kv.second;
+      Change change;
+      change.ns = log_entry.user;
+      change.event.set_key(log_entry.key);
+      change.event.set_op(log_entry.log_operation);
+      change.event.set_value(log_entry.value);
+      change.event.set_index(kv.first);
+
+      auto ns = namespaces_.find(change.ns);
+      if (ns != namespaces_.end()) {
+        auto key = ns->second.keys.find(log_entry.key);
+        if (key != ns->second.keys.end()) {
+          notify(key->second, change.event);
+        }
+        // 只查找已注册过的前缀长度
+        for (const auto& length : ns->second.prefix_lengths) {
+          if (length.first > log_entry.key.size()) {
+            break;
+          }
+          auto prefix = ns->second.prefixes.find(
+              log_entry.key.substr(0, length.first));
+          if (prefix != ns->second.prefixes.end()) {
+            notify(prefix->second, change.event);
+          }
+        }
+      }
+
+      history_.push_back(std::move(change));
+      while (history_.size() > static_cast<size_t>(options_.max_history)) {
+        history_floor_ = history_.front().event.index();
+        history_.pop_front();
+      }
+    }
+    for (Watcher* watcher : touched) {
+      DoDeliver(watcher, false, base::Status::OK(), &deliveries);
+    }
+  }
+  RunDeliveries(&deliveries);
+}
+
+size_t WatchManager::size() const {
+  base::mutex_lock l(mu_);
+  return watchers_.size();
+}
+
+int64_t WatchManager::last_index() const {
+  base::mutex_lock l(mu_);
+  return last_index_;
+}
+
+// static
+bool WatchManager::Matches(const Watcher& watcher, const Change& change) {
+  if (watcher.ns != change.ns) {
+    return false;
+  }
+  const std::string& key = change.event.key();
+  if (watcher.prefix) {
+    return key.compare(0, watcher.key.size(), watcher.key) == 0;
+  }
+  return key == watcher.key;
+}
+
+void WatchManager::DoEnqueue(Watcher* watcher, const WatchEvent& event) {
+  if (event.index() <= watcher->min_index || watcher->overflow) {
+    return;
+  }
+  if (watcher->events.size() >= static_cast<size_t>(options_.max_queue) &&
+      watcher->events.count(event.key()) == 0) {
+    // 之后的事件也丢弃, 直到客户端取走 overflow 重新读取
+    watcher->events.clear();
+    watcher->overflow = true;
+    overflow_counter->Increment();
+    return;
+  }
+  watcher->events[event.key()] = event;
+}
+
+void WatchManager::DoDeliver(Watcher* watcher, bool force,
+                             const base::Status& status,
+                             Deliveries* deliveries) {
+  if (!watcher->poll ||
+      (!force && watcher->events.empty() && !watcher->overflow)) {
+    return;
+  }
+  wheel_->Cancel(watcher->id);
+  deliveries->push_back(Delivery());
+  Delivery& delivery = deliveries->back();
+  delivery.done = std::move(watcher->poll);
+  watcher->poll = nullptr;
+  delivery.status = status;
+  WatchResponse& response = delivery.response;
+  response.set_watch_id(watcher->id);
+  response.set_last_index(last_index_);
+  if (!status.ok()) {
+    return;
+  }
+  std::vector<WatchEvent*> events;
+  for (auto& kv : watcher->events) {
+    events.push_back(&kv.second);
+  }
+  std::sort(events.begin(), events.end(),
+            [](const WatchEvent* a, const WatchEvent* b) {
+              return a->index() < b->index();
+            });
+  for (WatchEvent* event : events) {
+    response.add_events()->Swap(event);
+  }
+  delivered_counter->IncrementBy(events.size());
+  response.set_overflow(watcher->overflow);
+  watcher->events.clear();
+  watcher->overflow = false;
+  // 已经交付的事件不再重复
+  watcher->min_index = std::max(watcher->min_index, last_index_);
+}
+
+void WatchManager::DoRemove(int64_t watch_id, Deliveries* deliveries) {
+  auto it = watchers_.find(watch_id);
+  if (it == watchers_.end()) {
+    return;
+  }
+  Watcher* watcher = it->second.get();
+  DoDeliver(watcher, true, base::errors::Cancelled("watch ", watch_id, " cancelled"),
+            deliveries);
+  auto ns = namespaces_.find(watcher->ns);
+  if (ns != namespaces_.end()) {
+    Namespace& index = ns->second;
+    auto& ids = watcher->prefix ? index.prefixes : index.keys;
+    auto key = ids.find(watcher->key);
+    if (key != ids.end()) {
+      key->second.erase(watch_id);
+      if (key->second.empty()) {
+        ids.erase(key);
+      }
+    }
+    if (watcher->prefix && --index.prefix_lengths[watcher->key.size()] == 0) {
+      index.prefix_lengths.erase(watcher->key.size());
+    }
+    if (index.keys.empty() && index.prefixes.empty()) {
+      namespaces_.erase(ns);
+    }
+  }
+  auto session = sessions_.find(watcher->session_id);
+  if (session != sessions_.end()) {
+    session->second.erase(watch_id);
+    if (session->second.empty()) {
+      sessions_.erase(session);
+    }
+  }
+  watchers_.erase(it);
+  watchers_gauge->Set(watchers_.size());
+}
+
+void WatchManager::HandleTimeouts(std::vector<base::uint64>* ids) {
+  Deliveries deliveries;
+  {
+    base::mutex_lock l(mu_);
+    for (base::uint64 id : *ids) {
+      auto it = watchers_.find(static_cast<int64_t>(id));
+      if (it != watchers_.end()) {
+        DoDeliver(it->second.get(), true, base::Status::OK(), &deliveries);
+      }
+    }
+  }
+  RunDeliveries(&deliveries);
+}
+
+// static
+void WatchManager::RunDeliveries(Deliveries* deliveries) {
+  for (Delivery& delivery : *deliveries) {
+    delivery.done(delivery.status, &delivery.response);
+  }
+}
+
+} // namespace chubby
+} // namespace mpr
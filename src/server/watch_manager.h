@@ -0,0 +1,124 @@
+#ifndef MPR_CHUBBY_SERVER_WATCH_MANAGER_H_
+#define MPR_CHUBBY_SERVER_WATCH_MANAGER_H_
+
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "base/macros.h"
+#include "base/status.h"
+#include "base/platform/env.h"
+#include "base/platform/mutex.h"
+#include "base/thread/timing_wheel.h"
+#include "proto/service.pb.h"
+#include "server/apply_pipeline.h"
+
+namespace mpr {
+namespace chubby {
+
+// key 和前缀上的 watch, 由 ApplyPipeline 的 change_callback 驱动.
+//
+// 每个 namespace 有精确 key 和前缀两个索引, 一次变化只查找已注册过的前缀长度.
+// 每个 watch 有自己的事件队列, 同一个 key 的多次变化合并为最后一次; 队列超出
+// max_queue 时清空并标记 overflow, 客户端重新读取后继续. 客户端用 Poll
+// long-poll, 没有事件时挂起直到有事件或超时.
+//
+// 最近 max_history 个变化保留在内存中, 新建的 watch 可以从 start_index 之后
+// 重放, 断线或者换节点后不丢事件. index 是全局的日志 index, 任何节点都可以
+// 服务 watch.
+class WatchManager {
+ public:
+  // response 中填写 watch_id, events, overflow 和 last_index
+  typedef std::function<void(const base::Status& status,
+                             WatchResponse* response)> PollCallback;
+
+  struct Options {
+    int32_t max_queue;
+    int32_t max_history;
+    // Poll 超时的精度
+    int64_t tick_micros;
+    base::Env* env;
+    // 为 false 时由调用者调用 AdvanceTo
+    bool start_thread;
+
+    Options();
+  };
+
+  // last_applied: 启动时已经 apply 的位置, 更早的变化无法重放
+  WatchManager(const Options& options, int64_t last_applied);
+  // 挂起的 Poll 以 Cancelled 结束
+  ~WatchManager();
+
+  // start_index 早于保留的历史时返回 OutOfRange, 不创建 watch.
+  base::Status Watch(const std::string& ns, const std::string& session_id,
+                     const std::string& key, bool prefix, int64_t start_index,
+                     int64_t* watch_id);
+  // 有事件时立即返回, 否则最多等待 timeout_micros. 同一个 watch 新的 Poll
+  // 以空结果结束之前挂起的 Poll. watch 不存在时以 NotFound 调用 done.
+  // done 不在内部锁中调用.
+  void Poll(int64_t watch_id, int64_t timeout_micros, PollCallback done);
+  bool Cancel(int64_t watch_id);
+  // 会话结束时取消它的所有 watch
+  void CancelSession(const std::string& session_id);
+
+  // ApplyPipeline::Options::change_callback
+  void Apply(ApplyPipeline::Changes* changes);
+
+  size_t size() const;
+  int64_t last_index() const;
+  void AdvanceTo(uint64_t now_micros) { wheel_->AdvanceTo(now_micros); }
+
+ private:
+  struct Watcher;
+  struct Namespace {
+    std::unordered_map<std::string, std::set<int64_t>> keys;
+    std::unordered_map<std::string, std::set<int64_t>> prefixes;
+    // 前缀长度 -> 该长度的前缀数
+    std::map<size_t, int> prefix_lengths;
+  };
+  struct Change {
+    std::string ns;
+    WatchEvent event;
+  };
+  struct Delivery {
+    PollCallback done;
+    base::Status status;
+    WatchResponse response;
+  };
+  typedef std::vector<Delivery> Deliveries;
+
+  static bool Matches(const Watcher& watcher, const Change& change);
+  void DoEnqueue(Watcher* watcher, const WatchEvent& event);
+  // 有挂起的 Poll 时交付队列中的事件, force 时队列为空也交付
+  void DoDeliver(Watcher* watcher, bool force, const base::Status& status,
+                 Deliveries* deliveries);
+  void DoRemove(int64_t watch_id, Deliveries* deliveries);
+  void HandleTimeouts(std::vector<base::uint64>* ids);
+  static void RunDeliveries(Deliveries* deliveries);
+
+  const Options options_;
+
+  mutable base::mutex mu_;
+  int64_t next_watch_id_;
+  // 已经处理的最后一个变化
+  int64_t last_index_;
+  // 被挤出历史的最后一个变化, start_index 不能早于它
+  int64_t history_floor_;
+  std::deque<Change> history_;
+  std::unordered_map<int64_t, std::unique_ptr<Watcher>> watchers_;
+  std::unordered_map<std::string, Namespace> namespaces_;
+  std::unordered_map<std::string, std::set<int64_t>> sessions_;
+  // 最先析构: tick 线程退出之后才能释放上面的成员
+  std::unique_ptr<base::thread::TimingWheel> wheel_;
+
+  DISALLOW_COPY_AND_ASSIGN(WatchManager);
+};
+
+} // namespace chubby
+} // namespace mpr
+#endif // MPR_CHUBBY_SERVER_WATCH_MANAGER_H_
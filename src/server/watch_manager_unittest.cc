@@ -0,0 +1,202 @@
+#include <gtest/gtest.h>
+
+#include "server/watch_manager.h"
+#include "base/errors.h"
+#include "base/platform/env_test_util.h"
+
+namespace mpr {
+namespace chubby {
+
+namespace {
+
+class WatchManagerTest : public ::testing::Test {
+ protected:
+  void Init(int32_t max_queue, int32_t max_history) {
+    WatchManager::Options options;
+    options.max_queue = max_queue;
+    options.max_history = max_history;
+    options.env = &env_;
+    options.start_thread = false;
+    watches_.reset(new WatchManager(options, -1));
+  }
+
+  void SetUp() override { Init(100, 100); }
+
+  // 依次 apply 的 kPut, index 从 next_index_ 开始
+  void Put(const std::string& key, const std::string& value,
+           const std::string& ns = "") {
+    ApplyPipeline::Changes changes;
+    LogEntry log_entry;
+    log_entry.log_operation = kPut;
+    log_entry.user = ns;
+    log_entry.key = key;
+    log_entry.value = value;
+    changes.emplace_back(next_index_++, log_entry);
+    watches_->Apply(&changes);
+  }
+
+  int64_t Watch(const std::string& key, bool prefix, int64_t start_index = 0) {
+    int64_t watch_id = 0;
+    EXPECT_TRUE(watches_->Watch("", "session", key, prefix, start_index,
+                                &watch_id).ok());
+    return watch_id;
+  }
+
+  // 挂起的 Poll 的结果
+  struct PollResult {
+    bool done = false;
+    base::Status status;
+    WatchResponse response;
+  };
+
+  void Poll(int64_t watch_id, int64_t timeout_ms, PollResult* result) {
+    watches_->Poll(watch_id, timeout_ms * 1000,
+                   [result](const base::Status& status, WatchResponse* response) {
+                     result->done = true;
+                     result->status = status;
+                     result->response.Swap(response);
+                   });
+  }
+
+  void AdvanceMillis(int64_t ms) {
+    env_.AdvanceMillis(ms);
+    watches_->AdvanceTo(env_.NowMicros());
+  }
+
+  base::FakeClockEnv env_;
+  std::unique_ptr<WatchManager> watches_;
+  int64_t next_index_ = 0;
+};
+
+} // namespace
+
+TEST_F(WatchManagerTest, KeysAndPrefixes) {
+  int64_t key_watch = Watch("/a/b", false);
+  int64_t prefix_watch = Watch("/a/", true);
+  Put("/a/b", "1");
+  Put("/a/c", "2");
+  Put("/b", "3");
+  Put("/a/b", "4", "other");
+
+  PollResult result;
+  Poll(key_watch, 0, &result);
+  ASSERT_TRUE(result.done);
+  ASSERT_EQ(1, result.response.events_size());
+  EXPECT_EQ("/a/b", result.response.events(0).key());
+  EXPECT_EQ(kPut, result.response.events(0).op());
+  EXPECT_EQ("1", result.response.events(0).value());
+  EXPECT_EQ(0, result.response.events(0).index());
+  EXPECT_EQ(3, result.response.last_index());
+
+  Poll(prefix_watch, 0, &result);
+  ASSERT_EQ(2, result.response.events_size());
+  EXPECT_EQ("/a/b", result.response.events(0).key());
+  EXPECT_EQ("/a/c", result.response.events(1).key());
+}
+
+TEST_F(WatchManagerTest, LongPoll) {
+  int64_t watch_id = Watch("/a", false);
+  PollResult result;
+  Poll(watch_id, 1000, &result);
+  EXPECT_FALSE(result.done);
+  Put("/a", "1");
+  ASSERT_TRUE(result.done);
+  EXPECT_TRUE(result.status.ok());
+  EXPECT_EQ(1, result.response.events_size());
+
+  // 没有变化时超时返回空结果
+  PollResult timeout;
+  Poll(watch_id, 1000, &timeout);
+  AdvanceMillis(999);
+  EXPECT_FALSE(timeout.done);
+  AdvanceMillis(10);
+  ASSERT_TRUE(timeout.done);
+  EXPECT_TRUE(timeout.status.ok());
+  EXPECT_EQ(0, timeout.response.events_size());
+
+  // 新的 Poll 结束旧的, 事件交给新的
+  PollResult first, second;
+  Poll(watch_id, 1000, &first);
+  Poll(watch_id, 1000, &second);
+  ASSERT_TRUE(first.done);
+  Put("/a", "2");
+  EXPECT_EQ(0, first.response.events_size());
+  ASSERT_TRUE(second.done);
+  EXPECT_EQ(1, second.response.events_size());
+}
+
+TEST_F(WatchManagerTest, CoalescesAndOverflows) {
+  Init(3, 100);
+  int64_t watch_id = Watch("/", true);
+  for (int i = 0; i < 10; ++i) {
+    Put("/a", std::to_string(i));
+  }
+  Put("/b", "b");
+  PollResult result;
+  Poll(watch_id, 0, &result);
+  ASSERT_EQ(2, result.response.events_size());
+  EXPECT_EQ("/a", result.response.events(0).key());
+  EXPECT_EQ("9", result.response.events(0).value());
+  EXPECT_EQ("/b", result.response.events(1).key());
+  EXPECT_FALSE(result.response.overflow());
+
+  for (int i = 0; i < 4; ++i) {
+    Put("/key" + std::to_string(i), "v");
+  }
+  Poll(watch_id, 0, &result);
+  EXPECT_TRUE(result.response.overflow());
+  EXPECT_EQ(0, result.response.events_size());
+  EXPECT_EQ(next_index_ - 1, result.response.last_index());
+
+  // 取走 overflow 后恢复正常
+  Put("/c", "c");
+  Poll(watch_id, 0, &result);
+  EXPECT_FALSE(result.response.overflow());
+  EXPECT_EQ(1, result.response.events_size());
+}
+
+TEST_F(WatchManagerTest, ResumesFromIndex) {
+  Init(100, 3);
+  for (int i = 0; i < 6; ++i) {
+    Put("/a", std::to_string(i));
+  }
+  // 历史只保留 index 3..5
+  int64_t watch_id = 0;
+  EXPECT_TRUE(base::errors::IsOutOfRange(
+      watches_->Watch("", "s", "/a", false, 1, &watch_id)));
+  watch_id = Watch("/a", false, 2);
+  PollResult result;
+  Poll(watch_id, 0, &result);
+  ASSERT_EQ(1, result.response.events_size());
+  EXPECT_EQ("5", result.response.events(0).value());
+  EXPECT_EQ(5, result.response.events(0).index());
+
+  // start_index 超过本节点已经 apply 的位置, 之前的变化不交付
+  watch_id = Watch("/a", false, 7);
+  Put("/a", "6");
+  Put("/a", "7");
+  Put("/a", "8");
+  Poll(watch_id, 0, &result);
+  ASSERT_EQ(1, result.response.events_size());
+  EXPECT_EQ(8, result.response.events(0).index());
+}
+
+TEST_F(WatchManagerTest, Cancel) {
+  int64_t a = Watch("/a", false);
+  int64_t b = Watch("/", true);
+  PollResult result;
+  Poll(a, 1000, &result);
+  watches_->CancelSession("session");
+  ASSERT_TRUE(result.done);
+  EXPECT_TRUE(base::errors::IsCancelled(result.status));
+  EXPECT_EQ(0u, watches_->size());
+  EXPECT_FALSE(watches_->Cancel(b));
+
+  Poll(a, 0, &result);
+  EXPECT_TRUE(base::errors::IsNotFound(result.status));
+  // 索引已经清理
+  Put("/a", "1");
+}
+
+} // namespace chubby
+} // namespace mpr
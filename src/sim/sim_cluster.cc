@@ -0,0 +1,458 @@
+#include "sim/sim_cluster.h"
+
+#include <algorithm>
+
+#include <leveldb/helpers/memenv.h>
+
+#include "base/errors.h"
+#include "base/logging.h"
+#include "base/strings/stringprintf.h"
+
+namespace mpr {
+namespace chubby {
+
+struct SimCluster::Node {
+  std::string id;
+  std::unique_ptr<Database> database;
+  std::vector<std::unique_ptr<Peer>> peers;
+  std::unique_ptr<RaftGroup> group;
+  // 正在处理的 AppendEntries 完成的时间
+  uint64_t busy_until_micros;
+  int64_t apply_micros;
+  int64_t applied_index;
+  bool applying;
+
+  Node()
+    : busy_until_micros(0), apply_micros(0), applied_index(-1),
+      applying(false) {}
+};
+
+class SimCluster::Peer : public PeerClient {
+ public:
+  Peer(SimCluster* cluster, const std::string& from, const std::string& to)
+    : cluster_(cluster), from_(from), to_(to) {}
+
+  const std::string& peer_id() const override { return to_; }
+
+  void AppendEntries(const AppendEntriesRequest& request,
+                     AppendEntriesCallback done) override {
+    cluster_->SendAppendEntries(from_, to_, request, std::move(done));
+  }
+
+  void RequestVote(const VoteRequest& request, VoteCallback done) override {
+    cluster_->SendVote(from_, to_, request, std::move(done));
+  }
+
+  void TimeoutNow(const TimeoutNowRequest& request,
+                  TimeoutNowCallback done) override {
+    cluster_->SendTimeoutNow(from_, to_, request, std::move(done));
+  }
+
+ private:
+  SimCluster* cluster_;
+  const std::string from_;
+  const std::string to_;
+
+  DISALLOW_COPY_AND_ASSIGN(Peer);
+};
+
+SimOptions::SimOptions()
+  : nodes(3),
+    seed(301),
+    rpc_timeout_micros(200000),
+    append_micros(50),
+    apply_micros(0),
+    tick_micros(10000),
+    pre_vote(true) {
+  replicator.lease_micros = 0;
+}
+
+std::string SimReport::ToString() const {
+  std::string result = base::strings::SPrintf(
+      "elapsed %.2fs, commits %lld (%.1f/s), failures %lld, "
+      "latency p50 %.2fms p99 %.2fms",
+      elapsed_micros / 1e6, static_cast<long long>(commits), commits_per_sec,
+      static_cast<long long>(failures), p50_latency_micros / 1e3,
+      p99_latency_micros / 1e3);
+  if (election_micros >= 0) {
+    base::strings::Appendf(&result, ", election %.1fms", election_micros / 1e3);
+  }
+  if (failover_micros >= 0) {
+    base::strings::Appendf(&result, ", failover %.1fms", failover_micros / 1e3);
+  }
+  base::strings::Appendf(&result, ", messages %lld (%.2fMB, %lld dropped)",
+                         static_cast<long long>(network.messages),
+                         network.bytes / 1e6,
+                         static_cast<long long>(network.dropped));
+  return result;
+}
+
+SimCluster::SimCluster(const SimOptions& options)
+  : options_(options),
+    env_(&loop_),
+    network_(&loop_, options.seed),
+    storage_env_(leveldb::NewMemEnv(leveldb::Env::Default())),
+    workload_running_(false),
+    workload_epoch_(0),
+    next_key_(0) {
+  // 单节点时没有响应推动 commit
+  DCHECK_GE(options_.nodes, 2);
+  network_.SetDefaultLink(options_.link);
+  for (int32_t i = 0; i < options_.nodes; ++i) {
+    node_ids_.push_back("node" + std::to_string(i));
+  }
+  for (const std::string& id : node_ids_) {
+    std::unique_ptr<Node> node(new Node());
+    node->id = id;
+    node->apply_micros = options_.apply_micros;
+    const std::string data_dir = "/sim/" + id;
+    node->database.reset(new Database(data_dir, storage_env_.get()));
+    std::vector<PeerClient*> peers;
+    for (const std::string& peer_id : node_ids_) {
+      if (peer_id != id) {
+        node->peers.emplace_back(new Peer(this, id, peer_id));
+        peers.push_back(node->peers.back().get());
+      }
+    }
+    RaftGroup::Options group_options;
+    group_options.node_id = id;
+    group_options.data_dir = data_dir;
+    group_options.storage_env = storage_env_.get();
+    group_options.replicator = options_.replicator;
+    group_options.replicator.env = &env_;
+    group_options.proposal.max_delay_micros = 0;
+    group_options.proposal.env = &env_;
+    group_options.backlog = options_.backlog;
+    group_options.election = options_.election;
+    group_options.election.seed = options_.seed;
+    group_options.pre_vote = options_.pre_vote;
+    node->group.reset(new RaftGroup(group_options, node->database.get(), peers));
+    nodes_.push_back(std::move(node));
+  }
+  ResetStats();
+}
+
+SimCluster::~SimCluster() {
+  StopWorkload();
+  loop_.Clear();
+  nodes_.clear();
+  loop_.Clear();
+}
+
+RaftGroup* SimCluster::group(const std::string& node_id) {
+  Node* node = GetNode(node_id);
+  return node == nullptr ? nullptr : node->group.get();
+}
+
+void SimCluster::Start() {
+  const std::string& first = node_ids_[0];
+  for (auto& node : nodes_) {
+    if (node->id == first) {
+      node->group->BecomeLeader(1);
+    } else {
+      node->group->BecomeFollower(1, first);
+    }
+  }
+  Tick();
+}
+
+void SimCluster::StartWorkload(const SimWorkload& workload) {
+  workload_ = workload;
+  workload_running_ = true;
+  workload_epoch_++;
+  for (int32_t client = 0; client < workload_.clients; ++client) {
+    IssueRequest(client);
+  }
+}
+
+void SimCluster::StopWorkload() {
+  workload_running_ = false;
+  workload_epoch_++;
+}
+
+void SimCluster::Crash(const std::string& node_id) {
+  Node* node = GetNode(node_id);
+  DCHECK(node != nullptr) << node_id;
+  if (node->group->is_leader()) {
+    Disrupt(node_id);
+  }
+  network_.SetNodeUp(node_id, false);
+  // 进程重启后不再是 leader, 等待中的请求失败
+  node->group->BecomeFollower(node->group->current_term(), "");
+}
+
+void SimCluster::TransferLeadership(const std::string& target_id) {
+  const std::string leader_id = leader();
+  if (leader_id.empty()) {
+    return;
+  }
+  Disrupt(leader_id);
+  GetNode(leader_id)->group->TransferLeadership(target_id,
+      [leader_id, target_id](const base::Status& status) {
+        LOG_IF(WARNING, !status.ok()) << "[SimCluster] Transfer from " << leader_id
+                                      << " to " << target_id << " failed: "
+                                      << status.ToString();
+      });
+}
+
+void SimCluster::Disrupt(const std::string& leader_id) {
+  disrupt_micros_ = loop_.now_micros();
+  disrupted_leader_ = leader_id;
+  election_micros_ = -1;
+  failover_micros_ = -1;
+}
+
+void SimCluster::Restart(const std::string& node_id) {
+  Node* node = GetNode(node_id);
+  DCHECK(node != nullptr) << node_id;
+  network_.SetNodeUp(node_id, true);
+  node->busy_until_micros = loop_.now_micros();
+}
+
+void SimCluster::SetApplyMicros(const std::string& node_id,
+                                int64_t apply_micros) {
+  Node* node = GetNode(node_id);
+  DCHECK(node != nullptr) << node_id;
+  node->apply_micros = apply_micros;
+}
+
+std::string SimCluster::leader() const {
+  std::string leader_id;
+  int64_t leader_term = -1;
+  for (const auto& node : nodes_) {
+    if (network_.IsNodeUp(node->id) && node->group->is_leader() &&
+        node->group->current_term() > leader_term) {
+      leader_id = node->id;
+      leader_term = node->group->current_term();
+    }
+  }
+  return leader_id;
+}
+
+SimReport SimCluster::Report() const {
+  SimReport report;
+  report.elapsed_micros = loop_.now_micros() - stats_start_micros_;
+  report.commits = commits_;
+  report.failures = failures_;
+  report.commits_per_sec = report.elapsed_micros > 0 ?
+      commits_ * 1e6 / report.elapsed_micros : 0;
+  report.p50_latency_micros = commits_ > 0 ? latency_.Median() : 0;
+  report.p99_latency_micros = commits_ > 0 ? latency_.Percentile(99) : 0;
+  report.election_micros = election_micros_;
+  report.failover_micros = failover_micros_;
+  report.network = network_.stats();
+  return report;
+}
+
+void SimCluster::ResetStats() {
+  stats_start_micros_ = loop_.now_micros();
+  commits_ = 0;
+  failures_ = 0;
+  latency_.Clear();
+  disrupt_micros_ = 0;
+  disrupted_leader_.clear();
+  election_micros_ = -1;
+  failover_micros_ = -1;
+  network_.ResetStats();
+}
+
+SimCluster::Node* SimCluster::GetNode(const std::string& node_id) const {
+  for (const auto& node : nodes_) {
+    if (node->id == node_id) {
+      return node.get();
+    }
+  }
+  return nullptr;
+}
+
+void SimCluster::SendAppendEntries(const std::string& from, const std::string& to,
+                                   const AppendEntriesRequest& request,
+                                   PeerClient::AppendEntriesCallback done) {
+  // 响应与超时先到者结束请求
+  std::shared_ptr<bool> finished(new bool(false));
+  auto finish = [finished, done](const base::Status& status,
+                                 const AppendEntriesResponse& response) {
+    if (*finished) {
+      return;
+    }
+    *finished = true;
+    done(status, response);
+  };
+  loop_.Schedule(options_.rpc_timeout_micros, [finish]() {
+    finish(base::errors::Unavailable("rpc timeout"), AppendEntriesResponse());
+  });
+
+  network_.Send(from, to, request.ByteSizeLong(), [this, from, to, request, finish]() {
+    // follower 依次处理请求
+    Node* node = GetNode(to);
+    const uint64_t now = loop_.now_micros();
+    node->busy_until_micros = std::max(now, node->busy_until_micros) +
+                              options_.append_micros;
+    loop_.Schedule(node->busy_until_micros - now, [this, from, to, request, finish]() {
+      if (!network_.IsNodeUp(to)) {
+        return;
+      }
+      Node* node = GetNode(to);
+      AppendEntriesResponse response;
+      node->group->HandleAppendEntries(request, &response);
+      Apply(node);
+      network_.Send(to, from, response.ByteSizeLong(), [finish, response]() {
+        finish(base::Status::OK(), response);
+      });
+    });
+  });
+}
+
+template <typename Response>
+void SimCluster::Call(const std::string& from, const std::string& to,
+                      size_t request_bytes,
+                      std::function<void(RaftGroup*, Response*)> handle,
+                      std::function<void(const base::Status&, const Response&)> done) {
+  std::shared_ptr<bool> finished(new bool(false));
+  auto finish = [finished, done](const base::Status& status,
+                                 const Response& response) {
+    if (*finished) {
+      return;
+    }
+    *finished = true;
+    done(status, response);
+  };
+  loop_.Schedule(options_.rpc_timeout_micros, [finish]() {
+    finish(base::errors::Unavailable("rpc timeout"), Response());
+  });
+
+  network_.Send(from, to, request_bytes, [this, from, to, handle, finish]() {
+    if (!network_.IsNodeUp(to)) {
+      return;
+    }
+    Response response;
+    handle(GetNode(to)->group.get(), &response);
+    network_.Send(to, from, response.ByteSizeLong(), [finish, response]() {
+      finish(base::Status::OK(), response);
+    });
+  });
+}
+
+void SimCluster::SendVote(const std::string& from, const std::string& to,
+                          const VoteRequest& request,
+                          PeerClient::VoteCallback done) {
+  Call<VoteResponse>(from, to, request.ByteSizeLong(),
+      [request](RaftGroup* group, VoteResponse* response) {
+        group->HandleVote(request, response);
+      }, std::move(done));
+}
+
+void SimCluster::SendTimeoutNow(const std::string& from, const std::string& to,
+                                const TimeoutNowRequest& request,
+                                PeerClient::TimeoutNowCallback done) {
+  Call<TimeoutNowResponse>(from, to, request.ByteSizeLong(),
+      [request](RaftGroup* group, TimeoutNowResponse* response) {
+        group->HandleTimeoutNow(request, response);
+      }, std::move(done));
+}
+
+void SimCluster::Tick() {
+  for (auto& node : nodes_) {
+    if (!network_.IsNodeUp(node->id)) {
+      continue;
+    }
+    Apply(node.get());
+    node->group->Tick();
+  }
+  if (disrupt_micros_ > 0 && election_micros_ < 0) {
+    const std::string leader_id = leader();
+    if (!leader_id.empty() && leader_id != disrupted_leader_) {
+      election_micros_ = loop_.now_micros() - disrupt_micros_;
+    }
+  }
+  loop_.Schedule(options_.tick_micros, [this]() { Tick(); });
+}
+
+void SimCluster::Apply(Node* node) {
+  if (node->applying) {
+    return;
+  }
+  const int64_t commit_index = node->group->commit_index();
+  if (commit_index <= node->applied_index) {
+    return;
+  }
+  if (node->apply_micros <= 0) {
+    node->applied_index = commit_index;
+    node->group->Applied(commit_index);
+    return;
+  }
+  // 一次 apply 当前已提交的全部日志, 完成后再看是否有新提交的
+  node->applying = true;
+  const int64_t micros = (commit_index - node->applied_index) * node->apply_micros;
+  loop_.Schedule(micros, [this, node, commit_index]() {
+    node->applying = false;
+    node->applied_index = commit_index;
+    node->group->Applied(commit_index);
+    Apply(node);
+  });
+}
+
+void SimCluster::IssueRequest(int32_t client) {
+  Node* node = GetNode(leader());
+  if (node == nullptr) {
+    ScheduleRequest(client, workload_.retry_micros);
+    return;
+  }
+  Entry entry;
+  entry.set_op(kPut);
+  entry.set_key("key" + std::to_string(next_key_++));
+  entry.set_value(std::string(workload_.value_bytes, 'v'));
+
+  const uint64_t start_micros = loop_.now_micros();
+  const int64_t epoch = workload_epoch_;
+  std::shared_ptr<bool> finished(new bool(false));
+  auto finish = [this, finished, client, start_micros, epoch](
+      const base::Status& status) {
+    if (*finished) {
+      return;
+    }
+    *finished = true;
+    if (epoch == workload_epoch_) {
+      FinishRequest(client, start_micros, status);
+    }
+  };
+  base::Status status = node->group->Propose(entry,
+      [finish](const base::Status& s, int64_t) { finish(s); });
+  if (!status.ok()) {
+    finish(status);
+    return;
+  }
+  loop_.Schedule(workload_.request_timeout_micros, [finish]() {
+    finish(base::errors::DeadlineExceeded("request timeout"));
+  });
+}
+
+void SimCluster::ScheduleRequest(int32_t client, int64_t delay_micros) {
+  const int64_t epoch = workload_epoch_;
+  loop_.Schedule(delay_micros, [this, client, epoch]() {
+    if (workload_running_ && epoch == workload_epoch_) {
+      IssueRequest(client);
+    }
+  });
+}
+
+void SimCluster::FinishRequest(int32_t client, uint64_t start_micros,
+                               const base::Status& status) {
+  const uint64_t now = loop_.now_micros();
+  if (!status.ok()) {
+    failures_++;
+    ScheduleRequest(client, workload_.retry_micros);
+    return;
+  }
+  commits_++;
+  latency_.Add(now - start_micros);
+  // 之前发出的请求可能在转移期间提交, 不计入
+  if (disrupt_micros_ > 0 && failover_micros_ < 0 &&
+      start_micros >= disrupt_micros_) {
+    failover_micros_ = now - disrupt_micros_;
+  }
+  ScheduleRequest(client, 0);
+}
+
+} // namespace chubby
+} // namespace mpr
@@ -0,0 +1,165 @@
+#ifndef MPR_CHUBBY_SIM_SIM_CLUSTER_H_
+#define MPR_CHUBBY_SIM_SIM_CLUSTER_H_
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <leveldb/env.h>
+
+#include "base/histogram.h"
+#include "base/macros.h"
+#include "server/raft_group.h"
+#include "sim/sim_loop.h"
+#include "sim/sim_network.h"
+#include "storage/database.h"
+
+namespace mpr {
+namespace chubby {
+
+struct SimOptions {
+  int32_t nodes;
+  uint64_t seed;
+  LinkOptions link;
+  // 请求发出后没有在 rpc_timeout_micros 内收到响应时以 Unavailable 结束
+  int64_t rpc_timeout_micros;
+  // follower 处理一个 AppendEntries 的耗时 (写盘), 同一节点上依次处理
+  int64_t append_micros;
+  // apply 每条已提交日志的耗时, 0 表示提交后立即 apply
+  int64_t apply_micros;
+  // 调用 RaftGroup::Tick 的周期, 决定心跳和选举超时的精度
+  int64_t tick_micros;
+  // env 与回调由 SimCluster 填写
+  Replicator::Options replicator;
+  ApplyBacklog::Options backlog;
+  // seed 由 SimCluster 按节点填写
+  ElectionTimer::Options election;
+  bool pre_vote;
+
+  SimOptions();
+};
+
+// 闭环的写负载: 每个客户端同时只有一个 Put, 完成后立即发下一个.
+struct SimWorkload {
+  int32_t clients;
+  int32_t value_bytes;
+  // 超时或失败后等待 retry_micros 再向当前 leader 重试
+  int64_t request_timeout_micros;
+  int64_t retry_micros;
+
+  SimWorkload()
+    : clients(32), value_bytes(128), request_timeout_micros(1000000),
+      retry_micros(10000) {}
+};
+
+struct SimReport {
+  int64_t elapsed_micros;
+  int64_t commits;
+  int64_t failures;
+  double commits_per_sec;
+  double p50_latency_micros;
+  double p99_latency_micros;
+  // 最近一次 leader 宕机或开始转移领导权到选出新 leader (精度为 tick_micros),
+  // 以及到之后发出的请求第一次提交的时间, 没有发生时为 -1
+  int64_t election_micros;
+  int64_t failover_micros;
+  SimNetwork::Stats network;
+
+  std::string ToString() const;
+};
+
+// 在一个进程中运行 N 个节点的共识组.
+//
+// 所有节点共用一个 SimLoop, 时间是虚拟的, 同样的 seed 和脚本得到同样的
+// 结果. binlog 和 Database 放在 leveldb 的内存 Env 中, term 和投票不持久化.
+// 节点之间通过 SimNetwork 发送 AppendEntries 和 RequestVote, 可以注入延迟,
+// 丢包, 分区和带宽限制. leader 故障后由节点自己选举.
+class SimCluster {
+ public:
+  explicit SimCluster(const SimOptions& options);
+  ~SimCluster();
+
+  SimLoop* loop() { return &loop_; }
+  SimNetwork* network() { return &network_; }
+  const std::vector<std::string>& node_ids() const { return node_ids_; }
+  RaftGroup* group(const std::string& node_id);
+
+  // 第一个节点成为 term 1 的 leader, 开始周期性的 tick
+  void Start();
+  void RunFor(int64_t micros) { loop_.RunFor(micros); }
+
+  void StartWorkload(const SimWorkload& workload);
+  void StopWorkload();
+
+  // 宕机的节点收发的消息都会丢失, 并失去 leader 身份; 日志保留.
+  void Crash(const std::string& node_id);
+  void Restart(const std::string& node_id);
+  // 当前 leader 把领导权交给 target_id, 计入 election_micros 和 failover_micros
+  void TransferLeadership(const std::string& target_id);
+  // 单独调整一个节点的 apply 速度, 模拟磁盘或 CPU 出问题的副本
+  void SetApplyMicros(const std::string& node_id, int64_t apply_micros);
+
+  // 在线并且认为自己是 leader 的节点中 term 最大的一个, 没有时返回空
+  std::string leader() const;
+
+  // 统计 ResetStats 以来的数据
+  SimReport Report() const;
+  void ResetStats();
+
+ private:
+  struct Node;
+  class Peer;
+
+  Node* GetNode(const std::string& node_id) const;
+  void SendAppendEntries(const std::string& from, const std::string& to,
+                         const AppendEntriesRequest& request,
+                         PeerClient::AppendEntriesCallback done);
+  // 不排队的 RPC: 到达时在 to 上调用 handle, 消息丢失时以超时结束
+  template <typename Response>
+  void Call(const std::string& from, const std::string& to, size_t request_bytes,
+            std::function<void(RaftGroup*, Response*)> handle,
+            std::function<void(const base::Status&, const Response&)> done);
+  void SendVote(const std::string& from, const std::string& to,
+                const VoteRequest& request, PeerClient::VoteCallback done);
+  void SendTimeoutNow(const std::string& from, const std::string& to,
+                      const TimeoutNowRequest& request,
+                      PeerClient::TimeoutNowCallback done);
+  void Disrupt(const std::string& leader_id);
+  void Tick();
+  void Apply(Node* node);
+  void IssueRequest(int32_t client);
+  void ScheduleRequest(int32_t client, int64_t delay_micros);
+  void FinishRequest(int32_t client, uint64_t start_micros,
+                     const base::Status& status);
+
+  const SimOptions options_;
+  SimLoop loop_;
+  SimEnv env_;
+  SimNetwork network_;
+  std::unique_ptr<leveldb::Env> storage_env_;
+  std::vector<std::string> node_ids_;
+  std::vector<std::unique_ptr<Node>> nodes_;
+
+  bool workload_running_;
+  // 每次 StartWorkload 递增, 旧负载的回调被忽略
+  int64_t workload_epoch_;
+  SimWorkload workload_;
+  int64_t next_key_;
+
+  uint64_t stats_start_micros_;
+  int64_t commits_;
+  int64_t failures_;
+  base::Histogram latency_;
+  // 最近一次宕机或转移前的 leader
+  uint64_t disrupt_micros_;
+  std::string disrupted_leader_;
+  int64_t election_micros_;
+  int64_t failover_micros_;
+
+  DISALLOW_COPY_AND_ASSIGN(SimCluster);
+};
+
+} // namespace chubby
+} // namespace mpr
+#endif // MPR_CHUBBY_SIM_SIM_CLUSTER_H_
@@ -0,0 +1,245 @@
+#include <gtest/gtest.h>
+
+#include "sim/sim_cluster.h"
+
+namespace mpr {
+namespace chubby {
+
+namespace {
+
+SimOptions TestOptions() {
+  SimOptions options;
+  options.link.latency_micros = 1000;
+  options.link.jitter_micros = 200;
+  return options;
+}
+
+SimWorkload TestWorkload() {
+  SimWorkload workload;
+  workload.clients = 8;
+  workload.value_bytes = 64;
+  return workload;
+}
+
+} // namespace
+
+TEST(SimCluster, SteadyState) {
+  SimCluster cluster(TestOptions());
+  cluster.Start();
+  cluster.StartWorkload(TestWorkload());
+  cluster.RunFor(1000000);
+  SimReport report = cluster.Report();
+
+  EXPECT_GT(report.commits, 0);
+  EXPECT_EQ(0, report.failures);
+  // 至少一个来回
+  EXPECT_GE(report.p50_latency_micros, 2000);
+  EXPECT_LE(report.p50_latency_micros, report.p99_latency_micros);
+  EXPECT_EQ(-1, report.failover_micros);
+  EXPECT_EQ("node0", cluster.leader());
+}
+
+TEST(SimCluster, Deterministic) {
+  SimOptions options = TestOptions();
+  options.link.loss = 0.01;
+  SimReport reports[2];
+  for (SimReport& report : reports) {
+    SimCluster cluster(options);
+    cluster.Start();
+    cluster.StartWorkload(TestWorkload());
+    cluster.RunFor(500000);
+    report = cluster.Report();
+  }
+  EXPECT_GT(reports[0].commits, 0);
+  EXPECT_EQ(reports[0].commits, reports[1].commits);
+  EXPECT_EQ(reports[0].network.dropped, reports[1].network.dropped);
+  EXPECT_EQ(reports[0].p99_latency_micros, reports[1].p99_latency_micros);
+}
+
+TEST(SimCluster, FailoverAfterLeaderCrash) {
+  SimCluster cluster(TestOptions());
+  cluster.Start();
+  cluster.StartWorkload(TestWorkload());
+  cluster.RunFor(200000);
+  cluster.ResetStats();
+
+  cluster.Crash("node0");
+  EXPECT_EQ("", cluster.leader());
+  cluster.RunFor(2000000);
+  SimReport report = cluster.Report();
+
+  EXPECT_NE("", cluster.leader());
+  EXPECT_NE("node0", cluster.leader());
+  // 低延迟链路上心跳间隔为 50ms, 几个心跳间隔内完成切换
+  EXPECT_GT(report.election_micros, 0);
+  EXPECT_LT(report.election_micros, 500000);
+  EXPECT_GE(report.failover_micros, report.election_micros);
+  EXPECT_LT(report.failover_micros, 600000);
+  EXPECT_GT(report.commits, 0);
+
+  // 恢复后追上新 leader 的日志
+  cluster.Restart("node0");
+  cluster.RunFor(500000);
+  cluster.StopWorkload();
+  cluster.RunFor(500000);
+  const std::string leader = cluster.leader();
+  EXPECT_EQ(cluster.group(leader)->bin_logger()->GetLength(),
+            cluster.group("node0")->bin_logger()->GetLength());
+}
+
+TEST(SimCluster, LeadershipTransfer) {
+  SimCluster cluster(TestOptions());
+  cluster.Start();
+  cluster.StartWorkload(TestWorkload());
+  cluster.RunFor(200000);
+  cluster.ResetStats();
+
+  cluster.TransferLeadership("node2");
+  cluster.RunFor(1000000);
+  SimReport report = cluster.Report();
+
+  EXPECT_EQ("node2", cluster.leader());
+  EXPECT_FALSE(cluster.group("node0")->is_leader());
+  EXPECT_TRUE(cluster.group("node0")->transfer_target().empty());
+  // 不需要等待选举超时, 几个来回加上一次 tick 内完成
+  EXPECT_GT(report.election_micros, 0);
+  EXPECT_LE(report.election_micros, 20000);
+  EXPECT_LT(report.failover_micros, 50000);
+  EXPECT_GT(report.commits, 0);
+}
+
+TEST(SimCluster, MinorityPartition) {
+  SimCluster cluster(TestOptions());
+  cluster.Start();
+  cluster.StartWorkload(TestWorkload());
+  cluster.RunFor(200000);
+
+  // 隔离一个 follower 不影响提交
+  cluster.ResetStats();
+  cluster.network()->Partition({"node2"});
+  cluster.RunFor(300000);
+  EXPECT_GT(cluster.Report().commits, 0);
+  EXPECT_EQ("node0", cluster.leader());
+
+  // 隔离 leader 后多数派一侧选出新 leader
+  cluster.network()->Partition({"node0"});
+  cluster.RunFor(2000000);
+  EXPECT_NE("node0", cluster.leader());
+  cluster.network()->Heal();
+  cluster.RunFor(500000);
+  EXPECT_FALSE(cluster.group("node0")->is_leader());
+}
+
+TEST(SimCluster, BandwidthLimitsThroughput) {
+  SimOptions options = TestOptions();
+  SimWorkload workload = TestWorkload();
+  workload.value_bytes = 4096;
+  double throughput[2];
+  for (int i = 0; i < 2; ++i) {
+    options.link.bandwidth_bytes_per_sec = i == 0 ? 0 : 1024 * 1024;
+    SimCluster cluster(options);
+    cluster.Start();
+    cluster.StartWorkload(workload);
+    cluster.RunFor(1000000);
+    throughput[i] = cluster.Report().commits_per_sec;
+  }
+  EXPECT_GT(throughput[0], throughput[1]);
+  // 每条日志 4KB, 1MB/s 的链路最多约 256 条每秒
+  EXPECT_LT(throughput[1], 300);
+}
+
+TEST(SimCluster, SlowReplicaIsThrottled) {
+  SimOptions options = TestOptions();
+  options.backlog.max_entries = 200;
+  options.backlog.max_bytes = 0;
+  double throughput[2];
+  for (int i = 0; i < 2; ++i) {
+    SimCluster cluster(options);
+    if (i == 1) {
+      // node2 每秒只能 apply 1000 条, 远低于集群的提交速度
+      cluster.SetApplyMicros("node2", 1000);
+    }
+    cluster.Start();
+    cluster.StartWorkload(TestWorkload());
+    cluster.RunFor(2000000);
+    throughput[i] = cluster.Report().commits_per_sec;
+    if (i == 1) {
+      // 慢副本被限流, 积压保持在上限附近而不是无限增长
+      const ApplyBacklog* backlog = cluster.group("node2")->backlog();
+      EXPECT_LT(backlog->entries(), 1000);
+      std::vector<Replicator::FollowerStatus> status =
+          cluster.group("node0")->replicator()->GetFollowerStatus();
+      ASSERT_EQ(2u, status.size());
+      EXPECT_EQ(options.replicator.max_inflight, status[0].window);
+      EXPECT_LT(status[1].window, options.replicator.max_inflight);
+    }
+  }
+  EXPECT_GT(throughput[0], 1000);
+  // 提交只依赖健康的多数派
+  EXPECT_GT(throughput[1], throughput[0] * 0.8);
+}
+
+TEST(SimCluster, PreVoteKeepsRejoiningNodeFromDisrupting) {
+  for (bool pre_vote : {true, false}) {
+    SimOptions options = TestOptions();
+    options.pre_vote = pre_vote;
+    SimCluster cluster(options);
+    cluster.Start();
+    cluster.StartWorkload(TestWorkload());
+    cluster.RunFor(200000);
+    const int64_t term = cluster.group("node0")->current_term();
+
+    // 被隔离的 follower 反复选举超时
+    cluster.network()->Partition({"node2"});
+    cluster.RunFor(2000000);
+    cluster.network()->Heal();
+    cluster.RunFor(500000);
+
+    if (pre_vote) {
+      // pre-vote 得不到多数派, term 不变, leader 不受影响
+      EXPECT_EQ(term, cluster.group("node2")->current_term());
+      EXPECT_EQ(term, cluster.group("node0")->current_term());
+      EXPECT_EQ("node0", cluster.leader());
+    } else {
+      // 没有 pre-vote 时重新加入的节点带着更大的 term 迫使 leader 退位,
+      // 它的日志落后, 需要再一轮选举才能恢复
+      EXPECT_GT(cluster.group("node0")->current_term(), term);
+      cluster.RunFor(2000000);
+    }
+    EXPECT_NE("", cluster.leader());
+  }
+}
+
+TEST(SimCluster, OneVotePerTerm) {
+  SimOptions options = TestOptions();
+  options.nodes = 5;
+  // 很窄的随机区间, 容易同时超时
+  options.election.min_timeout_micros = 100000;
+  options.election.max_timeout_micros = 100000;
+  options.link.loss = 0.05;
+  SimCluster cluster(options);
+  cluster.Start();
+  cluster.RunFor(100000);
+  for (int i = 0; i < 3; ++i) {
+    const std::string old_leader = cluster.leader();
+    cluster.Crash(old_leader);
+    cluster.RunFor(2000000);
+    const std::string leader = cluster.leader();
+    ASSERT_NE("", leader);
+    // 当前 term 的 leader 只有一个, 并且得到了自己的一票
+    int leaders = 0;
+    for (const std::string& id : cluster.node_ids()) {
+      RaftGroup* group = cluster.group(id);
+      if (group->is_leader() &&
+          group->current_term() == cluster.group(leader)->current_term()) {
+        leaders++;
+      }
+    }
+    EXPECT_EQ(1, leaders);
+    EXPECT_EQ(leader, cluster.group(leader)->voted_for());
+    cluster.Restart(old_leader);
+  }
+}
+
+} // namespace chubby
+} // namespace mpr
@@ -0,0 +1,43 @@
+#include "sim/sim_loop.h"
+
+#include "base/logging.h"
+
+namespace mpr {
+namespace chubby {
+
+namespace {
+
+// 从非 0 开始, 0 在很多组件中表示 "从未发生".
+const uint64_t kStartMicros = 1000000;
+
+} // namespace
+
+SimLoop::SimLoop() : now_micros_(kStartMicros), next_seq_(0) {}
+
+SimLoop::~SimLoop() {}
+
+void SimLoop::Schedule(int64_t delay_micros, std::function<void()> fn) {
+  DCHECK_GE(delay_micros, 0);
+  events_.push(Event{now_micros_ + delay_micros, next_seq_++, std::move(fn)});
+}
+
+void SimLoop::RunUntil(uint64_t deadline_micros) {
+  while (!events_.empty() && events_.top().micros <= deadline_micros) {
+    Event event = events_.top();
+    events_.pop();
+    now_micros_ = event.micros;
+    event.fn();
+  }
+  if (deadline_micros > now_micros_) {
+    now_micros_ = deadline_micros;
+  }
+}
+
+void SimLoop::Clear() {
+  while (!events_.empty()) {
+    events_.pop();
+  }
+}
+
+} // namespace chubby
+} // namespace mpr
@@ -0,0 +1,71 @@
+#ifndef MPR_CHUBBY_SIM_SIM_LOOP_H_
+#define MPR_CHUBBY_SIM_SIM_LOOP_H_
+
+#include <functional>
+#include <queue>
+#include <vector>
+
+#include "base/macros.h"
+#include "base/platform/env.h"
+
+namespace mpr {
+namespace chubby {
+
+// 模拟器的虚拟时钟和事件队列.
+//
+// 单线程运行, 事件按时间执行, 同一时刻的事件按加入的顺序执行, 相同的输入
+// 总是得到相同的结果. 虚拟时间只在执行事件时前进, 与实际耗时无关.
+class SimLoop {
+ public:
+  SimLoop();
+  ~SimLoop();
+
+  uint64_t now_micros() const { return now_micros_; }
+
+  // 在 delay_micros 之后执行 fn, fn 中可以继续 Schedule.
+  void Schedule(int64_t delay_micros, std::function<void()> fn);
+
+  // 执行 deadline_micros 之前 (含) 的所有事件, 返回时虚拟时间为 deadline_micros.
+  void RunUntil(uint64_t deadline_micros);
+  void RunFor(int64_t micros) { RunUntil(now_micros_ + micros); }
+
+  // 丢弃所有未执行的事件
+  void Clear();
+
+  size_t pending() const { return events_.size(); }
+
+ private:
+  struct Event {
+    uint64_t micros;
+    uint64_t seq;
+    std::function<void()> fn;
+  };
+  struct Later {
+    bool operator()(const Event& a, const Event& b) const {
+      return a.micros != b.micros ? a.micros > b.micros : a.seq > b.seq;
+    }
+  };
+
+  uint64_t now_micros_;
+  uint64_t next_seq_;
+  std::priority_queue<Event, std::vector<Event>, Later> events_;
+
+  DISALLOW_COPY_AND_ASSIGN(SimLoop);
+};
+
+// NowMicros 返回 SimLoop 的虚拟时间, 其他调用转发给 Env::Default().
+// 模拟器中的组件不能启动自己的线程.
+class SimEnv : public base::EnvDecorator {
+ public:
+  explicit SimEnv(SimLoop* loop)
+    : base::EnvDecorator(base::Env::Default()), loop_(loop) {}
+
+  base::uint64 NowMicros() override { return loop_->now_micros(); }
+
+ private:
+  SimLoop* loop_;
+};
+
+} // namespace chubby
+} // namespace mpr
+#endif // MPR_CHUBBY_SIM_SIM_LOOP_H_
@@ -0,0 +1,90 @@
+#include "sim/sim_network.h"
+
+#include <algorithm>
+
+namespace mpr {
+namespace chubby {
+
+SimNetwork::SimNetwork(SimLoop* loop, uint64_t seed)
+  : loop_(loop),
+    philox_(seed),
+    random_(&philox_) {}
+
+void SimNetwork::SetDefaultLink(const LinkOptions& link) {
+  default_link_ = link;
+}
+
+void SimNetwork::SetLink(const std::string& from, const std::string& to,
+                         const LinkOptions& link) {
+  links_[Link(from, to)] = link;
+}
+
+void SimNetwork::SetNodeUp(const std::string& node, bool up) {
+  if (up) {
+    down_.erase(node);
+  } else {
+    down_.insert(node);
+  }
+}
+
+bool SimNetwork::IsNodeUp(const std::string& node) const {
+  return down_.count(node) == 0;
+}
+
+void SimNetwork::Partition(const std::vector<std::string>& side) {
+  partition_.clear();
+  partition_.insert(side.begin(), side.end());
+}
+
+void SimNetwork::Heal() {
+  partition_.clear();
+}
+
+bool SimNetwork::Reachable(const std::string& from, const std::string& to) const {
+  return IsNodeUp(from) && IsNodeUp(to) &&
+         partition_.count(from) == partition_.count(to);
+}
+
+void SimNetwork::Send(const std::string& from, const std::string& to,
+                      int64_t bytes, std::function<void()> deliver) {
+  const Link link(from, to);
+  const LinkOptions& options = GetLink(link);
+  stats_.messages++;
+  stats_.bytes += bytes;
+  if (!Reachable(from, to) ||
+      (options.loss > 0 && random_.RandDouble() < options.loss)) {
+    stats_.dropped++;
+    return;
+  }
+
+  int64_t delay = options.latency_micros;
+  if (options.jitter_micros > 0) {
+    delay += random_.Uniform64(options.jitter_micros);
+  }
+  if (options.bandwidth_bytes_per_sec > 0) {
+    // 消息依次占用链路, 排在前面的消息发完之后才开始发送
+    uint64_t& busy_until = busy_until_[link];
+    uint64_t start = std::max(busy_until, loop_->now_micros());
+    busy_until = start + bytes * 1000000 / options.bandwidth_bytes_per_sec;
+    delay += busy_until - loop_->now_micros();
+  }
+  // 同 TCP, 同一链路上的消息按发送顺序到达
+  uint64_t& last_arrival = last_arrival_[link];
+  uint64_t arrival = std::max(loop_->now_micros() + delay, last_arrival);
+  last_arrival = arrival;
+  loop_->Schedule(arrival - loop_->now_micros(), [this, from, to, deliver]() {
+    if (!Reachable(from, to)) {
+      stats_.dropped++;
+      return;
+    }
+    deliver();
+  });
+}
+
+const LinkOptions& SimNetwork::GetLink(const Link& link) const {
+  auto it = links_.find(link);
+  return it == links_.end() ? default_link_ : it->second;
+}
+
+} // namespace chubby
+} // namespace mpr
@@ -0,0 +1,90 @@
+#ifndef MPR_CHUBBY_SIM_SIM_NETWORK_H_
+#define MPR_CHUBBY_SIM_SIM_NETWORK_H_
+
+#include <functional>
+#include <map>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base/macros.h"
+#include "base/random/philox_random.h"
+#include "base/random/simple_philox.h"
+#include "sim/sim_loop.h"
+
+namespace mpr {
+namespace chubby {
+
+// 一个方向的链路参数
+struct LinkOptions {
+  // 单程延迟, 加上 [0, jitter_micros) 的均匀抖动
+  int64_t latency_micros;
+  int64_t jitter_micros;
+  // 每条消息独立丢失的概率
+  double loss;
+  // 0 表示不限带宽, 否则消息在链路上排队发送
+  int64_t bandwidth_bytes_per_sec;
+
+  LinkOptions()
+    : latency_micros(500), jitter_micros(100), loss(0),
+      bandwidth_bytes_per_sec(0) {}
+};
+
+// 模拟节点之间的网络. 消息在 SimLoop 中按链路参数延迟送达, 可以丢失,
+// 宕机的节点和被分区隔开的节点之间的消息都会丢失. 随机数由 seed 决定.
+class SimNetwork {
+ public:
+  struct Stats {
+    int64_t messages;
+    int64_t bytes;
+    int64_t dropped;
+
+    Stats() : messages(0), bytes(0), dropped(0) {}
+  };
+
+  SimNetwork(SimLoop* loop, uint64_t seed);
+
+  void SetDefaultLink(const LinkOptions& link);
+  void SetLink(const std::string& from, const std::string& to,
+               const LinkOptions& link);
+
+  void SetNodeUp(const std::string& node, bool up);
+  bool IsNodeUp(const std::string& node) const;
+
+  // side 中的节点与其他节点互相不可达, 覆盖之前的分区
+  void Partition(const std::vector<std::string>& side);
+  void Heal();
+  bool Reachable(const std::string& from, const std::string& to) const;
+
+  // 发送 bytes 字节的消息, 送达时在 SimLoop 中调用 deliver. 丢失的消息
+  // 不会有任何通知, 超时由调用者处理. 送达时再检查一次目标是否可达.
+  void Send(const std::string& from, const std::string& to, int64_t bytes,
+            std::function<void()> deliver);
+
+  const Stats& stats() const { return stats_; }
+  void ResetStats() { stats_ = Stats(); }
+
+ private:
+  typedef std::pair<std::string, std::string> Link;
+
+  const LinkOptions& GetLink(const Link& link) const;
+
+  SimLoop* loop_;
+  base::random::PhiloxRandom philox_;
+  base::random::SimplePhilox random_;
+  LinkOptions default_link_;
+  std::map<Link, LinkOptions> links_;
+  // 开启带宽限制时, 链路空闲的时间
+  std::map<Link, uint64_t> busy_until_;
+  std::map<Link, uint64_t> last_arrival_;
+  std::set<std::string> down_;
+  std::set<std::string> partition_;
+  Stats stats_;
+
+  DISALLOW_COPY_AND_ASSIGN(SimNetwork);
+};
+
+} // namespace chubby
+} // namespace mpr
+#endif // MPR_CHUBBY_SIM_SIM_NETWORK_H_
@@ -1,5 +1,7 @@
 #include "storage/bin_logger.h"
 
+#include <algorithm>
+
 #include "base/platform/env.h"
 #include "base/io/path.h"
 #include "base/string_encode.h"
@@ -11,6 +13,7 @@ namespace {
 
 const std::string kLogDbName = "#binlog";
 const std::string kLengthTag = "#BINLOG_LENGTH#";
+const std::string kFirstIndexTag = "#BINLOG_FIRST_INDEX#";
 
 } // namespace
 
@@ -18,7 +21,7 @@ namespace mpr {
 namespace chubby {
 
 BinLogger::BinLogger(const Options& options)
-    : length_(0), last_log_term_(-1) {
+    : first_index_(0), length_(0), last_log_term_(-1) {
 
   base::Status status = base::Env::Default()->CreateDirectory(kLogDbName);
   DCHECK(status.ok() || status.code() == base::error::ALREADY_EXISTS) << status.ToString(); 
@@ -31,6 +34,9 @@ BinLogger::BinLogger(const Options& options)
   }
   db_options.write_buffer_size = options.write_buffer_size;
   db_options.block_size = options.block_size;
+  if (options.env != nullptr) {
+    db_options.env = options.env;
+  }
 
   // Create leveldb
   leveldb::DB* db;
@@ -52,6 +58,11 @@ BinLogger::BinLogger(const Options& options)
       last_log_term_ = log_entry.term;
     }
   }
+  db_status = db_->Get(leveldb::ReadOptions(), kFirstIndexTag, &value);
+  if (db_status.ok() && !value.empty()) {
+    first_index_ = std::min(KeyToIndex(value), length_);
+    LOG(INFO) << "First index: " << first_index_;
+  }
 }
 
 BinLogger::~BinLogger() {}
@@ -61,6 +72,11 @@ int64_t BinLogger::GetLength() const {
   return length_;
 }
 
+int64_t BinLogger::GetFirstIndex() const {
+  base::mutex_lock l(mu_);
+  return first_index_;
+}
+
 bool BinLogger::ReadSlot(int64_t slot_index, LogEntry* result) {
   std::string value;
   std::string key = IndexToKey(slot_index);
@@ -78,34 +94,68 @@ bool BinLogger::ReadSlot(int64_t slot_index, LogEntry* result) {
 
 
 bool BinLogger::RemoveSlot(int64_t slot_index) {
-  std::string value;
-  std::string key = IndexToKey(slot_index); 
-  leveldb::Status status = db_->Get(leveldb::ReadOptions(), key, &value);
-  if (!status.ok()) {
-    return false;
-  }
-  status = db_->Delete(leveldb::WriteOptions(), key);
-  if (status.ok()) {
-    return true;
-  } else {
+  if (slot_index != GetFirstIndex()) {
     return false;
   }
+  return RemoveSlotBefore(slot_index + 1);
 }
 
 bool BinLogger::RemoveSlotBefore(int64_t slot_gc_index) {
-  (void) slot_gc_index;
-  // TODO(wqx):
-  // db_->SetNexusGCKey(slot_gc_index);
-  // DBImpl::CompactRange
-  db_->CompactRange(nullptr, nullptr);
+  int64_t first_index;
+  {
+    base::mutex_lock l(mu_);
+    slot_gc_index = std::min(slot_gc_index, length_ - 1);
+    if (slot_gc_index <= first_index_) {
+      return false;
+    }
+    leveldb::WriteBatch batch;
+    for (int64_t index = first_index_; index < slot_gc_index; ++index) {
+      batch.Delete(IndexToKey(index));
+    }
+    batch.Put(kFirstIndexTag, IndexToKey(slot_gc_index));
+    leveldb::Status status = db_->Write(leveldb::WriteOptions(), &batch);
+    if (!status.ok()) {
+      LOG(ERROR) << "Failed to remove slots before " << slot_gc_index << ": "
+                 << status.ToString();
+      return false;
+    }
+    first_index = first_index_;
+    first_index_ = slot_gc_index;
+  }
+  // 只压缩被删除的区间, 不阻塞写入
+  const std::string begin = IndexToKey(first_index);
+  const std::string end = IndexToKey(slot_gc_index);
+  leveldb::Slice begin_slice(begin), end_slice(end);
+  db_->CompactRange(&begin_slice, &end_slice);
   return true;
 }
 
-void BinLogger::AppendEntryList(const google::protobuf::RepeatedPtrField<mpr::chubby::Entry>& entries) {
+int64_t BinLogger::AppendEntryList(const google::protobuf::RepeatedPtrField<mpr::chubby::Entry>& entries) {
   base::mutex_lock l(mu_);
-  leveldb::WriteBatch batch;
   int64_t current_index = length_;
-  std::string next_index = IndexToKey(length_ + entries.size());
+  DoWriteEntryList(current_index, entries);
+  return current_index;
+}
+
+bool BinLogger::WriteEntryList(int64_t index,
+                               const google::protobuf::RepeatedPtrField<mpr::chubby::Entry>& entries) {
+  base::mutex_lock l(mu_);
+  if (index > length_ || (index < first_index_ && first_index_ > 0)) {
+    LOG(ERROR) << "Can not write at " << index << ", log: [" << first_index_
+               << ", " << length_ << ")";
+    return false;
+  }
+  if (entries.size() == 0) {
+    return true;
+  }
+  DoWriteEntryList(index, entries);
+  return true;
+}
+
+void BinLogger::DoWriteEntryList(int64_t index,
+                                 const google::protobuf::RepeatedPtrField<mpr::chubby::Entry>& entries) {
+  leveldb::WriteBatch batch;
+  std::string next_index = IndexToKey(index + entries.size());
   for (int i = 0; i < entries.size(); i++) {
     LogEntry log_entry;
     std::string buf;
@@ -114,15 +164,16 @@ void BinLogger::AppendEntryList(const google::protobuf::RepeatedPtrField<mpr::ch
     log_entry.key = entries.Get(i).key();
     log_entry.value = entries.Get(i).value();
     log_entry.term = entries.Get(i).term();
+    log_entry.dedup_key = entries.Get(i).dedup_key();
     last_log_term_ =  log_entry.term;
     LogEntryToString(log_entry, &buf);
 
-    batch.Put(IndexToKey(current_index + i), buf);
+    batch.Put(IndexToKey(index + i), buf);
   }
   batch.Put(kLengthTag, next_index);
   leveldb::Status status = db_->Write(leveldb::WriteOptions(), &batch);
   DCHECK(status.ok());
-  length_ += entries.size();
+  length_ = index + entries.size();
 }
 
 void BinLogger::AppendEntry(const LogEntry& log_entry) {
@@ -147,20 +198,31 @@ void BinLogger::AppendEntry(const LogEntry& log_entry) {
   last_log_term_ = log_entry.term;
 }
 
-void BinLogger::Truncate(int64_t trunk_slot_index) {
+bool BinLogger::Truncate(int64_t trunk_slot_index) {
   if (trunk_slot_index < -1)
     trunk_slot_index = -1;
   
   base::mutex_lock l(mu_);
-  length_ = trunk_slot_index + 1;
+  if (first_index_ > 0 && trunk_slot_index < first_index_) {
+    // 回收的日志已经 apply, 截断它们说明调用者的状态有误, 不做任何修改
+    LOG(ERROR) << "Can not truncate to " << trunk_slot_index
+               << ", slots before " << first_index_ << " are removed";
+    return false;
+  }
   leveldb::Status status = db_->Put(leveldb::WriteOptions(),
-                                    kLengthTag, IndexToKey(length_));
-  DCHECK(status.ok());
+                                    kLengthTag, IndexToKey(trunk_slot_index + 1));
+  if (!status.ok()) {
+    LOG(ERROR) << "Failed to truncate to " << trunk_slot_index << ": "
+               << status.ToString();
+    return false;
+  }
+  length_ = trunk_slot_index + 1;
   if (length_ > 0) {
     LogEntry log_entry;
     DCHECK(ReadSlot(length_ - 1, &log_entry));
     last_log_term_ = log_entry.term;
   }
+  return true;
 }
 
 void BinLogger::GetLastLogIndexAndTerm(int64_t* log_index, int64_t* log_term) const {
@@ -169,6 +231,48 @@ void BinLogger::GetLastLogIndexAndTerm(int64_t* log_index, int64_t* log_term) co
   *log_term = last_log_term_;
 }
 
+int64_t BinLogger::FindFirstIndexOfTerm(int64_t term, int64_t upper) {
+  upper = std::min(upper, GetLength() - 1);
+  int64_t lo = GetFirstIndex(), hi = upper + 1;
+  if (lo > hi) {
+    return upper + 1;
+  }
+  while (lo < hi) {
+    int64_t mid = lo + (hi - lo) / 2;
+    LogEntry log_entry;
+    if (!ReadSlot(mid, &log_entry)) {
+      LOG(WARNING) << "Failed to read slot: " << mid;
+      return upper + 1;
+    }
+    if (log_entry.term >= term) {
+      hi = mid;
+    } else {
+      lo = mid + 1;
+    }
+  }
+  return lo;
+}
+
+int64_t BinLogger::FindLastIndexOfTerm(int64_t term, int64_t upper) {
+  upper = std::min(upper, GetLength() - 1);
+  const int64_t first_index = GetFirstIndex();
+  int64_t lo = first_index, hi = upper + 1;
+  while (lo < hi) {
+    int64_t mid = lo + (hi - lo) / 2;
+    LogEntry log_entry;
+    if (!ReadSlot(mid, &log_entry)) {
+      LOG(WARNING) << "Failed to read slot: " << mid;
+      return -1;
+    }
+    if (log_entry.term > term) {
+      hi = mid;
+    } else {
+      lo = mid + 1;
+    }
+  }
+  return lo > first_index ? lo - 1 : -1;
+}
+
 void BinLogger::LogEntryToString(const LogEntry& log_entry, std::string* buf) {
   DCHECK(buf != nullptr);
   int32_t total_len = sizeof(uint8_t)
@@ -176,6 +280,9 @@ void BinLogger::LogEntryToString(const LogEntry& log_entry, std::string* buf) {
                           + sizeof(int32_t) + log_entry.key.size()
                           + sizeof(int32_t) + log_entry.value.size()
                           + sizeof(int64_t);
+  if (!log_entry.dedup_key.empty()) {
+    total_len += sizeof(int32_t) + log_entry.dedup_key.size();
+  }
   buf->resize(total_len);
   int32_t user_size = log_entry.user.size();
   int32_t key_size = log_entry.key.size();
@@ -196,6 +303,13 @@ void BinLogger::LogEntryToString(const LogEntry& log_entry, std::string* buf) {
   memcpy(p, static_cast<const void*>(log_entry.value.data()), log_entry.value.size());
   p += log_entry.value.size();
   memcpy(p, static_cast<const void*>(&log_entry.term), sizeof(int64_t));
+  p += sizeof(int64_t);
+  if (!log_entry.dedup_key.empty()) {
+    int32_t dedup_key_size = log_entry.dedup_key.size();
+    memcpy(p, static_cast<const void*>(&dedup_key_size), sizeof(int32_t));
+    p += sizeof(int32_t);
+    memcpy(p, static_cast<const void*>(log_entry.dedup_key.data()), dedup_key_size);
+  }
 }
 
 void BinLogger::StringToLogEntry(const std::string& buf, LogEntry* log_entry) {
@@ -224,6 +338,14 @@ void BinLogger::StringToLogEntry(const std::string& buf, LogEntry* log_entry) {
   memcpy(static_cast<void*>(&log_entry->value[0]), p, value_size);
   p += value_size;
   memcpy(static_cast<void*>(&log_entry->term), p , sizeof(int64_t));
+  p += sizeof(int64_t);
+  log_entry->dedup_key.clear();
+  if (p + sizeof(int32_t) <= buf.data() + buf.size()) {
+    int32_t dedup_key_size = 0;
+    memcpy(static_cast<void*>(&dedup_key_size), p, sizeof(int32_t));
+    p += sizeof(int32_t);
+    log_entry->dedup_key.assign(p, dedup_key_size);
+  }
 }
 
 // static
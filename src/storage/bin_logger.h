@@ -21,6 +21,8 @@ struct LogEntry {
     std::string key;
     std::string value;
     int64_t term;
+    // 为空时不编码, 与之前的格式兼容
+    std::string dedup_key;
     LogEntry() : log_operation(kNop), user("") {}
 };
 
@@ -32,6 +34,8 @@ class BinLogger {
     bool compress;
     int32_t block_size;
     int32_t write_buffer_size;
+    // 为空时使用磁盘, 模拟器中使用 leveldb::NewMemEnv
+    leveldb::Env* env;
     
     static const int32_t kDefaultBlockSize = 32748;
     static const int32_t kDefaultWriteBufferSize = 33554432;
@@ -42,22 +46,48 @@ class BinLogger {
       : db_path(db),
         compress(c),
         block_size(bs),
-        write_buffer_size(wbs) {}
+        write_buffer_size(wbs),
+        env(nullptr) {}
   };
 
   explicit BinLogger(const Options& options);
   ~BinLogger();
 
   int64_t GetLength() const;
+  // 第一条保留的日志, 之前的已经被 RemoveSlotBefore 回收. 日志为空时等于
+  // GetLength().
+  int64_t GetFirstIndex() const;
   bool ReadSlot(int64_t slot_index, LogEntry* log_entry);
   void AppendEntry(const LogEntry& log_entry);
-  void Truncate(int64_t truncate_slot_index);
-  void AppendEntryList(const ::google::protobuf::RepeatedPtrField<mpr::chubby::Entry>& entries);
+  // 保留 [0, truncate_slot_index]. 要截断 GetFirstIndex() 之前 (不含) 的日志
+  // 或者写入失败时返回 false, 日志不变
+  bool Truncate(int64_t truncate_slot_index);
+  // 返回第一条日志的 index
+  int64_t AppendEntryList(const ::google::protobuf::RepeatedPtrField<mpr::chubby::Entry>& entries);
+  // 从 index 开始写入, 原来 index 之后的日志被替换, 截断和写入在同一个
+  // WriteBatch 中. index 超过日志长度或者在已经回收的部分时返回 false.
+  bool WriteEntryList(int64_t index,
+                      const ::google::protobuf::RepeatedPtrField<mpr::chubby::Entry>& entries);
+  // 只能回收第一条保留的日志, 保持日志连续; 其他 slot 返回 false
   bool RemoveSlot(int64_t slot_index);
+  // 回收 slot_gc_index 之前的日志, 最后一条日志总是保留 (重启时用它恢复
+  // last_log_term). 返回是否回收了日志.
+  //
+  // 目前没有快照: next_index 落在已回收部分的 follower (包括之后加入的
+  // learner) 无法再追上, Replicator 只会反复报错. 调用者只能回收所有副本
+  // 都已经复制并 apply 的日志; 服务端目前没有调用 GC.
   bool RemoveSlotBefore(int64_t slot_gc_index);
   
   void GetLastLogIndexAndTerm(int64_t* last_log_index, int64_t* last_log_term) const;
 
+  // 日志的 term 单调不减, 以下两个函数在 [GetFirstIndex(), upper] 内二分
+  // 查找, 读取 O(log n) 个 slot. upper 超出日志长度时按日志末尾计算. 已经
+  // 回收的日志不参与查找.
+  // 第一条 term >= term 的保留日志, 不存在时返回 upper + 1
+  int64_t FindFirstIndexOfTerm(int64_t term, int64_t upper);
+  // 最后一条 term <= term 的保留日志, 不存在时返回 -1
+  int64_t FindLastIndexOfTerm(int64_t term, int64_t upper);
+
 
   void LogEntryToString(const LogEntry& log_entry, std::string* result);
   void StringToLogEntry(const std::string& buf, LogEntry* result);
@@ -67,7 +97,11 @@ class BinLogger {
   static int64_t KeyToIndex(const std::string& key);
 
  private:
+  void DoWriteEntryList(int64_t index,
+                        const ::google::protobuf::RepeatedPtrField<mpr::chubby::Entry>& entries);
+
   std::unique_ptr<leveldb::DB> db_;
+  int64_t first_index_;
   int64_t length_;
   int64_t last_log_term_;
   mutable base::mutex mu_;
@@ -1,4 +1,5 @@
 #include "storage/bin_logger.h"
+#include "base/platform/env.h"
 #include <gtest/gtest.h>
 
 namespace mpr {
@@ -23,6 +24,28 @@ TEST(BinLogger, LogEntryConvert) {
   EXPECT_EQ(log_entry.log_operation, log_entry2.log_operation);
 }
 
+TEST(BinLogger, LogEntryDedupKey) {
+  BinLogger bin_logger(BinLogger::Options("/tmp/"));
+  LogEntry log_entry, log_entry2;
+  log_entry.log_operation = kPut;
+  log_entry.key = "abc";
+  log_entry.term = 2;
+  log_entry.dedup_key = std::string("s1\0r7", 5);
+  std::string buf;
+  bin_logger.LogEntryToString(log_entry, &buf);
+  EXPECT_EQ(buf.size(), 33u); //#1+4+0+4+3+4+0+8+4+5
+  log_entry2.dedup_key = "stale";
+  bin_logger.StringToLogEntry(buf, &log_entry2);
+  EXPECT_EQ(log_entry.dedup_key, log_entry2.dedup_key);
+  EXPECT_EQ(log_entry.term, log_entry2.term);
+
+  // 没有 dedup_key 的旧格式
+  log_entry.dedup_key.clear();
+  bin_logger.LogEntryToString(log_entry, &buf);
+  bin_logger.StringToLogEntry(buf, &log_entry2);
+  EXPECT_TRUE(log_entry2.dedup_key.empty());
+}
+
 TEST(BinLogger, SlotWrite) {
   BinLogger bin_logger(BinLogger::Options("/tmp/"));
   char key_buf[1024] = {'\0'};
@@ -73,6 +96,122 @@ TEST(BinLogger, SlotRead) {
   }
 }
 
+TEST(BinLogger, FindTermBoundaries) {
+  base::int64 undeleted_files, undeleted_dirs;
+  base::Env::Default()->DeleteDirectoryRecursively("/tmp/bin_logger_term_test",
+                                                   &undeleted_files, &undeleted_dirs);
+  BinLogger bin_logger(BinLogger::Options("/tmp/bin_logger_term_test"));
+  // term: 1 1 1 3 3 4 4 4 4 6
+  const int64_t terms[] = {1, 1, 1, 3, 3, 4, 4, 4, 4, 6};
+  for (int64_t term : terms) {
+    LogEntry log_entry;
+    log_entry.term = term;
+    bin_logger.AppendEntry(log_entry);
+  }
+  EXPECT_EQ(0, bin_logger.FindFirstIndexOfTerm(1, 9));
+  EXPECT_EQ(3, bin_logger.FindFirstIndexOfTerm(3, 9));
+  EXPECT_EQ(5, bin_logger.FindFirstIndexOfTerm(4, 7));
+  EXPECT_EQ(9, bin_logger.FindFirstIndexOfTerm(5, 9));
+  EXPECT_EQ(8, bin_logger.FindFirstIndexOfTerm(5, 7));
+  EXPECT_EQ(10, bin_logger.FindFirstIndexOfTerm(7, 100));
+
+  EXPECT_EQ(2, bin_logger.FindLastIndexOfTerm(2, 9));
+  EXPECT_EQ(8, bin_logger.FindLastIndexOfTerm(4, 9));
+  EXPECT_EQ(6, bin_logger.FindLastIndexOfTerm(4, 6));
+  EXPECT_EQ(9, bin_logger.FindLastIndexOfTerm(6, 100));
+  EXPECT_EQ(-1, bin_logger.FindLastIndexOfTerm(0, 9));
+}
+
+TEST(BinLogger, WriteEntryListAtIndex) {
+  const std::string path = "/tmp/bin_logger_write_test";
+  base::int64 undeleted_files, undeleted_dirs;
+  base::Env::Default()->DeleteDirectoryRecursively(path, &undeleted_files,
+                                                   &undeleted_dirs);
+  BinLogger bin_logger{BinLogger::Options(path)};
+  ::google::protobuf::RepeatedPtrField<Entry> entries;
+  for (int i = 0; i < 3; ++i) {
+    Entry* entry = entries.Add();
+    entry->set_term(1);
+    entry->set_key("a" + std::to_string(i));
+  }
+  EXPECT_TRUE(bin_logger.WriteEntryList(0, entries));
+  // 重复的写入覆盖同样的位置
+  EXPECT_TRUE(bin_logger.WriteEntryList(1, entries));
+  EXPECT_EQ(4, bin_logger.GetLength());
+  // 超过末尾
+  EXPECT_FALSE(bin_logger.WriteEntryList(5, entries));
+
+  entries.Mutable(0)->set_term(2);
+  entries.Mutable(0)->set_key("b");
+  entries.RemoveLast();
+  entries.RemoveLast();
+  EXPECT_TRUE(bin_logger.WriteEntryList(2, entries));
+  EXPECT_EQ(3, bin_logger.GetLength());
+  int64_t last_index, last_term;
+  bin_logger.GetLastLogIndexAndTerm(&last_index, &last_term);
+  EXPECT_EQ(2, last_index);
+  EXPECT_EQ(2, last_term);
+  LogEntry log_entry;
+  ASSERT_TRUE(bin_logger.ReadSlot(1, &log_entry));
+  EXPECT_EQ("a0", log_entry.key);
+  ASSERT_TRUE(bin_logger.ReadSlot(2, &log_entry));
+  EXPECT_EQ("b", log_entry.key);
+}
+
+TEST(BinLogger, RemoveSlotBefore) {
+  const std::string path = "/tmp/bin_logger_gc_test";
+  base::int64 undeleted_files, undeleted_dirs;
+  base::Env::Default()->DeleteDirectoryRecursively(path, &undeleted_files,
+                                                   &undeleted_dirs);
+  {
+    BinLogger bin_logger{BinLogger::Options(path)};
+    // term: 1 1 1 3 3 4 4 4 4 6
+    const int64_t terms[] = {1, 1, 1, 3, 3, 4, 4, 4, 4, 6};
+    for (int64_t term : terms) {
+      LogEntry log_entry;
+      log_entry.term = term;
+      bin_logger.AppendEntry(log_entry);
+    }
+    EXPECT_EQ(0, bin_logger.GetFirstIndex());
+    // 只能从头回收
+    EXPECT_FALSE(bin_logger.RemoveSlot(3));
+    EXPECT_TRUE(bin_logger.RemoveSlot(0));
+    EXPECT_TRUE(bin_logger.RemoveSlotBefore(4));
+    EXPECT_FALSE(bin_logger.RemoveSlotBefore(2));
+    EXPECT_EQ(4, bin_logger.GetFirstIndex());
+    EXPECT_EQ(10, bin_logger.GetLength());
+    LogEntry log_entry;
+    EXPECT_FALSE(bin_logger.ReadSlot(3, &log_entry));
+    EXPECT_TRUE(bin_logger.ReadSlot(4, &log_entry));
+
+    // 查找从第一条保留的日志开始
+    EXPECT_EQ(4, bin_logger.FindFirstIndexOfTerm(1, 9));
+    EXPECT_EQ(4, bin_logger.FindFirstIndexOfTerm(3, 9));
+    EXPECT_EQ(5, bin_logger.FindFirstIndexOfTerm(4, 9));
+    EXPECT_EQ(3, bin_logger.FindFirstIndexOfTerm(4, 2));
+    EXPECT_EQ(4, bin_logger.FindLastIndexOfTerm(3, 9));
+    EXPECT_EQ(8, bin_logger.FindLastIndexOfTerm(5, 9));
+    EXPECT_EQ(-1, bin_logger.FindLastIndexOfTerm(2, 9));
+
+    // 最后一条日志总是保留
+    EXPECT_TRUE(bin_logger.RemoveSlotBefore(100));
+    EXPECT_EQ(9, bin_logger.GetFirstIndex());
+  }
+
+  BinLogger reopened{BinLogger::Options(path)};
+  EXPECT_EQ(9, reopened.GetFirstIndex());
+  EXPECT_EQ(10, reopened.GetLength());
+  int64_t last_index, last_term;
+  reopened.GetLastLogIndexAndTerm(&last_index, &last_term);
+  EXPECT_EQ(6, last_term);
+
+  // 不会截断已经回收的日志
+  EXPECT_FALSE(reopened.Truncate(5));
+  EXPECT_EQ(9, reopened.GetFirstIndex());
+  EXPECT_EQ(10, reopened.GetLength());
+  EXPECT_TRUE(reopened.Truncate(9));
+  EXPECT_EQ(10, reopened.GetLength());
+}
 
 #if 0
 TEST(BinLogger, SlotTruncate) {
@@ -0,0 +1,169 @@
+#include "storage/bulk_loader.h"
+
+#include <map>
+
+#include "base/coding.h"
+#include "base/errors.h"
+#include "base/logging.h"
+#include "base/io/inputbuffer.h"
+#include "base/io/path.h"
+#include "base/io/table/table_builder.h"
+#include "base/platform/env.h"
+
+namespace mpr {
+namespace chubby {
+
+namespace {
+
+const size_t kDumpReadBufferSize = 1 << 20;
+
+base::Status FlushTable(const std::map<std::string, std::string>& sorted,
+                        const std::string& output_dir,
+                        const std::string& prefix,
+                        const BulkLoadOptions& options,
+                        std::vector<std::string>* table_files) {
+  std::string fname = base::io::JoinPath(output_dir,
+      prefix + "-" + std::to_string(table_files->size()) + ".table");
+  std::unique_ptr<base::WritableFile> file;
+  RETURN_IF_ERROR(base::Env::Default()->NewWritableFile(fname, &file));
+
+  base::table::TableBuilder builder(options.table_options, file.get());
+  for (const auto& kv : sorted) {
+    builder.Add(kv.first, kv.second);
+  }
+  base::Status status = builder.Finish();
+  if (status.ok()) {
+    status = file->Close();
+  }
+  if (!status.ok()) {
+    return status;
+  }
+  LOG(INFO) << "[BulkLoad] " << fname << ": " << builder.NumEntries()
+            << " entries, " << builder.FileSize() << " bytes";
+  table_files->push_back(fname);
+  return base::Status::OK();
+}
+
+} // namespace
+
+void AppendDumpRecord(const std::string& key, const std::string& value,
+                      std::string* dst) {
+  base::PutVarint32(dst, key.size());
+  dst->append(key);
+  base::PutVarint32(dst, value.size());
+  dst->append(value);
+}
+
+base::Status BuildTablesFromDump(const std::string& dump_path,
+                                 const std::string& output_dir,
+                                 const std::string& prefix,
+                                 const BulkLoadOptions& options,
+                                 std::vector<std::string>* table_files) {
+  if (table_files == nullptr) {
+    return base::errors::InvalidArgument("table_files == nullptr");
+  }
+  base::Status status = base::Env::Default()->CreateDirectoryRecursively(output_dir);
+  if (!status.ok() && status.code() != base::error::ALREADY_EXISTS) {
+    return status;
+  }
+
+  std::unique_ptr<base::RandomAccessFile> file;
+  RETURN_IF_ERROR(base::Env::Default()->NewRandomAccessFile(dump_path, &file));
+  base::io::InputBuffer input(file.get(), kDumpReadBufferSize);
+
+  // 同一张表内后出现的 key 覆盖前面的, 与逐条 Put 的语义一致.
+  std::map<std::string, std::string> sorted;
+  size_t pending_bytes = 0;
+  std::string key;
+  std::string value;
+  while (true) {
+    base::uint32 key_size = 0;
+    base::uint32 value_size = 0;
+    status = input.ReadVarint32(&key_size);
+    if (status.code() == base::error::OUT_OF_RANGE) {
+      break;
+    }
+    RETURN_IF_ERROR(status);
+    RETURN_IF_ERROR(input.ReadNBytes(key_size, &key));
+    RETURN_IF_ERROR(input.ReadVarint32(&value_size));
+    RETURN_IF_ERROR(input.ReadNBytes(value_size, &value));
+
+    pending_bytes += key.size() + value.size();
+    sorted[key].swap(value);
+    if (pending_bytes >= options.max_table_bytes) {
+      RETURN_IF_ERROR(FlushTable(sorted, output_dir, prefix, options, table_files));
+      sorted.clear();
+      pending_bytes = 0;
+    }
+  }
+  if (!sorted.empty()) {
+    RETURN_IF_ERROR(FlushTable(sorted, output_dir, prefix, options, table_files));
+  }
+  return base::Status::OK();
+}
+
+base::Status MakeIngestTables(const std::string& ingest_dir,
+                              const std::vector<std::string>& table_files,
+                              std::vector<IngestTable>* tables) {
+  if (tables == nullptr) {
+    return base::errors::InvalidArgument("tables == nullptr");
+  }
+  std::string dir = base::io::CleanPath(ingest_dir);
+  if (dir.empty() || dir.back() != '/') {
+    dir.push_back('/');
+  }
+  tables->clear();
+  for (const auto& fname : table_files) {
+    const std::string path = base::io::CleanPath(fname);
+    if (path.compare(0, dir.size(), dir) != 0) {
+      return base::errors::InvalidArgument(fname, " is not under ", ingest_dir);
+    }
+    IngestTable table;
+    table.name = path.substr(dir.size());
+    base::uint64 size = 0;
+    RETURN_IF_ERROR(base::Env::Default()->GetFileSize(path, &size));
+    table.size = size;
+    tables->push_back(std::move(table));
+  }
+  return base::Status::OK();
+}
+
+std::string EncodeIngestTables(const std::vector<IngestTable>& tables) {
+  std::string payload;
+  base::PutVarint32(&payload, tables.size());
+  for (const auto& table : tables) {
+    base::PutVarint32(&payload, table.name.size());
+    payload.append(table.name);
+    base::PutVarint64(&payload, table.size);
+  }
+  return payload;
+}
+
+bool DecodeIngestTables(const std::string& payload,
+                        std::vector<IngestTable>* tables) {
+  base::StringPiece input(payload);
+  base::uint32 count = 0;
+  if (!base::GetVarint32(&input, &count)) {
+    return false;
+  }
+  tables->clear();
+  for (base::uint32 i = 0; i < count; ++i) {
+    base::uint32 size = 0;
+    if (!base::GetVarint32(&input, &size) || input.size() < size) {
+      return false;
+    }
+    IngestTable table;
+    table.name.assign(input.data(), size);
+    input.remove_prefix(size);
+    base::uint64 file_size = 0;
+    if (!base::GetVarint64(&input, &file_size)) {
+      return false;
+    }
+    table.size = file_size;
+    tables->push_back(std::move(table));
+  }
+  return input.empty();
+}
+
+} // namespace chubby
+} // namespace mpr
@@ -0,0 +1,61 @@
+#ifndef MPR_CHUBBY_STORAGE_BULK_LOADER_H_
+#define MPR_CHUBBY_STORAGE_BULK_LOADER_H_
+
+#include <string>
+#include <vector>
+
+#include "base/status.h"
+#include "base/io/table/table_options.h"
+
+namespace mpr {
+namespace chubby {
+
+// Bulk load
+//
+// 离线工具把 key/value dump 排序后用 base::table::TableBuilder 写成若干张表,
+// 放在所有副本都能读到的导入目录 (共享存储) 下, 然后通过一条 kIngest 日志
+// (user: namespace, value: EncodeIngestTables()) 让所有副本调用
+// Database::Ingest() 原子替换该 namespace. 日志中只有表相对于导入目录的路径
+// 和大小, 各副本的导入目录可以挂载在不同的位置.
+//
+// Dump format:
+// <varint32 key_len> <key> <varint32 value_len> <value>
+// ...
+struct BulkLoadOptions {
+  // 单张表在内存中排序的最大字节数, 超过后切分到下一张表.
+  size_t max_table_bytes = 64 * 1024 * 1024;
+  base::table::Options table_options;
+};
+
+void AppendDumpRecord(const std::string& key, const std::string& value,
+                      std::string* dst);
+
+// 读取 dump_path, 在 output_dir 下生成 <prefix>-<n>.table. 不同表之间的 key
+// 可能重叠, Ingest 时后面的表覆盖前面的.
+base::Status BuildTablesFromDump(const std::string& dump_path,
+                                 const std::string& output_dir,
+                                 const std::string& prefix,
+                                 const BulkLoadOptions& options,
+                                 std::vector<std::string>* table_files);
+
+// kIngest 引用的一张表
+struct IngestTable {
+  // 相对于导入目录的路径, 不能是绝对路径, 也不能包含 ".."
+  std::string name;
+  // 导入前检查, 确认各副本读到的是同一个文件
+  uint64_t size = 0;
+};
+
+// ingest_dir 下的表文件转为 kIngest 的引用, 表不在 ingest_dir 之内时返回
+// InvalidArgument
+base::Status MakeIngestTables(const std::string& ingest_dir,
+                              const std::vector<std::string>& table_files,
+                              std::vector<IngestTable>* tables);
+
+std::string EncodeIngestTables(const std::vector<IngestTable>& tables);
+bool DecodeIngestTables(const std::string& payload,
+                        std::vector<IngestTable>* tables);
+
+} // namespace chubby
+} // namespace mpr
+#endif // MPR_CHUBBY_STORAGE_BULK_LOADER_H_
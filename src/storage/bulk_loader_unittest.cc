@@ -0,0 +1,148 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
+
+#include "storage/bulk_loader.h"
+#include "storage/database.h"
+#include "base/errors.h"
+#include "base/status_test_util.h"
+#include "base/io/path.h"
+#include "base/platform/env.h"
+
+namespace mpr {
+namespace chubby {
+
+namespace {
+
+std::string WriteDump(const std::string& fname, int begin, int end) {
+  std::string dump;
+  for (int i = begin; i < end; ++i) {
+    AppendDumpRecord("key" + std::to_string(i), "value" + std::to_string(i), &dump);
+  }
+  EXPECT_TRUE(base::WriteStringToFile(base::Env::Default(), fname, dump).ok());
+  return fname;
+}
+
+} // namespace
+
+TEST(BulkLoader, EncodeDecodeTables) {
+  std::vector<IngestTable> tables(3);
+  tables[0].name = "a.table";
+  tables[0].size = 1;
+  tables[2].name = "bulk/b.table";
+  tables[2].size = 1ull << 40;
+  std::vector<IngestTable> result;
+  EXPECT_TRUE(DecodeIngestTables(EncodeIngestTables(tables), &result));
+  ASSERT_EQ(tables.size(), result.size());
+  for (size_t i = 0; i < tables.size(); ++i) {
+    EXPECT_EQ(tables[i].name, result[i].name);
+    EXPECT_EQ(tables[i].size, result[i].size);
+  }
+  EXPECT_FALSE(DecodeIngestTables(EncodeIngestTables(tables) + "x", &result));
+  EXPECT_FALSE(DecodeIngestTables("\x05", &result));
+}
+
+TEST(BulkLoader, BuildAndIngest) {
+  const std::string dir = "/tmp/bulk_loader_test";
+  base::int64 undeleted_files, undeleted_dirs;
+  base::Env::Default()->DeleteDirectoryRecursively(dir, &undeleted_files, &undeleted_dirs);
+  MPR_EXPECT_OK(base::Env::Default()->CreateDirectoryRecursively(dir));
+
+  std::string dump = WriteDump(base::io::JoinPath(dir, "dump"), 0, 1000);
+  BulkLoadOptions options;
+  options.max_table_bytes = 4096;
+  std::vector<std::string> table_files;
+  MPR_EXPECT_OK(BuildTablesFromDump(dump, base::io::JoinPath(dir, "tables"),
+                                    "t", options, &table_files));
+  EXPECT_GT(table_files.size(), 1u);
+  std::vector<IngestTable> tables;
+  MPR_EXPECT_OK(MakeIngestTables(dir, table_files, &tables));
+  ASSERT_EQ(table_files.size(), tables.size());
+  EXPECT_EQ("tables/t-0.table", tables[0].name);
+  EXPECT_TRUE(base::errors::IsInvalidArgument(
+      MakeIngestTables(base::io::JoinPath(dir, "other"), table_files, &tables)));
+  MPR_EXPECT_OK(MakeIngestTables(dir, table_files, &tables));
+
+  Database database(base::io::JoinPath(dir, "db"));
+  EXPECT_TRUE(database.Open("user1"));
+  MPR_EXPECT_OK(database.Put("user1", "stale", "value"));
+  MPR_EXPECT_OK(database.Ingest("user1", dir, tables));
+
+  std::string value;
+  for (int i = 0; i < 1000; ++i) {
+    MPR_EXPECT_OK(database.Get("user1", "key" + std::to_string(i), &value));
+    EXPECT_EQ("value" + std::to_string(i), value);
+  }
+  EXPECT_EQ(base::error::NOT_FOUND, database.Get("user1", "stale", &value).code());
+
+  // 未打开过的 namespace 也可以直接导入
+  MPR_EXPECT_OK(database.Ingest("user2", dir, tables));
+  MPR_EXPECT_OK(database.Get("user2", "key999", &value));
+  EXPECT_EQ("value999", value);
+
+  // 重试也不会成功的错误, 保留原有数据
+  IngestTable bad;
+  bad.name = "missing";
+  EXPECT_TRUE(base::errors::IsNotFound(database.Ingest("user1", dir, {bad})));
+  bad = tables[0];
+  bad.size++;
+  EXPECT_TRUE(base::errors::IsDataLoss(database.Ingest("user1", dir, {bad})));
+  bad.name = "dump";
+  base::uint64 dump_size = 0;
+  MPR_EXPECT_OK(base::Env::Default()->GetFileSize(
+      base::io::JoinPath(dir, "dump"), &dump_size));
+  bad.size = dump_size;
+  EXPECT_TRUE(base::errors::IsDataLoss(database.Ingest("user1", dir, {bad})));
+  bad.name = "../bulk_loader_test/dump";
+  EXPECT_TRUE(base::errors::IsInvalidArgument(database.Ingest("user1", dir, {bad})));
+  bad.name = base::io::JoinPath(dir, "dump");
+  EXPECT_TRUE(base::errors::IsInvalidArgument(database.Ingest("user1", dir, {bad})));
+  MPR_EXPECT_OK(database.Get("user1", "key1", &value));
+  database.Close("user1");
+  database.Close("user2");
+}
+
+// Ingest 等到正在使用的 Iterator 释放后才切换 DB
+TEST(BulkLoader, IngestWaitsForIterators) {
+  const std::string dir = "/tmp/bulk_loader_iterator_test";
+  base::int64 undeleted_files, undeleted_dirs;
+  base::Env::Default()->DeleteDirectoryRecursively(dir, &undeleted_files, &undeleted_dirs);
+  MPR_EXPECT_OK(base::Env::Default()->CreateDirectoryRecursively(dir));
+  std::string dump = WriteDump(base::io::JoinPath(dir, "dump"), 0, 10);
+  std::vector<std::string> table_files;
+  MPR_EXPECT_OK(BuildTablesFromDump(dump, base::io::JoinPath(dir, "tables"), "t",
+                                    BulkLoadOptions(), &table_files));
+  std::vector<IngestTable> tables;
+  MPR_EXPECT_OK(MakeIngestTables(dir, table_files, &tables));
+
+  Database database(base::io::JoinPath(dir, "db"));
+  EXPECT_TRUE(database.Open("user1"));
+  MPR_EXPECT_OK(database.Put("user1", "old", "value"));
+  std::unique_ptr<Database::Iterator> it(database.NewIterator("user1"));
+  ASSERT_TRUE(it != nullptr);
+  std::atomic<bool> done(false);
+  std::thread ingest([&database, &dir, &tables, &done]() {
+    MPR_EXPECT_OK(database.Ingest("user1", dir, tables));
+    done = true;
+  });
+  base::Env::Default()->SleepForMicroseconds(100 * 1000);
+  EXPECT_FALSE(done);
+  // 旧的 DB 仍然可以读
+  it->Seek("");
+  ASSERT_TRUE(it->Valid());
+  EXPECT_EQ("old", it->key());
+  it.reset();
+  ingest.join();
+  EXPECT_TRUE(done);
+
+  it.reset(database.NewIterator("user1"));
+  ASSERT_TRUE(it != nullptr);
+  it->Seek("");
+  ASSERT_TRUE(it->Valid());
+  EXPECT_EQ("key0", it->key());
+  it.reset();
+  database.Close("user1");
+}
+
+} // namespace chubby
+} // namespace mpr
@@ -4,8 +4,12 @@
 #include "base/errors.h"
 #include "base/io/path.h"
 #include "base/gtl/map_util.h"
+#include "base/io/table/table.h"
+#include "base/io/table/table_options.h"
 
 #include <gflags/gflags.h>
+#include <leveldb/env.h>
+#include <leveldb/write_batch.h>
 
 DECLARE_bool(chubby_data_compress);
 DECLARE_int32(chubby_data_block_size);
@@ -14,9 +18,93 @@ DECLARE_int32(chubby_data_write_buffer_size);
 namespace mpr {
 namespace chubby {
 
+namespace {
+
+const std::string kIngestSuffix = "#ingest";
+const std::string kRetiredSuffix = "#retired";
+const size_t kIngestBatchBytes = 4 * 1024 * 1024;
+
+base::Status FromLevelDB(const leveldb::Status& status) {
+  if (status.ok()) {
+    return base::Status::OK();
+  } else if (status.IsNotFound()) {
+    return base::errors::NotFound("leveldb: " + status.ToString());
+  }
+  return base::errors::Internal("leveldb: " + status.ToString());
+}
+
+// 通过 leveldb::Env 读取的表文件
+class TableFile : public base::RandomAccessFile {
+ public:
+  explicit TableFile(leveldb::RandomAccessFile* file) : file_(file) {}
+
+  base::Status Read(base::uint64 offset, size_t n, base::StringPiece* result,
+                    char* scratch) const override {
+    leveldb::Slice slice;
+    leveldb::Status status = file_->Read(offset, n, &slice, scratch);
+    *result = base::StringPiece(slice.data(), slice.size());
+    return FromLevelDB(status);
+  }
+
+ private:
+  std::unique_ptr<leveldb::RandomAccessFile> file_;
+};
+
+// leveldb 的目录是平的, 逐个删除其中的文件
+void RemoveDBDirectory(leveldb::Env* env, const std::string& path) {
+  std::vector<std::string> children;
+  if (!env->GetChildren(path, &children).ok()) {
+    return;
+  }
+  for (const auto& child : children) {
+    if (child != "." && child != "..") {
+      env->DeleteFile(base::io::JoinPath(path, child));
+    }
+  }
+  leveldb::Status status = env->DeleteDir(path);
+  LOG_IF(WARNING, !status.ok()) << "Failed to remove " << path << ": "
+                                << status.ToString();
+}
+
+// 逐个文件移动, 对不支持目录改名的 Env (例如 leveldb::NewMemEnv) 也有效.
+// 中途失败时 kIngest 重新 apply 会从头再做一次.
+leveldb::Status MoveDBDirectory(leveldb::Env* env, const std::string& from,
+                                const std::string& to) {
+  std::vector<std::string> children;
+  leveldb::Status status = env->GetChildren(from, &children);
+  if (!status.ok()) {
+    return status;
+  }
+  env->CreateDir(to);
+  for (const auto& child : children) {
+    if (child == "." || child == "..") {
+      continue;
+    }
+    status = env->RenameFile(base::io::JoinPath(from, child),
+                             base::io::JoinPath(to, child));
+    if (!status.ok()) {
+      return status;
+    }
+  }
+  env->DeleteDir(from);
+  return leveldb::Status::OK();
+}
+
+} // namespace
+
 const std::string Database::kAnonymousUser = "";
 
 // Iterator
+Database::Iterator::Iterator(Database* database, const std::string& name,
+                             leveldb::DB* db, const leveldb::ReadOptions& options)
+  : database_(database), name_(name), iterator_(db->NewIterator(options)) {}
+
+Database::Iterator::~Iterator() {
+  // 先于 DB 释放
+  iterator_.reset(nullptr);
+  database_->ReleaseIterator(name_);
+}
+
 std::string Database::Iterator::key() const {
   return iterator_ ? iterator_->key().ToString() : "";
 }
@@ -54,10 +142,13 @@ base::Status Database::Iterator::status() const {
 }
 
 //
-Database::Database(const std::string& db_path) : db_path_(db_path) {
+Database::Database(const std::string& db_path, leveldb::Env* env)
+  : db_path_(db_path), env_(env) {
 
-  base::Status status = base::Env::Default()->CreateDirectory(db_path_);
-  DCHECK(status.ok() || status.code() == base::error::ALREADY_EXISTS) << status.ToString(); 
+  if (env_ == nullptr) {
+    base::Status status = base::Env::Default()->CreateDirectory(db_path_);
+    DCHECK(status.ok() || status.code() == base::error::ALREADY_EXISTS) << status.ToString(); 
+  }
   std::unique_ptr<leveldb::DB> db;
   DoOpenDB(&db);
   db_map_[""] = std::move(db);  
@@ -83,12 +174,16 @@ bool Database::Open(const std::string& name) {
 
 void Database::Close(const std::string& name) {
   base::mutex_lock l(mu_);
-  auto it = db_map_.find(name);
-  if (it == db_map_.end()) {
+  if (db_map_.find(name) == db_map_.end()) {
     return;
   }
-  it->second.reset(nullptr);
-  db_map_.erase(it);
+  DoDrainIterators(name, &l);
+  auto it = db_map_.find(name);
+  if (it != db_map_.end()) {
+    it->second.reset(nullptr);
+    db_map_.erase(it);
+  }
+  DoEndDrain(name);
 }
 
 base::Status Database::Get(const std::string& name,
@@ -143,18 +238,183 @@ base::Status Database::Delete(const std::string& name,
   return base::errors::Internal("leveldb: " + status.ToString());
 }
 
+base::Status Database::Write(const std::string& name,
+                             leveldb::WriteBatch* batch) {
+  base::mutex_lock l(mu_);
+  auto it = db_map_.find(name);
+  if (it == db_map_.end()) {
+    LOG(WARNING) << "[WRITE] Not existed: " << name;
+    return base::errors::NotFound("Not found db name: ", name);
+  }
+  leveldb::Status status = it->second->Write(leveldb::WriteOptions(), batch);
+  if (status.ok()) {
+    return base::Status::OK();
+  }
+  return base::errors::Internal("leveldb: " + status.ToString());
+}
+
+base::Status Database::Ingest(const std::string& name, const std::string& table_dir,
+                              const std::vector<IngestTable>& tables) {
+  for (const auto& table : tables) {
+    if (table.name.empty() || base::io::IsAbsolutePath(table.name) ||
+        ("/" + table.name + "/").find("/../") != std::string::npos) {
+      return base::errors::InvalidArgument("bad ingest table name: ", table.name);
+    }
+  }
+  leveldb::Env* env = DoGetEnv();
+  const std::string live_path = DoGetDBPath(name);
+  const std::string staging_path = DoGetDBPath(name + kIngestSuffix);
+  const std::string retired_path = DoGetDBPath(name + kRetiredSuffix);
+
+  // 上次失败的导入可能留下目录
+  RemoveDBDirectory(env, staging_path);
+  RemoveDBDirectory(env, retired_path);
+
+  std::unique_ptr<leveldb::DB> db;
+  DoOpenDB(&db, name + kIngestSuffix);
+  for (const auto& table : tables) {
+    base::Status status = DoLoadTable(
+        db.get(), base::io::JoinPath(table_dir, table.name), table.size);
+    if (!status.ok()) {
+      db.reset(nullptr);
+      RemoveDBDirectory(env, staging_path);
+      return status;
+    }
+  }
+  db.reset(nullptr);
+
+  {
+    base::mutex_lock l(mu_);
+    // 正在使用的 Iterator 引用着旧的 DB
+    DoDrainIterators(name, &l);
+    auto it = db_map_.find(name);
+    if (it != db_map_.end()) {
+      it->second.reset(nullptr);
+    }
+    std::vector<std::string> children;
+    const bool had_live = env->GetChildren(live_path, &children).ok();
+    base::Status status;
+    if (had_live) {
+      status = FromLevelDB(MoveDBDirectory(env, live_path, retired_path));
+    }
+    if (status.ok()) {
+      status = FromLevelDB(MoveDBDirectory(env, staging_path, live_path));
+      if (!status.ok() && had_live) {
+        RemoveDBDirectory(env, live_path);
+        MoveDBDirectory(env, retired_path, live_path);
+      }
+    }
+    if (it != db_map_.end() || status.ok()) {
+      DoOpenDB(&db, name);
+      db_map_[name] = std::move(db);
+    }
+    DoEndDrain(name);
+    if (!status.ok()) {
+      LOG(WARNING) << "[INGEST] Failed to swap " << name << ": " << status.ToString();
+      return status;
+    }
+  }
+
+  RemoveDBDirectory(env, retired_path);
+  LOG(INFO) << "[INGEST] " << name << ": " << tables.size() << " tables";
+  return base::Status::OK();
+}
+
 Database::Iterator* Database::NewIterator(const std::string& name) {
   base::mutex_lock l(mu_);
+  while (draining_.count(name) > 0) {
+    drain_cv_.wait(l);
+  }
   auto it = db_map_.find(name);
   if (it == db_map_.end()) {
     LOG(WARNING) << "Not existed: " << name;
     return nullptr;
   }
-  return new Database::Iterator(it->second.get(), leveldb::ReadOptions());
+  iterators_[name]++;
+  return new Database::Iterator(this, name, it->second.get(), leveldb::ReadOptions());
+}
+
+void Database::ReleaseIterator(const std::string& name) {
+  base::mutex_lock l(mu_);
+  auto it = iterators_.find(name);
+  DCHECK(it != iterators_.end());
+  if (--it->second == 0) {
+    iterators_.erase(it);
+    drain_cv_.notify_all();
+  }
+}
+
+void Database::DoDrainIterators(const std::string& name, base::mutex_lock* l) {
+  // 同一个 namespace 上的切换和关闭依次进行
+  while (draining_.count(name) > 0) {
+    drain_cv_.wait(*l);
+  }
+  draining_.insert(name);
+  while (iterators_.count(name) > 0) {
+    drain_cv_.wait(*l);
+  }
+}
+
+void Database::DoEndDrain(const std::string& name) {
+  draining_.erase(name);
+  drain_cv_.notify_all();
+}
+
+std::string Database::DoGetDBPath(const std::string& name) const {
+  return base::io::JoinPath(db_path_, name + std::string("@db"));
+}
+
+leveldb::Env* Database::DoGetEnv() const {
+  return env_ != nullptr ? env_ : leveldb::Env::Default();
+}
+
+base::Status Database::DoLoadTable(leveldb::DB* db, const std::string& table_file,
+                                   uint64_t expected_size) {
+  leveldb::Env* env = DoGetEnv();
+  if (!env->FileExists(table_file)) {
+    return base::errors::NotFound("ingest table ", table_file, " not found");
+  }
+  uint64_t file_size = 0;
+  RETURN_IF_ERROR(FromLevelDB(env->GetFileSize(table_file, &file_size)));
+  if (file_size != expected_size) {
+    return base::errors::DataLoss("ingest table ", table_file, " has ", file_size,
+                                  " bytes, expected ", expected_size);
+  }
+  leveldb::RandomAccessFile* raw_file = nullptr;
+  RETURN_IF_ERROR(FromLevelDB(env->NewRandomAccessFile(table_file, &raw_file)));
+  std::unique_ptr<TableFile> file(new TableFile(raw_file));
+  base::table::Table* raw_table = nullptr;
+  // 内容损坏时 base::table 返回 DataLoss, 读取失败的错误原样返回
+  RETURN_IF_ERROR(base::table::Table::Open(base::table::Options(), file.get(),
+                                           file_size, &raw_table));
+  std::unique_ptr<base::table::Table> table(raw_table);
+  std::unique_ptr<base::table::Iterator> iter(table->NewIterator());
+
+  leveldb::WriteBatch batch;
+  leveldb::WriteOptions write_options;
+  leveldb::Status status;
+  for (iter->SeekToFirst(); iter->Valid(); iter->Next()) {
+    batch.Put(leveldb::Slice(iter->key().data(), iter->key().size()),
+              leveldb::Slice(iter->value().data(), iter->value().size()));
+    if (batch.ApproximateSize() >= kIngestBatchBytes) {
+      status = db->Write(write_options, &batch);
+      if (!status.ok()) {
+        return base::errors::Internal("leveldb: " + status.ToString());
+      }
+      batch.Clear();
+    }
+  }
+  RETURN_IF_ERROR(iter->status());
+  write_options.sync = true;
+  status = db->Write(write_options, &batch);
+  if (!status.ok()) {
+    return base::errors::Internal("leveldb: " + status.ToString());
+  }
+  return base::Status::OK();
 }
 
 void Database::DoOpenDB(std::unique_ptr<leveldb::DB>* result, const std::string& name) {
-  std::string full_name = base::io::JoinPath(db_path_, name + std::string("@db"));        
+  std::string full_name = DoGetDBPath(name);
   leveldb::Options options;                                           
   options.create_if_missing = true;                                   
   if (FLAGS_chubby_data_compress) {                                   
@@ -163,6 +423,9 @@ void Database::DoOpenDB(std::unique_ptr<leveldb::DB>* result, const std::string&
   }                                                                   
   options.write_buffer_size = FLAGS_chubby_data_write_buffer_size * 1024 * 1024;
   options.block_size = FLAGS_chubby_data_block_size * 1024;           
+  if (env_ != nullptr) {
+    options.env = env_;
+  }
   LOG(INFO) << "[data]: block_size: " << options.block_size << ", writer_buffer_size: " << options.write_buffer_size;
   leveldb::DB* db = nullptr;                                          
   leveldb::Status status = leveldb::DB::Open(options, full_name, &db);
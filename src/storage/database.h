@@ -1,42 +1,60 @@
 #ifndef MPR_CHUBBY_STORAGE_DATABASE_H_
 #define MPR_CHUBBY_STORAGE_DATABASE_H_
 
+#include <set>
 #include <unordered_map>
+#include <vector>
 #include <functional>
 #include <memory>
 
 #include <leveldb/db.h>
+#include <leveldb/write_batch.h>
 
 #include "proto/service.pb.h"
 #include "base/status.h"
 #include "base/platform/mutex.h"
+#include "storage/bulk_loader.h"
 
 namespace mpr {
 namespace chubby {
 
 class Database {
  public:
-  Database(const std::string& db_path);
+  // env 为空时使用磁盘
+  Database(const std::string& db_path, leveldb::Env* env = nullptr);
   ~Database();
 
   bool Open(const std::string& name);
+  // 等待该 namespace 上的 Iterator 都释放后关闭
   void Close(const std::string& name);
 
   base::Status Get(const std::string& name, const std::string& key, std::string* value);
   base::Status Put(const std::string& name, const std::string& key, const std::string& value);
   base::Status Delete(const std::string& name, const std::string& key);
+  // 原子地写入一批修改
+  base::Status Write(const std::string& name, leveldb::WriteBatch* batch);
+
+  // 用 base::table 格式的表整体替换 namespace 的内容. 表按顺序导入,
+  // 重复的 key 以后面的表为准. 不是文件级的导入: 表中的记录逐条读出, 用
+  // WriteBatch 写入旁路的 leveldb, 代价与同样多的 Put 相当, 只是不经过日志.
+  // 只有最后的切换持有 mu_, 其他读写不会看到导入一半的数据; 切换前等待该
+  // namespace 上的 Iterator 都释放, 期间新的 NewIterator 等待切换完成. 表是
+  // table_dir 下的 tables[i].name, 表文件和数据目录都通过构造时的 env 访问.
+  //
+  // 对同样的文件重试得到同样结果的错误: 名字不合法返回 InvalidArgument, 表
+  // 不存在返回 NotFound, 大小不符或者内容损坏返回 DataLoss. 其他错误 (例如
+  // 读写失败) 可以重试. 失败时 namespace 保留原有内容.
+  base::Status Ingest(const std::string& name, const std::string& table_dir,
+                      const std::vector<IngestTable>& tables);
 
   static const std::string kAnonymousUser;
  public:
 
+  // 持有期间 namespace 不会被 Ingest 或 Close 替换, 用完后尽快释放
   class Iterator {
    public:
-    Iterator() : iterator_(nullptr) {}
-    Iterator(leveldb::DB* db, const leveldb::ReadOptions& options)
-      : iterator_(db->NewIterator(options)) {}
+    ~Iterator();
 
-    ~Iterator() {}
-    
     std::string key() const;
     std::string value() const;
 
@@ -47,18 +65,40 @@ class Database {
     base::Status status() const;
 
    private:
+    friend class Database;
+    Iterator(Database* database, const std::string& name, leveldb::DB* db,
+             const leveldb::ReadOptions& options);
+
+    Database* database_;
+    const std::string name_;
     std::unique_ptr<leveldb::Iterator> iterator_;
     DISALLOW_COPY_AND_ASSIGN(Iterator);
   };
 
+  // namespace 不存在时返回 nullptr
   Iterator* NewIterator(const std::string& name);
 
  private:
   base::mutex mu_;
   std::string db_path_;
+  leveldb::Env* env_;
   std::unordered_map<std::string, std::unique_ptr<leveldb::DB>> db_map_;
+  // namespace -> 未释放的 Iterator 数
+  std::unordered_map<std::string, int> iterators_;
+  // 正在切换或关闭的 namespace, NewIterator 等待
+  std::set<std::string> draining_;
+  // Iterator 释放或者切换完成时通知
+  base::condition_variable drain_cv_;
 
   void DoOpenDB(std::unique_ptr<leveldb::DB>* result, const std::string& name="");
+  std::string DoGetDBPath(const std::string& name) const;
+  leveldb::Env* DoGetEnv() const;
+  base::Status DoLoadTable(leveldb::DB* db, const std::string& table_file,
+                           uint64_t expected_size);
+  // 阻止新的 Iterator 并等待已有的释放, 之后调用者需要 DoEndDrain
+  void DoDrainIterators(const std::string& name, base::mutex_lock* l);
+  void DoEndDrain(const std::string& name);
+  void ReleaseIterator(const std::string& name);
 
   DISALLOW_COPY_AND_ASSIGN(Database);
 };
@@ -1,8 +1,15 @@
 #include "storage/meta.h"
 
+#include <algorithm>
+#include <vector>
+
+#include "base/errors.h"
 #include "base/logging.h"
 #include "server/user_manager.h"
 #include "base/io/path.h"
+#include "base/string_encode.h"
+#include "base/strings/numbers.h"
+#include "base/strings/str_util.h"
 
 namespace mpr {
 namespace chubby {
@@ -10,30 +17,114 @@ namespace chubby {
 const std::string kTermFileName("term.data");
 const std::string kVoteFileName("vote.data");
 const std::string kRootFileName("root.data");
+const std::string kTokenKeyFileName("token_key.data");
 
 Meta::Meta(const std::string& db_path)
     : db_path_(db_path) {
-  base::Status status = base::Env::Default()->CreateDirectory(db_path_);
+  base::Status status = base::Env::Default()->CreateDirectoryRecursively(db_path_);
   DCHECK(status.ok() || status.code() == base::error::ALREADY_EXISTS) << "Failed to create directory: " << db_path_;
 
-  std::unique_ptr<base::WritableFile> term_file;
-  std::unique_ptr<base::WritableFile> vote_file;
-  std::unique_ptr<base::WritableFile> root_file;
-  
-  DCHECK(base::Env::Default()->NewAppendableFile(base::io::JoinPath(db_path_, kTermFileName), &term_file)
-         .ok()) << "Failed to create appendable file: " << base::io::JoinPath(db_path_, kTermFileName);
-  DCHECK(base::Env::Default()->NewAppendableFile(base::io::JoinPath(db_path_, kVoteFileName), &vote_file)
-         .ok()) << "Failed to create appendable file: " << base::io::JoinPath(db_path_, kVoteFileName);
-  DCHECK(base::Env::Default()->NewWritableFile(base::io::JoinPath(db_path_, kRootFileName), &root_file)
-         .ok()) << "Failed to create appendable file: " << base::io::JoinPath(db_path_, kRootFileName);
-  term_file_ = std::move(term_file);
-  vote_file_ = std::move(vote_file);
-  root_file_ = std::move(root_file);
+  // DCHECK 在 release 下不求值, 打开文件不能放在里面
+  status = base::Env::Default()->NewAppendableFile(
+      base::io::JoinPath(db_path_, kTermFileName), &term_file_);
+  DCHECK(status.ok()) << "Failed to create appendable file: " << base::io::JoinPath(db_path_, kTermFileName);
+  status = base::Env::Default()->NewAppendableFile(
+      base::io::JoinPath(db_path_, kVoteFileName), &vote_file_);
+  DCHECK(status.ok()) << "Failed to create appendable file: " << base::io::JoinPath(db_path_, kVoteFileName);
+  status = base::Env::Default()->NewWritableFile(
+      base::io::JoinPath(db_path_, kRootFileName), &root_file_);
+  DCHECK(status.ok()) << "Failed to create appendable file: " << base::io::JoinPath(db_path_, kRootFileName);
+  status = base::Env::Default()->NewAppendableFile(
+      base::io::JoinPath(db_path_, kTokenKeyFileName), &token_key_file_);
+  DCHECK(status.ok()) << "Failed to create appendable file: " << base::io::JoinPath(db_path_, kTokenKeyFileName);
+}
+
+Meta::~Meta() {
+  for (base::WritableFile* file : {term_file_.get(), vote_file_.get(),
+                                   root_file_.get(), token_key_file_.get()}) {
+    if (file != nullptr) {
+      file->Close();
+    }
+  }
+}
+
+namespace {
+
+// 追加写的文件末尾可能有写了一半的行, 解析失败的行被忽略
+std::vector<std::string> ReadLines(const std::string& fname) {
+  std::string data;
+  base::Status status = base::ReadFileToString(base::Env::Default(), fname, &data);
+  if (!status.ok()) {
+    LOG(WARNING) << "[Meta] Failed to read " << fname << ": " << status.ToString();
+    return std::vector<std::string>();
+  }
+  return base::strings::Split(data, '\n', base::strings::SkipEmpty());
+}
+
+base::Status AppendAndSync(base::WritableFile* file, const std::string& line) {
+  RETURN_IF_ERROR(file->Append(line));
+  RETURN_IF_ERROR(file->Flush());
+  return file->Sync();
 }
 
+} // namespace
+
 int64_t Meta::ReadCurrentTerm() {
-  int64_t current_term = 0, tmp = 0;
-  //while (term_file_->
+  int64_t current_term = 0;
+  base::int64 tmp = 0;
+  for (const std::string& line :
+       ReadLines(base::io::JoinPath(db_path_, kTermFileName))) {
+    if (base::strings::safe_strto64(line, &tmp)) {
+      current_term = std::max<int64_t>(current_term, tmp);
+    }
+  }
+  return current_term;
+}
+
+void Meta::ReadVotedFor(std::map<int64_t, std::string>& voted_for) {
+  base::int64 term = 0;
+  for (const std::string& line :
+       ReadLines(base::io::JoinPath(db_path_, kVoteFileName))) {
+    std::vector<std::string> fields = base::strings::Split(line, ' ');
+    if (fields.size() != 2 || !base::strings::safe_strto64(fields[0], &term)) {
+      continue;
+    }
+    voted_for[term] = fields[1];
+  }
+}
+
+base::Status Meta::ReadTokenKey(int64_t* epoch, std::string* key) {
+  bool found = false;
+  base::int64 tmp = 0;
+  for (const std::string& line :
+       ReadLines(base::io::JoinPath(db_path_, kTokenKeyFileName))) {
+    std::vector<std::string> fields = base::strings::Split(line, ' ');
+    if (fields.size() != 2 || !base::strings::safe_strto64(fields[0], &tmp)) {
+      continue;
+    }
+    std::string decoded = base::HexDecode(fields[1]);
+    if (decoded.empty()) {
+      continue;
+    }
+    *epoch = tmp;
+    key->swap(decoded);
+    found = true;
+  }
+  return found ? base::Status::OK() : base::errors::NotFound("no token key");
+}
+
+base::Status Meta::WriteCurrentTerm(int64_t term) {
+  return AppendAndSync(term_file_.get(), std::to_string(term) + "\n");
+}
+
+base::Status Meta::WriteVotedFor(int64_t term, const std::string& server_id) {
+  return AppendAndSync(vote_file_.get(),
+                       std::to_string(term) + " " + server_id + "\n");
+}
+
+base::Status Meta::WriteTokenKey(int64_t epoch, const std::string& key) {
+  return AppendAndSync(token_key_file_.get(),
+                       std::to_string(epoch) + " " + base::HexEncode(key) + "\n");
 }
 
 } // namespace chubby
@@ -10,23 +10,34 @@ namespace chubby {
 
 class UserManager;
 
+// 节点的 term, 投票和 root 用户信息.
+//
+// term 和投票每次变化追加一行并 sync, 一次选举只需要一次小的顺序写.
+// 读取时以最后一行为准. 会话 token 的签名密钥也以同样的方式保存, 内容来自
+// 复制的 kTokenKey 日志 (见 SessionTokens::Apply).
 class Meta {
  public:
   Meta(const std::string& db_path);
   ~Meta();
   
+  // 没有记录时返回 0
   int64_t ReadCurrentTerm();
   void ReadVotedFor(std::map<int64_t, std::string>& voted_for);
   UserInfo ReadRootInfo();
-  void WriteCurrentTerm(int64_t term);
-  void WriteVotedFor(int64_t term, const std::string& server_id);
+  // 返回前已经 sync
+  base::Status WriteCurrentTerm(int64_t term);
+  base::Status WriteVotedFor(int64_t term, const std::string& server_id);
   void WriteRootInfo(const UserInfo& root);
+  // 没有记录时返回 NotFound
+  base::Status ReadTokenKey(int64_t* epoch, std::string* key);
+  base::Status WriteTokenKey(int64_t epoch, const std::string& key);
 
  private:
   std::string db_path_;
   std::unique_ptr<base::WritableFile> term_file_;
   std::unique_ptr<base::WritableFile> vote_file_;
   std::unique_ptr<base::WritableFile> root_file_;
+  std::unique_ptr<base::WritableFile> token_key_file_;
 
   DISALLOW_COPY_AND_ASSIGN(Meta);
 };
@@ -2,6 +2,7 @@
 #include "base/io/path.h"
 #include "base/platform/env.h"
 
+#include "storage/meta.h"
 #include "storage/meta_file_interface.h"
 #include "storage/meta_file.h"
 
@@ -51,7 +52,49 @@ TEST(Term, ReadWrite) {
 }
 
 TEST(Vote, ReadWrite) {
-  EXPECT_TRUE(true);
+  const std::string meta_dir = base::io::JoinPath("/tmp", "meta_vote_test");
+  base::int64 undeleted_files, undeleted_dirs;
+  base::Env::Default()->DeleteDirectoryRecursively(meta_dir, &undeleted_files,
+                                                   &undeleted_dirs);
+  {
+    Meta meta(meta_dir);
+    EXPECT_EQ(0, meta.ReadCurrentTerm());
+    ASSERT_TRUE(meta.WriteCurrentTerm(3).ok());
+    ASSERT_TRUE(meta.WriteVotedFor(3, "node1").ok());
+    ASSERT_TRUE(meta.WriteCurrentTerm(5).ok());
+    ASSERT_TRUE(meta.WriteVotedFor(5, "node2").ok());
+  }
+
+  // 重新打开后继续追加
+  Meta meta(meta_dir);
+  EXPECT_EQ(5, meta.ReadCurrentTerm());
+  ASSERT_TRUE(meta.WriteVotedFor(6, "node0").ok());
+  std::map<int64_t, std::string> voted_for;
+  meta.ReadVotedFor(voted_for);
+  ASSERT_EQ(3u, voted_for.size());
+  EXPECT_EQ("node1", voted_for[3]);
+  EXPECT_EQ("node2", voted_for[5]);
+  EXPECT_EQ("node0", voted_for[6]);
+}
+
+TEST(TokenKey, ReadWrite) {
+  const std::string meta_dir = base::io::JoinPath("/tmp", "meta_token_key_test");
+  base::int64 undeleted_files, undeleted_dirs;
+  base::Env::Default()->DeleteDirectoryRecursively(meta_dir, &undeleted_files,
+                                                   &undeleted_dirs);
+  int64_t epoch = 0;
+  std::string key;
+  {
+    Meta meta(meta_dir);
+    EXPECT_EQ(base::error::NOT_FOUND, meta.ReadTokenKey(&epoch, &key).code());
+    ASSERT_TRUE(meta.WriteTokenKey(1, std::string("k\0ey1", 5)).ok());
+    ASSERT_TRUE(meta.WriteTokenKey(2, "key2").ok());
+  }
+  // 以最后一行为准
+  Meta meta(meta_dir);
+  ASSERT_TRUE(meta.ReadTokenKey(&epoch, &key).ok());
+  EXPECT_EQ(2, epoch);
+  EXPECT_EQ("key2", key);
 }
 
 TEST(RootInfo, ReadWrite) {
@@ -0,0 +1,62 @@
+// 离线把 key/value dump (格式见 storage/bulk_loader.h) 转成 base::table
+// 格式的表. output_dir 必须在各副本共享的 --ingest_dir (即副本上的
+// --chubby_ingest_dir) 之内; 输出每张表相对于它的路径和大小, --payload 不为
+// 空时把编码后的引用写入该文件, 可直接作为 kIngest 日志的 value 提交.
+#include <gflags/gflags.h>
+
+#include "base/logging.h"
+#include "base/platform/env.h"
+#include "storage/bulk_loader.h"
+
+DEFINE_string(dump, "", "key/value dump file");
+DEFINE_string(output_dir, "", "directory for generated tables");
+DEFINE_string(ingest_dir, "", "shared directory replicas ingest from, containing --output_dir");
+DEFINE_string(payload, "", "file to write the encoded kIngest value to");
+DEFINE_string(prefix, "bulk", "file name prefix of generated tables");
+DEFINE_int32(table_size_mb, 64, "max bytes sorted in memory per table, MB");
+DEFINE_bool(compress, true, "enable snappy compression in generated tables");
+
+int main(int argc, char* argv[]) {
+  google::ParseCommandLineFlags(&argc, &argv, true);
+  google::InitGoogleLogging(argv[0]);
+
+  if (FLAGS_dump.empty() || FLAGS_output_dir.empty() || FLAGS_ingest_dir.empty()) {
+    LOG(ERROR) << "--dump, --output_dir and --ingest_dir are required";
+    return 1;
+  }
+
+  mpr::chubby::BulkLoadOptions options;
+  options.max_table_bytes = static_cast<size_t>(FLAGS_table_size_mb) * 1024 * 1024;
+  options.table_options.compression = FLAGS_compress ?
+      base::table::kSnappyCompression : base::table::kNoCompression;
+
+  std::vector<std::string> table_files;
+  base::Status status = mpr::chubby::BuildTablesFromDump(FLAGS_dump,
+                                                         FLAGS_output_dir,
+                                                         FLAGS_prefix,
+                                                         options,
+                                                         &table_files);
+  if (!status.ok()) {
+    LOG(ERROR) << "Failed to build tables: " << status.ToString();
+    return 1;
+  }
+  std::vector<mpr::chubby::IngestTable> tables;
+  status = mpr::chubby::MakeIngestTables(FLAGS_ingest_dir, table_files, &tables);
+  if (!status.ok()) {
+    LOG(ERROR) << "Failed to reference tables: " << status.ToString();
+    return 1;
+  }
+  for (const auto& table : tables) {
+    printf("%s\t%llu\n", table.name.c_str(),
+           static_cast<unsigned long long>(table.size));
+  }
+  if (!FLAGS_payload.empty()) {
+    status = base::WriteStringToFile(base::Env::Default(), FLAGS_payload,
+                                     mpr::chubby::EncodeIngestTables(tables));
+    if (!status.ok()) {
+      LOG(ERROR) << "Failed to write " << FLAGS_payload << ": " << status.ToString();
+      return 1;
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,130 @@
+// 聚合客户端会话的 proxy. 客户端把 proxy 当作 leader 使用, 请求格式与
+// HttpChannel 相同: POST 序列化的请求到 /chubby/<方法>.
+//
+// 上游会话以 --uuid 登录集群, uuid 由 --username 登录得到. proxy 只服务这个
+// 用户, 客户端的 uuid 必须是签发给它的 token, 用集群的 token 密钥验证: 密钥
+// 从 --token_key_file 读出, --token_epoch 是集群当前的 epoch, 集群更换密钥后
+// 需要更新并重启 proxy.
+//
+//   chubby_proxy --proxy_id=10.0.0.8:9990 --uuid=<uuid> --username=alice
+//       --token_key_file=/etc/chubby/token_key --token_epoch=3
+//       --nodes=10.0.0.1:9980,10.0.0.2:9980
+#include <gflags/gflags.h>
+
+#include <event2/buffer.h>
+#include <event2/event.h>
+#include <evhtp.h>
+
+#include "base/logging.h"
+#include "base/platform/env.h"
+#include "base/strings/str_util.h"
+#include "client/http_channel.h"
+#include "proxy/chubby_proxy.h"
+
+DEFINE_string(proxy_id, "", "address clients use to reach this proxy, host:port");
+DEFINE_string(nodes, "", "comma separated host:port of the cell");
+DEFINE_string(uuid, "", "uuid the proxy logged in to the cell with");
+DEFINE_string(username, "", "user of --uuid, the only user the proxy serves");
+DEFINE_string(token_key_file, "", "file holding the cell's session token key");
+DEFINE_int64(token_epoch, 0, "current session token epoch of the cell");
+DEFINE_string(bind_address, "0.0.0.0", "address to listen on");
+DEFINE_int32(port, 9990, "port to listen on");
+DEFINE_int32(threads, 16, "request threads; a blocked Lock holds one");
+DEFINE_int32(upstream_timeout_ms, 10000, "timeout of requests to the cell, ms");
+
+namespace mpr {
+namespace chubby {
+namespace {
+
+template <typename Request, typename Response,
+          void (ChubbyProxy::*Method)(const Request&, Response*)>
+void Handle(evhtp_request_t* request, void* arg) {
+  ChubbyProxy* proxy = static_cast<ChubbyProxy*>(arg);
+  const size_t length = evbuffer_get_length(request->buffer_in);
+  std::string body(length, '\0');
+  if (length > 0) {
+    evbuffer_copyout(request->buffer_in, &body[0], length);
+  }
+  Request proxy_request;
+  if (!proxy_request.ParseFromString(body)) {
+    evhtp_send_reply(request, EVHTP_RES_400);
+    return;
+  }
+  Response proxy_response;
+  (proxy->*Method)(proxy_request, &proxy_response);
+  std::string out;
+  proxy_response.SerializeToString(&out);
+  evbuffer_add(request->buffer_out, out.data(), out.size());
+  evhtp_send_reply(request, EVHTP_RES_OK);
+}
+
+} // namespace
+} // namespace chubby
+} // namespace mpr
+
+int main(int argc, char* argv[]) {
+  google::ParseCommandLineFlags(&argc, &argv, true);
+  google::InitGoogleLogging(argv[0]);
+  using mpr::chubby::ChubbyProxy;
+  using mpr::chubby::Handle;
+
+  mpr::chubby::HttpChannel::Options channel_options;
+  channel_options.timeout_micros = FLAGS_upstream_timeout_ms * 1000LL;
+  mpr::chubby::HttpChannel channel(channel_options);
+
+  CHECK(!FLAGS_username.empty()) << "--username is required";
+  CHECK(!FLAGS_token_key_file.empty()) << "--token_key_file is required";
+  mpr::chubby::SessionTokens::Options token_options;
+  token_options.epoch = FLAGS_token_epoch;
+  base::Status status = base::ReadFileToString(
+      base::Env::Default(), FLAGS_token_key_file, &token_options.key);
+  CHECK(status.ok()) << "read " << FLAGS_token_key_file << ": " << status.ToString();
+  mpr::chubby::SessionTokens tokens(token_options);
+
+  ChubbyProxy::Options options;
+  options.proxy_id = FLAGS_proxy_id;
+  options.nodes = base::strings::Split(FLAGS_nodes, ',');
+  options.uuid = FLAGS_uuid;
+  options.username = FLAGS_username;
+  options.tokens = &tokens;
+  CHECK(!options.proxy_id.empty()) << "--proxy_id is required";
+  CHECK(!FLAGS_nodes.empty()) << "--nodes is required";
+  CHECK(!FLAGS_uuid.empty()) << "--uuid is required";
+  ChubbyProxy proxy(options, &channel);
+
+  evbase_t* ev_base = event_base_new();
+  evhtp_t* htp = evhtp_new(ev_base, nullptr);
+  CHECK(ev_base);
+  CHECK(htp);
+  evhtp_set_cb(htp, "/chubby/Get",
+               Handle<mpr::chubby::GetRequest, mpr::chubby::GetResponse,
+                      &ChubbyProxy::Get>, &proxy);
+  evhtp_set_cb(htp, "/chubby/Put",
+               Handle<mpr::chubby::PutRequest, mpr::chubby::PutResponse,
+                      &ChubbyProxy::Put>, &proxy);
+  evhtp_set_cb(htp, "/chubby/Delete",
+               Handle<mpr::chubby::DelRequest, mpr::chubby::DelResponse,
+                      &ChubbyProxy::Delete>, &proxy);
+  evhtp_set_cb(htp, "/chubby/Lock",
+               Handle<mpr::chubby::LockRequest, mpr::chubby::LockResponse,
+                      &ChubbyProxy::Lock>, &proxy);
+  evhtp_set_cb(htp, "/chubby/UnLock",
+               Handle<mpr::chubby::UnLockRequest, mpr::chubby::UnLockResponse,
+                      &ChubbyProxy::UnLock>, &proxy);
+  evhtp_set_cb(htp, "/chubby/KeepAlive",
+               Handle<mpr::chubby::KeepAliveRequest,
+                      mpr::chubby::KeepAliveResponse,
+                      &ChubbyProxy::KeepAlive>, &proxy);
+  // 上游请求是同步的, 在 evhtp 的线程池中处理
+  evhtp_use_threads(htp, nullptr, FLAGS_threads, nullptr);
+
+  LOG(INFO) << "Proxy " << FLAGS_proxy_id << " run at: " << FLAGS_bind_address
+            << ":" << FLAGS_port;
+  CHECK_EQ(0, evhtp_bind_socket(htp, FLAGS_bind_address.c_str(), FLAGS_port, 2046));
+  event_base_loop(ev_base, 0);
+
+  evhtp_unbind_socket(htp);
+  evhtp_free(htp);
+  event_base_free(ev_base);
+  return 0;
+}
@@ -0,0 +1,97 @@
+// 在模拟网络上运行共识组, 报告吞吐, 提交延迟和故障切换时间. 时间是虚拟
+// 的, 同样的参数总是得到同样的结果, 可以在提交前对比性能回退.
+//
+//   chubby_sim --scenario=failover --nodes=5 --latency_us=2000 --loss=0.001
+#include <gflags/gflags.h>
+
+#include "base/logging.h"
+#include "sim/sim_cluster.h"
+
+DEFINE_string(scenario, "steady", "steady, failover, transfer, partition or flaky");
+DEFINE_int32(nodes, 3, "number of nodes");
+DEFINE_uint64(seed, 301, "random seed of the simulated network");
+DEFINE_int32(duration_ms, 10000, "virtual time to run the workload, ms");
+DEFINE_int32(clients, 64, "concurrent clients, each with one outstanding Put");
+DEFINE_int32(value_bytes, 128, "value size of each Put");
+DEFINE_int32(latency_us, 500, "one-way link latency, us");
+DEFINE_int32(jitter_us, 100, "uniform jitter added to the latency, us");
+DEFINE_double(loss, 0, "message loss rate");
+DEFINE_int32(bandwidth_mbps, 0, "link bandwidth, Mbit/s; 0 for unlimited");
+DEFINE_int32(append_us, 50, "time a follower spends on one AppendEntries, us");
+DEFINE_int32(election_timeout_min_ms, 150, "lower bound of the election timeout, ms");
+DEFINE_bool(pre_vote, true, "run a pre-vote before bumping the term");
+
+namespace mpr {
+namespace chubby {
+namespace {
+
+// 各场景在 duration 的中间注入故障
+void RunScenario(SimCluster* cluster, int64_t duration_micros) {
+  const std::string leader = cluster->leader();
+  if (FLAGS_scenario == "steady") {
+    cluster->RunFor(duration_micros);
+  } else if (FLAGS_scenario == "failover") {
+    cluster->RunFor(duration_micros / 2);
+    cluster->Crash(leader);
+    cluster->RunFor(duration_micros / 2);
+  } else if (FLAGS_scenario == "transfer") {
+    // 滚动重启前主动交出领导权, 与 failover 对比不可用时间
+    cluster->RunFor(duration_micros / 2);
+    cluster->TransferLeadership(cluster->node_ids().back());
+    cluster->RunFor(duration_micros / 2);
+  } else if (FLAGS_scenario == "partition") {
+    // leader 被隔离一段时间后恢复
+    cluster->RunFor(duration_micros / 4);
+    cluster->network()->Partition({leader});
+    cluster->RunFor(duration_micros / 2);
+    cluster->network()->Heal();
+    cluster->RunFor(duration_micros / 4);
+  } else if (FLAGS_scenario == "flaky") {
+    // 一个 follower 反复宕机和恢复
+    const std::string follower = cluster->node_ids().back();
+    for (int i = 0; i < 10; ++i) {
+      cluster->RunFor(duration_micros / 20);
+      cluster->Crash(follower);
+      cluster->RunFor(duration_micros / 20);
+      cluster->Restart(follower);
+    }
+  } else {
+    LOG(FATAL) << "unknown scenario: " << FLAGS_scenario;
+  }
+}
+
+} // namespace
+} // namespace chubby
+} // namespace mpr
+
+int main(int argc, char* argv[]) {
+  google::ParseCommandLineFlags(&argc, &argv, true);
+  google::InitGoogleLogging(argv[0]);
+
+  mpr::chubby::SimOptions options;
+  options.nodes = FLAGS_nodes;
+  options.seed = FLAGS_seed;
+  options.link.latency_micros = FLAGS_latency_us;
+  options.link.jitter_micros = FLAGS_jitter_us;
+  options.link.loss = FLAGS_loss;
+  options.link.bandwidth_bytes_per_sec =
+      static_cast<int64_t>(FLAGS_bandwidth_mbps) * 1000 * 1000 / 8;
+  options.append_micros = FLAGS_append_us;
+  options.election.min_timeout_micros =
+      static_cast<int64_t>(FLAGS_election_timeout_min_ms) * 1000;
+  options.pre_vote = FLAGS_pre_vote;
+
+  mpr::chubby::SimWorkload workload;
+  workload.clients = FLAGS_clients;
+  workload.value_bytes = FLAGS_value_bytes;
+
+  mpr::chubby::SimCluster cluster(options);
+  cluster.Start();
+  cluster.StartWorkload(workload);
+  mpr::chubby::RunScenario(&cluster,
+                           static_cast<int64_t>(FLAGS_duration_ms) * 1000);
+  cluster.StopWorkload();
+
+  printf("%s: %s\n", FLAGS_scenario.c_str(), cluster.Report().ToString().c_str());
+  return 0;
+}